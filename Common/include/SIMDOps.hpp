@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+// Thin wrappers over SSE2, AVX2 and NEON intrinsics that let the same kernel
+// be instantiated for every instruction set. All operations work on float lanes;
+// comparisons return masks with all bits of the lane set or cleared.
+
+#include <cstring>
+
+#include "BasicTypes.h"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+// Scalar fallback that processes one lane at a time
+struct ScalarOps
+{
+    using Vec = float;
+
+    static constexpr size_t Width = 1;
+
+    // clang-format off
+    static Vec    Load     (const float* p)   { return *p; }
+    static void   Store    (float* p, Vec v)  { *p = v; }
+    static Vec    Set      (float f)          { return f; }
+    static Vec    Zero     ()                 { return 0; }
+    static Vec    AllOnes  ()                 { return FromBits(~0u); }
+    static Vec    Add      (Vec a, Vec b)     { return a + b; }
+    static Vec    Sub      (Vec a, Vec b)     { return a - b; }
+    static Vec    Mul      (Vec a, Vec b)     { return a * b; }
+    static Vec    Min      (Vec a, Vec b)     { return a < b ? a : b; }
+    static Vec    Max      (Vec a, Vec b)     { return a > b ? a : b; }
+    static Vec    And      (Vec a, Vec b)     { return FromBits(ToBits(a) & ToBits(b)); }
+    static Vec    Or       (Vec a, Vec b)     { return FromBits(ToBits(a) | ToBits(b)); }
+    static Vec    Less     (Vec a, Vec b)     { return FromBits(a < b ? ~0u : 0u); }
+    static Vec    LessEqual(Vec a, Vec b)     { return FromBits(a <= b ? ~0u : 0u); }
+    static Vec    Select   (Vec m, Vec a, Vec b) { return ToBits(m) != 0 ? a : b; }
+    static Uint32 MoveMask (Vec a)            { return ToBits(a) >> 31u; }
+    // clang-format on
+
+private:
+    static Uint32 ToBits(float f)
+    {
+        Uint32 u;
+        memcpy(&u, &f, sizeof(u));
+        return u;
+    }
+    static float FromBits(Uint32 u)
+    {
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+};
+
+#if DILIGENT_AVX2_ENABLED
+struct AVX2Ops
+{
+    using Vec = __m256;
+
+    static constexpr size_t Width = 8;
+
+    // clang-format off
+    static Vec    Load     (const float* p)   { return _mm256_loadu_ps(p); }
+    static void   Store    (float* p, Vec v)  { _mm256_storeu_ps(p, v); }
+    static Vec    Set      (float f)          { return _mm256_set1_ps(f); }
+    static Vec    Zero     ()                 { return _mm256_setzero_ps(); }
+    static Vec    AllOnes  ()                 { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static Vec    Add      (Vec a, Vec b)     { return _mm256_add_ps(a, b); }
+    static Vec    Sub      (Vec a, Vec b)     { return _mm256_sub_ps(a, b); }
+    static Vec    Mul      (Vec a, Vec b)     { return _mm256_mul_ps(a, b); }
+    static Vec    Min      (Vec a, Vec b)     { return _mm256_min_ps(a, b); }
+    static Vec    Max      (Vec a, Vec b)     { return _mm256_max_ps(a, b); }
+    static Vec    And      (Vec a, Vec b)     { return _mm256_and_ps(a, b); }
+    static Vec    Or       (Vec a, Vec b)     { return _mm256_or_ps(a, b); }
+    static Vec    Less     (Vec a, Vec b)     { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Vec    LessEqual(Vec a, Vec b)     { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Vec    Select   (Vec m, Vec a, Vec b) { return _mm256_blendv_ps(b, a, m); }
+    static Uint32 MoveMask (Vec a)            { return static_cast<Uint32>(_mm256_movemask_ps(a)); }
+    // clang-format on
+};
+#endif
+
+#if DILIGENT_SSE2_ENABLED
+struct SSE2Ops
+{
+    using Vec = __m128;
+
+    static constexpr size_t Width = 4;
+
+    // clang-format off
+    static Vec    Load     (const float* p)   { return _mm_loadu_ps(p); }
+    static void   Store    (float* p, Vec v)  { _mm_storeu_ps(p, v); }
+    static Vec    Set      (float f)          { return _mm_set1_ps(f); }
+    static Vec    Zero     ()                 { return _mm_setzero_ps(); }
+    static Vec    AllOnes  ()                 { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static Vec    Add      (Vec a, Vec b)     { return _mm_add_ps(a, b); }
+    static Vec    Sub      (Vec a, Vec b)     { return _mm_sub_ps(a, b); }
+    static Vec    Mul      (Vec a, Vec b)     { return _mm_mul_ps(a, b); }
+    static Vec    Min      (Vec a, Vec b)     { return _mm_min_ps(a, b); }
+    static Vec    Max      (Vec a, Vec b)     { return _mm_max_ps(a, b); }
+    static Vec    And      (Vec a, Vec b)     { return _mm_and_ps(a, b); }
+    static Vec    Or       (Vec a, Vec b)     { return _mm_or_ps(a, b); }
+    static Vec    Less     (Vec a, Vec b)     { return _mm_cmplt_ps(a, b); }
+    static Vec    LessEqual(Vec a, Vec b)     { return _mm_cmple_ps(a, b); }
+    static Vec    Select   (Vec m, Vec a, Vec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static Uint32 MoveMask (Vec a)            { return static_cast<Uint32>(_mm_movemask_ps(a)); }
+    // clang-format on
+};
+#endif
+
+#if DILIGENT_NEON_ENABLED
+struct NEONOps
+{
+    using Vec = float32x4_t;
+
+    static constexpr size_t Width = 4;
+
+    // clang-format off
+    static Vec  Load     (const float* p)   { return vld1q_f32(p); }
+    static void Store    (float* p, Vec v)  { vst1q_f32(p, v); }
+    static Vec  Set      (float f)          { return vdupq_n_f32(f); }
+    static Vec  Zero     ()                 { return vdupq_n_f32(0); }
+    static Vec  AllOnes  ()                 { return vreinterpretq_f32_u32(vdupq_n_u32(~0u)); }
+    static Vec  Add      (Vec a, Vec b)     { return vaddq_f32(a, b); }
+    static Vec  Sub      (Vec a, Vec b)     { return vsubq_f32(a, b); }
+    static Vec  Mul      (Vec a, Vec b)     { return vmulq_f32(a, b); }
+    static Vec  Min      (Vec a, Vec b)     { return vminq_f32(a, b); }
+    static Vec  Max      (Vec a, Vec b)     { return vmaxq_f32(a, b); }
+    static Vec  And      (Vec a, Vec b)     { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+    static Vec  Or       (Vec a, Vec b)     { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+    static Vec  Less     (Vec a, Vec b)     { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+    static Vec  LessEqual(Vec a, Vec b)     { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+    static Vec  Select   (Vec m, Vec a, Vec b) { return vbslq_f32(vreinterpretq_u32_f32(m), a, b); }
+    // clang-format on
+
+    static Uint32 MoveMask(Vec a)
+    {
+        // NEON has no movemask instruction: select one bit in every lane and combine the lanes
+        static constexpr uint32_t LaneBits[] = {1, 2, 4, 8};
+
+        const uint32x4_t Bits = vandq_u32(vreinterpretq_u32_f32(a), vld1q_u32(LaneBits));
+        const uint32x2_t Or2  = vorr_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+        return vget_lane_u32(Or2, 0) | vget_lane_u32(Or2, 1);
+    }
+};
+#endif
+
+// The widest instruction set available on the target platform
+#if DILIGENT_AVX2_ENABLED
+using NativeSIMDOps = AVX2Ops;
+#elif DILIGENT_SSE2_ENABLED
+using NativeSIMDOps = SSE2Ops;
+#elif DILIGENT_NEON_ENABLED
+using NativeSIMDOps = NEONOps;
+#else
+using NativeSIMDOps = ScalarOps;
+#endif
+
+} // namespace Diligent
@@ -28,6 +28,8 @@
 #pragma once
 
 #include <float.h>
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <type_traits>
 
@@ -1255,16 +1257,40 @@ enum TRIANGULATE_POLYGON_RESULT : Uint32
 };
 DEFINE_FLAG_ENUM_OPERATORS(TRIANGULATE_POLYGON_RESULT);
 
+/// Algorithm used by the polygon triangulator to check if a vertex is an ear.
+enum TRIANGULATE_POLYGON_MODE : Uint8
+{
+    /// Every ear candidate is tested against all remaining polygon vertices.
+    ///
+    /// The complexity is O(n^2), which is the fastest option for small polygons.
+    TRIANGULATE_POLYGON_MODE_EAR_CLIPPING = 0,
+
+    /// Polygon vertices are binned into a uniform grid, and every ear candidate is only
+    /// tested against the vertices in the grid cells that overlap the candidate triangle.
+    ///
+    /// The mode is intended for large polygons, such as glyph outlines or navigation
+    /// mesh contours with thousands of vertices, where it gives close to O(n log n)
+    /// behavior. The resulting triangles are the same as in TRIANGULATE_POLYGON_MODE_EAR_CLIPPING mode.
+    TRIANGULATE_POLYGON_MODE_SPATIAL_HASH
+};
+
 /// 2D polygon triangulator.
 ///
 /// The class implements the ear-clipping algorithm to triangulate simple (i.e.
 /// non-self-intersecting) 2D polygons.
 ///
+/// The triangulator keeps its internal buffers between the calls, so that triangulating
+/// polygons repeatedly with the same object does not allocate memory once the buffers are large enough.
+///
 /// \tparam IndexType - Index type (e.g. Uint32 or Uint16).
 template <typename IndexType>
 class Polygon2DTriangulator
 {
 public:
+    explicit Polygon2DTriangulator(TRIANGULATE_POLYGON_MODE Mode = TRIANGULATE_POLYGON_MODE_EAR_CLIPPING) :
+        m_Mode{Mode}
+    {}
+
     /// Triangulates a simple polygon using the ear-clipping algorithm.
 
     /// \tparam [in] ComponentType - Vertex component type (e.g. float, double or int).
@@ -1345,20 +1371,27 @@ public:
         }
         PolygonWinding = PolygonWinding > ComponentType{0} ? ComponentType{1} : ComponentType{-1};
 
-        m_RemainingVertIds.resize(VertCount);
+        // Remaining vertices form a doubly-linked list sorted by the vertex index.
+        // Clipped vertices have negative links.
+        m_PrevVert.resize(VertCount);
+        m_NextVert.resize(VertCount);
         m_VertTypes.resize(VertCount);
         for (int i = 0; i < VertCount; ++i)
         {
-            m_RemainingVertIds[i] = i;
-            m_VertTypes[i]        = VertexType::Convexx;
+            m_PrevVert[i]  = WrapIndex(i - 1, VertCount);
+            m_NextVert[i]  = WrapIndex(i + 1, VertCount);
+            m_VertTypes[i] = VertexType::Convexx;
         }
+        // The remaining vertex with the smallest index
+        int FirstVertIdx       = 0;
+        int RemainingVertCount = VertCount;
 
-        auto CheckConvex = [&](int vert_id) {
-            const int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
+        if (m_Mode == TRIANGULATE_POLYGON_MODE_SPATIAL_HASH)
+            InitVertexGrid(Polygon);
 
-            const int Idx0 = m_RemainingVertIds[WrapIndex(vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[WrapIndex(vert_id + 0, RemainingVertCount)];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(vert_id + 1, RemainingVertCount)];
+        auto CheckConvex = [&](int Idx1) {
+            const int Idx0 = m_PrevVert[Idx1];
+            const int Idx2 = m_NextVert[Idx1];
 
             const auto& V0 = Polygon[Idx0];
             const auto& V1 = Polygon[Idx1];
@@ -1369,12 +1402,9 @@ public:
                 VertexType::Convexx;
         };
 
-        auto CheckEar = [&](int vert_id) {
-            const int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
-
-            const int Idx0 = m_RemainingVertIds[WrapIndex(vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[WrapIndex(vert_id + 0, RemainingVertCount)];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(vert_id + 1, RemainingVertCount)];
+        auto CheckEar = [&](int Idx1) {
+            const int Idx0 = m_PrevVert[Idx1];
+            const int Idx2 = m_NextVert[Idx1];
 
             VERIFY_EXPR(m_VertTypes[Idx1] == VertexType::Convexx);
 
@@ -1382,10 +1412,10 @@ public:
             const auto& V1 = Polygon[Idx1];
             const auto& V2 = Polygon[Idx2];
 
-            for (const int Idx : m_RemainingVertIds)
-            {
+            // Returns true if the vertex is inside the triangle and thus prevents it from being an ear
+            auto IsInsideTriangle = [&](int Idx) {
                 if (Idx == Idx0 || Idx == Idx1 || Idx == Idx2)
-                    continue;
+                    return false;
 
                 if (m_VertTypes[Idx] == VertexType::Convexx || m_VertTypes[Idx] == VertexType::Ear)
                 {
@@ -1399,15 +1429,41 @@ public:
                             TRIANGULATE_POLYGON_RESULT_INVALID_EAR;
                     }
 #endif
-                    continue;
+                    return false;
                 }
 
                 // Do not treat vertices exactly on the edge as inside the triangle,
                 // so that we can clip out degenerate triangles.
-                if (IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false))
+                return IsPointInsideTriangle(V0, V1, V2, Polygon[Idx], /*AllowEdges = */ false);
+            };
+
+            if (m_Mode == TRIANGULATE_POLYGON_MODE_SPATIAL_HASH)
+            {
+                // Only the vertices in the grid cells that overlap the triangle bounding box may be inside it
+                const int MinCellX = GetGridCell((std::min)({V0.x, V1.x, V2.x}), 0);
+                const int MaxCellX = GetGridCell((std::max)({V0.x, V1.x, V2.x}), 0);
+                const int MinCellY = GetGridCell((std::min)({V0.y, V1.y, V2.y}), 1);
+                const int MaxCellY = GetGridCell((std::max)({V0.y, V1.y, V2.y}), 1);
+                for (int y = MinCellY; y <= MaxCellY; ++y)
+                {
+                    for (int x = MinCellX; x <= MaxCellX; ++x)
+                    {
+                        const int Cell = y * m_GridDim[0] + x;
+                        for (int i = m_GridCellStart[Cell]; i < m_GridCellStart[Cell + 1]; ++i)
+                        {
+                            const int Idx = m_GridVerts[i];
+                            if (m_NextVert[Idx] >= 0 && IsInsideTriangle(Idx))
+                                return VertexType::Convexx;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (int i = 0, Idx = FirstVertIdx; i < RemainingVertCount; ++i, Idx = m_NextVert[Idx])
                 {
-                    // The vertex is inside the triangle
-                    return VertexType::Convexx;
+                    if (IsInsideTriangle(Idx))
+                        return VertexType::Convexx;
                 }
             }
 
@@ -1415,73 +1471,89 @@ public:
         };
 
         // First label vertices as reflex or convex
-        for (int vert_id = 0; vert_id < VertCount; ++vert_id)
+        for (int Idx = 0; Idx < VertCount; ++Idx)
         {
-            m_VertTypes[vert_id] = CheckConvex(vert_id);
+            m_VertTypes[Idx] = CheckConvex(Idx);
         }
 
-        // Next, check convex vertices for ears
-        for (int vert_id = 0; vert_id < VertCount; ++vert_id)
+        // Next, check convex vertices for ears.
+        // Ears are clipped in the order of their indices, so they are kept in a min-heap.
+        m_EarQueue.clear();
+        for (int Idx = 0; Idx < VertCount; ++Idx)
         {
-            VertexType& VertType = m_VertTypes[vert_id];
+            VertexType& VertType = m_VertTypes[Idx];
             if (VertType == VertexType::Convexx)
-                VertType = CheckEar(vert_id);
+                VertType = CheckEar(Idx);
+            if (VertType == VertexType::Ear)
+                m_EarQueue.push_back(Idx); // Indices are added in ascending order, which is a valid min-heap
         }
 
-        m_Triangles.clear();
         m_Triangles.reserve(TriangleCount * 3);
 
         // Clip ears one by one until only three vertices are left
-        while (m_RemainingVertIds.size() > 3)
+        while (RemainingVertCount > 3)
         {
-            int RemainingVertCount = static_cast<int>(m_RemainingVertIds.size());
-
-            // Find the first ear
-            int ear_vert_id = 0;
-            for (; ear_vert_id < RemainingVertCount; ++ear_vert_id)
+            // Find the ear with the smallest index. The queue may contain clipped vertices
+            // as well as vertices that are no longer ears, which are skipped.
+            int Idx1 = -1;
+            while (!m_EarQueue.empty())
             {
-                const int Idx = m_RemainingVertIds[ear_vert_id];
-                if (m_VertTypes[Idx] == VertexType::Ear)
+                std::pop_heap(m_EarQueue.begin(), m_EarQueue.end(), std::greater<int>{});
+                const int Idx = m_EarQueue.back();
+                m_EarQueue.pop_back();
+                if (m_NextVert[Idx] >= 0 && m_VertTypes[Idx] == VertexType::Ear)
+                {
+                    Idx1 = Idx;
                     break;
-            };
+                }
+            }
 
-            if (ear_vert_id == RemainingVertCount)
+            if (Idx1 < 0)
             {
                 // No ears found
                 m_Result |= TRIANGULATE_POLYGON_RESULT_NO_EAR_FOUND;
-                ear_vert_id = 0;
+                Idx1 = FirstVertIdx;
             }
 
-            const int Idx0 = m_RemainingVertIds[WrapIndex(ear_vert_id - 1, RemainingVertCount)];
-            const int Idx1 = m_RemainingVertIds[ear_vert_id];
-            const int Idx2 = m_RemainingVertIds[WrapIndex(ear_vert_id + 1, RemainingVertCount)];
+            const int Idx0 = m_PrevVert[Idx1];
+            const int Idx2 = m_NextVert[Idx1];
 
             m_Triangles.emplace_back(Idx0);
             m_Triangles.emplace_back(Idx1);
             m_Triangles.emplace_back(Idx2);
-            m_RemainingVertIds.erase(m_RemainingVertIds.begin() + ear_vert_id);
+
+            m_NextVert[Idx0] = Idx2;
+            m_PrevVert[Idx2] = Idx0;
+            m_PrevVert[Idx1] = -1;
+            m_NextVert[Idx1] = -1;
+            if (Idx1 == FirstVertIdx)
+                FirstVertIdx = Idx2;
 
             --RemainingVertCount;
             // Update adjacent vertices
             if (RemainingVertCount > 3)
             {
-                const int IdxL = m_RemainingVertIds[WrapIndex(ear_vert_id - 1, RemainingVertCount)];
-                const int IdxR = m_RemainingVertIds[WrapIndex(ear_vert_id, RemainingVertCount)];
                 // First check for convex vs reflex
-                m_VertTypes[IdxL] = CheckConvex(ear_vert_id - 1);
-                m_VertTypes[IdxR] = CheckConvex(ear_vert_id);
+                m_VertTypes[Idx0] = CheckConvex(Idx0);
+                m_VertTypes[Idx2] = CheckConvex(Idx2);
 
                 // Next, check for ears
-                if (m_VertTypes[IdxL] == VertexType::Convexx)
-                    m_VertTypes[IdxL] = CheckEar(ear_vert_id - 1);
-                if (m_VertTypes[IdxR] == VertexType::Convexx)
-                    m_VertTypes[IdxR] = CheckEar(ear_vert_id);
+                for (const int Idx : {Idx0, Idx2})
+                {
+                    if (m_VertTypes[Idx] == VertexType::Convexx)
+                        m_VertTypes[Idx] = CheckEar(Idx);
+                    if (m_VertTypes[Idx] == VertexType::Ear)
+                    {
+                        m_EarQueue.push_back(Idx);
+                        std::push_heap(m_EarQueue.begin(), m_EarQueue.end(), std::greater<int>{});
+                    }
+                }
             }
         }
 
-        m_Triangles.emplace_back(m_RemainingVertIds[0]);
-        m_Triangles.emplace_back(m_RemainingVertIds[1]);
-        m_Triangles.emplace_back(m_RemainingVertIds[2]);
+        m_Triangles.emplace_back(FirstVertIdx);
+        m_Triangles.emplace_back(m_NextVert[FirstVertIdx]);
+        m_Triangles.emplace_back(m_NextVert[m_NextVert[FirstVertIdx]]);
 
         return m_Triangles;
     }
@@ -1493,6 +1565,61 @@ protected:
     std::vector<IndexType>     m_Triangles;
 
 private:
+    // Bins the polygon vertices into a uniform grid with approximately one vertex per cell.
+    template <typename ComponentType>
+    void InitVertexGrid(const std::vector<Vector2<ComponentType>>& Polygon)
+    {
+        const int VertCount = static_cast<int>(Polygon.size());
+
+        double MinX = static_cast<double>(Polygon[0].x);
+        double MinY = static_cast<double>(Polygon[0].y);
+        double MaxX = MinX;
+        double MaxY = MinY;
+        for (const auto& Vert : Polygon)
+        {
+            MinX = (std::min)(MinX, static_cast<double>(Vert.x));
+            MinY = (std::min)(MinY, static_cast<double>(Vert.y));
+            MaxX = (std::max)(MaxX, static_cast<double>(Vert.x));
+            MaxY = (std::max)(MaxY, static_cast<double>(Vert.y));
+        }
+
+        // Make the cells approximately square so that long thin polygons are handled efficiently
+        const double SizeX = (std::max)(MaxX - MinX, DBL_MIN);
+        const double SizeY = (std::max)(MaxY - MinY, DBL_MIN);
+        const double DimX  = std::sqrt(static_cast<double>(VertCount) * SizeX / SizeY);
+        m_GridDim[0]       = static_cast<int>((std::min)((std::max)(DimX, 1.0), static_cast<double>(VertCount)));
+        m_GridDim[1]       = (std::max)(VertCount / m_GridDim[0], 1);
+        m_GridMin[0]       = MinX;
+        m_GridMin[1]       = MinY;
+        m_GridScale[0]     = m_GridDim[0] / SizeX;
+        m_GridScale[1]     = m_GridDim[1] / SizeY;
+
+        // Counting sort of the vertices by their cells
+        const int NumCells = m_GridDim[0] * m_GridDim[1];
+        m_GridCellStart.assign(NumCells + 1, 0);
+        for (const auto& Vert : Polygon)
+            ++m_GridCellStart[GetGridCell(Vert.y, 1) * m_GridDim[0] + GetGridCell(Vert.x, 0)];
+        for (int Cell = 1; Cell <= NumCells; ++Cell)
+            m_GridCellStart[Cell] += m_GridCellStart[Cell - 1];
+
+        // m_GridCellStart[N] is now the end of cell N, and it is moved to the start of the cell as the vertices are inserted
+        m_GridVerts.resize(VertCount);
+        for (int Idx = VertCount - 1; Idx >= 0; --Idx)
+        {
+            const int Cell = GetGridCell(Polygon[Idx].y, 1) * m_GridDim[0] + GetGridCell(Polygon[Idx].x, 0);
+
+            m_GridVerts[--m_GridCellStart[Cell]] = Idx;
+        }
+    }
+
+    // Returns the grid cell coordinate of the value along the given axis (0 - x, 1 - y).
+    template <typename ComponentType>
+    int GetGridCell(ComponentType Val, int Axis) const
+    {
+        const int Cell = static_cast<int>((static_cast<double>(Val) - m_GridMin[Axis]) * m_GridScale[Axis]);
+        return (std::min)((std::max)(Cell, 0), m_GridDim[Axis] - 1);
+    }
+
     //        Reflex
     //   Ear.   |   .Ear
     //      \'. V .'/
@@ -1508,10 +1635,25 @@ private:
         Reflex,
         Ear
     };
+
+    TRIANGULATE_POLYGON_MODE m_Mode = TRIANGULATE_POLYGON_MODE_EAR_CLIPPING;
+
     std::vector<VertexType> m_VertTypes;
 
-    // Remaining vertices to process
-    std::vector<int> m_RemainingVertIds;
+    // Links of the remaining vertices
+    std::vector<int> m_PrevVert;
+    std::vector<int> m_NextVert;
+
+    // Min-heap of ear vertex indices
+    std::vector<int> m_EarQueue;
+
+    // Uniform grid of the polygon vertices used in TRIANGULATE_POLYGON_MODE_SPATIAL_HASH mode.
+    // Vertices of cell N are m_GridVerts[m_GridCellStart[N]] ... m_GridVerts[m_GridCellStart[N + 1] - 1].
+    int              m_GridDim[2]   = {};
+    double           m_GridMin[2]   = {};
+    double           m_GridScale[2] = {};
+    std::vector<int> m_GridCellStart;
+    std::vector<int> m_GridVerts;
 };
 
 
@@ -1525,6 +1667,10 @@ template <typename IndexType, typename ComponentType>
 class Polygon3DTriangulator : public Polygon2DTriangulator<typename std::enable_if<std::is_floating_point<ComponentType>::value, IndexType>::type>
 {
 public:
+    explicit Polygon3DTriangulator(TRIANGULATE_POLYGON_MODE Mode = TRIANGULATE_POLYGON_MODE_EAR_CLIPPING) :
+        Polygon2DTriangulator<IndexType>{Mode}
+    {}
+
     /// Triangulates a simple polygon in 3D.
 
     /// \remarks The function first projects the polygon onto a plane and then
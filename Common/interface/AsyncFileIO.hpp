@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the asynchronous file I/O service
+
+#include <functional>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Asynchronous file I/O backend
+enum ASYNC_FILE_IO_BACKEND : Uint8
+{
+    /// Use io_uring if it is available, and the thread pool otherwise.
+    ASYNC_FILE_IO_BACKEND_AUTO = 0,
+
+    /// Blocking reads are performed by a dedicated pool of I/O threads.
+    ASYNC_FILE_IO_BACKEND_THREAD_POOL,
+
+    /// Reads are submitted to the Linux io_uring. If io_uring is not supported
+    /// by the platform or the kernel, the thread pool backend is used.
+    ASYNC_FILE_IO_BACKEND_IO_URING,
+
+    ASYNC_FILE_IO_BACKEND_COUNT
+};
+
+/// Asynchronous file I/O service create information
+struct AsyncFileIOCreateInfo
+{
+    /// The I/O backend, see Diligent::ASYNC_FILE_IO_BACKEND.
+    ASYNC_FILE_IO_BACKEND Backend = ASYNC_FILE_IO_BACKEND_AUTO;
+
+    /// The maximum number of reads submitted to io_uring at the same time.
+    /// Requests that exceed this number are queued.
+    Uint32 QueueDepth = 64;
+
+    /// The number of I/O threads used by the thread pool backend.
+    Uint32 NumThreads = 2;
+
+    /// An optional thread pool that runs the completion callbacks.
+    ///
+    /// \remarks    If the thread pool is null, the callbacks are called
+    ///             from the I/O threads and should return quickly.
+    IThreadPool* pCompletionThreadPool = nullptr;
+};
+
+
+/// File opened for asynchronous reading, see Diligent::AsyncFileIO::OpenFile().
+class AsyncFile : public ObjectBase<IObject>
+{
+public:
+    using TBase = ObjectBase<IObject>;
+
+    explicit AsyncFile(IReferenceCounters* pRefCounters) noexcept :
+        TBase{pRefCounters}
+    {}
+
+    /// Returns the file size.
+    virtual Uint64 GetSize() const = 0;
+
+    /// Synchronously reads the data at the given offset and returns the number of bytes read,
+    /// which is less than Size if the end of the file is reached or an error occurs.
+    ///
+    /// \remarks    The method does not change any shared file position and
+    ///             may be called from multiple threads simultaneously.
+    virtual size_t ReadAt(Uint64 Offset, void* pData, size_t Size) = 0;
+};
+
+
+/// Asynchronous file read request
+struct AsyncFileReadRequest
+{
+    /// The file to read from. The service keeps a strong reference
+    /// to the file until the request is complete.
+    AsyncFile* pFile = nullptr;
+
+    /// Offset in the file.
+    Uint64 Offset = 0;
+
+    /// Destination memory, which must stay valid until the request is complete.
+    void* pData = nullptr;
+
+    /// The number of bytes to read.
+    size_t Size = 0;
+
+    /// An optional function that is called once the request is complete.
+    /// The argument is the number of bytes read, which is less than Size
+    /// if the end of the file is reached or an error occurred.
+    std::function<void(size_t BytesRead)> OnComplete = nullptr;
+};
+
+
+/// Asynchronous file I/O service.
+
+/// The service reads files without blocking the calling thread. Requests are submitted
+/// in batches and their completion is reported through the callbacks or through the
+/// IAsyncTask objects that may be used as prerequisites of the thread pool tasks,
+/// which allows overlapping I/O with data processing:
+///
+///     std::vector<Uint8> Data(Size);
+///     auto pReadTask = pFileIO->ReadAsync({pFile, Offset, Data.data(), Size});
+///     IAsyncTask* pPrereq = pReadTask;
+///     EnqueueAsyncWork(pThreadPool, &pPrereq, 1, [&Data](Uint32 ThreadId) {
+///         Decode(Data);
+///         return ASYNC_TASK_STATUS_COMPLETE;
+///     });
+///
+/// On Linux, the service uses io_uring. On other platforms or if io_uring is not available,
+/// the reads are performed by a dedicated pool of I/O threads.
+class AsyncFileIO : public ObjectBase<IObject>
+{
+public:
+    using TBase = ObjectBase<IObject>;
+
+    explicit AsyncFileIO(IReferenceCounters* pRefCounters) noexcept :
+        TBase{pRefCounters}
+    {}
+
+    /// Opens the file for asynchronous reading.
+    /// Returns null if the file can't be opened.
+    virtual RefCntAutoPtr<AsyncFile> OpenFile(const Char* Path) = 0;
+
+    /// Submits a batch of read requests.
+
+    /// \remarks    The method returns immediately. The completion callback
+    ///             of every request is called exactly once.
+    virtual void SubmitReads(const AsyncFileReadRequest* pRequests, size_t NumRequests) = 0;
+
+    /// Submits a read request and returns the task that is complete when
+    /// the request and its completion callback are finished.
+
+    /// \remarks    The returned task is not run by a thread pool, but may be
+    ///             used as a prerequisite of the thread pool tasks.
+    RefCntAutoPtr<IAsyncTask> ReadAsync(const AsyncFileReadRequest& Request);
+
+    /// Waits until all submitted requests are complete.
+
+    /// \note   This method must not be called from a completion callback.
+    virtual void WaitForAllReads() = 0;
+
+    /// Returns the backend that is used by the service.
+    virtual ASYNC_FILE_IO_BACKEND GetBackend() const = 0;
+};
+
+/// Creates the asynchronous file I/O service.
+RefCntAutoPtr<AsyncFileIO> CreateAsyncFileIO(const AsyncFileIOCreateInfo& CreateInfo);
+
+/// Reads the entire file into the data blob.
+
+/// \param [in] pFileIO   - Asynchronous file I/O service.
+/// \param [in] pFile     - File to read.
+/// \param [in] pData     - Data blob that receives the file contents. The blob is resized
+///                         to the file size, and to zero if the file could not be read.
+/// \param [in] ChunkSize - The size of the read requests the file is split into.
+///
+/// \return     The task that is complete when the entire file has been read.
+///
+/// \remarks    The file is read with a batch of requests that are processed in parallel.
+///             This is intended for loading large files such as device object archives.
+RefCntAutoPtr<IAsyncTask> ReadFileAsync(AsyncFileIO* pFileIO,
+                                        AsyncFile*   pFile,
+                                        IDataBlob*   pData,
+                                        size_t       ChunkSize = size_t{1} << 20);
+
+} // namespace Diligent
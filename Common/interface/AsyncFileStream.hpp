@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the AsyncFileStream class
+
+#include <vector>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "AsyncFileIO.hpp"
+
+namespace Diligent
+{
+
+/// Read-only file stream that reads ahead using the asynchronous file I/O service.
+
+/// The stream splits the file into chunks and keeps up to NumChunks reads in flight ahead
+/// of the current position, so that sequential readers (e.g. shader source factories or
+/// archive deserialization) process one chunk while the following chunks are being read.
+class AsyncFileStream final : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    AsyncFileStream(IReferenceCounters* pRefCounters,
+                    AsyncFileIO*        pFileIO,
+                    AsyncFile*          pFile,
+                    size_t              ChunkSize,
+                    Uint32              NumChunks);
+
+    ~AsyncFileStream();
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Reads data from the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override final;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override final;
+
+    /// Writing is not supported
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override final;
+
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override final;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override final;
+
+    /// Opens the file and creates the stream. Returns null if the file can't be opened.
+    static RefCntAutoPtr<AsyncFileStream> Create(AsyncFileIO* pFileIO,
+                                                 const Char*  Path,
+                                                 size_t       ChunkSize = size_t{256} << 10,
+                                                 Uint32       NumChunks = 4);
+
+private:
+    struct Chunk
+    {
+        size_t                    Index = ~size_t{0};
+        std::vector<Uint8>        Data;
+        size_t                    BytesRead = 0;
+        RefCntAutoPtr<IAsyncTask> pReadTask;
+    };
+
+    // Starts reading the chunk, if it is not already being read
+    void RequestChunk(size_t Index);
+
+private:
+    RefCntAutoPtr<AsyncFileIO> m_pFileIO;
+    RefCntAutoPtr<AsyncFile>   m_pFile;
+
+    const size_t m_Size;
+    const size_t m_ChunkSize;
+    size_t       m_CurrentOffset = 0;
+
+    std::vector<Chunk> m_Chunks;
+};
+
+} // namespace Diligent
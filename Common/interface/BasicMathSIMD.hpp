@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// SIMD implementations of float4x4 operations and batch transforms.
+///
+/// The functions use SSE2, AVX2 or NEON instructions when they are available on the target platform,
+/// and fall back to the scalar operations defined in BasicMath.hpp otherwise.
+/// Unless noted otherwise, the results are bit-exact with the scalar operations as the computations
+/// are performed in the same order.
+
+#include "BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Multiplies two matrices. The result is the same as m1 * m2.
+float4x4 MultiplyMatrices(const float4x4& m1, const float4x4& m2);
+
+/// Multiplies the row vector by the matrix. The result is the same as v * m.
+float4 TransformVector(const float4& v, const float4x4& m);
+
+/// Computes the inverse of the matrix.
+
+/// \remarks    The function uses the block-wise inversion method, so the result may differ
+///             from the result of m.Inverse() due to floating-point rounding.
+float4x4 InvertMatrix(const float4x4& m);
+
+
+/// Multiplies every matrix in the array by the same matrix.
+
+/// \param [in]  pLeft    - Array of Count matrices.
+/// \param [in]  Right    - Matrix to multiply every matrix by.
+/// \param [out] pResults - Array of Count matrices where pLeft[i] * Right will be written.
+///                         May be the same as pLeft.
+/// \param [in]  Count    - The number of matrices.
+void MultiplyMatrices(const float4x4* pLeft,
+                      const float4x4& Right,
+                      float4x4*       pResults,
+                      size_t          Count);
+
+/// Multiplies two arrays of matrices element-wise.
+
+/// \param [in]  pLeft    - Array of Count matrices.
+/// \param [in]  pRight   - Array of Count matrices.
+/// \param [out] pResults - Array of Count matrices where pLeft[i] * pRight[i] will be written.
+///                         May be the same as pLeft or pRight.
+/// \param [in]  Count    - The number of matrices.
+void MultiplyMatrices(const float4x4* pLeft,
+                      const float4x4* pRight,
+                      float4x4*       pResults,
+                      size_t          Count);
+
+/// Transforms an array of points by the matrix.
+
+/// \param [in]  pPoints  - Array of Count points.
+/// \param [in]  Count    - The number of points.
+/// \param [in]  m        - Transform matrix.
+/// \param [out] pResults - Array of Count points where pPoints[i] * m will be written.
+///                         May be the same as pPoints.
+///
+/// \remarks    Same as float3 * float4x4, the points are extended with w = 1 and
+///             the results are divided by the w component.
+void TransformPoints(const float3*   pPoints,
+                     size_t          Count,
+                     const float4x4& m,
+                     float3*         pResults);
+
+/// Transforms an array of homogeneous vectors by the matrix.
+
+/// \param [in]  pVectors - Array of Count vectors.
+/// \param [in]  Count    - The number of vectors.
+/// \param [in]  m        - Transform matrix.
+/// \param [out] pResults - Array of Count vectors where pVectors[i] * m will be written.
+///                         May be the same as pVectors.
+void TransformPoints(const float4*   pVectors,
+                     size_t          Count,
+                     const float4x4& m,
+                     float4*         pResults);
+
+/// Writes an array of matrices to the memory that will be used by shaders,
+/// for example a mapped constant or instance buffer.
+
+/// \param [in]  pMatrices - Array of Count matrices.
+/// \param [in]  Count     - The number of matrices.
+/// \param [out] pDst      - Destination memory. The memory does not need to be aligned.
+/// \param [in]  DstStride - Distance in bytes between the matrices in the destination memory.
+///                          If zero, the matrices are tightly packed.
+/// \param [in]  Transpose - Whether to transpose the matrices.
+///
+/// \remarks    Diligent Engine shaders use column-major matrices, so matrices that are used
+///             with D3D-style math in shaders need to be transposed (see BasicMath.hpp).
+///
+///             The function only writes the destination memory and never reads it, which is
+///             important when the memory is write-combined.
+void WriteShaderMatrices(const float4x4* pMatrices,
+                         size_t          Count,
+                         void*           pDst,
+                         size_t          DstStride,
+                         bool            Transpose);
+
+} // namespace Diligent
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::FileChangeWatcher class
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Watches directories for file modifications.
+
+/// On Linux and Android, the watcher uses inotify and recursively watches all subdirectories
+/// of the given directories, including the ones created after the watcher was initialized.
+/// On other platforms the watcher is not supported and IsActive() always returns false.
+///
+/// The watcher is not thread-safe.
+class FileChangeWatcher
+{
+public:
+    /// Creates the watcher.
+
+    /// \param [in] Directories - Semicolon-separated list of directories to watch.
+    explicit FileChangeWatcher(const Char* Directories);
+    ~FileChangeWatcher();
+
+    // clang-format off
+    FileChangeWatcher             (const FileChangeWatcher&) = delete;
+    FileChangeWatcher             (FileChangeWatcher&&)      = delete;
+    FileChangeWatcher& operator = (const FileChangeWatcher&) = delete;
+    FileChangeWatcher& operator = (FileChangeWatcher&&)      = delete;
+    // clang-format on
+
+    /// Returns true if at least one directory is being watched.
+    bool IsActive() const;
+
+    /// Appends the paths of the files that were written, created, deleted or renamed since
+    /// the previous call to PollChanges(). The method never blocks.
+
+    /// \param [out] ChangedFiles - Vector to which the paths of the changed files are appended.
+    ///                             The paths are formed by appending the file names to the
+    ///                             watched directories and use '/' as the separator.
+    ///                             A path may be reported more than once.
+    ///                             When a directory is deleted or moved away, the path of the
+    ///                             directory is reported instead of the paths of its files.
+    ///
+    /// \return     false if some events were lost because the event queue overflowed,
+    ///             in which case the application should assume that any file may have changed,
+    ///             and true otherwise.
+    bool PollChanges(std::vector<std::string>& ChangedFiles);
+
+private:
+    void AddWatch(const std::string& Directory, std::vector<std::string>* pFiles);
+    void RemoveWatches(const std::string& Directory);
+
+    // inotify instance file descriptor
+    int m_Fd = -1;
+
+    // Watch descriptor -> watched directory
+    std::unordered_map<int, std::string> m_Directories;
+};
+
+} // namespace Diligent
@@ -62,6 +62,19 @@ public:
     /// Releases memory allocated with AllocateAligned
     virtual void FreeAligned(void* Ptr) override final;
 
+    /// Allocates NumBlocks blocks of memory and writes their addresses to ppBlocks.
+    /// The allocator mutex is acquired only once.
+    void AllocateBatch(size_t Size, void** ppBlocks, size_t NumBlocks);
+
+    /// Releases NumBlocks blocks of memory. The allocator mutex is acquired only once.
+    void FreeBatch(void* const* ppBlocks, size_t NumBlocks);
+
+    /// Returns the total size of the memory pages allocated by the allocator, in bytes.
+    size_t GetReservedSize();
+
+    /// Returns the block size.
+    size_t GetBlockSize() const { return m_BlockSize; }
+
 private:
     // clang-format off
     FixedBlockMemoryAllocator             (const FixedBlockMemoryAllocator&) = delete;
@@ -72,6 +85,9 @@ private:
 
     void CreateNewPage();
 
+    void* AllocateUnguarded();
+    void  FreeUnguarded(void* Ptr);
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batch frustum culling of axis-aligned bounding boxes.
+
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Axis-aligned bounding boxes stored in the structure-of-arrays layout.
+struct BoundBoxArrays
+{
+    /// Box data layout.
+    enum LAYOUT : Uint8
+    {
+        /// The arrays contain box minimum and maximum coordinates.
+        LAYOUT_MIN_MAX = 0,
+
+        /// The arrays contain box centers and half extents.
+        LAYOUT_CENTER_HALF_EXTENTS
+    };
+
+    /// Pointers to the X, Y and Z coordinates of the box minimums (LAYOUT_MIN_MAX)
+    /// or centers (LAYOUT_CENTER_HALF_EXTENTS).
+    const float* pMinOrCenter[3] = {};
+
+    /// Pointers to the X, Y and Z coordinates of the box maximums (LAYOUT_MIN_MAX)
+    /// or half extents (LAYOUT_CENTER_HALF_EXTENTS).
+    const float* pMaxOrHalfExtent[3] = {};
+
+    /// The number of boxes.
+    size_t Count = 0;
+
+    /// Box data layout.
+    LAYOUT Layout = LAYOUT_MIN_MAX;
+};
+
+/// Tests every box in the batch against the view frustum.
+
+/// \param [in]  Frustum     - View frustum.
+/// \param [in]  Boxes       - Bounding boxes to test.
+/// \param [out] pVisibility - Array of Boxes.Count elements where the visibility of every box will be written.
+/// \param [in]  PlaneFlags  - Frustum planes to test the boxes against.
+/// \param [in]  pThreadPool - Optional thread pool that is used to process large batches in parallel.
+///                            The calling thread participates in the processing and waits until all boxes
+///                            are processed.
+///
+/// \remarks    The results are the same as returned by GetBoxVisibility(const ViewFrustumExt&, const BoundBox&, FRUSTUM_PLANE_FLAGS)
+///             for every box, except for the boxes that touch one of the planes, where the result may differ due to
+///             floating-point rounding.
+///
+///             The function uses SSE2, AVX2 or NEON instructions when they are available on the target platform.
+void GetBoxVisibility(const ViewFrustumExt& Frustum,
+                      const BoundBoxArrays& Boxes,
+                      BoxVisibility*        pVisibility,
+                      FRUSTUM_PLANE_FLAGS   PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                      IThreadPool*          pThreadPool = nullptr);
+
+/// Finds the boxes in the batch that are at least partially visible.
+
+/// \param [in]  Frustum     - View frustum.
+/// \param [in]  Boxes       - Bounding boxes to test.
+/// \param [out] pIndices    - Array of Boxes.Count elements where the indices of the visible
+///                            boxes will be written in increasing order.
+/// \param [in]  PlaneFlags  - Frustum planes to test the boxes against.
+/// \param [in]  pThreadPool - Optional thread pool that is used to process large batches in parallel.
+///
+/// \return     The number of visible boxes.
+size_t GetVisibleBoxes(const ViewFrustumExt& Frustum,
+                       const BoundBoxArrays& Boxes,
+                       Uint32*               pIndices,
+                       FRUSTUM_PLANE_FLAGS   PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                       IThreadPool*          pThreadPool = nullptr);
+
+} // namespace Diligent
@@ -22,6 +22,8 @@
 #include <memory>
 #include <algorithm>
 #include <atomic>
+#include <array>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -58,6 +60,19 @@ auto _LockWeakPtr(std::weak_ptr<T>& pWeakPtr)
     return pWeakPtr.lock();
 }
 
+// Thread-safe versions that do not modify the weak pointer
+template <typename T>
+auto _LockWeakPtrConst(const RefCntWeakPtr<T>& pWeakPtr)
+{
+    return pWeakPtr.Lock();
+}
+
+template <typename T>
+auto _LockWeakPtrConst(const std::weak_ptr<T>& pWeakPtr)
+{
+    return pWeakPtr.lock();
+}
+
 
 template <typename T>
 auto _IsWeakPtrExpired(RefCntWeakPtr<T>& pWeakPtr)
@@ -107,6 +122,13 @@ auto _IsWeakPtrExpired(std::weak_ptr<T>& pWeakPtr)
 ///
 ///         It is guaranteed, that the Object will only be initialized once, even if multiple threads call Get() simultaneously.
 ///
+///         In read-optimized mode, lookups of existing objects do not take any lock. The registry publishes an immutable
+///         snapshot of the key-to-object map that readers access lock-free, while insertions, removals and purges are
+///         performed under the mutex and publish a new snapshot. Retired snapshots are released once all readers that
+///         could have observed them have finished (an epoch-based scheme). Since every insertion copies the snapshot,
+///         this mode is intended for registries where lookups vastly outnumber insertions, e.g. state object
+///         deduplication caches accessed from many threads every frame.
+///
 template <typename KeyType,
           typename StrongPtrType,
           typename KeyHasher = std::hash<KeyType>,
@@ -116,10 +138,20 @@ class ObjectsRegistry
 public:
     using WeakPtrType = typename _StrongPtrHelper<StrongPtrType>::WeakPtrType;
 
-    explicit ObjectsRegistry(Uint32 NumRequestsToPurge = 1024) noexcept :
-        m_NumRequestsToPurge{NumRequestsToPurge}
+    /// \param [in] NumRequestsToPurge - The number of requests after which expired entries are purged.
+    /// \param [in] ReadOptimized      - Whether to enable the read-optimized mode, see remarks above.
+    explicit ObjectsRegistry(Uint32 NumRequestsToPurge = 1024,
+                             bool   ReadOptimized      = false) :
+        m_NumRequestsToPurge{NumRequestsToPurge},
+        m_ReaderSlots{ReadOptimized ? new ReaderSlotsType{} : nullptr}
     {}
 
+    /// Returns true if the registry operates in the read-optimized mode.
+    bool IsReadOptimized() const
+    {
+        return m_ReaderSlots != nullptr;
+    }
+
     /// Finds the object in the registry and returns strong pointer to it (std::shared_ptr or RefCntAutoPtr).
     /// If the object is not found, it is atomically created using the provided initializer.
     ///
@@ -140,6 +172,13 @@ public:
                       CreateObjectType&& CreateObject // May throw
                       ) noexcept(false)
     {
+        if (IsReadOptimized())
+        {
+            // Fast path: the object is present in the snapshot
+            if (auto pObject = FindInSnapshot(Key))
+                return pObject;
+        }
+
         // Get the Object wrapper. Since this is a shared pointer, it may not be destroyed
         // while we keep one, even if it is popped from the registry by another thread.
         std::shared_ptr<ObjectWrapper> pObjectWrpr;
@@ -205,6 +244,9 @@ public:
                 }
             }
 
+            if (pObject && IsReadOptimized())
+                AddToSnapshotUnguarded(Key, pObject);
+
             if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
                 PurgeUnguarded();
         }
@@ -219,8 +261,13 @@ public:
     ///
     /// \return     Strong pointer to the object with the specified key, if the object is found in the registry,
     ///             or empty pointer otherwise.
+    ///
+    /// \remarks    In read-optimized mode, the method does not take any lock.
     StrongPtrType Get(const KeyType& Key)
     {
+        if (IsReadOptimized())
+            return FindInSnapshot(Key);
+
         std::lock_guard<std::mutex> Guard{m_CacheMtx};
 
         if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
@@ -270,6 +317,8 @@ public:
         std::lock_guard<std::mutex> Guard{m_CacheMtx};
         m_Cache.clear();
         m_NumRequestsSinceLastPurge.store(0);
+        if (IsReadOptimized())
+            PublishSnapshotUnguarded(nullptr);
     }
 
 private:
@@ -279,13 +328,14 @@ private:
         template <typename CreateObjectType>
         const StrongPtrType Get(CreateObjectType&& CreateObject) noexcept(false)
         {
-            StrongPtrType pObject;
-
             std::lock_guard<std::mutex> Guard{m_CreateObjectMtx};
-            pObject = _LockWeakPtr(m_wpObject);
+
+            StrongPtrType pObject = Lock();
             if (!pObject)
             {
-                pObject    = CreateObject(); // May throw
+                pObject = CreateObject(); // May throw
+
+                std::lock_guard<std::mutex> WeakPtrGuard{m_WeakPtrMtx};
                 m_wpObject = pObject;
             }
 
@@ -294,16 +344,23 @@ private:
 
         StrongPtrType Lock()
         {
+            std::lock_guard<std::mutex> WeakPtrGuard{m_WeakPtrMtx};
             return _LockWeakPtr(m_wpObject);
         }
 
         bool IsExpired()
         {
+            std::lock_guard<std::mutex> WeakPtrGuard{m_WeakPtrMtx};
             return _IsWeakPtrExpired(m_wpObject);
         }
 
     private:
-        std::mutex  m_CreateObjectMtx;
+        std::mutex m_CreateObjectMtx;
+
+        // Protects m_wpObject, which is accessed by Lock() and IsExpired() while
+        // another thread may be creating the object. Unlike m_CreateObjectMtx,
+        // this mutex is never held while the object is being created.
+        std::mutex  m_WeakPtrMtx;
         WeakPtrType m_wpObject;
     };
 
@@ -322,6 +379,150 @@ private:
         }
 
         m_NumRequestsSinceLastPurge.store(0);
+
+        if (IsReadOptimized())
+        {
+            if (m_pSnapshot)
+            {
+                size_t NumExpired = 0;
+                for (auto& Entry : *m_pSnapshot)
+                {
+                    if (_IsWeakPtrExpired(Entry.second))
+                        ++NumExpired;
+                }
+
+                if (NumExpired != 0)
+                {
+                    std::unique_ptr<SnapshotType> pNewSnapshot;
+                    if (NumExpired < m_pSnapshot->size())
+                    {
+                        pNewSnapshot = std::make_unique<SnapshotType>();
+                        pNewSnapshot->reserve(m_pSnapshot->size() - NumExpired);
+                        for (auto& Entry : *m_pSnapshot)
+                        {
+                            if (!_IsWeakPtrExpired(Entry.second))
+                                pNewSnapshot->emplace(Entry.first, Entry.second);
+                        }
+                    }
+                    PublishSnapshotUnguarded(std::move(pNewSnapshot));
+                }
+            }
+            ReclaimSnapshotsUnguarded();
+        }
+    }
+
+private:
+    // Read-optimized mode implementation.
+    //
+    // Readers register in one of the striped counters of the current epoch parity, load the
+    // snapshot pointer and look up the key. Writers publish a new snapshot under the mutex,
+    // retire the old one with the current epoch, and advance the epoch once all readers
+    // registered with the previous parity have left. At that point, no reader can reference
+    // a snapshot retired before the current epoch.
+
+    using SnapshotType = std::unordered_map<KeyType, WeakPtrType, KeyHasher, KeyEqual>;
+
+    static constexpr size_t NumReaderStripes = 16;
+
+    struct ReaderCounter
+    {
+        std::atomic<Uint32> Count{0};
+        // Keep counters in separate cache lines
+        Uint8 Padding[64 - sizeof(std::atomic<Uint32>)];
+    };
+    using ReaderSlotsType = std::array<std::array<ReaderCounter, NumReaderStripes>, 2>;
+
+    static size_t GetReaderStripe()
+    {
+        static std::atomic<Uint32> NextStripe{0};
+        thread_local const Uint32  Stripe = NextStripe.fetch_add(1) % NumReaderStripes;
+        return Stripe;
+    }
+
+    StrongPtrType FindInSnapshot(const KeyType& Key)
+    {
+        const auto Stripe = GetReaderStripe();
+
+        std::atomic<Uint32>* pCounter = nullptr;
+        while (true)
+        {
+            const auto Epoch = m_Epoch.load();
+            pCounter         = &(*m_ReaderSlots)[Epoch & 1][Stripe].Count;
+            pCounter->fetch_add(1);
+            // Make sure the epoch has not advanced before the reader registered itself
+            if (m_Epoch.load() == Epoch)
+                break;
+            pCounter->fetch_sub(1);
+        }
+
+        StrongPtrType pObject;
+        if (const SnapshotType* pSnapshot = m_pReadSnapshot.load())
+        {
+            auto it = pSnapshot->find(Key);
+            if (it != pSnapshot->end())
+                pObject = _LockWeakPtrConst(it->second);
+        }
+
+        pCounter->fetch_sub(1);
+
+        return pObject;
+    }
+
+    void AddToSnapshotUnguarded(const KeyType& Key, const StrongPtrType& pObject)
+    {
+        if (m_pSnapshot)
+        {
+            auto it = m_pSnapshot->find(Key);
+            if (it != m_pSnapshot->end())
+            {
+                if (_LockWeakPtrConst(it->second) == pObject)
+                {
+                    // The object has already been published by another thread
+                    return;
+                }
+            }
+        }
+
+        auto pNewSnapshot = m_pSnapshot ?
+            std::make_unique<SnapshotType>(*m_pSnapshot) :
+            std::make_unique<SnapshotType>();
+
+        (*pNewSnapshot)[Key] = pObject;
+        PublishSnapshotUnguarded(std::move(pNewSnapshot));
+    }
+
+    void PublishSnapshotUnguarded(std::unique_ptr<SnapshotType> pNewSnapshot)
+    {
+        m_pReadSnapshot.store(pNewSnapshot.get());
+        if (m_pSnapshot)
+            m_RetiredSnapshots.emplace_back(m_Epoch.load(), std::move(m_pSnapshot));
+        m_pSnapshot = std::move(pNewSnapshot);
+
+        ReclaimSnapshotsUnguarded();
+    }
+
+    void ReclaimSnapshotsUnguarded()
+    {
+        if (m_RetiredSnapshots.empty())
+            return;
+
+        const auto Epoch = m_Epoch.load();
+        for (const auto& Counter : (*m_ReaderSlots)[(Epoch + 1) & 1])
+        {
+            if (Counter.Count.load() != 0)
+                return;
+        }
+
+        // All readers registered with the previous epoch have left. Snapshots retired before
+        // the current epoch are no longer accessible.
+        m_RetiredSnapshots.erase(
+            std::remove_if(m_RetiredSnapshots.begin(), m_RetiredSnapshots.end(),
+                           [Epoch](const RetiredSnapshot& Retired) {
+                               return Retired.first < Epoch;
+                           }),
+            m_RetiredSnapshots.end());
+
+        m_Epoch.store(Epoch + 1);
     }
 
 private:
@@ -333,6 +534,15 @@ private:
 
     std::mutex m_CacheMtx;
     CacheType  m_Cache;
+
+    // Read-optimized mode data
+    using RetiredSnapshot = std::pair<Uint64, std::unique_ptr<SnapshotType>>;
+
+    const std::unique_ptr<ReaderSlotsType> m_ReaderSlots;
+    std::atomic<Uint64>                    m_Epoch{0};
+    std::atomic<const SnapshotType*>       m_pReadSnapshot{nullptr};
+    std::unique_ptr<SnapshotType>          m_pSnapshot;        // Protected by m_CacheMtx
+    std::vector<RetiredSnapshot>           m_RetiredSnapshots; // Protected by m_CacheMtx
 };
 
 } // namespace Diligent
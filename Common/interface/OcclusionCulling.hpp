@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// CPU occlusion culling of bounding boxes against a software-rasterized depth buffer.
+
+#include <memory>
+#include <vector>
+
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Occluder triangle mesh.
+struct OccluderMesh
+{
+    /// Object-space vertex positions.
+    const float3* pVertices = nullptr;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Triangle list indices. If null, every three consecutive vertices form a triangle.
+    const Uint32* pIndices = nullptr;
+
+    /// The number of indices, which must be a multiple of three.
+    /// Ignored if pIndices is null.
+    Uint32 NumIndices = 0;
+
+    /// Matrix that transforms object-space positions to the clip space.
+    float4x4 WorldViewProj = float4x4::Identity();
+
+    /// Whether to skip back-facing triangles. Front faces have the clockwise winding,
+    /// which is the default in Diligent Engine (see RasterizerStateDesc::FrontCounterClockwise).
+    bool CullBackFaces = true;
+};
+
+/// Software occlusion culler.
+
+/// The culler rasterizes occluder meshes into a low-resolution depth buffer on the CPU and tests
+/// bounding boxes against it. A box is reported as occluded if every pixel covered by its screen-space
+/// rectangle contains an occluder that is closer than the nearest point of the box.
+///
+/// The screen is split into bins that are rasterized in parallel. Within a bin, triangles are
+/// rasterized with SSE2, AVX2 or NEON edge functions when they are available on the target platform.
+/// Every pixel keeps the minimum depth of the occluders that cover its center, and the maximum depth
+/// of every 8x8 tile is kept in the hierarchical depth buffer used to reject the boxes early.
+/// Since the depth test is order-independent, the results do not depend on the number of threads.
+///
+/// Depth values are in the [0, 1] range, where 1 is the far plane. Reverse depth is not supported.
+///
+/// The culler is not thread-safe: RasterizeOccluders() must not run concurrently with any other method.
+/// Box tests may run concurrently with each other.
+class SoftwareOcclusionCuller
+{
+public:
+    struct CreateInfo
+    {
+        /// Depth buffer width.
+        Uint32 Width = 256;
+
+        /// Depth buffer height.
+        Uint32 Height = 128;
+
+        /// Whether the projection matrices map depth to the [-1, 1] range (OpenGL style)
+        /// rather than to [0, 1] (Direct3D style).
+        bool NegativeOneToOneZ = false;
+    };
+
+    explicit SoftwareOcclusionCuller(const CreateInfo& CI);
+
+    // clang-format off
+    SoftwareOcclusionCuller             (const SoftwareOcclusionCuller&) = delete;
+    SoftwareOcclusionCuller             (SoftwareOcclusionCuller&&)      = delete;
+    SoftwareOcclusionCuller& operator = (const SoftwareOcclusionCuller&) = delete;
+    SoftwareOcclusionCuller& operator = (SoftwareOcclusionCuller&&)      = delete;
+    // clang-format on
+
+    ~SoftwareOcclusionCuller();
+
+    /// Resets the depth buffer to the far plane.
+    void Clear();
+
+    /// Rasterizes the occluders into the depth buffer.
+
+    /// \param [in] pOccluders   - Array of NumOccluders occluder meshes.
+    /// \param [in] NumOccluders - The number of occluders.
+    /// \param [in] pThreadPool  - Optional thread pool that is used to transform and rasterize
+    ///                            the occluders in parallel. The calling thread participates
+    ///                            in the processing and waits until all work is finished.
+    ///
+    /// \remarks    Occluders are accumulated in the depth buffer until Clear() is called.
+    void RasterizeOccluders(const OccluderMesh* pOccluders,
+                            size_t              NumOccluders,
+                            IThreadPool*        pThreadPool = nullptr);
+
+    /// Tests if the box may be visible.
+
+    /// \param [in] ViewProj - Matrix that transforms the box to the clip space.
+    /// \param [in] Box      - World-space bounding box.
+    ///
+    /// \return     false if the box is occluded or is entirely outside of the screen, and true otherwise.
+    ///             Boxes that intersect the near plane are always reported as visible.
+    bool IsBoxVisible(const float4x4& ViewProj, const BoundBox& Box) const;
+
+    /// Finds the boxes in the batch that may be visible.
+
+    /// \param [in]  ViewProj    - Matrix that transforms the boxes to the clip space.
+    /// \param [in]  pBoxes      - Array of NumBoxes world-space bounding boxes.
+    /// \param [in]  NumBoxes    - The number of boxes.
+    /// \param [out] pIndices    - Array of NumBoxes elements where the indices of the visible
+    ///                            boxes will be written in increasing order.
+    /// \param [in]  pThreadPool - Optional thread pool that is used to test large batches in parallel.
+    ///
+    /// \return     The number of visible boxes.
+    size_t GetVisibleBoxes(const float4x4& ViewProj,
+                           const BoundBox* pBoxes,
+                           size_t          NumBoxes,
+                           Uint32*         pIndices,
+                           IThreadPool*    pThreadPool = nullptr) const;
+
+    Uint32 GetWidth() const { return m_Width; }
+    Uint32 GetHeight() const { return m_Height; }
+
+    /// Returns the depth of the pixel, where (0, 0) is the top left pixel.
+    float GetDepth(Uint32 x, Uint32 y) const
+    {
+        VERIFY_EXPR(x < m_Width && y < m_Height);
+        return m_Depth[size_t{y} * m_Stride + x];
+    }
+
+private:
+    struct RasterTriangle;
+    struct BinningJob;
+
+    void RasterizeBin(Uint32 BinIdx, size_t NumJobs);
+
+    const Uint32 m_Width;
+    const Uint32 m_Height;
+    const bool   m_NegativeOneToOneZ;
+
+    // The depth buffer is padded to the whole number of bins
+    Uint32 m_Stride    = 0;
+    Uint32 m_NumBinsX  = 0;
+    Uint32 m_NumBinsY  = 0;
+    Uint32 m_NumTilesX = 0;
+
+    std::vector<float> m_Depth;
+
+    // The maximum depth of every tile
+    std::vector<float> m_TileMaxDepth;
+
+    // Scratch data reused between the calls to RasterizeOccluders()
+    std::vector<float4>                      m_ClipVerts;
+    std::vector<size_t>                      m_ClipVertsOffsets;
+    std::vector<std::unique_ptr<BinningJob>> m_Jobs;
+};
+
+} // namespace Diligent
@@ -412,6 +412,22 @@ public:
 
     /// Obtains a strong reference to the object
     RefCntAutoPtr<T> Lock()
+    {
+        RefCntAutoPtr<T> spObj = static_cast<const RefCntWeakPtr&>(*this).Lock();
+        if (!spObj)
+        {
+            // Owner object has been destroyed. There is no reason
+            // to keep this weak reference anymore
+            Release();
+        }
+        return spObj;
+    }
+
+    /// Obtains a strong reference to the object.
+    /// Unlike the non-const overload, this method does not release the weak reference
+    /// when the object has been destroyed, so it may be called by multiple threads
+    /// simultaneously for the same weak pointer.
+    RefCntAutoPtr<T> Lock() const
     {
         RefCntAutoPtr<T> spObj;
         if (m_pRefCounters)
@@ -428,12 +444,6 @@ public:
                 // create strong reference
                 spObj = m_pObject;
             }
-            else
-            {
-                // Owner object has been destroyed. There is no reason
-                // to keep this weak reference anymore
-                Release();
-            }
         }
         return spObj;
     }
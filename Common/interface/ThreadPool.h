@@ -285,6 +285,25 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     VIRTUAL bool METHOD(ProcessTask)(THIS_
                                      Uint32 ThreadId,
                                      bool   WaitForTask) PURE;
+
+
+    /// Returns the scratch memory of the worker thread.
+
+    /// \param[in]  ThreadId - Id of the worker thread.
+    /// \param[out] pSize    - Optional pointer to the variable that receives the scratch memory size.
+    ///
+    /// \return     Pointer to the scratch memory, or null if the thread pool was created with
+    ///             zero scratch size or ThreadId is not the id of a worker thread.
+    ///
+    /// \remarks    The memory is allocated and first touched by the worker thread itself after
+    ///             the thread affinity has been set, so that on NUMA systems it is placed on the
+    ///             node the thread runs on.
+    ///
+    ///             The scratch memory of a worker thread must only be accessed by the task
+    ///             running on that thread, e.g. from the IAsyncTask::Run() method.
+    VIRTUAL void* METHOD(GetThreadScratchMemory)(THIS_
+                                                 Uint32  ThreadId,
+                                                 size_t* pSize DEFAULT_VALUE(nullptr)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -292,15 +311,16 @@ DILIGENT_END_INTERFACE
 
 #if DILIGENT_C_INTERFACE
 
-#    define IThreadPool_EnqueueTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, EnqueueTask, This, __VA_ARGS__)
-#    define IThreadPool_ReprioritizeTask(This, ...) CALL_IFACE_METHOD(ThreadPool, ReprioritizeTask, This, __VA_ARGS__)
-#    define IThreadPool_ReprioritizeAllTasks(This)  CALL_IFACE_METHOD(ThreadPool, ReprioritizeAllTasks, This)
-#    define IThreadPool_RemoveTask(This, ...)       CALL_IFACE_METHOD(ThreadPool, RemoveTask, This, __VA_ARGS__)
-#    define IThreadPool_WaitForAllTasks(This)       CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
-#    define IThreadPool_GetQueueSize(This)          CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
-#    define IThreadPool_GetRunningTaskCount(This)   CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
-#    define IThreadPool_StopThreads(This)           CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
-#    define IThreadPool_ProcessTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, ProcessTask, This, __VA_ARGS__)
+#    define IThreadPool_EnqueueTask(This, ...)            CALL_IFACE_METHOD(ThreadPool, EnqueueTask, This, __VA_ARGS__)
+#    define IThreadPool_ReprioritizeTask(This, ...)       CALL_IFACE_METHOD(ThreadPool, ReprioritizeTask, This, __VA_ARGS__)
+#    define IThreadPool_ReprioritizeAllTasks(This)        CALL_IFACE_METHOD(ThreadPool, ReprioritizeAllTasks, This)
+#    define IThreadPool_RemoveTask(This, ...)             CALL_IFACE_METHOD(ThreadPool, RemoveTask, This, __VA_ARGS__)
+#    define IThreadPool_WaitForAllTasks(This)             CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
+#    define IThreadPool_GetQueueSize(This)                CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
+#    define IThreadPool_GetRunningTaskCount(This)         CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
+#    define IThreadPool_StopThreads(This)                 CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
+#    define IThreadPool_ProcessTask(This, ...)            CALL_IFACE_METHOD(ThreadPool, ProcessTask, This, __VA_ARGS__)
+#    define IThreadPool_GetThreadScratchMemory(This, ...) CALL_IFACE_METHOD(ThreadPool, GetThreadScratchMemory, This, __VA_ARGS__)
 
 #endif
 
@@ -28,11 +28,14 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../Platforms/Basic/interface/BasicPlatformMisc.hpp"
 
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -40,6 +43,29 @@
 namespace Diligent
 {
 
+/// Worker thread placement policy
+enum THREAD_POOL_PLACEMENT : Uint8
+{
+    /// Worker threads are not pinned and are scheduled by the operating system.
+    THREAD_POOL_PLACEMENT_NONE = 0,
+
+    /// Every worker thread is pinned to its own physical core (i.e. to all SMT siblings
+    /// of the core). Consecutive threads are spread across L3 domains to maximize the
+    /// available cache and memory bandwidth.
+    THREAD_POOL_PLACEMENT_PHYSICAL_CORES,
+
+    /// Every worker thread is pinned to its own physical core. Cores of one L3 domain
+    /// are filled before moving to the next domain, so that threads that share data
+    /// also share the last-level cache.
+    THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN,
+
+    /// All worker threads are pinned to the logical processors of the NUMA node
+    /// given by ThreadPoolCreateInfo::NUMANode.
+    THREAD_POOL_PLACEMENT_NUMA_LOCAL,
+
+    THREAD_POOL_PLACEMENT_COUNT
+};
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -58,10 +84,38 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Worker thread placement policy, see Diligent::THREAD_POOL_PLACEMENT.
+
+    /// \remarks    Worker threads are pinned before OnThreadStarted is called.
+    ///             The CPU topology is queried with PlatformMisc::GetCPUTopology().
+    THREAD_POOL_PLACEMENT Placement = THREAD_POOL_PLACEMENT_NONE;
+
+    /// The NUMA node index when Placement is THREAD_POOL_PLACEMENT_NUMA_LOCAL.
+    Uint32 NUMANode = 0;
+
+    /// The size of the scratch memory allocated for every worker thread,
+    /// see IThreadPool::GetThreadScratchMemory().
+    size_t ThreadScratchSize = 0;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
 
+/// Computes the affinity of every worker thread for the given placement policy.
+///
+/// \param Topology   - CPU topology.
+/// \param Placement  - Worker thread placement policy.
+/// \param NUMANode   - NUMA node index for THREAD_POOL_PLACEMENT_NUMA_LOCAL policy.
+/// \param NumThreads - The number of worker threads.
+/// \return           - Affinity of every worker thread. An empty set indicates
+///                      that the thread should not be pinned.
+///
+/// \remarks    If there are more threads than cores, the cores are reused in the same order.
+std::vector<ProcessorSet> GetWorkerThreadAffinity(const CPUTopology&    Topology,
+                                                  THREAD_POOL_PLACEMENT Placement,
+                                                  Uint32                NUMANode,
+                                                  size_t                NumThreads);
+
 /// Pins the worker thread to one of the allowed cores.
 ///
 /// \param ThreadId         - The thread ID.
@@ -75,6 +129,16 @@ RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPo
 ///             This function can be used as the OnThreadStarted callback in the ThreadPoolCreateInfo.
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask);
 
+/// Pins the worker thread to one of the allowed logical processors.
+///
+/// \param ThreadId          - The thread ID.
+/// \param AllowedProcessors - The set of allowed logical processors.
+/// \return                  - true if the thread was pinned, and false otherwise.
+///
+/// \remarks    This is the counterpart of the function above that supports systems
+///             with more than 64 logical processors.
+bool PinWorkerThread(Uint32 ThreadId, const ProcessorSet& AllowedProcessors);
+
 /// Base implementation of the IAsyncTask interface.
 class AsyncTaskBase : public ObjectBase<IAsyncTask>
 {
@@ -223,4 +287,49 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls Handler(ItemIdx) for every index in the range [0, NumItems) using the thread pool.
+
+/// The items are processed by at most MaxTasks tasks enqueued into the thread pool and
+/// by the calling thread, which guarantees progress even if the pool has no free threads.
+/// The function returns when all items have been processed. If the thread pool is null,
+/// all items are processed by the calling thread in order.
+template <typename HandlerType>
+void ParallelFor(IThreadPool* pThreadPool, size_t NumItems, size_t MaxTasks, const HandlerType& Handler)
+{
+    std::atomic<size_t> NextItem{0};
+
+    const auto ProcessAvailableItems = [&]() {
+        for (size_t Item = NextItem.fetch_add(1); Item < NumItems; Item = NextItem.fetch_add(1))
+        {
+            Handler(Item);
+        }
+    };
+
+    if (pThreadPool == nullptr || NumItems <= 1 || MaxTasks == 0)
+    {
+        ProcessAvailableItems();
+        return;
+    }
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(std::min(NumItems - 1, MaxTasks));
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        pTask = EnqueueAsyncWork(pThreadPool,
+                                 [&ProcessAvailableItems](Uint32 ThreadId) {
+                                     ProcessAvailableItems();
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+    }
+
+    ProcessAvailableItems();
+
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        // The tasks that have not been started yet have nothing to do as all items have been processed.
+        // The tasks that are running must be waited for as they reference the local variables.
+        if (!pThreadPool->RemoveTask(pTask))
+            pTask->WaitForCompletion();
+    }
+}
+
 } // namespace Diligent
@@ -0,0 +1,791 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "AsyncFileIO.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Cast.hpp"
+
+#if PLATFORM_LINUX
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/stat.h>
+#    if defined(__has_include)
+#        if __has_include(<linux/io_uring.h>)
+#            include <linux/io_uring.h>
+#            include <sys/mman.h>
+#            include <sys/syscall.h>
+#        endif
+#    endif
+#endif
+
+// IORING_OP_READ and IORING_FEAT_RW_CUR_POS were both introduced in Linux 5.6
+#if PLATFORM_LINUX && defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#    define DILIGENT_IO_URING_SUPPORTED 1
+#else
+#    define DILIGENT_IO_URING_SUPPORTED 0
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+#if PLATFORM_LINUX
+
+class AsyncFileImpl final : public AsyncFile
+{
+public:
+    AsyncFileImpl(IReferenceCounters* pRefCounters, int Fd, Uint64 Size) noexcept :
+        AsyncFile{pRefCounters},
+        m_Fd{Fd},
+        m_Size{Size}
+    {}
+
+    ~AsyncFileImpl()
+    {
+        close(m_Fd);
+    }
+
+    static RefCntAutoPtr<AsyncFile> Open(const Char* Path)
+    {
+        const int Fd = open(Path, O_RDONLY | O_CLOEXEC);
+        if (Fd < 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to open file ", Path, ": ", strerror(errno));
+            return {};
+        }
+
+        struct stat FileStat;
+        if (fstat(Fd, &FileStat) != 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to query the size of file ", Path, ": ", strerror(errno));
+            close(Fd);
+            return {};
+        }
+
+        return RefCntAutoPtr<AsyncFile>{MakeNewRCObj<AsyncFileImpl>()(Fd, static_cast<Uint64>(FileStat.st_size))};
+    }
+
+    virtual Uint64 GetSize() const override final
+    {
+        return m_Size;
+    }
+
+    virtual size_t ReadAt(Uint64 Offset, void* pData, size_t Size) override final
+    {
+        size_t BytesRead = 0;
+        while (BytesRead < Size)
+        {
+            const ssize_t Res = pread(m_Fd, static_cast<Uint8*>(pData) + BytesRead, Size - BytesRead, static_cast<off_t>(Offset + BytesRead));
+            if (Res < 0 && errno == EINTR)
+                continue;
+            if (Res <= 0)
+                break;
+            BytesRead += static_cast<size_t>(Res);
+        }
+        return BytesRead;
+    }
+
+    int GetFd() const
+    {
+        return m_Fd;
+    }
+
+private:
+    const int    m_Fd;
+    const Uint64 m_Size;
+};
+
+#else
+
+class AsyncFileImpl final : public AsyncFile
+{
+public:
+    AsyncFileImpl(IReferenceCounters* pRefCounters, const Char* Path) :
+        AsyncFile{pRefCounters},
+        m_File{Path, EFileAccessMode::Read},
+        m_Size{m_File ? m_File->GetSize() : 0}
+    {}
+
+    static RefCntAutoPtr<AsyncFile> Open(const Char* Path)
+    {
+        RefCntAutoPtr<AsyncFileImpl> pFile{MakeNewRCObj<AsyncFileImpl>()(Path)};
+        if (!pFile->m_File)
+        {
+            LOG_ERROR_MESSAGE("Failed to open file ", Path);
+            return {};
+        }
+        return pFile;
+    }
+
+    virtual Uint64 GetSize() const override final
+    {
+        return m_Size;
+    }
+
+    virtual size_t ReadAt(Uint64 Offset, void* pData, size_t Size) override final
+    {
+        if (Offset >= m_Size)
+            return 0;
+        Size = static_cast<size_t>(std::min(Uint64{Size}, m_Size - Offset));
+
+        // The file position is shared, so the reads are serialized
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (!m_File->SetPos(static_cast<size_t>(Offset), FilePosOrigin::Start) || !m_File->Read(pData, Size))
+            return 0;
+        return Size;
+    }
+
+private:
+    std::mutex   m_Mtx;
+    FileWrapper  m_File;
+    const Uint64 m_Size;
+};
+
+#endif
+
+
+class AsyncFileReadTask final : public AsyncTaskBase
+{
+public:
+    explicit AsyncFileReadTask(IReferenceCounters* pRefCounters) noexcept :
+        AsyncTaskBase{pRefCounters}
+    {
+        SetStatus(ASYNC_TASK_STATUS_RUNNING);
+    }
+
+    virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE Run(Uint32 ThreadId) override final
+    {
+        UNEXPECTED("File read tasks are completed by the I/O service and must not be enqueued into a thread pool");
+        return ASYNC_TASK_STATUS_CANCELLED;
+    }
+};
+
+
+class AsyncFileIOBase : public AsyncFileIO
+{
+public:
+    AsyncFileIOBase(IReferenceCounters* pRefCounters, const AsyncFileIOCreateInfo& CI) noexcept :
+        AsyncFileIO{pRefCounters},
+        m_pCompletionThreadPool{CI.pCompletionThreadPool}
+    {}
+
+    ~AsyncFileIOBase()
+    {
+        VERIFY(m_NumPendingReads == 0, "All reads must be complete before the base class is destroyed");
+    }
+
+    virtual RefCntAutoPtr<AsyncFile> OpenFile(const Char* Path) override final
+    {
+        if (Path == nullptr || Path[0] == '\0')
+        {
+            DEV_ERROR("Path must not be null or empty");
+            return {};
+        }
+
+        return AsyncFileImpl::Open(Path);
+    }
+
+    virtual void SubmitReads(const AsyncFileReadRequest* pRequests, size_t NumRequests) override final
+    {
+        if (NumRequests == 0)
+            return;
+        VERIFY_EXPR(pRequests != nullptr);
+
+        {
+            std::lock_guard<std::mutex> Lock{m_PendingReadsMtx};
+            m_NumPendingReads += NumRequests;
+        }
+
+        std::vector<ReadState*> States;
+        States.reserve(NumRequests);
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            const AsyncFileReadRequest& Request = pRequests[i];
+            DEV_CHECK_ERR(Request.pFile != nullptr, "File must not be null");
+            DEV_CHECK_ERR(Request.pData != nullptr || Request.Size == 0, "Destination memory must not be null");
+
+            ReadState* pState  = new ReadState;
+            pState->pFile      = ClassPtrCast<AsyncFileImpl>(Request.pFile);
+            pState->Offset     = Request.Offset;
+            pState->pData      = static_cast<Uint8*>(Request.pData);
+            pState->Size       = Request.Size;
+            pState->OnComplete = Request.OnComplete;
+
+            if (pState->pFile == nullptr || pState->Size == 0)
+                CompleteRead(pState);
+            else
+                States.push_back(pState);
+        }
+
+        if (!States.empty())
+            Submit(States.data(), States.size());
+    }
+
+    virtual void WaitForAllReads() override final
+    {
+        std::unique_lock<std::mutex> Lock{m_PendingReadsMtx};
+        m_ReadsCompleteCond.wait(Lock, [this] { return m_NumPendingReads == 0; });
+    }
+
+protected:
+    struct ReadState
+    {
+        RefCntAutoPtr<AsyncFileImpl> pFile;
+
+        Uint64 Offset    = 0;
+        Uint8* pData     = nullptr;
+        size_t Size      = 0;
+        size_t BytesRead = 0;
+
+        std::function<void(size_t)> OnComplete;
+    };
+
+    // Submits the reads to the backend. The backend must call CompleteRead() for every state.
+    virtual void Submit(ReadState** ppStates, size_t NumStates) = 0;
+
+    void CompleteRead(ReadState* pState)
+    {
+        if (m_pCompletionThreadPool != nullptr && pState->OnComplete)
+        {
+            EnqueueAsyncWork(m_pCompletionThreadPool,
+                             [this, pState](Uint32 ThreadId) {
+                                 FinishRead(pState);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        else
+        {
+            FinishRead(pState);
+        }
+    }
+
+private:
+    void FinishRead(ReadState* pState)
+    {
+        if (pState->OnComplete)
+            pState->OnComplete(pState->BytesRead);
+        delete pState;
+
+        std::lock_guard<std::mutex> Lock{m_PendingReadsMtx};
+        VERIFY_EXPR(m_NumPendingReads > 0);
+        if (--m_NumPendingReads == 0)
+            m_ReadsCompleteCond.notify_all();
+    }
+
+private:
+    RefCntAutoPtr<IThreadPool> m_pCompletionThreadPool;
+
+    std::mutex              m_PendingReadsMtx;
+    std::condition_variable m_ReadsCompleteCond;
+    size_t                  m_NumPendingReads = 0;
+};
+
+
+// Performs blocking reads on a dedicated pool of I/O threads
+class ThreadPoolAsyncFileIO final : public AsyncFileIOBase
+{
+public:
+    ThreadPoolAsyncFileIO(IReferenceCounters* pRefCounters, const AsyncFileIOCreateInfo& CI) :
+        AsyncFileIOBase{pRefCounters, CI},
+        m_pIOThreadPool{CreateThreadPool(ThreadPoolCreateInfo{std::max(CI.NumThreads, 1u)})}
+    {}
+
+    ~ThreadPoolAsyncFileIO()
+    {
+        WaitForAllReads();
+    }
+
+    virtual ASYNC_FILE_IO_BACKEND GetBackend() const override final
+    {
+        return ASYNC_FILE_IO_BACKEND_THREAD_POOL;
+    }
+
+private:
+    virtual void Submit(ReadState** ppStates, size_t NumStates) override final
+    {
+        for (size_t i = 0; i < NumStates; ++i)
+        {
+            EnqueueAsyncWork(m_pIOThreadPool,
+                             [this, pState = ppStates[i]](Uint32 ThreadId) {
+                                 pState->BytesRead = pState->pFile->ReadAt(pState->Offset, pState->pData, pState->Size);
+                                 CompleteRead(pState);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+    }
+
+private:
+    RefCntAutoPtr<IThreadPool> m_pIOThreadPool;
+};
+
+
+#if DILIGENT_IO_URING_SUPPORTED
+
+// Submits the reads to the io_uring. Completions are processed by a dedicated thread.
+class IoUringAsyncFileIO final : public AsyncFileIOBase
+{
+public:
+    IoUringAsyncFileIO(IReferenceCounters* pRefCounters, const AsyncFileIOCreateInfo& CI) :
+        AsyncFileIOBase{pRefCounters, CI}
+    {
+        io_uring_params Params;
+        memset(&Params, 0, sizeof(Params));
+        m_RingFd = static_cast<int>(syscall(__NR_io_uring_setup, std::max(CI.QueueDepth, 1u), &Params));
+        if (m_RingFd < 0)
+            return;
+
+        if (!InitRings(Params))
+        {
+            ReleaseRings();
+            return;
+        }
+
+        m_CompletionThread = std::thread{[this]() { ProcessCompletions(); }};
+    }
+
+    ~IoUringAsyncFileIO()
+    {
+        WaitForAllReads();
+
+        if (m_CompletionThread.joinable())
+        {
+            {
+                // Wake up the completion thread with a no-op request that has null user data
+                std::lock_guard<std::mutex> Lock{m_SubmitMtx};
+
+                unsigned int  Tail = *m_pSQTail;
+                io_uring_sqe& SQE  = GetNextSQE(Tail);
+                SQE.opcode         = IORING_OP_NOP;
+
+                std::vector<ReadState*> FailedReads;
+                SubmitSQEsUnsafe(Tail, FailedReads);
+                VERIFY(FailedReads.empty(), "All reads must be complete at this point");
+            }
+            m_CompletionThread.join();
+        }
+
+        ReleaseRings();
+    }
+
+    bool IsInitialized() const
+    {
+        return m_RingFd >= 0;
+    }
+
+    virtual ASYNC_FILE_IO_BACKEND GetBackend() const override final
+    {
+        return ASYNC_FILE_IO_BACKEND_IO_URING;
+    }
+
+private:
+    virtual void Submit(ReadState** ppStates, size_t NumStates) override final
+    {
+        std::vector<ReadState*> FailedReads;
+        {
+            std::lock_guard<std::mutex> Lock{m_SubmitMtx};
+            m_QueuedReads.insert(m_QueuedReads.end(), ppStates, ppStates + NumStates);
+            SubmitQueuedReadsUnsafe(FailedReads);
+        }
+
+        // Completion callbacks may submit new reads, so they must not be called while the mutex is locked
+        for (ReadState* pState : FailedReads)
+            CompleteRead(pState);
+    }
+
+    bool InitRings(const io_uring_params& Params)
+    {
+        if ((Params.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            // The kernel is too old to support IORING_OP_READ
+            return false;
+        }
+
+        m_SQRingSize = Params.sq_off.array + Params.sq_entries * sizeof(__u32);
+        m_CQRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool SingleMmap = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (SingleMmap)
+            m_SQRingSize = m_CQRingSize = std::max(m_SQRingSize, m_CQRingSize);
+
+        m_pSQRing = MapRing(m_SQRingSize, IORING_OFF_SQ_RING);
+        if (m_pSQRing == nullptr)
+            return false;
+
+        m_pCQRing = SingleMmap ? m_pSQRing : MapRing(m_CQRingSize, IORING_OFF_CQ_RING);
+        if (m_pCQRing == nullptr)
+            return false;
+
+        m_SQEsSize = Params.sq_entries * sizeof(io_uring_sqe);
+        m_pSQEs    = static_cast<io_uring_sqe*>(MapRing(m_SQEsSize, IORING_OFF_SQES));
+        if (m_pSQEs == nullptr)
+            return false;
+
+        Uint8* const pSQRing = static_cast<Uint8*>(m_pSQRing);
+        m_pSQHead            = reinterpret_cast<unsigned int*>(pSQRing + Params.sq_off.head);
+        m_pSQTail            = reinterpret_cast<unsigned int*>(pSQRing + Params.sq_off.tail);
+        m_pSQMask            = reinterpret_cast<unsigned int*>(pSQRing + Params.sq_off.ring_mask);
+        m_pSQArray           = reinterpret_cast<unsigned int*>(pSQRing + Params.sq_off.array);
+
+        Uint8* const pCQRing = static_cast<Uint8*>(m_pCQRing);
+        m_pCQHead            = reinterpret_cast<unsigned int*>(pCQRing + Params.cq_off.head);
+        m_pCQTail            = reinterpret_cast<unsigned int*>(pCQRing + Params.cq_off.tail);
+        m_pCQMask            = reinterpret_cast<unsigned int*>(pCQRing + Params.cq_off.ring_mask);
+        m_pCQEs              = reinterpret_cast<io_uring_cqe*>(pCQRing + Params.cq_off.cqes);
+
+        // The completion queue is twice as large as the submission queue, so limiting
+        // the number of reads in flight by the submission queue size prevents overflows.
+        m_MaxReadsInFlight = Params.sq_entries;
+
+        return true;
+    }
+
+    void* MapRing(size_t Size, Uint64 Offset)
+    {
+        void* pRing = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, static_cast<off_t>(Offset));
+        return pRing != MAP_FAILED ? pRing : nullptr;
+    }
+
+    void ReleaseRings()
+    {
+        if (m_pSQEs != nullptr)
+            munmap(m_pSQEs, m_SQEsSize);
+        if (m_pCQRing != nullptr && m_pCQRing != m_pSQRing)
+            munmap(m_pCQRing, m_CQRingSize);
+        if (m_pSQRing != nullptr)
+            munmap(m_pSQRing, m_SQRingSize);
+        if (m_RingFd >= 0)
+            close(m_RingFd);
+
+        m_pSQEs   = nullptr;
+        m_pCQRing = nullptr;
+        m_pSQRing = nullptr;
+        m_RingFd  = -1;
+    }
+
+    int Enter(unsigned int ToSubmit, unsigned int MinComplete, unsigned int Flags)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, m_RingFd, ToSubmit, MinComplete, Flags, nullptr, 0));
+    }
+
+    io_uring_sqe& GetNextSQE(unsigned int& Tail)
+    {
+        const unsigned int Idx = Tail & *m_pSQMask;
+        m_pSQArray[Idx]        = Idx;
+        ++Tail;
+
+        io_uring_sqe& SQE = m_pSQEs[Idx];
+        memset(&SQE, 0, sizeof(SQE));
+        return SQE;
+    }
+
+    // Submits the queued reads. If the reads can't be submitted, they are appended to FailedReads
+    // and must be completed by the caller after the submit mutex is released.
+    void SubmitQueuedReadsUnsafe(std::vector<ReadState*>& FailedReads)
+    {
+        // A single read is limited to 1GB. Larger requests are completed by subsequent reads.
+        constexpr size_t MaxReadSize = size_t{1} << 30;
+
+        unsigned int Tail = *m_pSQTail;
+        while (!m_QueuedReads.empty() && m_NumReadsInFlight < m_MaxReadsInFlight)
+        {
+            ReadState* pState = m_QueuedReads.front();
+            m_QueuedReads.pop_front();
+
+            io_uring_sqe& SQE = GetNextSQE(Tail);
+            SQE.opcode        = IORING_OP_READ;
+            SQE.fd            = pState->pFile->GetFd();
+            SQE.off           = pState->Offset + pState->BytesRead;
+            SQE.addr          = reinterpret_cast<Uint64>(pState->pData + pState->BytesRead);
+            SQE.len           = static_cast<Uint32>(std::min(pState->Size - pState->BytesRead, MaxReadSize));
+            SQE.user_data     = reinterpret_cast<Uint64>(pState);
+            ++m_NumReadsInFlight;
+        }
+
+        if (!SubmitSQEsUnsafe(Tail, FailedReads))
+        {
+            // The queued reads would never be submitted if no reads are in flight
+            FailedReads.insert(FailedReads.end(), m_QueuedReads.begin(), m_QueuedReads.end());
+            m_QueuedReads.clear();
+        }
+    }
+
+    // Returns false if the requests could not be submitted. In this case, the entries that
+    // were not consumed by the kernel are removed from the submission queue, and their reads
+    // are appended to FailedReads and are no longer counted as in flight.
+    bool SubmitSQEsUnsafe(unsigned int Tail, std::vector<ReadState*>& FailedReads)
+    {
+        __atomic_store_n(m_pSQTail, Tail, __ATOMIC_RELEASE);
+        while (true)
+        {
+            const unsigned int NumToSubmit = Tail - __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+            if (NumToSubmit == 0)
+                return true;
+
+            if (Enter(NumToSubmit, 0, 0) < 0)
+            {
+                if (errno == EAGAIN || errno == EBUSY)
+                {
+                    std::this_thread::yield();
+                }
+                else if (errno != EINTR)
+                {
+                    LOG_ERROR_MESSAGE("Failed to submit io_uring requests: ", strerror(errno));
+                    break;
+                }
+            }
+        }
+
+        // Without submission queue polling, the kernel only reads the queue in io_uring_enter,
+        // so the entries that it has not consumed can be safely taken back.
+        const unsigned int Head = __atomic_load_n(m_pSQHead, __ATOMIC_ACQUIRE);
+
+        Uint32 NumFailedReads = 0;
+        for (unsigned int i = Head; i != Tail; ++i)
+        {
+            const io_uring_sqe& SQE = m_pSQEs[m_pSQArray[i & *m_pSQMask]];
+            if (SQE.user_data != 0)
+            {
+                // The read keeps the bytes read by its previous requests
+                FailedReads.push_back(reinterpret_cast<ReadState*>(SQE.user_data));
+                ++NumFailedReads;
+            }
+        }
+        __atomic_store_n(m_pSQTail, Head, __ATOMIC_RELEASE);
+
+        VERIFY_EXPR(m_NumReadsInFlight >= NumFailedReads);
+        m_NumReadsInFlight -= NumFailedReads;
+
+        return false;
+    }
+
+    void ProcessCompletions()
+    {
+        std::vector<ReadState*> CompletedReads;
+        while (true)
+        {
+            unsigned int       Head = *m_pCQHead;
+            const unsigned int Tail = __atomic_load_n(m_pCQTail, __ATOMIC_ACQUIRE);
+            if (Head == Tail)
+            {
+                Enter(0, 1, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+
+            bool     Stop              = false;
+            unsigned NumCompletedReads = 0;
+            for (; Head != Tail; ++Head)
+            {
+                const io_uring_cqe& CQE = m_pCQEs[Head & *m_pCQMask];
+                if (CQE.user_data == 0)
+                {
+                    Stop = true;
+                    continue;
+                }
+
+                ReadState* pState = reinterpret_cast<ReadState*>(CQE.user_data);
+                ++NumCompletedReads;
+
+                bool Complete = true;
+                if (CQE.res > 0)
+                {
+                    // Continue short reads until the end of the file is reached
+                    pState->BytesRead += static_cast<size_t>(CQE.res);
+                    Complete = pState->BytesRead >= pState->Size;
+                }
+                else if (CQE.res == -EAGAIN || CQE.res == -EINTR)
+                {
+                    Complete = false;
+                }
+                // Zero result indicates the end of the file, negative result indicates an error
+
+                if (Complete)
+                    CompletedReads.push_back(pState);
+                else
+                    m_RetriedReads.push_back(pState);
+            }
+            __atomic_store_n(m_pCQHead, Head, __ATOMIC_RELEASE);
+
+            if (NumCompletedReads > 0)
+            {
+                std::lock_guard<std::mutex> Lock{m_SubmitMtx};
+                VERIFY_EXPR(m_NumReadsInFlight >= NumCompletedReads);
+                m_NumReadsInFlight -= NumCompletedReads;
+                m_QueuedReads.insert(m_QueuedReads.begin(), m_RetriedReads.begin(), m_RetriedReads.end());
+                // Reads that fail to submit are completed with the bytes read so far
+                SubmitQueuedReadsUnsafe(CompletedReads);
+            }
+            m_RetriedReads.clear();
+
+            for (ReadState* pState : CompletedReads)
+                CompleteRead(pState);
+            CompletedReads.clear();
+
+            if (Stop)
+                break;
+        }
+    }
+
+private:
+    int m_RingFd = -1;
+
+    void*         m_pSQRing    = nullptr;
+    size_t        m_SQRingSize = 0;
+    void*         m_pCQRing    = nullptr;
+    size_t        m_CQRingSize = 0;
+    io_uring_sqe* m_pSQEs      = nullptr;
+    size_t        m_SQEsSize   = 0;
+
+    unsigned int* m_pSQHead  = nullptr;
+    unsigned int* m_pSQTail  = nullptr;
+    unsigned int* m_pSQMask  = nullptr;
+    unsigned int* m_pSQArray = nullptr;
+
+    unsigned int* m_pCQHead = nullptr;
+    unsigned int* m_pCQTail = nullptr;
+    unsigned int* m_pCQMask = nullptr;
+    io_uring_cqe* m_pCQEs   = nullptr;
+
+    std::mutex             m_SubmitMtx;
+    std::deque<ReadState*> m_QueuedReads;
+    Uint32                 m_NumReadsInFlight = 0;
+    Uint32                 m_MaxReadsInFlight = 0;
+
+    // Only accessed by the completion thread
+    std::vector<ReadState*> m_RetriedReads;
+
+    std::thread m_CompletionThread;
+};
+
+#endif
+
+} // namespace
+
+
+RefCntAutoPtr<IAsyncTask> AsyncFileIO::ReadAsync(const AsyncFileReadRequest& Request)
+{
+    RefCntAutoPtr<AsyncFileReadTask> pTask{MakeNewRCObj<AsyncFileReadTask>()()};
+
+    AsyncFileReadRequest TaskRequest{Request};
+    TaskRequest.OnComplete = [pTask, OnComplete = Request.OnComplete](size_t BytesRead) {
+        if (OnComplete)
+            OnComplete(BytesRead);
+        pTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+    };
+    SubmitReads(&TaskRequest, 1);
+
+    return pTask;
+}
+
+
+RefCntAutoPtr<AsyncFileIO> CreateAsyncFileIO(const AsyncFileIOCreateInfo& CreateInfo)
+{
+    DEV_CHECK_ERR(CreateInfo.Backend < ASYNC_FILE_IO_BACKEND_COUNT, "Invalid backend");
+
+    if (CreateInfo.Backend == ASYNC_FILE_IO_BACKEND_AUTO || CreateInfo.Backend == ASYNC_FILE_IO_BACKEND_IO_URING)
+    {
+#if DILIGENT_IO_URING_SUPPORTED
+        RefCntAutoPtr<IoUringAsyncFileIO> pFileIO{MakeNewRCObj<IoUringAsyncFileIO>()(CreateInfo)};
+        if (pFileIO->IsInitialized())
+            return pFileIO;
+#endif
+        if (CreateInfo.Backend == ASYNC_FILE_IO_BACKEND_IO_URING)
+            LOG_WARNING_MESSAGE("io_uring is not available. Falling back to the thread pool backend.");
+    }
+
+    return RefCntAutoPtr<AsyncFileIO>{MakeNewRCObj<ThreadPoolAsyncFileIO>()(CreateInfo)};
+}
+
+
+RefCntAutoPtr<IAsyncTask> ReadFileAsync(AsyncFileIO* pFileIO,
+                                        AsyncFile*   pFile,
+                                        IDataBlob*   pData,
+                                        size_t       ChunkSize)
+{
+    DEV_CHECK_ERR(pFileIO != nullptr && pFile != nullptr && pData != nullptr, "File I/O service, file and data blob must not be null");
+
+    RefCntAutoPtr<AsyncFileReadTask> pTask{MakeNewRCObj<AsyncFileReadTask>()()};
+
+    const size_t FileSize = StaticCast<size_t>(pFile->GetSize());
+    pData->Resize(FileSize);
+    if (FileSize == 0)
+    {
+        pTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+        return pTask;
+    }
+
+    ChunkSize = std::max(ChunkSize, size_t{1});
+
+    struct ReadFileState
+    {
+        std::atomic<size_t> NumChunksLeft{0};
+        std::atomic<bool>   Failed{false};
+    };
+    auto pState = std::make_shared<ReadFileState>();
+
+    RefCntAutoPtr<IDataBlob> pDataBlob{pData};
+
+    std::vector<AsyncFileReadRequest> Requests((FileSize + ChunkSize - 1) / ChunkSize);
+    pState->NumChunksLeft.store(Requests.size());
+    for (size_t i = 0; i < Requests.size(); ++i)
+    {
+        AsyncFileReadRequest& Request = Requests[i];
+
+        Request.pFile      = pFile;
+        Request.Offset     = Uint64{i} * ChunkSize;
+        Request.Size       = std::min(ChunkSize, FileSize - i * ChunkSize);
+        Request.pData      = pData->GetDataPtr(i * ChunkSize);
+        Request.OnComplete = [pState, pTask, pDataBlob, ExpectedSize = Request.Size](size_t BytesRead) {
+            if (BytesRead != ExpectedSize)
+                pState->Failed.store(true);
+
+            if (pState->NumChunksLeft.fetch_sub(1) == 1)
+            {
+                if (pState->Failed.load())
+                    pDataBlob->Resize(0);
+                pTask->SetStatus(ASYNC_TASK_STATUS_COMPLETE);
+            }
+        };
+    }
+    pFileIO->SubmitReads(Requests.data(), Requests.size());
+
+    return pTask;
+}
+
+} // namespace Diligent
@@ -0,0 +1,191 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "AsyncFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Diligent
+{
+
+RefCntAutoPtr<AsyncFileStream> AsyncFileStream::Create(AsyncFileIO* pFileIO,
+                                                       const Char*  Path,
+                                                       size_t       ChunkSize,
+                                                       Uint32       NumChunks)
+{
+    DEV_CHECK_ERR(pFileIO != nullptr, "File I/O service must not be null");
+    if (pFileIO == nullptr)
+        return {};
+
+    RefCntAutoPtr<AsyncFile> pFile = pFileIO->OpenFile(Path);
+    if (!pFile)
+        return {};
+
+    return RefCntAutoPtr<AsyncFileStream>{MakeNewRCObj<AsyncFileStream>()(pFileIO, pFile, ChunkSize, NumChunks)};
+}
+
+AsyncFileStream::AsyncFileStream(IReferenceCounters* pRefCounters,
+                                 AsyncFileIO*        pFileIO,
+                                 AsyncFile*          pFile,
+                                 size_t              ChunkSize,
+                                 Uint32              NumChunks) :
+    TBase{pRefCounters},
+    m_pFileIO{pFileIO},
+    m_pFile{pFile},
+    m_Size{pFile != nullptr ? StaticCast<size_t>(pFile->GetSize()) : 0},
+    m_ChunkSize{std::max(ChunkSize, size_t{1})},
+    m_Chunks(std::max(NumChunks, 1u))
+{
+    VERIFY_EXPR(m_pFileIO != nullptr);
+}
+
+AsyncFileStream::~AsyncFileStream()
+{
+    // The chunk memory must stay valid until the reads are complete
+    for (Chunk& C : m_Chunks)
+    {
+        if (C.pReadTask)
+            C.pReadTask->WaitForCompletion();
+    }
+}
+
+IMPLEMENT_QUERY_INTERFACE(AsyncFileStream, IID_FileStream, TBase)
+
+void AsyncFileStream::RequestChunk(size_t Index)
+{
+    const size_t Offset = Index * m_ChunkSize;
+    if (Offset >= m_Size)
+        return;
+
+    Chunk& C = m_Chunks[Index % m_Chunks.size()];
+    if (C.Index == Index)
+        return;
+
+    if (C.pReadTask)
+        C.pReadTask->WaitForCompletion();
+
+    C.Index     = Index;
+    C.BytesRead = 0;
+    C.Data.resize(std::min(m_ChunkSize, m_Size - Offset));
+
+    AsyncFileReadRequest Request;
+    Request.pFile      = m_pFile;
+    Request.Offset     = Offset;
+    Request.pData      = C.Data.data();
+    Request.Size       = C.Data.size();
+    Request.OnComplete = [&C](size_t BytesRead) {
+        C.BytesRead = BytesRead;
+    };
+    C.pReadTask = m_pFileIO->ReadAsync(Request);
+}
+
+bool AsyncFileStream::Read(void* Data, size_t Size)
+{
+    Uint8* pDst = static_cast<Uint8*>(Data);
+    while (Size > 0 && m_CurrentOffset < m_Size)
+    {
+        const size_t Index = m_CurrentOffset / m_ChunkSize;
+        for (size_t i = 0; i < m_Chunks.size(); ++i)
+            RequestChunk(Index + i);
+
+        Chunk& C = m_Chunks[Index % m_Chunks.size()];
+        VERIFY_EXPR(C.Index == Index && C.pReadTask);
+        C.pReadTask->WaitForCompletion();
+        if (C.BytesRead != C.Data.size())
+        {
+            LOG_ERROR_MESSAGE("Failed to read ", C.Data.size(), " bytes at offset ", Index * m_ChunkSize);
+            return false;
+        }
+
+        const size_t ChunkOffset = m_CurrentOffset - Index * m_ChunkSize;
+        const size_t NumBytes    = std::min(Size, C.Data.size() - ChunkOffset);
+        memcpy(pDst, C.Data.data() + ChunkOffset, NumBytes);
+
+        pDst += NumBytes;
+        Size -= NumBytes;
+        m_CurrentOffset += NumBytes;
+    }
+
+    return Size == 0;
+}
+
+void AsyncFileStream::ReadBlob(IDataBlob* pData)
+{
+    VERIFY_EXPR(pData != nullptr);
+    const size_t BytesLeft = m_Size - std::min(m_CurrentOffset, m_Size);
+    pData->Resize(BytesLeft);
+    if (!Read(pData->GetDataPtr(), pData->GetSize()))
+        pData->Resize(0);
+}
+
+bool AsyncFileStream::Write(const void* Data, size_t Size)
+{
+    DEV_ERROR("Asynchronous file stream is read-only");
+    return false;
+}
+
+bool AsyncFileStream::IsValid()
+{
+    return !!m_pFile;
+}
+
+size_t AsyncFileStream::GetSize()
+{
+    return m_Size;
+}
+
+size_t AsyncFileStream::GetPos()
+{
+    return m_CurrentOffset;
+}
+
+bool AsyncFileStream::SetPos(size_t Offset, int Origin)
+{
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        case FilePosOrigin::Start:
+            m_CurrentOffset = Offset;
+            break;
+
+        case FilePosOrigin::Curr:
+            m_CurrentOffset += Offset;
+            break;
+
+        case FilePosOrigin::End:
+            m_CurrentOffset = m_Size + Offset;
+            break;
+
+        default:
+            UNEXPECTED("Unknown origin");
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace Diligent
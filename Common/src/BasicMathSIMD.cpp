@@ -0,0 +1,503 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+#include <cstring>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+#if DILIGENT_SSE2_ENABLED
+struct SSE2Ops
+{
+    using Vec = __m128;
+
+    // clang-format off
+    static Vec   Load (const float* p)      { return _mm_loadu_ps(p); }
+    static void  Store(float* p, Vec v)     { _mm_storeu_ps(p, v); }
+    static Vec   Set  (float f)             { return _mm_set1_ps(f); }
+    static Vec   Zero ()                    { return _mm_setzero_ps(); }
+    static Vec   Add  (Vec a, Vec b)        { return _mm_add_ps(a, b); }
+    static Vec   Sub  (Vec a, Vec b)        { return _mm_sub_ps(a, b); }
+    static Vec   Mul  (Vec a, Vec b)        { return _mm_mul_ps(a, b); }
+    static Vec   Div  (Vec a, Vec b)        { return _mm_div_ps(a, b); }
+
+    // (a0, a1, b0, b1)
+    static Vec MoveLH(Vec a, Vec b) { return _mm_movelh_ps(a, b); }
+    // (a2, a3, b2, b3)
+    static Vec MoveHL(Vec a, Vec b) { return _mm_movehl_ps(b, a); }
+    // clang-format on
+
+    // (a[X], a[Y], b[Z], b[W])
+    template <int X, int Y, int Z, int W>
+    static Vec Shuffle(Vec a, Vec b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
+    static void Transpose(Vec& r0, Vec& r1, Vec& r2, Vec& r3)
+    {
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    }
+};
+#endif
+
+#if DILIGENT_NEON_ENABLED
+struct NEONOps
+{
+    using Vec = float32x4_t;
+
+    // clang-format off
+    static Vec  Load (const float* p)  { return vld1q_f32(p); }
+    static void Store(float* p, Vec v) { vst1q_f32(p, v); }
+    static Vec  Set  (float f)         { return vdupq_n_f32(f); }
+    static Vec  Zero ()                { return vdupq_n_f32(0); }
+    static Vec  Add  (Vec a, Vec b)    { return vaddq_f32(a, b); }
+    static Vec  Sub  (Vec a, Vec b)    { return vsubq_f32(a, b); }
+    static Vec  Mul  (Vec a, Vec b)    { return vmulq_f32(a, b); }
+
+    static Vec MoveLH(Vec a, Vec b) { return vcombine_f32(vget_low_f32(a), vget_low_f32(b)); }
+    static Vec MoveHL(Vec a, Vec b) { return vcombine_f32(vget_high_f32(a), vget_high_f32(b)); }
+    // clang-format on
+
+    static Vec Div(Vec a, Vec b)
+    {
+#    if defined(__aarch64__) || defined(_M_ARM64)
+        return vdivq_f32(a, b);
+#    else
+        // 32-bit NEON has no division instruction
+        float fa[4], fb[4];
+        vst1q_f32(fa, a);
+        vst1q_f32(fb, b);
+        for (int i = 0; i < 4; ++i)
+            fa[i] /= fb[i];
+        return vld1q_f32(fa);
+#    endif
+    }
+
+    template <int X, int Y, int Z, int W>
+    static Vec Shuffle(Vec a, Vec b)
+    {
+        Vec r = vdupq_n_f32(vgetq_lane_f32(a, X));
+        r     = vsetq_lane_f32(vgetq_lane_f32(a, Y), r, 1);
+        r     = vsetq_lane_f32(vgetq_lane_f32(b, Z), r, 2);
+        r     = vsetq_lane_f32(vgetq_lane_f32(b, W), r, 3);
+        return r;
+    }
+
+    static void Transpose(Vec& r0, Vec& r1, Vec& r2, Vec& r3)
+    {
+        const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+        const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+
+        r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+        r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+        r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+        r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+    }
+};
+#endif
+
+#if DILIGENT_SSE2_ENABLED
+using SIMD = SSE2Ops;
+#elif DILIGENT_NEON_ENABLED
+using SIMD = NEONOps;
+#endif
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+
+using Vec = SIMD::Vec;
+
+template <int X, int Y, int Z, int W>
+Vec Swizzle(Vec a)
+{
+    return SIMD::Shuffle<X, Y, Z, W>(a, a);
+}
+
+template <int I>
+Vec Splat(Vec a)
+{
+    return SIMD::Shuffle<I, I, I, I>(a, a);
+}
+
+struct MatrixRows
+{
+    Vec r[4];
+
+    explicit MatrixRows(const float4x4& m)
+    {
+        for (int i = 0; i < 4; ++i)
+            r[i] = SIMD::Load(m.m[i]);
+    }
+
+    void Store(float4x4& m) const
+    {
+        for (int i = 0; i < 4; ++i)
+            SIMD::Store(m.m[i], r[i]);
+    }
+};
+
+// Computes a row of the matrix product. The computations are performed
+// in the same order as in Matrix4x4::Mul, including the addition to zero,
+// which turns the negative zero into the positive one.
+inline Vec MultiplyRow(const float* Row, const MatrixRows& m)
+{
+    Vec r = SIMD::Add(SIMD::Zero(), SIMD::Mul(SIMD::Set(Row[0]), m.r[0]));
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(Row[1]), m.r[1]));
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(Row[2]), m.r[2]));
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(Row[3]), m.r[3]));
+    return r;
+}
+
+inline void MultiplyMatrices(const float4x4& m1, const MatrixRows& m2, float4x4& Result)
+{
+    // Compute all rows before writing the result as it may overlap with the arguments
+    Vec r[4];
+    for (int i = 0; i < 4; ++i)
+        r[i] = MultiplyRow(m1.m[i], m2);
+    for (int i = 0; i < 4; ++i)
+        SIMD::Store(Result.m[i], r[i]);
+}
+
+// Same order as in Vector4::operator*(const Matrix4x4&)
+inline Vec TransformVector(float x, float y, float z, float w, const MatrixRows& m)
+{
+    Vec r = SIMD::Mul(SIMD::Set(x), m.r[0]);
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(y), m.r[1]));
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(z), m.r[2]));
+    r     = SIMD::Add(r, SIMD::Mul(SIMD::Set(w), m.r[3]));
+    return r;
+}
+
+// The inverse is computed using the block-wise inversion of 2x2 sub-matrices:
+//
+//      M = | A  B |    M^-1 = 1/|M| | X  Y |
+//          | C  D |                 | Z  W |
+//
+// where the 2x2 matrices are stored in the row-major order in a single vector.
+// In the comments below, A# is the adjugate matrix of A, and |A| is its determinant.
+
+// A * B
+inline Vec Mat2Mul(Vec a, Vec b)
+{
+    return SIMD::Add(SIMD::Mul(a, Swizzle<0, 3, 0, 3>(b)),
+                     SIMD::Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+// A# * B
+inline Vec Mat2AdjMul(Vec a, Vec b)
+{
+    return SIMD::Sub(SIMD::Mul(Swizzle<3, 3, 0, 0>(a), b),
+                     SIMD::Mul(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+// A * B#
+inline Vec Mat2MulAdj(Vec a, Vec b)
+{
+    return SIMD::Sub(SIMD::Mul(a, Swizzle<3, 0, 3, 0>(b)),
+                     SIMD::Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+inline void InvertMatrix(MatrixRows& m)
+{
+    const Vec A = SIMD::MoveLH(m.r[0], m.r[1]);
+    const Vec B = SIMD::MoveHL(m.r[0], m.r[1]);
+    const Vec C = SIMD::MoveLH(m.r[2], m.r[3]);
+    const Vec D = SIMD::MoveHL(m.r[2], m.r[3]);
+
+    // (|A|, |B|, |C|, |D|)
+    const Vec DetSub = SIMD::Sub(SIMD::Mul(SIMD::Shuffle<0, 2, 0, 2>(m.r[0], m.r[2]), SIMD::Shuffle<1, 3, 1, 3>(m.r[1], m.r[3])),
+                                 SIMD::Mul(SIMD::Shuffle<1, 3, 1, 3>(m.r[0], m.r[2]), SIMD::Shuffle<0, 2, 0, 2>(m.r[1], m.r[3])));
+
+    const Vec DetA = Splat<0>(DetSub);
+    const Vec DetB = Splat<1>(DetSub);
+    const Vec DetC = Splat<2>(DetSub);
+    const Vec DetD = Splat<3>(DetSub);
+
+    const Vec D_C = Mat2AdjMul(D, C);
+    const Vec A_B = Mat2AdjMul(A, B);
+
+    // X# = |D|A - B(D#C)
+    Vec X_ = SIMD::Sub(SIMD::Mul(DetD, A), Mat2Mul(B, D_C));
+    // W# = |A|D - C(A#B)
+    Vec W_ = SIMD::Sub(SIMD::Mul(DetA, D), Mat2Mul(C, A_B));
+    // Y# = |B|C - D(A#B)#
+    Vec Y_ = SIMD::Sub(SIMD::Mul(DetB, C), Mat2MulAdj(D, A_B));
+    // Z# = |C|B - A(D#C)#
+    Vec Z_ = SIMD::Sub(SIMD::Mul(DetC, B), Mat2MulAdj(A, D_C));
+
+    // tr((A#B)(D#C)) in all components
+    Vec Tr = SIMD::Mul(A_B, Swizzle<0, 2, 1, 3>(D_C));
+    Tr     = SIMD::Add(Tr, Swizzle<2, 3, 0, 1>(Tr));
+    Tr     = SIMD::Add(Tr, Swizzle<1, 0, 3, 2>(Tr));
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    const Vec DetM = SIMD::Sub(SIMD::Add(SIMD::Mul(DetA, DetD), SIMD::Mul(DetB, DetC)), Tr);
+
+    // (1/|M|, -1/|M|, -1/|M|, 1/|M|): the signs of the adjugate matrix elements
+    static constexpr float AdjSigns[] = {1, -1, -1, 1};
+
+    const Vec RcpDetM = SIMD::Div(SIMD::Load(AdjSigns), DetM);
+
+    X_ = SIMD::Mul(X_, RcpDetM);
+    Y_ = SIMD::Mul(Y_, RcpDetM);
+    Z_ = SIMD::Mul(Z_, RcpDetM);
+    W_ = SIMD::Mul(W_, RcpDetM);
+
+    // Take the adjugates of X#, Y#, Z#, W# and combine the 2x2 matrices into rows
+    m.r[0] = SIMD::Shuffle<3, 1, 3, 1>(X_, Y_);
+    m.r[1] = SIMD::Shuffle<2, 0, 2, 0>(X_, Y_);
+    m.r[2] = SIMD::Shuffle<3, 1, 3, 1>(Z_, W_);
+    m.r[3] = SIMD::Shuffle<2, 0, 2, 0>(Z_, W_);
+}
+
+#endif
+
+#if DILIGENT_AVX2_ENABLED
+
+// Multiplies two rows of the left matrix at a time. Same order of computations as in MultiplyRow().
+inline void MultiplyMatricesAVX(const float4x4& m1, const __m256 (&m2)[4], float4x4& Result)
+{
+    __m256 r[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        // Rows 2*i and 2*i+1 of the left matrix
+        const __m256 Rows = _mm256_loadu_ps(m1.m[2 * i]);
+
+        __m256 p = _mm256_add_ps(_mm256_setzero_ps(), _mm256_mul_ps(_mm256_permute_ps(Rows, 0x00), m2[0]));
+        p        = _mm256_add_ps(p, _mm256_mul_ps(_mm256_permute_ps(Rows, 0x55), m2[1]));
+        p        = _mm256_add_ps(p, _mm256_mul_ps(_mm256_permute_ps(Rows, 0xAA), m2[2]));
+        p        = _mm256_add_ps(p, _mm256_mul_ps(_mm256_permute_ps(Rows, 0xFF), m2[3]));
+        r[i]     = p;
+    }
+    _mm256_storeu_ps(Result.m[0], r[0]);
+    _mm256_storeu_ps(Result.m[2], r[1]);
+}
+
+// Every row of the matrix in both 128-bit lanes
+inline void LoadMatrixRowsAVX(const float4x4& m, __m256 (&Rows)[4])
+{
+    for (int i = 0; i < 4; ++i)
+        Rows[i] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m[i]));
+}
+
+#endif
+
+} // namespace
+
+
+float4x4 MultiplyMatrices(const float4x4& m1, const float4x4& m2)
+{
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    float4x4 Result;
+    MultiplyMatrices(m1, MatrixRows{m2}, Result);
+    return Result;
+#else
+    return m1 * m2;
+#endif
+}
+
+float4 TransformVector(const float4& v, const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    float4 Result;
+    SIMD::Store(Result.Data(), TransformVector(v.x, v.y, v.z, v.w, MatrixRows{m}));
+    return Result;
+#else
+    return v * m;
+#endif
+}
+
+float4x4 InvertMatrix(const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    MatrixRows Rows{m};
+    InvertMatrix(Rows);
+    float4x4 Result;
+    Rows.Store(Result);
+    return Result;
+#else
+    return m.Inverse();
+#endif
+}
+
+void MultiplyMatrices(const float4x4* pLeft,
+                      const float4x4& Right,
+                      float4x4*       pResults,
+                      size_t          Count)
+{
+    DEV_CHECK_ERR(Count == 0 || (pLeft != nullptr && pResults != nullptr), "Source and destination arrays must not be null");
+
+#if DILIGENT_AVX2_ENABLED
+    __m256 RightRows[4];
+    LoadMatrixRowsAVX(Right, RightRows);
+    for (size_t i = 0; i < Count; ++i)
+        MultiplyMatricesAVX(pLeft[i], RightRows, pResults[i]);
+#elif DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    const MatrixRows RightRows{Right};
+    for (size_t i = 0; i < Count; ++i)
+        MultiplyMatrices(pLeft[i], RightRows, pResults[i]);
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pResults[i] = pLeft[i] * Right;
+#endif
+}
+
+void MultiplyMatrices(const float4x4* pLeft,
+                      const float4x4* pRight,
+                      float4x4*       pResults,
+                      size_t          Count)
+{
+    DEV_CHECK_ERR(Count == 0 || (pLeft != nullptr && pRight != nullptr && pResults != nullptr), "Source and destination arrays must not be null");
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+#if DILIGENT_AVX2_ENABLED
+        __m256 RightRows[4];
+        LoadMatrixRowsAVX(pRight[i], RightRows);
+        MultiplyMatricesAVX(pLeft[i], RightRows, pResults[i]);
+#elif DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+        MultiplyMatrices(pLeft[i], MatrixRows{pRight[i]}, pResults[i]);
+#else
+        pResults[i] = pLeft[i] * pRight[i];
+#endif
+    }
+}
+
+void TransformPoints(const float3*   pPoints,
+                     size_t          Count,
+                     const float4x4& m,
+                     float3*         pResults)
+{
+    DEV_CHECK_ERR(Count == 0 || (pPoints != nullptr && pResults != nullptr), "Source and destination arrays must not be null");
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    const MatrixRows Rows{m};
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float3& Src = pPoints[i];
+
+        Vec r = TransformVector(Src.x, Src.y, Src.z, 1, Rows);
+        r     = SIMD::Div(r, Splat<3>(r));
+
+        // The results are not written with a 16-byte store, which would overrun the last element
+        float Result[4];
+        SIMD::Store(Result, r);
+        pResults[i] = float3{Result[0], Result[1], Result[2]};
+    }
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pResults[i] = pPoints[i] * m;
+#endif
+}
+
+void TransformPoints(const float4*   pVectors,
+                     size_t          Count,
+                     const float4x4& m,
+                     float4*         pResults)
+{
+    DEV_CHECK_ERR(Count == 0 || (pVectors != nullptr && pResults != nullptr), "Source and destination arrays must not be null");
+
+    size_t i = 0;
+#if DILIGENT_AVX2_ENABLED
+    // Transform two vectors at a time
+    __m256 Rows[4];
+    LoadMatrixRowsAVX(m, Rows);
+    for (; i + 2 <= Count; i += 2)
+    {
+        const __m256 v = _mm256_loadu_ps(pVectors[i].Data());
+
+        __m256 r = _mm256_mul_ps(_mm256_permute_ps(v, 0x00), Rows[0]);
+        r        = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(v, 0x55), Rows[1]));
+        r        = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(v, 0xAA), Rows[2]));
+        r        = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(v, 0xFF), Rows[3]));
+        _mm256_storeu_ps(pResults[i].Data(), r);
+    }
+#endif
+
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    const MatrixRows MatRows{m};
+    for (; i < Count; ++i)
+    {
+        const float4& Src = pVectors[i];
+        SIMD::Store(pResults[i].Data(), TransformVector(Src.x, Src.y, Src.z, Src.w, MatRows));
+    }
+#else
+    for (; i < Count; ++i)
+        pResults[i] = pVectors[i] * m;
+#endif
+}
+
+void WriteShaderMatrices(const float4x4* pMatrices,
+                         size_t          Count,
+                         void*           pDst,
+                         size_t          DstStride,
+                         bool            Transpose)
+{
+    DEV_CHECK_ERR(Count == 0 || (pMatrices != nullptr && pDst != nullptr), "Source and destination must not be null");
+    DEV_CHECK_ERR(DstStride == 0 || DstStride >= sizeof(float4x4), "Destination stride (", DstStride, ") must be at least ", sizeof(float4x4), " bytes");
+
+    if (DstStride == 0)
+        DstStride = sizeof(float4x4);
+
+    Uint8* pDstBytes = static_cast<Uint8*>(pDst);
+    if (!Transpose)
+    {
+        if (DstStride == sizeof(float4x4))
+        {
+            memcpy(pDstBytes, pMatrices, Count * sizeof(float4x4));
+        }
+        else
+        {
+            for (size_t i = 0; i < Count; ++i)
+                memcpy(pDstBytes + i * DstStride, &pMatrices[i], sizeof(float4x4));
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        float* pDstMatrix = reinterpret_cast<float*>(pDstBytes + i * DstStride);
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+        MatrixRows Rows{pMatrices[i]};
+        SIMD::Transpose(Rows.r[0], Rows.r[1], Rows.r[2], Rows.r[3]);
+        for (int r = 0; r < 4; ++r)
+            SIMD::Store(pDstMatrix + r * 4, Rows.r[r]);
+#else
+        const float4x4 Transposed = pMatrices[i].Transpose();
+        memcpy(pDstMatrix, &Transposed, sizeof(float4x4));
+#endif
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,245 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "FileChangeWatcher.hpp"
+
+#include <cstring>
+
+#include "FileSystem.hpp"
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+#    include <errno.h>
+#    include <dirent.h>
+#    include <unistd.h>
+#    include <sys/inotify.h>
+#    include <sys/stat.h>
+#endif
+
+namespace Diligent
+{
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+
+// Events that indicate that the contents of a directory changed.
+// Note that IN_MODIFY is not used as it is generated for every write, while
+// IN_CLOSE_WRITE is only generated once the file is closed.
+static constexpr uint32_t WatchEventMask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+FileChangeWatcher::FileChangeWatcher(const Char* Directories)
+{
+    if (Directories == nullptr || Directories[0] == '\0')
+        return;
+
+    m_Fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_Fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to initialize inotify: ", strerror(errno));
+        return;
+    }
+
+    FileSystem::SplitPathList(Directories,
+                              [this](const Char* Path, size_t Len) {
+                                  std::string Directory = FileSystem::SimplifyPath(std::string{Path, Len}.c_str(), '/');
+                                  if (Directory.empty())
+                                      Directory = ".";
+                                  AddWatch(Directory, nullptr);
+                                  return true;
+                              });
+}
+
+FileChangeWatcher::~FileChangeWatcher()
+{
+    if (m_Fd >= 0)
+        close(m_Fd);
+}
+
+void FileChangeWatcher::AddWatch(const std::string& Directory, std::vector<std::string>* pFiles)
+{
+    const int Wd = inotify_add_watch(m_Fd, Directory.c_str(), WatchEventMask);
+    if (Wd < 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to watch directory '", Directory, "' for changes: ", strerror(errno));
+        return;
+    }
+    m_Directories[Wd] = Directory;
+
+    // inotify does not watch subdirectories, so we need to add them one by one
+    DIR* pDir = opendir(Directory.c_str());
+    if (pDir == nullptr)
+        return;
+
+    while (const dirent* pEntry = readdir(pDir))
+    {
+        if (strcmp(pEntry->d_name, ".") == 0 || strcmp(pEntry->d_name, "..") == 0)
+            continue;
+
+        std::string Path = Directory + '/' + pEntry->d_name;
+
+        bool IsDirectory = pEntry->d_type == DT_DIR;
+        if (pEntry->d_type == DT_UNKNOWN)
+        {
+            struct stat Stat;
+            IsDirectory = stat(Path.c_str(), &Stat) == 0 && S_ISDIR(Stat.st_mode);
+        }
+
+        if (IsDirectory)
+            AddWatch(Path, pFiles);
+        else if (pFiles != nullptr)
+            pFiles->emplace_back(std::move(Path));
+    }
+    closedir(pDir);
+}
+
+void FileChangeWatcher::RemoveWatches(const std::string& Directory)
+{
+    // Watches of deleted directories are removed by the system, but watches of the
+    // directories that were moved away must be removed explicitly as they would
+    // otherwise report changes under the old paths. Moved directories are
+    // watched again under the new paths when the IN_MOVED_TO event arrives.
+    for (auto it = m_Directories.begin(); it != m_Directories.end();)
+    {
+        const std::string& Path = it->second;
+        if (Path.compare(0, Directory.length(), Directory) == 0 &&
+            (Path.length() == Directory.length() || Path[Directory.length()] == '/'))
+        {
+            inotify_rm_watch(m_Fd, it->first);
+            it = m_Directories.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+bool FileChangeWatcher::IsActive() const
+{
+    return m_Fd >= 0 && !m_Directories.empty();
+}
+
+bool FileChangeWatcher::PollChanges(std::vector<std::string>& ChangedFiles)
+{
+    if (m_Fd < 0)
+        return true;
+
+    bool NoEventsLost = true;
+
+    alignas(inotify_event) char Buffer[4096];
+    for (;;)
+    {
+        const ssize_t Size = read(m_Fd, Buffer, sizeof(Buffer));
+        if (Size < 0 && errno == EINTR)
+            continue;
+        if (Size <= 0)
+            break; // EAGAIN: no more events
+
+        for (const char* Ptr = Buffer; Ptr < Buffer + Size;)
+        {
+            const inotify_event& Event = *reinterpret_cast<const inotify_event*>(Ptr);
+            Ptr += sizeof(inotify_event) + Event.len;
+
+            if (Event.mask & IN_Q_OVERFLOW)
+            {
+                NoEventsLost = false;
+                continue;
+            }
+
+            auto it = m_Directories.find(Event.wd);
+            if (it == m_Directories.end())
+                continue;
+
+            if (Event.mask & IN_IGNORED)
+            {
+                // The directory was deleted or unmounted
+                m_Directories.erase(it);
+                continue;
+            }
+
+            if (Event.len == 0 || Event.name[0] == '\0')
+                continue;
+
+            std::string Path = it->second + '/' + Event.name;
+            if (Event.mask & IN_ISDIR)
+            {
+                // Start watching new directories. Files that were created in the directory
+                // before the watch was added are reported as changed.
+                if (Event.mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    AddWatch(Path, &ChangedFiles);
+                }
+                else if (Event.mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    // Files in the directory are not reported individually, so report the directory itself.
+                    RemoveWatches(Path);
+                    ChangedFiles.emplace_back(std::move(Path));
+                }
+            }
+            else
+            {
+                ChangedFiles.emplace_back(std::move(Path));
+            }
+        }
+    }
+
+    return NoEventsLost;
+}
+
+#else
+
+FileChangeWatcher::FileChangeWatcher(const Char* Directories)
+{
+    if (Directories != nullptr && Directories[0] != '\0')
+    {
+        LOG_WARNING_MESSAGE("File change notifications are not supported on this platform. Directories '", Directories, "' will not be watched.");
+    }
+}
+
+FileChangeWatcher::~FileChangeWatcher()
+{
+}
+
+void FileChangeWatcher::AddWatch(const std::string& Directory, std::vector<std::string>* pFiles)
+{
+}
+
+void FileChangeWatcher::RemoveWatches(const std::string& Directory)
+{
+}
+
+bool FileChangeWatcher::IsActive() const
+{
+    return false;
+}
+
+bool FileChangeWatcher::PollChanges(std::vector<std::string>& ChangedFiles)
+{
+    return true;
+}
+
+#endif
+
+} // namespace Diligent
@@ -207,15 +207,8 @@ void FixedBlockMemoryAllocator::CreateNewPage()
     m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
 }
 
-void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+void* FixedBlockMemoryAllocator::AllocateUnguarded()
 {
-    VERIFY_EXPR(Size > 0);
-
-    Size = AdjustBlockSize(Size);
-    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
-
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-
     if (m_AvailablePages.empty())
     {
         CreateNewPage();
@@ -233,10 +226,9 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     return Ptr;
 }
 
-void FixedBlockMemoryAllocator::Free(void* Ptr)
+void FixedBlockMemoryAllocator::FreeUnguarded(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
+    auto PageIdIt = m_AddrToPageId.find(Ptr);
     if (PageIdIt != m_AddrToPageId.end())
     {
         auto PageId = PageIdIt->second;
@@ -259,6 +251,48 @@ void FixedBlockMemoryAllocator::Free(void* Ptr)
     }
 }
 
+void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    return AllocateUnguarded();
+}
+
+void FixedBlockMemoryAllocator::Free(void* Ptr)
+{
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    FreeUnguarded(Ptr);
+}
+
+void FixedBlockMemoryAllocator::AllocateBatch(size_t Size, void** ppBlocks, size_t NumBlocks)
+{
+    VERIFY_EXPR(Size > 0);
+
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    for (size_t i = 0; i < NumBlocks; ++i)
+        ppBlocks[i] = AllocateUnguarded();
+}
+
+void FixedBlockMemoryAllocator::FreeBatch(void* const* ppBlocks, size_t NumBlocks)
+{
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    for (size_t i = 0; i < NumBlocks; ++i)
+        FreeUnguarded(ppBlocks[i]);
+}
+
+size_t FixedBlockMemoryAllocator::GetReservedSize()
+{
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    return m_PagePool.size() * m_BlockSize * m_NumBlocksInPage;
+}
+
 void* FixedBlockMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
     VERIFY(Alignment <= sizeof(void*), "Alignment (", Alignment, ") exceeds the default alignment (", sizeof(void*), ")");
@@ -0,0 +1,390 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "SIMDOps.hpp"
+#include "PlatformMisc.hpp"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Frustum data in the form used by the culling kernels
+struct FrustumCullingAttribs
+{
+    struct Plane
+    {
+        float3 Normal;
+        float3 AbsNormal;
+        float  Distance = 0;
+    };
+
+    const ViewFrustumExt&     Frustum;
+    const FRUSTUM_PLANE_FLAGS PlaneFlags;
+
+    Plane  Planes[ViewFrustum::NUM_PLANES];
+    Uint32 NumPlanes = 0;
+
+    // Whether the frustum corners need to be tested against the box planes,
+    // see GetBoxVisibility(const ViewFrustumExt&, const BoundBox&, FRUSTUM_PLANE_FLAGS).
+    bool TestCorners = false;
+
+    // All frustum corners are outside of the box min plane along axis i if the maximum
+    // corner coordinate is not greater than the plane coordinate. Similarly, all corners are
+    // outside of the max plane if the minimum corner coordinate is not less than the plane coordinate.
+    float3 CornersMin;
+    float3 CornersMax;
+
+    FrustumCullingAttribs(const ViewFrustumExt& _Frustum, FRUSTUM_PLANE_FLAGS _PlaneFlags) :
+        Frustum{_Frustum},
+        PlaneFlags{_PlaneFlags}
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& FrustumPlane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+            Plane& Dst    = Planes[NumPlanes++];
+            Dst.Normal    = FrustumPlane.Normal;
+            Dst.AbsNormal = abs(FrustumPlane.Normal);
+            Dst.Distance  = FrustumPlane.Distance;
+        }
+
+        TestCorners = (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM;
+
+        CornersMin = CornersMax = Frustum.FrustumCorners[0];
+        for (size_t i = 1; i < _countof(Frustum.FrustumCorners); ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                CornersMin[c] = std::min(CornersMin[c], Frustum.FrustumCorners[i][c]);
+                CornersMax[c] = std::max(CornersMax[c], Frustum.FrustumCorners[i][c]);
+            }
+        }
+    }
+};
+
+BoundBox GetBoundBox(const BoundBoxArrays& Boxes, size_t Idx)
+{
+    const float3 A{Boxes.pMinOrCenter[0][Idx], Boxes.pMinOrCenter[1][Idx], Boxes.pMinOrCenter[2][Idx]};
+    const float3 B{Boxes.pMaxOrHalfExtent[0][Idx], Boxes.pMaxOrHalfExtent[1][Idx], Boxes.pMaxOrHalfExtent[2][Idx]};
+    return Boxes.Layout == BoundBoxArrays::LAYOUT_MIN_MAX ?
+        BoundBox{A, B} :
+        BoundBox{A - B, A + B};
+}
+
+// Kernels call the handler for every group of boxes:
+//
+//      Handler(size_t FirstBox, size_t NumBoxes, Uint32 InvisibleMask, Uint32 FullyVisibleMask)
+//
+// Bit i of the masks corresponds to the box FirstBox + i. Boxes that are neither invisible
+// nor fully visible intersect the frustum.
+
+template <typename HandlerType>
+void CullBoxesGeneric(const FrustumCullingAttribs& Attribs,
+                      const BoundBoxArrays&        Boxes,
+                      size_t                       Start,
+                      size_t                       End,
+                      HandlerType&&                Handler)
+{
+    for (size_t i = Start; i < End; ++i)
+    {
+        const BoxVisibility Visibility = GetBoxVisibility(Attribs.Frustum, GetBoundBox(Boxes, i), Attribs.PlaneFlags);
+        Handler(i, 1,
+                Visibility == BoxVisibility::Invisible ? 1u : 0u,
+                Visibility == BoxVisibility::FullyVisible ? 1u : 0u);
+    }
+}
+
+// Tests SIMD::Width boxes at a time. The computations are performed in the same order
+// as in GetBoxVisibilityAgainstPlane(const Plane3D&, const BoundBox&).
+template <typename SIMD, bool IsMinMax, typename HandlerType>
+void CullBoxesSIMD(const FrustumCullingAttribs& Attribs,
+                   const BoundBoxArrays&        Boxes,
+                   size_t                       Start,
+                   size_t                       End,
+                   HandlerType&&                Handler)
+{
+    using Vec                = typename SIMD::Vec;
+    constexpr size_t Width   = SIMD::Width;
+    constexpr Uint32 AllBits = (1u << Width) - 1u;
+
+    struct PlaneVecs
+    {
+        Vec Normal[3];
+        Vec AbsNormal[3];
+        Vec Distance;
+    };
+    PlaneVecs Planes[ViewFrustum::NUM_PLANES];
+    for (Uint32 i = 0; i < Attribs.NumPlanes; ++i)
+    {
+        const FrustumCullingAttribs::Plane& Plane = Attribs.Planes[i];
+        for (int c = 0; c < 3; ++c)
+        {
+            Planes[i].Normal[c]    = SIMD::Set(Plane.Normal[c]);
+            Planes[i].AbsNormal[c] = SIMD::Set(Plane.AbsNormal[c]);
+        }
+        Planes[i].Distance = SIMD::Set(Plane.Distance);
+    }
+
+    Vec CornersMin[3];
+    Vec CornersMax[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        CornersMin[c] = SIMD::Set(Attribs.CornersMin[c]);
+        CornersMax[c] = SIMD::Set(Attribs.CornersMax[c]);
+    }
+
+    const Vec Half = SIMD::Set(0.5f);
+
+    // The last incomplete group of boxes is copied to the zero-padded buffer
+    float TailData[6][Width] = {};
+
+    for (size_t FirstBox = Start; FirstBox < End; FirstBox += Width)
+    {
+        const size_t NumBoxes = std::min(Width, End - FirstBox);
+
+        Vec A[3];
+        Vec B[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            if (NumBoxes == Width)
+            {
+                A[c] = SIMD::Load(Boxes.pMinOrCenter[c] + FirstBox);
+                B[c] = SIMD::Load(Boxes.pMaxOrHalfExtent[c] + FirstBox);
+            }
+            else
+            {
+                memcpy(TailData[c], Boxes.pMinOrCenter[c] + FirstBox, NumBoxes * sizeof(float));
+                memcpy(TailData[3 + c], Boxes.pMaxOrHalfExtent[c] + FirstBox, NumBoxes * sizeof(float));
+                A[c] = SIMD::Load(TailData[c]);
+                B[c] = SIMD::Load(TailData[3 + c]);
+            }
+        }
+
+        // For the min/max layout, the center and the extent are doubled and are
+        // scaled by 0.5 after the dot product, which is what the scalar code does.
+        Vec Center[3];
+        Vec Extent[3];
+        Vec Min[3];
+        Vec Max[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            if (IsMinMax)
+            {
+                Min[c]    = A[c];
+                Max[c]    = B[c];
+                Center[c] = SIMD::Add(B[c], A[c]);
+                Extent[c] = SIMD::Sub(B[c], A[c]);
+            }
+            else
+            {
+                Center[c] = A[c];
+                Extent[c] = B[c];
+                Min[c]    = SIMD::Sub(A[c], B[c]);
+                Max[c]    = SIMD::Add(A[c], B[c]);
+            }
+        }
+
+        Vec Invisible = SIMD::Zero();
+        Vec AllInside = SIMD::AllOnes();
+        for (Uint32 i = 0; i < Attribs.NumPlanes; ++i)
+        {
+            const PlaneVecs& Plane = Planes[i];
+
+            Vec Distance = SIMD::Add(SIMD::Add(SIMD::Mul(Center[0], Plane.Normal[0]), SIMD::Mul(Center[1], Plane.Normal[1])), SIMD::Mul(Center[2], Plane.Normal[2]));
+            Vec ProjHalf = SIMD::Add(SIMD::Add(SIMD::Mul(Extent[0], Plane.AbsNormal[0]), SIMD::Mul(Extent[1], Plane.AbsNormal[1])), SIMD::Mul(Extent[2], Plane.AbsNormal[2]));
+            if (IsMinMax)
+            {
+                Distance = SIMD::Mul(Distance, Half);
+                ProjHalf = SIMD::Mul(ProjHalf, Half);
+            }
+            Distance = SIMD::Add(Distance, Plane.Distance);
+
+            // Distance < -ProjHalf
+            Invisible = SIMD::Or(Invisible, SIMD::Less(Distance, SIMD::Sub(SIMD::Zero(), ProjHalf)));
+            // Distance > ProjHalf
+            AllInside = SIMD::And(AllInside, SIMD::Less(ProjHalf, Distance));
+        }
+
+        Uint32 InvisibleMask    = SIMD::MoveMask(Invisible);
+        Uint32 FullyVisibleMask = SIMD::MoveMask(AllInside) & ~InvisibleMask;
+        if (Attribs.TestCorners && (InvisibleMask | FullyVisibleMask) != AllBits)
+        {
+            // Test if all frustum corners are outside of one of the box planes
+            Vec CornersOutside = SIMD::Zero();
+            for (int c = 0; c < 3; ++c)
+            {
+                CornersOutside = SIMD::Or(CornersOutside, SIMD::LessEqual(CornersMax[c], Min[c]));
+                CornersOutside = SIMD::Or(CornersOutside, SIMD::LessEqual(Max[c], CornersMin[c]));
+            }
+            InvisibleMask |= SIMD::MoveMask(CornersOutside) & ~FullyVisibleMask;
+        }
+
+        const Uint32 BoxMask = AllBits >> (Width - NumBoxes);
+        Handler(FirstBox, NumBoxes, InvisibleMask & BoxMask, FullyVisibleMask & BoxMask);
+    }
+}
+
+template <typename HandlerType>
+void CullBoxes(const FrustumCullingAttribs& Attribs,
+               const BoundBoxArrays&        Boxes,
+               size_t                       Start,
+               size_t                       End,
+               HandlerType&&                Handler)
+{
+#if DILIGENT_AVX2_ENABLED || DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    using SIMD = NativeSIMDOps;
+    if (Boxes.Layout == BoundBoxArrays::LAYOUT_MIN_MAX)
+        CullBoxesSIMD<SIMD, true>(Attribs, Boxes, Start, End, std::forward<HandlerType>(Handler));
+    else
+        CullBoxesSIMD<SIMD, false>(Attribs, Boxes, Start, End, std::forward<HandlerType>(Handler));
+#else
+    CullBoxesGeneric(Attribs, Boxes, Start, End, std::forward<HandlerType>(Handler));
+#endif
+}
+
+// The number of boxes processed by one task. Must be a multiple of the SIMD width.
+constexpr size_t BoxesPerChunk = 16384;
+
+// The maximum number of tasks that are enqueued into the thread pool
+constexpr size_t MaxCullingTasks = 64;
+
+// Splits the boxes into chunks and calls ChunkHandler(ChunkIdx, Start, End) for every chunk.
+// If the thread pool is not null, the chunks are processed in parallel by the pool and the calling thread.
+template <typename ChunkHandlerType>
+void ProcessChunks(size_t NumBoxes, IThreadPool* pThreadPool, const ChunkHandlerType& ChunkHandler)
+{
+    const size_t NumChunks = (NumBoxes + BoxesPerChunk - 1) / BoxesPerChunk;
+    ParallelFor(pThreadPool, NumChunks, MaxCullingTasks,
+                [&](size_t Chunk) {
+                    ChunkHandler(Chunk, Chunk * BoxesPerChunk, std::min((Chunk + 1) * BoxesPerChunk, NumBoxes));
+                });
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void CheckBoundBoxArrays(const BoundBoxArrays& Boxes)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        DEV_CHECK_ERR(Boxes.pMinOrCenter[c] != nullptr, "Box coordinate array ", c, " must not be null");
+        DEV_CHECK_ERR(Boxes.pMaxOrHalfExtent[c] != nullptr, "Box coordinate array ", 3 + c, " must not be null");
+    }
+    DEV_CHECK_ERR(Boxes.Count <= size_t{UINT32_MAX}, "The number of boxes (", Boxes.Count, ") exceeds the maximum index value");
+}
+#endif
+
+} // namespace
+
+void GetBoxVisibility(const ViewFrustumExt& Frustum,
+                      const BoundBoxArrays& Boxes,
+                      BoxVisibility*        pVisibility,
+                      FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                      IThreadPool*          pThreadPool)
+{
+    if (Boxes.Count == 0)
+        return;
+
+    DEV_CHECK_ERR(pVisibility != nullptr, "Visibility array must not be null");
+#ifdef DILIGENT_DEVELOPMENT
+    CheckBoundBoxArrays(Boxes);
+#endif
+
+    const FrustumCullingAttribs Attribs{Frustum, PlaneFlags};
+    ProcessChunks(Boxes.Count, pThreadPool,
+                  [&](size_t ChunkIdx, size_t Start, size_t End) {
+                      CullBoxes(Attribs, Boxes, Start, End,
+                                [pVisibility](size_t FirstBox, size_t NumBoxes, Uint32 InvisibleMask, Uint32 FullyVisibleMask) {
+                                    for (size_t i = 0; i < NumBoxes; ++i)
+                                    {
+                                        const Uint32 Bit = 1u << i;
+
+                                        pVisibility[FirstBox + i] = (FullyVisibleMask & Bit) != 0 ?
+                                            BoxVisibility::FullyVisible :
+                                            ((InvisibleMask & Bit) != 0 ? BoxVisibility::Invisible : BoxVisibility::Intersecting);
+                                    }
+                                });
+                  });
+}
+
+size_t GetVisibleBoxes(const ViewFrustumExt& Frustum,
+                       const BoundBoxArrays& Boxes,
+                       Uint32*               pIndices,
+                       FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                       IThreadPool*          pThreadPool)
+{
+    if (Boxes.Count == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pIndices != nullptr, "Index array must not be null");
+#ifdef DILIGENT_DEVELOPMENT
+    CheckBoundBoxArrays(Boxes);
+#endif
+
+    const FrustumCullingAttribs Attribs{Frustum, PlaneFlags};
+
+    // Every chunk writes the indices of its visible boxes starting from the chunk's first box,
+    // after which the chunks are compacted.
+    std::vector<size_t> ChunkSizes((Boxes.Count + BoxesPerChunk - 1) / BoxesPerChunk);
+    ProcessChunks(Boxes.Count, pThreadPool,
+                  [&](size_t ChunkIdx, size_t Start, size_t End) {
+                      Uint32* pDst = pIndices + Start;
+                      CullBoxes(Attribs, Boxes, Start, End,
+                                [&pDst](size_t FirstBox, size_t NumBoxes, Uint32 InvisibleMask, Uint32 FullyVisibleMask) {
+                                    Uint32 VisibleMask = ~InvisibleMask & ((1u << NumBoxes) - 1u);
+                                    while (VisibleMask != 0)
+                                    {
+                                        const Uint32 Bit = PlatformMisc::GetLSB(VisibleMask);
+                                        *(pDst++)        = static_cast<Uint32>(FirstBox + Bit);
+                                        VisibleMask &= VisibleMask - 1u;
+                                    }
+                                });
+                      ChunkSizes[ChunkIdx] = pDst - (pIndices + Start);
+                  });
+
+    size_t NumVisible = ChunkSizes[0];
+    for (size_t i = 1; i < ChunkSizes.size(); ++i)
+    {
+        // The destination range precedes the source range, so memmove is required
+        memmove(pIndices + NumVisible, pIndices + i * BoxesPerChunk, ChunkSizes[i] * sizeof(Uint32));
+        NumVisible += ChunkSizes[i];
+    }
+
+    return NumVisible;
+}
+
+} // namespace Diligent
@@ -0,0 +1,598 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "OcclusionCulling.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+#include "SIMDOps.hpp"
+#include "BasicMathSIMD.hpp"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Bin dimensions. Bins are rasterized in parallel and must be multiples of the tile size.
+constexpr Uint32 BinWidth  = 64;
+constexpr Uint32 BinHeight = 32;
+
+// Tile size of the hierarchical depth buffer. Must be a multiple of the SIMD width.
+constexpr Uint32 TileSize = 8;
+
+// The maximum number of triangles set up and binned by one task
+constexpr Uint32 TrianglesPerJob = 2048;
+
+// The number of boxes tested by one task
+constexpr size_t BoxesPerChunk = 1024;
+
+// The maximum number of tasks that are enqueued into the thread pool
+constexpr size_t MaxOcclusionTasks = 64;
+
+float GetNearPlaneDistance(const float4& ClipPos, bool NegativeOneToOneZ)
+{
+    return NegativeOneToOneZ ? ClipPos.z + ClipPos.w : ClipPos.z;
+}
+
+} // namespace
+
+struct SoftwareOcclusionCuller::RasterTriangle
+{
+    // Screen-space vertex positions
+    float X[3];
+    float Y[3];
+
+    // Edge i goes from vertex i to vertex (i + 1) % 3. The pixel center p is inside the triangle if
+    //      EdgeA[i] * (p.x - X[i]) + EdgeB[i] * (p.y - Y[i]) >= 0
+    // for all edges.
+    float EdgeA[3];
+    float EdgeB[3];
+
+    // Depth plane: z(p) = Z0 + DzDx * (p.x - X[0]) + DzDy * (p.y - Y[0])
+    float Z0;
+    float DzDx;
+    float DzDy;
+
+    // Inclusive range of pixels whose centers are inside the triangle bounding box
+    int MinX;
+    int MinY;
+    int MaxX;
+    int MaxY;
+};
+
+struct SoftwareOcclusionCuller::BinningJob
+{
+    size_t MeshIdx       = 0;
+    Uint32 FirstTriangle = 0;
+    Uint32 NumTriangles  = 0;
+
+    std::vector<RasterTriangle> Triangles;
+
+    // Indices of the triangles that overlap every bin
+    std::vector<std::vector<Uint32>> Bins;
+};
+
+namespace
+{
+
+struct TriangleSetupAttribs
+{
+    const Uint32 Width;
+    const Uint32 Height;
+    const bool   NegativeOneToOneZ;
+    const bool   CullBackFaces;
+};
+
+float3 ClipToScreen(const float4& ClipPos, const TriangleSetupAttribs& Attribs)
+{
+    const float InvW = 1.f / ClipPos.w;
+
+    float3 ScreenPos;
+    ScreenPos.x = (ClipPos.x * InvW * 0.5f + 0.5f) * static_cast<float>(Attribs.Width);
+    ScreenPos.y = (0.5f - ClipPos.y * InvW * 0.5f) * static_cast<float>(Attribs.Height);
+    ScreenPos.z = ClipPos.z * InvW;
+    if (Attribs.NegativeOneToOneZ)
+        ScreenPos.z = ScreenPos.z * 0.5f + 0.5f;
+    return ScreenPos;
+}
+
+// Sets up the screen-space triangle for rasterization. Returns false if the triangle
+// is back-facing, degenerate or does not cover any pixel centers.
+template <typename RasterTriangleType>
+bool SetupScreenTriangle(float3 V0, float3 V1, float3 V2, const TriangleSetupAttribs& Attribs, RasterTriangleType& Tri)
+{
+    // Clockwise triangles have positive area since the screen Y axis points down
+    float Area2 = (V1.x - V0.x) * (V2.y - V0.y) - (V2.x - V0.x) * (V1.y - V0.y);
+    if (!(Area2 > 0))
+    {
+        if (Attribs.CullBackFaces || !(Area2 < 0))
+            return false;
+
+        std::swap(V1, V2);
+        Area2 = -Area2;
+    }
+
+    const float MinX = std::max(FastCeil(std::min({V0.x, V1.x, V2.x}) - 0.5f), 0.f);
+    const float MinY = std::max(FastCeil(std::min({V0.y, V1.y, V2.y}) - 0.5f), 0.f);
+    const float MaxX = std::min(FastFloor(std::max({V0.x, V1.x, V2.x}) - 0.5f), static_cast<float>(Attribs.Width - 1));
+    const float MaxY = std::min(FastFloor(std::max({V0.y, V1.y, V2.y}) - 0.5f), static_cast<float>(Attribs.Height - 1));
+    if (!(MinX <= MaxX && MinY <= MaxY))
+        return false;
+
+    Tri.MinX = static_cast<int>(MinX);
+    Tri.MinY = static_cast<int>(MinY);
+    Tri.MaxX = static_cast<int>(MaxX);
+    Tri.MaxY = static_cast<int>(MaxY);
+
+    const float3* Verts[] = {&V0, &V1, &V2};
+    for (int i = 0; i < 3; ++i)
+    {
+        const float3& Start = *Verts[i];
+        const float3& End   = *Verts[(i + 1) % 3];
+
+        Tri.X[i]     = Start.x;
+        Tri.Y[i]     = Start.y;
+        Tri.EdgeA[i] = Start.y - End.y;
+        Tri.EdgeB[i] = End.x - Start.x;
+    }
+
+    const float dZ1 = V1.z - V0.z;
+    const float dZ2 = V2.z - V0.z;
+
+    Tri.Z0   = V0.z;
+    Tri.DzDx = (dZ1 * (V2.y - V0.y) - dZ2 * (V1.y - V0.y)) / Area2;
+    Tri.DzDy = ((V1.x - V0.x) * dZ2 - (V2.x - V0.x) * dZ1) / Area2;
+
+    return true;
+}
+
+// Clips the clip-space triangle against the near plane, projects it to the screen and
+// calls Handler(const RasterTriangle&) for every resulting triangle that needs to be rasterized.
+template <typename RasterTriangleType, typename HandlerType>
+void SetupTriangle(const float4& C0, const float4& C1, const float4& C2, const TriangleSetupAttribs& Attribs, HandlerType&& Handler)
+{
+    const float4* ClipVerts[] = {&C0, &C1, &C2};
+
+    // Reject the triangles that are entirely outside of one of the frustum planes, except for the near plane
+    Uint32 OutCodeAnd = ~0u;
+    float  NearDist[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const float4& C = *ClipVerts[i];
+
+        Uint32 OutCode = 0;
+        OutCode |= C.x < -C.w ? 0x01u : 0u;
+        OutCode |= C.x > +C.w ? 0x02u : 0u;
+        OutCode |= C.y < -C.w ? 0x04u : 0u;
+        OutCode |= C.y > +C.w ? 0x08u : 0u;
+        OutCode |= C.z > +C.w ? 0x10u : 0u;
+        OutCodeAnd &= OutCode;
+
+        NearDist[i] = GetNearPlaneDistance(C, Attribs.NegativeOneToOneZ);
+    }
+    if (OutCodeAnd != 0)
+        return;
+
+    // Clip the triangle against the near plane, which produces at most four vertices
+    float4 Poly[4];
+    int    NumVerts = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        const int j = (i + 1) % 3;
+        if (NearDist[i] >= 0)
+            Poly[NumVerts++] = *ClipVerts[i];
+        if ((NearDist[i] >= 0) != (NearDist[j] >= 0))
+        {
+            const float t    = NearDist[i] / (NearDist[i] - NearDist[j]);
+            Poly[NumVerts++] = *ClipVerts[i] + (*ClipVerts[j] - *ClipVerts[i]) * t;
+        }
+    }
+    if (NumVerts < 3)
+        return;
+
+    float3 ScreenVerts[4];
+    for (int i = 0; i < NumVerts; ++i)
+    {
+        if (!(Poly[i].w > 0))
+            return;
+        ScreenVerts[i] = ClipToScreen(Poly[i], Attribs);
+    }
+
+    for (int i = 2; i < NumVerts; ++i)
+    {
+        RasterTriangleType Tri;
+        if (SetupScreenTriangle(ScreenVerts[0], ScreenVerts[i - 1], ScreenVerts[i], Attribs, Tri))
+            Handler(Tri);
+    }
+}
+
+// Rasterizes the part of the triangle inside the rectangle [X0, X1] x [Y0, Y1] and keeps the minimum depth
+// for every covered pixel center. Every lane performs the same computations, so the results do not depend
+// on the SIMD width.
+template <typename SIMD, typename RasterTriangleType>
+void RasterizeTriangleInRect(const RasterTriangleType& Tri, int X0, int Y0, int X1, int Y1, float* pDepth, size_t Stride)
+{
+    using Vec            = typename SIMD::Vec;
+    constexpr int Width  = static_cast<int>(SIMD::Width);
+    static_assert(TileSize % Width == 0, "Tile size must be a multiple of the SIMD width");
+
+    const int MinX = std::max(Tri.MinX, X0);
+    const int MinY = std::max(Tri.MinY, Y0);
+    const int MaxX = std::min(Tri.MaxX, X1);
+    const int MaxY = std::min(Tri.MaxY, Y1);
+    if (MinX > MaxX || MinY > MaxY)
+        return;
+
+    // Pixel center offsets within a group of pixels
+    static constexpr float LaneOffsets[] = {0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f};
+    static_assert(Width <= _countof(LaneOffsets), "Not enough lane offsets");
+
+    const Vec Offsets = SIMD::Load(LaneOffsets);
+    const Vec Zero    = SIMD::Zero();
+
+    // Lanes outside of the bounding box are masked out so that the same pixels are
+    // rasterized regardless of the SIMD width.
+    const Vec MinCenterX = SIMD::Set(static_cast<float>(MinX) + 0.5f);
+    const Vec MaxCenterX = SIMD::Set(static_cast<float>(MaxX) + 0.5f);
+
+    Vec EdgeA[3];
+    Vec EdgeX[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        EdgeA[i] = SIMD::Set(Tri.EdgeA[i]);
+        EdgeX[i] = SIMD::Set(Tri.X[i]);
+    }
+    const Vec DzDx = SIMD::Set(Tri.DzDx);
+
+    const int StartX = MinX - MinX % Width;
+    for (int y = MinY; y <= MaxY; ++y)
+    {
+        const float CenterY = static_cast<float>(y) + 0.5f;
+
+        Vec EdgeRow[3];
+        for (int i = 0; i < 3; ++i)
+            EdgeRow[i] = SIMD::Set(Tri.EdgeB[i] * (CenterY - Tri.Y[i]));
+        const Vec ZRow = SIMD::Set(Tri.Z0 + Tri.DzDy * (CenterY - Tri.Y[0]));
+
+        float* pRow = pDepth + y * Stride;
+        for (int x = StartX; x <= MaxX; x += Width)
+        {
+            const Vec CenterX = SIMD::Add(SIMD::Set(static_cast<float>(x)), Offsets);
+
+            Vec Inside = SIMD::And(SIMD::LessEqual(MinCenterX, CenterX), SIMD::LessEqual(CenterX, MaxCenterX));
+            for (int i = 0; i < 3; ++i)
+            {
+                const Vec Edge = SIMD::Add(SIMD::Mul(EdgeA[i], SIMD::Sub(CenterX, EdgeX[i])), EdgeRow[i]);
+                Inside         = SIMD::And(Inside, SIMD::LessEqual(Zero, Edge));
+            }
+            if (SIMD::MoveMask(Inside) == 0)
+                continue;
+
+            const Vec Z     = SIMD::Add(SIMD::Mul(DzDx, SIMD::Sub(CenterX, EdgeX[0])), ZRow);
+            const Vec Depth = SIMD::Load(pRow + x);
+            SIMD::Store(pRow + x, SIMD::Select(Inside, SIMD::Min(Depth, Z), Depth));
+        }
+    }
+}
+
+// Returns the maximum depth of the tile
+template <typename SIMD>
+float GetTileMaxDepth(const float* pTile, size_t Stride)
+{
+    using Vec = typename SIMD::Vec;
+
+    Vec MaxDepth = SIMD::Load(pTile);
+    for (Uint32 y = 0; y < TileSize; ++y)
+    {
+        for (Uint32 x = 0; x < TileSize; x += SIMD::Width)
+            MaxDepth = SIMD::Max(MaxDepth, SIMD::Load(pTile + y * Stride + x));
+    }
+
+    float Lanes[SIMD::Width];
+    SIMD::Store(Lanes, MaxDepth);
+    return *std::max_element(Lanes, Lanes + SIMD::Width);
+}
+
+} // namespace
+
+
+SoftwareOcclusionCuller::SoftwareOcclusionCuller(const CreateInfo& CI) :
+    m_Width{CI.Width},
+    m_Height{CI.Height},
+    m_NegativeOneToOneZ{CI.NegativeOneToOneZ}
+{
+    static_assert(BinWidth % TileSize == 0 && BinHeight % TileSize == 0, "Bin size must be a multiple of the tile size");
+
+    if (m_Width == 0 || m_Height == 0)
+        LOG_ERROR_AND_THROW("Depth buffer size (", m_Width, "x", m_Height, ") must not be zero");
+
+    m_NumBinsX  = (m_Width + BinWidth - 1) / BinWidth;
+    m_NumBinsY  = (m_Height + BinHeight - 1) / BinHeight;
+    m_Stride    = m_NumBinsX * BinWidth;
+    m_NumTilesX = m_Stride / TileSize;
+
+    m_Depth.resize(size_t{m_Stride} * m_NumBinsY * BinHeight);
+    m_TileMaxDepth.resize(size_t{m_NumTilesX} * m_NumBinsY * (BinHeight / TileSize));
+    Clear();
+}
+
+SoftwareOcclusionCuller::~SoftwareOcclusionCuller()
+{
+}
+
+void SoftwareOcclusionCuller::Clear()
+{
+    std::fill(m_Depth.begin(), m_Depth.end(), 1.f);
+    std::fill(m_TileMaxDepth.begin(), m_TileMaxDepth.end(), 1.f);
+}
+
+void SoftwareOcclusionCuller::RasterizeOccluders(const OccluderMesh* pOccluders,
+                                                 size_t              NumOccluders,
+                                                 IThreadPool*        pThreadPool)
+{
+    if (NumOccluders == 0)
+        return;
+
+    DEV_CHECK_ERR(pOccluders != nullptr, "Occluder array must not be null");
+
+    // Split the occluders into jobs and transform the vertices to the clip space
+    size_t NumJobs = 0;
+    m_ClipVertsOffsets.resize(NumOccluders + 1);
+    m_ClipVertsOffsets[0] = 0;
+    for (size_t MeshIdx = 0; MeshIdx < NumOccluders; ++MeshIdx)
+    {
+        const OccluderMesh& Mesh = pOccluders[MeshIdx];
+        DEV_CHECK_ERR(Mesh.NumVertices == 0 || Mesh.pVertices != nullptr, "Occluder ", MeshIdx, " has no vertex data");
+        DEV_CHECK_ERR(Mesh.pIndices == nullptr || Mesh.NumIndices % 3 == 0, "The number of indices of occluder ", MeshIdx, " is not a multiple of 3");
+
+        m_ClipVertsOffsets[MeshIdx + 1] = m_ClipVertsOffsets[MeshIdx] + Mesh.NumVertices;
+
+        const Uint32 NumTriangles = (Mesh.pIndices != nullptr ? Mesh.NumIndices : Mesh.NumVertices) / 3;
+        for (Uint32 FirstTriangle = 0; FirstTriangle < NumTriangles; FirstTriangle += TrianglesPerJob)
+        {
+            if (NumJobs == m_Jobs.size())
+                m_Jobs.emplace_back(new BinningJob{});
+
+            BinningJob& Job   = *m_Jobs[NumJobs++];
+            Job.MeshIdx       = MeshIdx;
+            Job.FirstTriangle = FirstTriangle;
+            Job.NumTriangles  = std::min(TrianglesPerJob, NumTriangles - FirstTriangle);
+        }
+    }
+    if (NumJobs == 0)
+        return;
+
+    m_ClipVerts.resize(m_ClipVertsOffsets[NumOccluders]);
+    ParallelFor(pThreadPool, NumOccluders, MaxOcclusionTasks,
+                [&](size_t MeshIdx) {
+                    const OccluderMesh& Mesh       = pOccluders[MeshIdx];
+                    float4*             pClipVerts = m_ClipVerts.data() + m_ClipVertsOffsets[MeshIdx];
+                    for (Uint32 v = 0; v < Mesh.NumVertices; ++v)
+                    {
+                        const float3& Pos = Mesh.pVertices[v];
+                        pClipVerts[v]     = TransformVector(float4{Pos, 1}, Mesh.WorldViewProj);
+                    }
+                });
+
+    // Set up the triangles and sort them into bins
+    const Uint32 NumBins = m_NumBinsX * m_NumBinsY;
+    ParallelFor(pThreadPool, NumJobs, MaxOcclusionTasks,
+                [&](size_t JobIdx) {
+                    BinningJob&         Job  = *m_Jobs[JobIdx];
+                    const OccluderMesh& Mesh = pOccluders[Job.MeshIdx];
+
+                    Job.Triangles.clear();
+                    Job.Bins.resize(NumBins);
+                    for (std::vector<Uint32>& Bin : Job.Bins)
+                        Bin.clear();
+
+                    const TriangleSetupAttribs Attribs{m_Width, m_Height, m_NegativeOneToOneZ, Mesh.CullBackFaces};
+
+                    const float4* pClipVerts = m_ClipVerts.data() + m_ClipVertsOffsets[Job.MeshIdx];
+                    for (Uint32 t = Job.FirstTriangle; t < Job.FirstTriangle + Job.NumTriangles; ++t)
+                    {
+                        Uint32 Idx[3] = {t * 3, t * 3 + 1, t * 3 + 2};
+                        if (Mesh.pIndices != nullptr)
+                        {
+                            for (Uint32& i : Idx)
+                            {
+                                i = Mesh.pIndices[i];
+                                DEV_CHECK_ERR(i < Mesh.NumVertices, "Index ", i, " is out of range");
+                            }
+                        }
+
+                        SetupTriangle<RasterTriangle>(
+                            pClipVerts[Idx[0]], pClipVerts[Idx[1]], pClipVerts[Idx[2]], Attribs,
+                            [&](const RasterTriangle& Tri) {
+                                const Uint32 TriIdx = static_cast<Uint32>(Job.Triangles.size());
+                                Job.Triangles.push_back(Tri);
+                                for (Uint32 BinY = Tri.MinY / BinHeight; BinY <= Tri.MaxY / BinHeight; ++BinY)
+                                {
+                                    for (Uint32 BinX = Tri.MinX / BinWidth; BinX <= Tri.MaxX / BinWidth; ++BinX)
+                                        Job.Bins[BinY * m_NumBinsX + BinX].push_back(TriIdx);
+                                }
+                            });
+                    }
+                });
+
+    // Rasterize the bins
+    ParallelFor(pThreadPool, NumBins, MaxOcclusionTasks,
+                [&](size_t BinIdx) {
+                    RasterizeBin(static_cast<Uint32>(BinIdx), NumJobs);
+                });
+}
+
+void SoftwareOcclusionCuller::RasterizeBin(Uint32 BinIdx, size_t NumJobs)
+{
+    const Uint32 BinX = BinIdx % m_NumBinsX;
+    const Uint32 BinY = BinIdx / m_NumBinsX;
+
+    const int X0 = static_cast<int>(BinX * BinWidth);
+    const int Y0 = static_cast<int>(BinY * BinHeight);
+    const int X1 = X0 + static_cast<int>(BinWidth) - 1;
+    const int Y1 = Y0 + static_cast<int>(BinHeight) - 1;
+
+    bool BinUpdated = false;
+    for (size_t JobIdx = 0; JobIdx < NumJobs; ++JobIdx)
+    {
+        const BinningJob& Job = *m_Jobs[JobIdx];
+        for (Uint32 TriIdx : Job.Bins[BinIdx])
+        {
+            RasterizeTriangleInRect<NativeSIMDOps>(Job.Triangles[TriIdx], X0, Y0, X1, Y1, m_Depth.data(), m_Stride);
+            BinUpdated = true;
+        }
+    }
+    if (!BinUpdated)
+        return;
+
+    // Update the hierarchical depth buffer
+    for (Uint32 TileY = BinY * (BinHeight / TileSize); TileY < (BinY + 1) * (BinHeight / TileSize); ++TileY)
+    {
+        for (Uint32 TileX = BinX * (BinWidth / TileSize); TileX < (BinX + 1) * (BinWidth / TileSize); ++TileX)
+        {
+            const float* pTile = m_Depth.data() + size_t{TileY} * TileSize * m_Stride + TileX * TileSize;
+
+            m_TileMaxDepth[size_t{TileY} * m_NumTilesX + TileX] = GetTileMaxDepth<NativeSIMDOps>(pTile, m_Stride);
+        }
+    }
+}
+
+bool SoftwareOcclusionCuller::IsBoxVisible(const float4x4& ViewProj, const BoundBox& Box) const
+{
+    float MinX = +FLT_MAX;
+    float MinY = +FLT_MAX;
+    float MaxX = -FLT_MAX;
+    float MaxY = -FLT_MAX;
+    float MinZ = +FLT_MAX;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const float4 Corner{
+            (i & 0x01u) ? Box.Max.x : Box.Min.x,
+            (i & 0x02u) ? Box.Max.y : Box.Min.y,
+            (i & 0x04u) ? Box.Max.z : Box.Min.z,
+            1,
+        };
+        const float4 ClipPos = Corner * ViewProj;
+
+        // Boxes that intersect the near plane are treated as visible
+        if (!(GetNearPlaneDistance(ClipPos, m_NegativeOneToOneZ) > 0 && ClipPos.w > 0))
+            return true;
+
+        const float3 ScreenPos = ClipToScreen(ClipPos, TriangleSetupAttribs{m_Width, m_Height, m_NegativeOneToOneZ, false});
+
+        MinX = std::min(MinX, ScreenPos.x);
+        MinY = std::min(MinY, ScreenPos.y);
+        MaxX = std::max(MaxX, ScreenPos.x);
+        MaxY = std::max(MaxY, ScreenPos.y);
+        MinZ = std::min(MinZ, ScreenPos.z);
+    }
+
+    // All pixels that the screen-space rectangle touches
+    if (!(MaxX >= 0 && MaxY >= 0 && MinX < static_cast<float>(m_Width) && MinY < static_cast<float>(m_Height)))
+        return false;
+
+    // Clamp in float: the projected coordinates may be arbitrarily large when w is small,
+    // and converting an out-of-range float to an integer is undefined behavior.
+    const float  MaxPixelX = static_cast<float>(m_Width - 1);
+    const float  MaxPixelY = static_cast<float>(m_Height - 1);
+    const Uint32 PixelX0   = static_cast<Uint32>(clamp(MinX, 0.f, MaxPixelX));
+    const Uint32 PixelY0   = static_cast<Uint32>(clamp(MinY, 0.f, MaxPixelY));
+    const Uint32 PixelX1   = static_cast<Uint32>(clamp(MaxX, 0.f, MaxPixelX));
+    const Uint32 PixelY1   = static_cast<Uint32>(clamp(MaxY, 0.f, MaxPixelY));
+
+    for (Uint32 TileY = PixelY0 / TileSize; TileY <= PixelY1 / TileSize; ++TileY)
+    {
+        for (Uint32 TileX = PixelX0 / TileSize; TileX <= PixelX1 / TileSize; ++TileX)
+        {
+            // All occluders in the tile are closer than the box
+            if (MinZ > m_TileMaxDepth[size_t{TileY} * m_NumTilesX + TileX])
+                continue;
+
+            const Uint32 y0 = std::max(TileY * TileSize, PixelY0);
+            const Uint32 y1 = std::min(TileY * TileSize + TileSize - 1, PixelY1);
+            const Uint32 x0 = std::max(TileX * TileSize, PixelX0);
+            const Uint32 x1 = std::min(TileX * TileSize + TileSize - 1, PixelX1);
+            for (Uint32 y = y0; y <= y1; ++y)
+            {
+                const float* pRow = m_Depth.data() + size_t{y} * m_Stride;
+                for (Uint32 x = x0; x <= x1; ++x)
+                {
+                    if (pRow[x] >= MinZ)
+                        return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+size_t SoftwareOcclusionCuller::GetVisibleBoxes(const float4x4& ViewProj,
+                                                const BoundBox* pBoxes,
+                                                size_t          NumBoxes,
+                                                Uint32*         pIndices,
+                                                IThreadPool*    pThreadPool) const
+{
+    if (NumBoxes == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pBoxes != nullptr, "Box array must not be null");
+    DEV_CHECK_ERR(pIndices != nullptr, "Index array must not be null");
+
+    // Every chunk writes the indices of its visible boxes starting from the chunk's first box,
+    // after which the chunks are compacted.
+    std::vector<size_t> ChunkSizes((NumBoxes + BoxesPerChunk - 1) / BoxesPerChunk);
+    ParallelFor(pThreadPool, ChunkSizes.size(), MaxOcclusionTasks,
+                [&](size_t ChunkIdx) {
+                    const size_t Start = ChunkIdx * BoxesPerChunk;
+                    const size_t End   = std::min(Start + BoxesPerChunk, NumBoxes);
+
+                    Uint32* pDst = pIndices + Start;
+                    for (size_t i = Start; i < End; ++i)
+                    {
+                        if (IsBoxVisible(ViewProj, pBoxes[i]))
+                            *(pDst++) = static_cast<Uint32>(i);
+                    }
+                    ChunkSizes[ChunkIdx] = pDst - (pIndices + Start);
+                });
+
+    size_t NumVisible = ChunkSizes[0];
+    for (size_t i = 1; i < ChunkSizes.size(); ++i)
+    {
+        // The destination range precedes the source range, so memmove is required
+        memmove(pIndices + NumVisible, pIndices + i * BoxesPerChunk, ChunkSizes[i] * sizeof(Uint32));
+        NumVisible += ChunkSizes[i];
+    }
+
+    return NumVisible;
+}
+
+} // namespace Diligent
@@ -52,12 +52,25 @@ public:
                    const ThreadPoolCreateInfo& PoolCI) :
         TBase{pRefCounters}
     {
+        std::vector<ProcessorSet> ThreadAffinity;
+        if (PoolCI.Placement != THREAD_POOL_PLACEMENT_NONE && PoolCI.NumThreads > 0)
+            ThreadAffinity = GetWorkerThreadAffinity(PlatformMisc::GetCPUTopology(), PoolCI.Placement, PoolCI.NUMANode, PoolCI.NumThreads);
+
+        m_ThreadScratch.resize(PoolCI.NumThreads);
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
         {
             m_WorkerThreads.emplace_back(
-                [this, PoolCI, i] //
+                [this, PoolCI, i, Affinity = i < ThreadAffinity.size() ? ThreadAffinity[i] : ProcessorSet{}] //
                 {
+                    if (!Affinity.IsEmpty() && !PlatformMisc::SetCurrentThreadAffinity(Affinity))
+                        LOG_WARNING_MESSAGE("Failed to set the affinity of worker thread ", i);
+
+                    // The scratch memory is zeroed by the worker thread after the affinity has been set,
+                    // so that the first-touch policy places its pages on the thread's NUMA node.
+                    if (PoolCI.ThreadScratchSize > 0)
+                        m_ThreadScratch[i].resize(PoolCI.ThreadScratchSize);
+
                     if (PoolCI.OnThreadStarted)
                         PoolCI.OnThreadStarted(i);
 
@@ -319,6 +332,14 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual void* DILIGENT_CALL_TYPE GetThreadScratchMemory(Uint32 ThreadId, size_t* pSize) override final
+    {
+        std::vector<Uint8>* pScratch = ThreadId < m_ThreadScratch.size() ? &m_ThreadScratch[ThreadId] : nullptr;
+        if (pSize != nullptr)
+            *pSize = pScratch != nullptr ? pScratch->size() : 0;
+        return pScratch != nullptr && !pScratch->empty() ? pScratch->data() : nullptr;
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
@@ -329,6 +350,9 @@ public:
 private:
     std::vector<std::thread> m_WorkerThreads;
 
+    // Per-thread scratch memory, each element is only accessed by the corresponding worker thread
+    std::vector<std::vector<Uint8>> m_ThreadScratch;
+
     struct QueuedTaskInfo
     {
         RefCntAutoPtr<IAsyncTask>              pTask;
@@ -386,7 +410,7 @@ Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
     VERIFY_EXPR(AffinityMask != 0);
     Uint32 WorkerCore = PlatformMisc::GetLSB(AffinityMask);
     VERIFY_EXPR(WorkerCore < NumCores);
-    Uint64 PrevMask = PlatformMisc::SetCurrentThreadAffinity(Uint64{1} << WorkerCore) != 0;
+    Uint64 PrevMask = PlatformMisc::SetCurrentThreadAffinity(Uint64{1} << WorkerCore);
     if (PrevMask == 0)
     {
         LOG_WARNING_MESSAGE("Failed to pin worker thread ", ThreadId, " to core ", WorkerCore);
@@ -395,4 +419,109 @@ Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
     return PrevMask;
 }
 
+bool PinWorkerThread(Uint32 ThreadId, const ProcessorSet& AllowedProcessors)
+{
+    const Uint32 NumAllowedProcessors = AllowedProcessors.Count();
+    if (NumAllowedProcessors == 0)
+        return false;
+
+    Uint32 WorkerProcessor = AllowedProcessors.FindNext(0);
+    for (Uint32 i = 0; i < ThreadId % NumAllowedProcessors; ++i)
+        WorkerProcessor = AllowedProcessors.FindNext(WorkerProcessor + 1);
+    VERIFY_EXPR(WorkerProcessor != ~0u);
+
+    ProcessorSet WorkerAffinity;
+    WorkerAffinity.Set(WorkerProcessor);
+    if (!PlatformMisc::SetCurrentThreadAffinity(WorkerAffinity))
+    {
+        LOG_WARNING_MESSAGE("Failed to pin worker thread ", ThreadId, " to processor ", WorkerProcessor);
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<ProcessorSet> GetWorkerThreadAffinity(const CPUTopology&    Topology,
+                                                  THREAD_POOL_PLACEMENT Placement,
+                                                  Uint32                NUMANode,
+                                                  size_t                NumThreads)
+{
+    VERIFY_EXPR(Placement < THREAD_POOL_PLACEMENT_COUNT);
+
+    std::vector<ProcessorSet> ThreadAffinity(NumThreads);
+    if (Placement == THREAD_POOL_PLACEMENT_NONE || NumThreads == 0 || Topology.Processors.empty())
+        return ThreadAffinity;
+
+    if (Placement == THREAD_POOL_PLACEMENT_NUMA_LOCAL)
+    {
+        ProcessorSet NodeProcessors;
+        for (const CPUTopology::Processor& Proc : Topology.Processors)
+        {
+            if (Proc.NUMANodeId == NUMANode)
+                NodeProcessors.Set(Proc.Id);
+        }
+
+        if (NodeProcessors.IsEmpty())
+        {
+            LOG_WARNING_MESSAGE("NUMA node ", NUMANode, " has no online processors. Worker threads will not be pinned.");
+            return ThreadAffinity;
+        }
+
+        std::fill(ThreadAffinity.begin(), ThreadAffinity.end(), NodeProcessors);
+        return ThreadAffinity;
+    }
+
+    VERIFY_EXPR(Placement == THREAD_POOL_PLACEMENT_PHYSICAL_CORES || Placement == THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN);
+
+    // Group the processors into cores and the cores into L3 domains
+    std::vector<ProcessorSet>        CoreProcessors(Topology.NumCores);
+    std::vector<std::vector<Uint32>> DomainCores(Topology.NumL3Domains);
+    for (const CPUTopology::Processor& Proc : Topology.Processors)
+    {
+        if (Proc.CoreId >= CoreProcessors.size() || Proc.L3DomainId >= DomainCores.size())
+        {
+            UNEXPECTED("Processor ", Proc.Id, " has invalid core or L3 domain index");
+            continue;
+        }
+
+        if (CoreProcessors[Proc.CoreId].IsEmpty())
+            DomainCores[Proc.L3DomainId].push_back(Proc.CoreId);
+        CoreProcessors[Proc.CoreId].Set(Proc.Id);
+    }
+
+    std::vector<Uint32> CoreOrder;
+    CoreOrder.reserve(CoreProcessors.size());
+    if (Placement == THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN)
+    {
+        for (const std::vector<Uint32>& Cores : DomainCores)
+            CoreOrder.insert(CoreOrder.end(), Cores.begin(), Cores.end());
+    }
+    else
+    {
+        // Take one core from every domain in turn
+        for (size_t i = 0; CoreOrder.size() < CoreProcessors.size(); ++i)
+        {
+            bool CoreAdded = false;
+            for (const std::vector<Uint32>& Cores : DomainCores)
+            {
+                if (i < Cores.size())
+                {
+                    CoreOrder.push_back(Cores[i]);
+                    CoreAdded = true;
+                }
+            }
+            if (!CoreAdded)
+                break;
+        }
+    }
+
+    if (CoreOrder.empty())
+        return ThreadAffinity;
+
+    for (size_t i = 0; i < NumThreads; ++i)
+        ThreadAffinity[i] = CoreProcessors[CoreOrder[i % CoreOrder.size()]];
+
+    return ThreadAffinity;
+}
+
 } // namespace Diligent
@@ -56,6 +56,7 @@ public:
     UNSUPPORTED_METHOD(void, CreateComputePipelineState,    const ComputePipelineStateCreateInfo&    PSOCreateInfo, IPipelineState** ppPipelineState)
     UNSUPPORTED_METHOD(void, CreateRayTracingPipelineState, const RayTracingPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
     UNSUPPORTED_METHOD(void, CreateTilePipelineState,       const TilePipelineStateCreateInfo&       PSOCreateInfo, IPipelineState** ppPipelineState)
+    UNSUPPORTED_METHOD(void, CreatePipelineStates,          const PipelineStateCreateInfo* const*    ppCreateInfos, Uint32 NumPipelines, IPipelineState** ppPipelineStates)
 
     UNSUPPORTED_METHOD(void, CreateShader,      const ShaderCreateInfo&  CreateInfo, IShader** ppShader, IDataBlob** ppCompilerOutput)
 
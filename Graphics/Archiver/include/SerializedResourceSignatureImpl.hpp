@@ -79,6 +79,7 @@ public:
     UNSUPPORTED_CONST_METHOD(Int32,    GetUniqueID)
     UNSUPPORTED_METHOD      (void,     SetUserData, IObject* pUserData)
     UNSUPPORTED_CONST_METHOD(IObject*, GetUserData)
+    UNSUPPORTED_CONST_METHOD(SRBMemoryStats, GetSRBMemoryStats)
     // clang-format on
 
     bool IsCompatible(const SerializedResourceSignatureImpl& Rhs, ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags) const;
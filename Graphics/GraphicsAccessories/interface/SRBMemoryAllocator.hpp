@@ -29,7 +29,11 @@
 
 #pragma once
 
+#include <array>
+
 #include "../../../Common/interface/FixedBlockMemoryAllocator.hpp"
+#include "../../../Common/interface/SpinLock.hpp"
+#include "../../GraphicsEngine/interface/PipelineResourceSignature.h"
 
 namespace Diligent
 {
@@ -51,21 +55,70 @@ public:
 
     IMemoryAllocator& GetShaderVariableDataAllocator(Uint32 Ind)
     {
-        VERIFY_EXPR(m_DataAllocators == nullptr || Ind < m_ShaderVariableDataAllocatorCount);
-        return m_DataAllocators != nullptr ? m_DataAllocators[Ind] : m_RawMemAllocator;
+        VERIFY_EXPR(m_DataPools == nullptr || Ind < m_ShaderVariableDataAllocatorCount);
+        return m_DataPools != nullptr ? m_DataPools[Ind] : m_RawMemAllocator;
     }
 
     IMemoryAllocator& GetResourceCacheDataAllocator(Uint32 Ind)
     {
-        VERIFY_EXPR(m_DataAllocators == nullptr || Ind < m_ResourceCacheDataAllocatorCount);
-        return m_DataAllocators != nullptr ? m_DataAllocators[m_ShaderVariableDataAllocatorCount + Ind] : m_RawMemAllocator;
+        VERIFY_EXPR(m_DataPools == nullptr || Ind < m_ResourceCacheDataAllocatorCount);
+        return m_DataPools != nullptr ? m_DataPools[m_ShaderVariableDataAllocatorCount + Ind] : m_RawMemAllocator;
     }
 
+    SRBMemoryStats GetStats() const;
+
 private:
+    // Fixed-block memory pool with per-thread block caches (magazines).
+    // Every thread allocates blocks from and releases them to its own magazine,
+    // and only accesses the shared pool (and locks its mutex) to refill an empty
+    // magazine or to flush a full one, in batches.
+    class DataPool final : public IMemoryAllocator
+    {
+    public:
+        DataPool(IMemoryAllocator& RawMemAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+        ~DataPool();
+
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+        virtual void  Free(void* Ptr) override final;
+        virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+        virtual void  FreeAligned(void* Ptr) override final;
+
+        void QueryStats(SRBMemoryStats& Stats);
+
+        static constexpr Uint32 NumMagazines     = 8;
+        static constexpr Uint32 MagazineCapacity = 16;
+        static constexpr Uint32 BatchSize        = MagazineCapacity / 2;
+
+    private:
+        struct Magazine
+        {
+            Threading::SpinLock Lock;
+
+            Uint32 NumBlocks = 0;
+            void*  Blocks[MagazineCapacity];
+
+            Uint64 NumAllocations      = 0;
+            Uint64 NumFrees            = 0;
+            Uint64 NumSharedPoolAccess = 0;
+
+            // Keep magazines used by different threads in separate cache lines
+            Uint8 Padding[64];
+        };
+
+        Magazine& GetThreadMagazine()
+        {
+            return m_Magazines[GetThreadMagazineIndex()];
+        }
+        static Uint32 GetThreadMagazineIndex();
+
+        FixedBlockMemoryAllocator          m_SharedPool;
+        std::array<Magazine, NumMagazines> m_Magazines;
+    };
+
     IMemoryAllocator& m_RawMemAllocator;
 
-    // Fixed-block allocators for every shader stage
-    FixedBlockMemoryAllocator* m_DataAllocators = nullptr;
+    // Memory pools for every shader stage
+    DataPool* m_DataPools = nullptr;
 
     Uint32 m_ShaderVariableDataAllocatorCount = 0;
     Uint32 m_ResourceCacheDataAllocatorCount  = 0;
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Block compression of texture data on the CPU
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Attributes of the CompressTextureData function.
+struct CompressTextureDataAttribs
+{
+    /// Block-compressed destination format.
+
+    /// The supported formats are BC1, BC2, BC3 and BC7 (UNORM and UNORM_SRGB),
+    /// BC4 and BC5 (UNORM and SNORM).
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+
+    /// Image width, in pixels.
+    Uint32 Width = 0;
+
+    /// Image height, in pixels.
+    Uint32 Height = 0;
+
+    /// Pointer to the source data.
+
+    /// The source data must use the 8-bit format returned by BCFormatToUncompressed(), i.e.
+    /// RGBA8 for BC1, BC2, BC3 and BC7, R8 for BC4 and RG8 for BC5. sRGB data is compressed as is.
+    const void* pSrcData = nullptr;
+
+    /// Source row stride, in bytes. If zero, the rows are tightly packed.
+    size_t SrcStride = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Stride between the rows of 4x4 blocks in the destination data, in bytes.
+    /// If zero, the rows are tightly packed.
+    ///
+    /// \remarks    To compress the data directly into an upload buffer of the texture uploader,
+    ///             use MappedTextureSubresource::pData and MappedTextureSubresource::Stride
+    ///             returned by IUploadBuffer::GetMappedData().
+    size_t DstStride = 0;
+
+    /// Optional thread pool that is used to compress the blocks in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Compresses texture data to a block-compressed format on the CPU.
+
+/// The encoder is intended for textures generated at run time and favors speed over quality:
+///  - Color endpoints are fitted along the principal axis of the block colors and refined
+///    with a least-squares pass.
+///  - BC1 blocks that contain pixels with alpha below 128 use the 3-color mode with transparent pixels.
+///  - BC7 blocks are encoded in mode 6 (RGBA endpoints with 4-bit indices) or mode 5 (separate color
+///    and alpha endpoints with 2-bit indices), whichever gives the smaller error. Other modes are not used.
+///
+/// Image sizes that are not multiples of 4 are supported; the edge pixels are replicated
+/// to fill the partial blocks.
+///
+/// \return     true if the data was compressed, and false if the parameters are invalid
+///             or the format is not supported.
+bool CompressTextureData(const CompressTextureDataAttribs& Attribs);
+
+} // namespace Diligent
@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Texture data format conversion on the CPU
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Attributes of the ConvertTextureData function.
+struct ConvertTextureDataAttribs
+{
+    /// Source texture format.
+    TEXTURE_FORMAT SrcFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source row stride, in bytes. If zero, the rows are tightly packed.
+    size_t SrcStride = 0;
+
+    /// The number of components in the source data.
+
+    /// If zero, the number of components of the source format is used.
+    /// Setting the value lower than that allows converting from layouts that have no
+    /// matching texture format, for example 24-bit RGB data can be converted by using
+    /// TEX_FORMAT_RGBA8_UNORM with three components. Not allowed for packed formats.
+    Uint32 SrcNumComponents = 0;
+
+    /// Destination texture format.
+    TEXTURE_FORMAT DstFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination row stride, in bytes. If zero, the rows are tightly packed.
+    size_t DstStride = 0;
+
+    /// The number of components in the destination data, see SrcNumComponents.
+    Uint32 DstNumComponents = 0;
+
+    /// Image width, in pixels.
+    Uint32 Width = 0;
+
+    /// Image height, in pixels.
+    Uint32 Height = 0;
+
+    /// Optional thread pool that is used to convert the rows in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Converts texture data between uncompressed texture formats on the CPU.
+
+/// The source pixels are converted to linear RGBA values, which are then written to the
+/// destination. Components missing in the source are set to (0, 0, 0, 1), and components
+/// missing in the destination are dropped. Float values are clamped to the range of the
+/// destination format and rounded to nearest even. sRGB formats are converted to and from
+/// linear space.
+///
+/// The supported formats are all 8-, 16- and 32-bit UNORM, SNORM, UINT, SINT and FLOAT formats,
+/// their sRGB variants, BGRA8 and BGRX8 formats, RGB10A2_UNORM and RGB10A2_UINT.
+/// Typeless, depth-stencil and compressed formats are not supported.
+///
+/// Common conversions, such as RGB8 to RGBA8 expansion, BGRA8/RGBA8 swizzles, sRGB to linear
+/// conversion of 8-bit data, float to half, UNORM8 to float and RGBA32_FLOAT to RGB10A2_UNORM,
+/// are vectorized.
+///
+/// \return     true if the conversion was performed, and false if the parameters are invalid
+///             or the conversion is not supported.
+bool ConvertTextureData(const ConvertTextureDataAttribs& Attribs);
+
+
+/// Converts a 32-bit float to a 16-bit half-precision float, rounding to nearest even.
+/// Values that are too large are converted to infinity.
+Uint16 FloatToHalf(float f);
+
+/// Converts a 16-bit half-precision float to a 32-bit float.
+float HalfToFloat(Uint16 h);
+
+} // namespace Diligent
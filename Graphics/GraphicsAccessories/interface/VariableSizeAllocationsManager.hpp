@@ -223,49 +223,29 @@ public:
         VERIFY_EXPR(Size + AlignmentReserve <= SmallestBlockIt->second.Size);
         VERIFY_EXPR(SmallestBlockIt->second.Size == SmallestBlockItIt->first);
 
-        //     SmallestBlockIt.Offset
-        //        |                                  |
-        //        |<------SmallestBlockIt.Size------>|
-        //        |<------Size------>|<---NewSize--->|
-        //        |                  |
-        //      Offset              NewOffset
-        //
-        auto Offset = SmallestBlockIt->first;
-        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
-        auto AlignedOffset = AlignUp(Offset, Alignment);
-        auto AdjustedSize  = Size + (AlignedOffset - Offset);
-        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
-        auto NewOffset = Offset + AdjustedSize;
-        auto NewSize   = SmallestBlockIt->second.Size - AdjustedSize;
-        VERIFY_EXPR(SmallestBlockItIt == SmallestBlockIt->second.OrderBySizeIt);
-        m_FreeBlocksBySize.erase(SmallestBlockItIt);
-        m_FreeBlocksByOffset.erase(SmallestBlockIt);
-        if (NewSize > 0)
-        {
-            AddNewBlock(NewOffset, NewSize);
-        }
+        return AllocateFromBlock(SmallestBlockIt, Size, Alignment);
+    }
 
-        m_FreeSize -= AdjustedSize;
+    // Allocates the space from the free block with the lowest offset that is large enough
+    // to accommodate the request (first fit). Only blocks that start below MaxOffset are
+    // considered. This is used to move allocations towards the beginning of the managed
+    // space, e.g. when compacting the memory.
+    Allocation AllocateFirstFit(OffsetType Size, OffsetType Alignment, OffsetType MaxOffset)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size || GetMaxFreeBlockSize() < Size)
+            return Allocation::InvalidAllocation();
 
-        if ((Size & (m_CurrAlignment - 1)) != 0)
+        auto AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+        for (auto BlockIt = m_FreeBlocksByOffset.begin(); BlockIt != m_FreeBlocksByOffset.end() && BlockIt->first < MaxOffset; ++BlockIt)
         {
-            if (IsPowerOfTwo(Size))
-            {
-                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
-                m_CurrAlignment = Size;
-            }
-            else
-            {
-                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
-            }
+            if (BlockIt->second.Size >= Size + AlignmentReserve)
+                return AllocateFromBlock(BlockIt, Size, Alignment);
         }
 
-#ifdef DILIGENT_DEBUG
-        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
-        if (!m_DbgDisableDebugValidation)
-            DbgVerifyList();
-#endif
-        return Allocation{Offset, AdjustedSize};
+        return Allocation::InvalidAllocation();
     }
 
     void Free(Allocation&& allocation)
@@ -429,6 +409,53 @@ public:
     }
 
 private:
+    Allocation AllocateFromBlock(TFreeBlocksByOffsetMap::iterator BlockIt, OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(BlockIt->second.Size == BlockIt->second.OrderBySizeIt->first);
+
+        //     BlockIt.Offset
+        //        |                                  |
+        //        |<---------BlockIt.Size----------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        auto Offset = BlockIt->first;
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        auto AlignedOffset = AlignUp(Offset, Alignment);
+        auto AdjustedSize  = Size + (AlignedOffset - Offset);
+        auto NewOffset     = Offset + AdjustedSize;
+        auto NewSize       = BlockIt->second.Size - AdjustedSize;
+        m_FreeBlocksBySize.erase(BlockIt->second.OrderBySizeIt);
+        m_FreeBlocksByOffset.erase(BlockIt);
+        if (NewSize > 0)
+        {
+            AddNewBlock(NewOffset, NewSize);
+        }
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
     void AddNewBlock(OffsetType Offset, OffsetType Size)
     {
         auto NewBlockIt = m_FreeBlocksByOffset.emplace(Offset, Size);
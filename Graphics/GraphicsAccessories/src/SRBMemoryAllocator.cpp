@@ -27,19 +27,125 @@
 
 #include "SRBMemoryAllocator.hpp"
 
+#include <atomic>
+#include <cstring>
+
 namespace Diligent
 {
 
+SRBMemoryAllocator::DataPool::DataPool(IMemoryAllocator& RawMemAllocator, size_t BlockSize, Uint32 NumBlocksInPage) :
+    m_SharedPool{RawMemAllocator, BlockSize, NumBlocksInPage}
+{
+}
+
+SRBMemoryAllocator::DataPool::~DataPool()
+{
+#ifdef DILIGENT_DEBUG
+    {
+        Uint64 NumAllocations = 0;
+        Uint64 NumFrees       = 0;
+        for (const auto& Mag : m_Magazines)
+        {
+            NumAllocations += Mag.NumAllocations;
+            NumFrees += Mag.NumFrees;
+        }
+        VERIFY(NumAllocations == NumFrees, "Memory leak detected: ", NumAllocations - NumFrees, " block(s) have not been released");
+    }
+#endif
+
+    // Return all cached blocks to the shared pool
+    for (auto& Mag : m_Magazines)
+    {
+        m_SharedPool.FreeBatch(Mag.Blocks, Mag.NumBlocks);
+        Mag.NumBlocks = 0;
+    }
+}
+
+Uint32 SRBMemoryAllocator::DataPool::GetThreadMagazineIndex()
+{
+    static std::atomic<Uint32> NextIndex{0};
+    thread_local const Uint32  Index = NextIndex.fetch_add(1) % NumMagazines;
+    return Index;
+}
+
+void* SRBMemoryAllocator::DataPool::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    auto& Mag = GetThreadMagazine();
+
+    std::lock_guard<Threading::SpinLock> Guard{Mag.Lock};
+    if (Mag.NumBlocks == 0)
+    {
+        m_SharedPool.AllocateBatch(Size, Mag.Blocks, BatchSize);
+        Mag.NumBlocks = BatchSize;
+        ++Mag.NumSharedPoolAccess;
+    }
+    ++Mag.NumAllocations;
+    return Mag.Blocks[--Mag.NumBlocks];
+}
+
+void SRBMemoryAllocator::DataPool::Free(void* Ptr)
+{
+    VERIFY_EXPR(Ptr != nullptr);
+#ifdef DILIGENT_DEBUG
+    memset(Ptr, 0xDE, m_SharedPool.GetBlockSize());
+#endif
+
+    auto& Mag = GetThreadMagazine();
+
+    std::lock_guard<Threading::SpinLock> Guard{Mag.Lock};
+    if (Mag.NumBlocks == MagazineCapacity)
+    {
+        Mag.NumBlocks -= BatchSize;
+        m_SharedPool.FreeBatch(Mag.Blocks + Mag.NumBlocks, BatchSize);
+        ++Mag.NumSharedPoolAccess;
+    }
+    ++Mag.NumFrees;
+    Mag.Blocks[Mag.NumBlocks++] = Ptr;
+}
+
+void* SRBMemoryAllocator::DataPool::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY(Alignment <= sizeof(void*), "Alignment (", Alignment, ") exceeds the default alignment (", sizeof(void*), ")");
+    return Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void SRBMemoryAllocator::DataPool::FreeAligned(void* Ptr)
+{
+    Free(Ptr);
+}
+
+void SRBMemoryAllocator::DataPool::QueryStats(SRBMemoryStats& Stats)
+{
+    // Blocks may be allocated by one thread and released by another,
+    // so only the totals across all magazines are meaningful.
+    Uint64 NumAllocations = 0;
+    Uint64 NumFrees       = 0;
+    for (auto& Mag : m_Magazines)
+    {
+        std::lock_guard<Threading::SpinLock> Guard{Mag.Lock};
+        NumAllocations += Mag.NumAllocations;
+        NumFrees += Mag.NumFrees;
+        Stats.NumSharedPoolAccesses += Mag.NumSharedPoolAccess;
+    }
+    const auto NumAllocatedBlocks = NumAllocations >= NumFrees ? NumAllocations - NumFrees : 0;
+
+    Stats.NumAllocatedBlocks += NumAllocatedBlocks;
+    Stats.AllocatedSize += NumAllocatedBlocks * m_SharedPool.GetBlockSize();
+    Stats.ReservedSize += m_SharedPool.GetReservedSize();
+    Stats.TotalAllocations += NumAllocations;
+}
+
+
 SRBMemoryAllocator::~SRBMemoryAllocator()
 {
-    if (m_DataAllocators != nullptr)
+    if (m_DataPools != nullptr)
     {
         auto TotalAllocatorCount = m_ShaderVariableDataAllocatorCount + m_ResourceCacheDataAllocatorCount;
         for (Uint32 s = 0; s < TotalAllocatorCount; ++s)
         {
-            m_DataAllocators[s].~FixedBlockMemoryAllocator();
+            m_DataPools[s].~DataPool();
         }
-        m_RawMemAllocator.Free(m_DataAllocators);
+        m_RawMemAllocator.Free(m_DataPools);
     }
 }
 
@@ -50,7 +156,7 @@ void SRBMemoryAllocator::Initialize(Uint32              SRBAllocationGranularity
                                     const size_t* const ResourceCacheDataSizes)
 {
     VERIFY_EXPR(SRBAllocationGranularity > 1);
-    VERIFY(m_DataAllocators == nullptr && m_ShaderVariableDataAllocatorCount == 0 && m_ResourceCacheDataAllocatorCount == 0, "Allocator is already initialized");
+    VERIFY(m_DataPools == nullptr && m_ShaderVariableDataAllocatorCount == 0 && m_ResourceCacheDataAllocatorCount == 0, "Allocator is already initialized");
 
     m_ShaderVariableDataAllocatorCount = ShaderVariableDataAllocatorCount;
     m_ResourceCacheDataAllocatorCount  = ResourceCacheDataAllocatorCount;
@@ -59,17 +165,31 @@ void SRBMemoryAllocator::Initialize(Uint32              SRBAllocationGranularity
     if (TotalAllocatorCount == 0)
         return;
 
-    auto* pAllocatorsRawMem = m_RawMemAllocator.Allocate(
-        sizeof(FixedBlockMemoryAllocator) * TotalAllocatorCount,
-        "Raw memory for SRBMemoryAllocator::m_ShaderVariableDataAllocators",
+    auto* pPoolsRawMem = m_RawMemAllocator.Allocate(
+        sizeof(DataPool) * TotalAllocatorCount,
+        "Raw memory for SRBMemoryAllocator::m_DataPools",
         __FILE__, __LINE__);
-    m_DataAllocators = reinterpret_cast<FixedBlockMemoryAllocator*>(pAllocatorsRawMem);
+    m_DataPools = reinterpret_cast<DataPool*>(pPoolsRawMem);
 
     for (Uint32 s = 0; s < TotalAllocatorCount; ++s)
     {
         auto size = s < ShaderVariableDataAllocatorCount ? ShaderVariableDataSizes[s] : ResourceCacheDataSizes[s - ShaderVariableDataAllocatorCount];
-        new (m_DataAllocators + s) FixedBlockMemoryAllocator(GetRawAllocator(), size, SRBAllocationGranularity);
+        new (m_DataPools + s) DataPool(GetRawAllocator(), size, SRBAllocationGranularity);
+    }
+}
+
+SRBMemoryStats SRBMemoryAllocator::GetStats() const
+{
+    SRBMemoryStats Stats;
+    if (m_DataPools != nullptr)
+    {
+        auto TotalAllocatorCount = m_ShaderVariableDataAllocatorCount + m_ResourceCacheDataAllocatorCount;
+        for (Uint32 s = 0; s < TotalAllocatorCount; ++s)
+        {
+            m_DataPools[s].QueryStats(Stats);
+        }
     }
+    return Stats;
 }
 
 } // namespace Diligent
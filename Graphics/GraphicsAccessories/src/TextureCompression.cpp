@@ -0,0 +1,911 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureCompression.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Block rows are split into chunks of approximately this number of blocks that are compressed in parallel
+constexpr size_t CompressionChunkSize  = 1024;
+constexpr size_t MaxCompressionTasks   = 32;
+constexpr Uint32 NumBlockPixels        = 16;
+constexpr Uint32 MaxPaletteSize        = 16;
+constexpr float  MaxUnsignedValue      = 255.f;
+constexpr float  MaxSignedValue        = 127.f;
+constexpr Uint32 BC1TransparencyCutoff = 128;
+constexpr Uint32 BC7Mode6IndexBits     = 4;
+constexpr Uint32 BC7Mode6EndpointBits  = 7;
+constexpr Uint32 BC7Mode5IndexBits     = 2;
+constexpr Uint32 BC7Mode5ColorBits     = 7;
+constexpr Uint32 BC7Mode5AlphaBits     = 8;
+
+// Pixel values of a 4x4 block, channel-major
+using BlockChannels = float[4][NumBlockPixels];
+
+struct BlockEncoderInfo
+{
+    Uint32 NumSrcChannels = 0;
+    Uint32 BlockSize      = 0;
+    bool   IsSigned       = false;
+
+    void (*EncodeBlock)(const BlockChannels& Block, bool IsSigned, Uint8* pDst) = nullptr;
+};
+
+template <typename T>
+T Clamp(T Val, T Min, T Max)
+{
+    return std::min(std::max(Val, Min), Max);
+}
+
+// Finds the closest palette entry for every pixel and returns the total squared error.
+float FindClosestIndices(const float (*Pixels)[NumBlockPixels],
+                         Uint32 NumChannels,
+                         const float (*Palette)[4],
+                         Uint32 NumEntries,
+                         Uint8* Indices)
+{
+    float Error = 0;
+#if DILIGENT_AVX2_ENABLED
+    for (Uint32 i = 0; i < NumBlockPixels; i += 8)
+    {
+        __m256 BestDist = _mm256_set1_ps(FLT_MAX);
+        __m256 BestIdx  = _mm256_setzero_ps();
+        for (Uint32 e = 0; e < NumEntries; ++e)
+        {
+            __m256 Dist = _mm256_setzero_ps();
+            for (Uint32 c = 0; c < NumChannels; ++c)
+            {
+                const __m256 Diff = _mm256_sub_ps(_mm256_loadu_ps(&Pixels[c][i]), _mm256_set1_ps(Palette[e][c]));
+                Dist              = _mm256_add_ps(Dist, _mm256_mul_ps(Diff, Diff));
+            }
+            const __m256 IsCloser = _mm256_cmp_ps(Dist, BestDist, _CMP_LT_OQ);
+            BestDist              = _mm256_min_ps(Dist, BestDist);
+            BestIdx               = _mm256_blendv_ps(BestIdx, _mm256_set1_ps(static_cast<float>(e)), IsCloser);
+        }
+
+        alignas(32) Int32 Idx[8];
+        alignas(32) float Dist[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(Idx), _mm256_cvttps_epi32(BestIdx));
+        _mm256_store_ps(Dist, BestDist);
+        for (Uint32 j = 0; j < 8; ++j)
+        {
+            Indices[i + j] = static_cast<Uint8>(Idx[j]);
+            Error += Dist[j];
+        }
+    }
+#elif DILIGENT_SSE2_ENABLED
+    for (Uint32 i = 0; i < NumBlockPixels; i += 4)
+    {
+        __m128 BestDist = _mm_set1_ps(FLT_MAX);
+        __m128 BestIdx  = _mm_setzero_ps();
+        for (Uint32 e = 0; e < NumEntries; ++e)
+        {
+            __m128 Dist = _mm_setzero_ps();
+            for (Uint32 c = 0; c < NumChannels; ++c)
+            {
+                const __m128 Diff = _mm_sub_ps(_mm_loadu_ps(&Pixels[c][i]), _mm_set1_ps(Palette[e][c]));
+                Dist              = _mm_add_ps(Dist, _mm_mul_ps(Diff, Diff));
+            }
+            const __m128 IsCloser = _mm_cmplt_ps(Dist, BestDist);
+            BestDist              = _mm_min_ps(Dist, BestDist);
+            BestIdx               = _mm_or_ps(_mm_and_ps(IsCloser, _mm_set1_ps(static_cast<float>(e))), _mm_andnot_ps(IsCloser, BestIdx));
+        }
+
+        alignas(16) Int32 Idx[4];
+        alignas(16) float Dist[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(Idx), _mm_cvttps_epi32(BestIdx));
+        _mm_store_ps(Dist, BestDist);
+        for (Uint32 j = 0; j < 4; ++j)
+        {
+            Indices[i + j] = static_cast<Uint8>(Idx[j]);
+            Error += Dist[j];
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    for (Uint32 i = 0; i < NumBlockPixels; i += 4)
+    {
+        float32x4_t BestDist = vdupq_n_f32(FLT_MAX);
+        uint32x4_t  BestIdx  = vdupq_n_u32(0);
+        for (Uint32 e = 0; e < NumEntries; ++e)
+        {
+            float32x4_t Dist = vdupq_n_f32(0);
+            for (Uint32 c = 0; c < NumChannels; ++c)
+            {
+                const float32x4_t Diff = vsubq_f32(vld1q_f32(&Pixels[c][i]), vdupq_n_f32(Palette[e][c]));
+                Dist                   = vaddq_f32(Dist, vmulq_f32(Diff, Diff));
+            }
+            const uint32x4_t IsCloser = vcltq_f32(Dist, BestDist);
+            BestDist                  = vminq_f32(Dist, BestDist);
+            BestIdx                   = vbslq_u32(IsCloser, vdupq_n_u32(e), BestIdx);
+        }
+
+        Uint32 Idx[4];
+        float  Dist[4];
+        vst1q_u32(Idx, BestIdx);
+        vst1q_f32(Dist, BestDist);
+        for (Uint32 j = 0; j < 4; ++j)
+        {
+            Indices[i + j] = static_cast<Uint8>(Idx[j]);
+            Error += Dist[j];
+        }
+    }
+#else
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+    {
+        float BestDist = FLT_MAX;
+        for (Uint32 e = 0; e < NumEntries; ++e)
+        {
+            float Dist = 0;
+            for (Uint32 c = 0; c < NumChannels; ++c)
+            {
+                const float Diff = Pixels[c][i] - Palette[e][c];
+                Dist += Diff * Diff;
+            }
+            if (Dist < BestDist)
+            {
+                BestDist   = Dist;
+                Indices[i] = static_cast<Uint8>(e);
+            }
+        }
+        Error += BestDist;
+    }
+#endif
+    return Error;
+}
+
+// Fits the endpoints along the principal axis of the pixel values.
+void FitEndpoints(const float (*Pixels)[NumBlockPixels], Uint32 NumChannels, float MinVal, float MaxVal, float E0[4], float E1[4])
+{
+    float Mean[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        for (Uint32 i = 0; i < NumBlockPixels; ++i)
+            Mean[c] += Pixels[c][i];
+        Mean[c] /= static_cast<float>(NumBlockPixels);
+    }
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+    {
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = c0; c1 < NumChannels; ++c1)
+                Cov[c0][c1] += (Pixels[c0][i] - Mean[c0]) * (Pixels[c1][i] - Mean[c1]);
+        }
+    }
+    for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+    {
+        for (Uint32 c1 = 0; c1 < c0; ++c1)
+            Cov[c0][c1] = Cov[c1][c0];
+    }
+
+    // Power iteration starting from the covariance row with the largest variance
+    Uint32 MaxVarChannel = 0;
+    for (Uint32 c = 1; c < NumChannels; ++c)
+    {
+        if (Cov[c][c] > Cov[MaxVarChannel][MaxVarChannel])
+            MaxVarChannel = c;
+    }
+    float Axis[4] = {};
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        Axis[c] = Cov[MaxVarChannel][c];
+
+    constexpr Uint32 NumPowerIterations = 8;
+    for (Uint32 Iter = 0; Iter < NumPowerIterations; ++Iter)
+    {
+        float NewAxis[4] = {};
+        float MaxComp    = 0;
+        for (Uint32 c0 = 0; c0 < NumChannels; ++c0)
+        {
+            for (Uint32 c1 = 0; c1 < NumChannels; ++c1)
+                NewAxis[c0] += Cov[c0][c1] * Axis[c1];
+            MaxComp = std::max(MaxComp, std::abs(NewAxis[c0]));
+        }
+        if (MaxComp == 0)
+            break;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Axis[c] = NewAxis[c] / MaxComp;
+    }
+
+    float AxisLenSq = 0;
+    for (Uint32 c = 0; c < NumChannels; ++c)
+        AxisLenSq += Axis[c] * Axis[c];
+
+    float MinT = 0;
+    float MaxT = 0;
+    if (AxisLenSq > 0)
+    {
+        MinT = FLT_MAX;
+        MaxT = -FLT_MAX;
+        for (Uint32 i = 0; i < NumBlockPixels; ++i)
+        {
+            float t = 0;
+            for (Uint32 c = 0; c < NumChannels; ++c)
+                t += (Pixels[c][i] - Mean[c]) * Axis[c];
+            MinT = std::min(MinT, t);
+            MaxT = std::max(MaxT, t);
+        }
+        MinT /= AxisLenSq;
+        MaxT /= AxisLenSq;
+    }
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        E0[c] = Clamp(Mean[c] + MinT * Axis[c], MinVal, MaxVal);
+        E1[c] = Clamp(Mean[c] + MaxT * Axis[c], MinVal, MaxVal);
+    }
+}
+
+// Computes the endpoints that minimize the squared error for the given indices.
+// Weights[i] is the weight of the second endpoint in palette entry i.
+bool RefineEndpoints(const float (*Pixels)[NumBlockPixels],
+                     Uint32       NumChannels,
+                     const Uint8* Indices,
+                     const float* Weights,
+                     float        MinVal,
+                     float        MaxVal,
+                     float        E0[4],
+                     float        E1[4])
+{
+    float AA = 0, AB = 0, BB = 0;
+
+    float AX[4] = {};
+    float BX[4] = {};
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+    {
+        const float b = Weights[Indices[i]];
+        const float a = 1.f - b;
+        AA += a * a;
+        AB += a * b;
+        BB += b * b;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            AX[c] += a * Pixels[c][i];
+            BX[c] += b * Pixels[c][i];
+        }
+    }
+
+    const float Det = AA * BB - AB * AB;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        E0[c] = Clamp((BB * AX[c] - AB * BX[c]) / Det, MinVal, MaxVal);
+        E1[c] = Clamp((AA * BX[c] - AB * AX[c]) / Det, MinVal, MaxVal);
+    }
+    return true;
+}
+
+// BC1 color block ------------------------------------------------------------
+
+Uint16 PackRGB565(const float Color[3])
+{
+    const Uint32 R = static_cast<Uint32>(std::lrint(Color[0] * (31.f / 255.f)));
+    const Uint32 G = static_cast<Uint32>(std::lrint(Color[1] * (63.f / 255.f)));
+    const Uint32 B = static_cast<Uint32>(std::lrint(Color[2] * (31.f / 255.f)));
+    return static_cast<Uint16>((R << 11u) | (G << 5u) | B);
+}
+
+void UnpackRGB565(Uint32 Color, float Unpacked[4])
+{
+    const Uint32 R = (Color >> 11u) & 0x1Fu;
+    const Uint32 G = (Color >> 5u) & 0x3Fu;
+    const Uint32 B = Color & 0x1Fu;
+    Unpacked[0]    = static_cast<float>((R << 3u) | (R >> 2u));
+    Unpacked[1]    = static_cast<float>((G << 2u) | (G >> 4u));
+    Unpacked[2]    = static_cast<float>((B << 3u) | (B >> 2u));
+    Unpacked[3]    = 0;
+}
+
+struct BC1ColorBlock
+{
+    Uint16 Color0                  = 0;
+    Uint16 Color1                  = 0;
+    Uint8  Indices[NumBlockPixels] = {};
+    float  Error                   = FLT_MAX;
+};
+
+// Quantizes the endpoints and finds the indices. In the 4-color mode, Color0 must be greater than Color1;
+// in the 3-color mode, it must not be.
+BC1ColorBlock EncodeBC1Endpoints(const BlockChannels& Block, const float E0[4], const float E1[4], bool ThreeColorMode)
+{
+    BC1ColorBlock Res;
+    Res.Color0 = PackRGB565(E0);
+    Res.Color1 = PackRGB565(E1);
+    if ((Res.Color0 < Res.Color1) != ThreeColorMode)
+        std::swap(Res.Color0, Res.Color1);
+
+    float Palette[4][4];
+    UnpackRGB565(Res.Color0, Palette[0]);
+    UnpackRGB565(Res.Color1, Palette[1]);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        if (ThreeColorMode)
+        {
+            Palette[2][c] = (Palette[0][c] + Palette[1][c]) / 2.f;
+        }
+        else
+        {
+            Palette[2][c] = (2.f * Palette[0][c] + Palette[1][c]) / 3.f;
+            Palette[3][c] = (Palette[0][c] + 2.f * Palette[1][c]) / 3.f;
+        }
+    }
+
+    Res.Error = FindClosestIndices(Block, 3, Palette, ThreeColorMode ? 3 : 4, Res.Indices);
+    return Res;
+}
+
+void EncodeBC1ColorBlock(const BlockChannels& SrcBlock, bool AllowTransparency, Uint8* pDst)
+{
+    bool IsTransparent[NumBlockPixels] = {};
+
+    Uint32 NumTransparent = 0;
+    if (AllowTransparency)
+    {
+        for (Uint32 i = 0; i < NumBlockPixels; ++i)
+        {
+            IsTransparent[i] = SrcBlock[3][i] < static_cast<float>(BC1TransparencyCutoff);
+            NumTransparent += IsTransparent[i] ? 1 : 0;
+        }
+    }
+
+    BC1ColorBlock Res;
+    if (NumTransparent == NumBlockPixels)
+    {
+        Res.Color1 = 0xFFFF;
+    }
+    else
+    {
+        // Transparent pixels are replaced with the average opaque color so that they do not affect the endpoints
+        BlockChannels OpaqueBlock;
+        if (NumTransparent > 0)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                float Mean = 0;
+                for (Uint32 i = 0; i < NumBlockPixels; ++i)
+                    Mean += IsTransparent[i] ? 0.f : SrcBlock[c][i];
+                Mean /= static_cast<float>(NumBlockPixels - NumTransparent);
+
+                for (Uint32 i = 0; i < NumBlockPixels; ++i)
+                    OpaqueBlock[c][i] = IsTransparent[i] ? Mean : SrcBlock[c][i];
+            }
+        }
+        const BlockChannels& FitBlock = NumTransparent > 0 ? OpaqueBlock : SrcBlock;
+
+        const bool ThreeColorMode = NumTransparent > 0;
+
+        float E0[4], E1[4];
+        FitEndpoints(FitBlock, 3, 0, MaxUnsignedValue, E0, E1);
+        Res = EncodeBC1Endpoints(FitBlock, E0, E1, ThreeColorMode);
+
+        if (!ThreeColorMode)
+        {
+            // Weights of Color1 in the 4-color palette
+            static constexpr float Weights[] = {0, 1, 1.f / 3.f, 2.f / 3.f};
+
+            const bool IsSwapped = PackRGB565(E0) < PackRGB565(E1);
+            if (RefineEndpoints(FitBlock, 3, Res.Indices, Weights, 0, MaxUnsignedValue, IsSwapped ? E1 : E0, IsSwapped ? E0 : E1))
+            {
+                const BC1ColorBlock Refined = EncodeBC1Endpoints(FitBlock, E0, E1, ThreeColorMode);
+                if (Refined.Error < Res.Error)
+                    Res = Refined;
+            }
+        }
+    }
+
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+    {
+        if (IsTransparent[i])
+            Res.Indices[i] = 3;
+    }
+
+    Uint32 Indices = 0;
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+        Indices |= Uint32{Res.Indices[i]} << (i * 2);
+
+    std::memcpy(pDst + 0, &Res.Color0, sizeof(Res.Color0));
+    std::memcpy(pDst + 2, &Res.Color1, sizeof(Res.Color1));
+    std::memcpy(pDst + 4, &Indices, sizeof(Indices));
+}
+
+// BC4 block ------------------------------------------------------------------
+
+struct BC4Block
+{
+    Int32 Endpoint0               = 0;
+    Int32 Endpoint1               = 0;
+    Uint8 Indices[NumBlockPixels] = {};
+    float Error                   = FLT_MAX;
+};
+
+// In the 8-value mode, Endpoint0 must be greater than Endpoint1; in the 6-value mode, it must not be.
+BC4Block EncodeBC4Endpoints(const float (*Values)[NumBlockPixels], float E0, float E1, bool SixValueMode, bool IsSigned)
+{
+    BC4Block Res;
+    Res.Endpoint0 = static_cast<Int32>(std::lrint(E0));
+    Res.Endpoint1 = static_cast<Int32>(std::lrint(E1));
+    if ((Res.Endpoint0 > Res.Endpoint1) == SixValueMode)
+        std::swap(Res.Endpoint0, Res.Endpoint1);
+
+    const float P0 = static_cast<float>(Res.Endpoint0);
+    const float P1 = static_cast<float>(Res.Endpoint1);
+
+    float Palette[8][4] = {{P0}, {P1}};
+    if (SixValueMode)
+    {
+        for (Uint32 i = 1; i < 5; ++i)
+            Palette[i + 1][0] = (static_cast<float>(5 - i) * P0 + static_cast<float>(i) * P1) / 5.f;
+        Palette[6][0] = IsSigned ? -MaxSignedValue : 0.f;
+        Palette[7][0] = IsSigned ? MaxSignedValue : MaxUnsignedValue;
+    }
+    else
+    {
+        for (Uint32 i = 1; i < 7; ++i)
+            Palette[i + 1][0] = (static_cast<float>(7 - i) * P0 + static_cast<float>(i) * P1) / 7.f;
+    }
+
+    Res.Error = FindClosestIndices(Values, 1, Palette, 8, Res.Indices);
+    return Res;
+}
+
+void EncodeBC4Channel(const float (*Values)[NumBlockPixels], bool IsSigned, Uint8* pDst)
+{
+    const float MinVal = IsSigned ? -MaxSignedValue : 0.f;
+    const float MaxVal = IsSigned ? MaxSignedValue : MaxUnsignedValue;
+
+    float BlockMin = FLT_MAX;
+    float BlockMax = -FLT_MAX;
+    // The range of the values other than the extremes, which the 6-value mode encodes explicitly
+    float InnerMin = FLT_MAX;
+    float InnerMax = -FLT_MAX;
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+    {
+        const float Val = (*Values)[i];
+        BlockMin        = std::min(BlockMin, Val);
+        BlockMax        = std::max(BlockMax, Val);
+        if (Val != MinVal && Val != MaxVal)
+        {
+            InnerMin = std::min(InnerMin, Val);
+            InnerMax = std::max(InnerMax, Val);
+        }
+    }
+
+    BC4Block Res = EncodeBC4Endpoints(Values, BlockMax, BlockMin, false, IsSigned);
+    if (Res.Error > 0)
+    {
+        // Weights of the second endpoint in the 8-value palette
+        static constexpr float Weights[] = {0, 1, 1.f / 7.f, 2.f / 7.f, 3.f / 7.f, 4.f / 7.f, 5.f / 7.f, 6.f / 7.f};
+
+        float E0 = BlockMax;
+        float E1 = BlockMin;
+        if (Res.Endpoint0 < Res.Endpoint1)
+            std::swap(E0, E1);
+        if (RefineEndpoints(Values, 1, Res.Indices, Weights, MinVal, MaxVal, &E0, &E1))
+        {
+            const BC4Block Refined = EncodeBC4Endpoints(Values, E0, E1, false, IsSigned);
+            if (Refined.Error < Res.Error)
+                Res = Refined;
+        }
+
+        if (InnerMin <= InnerMax && (BlockMin == MinVal || BlockMax == MaxVal))
+        {
+            const BC4Block SixValue = EncodeBC4Endpoints(Values, InnerMin, InnerMax, true, IsSigned);
+            if (SixValue.Error < Res.Error)
+                Res = SixValue;
+        }
+    }
+
+    Uint64 Bits = static_cast<Uint64>(Res.Endpoint0 & 0xFF) | (static_cast<Uint64>(Res.Endpoint1 & 0xFF) << 8u);
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+        Bits |= Uint64{Res.Indices[i]} << (16u + i * 3u);
+    std::memcpy(pDst, &Bits, 8);
+}
+
+// BC7 block ----------------------------------------------------------------
+
+// Weights of the second endpoint for 2-bit and 4-bit indices, in 1/64 units
+constexpr Uint32 BC7Weights2[] = {0, 21, 43, 64};
+constexpr Uint32 BC7Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Quantized endpoints and indices of one set of channels in a single-subset BC7 block
+struct BC7Endpoints
+{
+    Uint32 Endpoints[2][4]         = {};
+    Uint32 PBits[2]                = {};
+    Uint8  Indices[NumBlockPixels] = {};
+    float  Error                   = FLT_MAX;
+};
+
+// Mode 6: 7-bit RGBA endpoints with unique p-bits and 4-bit indices
+BC7Endpoints QuantizeBC7Mode6Endpoints(const float (*Pixels)[NumBlockPixels], const float E0[4], const float E1[4])
+{
+    BC7Endpoints Res;
+
+    Uint32 Unquantized[2][4] = {};
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        const float* E = e == 0 ? E0 : E1;
+
+        // Choose the p-bit that gives the smallest error
+        float BestError = FLT_MAX;
+        for (Uint32 p = 0; p < 2; ++p)
+        {
+            float  Error = 0;
+            Uint32 Quantized[4];
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                Quantized[c]     = static_cast<Uint32>(Clamp(std::lrint((E[c] - static_cast<float>(p)) / 2.f), 0l, 127l));
+                const float Diff = static_cast<float>((Quantized[c] << 1u) | p) - E[c];
+                Error += Diff * Diff;
+            }
+            if (Error < BestError)
+            {
+                BestError    = Error;
+                Res.PBits[e] = p;
+                for (Uint32 c = 0; c < 4; ++c)
+                {
+                    Res.Endpoints[e][c] = Quantized[c];
+                    Unquantized[e][c]   = (Quantized[c] << 1u) | p;
+                }
+            }
+        }
+    }
+
+    float Palette[MaxPaletteSize][4];
+    for (Uint32 i = 0; i < MaxPaletteSize; ++i)
+    {
+        const Uint32 w = BC7Weights4[i];
+        for (Uint32 c = 0; c < 4; ++c)
+            Palette[i][c] = static_cast<float>(((64u - w) * Unquantized[0][c] + w * Unquantized[1][c] + 32u) >> 6u);
+    }
+
+    Res.Error = FindClosestIndices(Pixels, 4, Palette, MaxPaletteSize, Res.Indices);
+    return Res;
+}
+
+// Mode 5: 7-bit RGB and 8-bit alpha endpoints without p-bits and with separate 2-bit color and alpha indices
+BC7Endpoints QuantizeBC7Mode5Endpoints(const float (*Pixels)[NumBlockPixels], Uint32 NumChannels, const float E0[4], const float E1[4])
+{
+    BC7Endpoints Res;
+
+    const Uint32 NumBits      = NumChannels == 1 ? BC7Mode5AlphaBits : BC7Mode5ColorBits;
+    const float  MaxQuantized = static_cast<float>((1u << NumBits) - 1u);
+
+    Uint32 Unquantized[2][4] = {};
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        const float* E = e == 0 ? E0 : E1;
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            Res.Endpoints[e][c] = static_cast<Uint32>(std::lrint(E[c] * MaxQuantized / MaxUnsignedValue));
+            Unquantized[e][c]   = (Res.Endpoints[e][c] << (8u - NumBits)) | (Res.Endpoints[e][c] >> (2u * NumBits - 8u));
+        }
+    }
+
+    float Palette[4][4] = {};
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        const Uint32 w = BC7Weights2[i];
+        for (Uint32 c = 0; c < NumChannels; ++c)
+            Palette[i][c] = static_cast<float>(((64u - w) * Unquantized[0][c] + w * Unquantized[1][c] + 32u) >> 6u);
+    }
+
+    Res.Error = FindClosestIndices(Pixels, NumChannels, Palette, 4, Res.Indices);
+    return Res;
+}
+
+// Fits the endpoints, refines them and quantizes them with QuantizeFn(E0, E1).
+template <typename QuantizeFnType>
+BC7Endpoints EncodeBC7Endpoints(const float (*Pixels)[NumBlockPixels],
+                                Uint32         NumChannels,
+                                Uint32         IndexBits,
+                                QuantizeFnType QuantizeFn)
+{
+    const Uint32 NumIndices = 1u << IndexBits;
+
+    float E0[4], E1[4];
+    FitEndpoints(Pixels, NumChannels, 0, MaxUnsignedValue, E0, E1);
+
+    BC7Endpoints Res = QuantizeFn(E0, E1);
+    if (Res.Error > 0)
+    {
+        const Uint32* WeightsTable = IndexBits == BC7Mode5IndexBits ? BC7Weights2 : BC7Weights4;
+
+        float Weights[MaxPaletteSize];
+        for (Uint32 i = 0; i < NumIndices; ++i)
+            Weights[i] = static_cast<float>(WeightsTable[i]) / 64.f;
+
+        if (RefineEndpoints(Pixels, NumChannels, Res.Indices, Weights, 0, MaxUnsignedValue, E0, E1))
+        {
+            const BC7Endpoints Refined = QuantizeFn(E0, E1);
+            if (Refined.Error < Res.Error)
+                Res = Refined;
+        }
+    }
+
+    // The most significant bit of the first pixel index is implicitly zero
+    if (Res.Indices[0] >= NumIndices / 2)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            std::swap(Res.Endpoints[0][c], Res.Endpoints[1][c]);
+        std::swap(Res.PBits[0], Res.PBits[1]);
+        for (Uint32 i = 0; i < NumBlockPixels; ++i)
+            Res.Indices[i] = static_cast<Uint8>(NumIndices - 1 - Res.Indices[i]);
+    }
+    return Res;
+}
+
+class BitWriter
+{
+public:
+    explicit BitWriter(Uint8* pDst) :
+        m_pDst{pDst}
+    {
+        std::memset(m_pDst, 0, 16);
+    }
+
+    void Write(Uint32 Val, Uint32 NumBits)
+    {
+        for (Uint32 i = 0; i < NumBits; ++i, ++m_Pos)
+        {
+            if (Val & (1u << i))
+                m_pDst[m_Pos / 8] |= static_cast<Uint8>(1u << (m_Pos % 8));
+        }
+    }
+
+    void WriteIndices(const Uint8* Indices, Uint32 IndexBits)
+    {
+        // The first index is the anchor index that is stored without its most significant bit
+        for (Uint32 i = 0; i < NumBlockPixels; ++i)
+            Write(Indices[i], i == 0 ? IndexBits - 1 : IndexBits);
+    }
+
+private:
+    Uint8* const m_pDst;
+    Uint32       m_Pos = 0;
+};
+
+void EncodeBC7Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    BitWriter Writer{pDst};
+
+    const BC7Endpoints Mode6 = EncodeBC7Endpoints(Block, 4, BC7Mode6IndexBits,
+                                                  [&](const float E0[4], const float E1[4]) {
+                                                      return QuantizeBC7Mode6Endpoints(Block, E0, E1);
+                                                  });
+    if (Mode6.Error > 0)
+    {
+        // Mode 5 handles blocks where alpha does not correlate with the color better than mode 6
+        const BC7Endpoints Color = EncodeBC7Endpoints(Block, 3, BC7Mode5IndexBits,
+                                                      [&](const float E0[4], const float E1[4]) {
+                                                          return QuantizeBC7Mode5Endpoints(Block, 3, E0, E1);
+                                                      });
+        const BC7Endpoints Alpha = EncodeBC7Endpoints(Block + 3, 1, BC7Mode5IndexBits,
+                                                      [&](const float E0[4], const float E1[4]) {
+                                                          return QuantizeBC7Mode5Endpoints(Block + 3, 1, E0, E1);
+                                                      });
+        if (Color.Error + Alpha.Error < Mode6.Error)
+        {
+            Writer.Write(1u << 5u, 6); // Mode 5
+            Writer.Write(0, 2);        // No channel rotation
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                Writer.Write(Color.Endpoints[0][c], BC7Mode5ColorBits);
+                Writer.Write(Color.Endpoints[1][c], BC7Mode5ColorBits);
+            }
+            Writer.Write(Alpha.Endpoints[0][0], BC7Mode5AlphaBits);
+            Writer.Write(Alpha.Endpoints[1][0], BC7Mode5AlphaBits);
+            Writer.WriteIndices(Color.Indices, BC7Mode5IndexBits);
+            Writer.WriteIndices(Alpha.Indices, BC7Mode5IndexBits);
+            return;
+        }
+    }
+
+    Writer.Write(1u << 6u, 7); // Mode 6
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        Writer.Write(Mode6.Endpoints[0][c], BC7Mode6EndpointBits);
+        Writer.Write(Mode6.Endpoints[1][c], BC7Mode6EndpointBits);
+    }
+    Writer.Write(Mode6.PBits[0], 1);
+    Writer.Write(Mode6.PBits[1], 1);
+    Writer.WriteIndices(Mode6.Indices, BC7Mode6IndexBits);
+}
+
+// Block encoders -------------------------------------------------------------
+
+void EncodeBC1Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    EncodeBC1ColorBlock(Block, true, pDst);
+}
+
+void EncodeBC2Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    Uint64 Alpha = 0;
+    for (Uint32 i = 0; i < NumBlockPixels; ++i)
+        Alpha |= static_cast<Uint64>(std::lrint(Block[3][i] * (15.f / 255.f))) << (i * 4u);
+    std::memcpy(pDst, &Alpha, sizeof(Alpha));
+
+    EncodeBC1ColorBlock(Block, false, pDst + 8);
+}
+
+void EncodeBC3Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    EncodeBC4Channel(Block + 3, false, pDst);
+    EncodeBC1ColorBlock(Block, false, pDst + 8);
+}
+
+void EncodeBC4Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    EncodeBC4Channel(Block + 0, IsSigned, pDst);
+}
+
+void EncodeBC5Block(const BlockChannels& Block, bool IsSigned, Uint8* pDst)
+{
+    EncodeBC4Channel(Block + 0, IsSigned, pDst);
+    EncodeBC4Channel(Block + 1, IsSigned, pDst + 8);
+}
+
+bool GetBlockEncoderInfo(TEXTURE_FORMAT Format, BlockEncoderInfo& Info)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            Info = {4, 8, false, EncodeBC1Block};
+            return true;
+
+        case TEX_FORMAT_BC2_UNORM:
+        case TEX_FORMAT_BC2_UNORM_SRGB:
+            Info = {4, 16, false, EncodeBC2Block};
+            return true;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            Info = {4, 16, false, EncodeBC3Block};
+            return true;
+
+        case TEX_FORMAT_BC4_UNORM:
+        case TEX_FORMAT_BC4_SNORM:
+            Info = {1, 8, Format == TEX_FORMAT_BC4_SNORM, EncodeBC4Block};
+            return true;
+
+        case TEX_FORMAT_BC5_UNORM:
+        case TEX_FORMAT_BC5_SNORM:
+            Info = {2, 16, Format == TEX_FORMAT_BC5_SNORM, EncodeBC5Block};
+            return true;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            Info = {4, 16, false, EncodeBC7Block};
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void LoadBlock(const Uint8*            pSrc,
+               size_t                  SrcStride,
+               const BlockEncoderInfo& Info,
+               Uint32                  X,
+               Uint32                  Y,
+               Uint32                  Width,
+               Uint32                  Height,
+               BlockChannels&          Block)
+{
+    for (Uint32 y = 0; y < 4; ++y)
+    {
+        // Edge pixels are replicated in partial blocks
+        const Uint8* pRow = pSrc + std::min(Y + y, Height - 1) * SrcStride;
+        for (Uint32 x = 0; x < 4; ++x)
+        {
+            const Uint8* pPixel = pRow + std::min(X + x, Width - 1) * Info.NumSrcChannels;
+            const Uint32 i      = y * 4 + x;
+            for (Uint32 c = 0; c < Info.NumSrcChannels; ++c)
+            {
+                Block[c][i] = Info.IsSigned ?
+                    std::max(static_cast<float>(static_cast<Int8>(pPixel[c])), -MaxSignedValue) :
+                    static_cast<float>(pPixel[c]);
+            }
+            for (Uint32 c = Info.NumSrcChannels; c < 4; ++c)
+                Block[c][i] = 0;
+        }
+    }
+}
+
+} // namespace
+
+bool CompressTextureData(const CompressTextureDataAttribs& Attribs)
+{
+    BlockEncoderInfo Info;
+    if (!GetBlockEncoderInfo(Attribs.Format, Info))
+    {
+        LOG_ERROR_MESSAGE("Format ", GetTextureFormatAttribs(Attribs.Format).Name, " is not supported by texture data compression");
+        return false;
+    }
+
+    if (Attribs.Width == 0 || Attribs.Height == 0)
+        return true;
+
+    if (Attribs.pSrcData == nullptr || Attribs.pDstData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Source and destination data must not be null");
+        return false;
+    }
+
+    const Uint32 NumBlocksX      = (Attribs.Width + 3) / 4;
+    const Uint32 NumBlocksY      = (Attribs.Height + 3) / 4;
+    const size_t SrcRowSize      = size_t{Attribs.Width} * Info.NumSrcChannels;
+    const size_t DstBlockRowSize = size_t{NumBlocksX} * Info.BlockSize;
+    const size_t SrcStride       = Attribs.SrcStride != 0 ? Attribs.SrcStride : SrcRowSize;
+    const size_t DstStride       = Attribs.DstStride != 0 ? Attribs.DstStride : DstBlockRowSize;
+    if (SrcStride < SrcRowSize || DstStride < DstBlockRowSize)
+    {
+        LOG_ERROR_MESSAGE("Source stride (", SrcStride, ") or destination stride (", DstStride,
+                          ") is smaller than the row size (", SrcRowSize, " and ", DstBlockRowSize, " bytes)");
+        return false;
+    }
+
+    const Uint8* const pSrc = static_cast<const Uint8*>(Attribs.pSrcData);
+    Uint8* const       pDst = static_cast<Uint8*>(Attribs.pDstData);
+
+    const size_t BlocksPerChunk = std::max(CompressionChunkSize / NumBlocksX, size_t{1}) * NumBlocksX;
+    const size_t NumBlocks      = size_t{NumBlocksX} * NumBlocksY;
+    ParallelFor(Attribs.pThreadPool, (NumBlocks + BlocksPerChunk - 1) / BlocksPerChunk, MaxCompressionTasks,
+                [&](size_t Chunk) {
+                    const size_t EndBlock = std::min((Chunk + 1) * BlocksPerChunk, NumBlocks);
+                    for (size_t Block = Chunk * BlocksPerChunk; Block < EndBlock; ++Block)
+                    {
+                        const Uint32 BlockX = static_cast<Uint32>(Block % NumBlocksX);
+                        const Uint32 BlockY = static_cast<Uint32>(Block / NumBlocksX);
+
+                        BlockChannels Pixels;
+                        LoadBlock(pSrc, SrcStride, Info, BlockX * 4, BlockY * 4, Attribs.Width, Attribs.Height, Pixels);
+                        Info.EncodeBlock(Pixels, Info.IsSigned, pDst + BlockY * DstStride + BlockX * Info.BlockSize);
+                    }
+                });
+
+    return true;
+}
+
+} // namespace Diligent
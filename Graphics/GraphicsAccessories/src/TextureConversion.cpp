@@ -0,0 +1,975 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureConversion.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "GraphicsAccessories.hpp"
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+Uint16 FloatToHalf(float f)
+{
+    // Round-to-nearest-even conversion, see
+    // https://gist.github.com/rygorous/2156668
+    constexpr Uint32 F32Infinity  = 255u << 23;
+    constexpr Uint32 F16Max       = (127u + 16u) << 23; // All values above this are converted to infinity
+    constexpr Uint32 MinNormal    = (127u - 14u) << 23; // The smallest float that is converted to a normal half
+    constexpr Uint32 DenormMagic  = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    constexpr Uint32 NormalBias   = 0xFFFu - ((127u - 15u) << 23);
+
+    Uint32 u;
+    std::memcpy(&u, &f, sizeof(u));
+
+    const Uint32 Sign = u & 0x80000000u;
+    u ^= Sign;
+
+    Uint32 h;
+    if (u >= F16Max)
+    {
+        // Infinity or NaN
+        h = u > F32Infinity ? 0x7E00u : 0x7C00u;
+    }
+    else if (u < MinNormal)
+    {
+        // The result is a denormal or zero. Adding the magic value aligns the mantissa
+        // and rounds it using the FPU.
+        float Denorm;
+        std::memcpy(&Denorm, &u, sizeof(Denorm));
+        float Magic;
+        std::memcpy(&Magic, &DenormMagic, sizeof(Magic));
+        Denorm += Magic;
+        std::memcpy(&h, &Denorm, sizeof(h));
+        h -= DenormMagic;
+    }
+    else
+    {
+        // Adjust the exponent and round the mantissa; the odd bit breaks the ties to even
+        const Uint32 MantOdd = (u >> 13) & 1u;
+        h                    = (u + NormalBias + MantOdd) >> 13;
+    }
+
+    return static_cast<Uint16>(h | (Sign >> 16));
+}
+
+float HalfToFloat(Uint16 h)
+{
+    // Scaling the shifted exponent and mantissa by 2^112 rebiases the exponent and
+    // normalizes denormals at the same time.
+    constexpr Uint32 Magic = (254u - 15u) << 23;
+
+    const Uint32 ExpMant = h & 0x7FFFu;
+
+    Uint32 u = ExpMant << 13;
+    float  f, Scale;
+    std::memcpy(&f, &u, sizeof(f));
+    std::memcpy(&Scale, &Magic, sizeof(Scale));
+    f *= Scale;
+    std::memcpy(&u, &f, sizeof(u));
+    if (ExpMant > 0x7BFFu)
+        u |= 255u << 23; // Infinity or NaN
+    u |= static_cast<Uint32>(h & 0x8000u) << 16;
+
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+namespace
+{
+
+// The rows are split into chunks of approximately this size that are converted in parallel
+constexpr size_t ConversionChunkSize = 64 << 10;
+constexpr size_t MaxConversionTasks  = 32;
+
+constexpr Uint8 InvalidByteIdx = 0xFF;
+
+struct PixelLayout
+{
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+    COMPONENT_TYPE Type   = COMPONENT_TYPE_UNDEFINED;
+
+    // For packed formats, the size of the pixel
+    Uint32 ComponentSize = 0;
+
+    // The number of components stored in the pixel
+    Uint32 NumComponents = 0;
+
+    Uint32 PixelSize = 0;
+
+    // RGB components are stored in the reverse order
+    bool IsBGR = false;
+
+    // The pixel ends with an unused byte
+    bool HasX = false;
+};
+
+bool GetPixelLayout(TEXTURE_FORMAT Format, Uint32 NumComponents, const char* Name, PixelLayout& Layout)
+{
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Format);
+
+    bool IsSupported = !FmtAttribs.IsTypeless;
+    switch (FmtAttribs.ComponentType)
+    {
+        case COMPONENT_TYPE_UNORM:
+        case COMPONENT_TYPE_SNORM:
+        case COMPONENT_TYPE_UINT:
+        case COMPONENT_TYPE_SINT:
+        case COMPONENT_TYPE_FLOAT:
+        case COMPONENT_TYPE_UNORM_SRGB:
+            break;
+
+        case COMPONENT_TYPE_COMPOUND:
+            IsSupported = IsSupported && (Format == TEX_FORMAT_RGB10A2_UNORM || Format == TEX_FORMAT_RGB10A2_UINT);
+            break;
+
+        default:
+            IsSupported = false;
+    }
+
+    switch (Format)
+    {
+        case TEX_FORMAT_A8_UNORM:
+        case TEX_FORMAT_R1_UNORM:
+        case TEX_FORMAT_RG8_B8G8_UNORM:
+        case TEX_FORMAT_G8R8_G8B8_UNORM:
+            IsSupported = false;
+            break;
+
+        default:
+            break;
+    }
+
+    if (!IsSupported)
+    {
+        LOG_ERROR_MESSAGE(Name, " format ", FmtAttribs.Name, " is not supported by texture data conversion");
+        return false;
+    }
+
+    Layout.Format        = Format;
+    Layout.Type          = FmtAttribs.ComponentType;
+    Layout.ComponentSize = FmtAttribs.ComponentSize;
+    Layout.NumComponents = FmtAttribs.NumComponents;
+    Layout.IsBGR         = (Format == TEX_FORMAT_BGRA8_UNORM || Format == TEX_FORMAT_BGRA8_UNORM_SRGB ||
+                            Format == TEX_FORMAT_BGRX8_UNORM || Format == TEX_FORMAT_BGRX8_UNORM_SRGB);
+    Layout.HasX          = (Format == TEX_FORMAT_BGRX8_UNORM || Format == TEX_FORMAT_BGRX8_UNORM_SRGB);
+    if (Layout.HasX)
+        Layout.NumComponents = 3;
+
+    if (NumComponents != 0 && NumComponents != Layout.NumComponents)
+    {
+        if (Layout.Type == COMPONENT_TYPE_COMPOUND || Layout.HasX)
+        {
+            LOG_ERROR_MESSAGE(Name, " component count can't be specified for format ", FmtAttribs.Name);
+            return false;
+        }
+        if (NumComponents > Layout.NumComponents || (Layout.IsBGR && NumComponents < 3))
+        {
+            LOG_ERROR_MESSAGE(Name, " component count (", NumComponents, ") is not valid for format ", FmtAttribs.Name);
+            return false;
+        }
+        Layout.NumComponents = NumComponents;
+    }
+
+    Layout.PixelSize = Layout.Type == COMPONENT_TYPE_COMPOUND ?
+        Layout.ComponentSize :
+        Layout.ComponentSize * (Layout.NumComponents + (Layout.HasX ? 1 : 0));
+
+    return true;
+}
+
+// Returns the index of the RGBA channel that is stored in the given component of the pixel
+inline Uint32 GetChannel(const PixelLayout& Layout, Uint32 Component)
+{
+    return (Layout.IsBGR && Component < 3) ? 2 - Component : Component;
+}
+
+template <typename T>
+T LoadValue(const Uint8* pSrc)
+{
+    T Val;
+    std::memcpy(&Val, pSrc, sizeof(T));
+    return Val;
+}
+
+template <typename T>
+void StoreValue(Uint8* pDst, T Val)
+{
+    std::memcpy(pDst, &Val, sizeof(T));
+}
+
+// Clamps the value to the range [Min, Max]; NaN is converted to zero
+template <typename T>
+T ClampToRange(T Val, T Min, T Max)
+{
+    return Val >= Min ? (Val <= Max ? Val : Max) : (Val < Min ? Min : T{0});
+}
+
+// Float to UNORM and SNORM conversions round to nearest even, which matches
+// the vector conversion instructions.
+template <typename T>
+T FloatToUnorm(float Val, float MaxVal = static_cast<float>(std::numeric_limits<T>::max()))
+{
+    return static_cast<T>(std::lrint(ClampToRange(Val, 0.f, 1.f) * MaxVal));
+}
+
+template <typename T>
+T FloatToSnorm(float Val)
+{
+    constexpr float MaxVal = static_cast<float>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::lrint(ClampToRange(Val, -1.f, 1.f) * MaxVal));
+}
+
+template <typename T>
+T FloatToInt(float Val)
+{
+    constexpr double MinVal = static_cast<double>(std::numeric_limits<T>::min());
+    constexpr double MaxVal = static_cast<double>(std::numeric_limits<T>::max());
+    return static_cast<T>(std::llrint(ClampToRange(static_cast<double>(Val), MinVal, MaxVal)));
+}
+
+inline Uint8 FloatToSRGB8(float Val)
+{
+    return FloatToUnorm<Uint8>(LinearToGamma(ClampToRange(Val, 0.f, 1.f)));
+}
+
+float DecodeComponent(const Uint8* pSrc, COMPONENT_TYPE Type, Uint32 Size)
+{
+    switch (Type)
+    {
+        case COMPONENT_TYPE_UNORM:
+            return Size == 1 ?
+                static_cast<float>(*pSrc) / 255.f :
+                static_cast<float>(LoadValue<Uint16>(pSrc)) / 65535.f;
+
+        case COMPONENT_TYPE_UNORM_SRGB:
+            return GammaToLinear(*pSrc);
+
+        case COMPONENT_TYPE_SNORM:
+            return Size == 1 ?
+                std::max(static_cast<float>(static_cast<Int8>(*pSrc)) / 127.f, -1.f) :
+                std::max(static_cast<float>(LoadValue<Int16>(pSrc)) / 32767.f, -1.f);
+
+        case COMPONENT_TYPE_UINT:
+            return Size == 1 ? static_cast<float>(*pSrc) :
+                Size == 2    ? static_cast<float>(LoadValue<Uint16>(pSrc)) :
+                               static_cast<float>(LoadValue<Uint32>(pSrc));
+
+        case COMPONENT_TYPE_SINT:
+            return Size == 1 ? static_cast<float>(static_cast<Int8>(*pSrc)) :
+                Size == 2    ? static_cast<float>(LoadValue<Int16>(pSrc)) :
+                               static_cast<float>(LoadValue<Int32>(pSrc));
+
+        case COMPONENT_TYPE_FLOAT:
+            return Size == 2 ?
+                HalfToFloat(LoadValue<Uint16>(pSrc)) :
+                LoadValue<float>(pSrc);
+
+        default:
+            UNEXPECTED("Unexpected component type");
+            return 0;
+    }
+}
+
+void EncodeComponent(float Val, COMPONENT_TYPE Type, Uint32 Size, Uint8* pDst)
+{
+    switch (Type)
+    {
+        case COMPONENT_TYPE_UNORM:
+            if (Size == 1)
+                *pDst = FloatToUnorm<Uint8>(Val);
+            else
+                StoreValue(pDst, FloatToUnorm<Uint16>(Val));
+            break;
+
+        case COMPONENT_TYPE_UNORM_SRGB:
+            *pDst = FloatToSRGB8(Val);
+            break;
+
+        case COMPONENT_TYPE_SNORM:
+            if (Size == 1)
+                *pDst = static_cast<Uint8>(FloatToSnorm<Int8>(Val));
+            else
+                StoreValue(pDst, FloatToSnorm<Int16>(Val));
+            break;
+
+        case COMPONENT_TYPE_UINT:
+            if (Size == 1)
+                *pDst = FloatToInt<Uint8>(Val);
+            else if (Size == 2)
+                StoreValue(pDst, FloatToInt<Uint16>(Val));
+            else
+                StoreValue(pDst, FloatToInt<Uint32>(Val));
+            break;
+
+        case COMPONENT_TYPE_SINT:
+            if (Size == 1)
+                *pDst = static_cast<Uint8>(FloatToInt<Int8>(Val));
+            else if (Size == 2)
+                StoreValue(pDst, FloatToInt<Int16>(Val));
+            else
+                StoreValue(pDst, FloatToInt<Int32>(Val));
+            break;
+
+        case COMPONENT_TYPE_FLOAT:
+            if (Size == 2)
+                StoreValue(pDst, FloatToHalf(Val));
+            else
+                StoreValue(pDst, Val);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected component type");
+    }
+}
+
+void DecodePixels(const PixelLayout& Layout, const Uint8* pSrc, Uint32 NumPixels, float4* pDst)
+{
+    for (Uint32 i = 0; i < NumPixels; ++i, pSrc += Layout.PixelSize)
+    {
+        float4& Color = pDst[i];
+        if (Layout.Type == COMPONENT_TYPE_COMPOUND)
+        {
+            const Uint32 Val = LoadValue<Uint32>(pSrc);
+            Color            = float4{
+                static_cast<float>(Val & 0x3FFu),
+                static_cast<float>((Val >> 10) & 0x3FFu),
+                static_cast<float>((Val >> 20) & 0x3FFu),
+                static_cast<float>(Val >> 30),
+            };
+            if (Layout.Format == TEX_FORMAT_RGB10A2_UNORM)
+                Color = Color / float4{1023, 1023, 1023, 3};
+            continue;
+        }
+
+        Color = float4{0, 0, 0, 1};
+        for (Uint32 c = 0; c < Layout.NumComponents; ++c)
+        {
+            const Uint32 Channel = GetChannel(Layout, c);
+            // Alpha channel of sRGB formats is linear
+            const COMPONENT_TYPE Type = (Layout.Type == COMPONENT_TYPE_UNORM_SRGB && Channel == 3) ? COMPONENT_TYPE_UNORM : Layout.Type;
+            Color[Channel]            = DecodeComponent(pSrc + c * Layout.ComponentSize, Type, Layout.ComponentSize);
+        }
+    }
+}
+
+void EncodePixels(const PixelLayout& Layout, const float4* pSrc, Uint32 NumPixels, Uint8* pDst)
+{
+    for (Uint32 i = 0; i < NumPixels; ++i, pDst += Layout.PixelSize)
+    {
+        const float4& Color = pSrc[i];
+        if (Layout.Type == COMPONENT_TYPE_COMPOUND)
+        {
+            Uint32 Val = 0;
+            if (Layout.Format == TEX_FORMAT_RGB10A2_UNORM)
+            {
+                Val = (FloatToUnorm<Uint32>(Color.r, 1023.f) << 0u) |
+                    (FloatToUnorm<Uint32>(Color.g, 1023.f) << 10u) |
+                    (FloatToUnorm<Uint32>(Color.b, 1023.f) << 20u) |
+                    (FloatToUnorm<Uint32>(Color.a, 3.f) << 30u);
+            }
+            else
+            {
+                Val = (std::min(FloatToInt<Uint32>(Color.r), 1023u) << 0u) |
+                    (std::min(FloatToInt<Uint32>(Color.g), 1023u) << 10u) |
+                    (std::min(FloatToInt<Uint32>(Color.b), 1023u) << 20u) |
+                    (std::min(FloatToInt<Uint32>(Color.a), 3u) << 30u);
+            }
+            StoreValue(pDst, Val);
+            continue;
+        }
+
+        for (Uint32 c = 0; c < Layout.NumComponents; ++c)
+        {
+            const Uint32         Channel = GetChannel(Layout, c);
+            const COMPONENT_TYPE Type    = (Layout.Type == COMPONENT_TYPE_UNORM_SRGB && Channel == 3) ? COMPONENT_TYPE_UNORM : Layout.Type;
+            EncodeComponent(Color[Channel], Type, Layout.ComponentSize, pDst + c * Layout.ComponentSize);
+        }
+        if (Layout.HasX)
+            pDst[3] = 0xFF;
+    }
+}
+
+const std::array<Uint8, 256>& GetSRGBToLinear8LUT()
+{
+    static const std::array<Uint8, 256> LUT = []() {
+        std::array<Uint8, 256> LUT;
+        for (Uint32 i = 0; i < LUT.size(); ++i)
+            LUT[i] = FloatToUnorm<Uint8>(GammaToLinear(static_cast<Uint8>(i)));
+        return LUT;
+    }();
+    return LUT;
+}
+
+const std::array<Uint8, 256>& GetLinearToSRGB8LUT()
+{
+    static const std::array<Uint8, 256> LUT = []() {
+        std::array<Uint8, 256> LUT;
+        for (Uint32 i = 0; i < LUT.size(); ++i)
+            LUT[i] = FloatToSRGB8(static_cast<float>(i) / 255.f);
+        return LUT;
+    }();
+    return LUT;
+}
+
+struct ConversionInfo
+{
+    PixelLayout Src;
+    PixelLayout Dst;
+
+    // 8-bit conversions: for every destination byte, the index of the source byte
+    // or InvalidByteIdx if the constant value is written.
+    Uint8        SrcByte[4]   = {};
+    Uint8        ConstByte[4] = {};
+    const Uint8* ByteLUT[4]   = {};
+
+    // Shuffle mask and constant bytes for four pixels
+    Uint8 ShuffleMask[16]  = {};
+    Uint8 ShuffleConst[16] = {};
+};
+
+using RowConverterType = void (*)(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width);
+
+void ConvertRowGeneric(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    constexpr Uint32 BatchSize = 64;
+
+    float4 Pixels[BatchSize];
+    for (Uint32 x = 0; x < Width; x += BatchSize)
+    {
+        const Uint32 NumPixels = std::min(Width - x, BatchSize);
+        DecodePixels(Info.Src, pSrc + size_t{x} * Info.Src.PixelSize, NumPixels, Pixels);
+        EncodePixels(Info.Dst, Pixels, NumPixels, pDst + size_t{x} * Info.Dst.PixelSize);
+    }
+}
+
+void CopyRow(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    std::memcpy(pDst, pSrc, size_t{Width} * Info.Src.PixelSize);
+}
+
+void ConvertRowBytes(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const Uint32 SrcSize = Info.Src.PixelSize;
+    const Uint32 DstSize = Info.Dst.PixelSize;
+    for (Uint32 x = 0; x < Width; ++x, pSrc += SrcSize, pDst += DstSize)
+    {
+        for (Uint32 i = 0; i < DstSize; ++i)
+        {
+            const Uint8 SrcByte = Info.SrcByte[i];
+            if (SrcByte == InvalidByteIdx)
+                pDst[i] = Info.ConstByte[i];
+            else if (Info.ByteLUT[i] != nullptr)
+                pDst[i] = Info.ByteLUT[i][pSrc[SrcByte]];
+            else
+                pDst[i] = pSrc[SrcByte];
+        }
+    }
+}
+
+// Byte swizzles that do not require LUTs: RGB8 to RGBA8, BGRA8 to RGBA8, etc.
+void ShuffleRowBytes(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const Uint32 SrcSize = Info.Src.PixelSize;
+    const Uint32 DstSize = Info.Dst.PixelSize;
+
+    Uint32 x = 0;
+#if DILIGENT_AVX2_ENABLED
+    {
+        // Four pixels per iteration. The loads and stores are 16 bytes wide, which may cover
+        // more than four pixels, so the loop stops when the rest of the row is shorter than that.
+        // The extra bytes written to the destination are overwritten by the next iteration.
+        const __m128i Mask  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Info.ShuffleMask));
+        const __m128i Const = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Info.ShuffleConst));
+        for (; (Width - x) * SrcSize >= 16 && (Width - x) * DstSize >= 16; x += 4)
+        {
+            __m128i Pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * SrcSize));
+            Pixels         = _mm_or_si128(_mm_shuffle_epi8(Pixels, Mask), Const);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * DstSize), Pixels);
+        }
+    }
+#elif DILIGENT_SSE2_ENABLED
+    if (SrcSize == 4 && DstSize == 4)
+    {
+        // Without byte shuffles, every destination byte is extracted with shifts
+        __m128i Shifts[4][2];
+        bool    IsConst[4];
+        for (Uint32 i = 0; i < 4; ++i)
+        {
+            IsConst[i]   = Info.SrcByte[i] == InvalidByteIdx;
+            Shifts[i][0] = _mm_cvtsi32_si128(IsConst[i] ? 0 : Info.SrcByte[i] * 8);
+            Shifts[i][1] = _mm_cvtsi32_si128(i * 8);
+        }
+        const __m128i ByteMask = _mm_set1_epi32(0xFF);
+        const __m128i Const    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Info.ShuffleConst));
+        for (; x + 4 <= Width; x += 4)
+        {
+            const __m128i Pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * 4));
+
+            __m128i Res = Const;
+            for (Uint32 i = 0; i < 4; ++i)
+            {
+                if (IsConst[i])
+                    continue;
+                const __m128i Byte = _mm_and_si128(_mm_srl_epi32(Pixels, Shifts[i][0]), ByteMask);
+                Res                = _mm_or_si128(Res, _mm_sll_epi32(Byte, Shifts[i][1]));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * 4), Res);
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    if ((SrcSize == 3 || SrcSize == 4) && (DstSize == 3 || DstSize == 4))
+    {
+        // Sixteen pixels per iteration with deinterleaving loads and interleaving stores
+        for (; x + 16 <= Width; x += 16)
+        {
+            uint8x16_t SrcBytes[4];
+            if (SrcSize == 4)
+            {
+                const uint8x16x4_t Pixels = vld4q_u8(pSrc + x * 4);
+                for (Uint32 i = 0; i < 4; ++i)
+                    SrcBytes[i] = Pixels.val[i];
+            }
+            else
+            {
+                const uint8x16x3_t Pixels = vld3q_u8(pSrc + x * 3);
+                for (Uint32 i = 0; i < 3; ++i)
+                    SrcBytes[i] = Pixels.val[i];
+                SrcBytes[3] = vdupq_n_u8(0);
+            }
+
+            uint8x16_t DstBytes[4];
+            for (Uint32 i = 0; i < DstSize; ++i)
+            {
+                DstBytes[i] = Info.SrcByte[i] != InvalidByteIdx ?
+                    SrcBytes[Info.SrcByte[i]] :
+                    vdupq_n_u8(Info.ConstByte[i]);
+            }
+
+            if (DstSize == 4)
+            {
+                const uint8x16x4_t Pixels = {{DstBytes[0], DstBytes[1], DstBytes[2], DstBytes[3]}};
+                vst4q_u8(pDst + x * 4, Pixels);
+            }
+            else
+            {
+                const uint8x16x3_t Pixels = {{DstBytes[0], DstBytes[1], DstBytes[2]}};
+                vst3q_u8(pDst + x * 3, Pixels);
+            }
+        }
+    }
+#endif
+    ConvertRowBytes(Info, pSrc + x * SrcSize, pDst + x * DstSize, Width - x);
+}
+
+// Component-wise conversions between formats with the same number and order of components
+
+void ConvertRowUnorm8ToFloat(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const size_t Count = size_t{Width} * Info.Src.NumComponents;
+
+    size_t i = 0;
+#if DILIGENT_AVX2_ENABLED
+    {
+        const __m256 Scale = _mm256_set1_ps(255.f);
+        for (; i + 8 <= Count; i += 8)
+        {
+            const __m256i Ints = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc + i)));
+            _mm256_storeu_ps(reinterpret_cast<float*>(pDst) + i, _mm256_div_ps(_mm256_cvtepi32_ps(Ints), Scale));
+        }
+    }
+#elif DILIGENT_SSE2_ENABLED
+    {
+        const __m128  Scale = _mm_set1_ps(255.f);
+        const __m128i Zero  = _mm_setzero_si128();
+        for (; i + 16 <= Count; i += 16)
+        {
+            const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+            const __m128i Lo    = _mm_unpacklo_epi8(Bytes, Zero);
+            const __m128i Hi    = _mm_unpackhi_epi8(Bytes, Zero);
+
+            const __m128i Ints[4] = {
+                _mm_unpacklo_epi16(Lo, Zero),
+                _mm_unpackhi_epi16(Lo, Zero),
+                _mm_unpacklo_epi16(Hi, Zero),
+                _mm_unpackhi_epi16(Hi, Zero),
+            };
+            for (size_t j = 0; j < 4; ++j)
+                _mm_storeu_ps(reinterpret_cast<float*>(pDst) + i + j * 4, _mm_div_ps(_mm_cvtepi32_ps(Ints[j]), Scale));
+        }
+    }
+#endif
+    for (; i < Count; ++i)
+        StoreValue(pDst + i * 4, static_cast<float>(pSrc[i]) / 255.f);
+}
+
+void ConvertRowFloatToUnorm8(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const size_t Count = size_t{Width} * Info.Src.NumComponents;
+
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128 Zero  = _mm_setzero_ps();
+        const __m128 One   = _mm_set1_ps(1.f);
+        const __m128 Scale = _mm_set1_ps(255.f);
+        for (; i + 16 <= Count; i += 16)
+        {
+            __m128i Ints[4];
+            for (size_t j = 0; j < 4; ++j)
+            {
+                __m128 Val = _mm_loadu_ps(reinterpret_cast<const float*>(pSrc) + i + j * 4);
+                // maxps returns the second operand if the first one is NaN
+                Val     = _mm_min_ps(_mm_max_ps(Val, Zero), One);
+                Ints[j] = _mm_cvtps_epi32(_mm_mul_ps(Val, Scale));
+            }
+            const __m128i Bytes = _mm_packus_epi16(_mm_packs_epi32(Ints[0], Ints[1]), _mm_packs_epi32(Ints[2], Ints[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), Bytes);
+        }
+    }
+#endif
+    for (; i < Count; ++i)
+        pDst[i] = FloatToUnorm<Uint8>(LoadValue<float>(pSrc + i * 4));
+}
+
+#if DILIGENT_SSE2_ENABLED
+// https://gist.github.com/rygorous/2156668
+inline __m128i FloatToHalfSSE2(__m128 f)
+{
+    const __m128i SignMask    = _mm_set1_epi32(0x80000000u);
+    const __m128i F16Max      = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i InfOrNaN    = _mm_set1_epi32(0x7C00);
+    const __m128i NaNBit      = _mm_set1_epi32(0x200);
+    const __m128i MinNormal   = _mm_set1_epi32((127 - 14) << 23);
+    const __m128i DenormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i NormalBias  = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+    const __m128  Sign     = _mm_and_ps(_mm_castsi128_ps(SignMask), f);
+    const __m128  Abs      = _mm_xor_ps(f, Sign);
+    const __m128i AbsInt   = _mm_castps_si128(Abs);
+    const __m128i IsNaN    = _mm_castps_si128(_mm_cmpunord_ps(Abs, Abs));
+    const __m128i IsFinite = _mm_cmpgt_epi32(F16Max, AbsInt);
+    const __m128i Special  = _mm_or_si128(_mm_and_si128(IsNaN, NaNBit), InfOrNaN);
+
+    // Denormal results
+    const __m128i IsDenorm = _mm_cmpgt_epi32(MinNormal, AbsInt);
+    const __m128i Denorm   = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(DenormMagic))), DenormMagic);
+
+    // Normal results
+    const __m128i MantOdd = _mm_srai_epi32(_mm_slli_epi32(AbsInt, 31 - 13), 31); // -1 if the resulting mantissa is odd
+    const __m128i Normal  = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(AbsInt, NormalBias), MantOdd), 13);
+
+    const __m128i Finite = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Normal));
+    const __m128i Res    = _mm_or_si128(_mm_and_si128(IsFinite, Finite), _mm_andnot_si128(IsFinite, Special));
+
+    // The sign is shifted arithmetically so that the result can be packed with signed saturation
+    return _mm_or_si128(Res, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+}
+
+inline __m128 HalfToFloatSSE2(__m128i h)
+{
+    const __m128i ExpMantMask = _mm_set1_epi32(0x7FFF);
+    const __m128  Magic       = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i MaxFinite   = _mm_set1_epi32(0x7BFF);
+    const __m128i InfExp      = _mm_set1_epi32(255 << 23);
+
+    const __m128i ExpMant = _mm_and_si128(h, ExpMantMask);
+    const __m128i Sign    = _mm_slli_epi32(_mm_xor_si128(h, ExpMant), 16);
+    const __m128  Scaled  = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMant, 13)), Magic);
+    const __m128i InfNaN  = _mm_and_si128(_mm_cmpgt_epi32(ExpMant, MaxFinite), InfExp);
+    return _mm_or_ps(Scaled, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaN)));
+}
+#endif
+
+#if DILIGENT_AVX2_ENABLED && (defined(__F16C__) || defined(_MSC_VER))
+#    define DILIGENT_F16C_ENABLED 1
+#endif
+
+void ConvertRowFloatToHalf(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const size_t Count = size_t{Width} * Info.Src.NumComponents;
+
+    size_t i = 0;
+#if DILIGENT_F16C_ENABLED
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m256 Floats = _mm256_loadu_ps(reinterpret_cast<const float*>(pSrc) + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i * 2), _mm256_cvtps_ph(Floats, _MM_FROUND_TO_NEAREST_INT));
+    }
+#elif DILIGENT_SSE2_ENABLED
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m128i Lo = FloatToHalfSSE2(_mm_loadu_ps(reinterpret_cast<const float*>(pSrc) + i));
+        const __m128i Hi = FloatToHalfSSE2(_mm_loadu_ps(reinterpret_cast<const float*>(pSrc) + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i * 2), _mm_packs_epi32(Lo, Hi));
+    }
+#endif
+    for (; i < Count; ++i)
+        StoreValue(pDst + i * 2, FloatToHalf(LoadValue<float>(pSrc + i * 4)));
+}
+
+void ConvertRowHalfToFloat(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    const size_t Count = size_t{Width} * Info.Src.NumComponents;
+
+    size_t i = 0;
+#if DILIGENT_F16C_ENABLED
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m128i Halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i * 2));
+        _mm256_storeu_ps(reinterpret_cast<float*>(pDst) + i, _mm256_cvtph_ps(Halves));
+    }
+#elif DILIGENT_SSE2_ENABLED
+    const __m128i Zero = _mm_setzero_si128();
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m128i Halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i * 2));
+        _mm_storeu_ps(reinterpret_cast<float*>(pDst) + i, HalfToFloatSSE2(_mm_unpacklo_epi16(Halves, Zero)));
+        _mm_storeu_ps(reinterpret_cast<float*>(pDst) + i + 4, HalfToFloatSSE2(_mm_unpackhi_epi16(Halves, Zero)));
+    }
+#endif
+    for (; i < Count; ++i)
+        StoreValue(pDst + i * 4, HalfToFloat(LoadValue<Uint16>(pSrc + i * 2)));
+}
+
+void ConvertRowRGBA32FToRGB10A2(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    Uint32 x = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128 Zero  = _mm_setzero_ps();
+        const __m128 One   = _mm_set1_ps(1.f);
+        const __m128 Scale = _mm_set1_ps(1023.f);
+        for (; x + 4 <= Width; x += 4)
+        {
+            const float* pPixels = reinterpret_cast<const float*>(pSrc) + x * 4;
+
+            __m128 R = _mm_loadu_ps(pPixels + 0);
+            __m128 G = _mm_loadu_ps(pPixels + 4);
+            __m128 B = _mm_loadu_ps(pPixels + 8);
+            __m128 A = _mm_loadu_ps(pPixels + 12);
+            _MM_TRANSPOSE4_PS(R, G, B, A);
+
+            const __m128i RInt = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(R, Zero), One), Scale));
+            const __m128i GInt = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(G, Zero), One), Scale));
+            const __m128i BInt = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(B, Zero), One), Scale));
+            const __m128i AInt = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(A, Zero), One), _mm_set1_ps(3.f)));
+
+            const __m128i Packed = _mm_or_si128(_mm_or_si128(RInt, _mm_slli_epi32(GInt, 10)),
+                                                _mm_or_si128(_mm_slli_epi32(BInt, 20), _mm_slli_epi32(AInt, 30)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + x * 4), Packed);
+        }
+    }
+#endif
+    ConvertRowGeneric(Info, pSrc + x * 16, pDst + x * 4, Width - x);
+}
+
+void ConvertRowRGB10A2ToRGBA32F(const ConversionInfo& Info, const Uint8* pSrc, Uint8* pDst, Uint32 Width)
+{
+    Uint32 x = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128i Mask10 = _mm_set1_epi32(0x3FF);
+        const __m128  Scale  = _mm_set1_ps(1023.f);
+        for (; x + 4 <= Width; x += 4)
+        {
+            const __m128i Packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x * 4));
+
+            __m128 R = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(Packed, Mask10)), Scale);
+            __m128 G = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 10), Mask10)), Scale);
+            __m128 B = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 20), Mask10)), Scale);
+            __m128 A = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Packed, 30)), _mm_set1_ps(3.f));
+            _MM_TRANSPOSE4_PS(R, G, B, A);
+
+            float* pPixels = reinterpret_cast<float*>(pDst) + x * 4;
+            _mm_storeu_ps(pPixels + 0, R);
+            _mm_storeu_ps(pPixels + 4, G);
+            _mm_storeu_ps(pPixels + 8, B);
+            _mm_storeu_ps(pPixels + 12, A);
+        }
+    }
+#endif
+    ConvertRowGeneric(Info, pSrc + x * 4, pDst + x * 16, Width - x);
+}
+
+bool IsByteLayout(const PixelLayout& Layout)
+{
+    return Layout.ComponentSize == 1 && (Layout.Type == COMPONENT_TYPE_UNORM || Layout.Type == COMPONENT_TYPE_UNORM_SRGB);
+}
+
+// Sets up the byte mapping for conversions between 8-bit UNORM and sRGB formats.
+// Returns true if no LUTs are required.
+bool InitByteMapping(ConversionInfo& Info)
+{
+    Uint8 ChannelToSrcByte[4] = {InvalidByteIdx, InvalidByteIdx, InvalidByteIdx, InvalidByteIdx};
+    for (Uint32 c = 0; c < Info.Src.NumComponents; ++c)
+        ChannelToSrcByte[GetChannel(Info.Src, c)] = static_cast<Uint8>(c);
+
+    const bool IsSrcSRGB = Info.Src.Type == COMPONENT_TYPE_UNORM_SRGB;
+    const bool IsDstSRGB = Info.Dst.Type == COMPONENT_TYPE_UNORM_SRGB;
+
+    const Uint8* pColorLUT = nullptr;
+    if (IsSrcSRGB && !IsDstSRGB)
+        pColorLUT = GetSRGBToLinear8LUT().data();
+    else if (!IsSrcSRGB && IsDstSRGB)
+        pColorLUT = GetLinearToSRGB8LUT().data();
+
+    bool NeedsLUT = false;
+    for (Uint32 i = 0; i < Info.Dst.PixelSize; ++i)
+    {
+        if (i >= Info.Dst.NumComponents)
+        {
+            // Unused byte of BGRX formats
+            Info.SrcByte[i]   = InvalidByteIdx;
+            Info.ConstByte[i] = 0xFF;
+            continue;
+        }
+
+        const Uint32 Channel = GetChannel(Info.Dst, i);
+
+        Info.SrcByte[i] = ChannelToSrcByte[Channel];
+        if (Info.SrcByte[i] == InvalidByteIdx)
+        {
+            // Missing components are set to (0, 0, 0, 1)
+            Info.ConstByte[i] = Channel == 3 ? 0xFF : 0;
+        }
+        else if (Channel < 3 && pColorLUT != nullptr)
+        {
+            Info.ByteLUT[i] = pColorLUT;
+            NeedsLUT        = true;
+        }
+    }
+
+    for (Uint32 p = 0; p < 4; ++p)
+    {
+        for (Uint32 i = 0; i < Info.Dst.PixelSize; ++i)
+        {
+            const Uint32 Idx       = p * Info.Dst.PixelSize + i;
+            const bool   IsConst   = Info.SrcByte[i] == InvalidByteIdx;
+            Info.ShuffleMask[Idx]  = IsConst ? 0x80 : static_cast<Uint8>(p * Info.Src.PixelSize + Info.SrcByte[i]);
+            Info.ShuffleConst[Idx] = IsConst ? Info.ConstByte[i] : 0;
+        }
+    }
+    for (Uint32 Idx = 4 * Info.Dst.PixelSize; Idx < 16; ++Idx)
+        Info.ShuffleMask[Idx] = 0x80;
+
+    return !NeedsLUT;
+}
+
+RowConverterType SelectRowConverter(ConversionInfo& Info)
+{
+    const PixelLayout& Src = Info.Src;
+    const PixelLayout& Dst = Info.Dst;
+
+    if (Src.Format == Dst.Format && Src.NumComponents == Dst.NumComponents)
+        return CopyRow;
+
+    if (IsByteLayout(Src) && IsByteLayout(Dst))
+        return InitByteMapping(Info) ? ShuffleRowBytes : ConvertRowBytes;
+
+    const bool IsSameComponentOrder = (Src.Type != COMPONENT_TYPE_COMPOUND && Dst.Type != COMPONENT_TYPE_COMPOUND &&
+                                       Src.NumComponents == Dst.NumComponents && !Src.IsBGR && !Dst.IsBGR);
+    if (IsSameComponentOrder)
+    {
+        if (Src.Type == COMPONENT_TYPE_UNORM && Src.ComponentSize == 1 && Dst.Type == COMPONENT_TYPE_FLOAT && Dst.ComponentSize == 4)
+            return ConvertRowUnorm8ToFloat;
+        if (Src.Type == COMPONENT_TYPE_FLOAT && Src.ComponentSize == 4 && Dst.Type == COMPONENT_TYPE_UNORM && Dst.ComponentSize == 1)
+            return ConvertRowFloatToUnorm8;
+        if (Src.Type == COMPONENT_TYPE_FLOAT && Dst.Type == COMPONENT_TYPE_FLOAT)
+        {
+            if (Src.ComponentSize == 4 && Dst.ComponentSize == 2)
+                return ConvertRowFloatToHalf;
+            if (Src.ComponentSize == 2 && Dst.ComponentSize == 4)
+                return ConvertRowHalfToFloat;
+        }
+    }
+
+    if (Src.Format == TEX_FORMAT_RGBA32_FLOAT && Src.NumComponents == 4 && Dst.Format == TEX_FORMAT_RGB10A2_UNORM)
+        return ConvertRowRGBA32FToRGB10A2;
+    if (Src.Format == TEX_FORMAT_RGB10A2_UNORM && Dst.Format == TEX_FORMAT_RGBA32_FLOAT && Dst.NumComponents == 4)
+        return ConvertRowRGB10A2ToRGBA32F;
+
+    return ConvertRowGeneric;
+}
+
+} // namespace
+
+bool ConvertTextureData(const ConvertTextureDataAttribs& Attribs)
+{
+    if (Attribs.Width == 0 || Attribs.Height == 0)
+        return true;
+
+    if (Attribs.pSrcData == nullptr || Attribs.pDstData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Source and destination data must not be null");
+        return false;
+    }
+
+    ConversionInfo Info;
+    if (!GetPixelLayout(Attribs.SrcFormat, Attribs.SrcNumComponents, "Source", Info.Src) ||
+        !GetPixelLayout(Attribs.DstFormat, Attribs.DstNumComponents, "Destination", Info.Dst))
+        return false;
+
+    const size_t SrcRowSize = size_t{Attribs.Width} * Info.Src.PixelSize;
+    const size_t DstRowSize = size_t{Attribs.Width} * Info.Dst.PixelSize;
+    const size_t SrcStride  = Attribs.SrcStride != 0 ? Attribs.SrcStride : SrcRowSize;
+    const size_t DstStride  = Attribs.DstStride != 0 ? Attribs.DstStride : DstRowSize;
+    if (SrcStride < SrcRowSize || DstStride < DstRowSize)
+    {
+        LOG_ERROR_MESSAGE("Source stride (", SrcStride, ") or destination stride (", DstStride,
+                          ") is smaller than the row size (", SrcRowSize, " and ", DstRowSize, " bytes)");
+        return false;
+    }
+
+    const RowConverterType ConvertRow = SelectRowConverter(Info);
+
+    const Uint8* const pSrc = static_cast<const Uint8*>(Attribs.pSrcData);
+    Uint8* const       pDst = static_cast<Uint8*>(Attribs.pDstData);
+
+    const size_t RowsPerChunk = std::max(ConversionChunkSize / std::max(SrcRowSize, DstRowSize), size_t{1});
+    const size_t NumChunks    = (Attribs.Height + RowsPerChunk - 1) / RowsPerChunk;
+    ParallelFor(Attribs.pThreadPool, NumChunks, MaxConversionTasks,
+                [&](size_t Chunk) {
+                    const size_t EndRow = std::min((Chunk + 1) * RowsPerChunk, size_t{Attribs.Height});
+                    for (size_t Row = Chunk * RowsPerChunk; Row < EndRow; ++Row)
+                    {
+                        ConvertRow(Info, pSrc + Row * SrcStride, pDst + Row * DstStride, Attribs.Width);
+                    }
+                });
+
+    return true;
+}
+
+} // namespace Diligent
@@ -27,6 +27,6 @@
 
 #pragma once
 
-#if !D3D11_SUPPORTED && !D3D12_SUPPORTED && !GL_SUPPORTED && !GLES_SUPPORTED && !VULKAN_SUPPORTED && !METAL_SUPPORTED && !WEBGPU_SUPPORTED
-#    error No API is supported on this platform: one of D3D11_SUPPORTED, D3D12_SUPPORTED, GL_SUPPORTED, GLES_SUPPORTED, VULKAN_SUPPORTED, METAL_SUPPORTED, or WEBGPU_SUPPORTED macros must be defined as 1.
+#if !D3D11_SUPPORTED && !D3D12_SUPPORTED && !GL_SUPPORTED && !GLES_SUPPORTED && !VULKAN_SUPPORTED && !METAL_SUPPORTED && !WEBGPU_SUPPORTED && !NULL_SUPPORTED
+#    error No API is supported on this platform: one of D3D11_SUPPORTED, D3D12_SUPPORTED, GL_SUPPORTED, GLES_SUPPORTED, VULKAN_SUPPORTED, METAL_SUPPORTED, WEBGPU_SUPPORTED, or NULL_SUPPORTED macros must be defined as 1.
 #endif
@@ -37,6 +37,8 @@
 #include <functional>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <mutex>
 
 #include "PrivateConstants.h"
 #include "PipelineResourceSignature.h"
@@ -48,6 +50,7 @@
 #include "PlatformMisc.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "ShaderResourceVariableBase.hpp"
 #include "HashUtils.hpp"
 
 #if defined(_MSC_VER) && defined(FindResource)
@@ -81,6 +84,86 @@ Uint32 FindResource(const PipelineResourceDesc Resources[],
                     SHADER_TYPE                ShaderStage,
                     const char*                ResourceName);
 
+/// Hash index that maps resource names to the resource indices.
+
+/// Resources in different shader stages may share the same name, so every name
+/// maps to a chain of indices sorted in ascending order. Lookups walk the chain
+/// and return the first index accepted by the user-provided predicate, which gives
+/// the same result as a linear search over the resource array.
+class PipelineResourceNameIndex
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Adds an index to the chain of the given name.
+
+    /// \param [in] Name      - Resource name. Unless bMakeCopy is true, the string
+    ///                         must stay valid for the lifetime of the index.
+    /// \param [in] Index     - Resource index. Indices must be added in ascending order.
+    /// \param [in] Suffixed  - Whether the name is the resource name with a suffix appended
+    ///                         (e.g. combined sampler suffix), see Find().
+    /// \param [in] bMakeCopy - Whether to make a copy of the name string.
+    void Add(const char* Name, Uint32 Index, bool Suffixed = false, bool bMakeCopy = false);
+
+    /// Finds the first index with the given name for which Predicate(Index) returns true.
+    /// Only the names that were added with the same Suffixed flag are considered.
+    template <typename PredicateType>
+    Uint32 Find(const char* Name, bool Suffixed, PredicateType&& Predicate) const
+    {
+        VERIFY_EXPR(Name != nullptr);
+        auto it = m_Chains.find(Name);
+        if (it == m_Chains.end())
+            return InvalidIndex;
+
+        for (Uint32 e = it->second.First; e != InvalidIndex; e = m_Entries[e].Next)
+        {
+            const auto& Entry = m_Entries[e];
+            if (Entry.Suffixed == Suffixed && Predicate(Entry.Index))
+                return Entry.Index;
+        }
+        return InvalidIndex;
+    }
+
+    bool IsEmpty() const { return m_Entries.empty(); }
+
+    void Clear()
+    {
+        m_Chains.clear();
+        m_Entries.clear();
+    }
+
+private:
+    struct ChainInfo
+    {
+        Uint32 First = InvalidIndex;
+        Uint32 Last  = InvalidIndex;
+    };
+    std::unordered_map<HashMapStringKey, ChainInfo, HashMapStringKey::Hasher> m_Chains;
+
+    struct EntryInfo
+    {
+        Uint32 Index    = InvalidIndex;
+        Uint32 Next     = InvalidIndex;
+        bool   Suffixed = false;
+    };
+    std::vector<EntryInfo> m_Entries;
+};
+
+/// Adds immutable sampler names to the name index. If 'SamplerSuffix' is not null or empty,
+/// the names with the suffix appended are added as well.
+void AddImmutableSamplersToNameIndex(PipelineResourceNameIndex& NameIndex,
+                                     const ImmutableSamplerDesc ImtblSamplers[],
+                                     Uint32                     NumImtblSamplers,
+                                     const char*                SamplerSuffix);
+
+/// Same as FindImmutableSampler() above, but uses the name index. If 'SamplerSuffix' is not null,
+/// the index must have been populated by AddImmutableSamplersToNameIndex() with the same suffix.
+Uint32 FindImmutableSampler(const PipelineResourceNameIndex& NameIndex,
+                            const ImmutableSamplerDesc       ImtblSamplers[],
+                            SHADER_TYPE                      ShaderStages,
+                            const char*                      ResourceName,
+                            const char*                      SamplerSuffix);
+
 /// Returns true if two pipeline resource signature descriptions are compatible, and false otherwise
 bool PipelineResourceSignaturesCompatible(const PipelineResourceSignatureDesc& Desc0,
                                           const PipelineResourceSignatureDesc& Desc1,
@@ -585,6 +668,12 @@ public:
         pThisImpl->CopyStaticResources(*pDstSignImpl->m_pStaticResCache);
     }
 
+    /// Implementation of IPipelineResourceSignature::GetSRBMemoryStats.
+    virtual SRBMemoryStats DILIGENT_CALL_TYPE GetSRBMemoryStats() const override final
+    {
+        return m_SRBMemAllocator.GetStats();
+    }
+
     /// Implementation of IPipelineResourceSignature::IsCompatibleWith.
     virtual bool DILIGENT_CALL_TYPE IsCompatibleWith(const IPipelineResourceSignature* pPRS) const override final
     {
@@ -672,15 +761,31 @@ public:
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        if (m_ResourceNameIndex.IsEmpty())
+            return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+
+        VERIFY_EXPR(ResourceName != nullptr && ResourceName[0] != '\0');
+        static_assert(PipelineResourceNameIndex::InvalidIndex == InvalidPipelineResourceIndex, "Invalid index values must match");
+        return m_ResourceNameIndex.Find(ResourceName, false,
+                                        [this, ShaderStage](Uint32 ResIndex) {
+                                            return (this->m_Desc.Resources[ResIndex].ShaderStages & ShaderStage) != 0;
+                                        });
     }
 
     /// Finds an immutable with the given name in the specified shader stage and returns its
     /// index in m_Desc.ImmutableSamplers[], or InvalidImmutableSamplerIndex if the sampler is not found.
-    Uint32 FindImmutableSampler(SHADER_TYPE ShaderStage, const char* ResourceName) const
+    /// If UseCombinedSamplerSuffix is true and the signature uses combined samplers, the name may
+    /// also be the sampler name with the combined sampler suffix appended.
+    Uint32 FindImmutableSampler(SHADER_TYPE ShaderStage, const char* ResourceName, bool UseCombinedSamplerSuffix = true) const
     {
-        return Diligent::FindImmutableSampler(this->m_Desc.ImmutableSamplers, this->m_Desc.NumImmutableSamplers,
-                                              ShaderStage, ResourceName, GetCombinedSamplerSuffix());
+        if (m_ImtblSamplerNameIndex.IsEmpty())
+        {
+            return Diligent::FindImmutableSampler(this->m_Desc.ImmutableSamplers, this->m_Desc.NumImmutableSamplers,
+                                                  ShaderStage, ResourceName, UseCombinedSamplerSuffix ? GetCombinedSamplerSuffix() : nullptr);
+        }
+
+        return Diligent::FindImmutableSampler(m_ImtblSamplerNameIndex, this->m_Desc.ImmutableSamplers,
+                                              ShaderStage, ResourceName, UseCombinedSamplerSuffix ? GetCombinedSamplerSuffix() : nullptr);
     }
 
     const PipelineResourceDesc& GetResourceDesc(Uint32 ResIndex) const
@@ -730,6 +835,22 @@ public:
         return m_SRBMemAllocator;
     }
 
+    // Returns the variable name hash for the SRB variable manager of the given active shader stage,
+    // or null if the manager has too few variables. The hash is built from the first manager
+    // and shared by all SRBs created from this signature.
+    const ShaderVariableNameHash* GetSRBVariableNameHash(Uint32 ActiveStageInd, const ShaderVariableManagerImplType& Mgr) const
+    {
+        VERIFY_EXPR(ActiveStageInd < GetNumActiveShaderStages());
+        if (Mgr.GetVariableCount() < ShaderVariableNameHash::MinVariableCount)
+            return nullptr;
+
+        auto& NameHash = m_SRBVarNameHashes[ActiveStageInd];
+        std::call_once(m_SRBVarNameHashInitFlags[ActiveStageInd], [&NameHash, &Mgr]() {
+            NameHash.Initialize(Mgr);
+        });
+        return &NameHash;
+    }
+
     // Processes resources with the allowed variable types in the allowed shader stages
     // and calls user-provided handler for each resource.
     template <typename HandlerType>
@@ -863,6 +984,8 @@ protected:
             }
         }
 
+        InitializeNameIndices();
+
         InitResourceLayout();
 
         auto* const pThisImpl = static_cast<PipelineResourceSignatureImplType*>(this);
@@ -878,6 +1001,11 @@ protected:
                     VERIFY_EXPR(static_cast<Uint32>(Idx) < NumStaticResStages);
                     const auto ShaderType = GetShaderTypeFromPipelineIndex(i, GetPipelineType());
                     m_StaticVarsMgrs[Idx].Initialize(*pThisImpl, RawAllocator, AllowedVarTypes, _countof(AllowedVarTypes), ShaderType);
+                    if (m_StaticVarsMgrs[Idx].GetVariableCount() >= ShaderVariableNameHash::MinVariableCount)
+                    {
+                        m_StaticVarNameHashes[Idx].Initialize(m_StaticVarsMgrs[Idx]);
+                        m_StaticVarsMgrs[Idx].SetNameHash(&m_StaticVarNameHashes[Idx]);
+                    }
                 }
             }
         }
@@ -995,6 +1123,9 @@ protected:
 
         m_StaticResStageIndex.fill(-1);
 
+        m_ResourceNameIndex.Clear();
+        m_ImtblSamplerNameIndex.Clear();
+
         static_assert(std::is_trivially_destructible<PipelineResourceAttribsType>::value, "Destructors for m_pResourceAttribs[] are required");
         m_pResourceAttribs = nullptr;
         static_assert(std::is_trivially_destructible<ImmutableSamplerAttribsType>::value, "Destructors for m_pImmutableSamplerAttribs[] are required");
@@ -1020,7 +1151,24 @@ protected:
     {
         VERIFY_EXPR(Tex.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV);
         Uint32 SamplerInd = InvalidSamplerValue;
-        if (IsUsingCombinedSamplers())
+        if (IsUsingCombinedSamplers() && !m_ResourceNameIndex.IsEmpty())
+        {
+            const auto SamplerName = String{Tex.Name} + GetCombinedSamplerSuffix();
+            const auto Idx         = m_ResourceNameIndex.Find(
+                SamplerName.c_str(), false,
+                [this, &Tex](Uint32 ResIndex) {
+                    const auto& Res = this->m_Desc.Resources[ResIndex];
+                    return (Res.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER &&
+                            Res.VarType == Tex.VarType &&
+                            (Tex.ShaderStages & Res.ShaderStages) != 0);
+                });
+            if (Idx != PipelineResourceNameIndex::InvalidIndex)
+            {
+                VERIFY_EXPR((this->m_Desc.Resources[Idx].ShaderStages & Tex.ShaderStages) == Tex.ShaderStages);
+                SamplerInd = Idx;
+            }
+        }
+        else if (IsUsingCombinedSamplers())
         {
             const auto IdxRange = GetResourceIndexRange(Tex.VarType);
 
@@ -1042,6 +1190,27 @@ protected:
         return SamplerInd;
     }
 
+    // Builds the name indices for signatures with many resources or immutable samplers.
+    // Must be called after the description has been copied, as the indices reference
+    // the resource names in m_Desc.
+    void InitializeNameIndices()
+    {
+        // Linear search is faster than hashing for small arrays
+        static constexpr Uint32 MinIndexedResourceCount = 16;
+
+        if (this->m_Desc.NumResources >= MinIndexedResourceCount)
+        {
+            for (Uint32 r = 0; r < this->m_Desc.NumResources; ++r)
+                m_ResourceNameIndex.Add(this->m_Desc.Resources[r].Name, r);
+        }
+
+        if (this->m_Desc.NumImmutableSamplers >= MinIndexedResourceCount)
+        {
+            AddImmutableSamplersToNameIndex(m_ImtblSamplerNameIndex, this->m_Desc.ImmutableSamplers, this->m_Desc.NumImmutableSamplers,
+                                            GetCombinedSamplerSuffix());
+        }
+    }
+
     void CalculateHash()
     {
         const auto* const pThisImpl = static_cast<const PipelineResourceSignatureImplType*>(this);
@@ -1093,6 +1262,21 @@ protected:
     // Allocator for shader resource binding object instances.
     SRBMemoryAllocator m_SRBMemAllocator;
 
+    // Variable name hashes of the static variable managers.
+    std::array<ShaderVariableNameHash, MAX_SHADERS_IN_PIPELINE> m_StaticVarNameHashes;
+
+    // Variable name hashes shared by the SRB variable managers, for every active shader stage.
+    // The hashes are built on demand by the first SRB.
+    mutable std::array<ShaderVariableNameHash, MAX_SHADERS_IN_PIPELINE> m_SRBVarNameHashes;
+    mutable std::array<std::once_flag, MAX_SHADERS_IN_PIPELINE>         m_SRBVarNameHashInitFlags;
+
+    // Resource name -> index in m_Desc.Resources. Only built for large signatures.
+    PipelineResourceNameIndex m_ResourceNameIndex;
+
+    // Immutable sampler name (with and without the combined sampler suffix) -> index
+    // in m_Desc.ImmutableSamplers. Only built for large signatures.
+    PipelineResourceNameIndex m_ImtblSamplerNameIndex;
+
 #ifdef DILIGENT_DEBUG
     bool m_IsDestructed = false;
 #endif
@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 #include "RenderDevice.h"
 #include "DeviceObjectBase.hpp"
@@ -131,6 +132,7 @@ public:
         m_pEngineFactory      {pEngineFactory},
         m_ValidationFlags     {EngineCI.ValidationFlags},
         m_AdapterInfo         {AdapterInfo},
+        m_SamplersRegistry    {1024, /*ReadOptimized = */ true},
         m_TextureFormatsInfo  (TEX_FORMAT_NUM_FORMATS, TextureFormatInfoExt(), STD_ALLOCATOR_RAW_MEM(TextureFormatInfoExt, RawMemAllocator, "Allocator for vector<TextureFormatInfoExt>")),
         m_TexFmtInfoInitFlags (TEX_FORMAT_NUM_FORMATS, false, STD_ALLOCATOR_RAW_MEM(bool, RawMemAllocator, "Allocator for vector<bool>")),
         m_wpImmediateContexts (std::max(1u, EngineCI.NumImmediateContexts), RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
@@ -292,6 +294,18 @@ public:
         UNSUPPORTED("Tile pipeline is not supported by this device. Please check DeviceFeatures.TileShaders feature.");
     }
 
+    /// Base implementation of IRenderDevice::CreatePipelineStates().
+    virtual void DILIGENT_CALL_TYPE CreatePipelineStates(const PipelineStateCreateInfo* const* ppCreateInfos,
+                                                         Uint32                                NumPipelines,
+                                                         IPipelineState**                      ppPipelineStates) override
+    {
+        CreatePipelineStatesImpl(ppCreateInfos, NumPipelines, ppPipelineStates,
+                                 [this](const auto& PSOCreateInfo, IPipelineState** ppPipelineState) //
+                                 {
+                                     static_cast<IRenderDevice*>(this)->CreatePipelineState(PSOCreateInfo, ppPipelineState);
+                                 });
+    }
+
     /// Set weak reference to the immediate context
     void SetImmediateContext(size_t Ctx, DeviceContextImplType* pImmediateContext)
     {
@@ -438,6 +452,105 @@ protected:
                            });
     }
 
+    /// Creates a batch of pipeline states.
+
+    /// \param [in]  ppCreateInfos    - Pipeline state create infos.
+    /// \param [in]  NumPipelines     - The number of pipelines.
+    /// \param [out] ppPipelineStates - Created pipeline states.
+    /// \param [in]  CreatePSO        - Functor that creates a graphics, compute or ray tracing
+    ///                                 pipeline state from the create info of the corresponding type.
+    ///                                 Tile pipelines are always created by CreateTilePipelineState().
+    ///
+    /// \remarks   When the device has a shader compilation thread pool, all pipelines in the batch are
+    ///            created asynchronously. Initialization of every pipeline is then scheduled by the pool
+    ///            after the compile tasks of its shaders, so that independent pipelines are initialized
+    ///            in parallel. The method then waits for the pipelines that were not requested to be
+    ///            created asynchronously.
+    template <typename CreatePSOFunctorType>
+    void CreatePipelineStatesImpl(const PipelineStateCreateInfo* const* ppCreateInfos,
+                                  Uint32                                NumPipelines,
+                                  IPipelineState**                      ppPipelineStates,
+                                  CreatePSOFunctorType                  CreatePSO)
+    {
+        if (NumPipelines == 0)
+            return;
+
+        DEV_CHECK_ERR(ppCreateInfos != nullptr, "ppCreateInfos must not be null");
+        DEV_CHECK_ERR(ppPipelineStates != nullptr, "ppPipelineStates must not be null");
+        if (ppCreateInfos == nullptr || ppPipelineStates == nullptr)
+            return;
+
+        // There is nothing to overlap when the batch contains a single pipeline
+        const bool CreateInParallel = m_pShaderCompilationThreadPool && NumPipelines > 1;
+
+        std::vector<bool> WaitForCompletion(NumPipelines, false);
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+        {
+            IPipelineState*& pPSO = ppPipelineStates[i];
+            DEV_CHECK_ERR(pPSO == nullptr, "Overwriting reference to an existing pipeline state object may result in memory leaks");
+            pPSO = nullptr;
+
+            const PipelineStateCreateInfo* pCreateInfo = ppCreateInfos[i];
+            if (pCreateInfo == nullptr)
+            {
+                DEV_ERROR("Create info at index ", i, " is null");
+                continue;
+            }
+
+            const PSO_CREATE_FLAGS Flags = CreateInParallel ? pCreateInfo->Flags | PSO_CREATE_FLAG_ASYNCHRONOUS : pCreateInfo->Flags;
+
+            WaitForCompletion[i] = CreateInParallel && (pCreateInfo->Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0;
+
+            auto CreatePSOWithFlags = [&](auto CreateInfo) //
+            {
+                CreateInfo.Flags = Flags;
+                CreatePSO(CreateInfo, &pPSO);
+            };
+
+            switch (pCreateInfo->PSODesc.PipelineType)
+            {
+                case PIPELINE_TYPE_GRAPHICS:
+                case PIPELINE_TYPE_MESH:
+                    CreatePSOWithFlags(*static_cast<const GraphicsPipelineStateCreateInfo*>(pCreateInfo));
+                    break;
+
+                case PIPELINE_TYPE_COMPUTE:
+                    CreatePSOWithFlags(*static_cast<const ComputePipelineStateCreateInfo*>(pCreateInfo));
+                    break;
+
+                case PIPELINE_TYPE_RAY_TRACING:
+                    CreatePSOWithFlags(*static_cast<const RayTracingPipelineStateCreateInfo*>(pCreateInfo));
+                    break;
+
+                case PIPELINE_TYPE_TILE:
+                {
+                    TilePipelineStateCreateInfo TileCI = *static_cast<const TilePipelineStateCreateInfo*>(pCreateInfo);
+                    TileCI.Flags                       = Flags;
+                    static_cast<IRenderDevice*>(this)->CreateTilePipelineState(TileCI, &pPSO);
+                    break;
+                }
+
+                default:
+                    DEV_ERROR("Unexpected pipeline type of pipeline state '", (pCreateInfo->PSODesc.Name != nullptr ? pCreateInfo->PSODesc.Name : ""), "'");
+            }
+        }
+
+        for (Uint32 i = 0; i < NumPipelines; ++i)
+        {
+            IPipelineState*& pPSO = ppPipelineStates[i];
+            if (pPSO == nullptr || !WaitForCompletion[i])
+                continue;
+
+            const PIPELINE_STATE_STATUS Status = pPSO->GetStatus(/*WaitForCompletion = */ true);
+            if (Status != PIPELINE_STATE_STATUS_READY)
+            {
+                LOG_ERROR_MESSAGE("Failed to create pipeline state '", pPSO->GetDesc().Name, "'");
+                pPSO->Release();
+                pPSO = nullptr;
+            }
+        }
+    }
+
     template <typename... ExtraArgsType>
     void CreateBufferImpl(IBuffer** ppBuffer, const BufferDesc& BuffDesc, const ExtraArgsType&... ExtraArgs)
     {
@@ -121,6 +121,7 @@ public:
                 // Note that the cache has space for all variable types
                 const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
                 m_pShaderVarMgrs[MgrInd].Initialize(*pPRS, VarDataAllocator, VarTypes, _countof(VarTypes), ShaderType);
+                m_pShaderVarMgrs[MgrInd].SetNameHash(pPRS->GetSRBVariableNameHash(s, m_pShaderVarMgrs[MgrInd]));
             }
         }
         catch (...)
@@ -265,6 +266,26 @@ public:
         return StaleVarTypes;
     }
 
+    /// Implementation of IShaderResourceBinding::SetVariables().
+
+    /// Backends that can batch the cache updates override this method and
+    /// call the base implementation between the batch boundaries.
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings) override
+    {
+        DEV_CHECK_ERR(pBindings != nullptr || NumBindings == 0, "pBindings must not be null when NumBindings (", NumBindings, ") is not zero");
+
+        for (Uint32 i = 0; i < NumBindings; ++i)
+        {
+            const ShaderVariableBinding& Binding = pBindings[i];
+            DEV_CHECK_ERR(Binding.pVariable != nullptr, "Shader variable in binding ", i, " is null");
+            DEV_CHECK_ERR(Binding.ppObjects != nullptr || Binding.NumElements == 0, "ppObjects in binding ", i, " is null");
+            if (Binding.pVariable == nullptr)
+                continue;
+
+            Binding.pVariable->SetArray(Binding.ppObjects, Binding.FirstElement, Binding.NumElements, Binding.Flags);
+        }
+    }
+
     ShaderResourceCacheImplType&       GetResourceCache() { return m_ShaderResourceCache; }
     const ShaderResourceCacheImplType& GetResourceCache() const { return m_ShaderResourceCache; }
 
@@ -35,6 +35,7 @@
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
 #include "StringTools.hpp"
+#include "HashUtils.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -812,6 +813,92 @@ protected:
     const Uint32 m_ResIndex;
 };
 
+/// Open-addressing hash table that maps shader variable names to variable indices in a variable manager.
+
+/// All variable managers created by a signature for the same shader stage and variable types
+/// have identical variable layouts, so a single table is built by the signature and shared by
+/// all managers. The table references the variable names owned by the signature.
+class ShaderVariableNameHash
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Variable managers with fewer variables use linear search, which is faster for small counts.
+    static constexpr Uint32 MinVariableCount = 16;
+
+    template <typename VarManagerType>
+    void Initialize(const VarManagerType& Mgr)
+    {
+        VERIFY(m_Slots.empty(), "The hash has already been initialized");
+
+        const Uint32 NumVars = Mgr.GetVariableCount();
+
+        // Keep the load factor at or below 0.5 so that probe sequences stay short
+        // and there is always at least one empty slot.
+        size_t TableSize = 1;
+        while (TableSize < size_t{NumVars} * 2)
+            TableSize *= 2;
+        m_Slots.resize(TableSize);
+
+        for (Uint32 v = 0; v < NumVars; ++v)
+        {
+            ShaderResourceDesc VarDesc;
+            Mgr.GetVariable(v)->GetResourceDesc(VarDesc);
+            Insert(VarDesc.Name, v);
+        }
+    }
+
+    /// Returns the index of the variable with the given name, or InvalidIndex if there is no such variable.
+    Uint32 Find(const Char* Name) const
+    {
+        VERIFY_EXPR(!m_Slots.empty() && Name != nullptr);
+
+        const size_t Hash = CStringHash<Char>{}(Name);
+        const size_t Mask = m_Slots.size() - 1;
+        for (size_t i = Hash & Mask;; i = (i + 1) & Mask)
+        {
+            const auto& Slot = m_Slots[i];
+            if (Slot.Name == nullptr)
+                return InvalidIndex;
+            if (Slot.Hash == Hash && strcmp(Slot.Name, Name) == 0)
+                return Slot.Index;
+        }
+    }
+
+    bool IsInitialized() const { return !m_Slots.empty(); }
+
+private:
+    void Insert(const Char* Name, Uint32 Index)
+    {
+        VERIFY_EXPR(Name != nullptr);
+
+        const size_t Hash = CStringHash<Char>{}(Name);
+        const size_t Mask = m_Slots.size() - 1;
+        for (size_t i = Hash & Mask;; i = (i + 1) & Mask)
+        {
+            auto& Slot = m_Slots[i];
+            if (Slot.Name == nullptr)
+            {
+                Slot.Name  = Name;
+                Slot.Hash  = Hash;
+                Slot.Index = Index;
+                return;
+            }
+            // Keep the first variable to match the linear search
+            if (Slot.Hash == Hash && strcmp(Slot.Name, Name) == 0)
+                return;
+        }
+    }
+
+    struct SlotInfo
+    {
+        const Char* Name  = nullptr;
+        size_t      Hash  = 0;
+        Uint32      Index = InvalidIndex;
+    };
+    std::vector<SlotInfo> m_Slots;
+};
+
 template <class EngineImplTraits, typename VariableType>
 class ShaderVariableManagerBase
 {
@@ -858,6 +945,15 @@ protected:
 #ifdef DILIGENT_DEBUG
         m_pDbgAllocator = nullptr;
 #endif
+        m_pNameHash = nullptr;
+    }
+
+    // Sets the variable name hash shared by all managers with the same layout.
+    // The hash is owned by the signature.
+    void SetNameHash(const ShaderVariableNameHash* pNameHash)
+    {
+        VERIFY_EXPR(pNameHash == nullptr || pNameHash->IsInitialized());
+        m_pNameHash = pNameHash;
     }
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
@@ -907,6 +1003,9 @@ protected:
     // shader resource bindings reside in continuous memory. If allocation granularity == 1, raw allocator is used.
     VariableType* m_pVariables = nullptr;
 
+    // Variable name hash, or null if variables are searched linearly.
+    const ShaderVariableNameHash* m_pNameHash = nullptr;
+
 private:
 #ifdef DILIGENT_DEBUG
     // Memory allocator that was used to allocate memory for m_pVariables (for debug purposes only).
@@ -1611,6 +1611,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
     RENDER_DEVICE_TYPE_WEBGPU,         ///< WebGPU device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null (headless) device that does not perform any GPU work
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -2534,6 +2535,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_WEBGPU;
     }
+    constexpr bool IsNullDevice() const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -4193,6 +4198,32 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 };
 typedef struct EngineWebGPUCreateInfo EngineWebGPUCreateInfo;
 
+/// Attributes of the null engine implementation
+
+/// The null backend implements all engine objects on the CPU side
+/// and never submits any work to the GPU. It is intended for measuring
+/// the CPU overhead of the engine and the application.
+struct EngineNullCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
+
+    /// Simulated GPU latency, in microseconds.
+
+    /// When this value is zero, the fence value signaled by a command buffer
+    /// submission is completed immediately. Otherwise, the submission is
+    /// considered complete after the specified amount of time has passed.
+    Uint32 FenceLatencyMicroseconds DEFAULT_INITIALIZER(0);
+
+#if DILIGENT_CPP_INTERFACE
+    EngineNullCreateInfo() noexcept :
+        EngineNullCreateInfo{EngineCreateInfo{}}
+    {}
+
+    explicit EngineNullCreateInfo(const EngineCreateInfo &EngineCI) noexcept :
+        EngineCreateInfo{EngineCI}
+    {}
+#endif
+};
+typedef struct EngineNullCreateInfo EngineNullCreateInfo;
+
 /// Box
 struct Box
 {
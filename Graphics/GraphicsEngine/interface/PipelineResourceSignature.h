@@ -427,6 +427,33 @@ struct PipelineResourceSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
 };
 typedef struct PipelineResourceSignatureDesc PipelineResourceSignatureDesc;
 
+
+/// Shader resource binding memory statistics, see IPipelineResourceSignature::GetSRBMemoryStats().
+
+/// \remarks   The statistics are only collected when the signature was created with
+///            SRBAllocationGranularity greater than 1. Otherwise, shader resource binding
+///            objects allocate their memory from the raw memory allocator and all values are zero.
+struct SRBMemoryStats
+{
+    /// The number of memory blocks that are currently allocated by the shader resource
+    /// binding objects for their resource caches and shader variable managers.
+    Uint64 NumAllocatedBlocks    DEFAULT_INITIALIZER(0);
+
+    /// The total size of the allocated memory blocks, in bytes.
+    Uint64 AllocatedSize         DEFAULT_INITIALIZER(0);
+
+    /// The total size of the memory reserved by the signature's memory pools, in bytes.
+    Uint64 ReservedSize          DEFAULT_INITIALIZER(0);
+
+    /// The total number of memory block allocations.
+    Uint64 TotalAllocations      DEFAULT_INITIALIZER(0);
+
+    /// The number of times the per-thread block caches were refilled from or flushed
+    /// to the shared memory pools. Every such operation acquires a mutex.
+    Uint64 NumSharedPoolAccesses DEFAULT_INITIALIZER(0);
+};
+typedef struct SRBMemoryStats SRBMemoryStats;
+
 // clang-format on
 
 
@@ -566,6 +593,10 @@ DILIGENT_BEGIN_INTERFACE(IPipelineResourceSignature, IDeviceObject)
     ///             defined in the same order disregarding their names.
     VIRTUAL Bool METHOD(IsCompatibleWith)(THIS_
                                           const struct IPipelineResourceSignature* pPRS) CONST PURE;
+
+    /// Returns the memory statistics of the shader resource binding objects
+    /// created by this signature, see Diligent::SRBMemoryStats.
+    VIRTUAL SRBMemoryStats METHOD(GetSRBMemoryStats)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -585,6 +616,7 @@ DILIGENT_END_INTERFACE
 #    define IPipelineResourceSignature_InitializeStaticSRBResources(This, ...) CALL_IFACE_METHOD(PipelineResourceSignature, InitializeStaticSRBResources,This, __VA_ARGS__)
 #    define IPipelineResourceSignature_CopyStaticResources(This, ...)          CALL_IFACE_METHOD(PipelineResourceSignature, CopyStaticResources,         This, __VA_ARGS__)
 #    define IPipelineResourceSignature_IsCompatibleWith(This, ...)             CALL_IFACE_METHOD(PipelineResourceSignature, IsCompatibleWith,            This, __VA_ARGS__)
+#    define IPipelineResourceSignature_GetSRBMemoryStats(This)                 CALL_IFACE_METHOD(PipelineResourceSignature, GetSRBMemoryStats,           This)
 
 // clang-format on
 
@@ -212,6 +212,36 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
                                                  const TilePipelineStateCreateInfo REF PSOCreateInfo,
                                                  IPipelineState**                      ppPipelineState) PURE;
 
+    /// Creates multiple pipeline state objects.
+
+    /// \param [in]  ppCreateInfos    - An array of NumPipelines pointers to pipeline state create infos.
+    ///                                 The actual type of each create info is determined by its
+    ///                                 PSODesc.PipelineType member (e.g. Diligent::GraphicsPipelineStateCreateInfo
+    ///                                 for PIPELINE_TYPE_GRAPHICS).
+    /// \param [in]  NumPipelines     - The number of pipelines to create.
+    /// \param [out] ppPipelineStates - Address of the array of NumPipelines pointers where the
+    ///                                 created pipeline states will be written.
+    ///                                 The function calls AddRef() for every created object.
+    ///                                 If a pipeline fails to be created, null is written
+    ///                                 to the corresponding element.
+    ///
+    /// \remarks    The result is equivalent to creating every pipeline with the
+    ///             corresponding Create*PipelineState method, but the implementation
+    ///             may process the batch more efficiently. When the device has a shader
+    ///             compilation thread pool (see IRenderDevice::GetShaderCompilationThreadPool),
+    ///             pipelines are initialized in parallel, each one starting as soon as
+    ///             its shaders are compiled. Vulkan backend also shares shader modules
+    ///             with identical byte code between the pipelines in the batch.
+    ///
+    ///             Pipelines that do not use the PSO_CREATE_FLAG_ASYNCHRONOUS flag are
+    ///             ready when the method returns. Pipelines that use the flag may
+    ///             still be compiling, and the application should use IPipelineState::GetStatus()
+    ///             to check their status.
+    VIRTUAL void METHOD(CreatePipelineStates)(THIS_
+                                              const PipelineStateCreateInfo* const* ppCreateInfos,
+                                              Uint32                                NumPipelines,
+                                              IPipelineState**                      ppPipelineStates) PURE;
+
     /// Creates a new fence object
 
     /// \param [in]  Desc    - Fence description, see Diligent::FenceDesc for details.
@@ -443,6 +473,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_CreateGraphicsPipelineState(This, ...)     CALL_IFACE_METHOD(RenderDevice, CreateGraphicsPipelineState,     This, __VA_ARGS__)
 #    define IRenderDevice_CreateComputePipelineState(This, ...)      CALL_IFACE_METHOD(RenderDevice, CreateComputePipelineState,      This, __VA_ARGS__)
 #    define IRenderDevice_CreateRayTracingPipelineState(This, ...)   CALL_IFACE_METHOD(RenderDevice, CreateRayTracingPipelineState,   This, __VA_ARGS__)
+#    define IRenderDevice_CreatePipelineStates(This, ...)            CALL_IFACE_METHOD(RenderDevice, CreatePipelineStates,            This, __VA_ARGS__)
 #    define IRenderDevice_CreateFence(This, ...)                     CALL_IFACE_METHOD(RenderDevice, CreateFence,                     This, __VA_ARGS__)
 #    define IRenderDevice_CreateQuery(This, ...)                     CALL_IFACE_METHOD(RenderDevice, CreateQuery,                     This, __VA_ARGS__)
 #    define IRenderDevice_CreateRenderPass(This, ...)                CALL_IFACE_METHOD(RenderDevice, CreateRenderPass,                This, __VA_ARGS__)
@@ -39,7 +39,7 @@ namespace Diligent
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new render device type? Please handle it here.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new render device type? Please handle it here.");
     switch (Type)
     {
             // clang-format off
@@ -57,6 +57,10 @@ DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVIC
             return DeviceObjectArchive::DeviceType::WebGPU;
 
         // clang-format on
+        case RENDER_DEVICE_TYPE_NULL:
+            UNEXPECTED("Null device does not use device object archives");
+            return DeviceObjectArchive::DeviceType::Count;
+
         default:
             UNEXPECTED("Unexpected device type");
             return DeviceObjectArchive::DeviceType::Count;
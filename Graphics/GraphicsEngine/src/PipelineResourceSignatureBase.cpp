@@ -363,6 +363,71 @@ Uint32 FindResource(const PipelineResourceDesc Resources[],
     return InvalidPipelineResourceIndex;
 }
 
+void PipelineResourceNameIndex::Add(const char* Name, Uint32 Index, bool Suffixed, bool bMakeCopy)
+{
+    VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
+
+    const auto EntryIdx = static_cast<Uint32>(m_Entries.size());
+    m_Entries.emplace_back();
+    auto& Entry{m_Entries.back()};
+    Entry.Index    = Index;
+    Entry.Suffixed = Suffixed;
+
+    auto it = m_Chains.find(Name);
+    if (it == m_Chains.end())
+    {
+        ChainInfo Chain;
+        Chain.First = EntryIdx;
+        Chain.Last  = EntryIdx;
+        m_Chains.emplace(HashMapStringKey{Name, bMakeCopy}, Chain);
+    }
+    else
+    {
+        auto& Chain{it->second};
+        VERIFY(m_Entries[Chain.Last].Index <= Index, "Indices must be added in ascending order");
+        m_Entries[Chain.Last].Next = EntryIdx;
+        Chain.Last                 = EntryIdx;
+    }
+}
+
+void AddImmutableSamplersToNameIndex(PipelineResourceNameIndex& NameIndex,
+                                     const ImmutableSamplerDesc ImtblSamplers[],
+                                     Uint32                     NumImtblSamplers,
+                                     const char*                SamplerSuffix)
+{
+    for (Uint32 s = 0; s < NumImtblSamplers; ++s)
+    {
+        const char* SamName = ImtblSamplers[s].SamplerOrTextureName;
+        NameIndex.Add(SamName, s);
+        if (SamplerSuffix != nullptr && SamplerSuffix[0] != '\0')
+            NameIndex.Add((String{SamName} + SamplerSuffix).c_str(), s, true /*Suffixed*/, true /*bMakeCopy*/);
+    }
+}
+
+Uint32 FindImmutableSampler(const PipelineResourceNameIndex& NameIndex,
+                            const ImmutableSamplerDesc       ImtblSamplers[],
+                            SHADER_TYPE                      ShaderStages,
+                            const char*                      ResourceName,
+                            const char*                      SamplerSuffix)
+{
+    VERIFY_EXPR(ResourceName != nullptr && ResourceName[0] != '\0');
+    static_assert(PipelineResourceNameIndex::InvalidIndex == InvalidImmutableSamplerIndex, "Invalid index values must match");
+
+    // Same as in the linear search, if the suffix is given, only the names with the suffix match.
+    // Empty suffix is not added to the index, so the names without the suffix are searched instead.
+    const bool Suffixed = SamplerSuffix != nullptr && SamplerSuffix[0] != '\0';
+    return NameIndex.Find(ResourceName, Suffixed,
+                          [&](Uint32 SamIndex) {
+                              const auto& Sam = ImtblSamplers[SamIndex];
+                              if ((Sam.ShaderStages & ShaderStages) == 0)
+                                  return false;
+                              VERIFY((Sam.ShaderStages & ShaderStages) == ShaderStages,
+                                     "Immutable sampler uses only some of the stages that resource '", ResourceName,
+                                     "' is defined for. This error should've been caught by ValidatePipelineResourceSignatureDesc().");
+                              return true;
+                          });
+}
+
 /// Returns true if two pipeline resources are compatible
 inline bool PipelineResourcesCompatible(const PipelineResourceDesc& lhs, const PipelineResourceDesc& rhs)
 {
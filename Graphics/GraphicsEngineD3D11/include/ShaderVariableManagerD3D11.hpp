@@ -41,7 +41,7 @@ namespace Diligent
 {
 
 /// Diligent::ShaderVariableManagerD3D11 class
-// sizeof(ShaderVariableManagerD3D11) == 48, (Release, x64)
+// sizeof(ShaderVariableManagerD3D11) == 56, (Release, x64)
 class ShaderVariableManagerD3D11 : ShaderVariableManagerBase<EngineD3D11ImplTraits, void>
 {
 public:
@@ -194,6 +194,8 @@ public:
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
+    using TBase::SetNameHash;
+
     IShaderResourceVariable* GetVariable(const Char* Name) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
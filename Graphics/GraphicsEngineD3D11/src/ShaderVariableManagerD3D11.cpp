@@ -540,6 +540,12 @@ IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByName(const Cha
 
 IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariable(const Char* Name) const
 {
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? GetVariable(VarIndex) : nullptr;
+    }
+
     if (auto* pCB = GetResourceByName<ConstBuffBindInfo>(Name))
         return pCB;
 
@@ -70,7 +70,7 @@ class ShaderVariableD3D12Impl;
 class ShaderResourceCacheD3D12;
 class PipelineResourceSignatureD3D12Impl;
 
-// sizeof(ShaderVariableManagerD3D12) == 40 (x64, msvc, Release)
+// sizeof(ShaderVariableManagerD3D12) == 48 (x64, msvc, Release)
 class ShaderVariableManagerD3D12 : public ShaderVariableManagerBase<EngineD3D12ImplTraits, ShaderVariableD3D12Impl>
 {
 public:
@@ -95,6 +95,8 @@ public:
 
     void Destroy(IMemoryAllocator& Allocator);
 
+    using TBase::SetNameHash;
+
     ShaderVariableD3D12Impl* GetVariable(const Char* Name) const;
     ShaderVariableD3D12Impl* GetVariable(Uint32 Index) const;
 
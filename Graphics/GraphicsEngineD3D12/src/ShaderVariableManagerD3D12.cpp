@@ -135,6 +135,12 @@ const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::G
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name) const
 {
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? m_pVariables + VarIndex : nullptr;
+    }
+
     for (Uint32 v = 0; v < m_NumVariables; ++v)
     {
         auto& Var = m_pVariables[v];
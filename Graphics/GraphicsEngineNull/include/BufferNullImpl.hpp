@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BufferNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "BufferBase.hpp"
+#include "BufferViewNullImpl.hpp" // Required by BufferBase
+
+namespace Diligent
+{
+
+/// Buffer implementation in null backend.
+
+/// Dynamic, staging and unified buffers as well as buffers with CPU access flags keep
+/// their contents in system memory so that they can be mapped. Contents of other buffers
+/// is never stored.
+class BufferNullImpl final : public BufferBase<EngineNullImplTraits>
+{
+public:
+    using TBufferBase = BufferBase<EngineNullImplTraits>;
+
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x8f1d5a2c, 0x6b3e, 0x4c97, {0xa1, 0x4d, 0x2e, 0x7b, 0x90, 0xc5, 0x38, 0x16}};
+
+    BufferNullImpl(IReferenceCounters*        pRefCounters,
+                   FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
+                   RenderDeviceNullImpl*      pDevice,
+                   const BufferDesc&          Desc,
+                   const BufferData*          pInitData,
+                   bool                       bIsDeviceInternal);
+    ~BufferNullImpl() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TBufferBase)
+
+    /// Implementation of IBuffer::GetNativeHandle() in null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return 0; }
+
+    /// Implementation of IBuffer::GetSparseProperties() in null backend.
+    virtual SparseBufferProperties DILIGENT_CALL_TYPE GetSparseProperties() const override final;
+
+    /// Returns a pointer to the buffer data in system memory, or null if the
+    /// buffer contents is not stored.
+    Uint8* GetCPUData() { return !m_CPUData.empty() ? m_CPUData.data() : nullptr; }
+
+    bool HasCPUData() const { return !m_CPUData.empty(); }
+
+private:
+    virtual void CreateViewInternal(const BufferViewDesc& ViewDesc, IBufferView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8> m_CPUData;
+};
+
+} // namespace Diligent
@@ -0,0 +1,371 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DeviceContextNullImpl class
+
+#include <vector>
+#include <unordered_map>
+
+#include "EngineNullImplTraits.hpp"
+#include "DeviceContextNextGenBase.hpp"
+
+// Required by DeviceContextBase
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Device context implementation in null backend.
+
+/// The context performs all validation and state tracking that other backends do,
+/// but instead of recording GPU commands it only counts them.
+class DeviceContextNullImpl final : public DeviceContextNextGenBase<EngineNullImplTraits>
+{
+public:
+    using TDeviceContextBase = DeviceContextNextGenBase<EngineNullImplTraits>;
+
+    DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                          RenderDeviceNullImpl*    pDevice,
+                          const DeviceContextDesc& Desc);
+    ~DeviceContextNullImpl();
+
+    /// Implementation of IDeviceContext::Begin() in null backend.
+    virtual void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+
+    /// Implementation of IDeviceContext::SetPipelineState() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
+
+    /// Implementation of IDeviceContext::TransitionShaderResources() in null backend.
+    virtual void DILIGENT_CALL_TYPE TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding) override final;
+
+    /// Implementation of IDeviceContext::CommitShaderResources() in null backend.
+    virtual void DILIGENT_CALL_TYPE CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetStencilRef() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetStencilRef(Uint32 StencilRef) override final;
+
+    /// Implementation of IDeviceContext::SetBlendFactors() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
+
+    /// Implementation of IDeviceContext::SetVertexBuffers() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
+                                                     Uint32                         NumBuffersSet,
+                                                     IBuffer* const*                ppBuffers,
+                                                     const Uint64*                  pOffsets,
+                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                                     SET_VERTEX_BUFFERS_FLAGS       Flags) override final;
+
+    /// Implementation of IDeviceContext::InvalidateState() in null backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateState() override final;
+
+    /// Implementation of IDeviceContext::SetIndexBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                                   Uint64                         ByteOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetViewports() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetViewports(Uint32          NumViewports,
+                                                 const Viewport* pViewports,
+                                                 Uint32          RTWidth,
+                                                 Uint32          RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetScissorRects() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetScissorRects(Uint32      NumRects,
+                                                    const Rect* pRects,
+                                                    Uint32      RTWidth,
+                                                    Uint32      RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetRenderTargetsExt() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::BeginRenderPass() in null backend.
+    virtual void DILIGENT_CALL_TYPE BeginRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::NextSubpass() in null backend.
+    virtual void DILIGENT_CALL_TYPE NextSubpass() override final;
+
+    /// Implementation of IDeviceContext::EndRenderPass() in null backend.
+    virtual void DILIGENT_CALL_TYPE EndRenderPass() override final;
+
+    /// Implementation of IDeviceContext::Draw() in null backend.
+    virtual void DILIGENT_CALL_TYPE Draw(const DrawAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndexed() in null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndexed(const DrawIndexedAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndirect() in null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndexedIndirect() in null backend.
+    virtual void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawMesh() in null backend.
+    virtual void DILIGENT_CALL_TYPE DrawMesh(const DrawMeshAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawMeshIndirect() in null backend.
+    virtual void DILIGENT_CALL_TYPE DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDraw() in null backend.
+    virtual void DILIGENT_CALL_TYPE MultiDraw(const MultiDrawAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in null backend.
+    virtual void DILIGENT_CALL_TYPE MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DispatchCompute() in null backend.
+    virtual void DILIGENT_CALL_TYPE DispatchCompute(const DispatchComputeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DispatchComputeIndirect() in null backend.
+    virtual void DILIGENT_CALL_TYPE DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::ClearDepthStencil() in null backend.
+    virtual void DILIGENT_CALL_TYPE ClearDepthStencil(ITextureView*                  pView,
+                                                      CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                                      float                          fDepth,
+                                                      Uint8                          Stencil,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::ClearRenderTarget() in null backend.
+    virtual void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView*                  pView,
+                                                      const void*                    RGBA,
+                                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::UpdateBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
+                                                 Uint64                         Offset,
+                                                 Uint64                         Size,
+                                                 const void*                    pData,
+                                                 RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE CopyBuffer(IBuffer*                       pSrcBuffer,
+                                               Uint64                         SrcOffset,
+                                               RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                               IBuffer*                       pDstBuffer,
+                                               Uint64                         DstOffset,
+                                               Uint64                         Size,
+                                               RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::MapBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE MapBuffer(IBuffer*  pBuffer,
+                                              MAP_TYPE  MapType,
+                                              MAP_FLAGS MapFlags,
+                                              PVoid&    pMappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType) override final;
+
+    /// Implementation of IDeviceContext::UpdateTexture() in null backend.
+    virtual void DILIGENT_CALL_TYPE UpdateTexture(ITexture*                      pTexture,
+                                                  Uint32                         MipLevel,
+                                                  Uint32                         Slice,
+                                                  const Box&                     DstBox,
+                                                  const TextureSubResData&       SubresData,
+                                                  RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                                  RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyTexture() in null backend.
+    virtual void DILIGENT_CALL_TYPE CopyTexture(const CopyTextureAttribs& CopyAttribs) override final;
+
+    /// Implementation of IDeviceContext::MapTextureSubresource() in null backend.
+    virtual void DILIGENT_CALL_TYPE MapTextureSubresource(ITexture*                 pTexture,
+                                                          Uint32                    MipLevel,
+                                                          Uint32                    ArraySlice,
+                                                          MAP_TYPE                  MapType,
+                                                          MAP_FLAGS                 MapFlags,
+                                                          const Box*                pMapRegion,
+                                                          MappedTextureSubresource& MappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapTextureSubresource() in null backend.
+    virtual void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
+
+    /// Implementation of IDeviceContext::FinishCommandList() in null backend.
+    virtual void DILIGENT_CALL_TYPE FinishCommandList(ICommandList** ppCommandList) override final;
+
+    /// Implementation of IDeviceContext::ExecuteCommandLists() in null backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteCommandLists(Uint32               NumCommandLists,
+                                                        ICommandList* const* ppCommandLists) override final;
+
+    /// Implementation of IDeviceContext::EnqueueSignal() in null backend.
+    virtual void DILIGENT_CALL_TYPE EnqueueSignal(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in null backend.
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::WaitForIdle() in null backend.
+    virtual void DILIGENT_CALL_TYPE WaitForIdle() override final;
+
+    /// Implementation of IDeviceContext::BeginQuery() in null backend.
+    virtual void DILIGENT_CALL_TYPE BeginQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::EndQuery() in null backend.
+    virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::Flush() in null backend.
+    virtual void DILIGENT_CALL_TYPE Flush() override final;
+
+    /// Implementation of IDeviceContext::BuildBLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE BuildBLAS(const BuildBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::BuildTLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE BuildTLAS(const BuildTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyBLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE CopyBLAS(const CopyBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyTLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE CopyTLAS(const CopyTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteBLASCompactedSize() in null backend.
+    virtual void DILIGENT_CALL_TYPE WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteTLASCompactedSize() in null backend.
+    virtual void DILIGENT_CALL_TYPE WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::TraceRays() in null backend.
+    virtual void DILIGENT_CALL_TYPE TraceRays(const TraceRaysAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::TraceRaysIndirect() in null backend.
+    virtual void DILIGENT_CALL_TYPE TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::UpdateSBT() in null backend.
+    virtual void DILIGENT_CALL_TYPE UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs) override final;
+
+    /// Implementation of IDeviceContext::BeginDebugGroup() in null backend.
+    virtual void DILIGENT_CALL_TYPE BeginDebugGroup(const Char* Name, const float* pColor) override final;
+
+    /// Implementation of IDeviceContext::EndDebugGroup() in null backend.
+    virtual void DILIGENT_CALL_TYPE EndDebugGroup() override final;
+
+    /// Implementation of IDeviceContext::InsertDebugLabel() in null backend.
+    virtual void DILIGENT_CALL_TYPE InsertDebugLabel(const Char* Label, const float* pColor) override final;
+
+    /// Implementation of IDeviceContext::SetShadingRate() in null backend.
+    virtual void DILIGENT_CALL_TYPE SetShadingRate(SHADING_RATE          BaseRate,
+                                                   SHADING_RATE_COMBINER PrimitiveCombiner,
+                                                   SHADING_RATE_COMBINER TextureCombiner) override final;
+
+    /// Implementation of IDeviceContext::BindSparseResourceMemory() in null backend.
+    virtual void DILIGENT_CALL_TYPE BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::GenerateMips() in null backend.
+    virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+
+    /// Implementation of IDeviceContext::FinishFrame() in null backend.
+    virtual void DILIGENT_CALL_TYPE FinishFrame() override final;
+
+    /// Implementation of IDeviceContext::TransitionResourceStates() in null backend.
+    virtual void DILIGENT_CALL_TYPE TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers) override final;
+
+    /// Implementation of IDeviceContext::ResolveTextureSubresource() in null backend.
+    virtual void DILIGENT_CALL_TYPE ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                              ITexture*                               pDstTexture,
+                                                              const ResolveTextureSubresourceAttribs& ResolveAttribs) override final;
+
+    // clang-format off
+    void TransitionTextureState(TextureNullImpl& TextureNull, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateTextureState);
+    void TransitionBufferState (BufferNullImpl&  BufferNull,  RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState);
+    // clang-format on
+
+    /// Returns the number of commands recorded since the last flush.
+    Uint32 GetNumCommandsInCtx() const { return m_NumCommands; }
+
+private:
+    void Flush(Uint32               NumCommandLists,
+               ICommandList* const* ppCommandLists);
+
+    // clang-format off
+    void TransitionOrVerifyBufferState (BufferNullImpl&                 Buffer,
+                                        RESOURCE_STATE_TRANSITION_MODE  TransitionMode,
+                                        RESOURCE_STATE                  RequiredState,
+                                        const char*                     OperationName);
+    void TransitionOrVerifyTextureState(TextureNullImpl&                Texture,
+                                        RESOURCE_STATE_TRANSITION_MODE  TransitionMode,
+                                        RESOURCE_STATE                  RequiredState,
+                                        const char*                     OperationName);
+    // clang-format on
+
+    void PrepareForDraw(DRAW_FLAGS Flags);
+    void PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
+    void PrepareForDispatchCompute();
+    void PrepareForIndirectCommand(IBuffer* pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode);
+
+    void CommitSRBs(Uint32 CommitMask);
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpValidateCommittedShaderResources();
+#endif
+
+private:
+    // The number of commands recorded since the last flush
+    Uint32 m_NumCommands = 0;
+
+    CommittedShaderResources m_BindInfo;
+
+    std::vector<std::pair<Uint64, RefCntAutoPtr<FenceNullImpl>>> m_SignalFences;
+
+    FixedBlockMemoryAllocator m_CmdListAllocator;
+
+    Int32 m_ActiveQueriesCounter = 0;
+
+    struct MappedTextureKey
+    {
+        TextureNullImpl* const Texture;
+        Uint32 const           MipLevel;
+        Uint32 const           ArraySlice;
+
+        constexpr bool operator==(const MappedTextureKey& rhs) const
+        {
+            return Texture == rhs.Texture &&
+                MipLevel == rhs.MipLevel &&
+                ArraySlice == rhs.ArraySlice;
+        }
+        struct Hasher
+        {
+            size_t operator()(const MappedTextureKey& Key) const noexcept
+            {
+                return ComputeHash(Key.Texture, Key.MipLevel, Key.ArraySlice);
+            }
+        };
+    };
+    // Dynamic textures have no system memory storage, so the context provides
+    // temporary memory for every mapped subresource.
+    std::unordered_map<MappedTextureKey, std::vector<Uint8>, MappedTextureKey::Hasher> m_MappedTextures;
+};
+
+} // namespace Diligent
@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::EngineNullImplTraits struct
+
+#include "RenderDevice.h"
+#include "DeviceContext.h"
+#include "RenderPass.h"
+#include "Framebuffer.h"
+#include "CommandList.h"
+#include "PipelineResourceSignature.h"
+#include "DeviceMemory.h"
+
+#include "CommandQueueNull.h"
+
+namespace Diligent
+{
+
+class RenderDeviceNullImpl;
+class DeviceContextNullImpl;
+class PipelineStateNullImpl;
+class ShaderResourceBindingNullImpl;
+class BufferNullImpl;
+class BufferViewNullImpl;
+class TextureNullImpl;
+class TextureViewNullImpl;
+class ShaderNullImpl;
+class SamplerNullImpl;
+class FenceNullImpl;
+class QueryNullImpl;
+class RenderPassNullImpl;
+class FramebufferNullImpl;
+class CommandListNullImpl;
+class BottomLevelASNullImpl;
+class TopLevelASNullImpl;
+class ShaderBindingTableNullImpl;
+class PipelineResourceSignatureNullImpl;
+class DeviceMemoryNullImpl;
+class PipelineStateCacheNullImpl
+{};
+
+class FixedBlockMemoryAllocator;
+
+class ShaderResourceCacheNull;
+class ShaderVariableManagerNull;
+
+struct PipelineResourceAttribsNull;
+struct ImmutableSamplerAttribsNull;
+struct PipelineResourceSignatureInternalDataNull;
+
+struct EngineNullImplTraits
+{
+    static constexpr auto DeviceType = RENDER_DEVICE_TYPE_NULL;
+
+    using RenderDeviceInterface              = IRenderDevice;
+    using DeviceContextInterface             = IDeviceContext;
+    using PipelineStateInterface             = IPipelineState;
+    using ShaderResourceBindingInterface     = IShaderResourceBinding;
+    using BufferInterface                    = IBuffer;
+    using BufferViewInterface                = IBufferView;
+    using TextureInterface                   = ITexture;
+    using TextureViewInterface               = ITextureView;
+    using ShaderInterface                    = IShader;
+    using SamplerInterface                   = ISampler;
+    using FenceInterface                     = IFence;
+    using QueryInterface                     = IQuery;
+    using RenderPassInterface                = IRenderPass;
+    using FramebufferInterface               = IFramebuffer;
+    using CommandListInterface               = ICommandList;
+    using PipelineResourceSignatureInterface = IPipelineResourceSignature;
+    using CommandQueueInterface              = ICommandQueueNull;
+    using DeviceMemoryInterface              = IDeviceMemory;
+
+    using RenderDeviceImplType              = RenderDeviceNullImpl;
+    using DeviceContextImplType             = DeviceContextNullImpl;
+    using PipelineStateImplType             = PipelineStateNullImpl;
+    using ShaderResourceBindingImplType     = ShaderResourceBindingNullImpl;
+    using BufferImplType                    = BufferNullImpl;
+    using BufferViewImplType                = BufferViewNullImpl;
+    using TextureImplType                   = TextureNullImpl;
+    using TextureViewImplType               = TextureViewNullImpl;
+    using ShaderImplType                    = ShaderNullImpl;
+    using SamplerImplType                   = SamplerNullImpl;
+    using FenceImplType                     = FenceNullImpl;
+    using QueryImplType                     = QueryNullImpl;
+    using RenderPassImplType                = RenderPassNullImpl;
+    using FramebufferImplType               = FramebufferNullImpl;
+    using CommandListImplType               = CommandListNullImpl;
+    using BottomLevelASImplType             = BottomLevelASNullImpl;
+    using TopLevelASImplType                = TopLevelASNullImpl;
+    using ShaderBindingTableImplType        = ShaderBindingTableNullImpl;
+    using PipelineResourceSignatureImplType = PipelineResourceSignatureNullImpl;
+    using DeviceMemoryImplType              = DeviceMemoryNullImpl;
+    using PipelineStateCacheImplType        = PipelineStateCacheNullImpl;
+
+    using BuffViewObjAllocatorType = FixedBlockMemoryAllocator;
+    using TexViewObjAllocatorType  = FixedBlockMemoryAllocator;
+
+    using ShaderResourceCacheImplType   = ShaderResourceCacheNull;
+    using ShaderVariableManagerImplType = ShaderVariableManagerNull;
+
+    using PipelineResourceAttribsType               = PipelineResourceAttribsNull;
+    using ImmutableSamplerAttribsType               = ImmutableSamplerAttribsNull;
+    using PipelineResourceSignatureInternalDataType = PipelineResourceSignatureInternalDataNull;
+};
+
+} // namespace Diligent
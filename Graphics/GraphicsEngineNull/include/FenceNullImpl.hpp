@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::FenceNullImpl class
+
+#include <deque>
+#include <mutex>
+
+#include "EngineNullImplTraits.hpp"
+#include "FenceBase.hpp"
+#include "IndexWrapper.hpp"
+
+namespace Diligent
+{
+
+/// Fence implementation in null backend.
+class FenceNullImpl final : public FenceBase<EngineNullImplTraits>
+{
+public:
+    using TFenceBase = FenceBase<EngineNullImplTraits>;
+
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x3c5f18e2, 0x94a7, 0x4b0d, {0xae, 0x73, 0x58, 0x1f, 0xc2, 0x06, 0xd9, 0x8b}};
+
+    FenceNullImpl(IReferenceCounters*   pRefCounters,
+                  RenderDeviceNullImpl* pDevice,
+                  const FenceDesc&      Desc);
+    ~FenceNullImpl() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TFenceBase)
+
+    /// Implementation of IFence::GetCompletedValue() in null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetCompletedValue() override final;
+
+    /// Implementation of IFence::Signal() in null backend.
+    virtual void DILIGENT_CALL_TYPE Signal(Uint64 Value) override final;
+
+    /// Implementation of IFence::Wait() in null backend.
+    virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
+
+    /// Enqueues a signal that will be performed when the command queue
+    /// reaches the given fence value.
+    void EnqueueSignal(SoftwareQueueIndex QueueId, Uint64 QueueFenceValue, Uint64 Value);
+
+private:
+    struct PendingSignal
+    {
+        SoftwareQueueIndex QueueId;
+        Uint64             QueueFenceValue;
+        Uint64             Value;
+    };
+    std::mutex                m_PendingSignalsMtx;
+    std::deque<PendingSignal> m_PendingSignals;
+};
+
+} // namespace Diligent
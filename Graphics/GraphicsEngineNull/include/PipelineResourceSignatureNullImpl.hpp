@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineResourceSignatureNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "PipelineResourceSignatureBase.hpp"
+
+// ShaderResourceCacheNull, ShaderVariableManagerNull, and ShaderResourceBindingNullImpl
+// are required by PipelineResourceSignatureBase
+#include "ShaderResourceCacheNull.hpp"
+#include "ShaderVariableManagerNull.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+
+#include "PipelineResourceAttribsNull.hpp"
+#include "SamplerNullImpl.hpp"
+
+namespace Diligent
+{
+
+struct ImmutableSamplerAttribsNull
+{
+public:
+    Uint32 CacheOffset = ~0u; // Offset in the SRB resource cache
+    Uint32 ArraySize   = 1;
+
+    ImmutableSamplerAttribsNull() noexcept {}
+
+    bool IsAllocated() const { return CacheOffset != ~0u; }
+};
+ASSERT_SIZEOF(ImmutableSamplerAttribsNull, 8, "The struct is used in serialization and must be tightly packed");
+
+struct PipelineResourceSignatureInternalDataNull : PipelineResourceSignatureInternalData<PipelineResourceAttribsNull, ImmutableSamplerAttribsNull>
+{
+    PipelineResourceSignatureInternalDataNull() noexcept = default;
+
+    explicit PipelineResourceSignatureInternalDataNull(const PipelineResourceSignatureInternalData& InternalData) noexcept :
+        PipelineResourceSignatureInternalData{InternalData}
+    {}
+};
+
+/// Implementation of the Diligent::PipelineResourceSignatureNullImpl class
+
+/// The null signature lays out all resources in a single flat cache:
+///
+///     | Immutable samplers | Static | Mutable | Dynamic |
+///
+/// Static resources are additionally stored in the static resource cache.
+class PipelineResourceSignatureNullImpl final : public PipelineResourceSignatureBase<EngineNullImplTraits>
+{
+public:
+    using TPipelineResourceSignatureBase = PipelineResourceSignatureBase<EngineNullImplTraits>;
+
+    using ResourceAttribs = TPipelineResourceSignatureBase::PipelineResourceAttribsType;
+
+    PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                      RenderDeviceNullImpl*                pDevice,
+                                      const PipelineResourceSignatureDesc& Desc,
+                                      SHADER_TYPE                          ShaderStages      = SHADER_TYPE_UNKNOWN,
+                                      bool                                 bIsDeviceInternal = false);
+    ~PipelineResourceSignatureNullImpl();
+
+    /// Returns the total number of resources in the SRB cache, including immutable samplers.
+    Uint32 GetTotalSRBCacheSize() const { return m_TotalSRBCacheSize; }
+
+    void InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache);
+
+    void CopyStaticResources(ShaderResourceCacheNull& ResourceCache) const;
+    // Make the base class method visible
+    using TPipelineResourceSignatureBase::CopyStaticResources;
+
+#ifdef DILIGENT_DEVELOPMENT
+    /// Verifies that all resources required by the signature are bound in the cache.
+    bool DvpValidateCommittedResources(const ShaderResourceCacheNull& ResourceCache) const;
+#endif
+
+private:
+    void CreateLayout();
+
+private:
+    // The total number of resources in the SRB cache, accounting for array sizes
+    Uint32 m_TotalSRBCacheSize = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::RenderDeviceNullImpl class
+
+#include "EngineNullImplTraits.hpp"
+#include "RenderDeviceBase.hpp"
+#include "RenderDeviceNextGenBase.hpp"
+#include "CommandQueueNull.h"
+
+namespace Diligent
+{
+
+/// Render device implementation in null backend.
+
+/// The device creates all objects on the CPU side and never allocates any GPU memory.
+/// Every immediate context has its own command queue, see Diligent::CommandQueueNullImpl.
+class RenderDeviceNullImpl final : public RenderDeviceNextGenBase<RenderDeviceBase<EngineNullImplTraits>, ICommandQueueNull>
+{
+public:
+    using TRenderDeviceBase = RenderDeviceNextGenBase<RenderDeviceBase<EngineNullImplTraits>, ICommandQueueNull>;
+
+    RenderDeviceNullImpl(IReferenceCounters*         pRefCounters,
+                         IMemoryAllocator&           RawMemAllocator,
+                         IEngineFactory*             pEngineFactory,
+                         const EngineNullCreateInfo& EngineCI,
+                         const GraphicsAdapterInfo&  AdapterInfo,
+                         size_t                      CommandQueueCount,
+                         ICommandQueueNull**         ppCmdQueues) noexcept(false);
+    ~RenderDeviceNullImpl() override;
+
+    /// Implementation of IRenderDevice::CreateBuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateBuffer(const BufferDesc& BuffDesc,
+                                                 const BufferData* pBuffData,
+                                                 IBuffer**         ppBuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateShader() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
+                                                 IShader**               ppShader,
+                                                 IDataBlob**             ppCompilerOutput) override final;
+
+    /// Implementation of IRenderDevice::CreateTexture() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateTexture(const TextureDesc& TexDesc,
+                                                  const TextureData* pData,
+                                                  ITexture**         ppTexture) override final;
+
+    /// Implementation of IRenderDevice::CreateSampler() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateSampler(const SamplerDesc& SamplerDesc,
+                                                  ISampler**         ppSampler) override final;
+
+    /// Implementation of IRenderDevice::CreateGraphicsPipelineState() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                                IPipelineState**                       ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateComputePipelineState() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                               IPipelineState**                      ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateRayTracingPipelineState() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                                  IPipelineState**                         ppPipelineState) override final;
+
+    /// Implementation of IRenderDevice::CreateFence() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateFence(const FenceDesc& Desc,
+                                                IFence**         ppFence) override final;
+
+    /// Implementation of IRenderDevice::CreateQuery() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateQuery(const QueryDesc& Desc,
+                                                IQuery**         ppQuery) override final;
+
+    /// Implementation of IRenderDevice::CreateRenderPass() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateRenderPass(const RenderPassDesc& Desc,
+                                                     IRenderPass**         ppRenderPass) override final;
+
+    /// Implementation of IRenderDevice::CreateFramebuffer() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateFramebuffer(const FramebufferDesc& Desc,
+                                                      IFramebuffer**         ppFramebuffer) override final;
+
+    /// Implementation of IRenderDevice::CreateBLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateBLAS(const BottomLevelASDesc& Desc,
+                                               IBottomLevelAS**         ppBLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateTLAS() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateTLAS(const TopLevelASDesc& Desc,
+                                               ITopLevelAS**         ppTLAS) override final;
+
+    /// Implementation of IRenderDevice::CreateSBT() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateSBT(const ShaderBindingTableDesc& Desc,
+                                              IShaderBindingTable**         ppSBT) override final;
+
+    /// Implementation of IRenderDevice::CreatePipelineResourceSignature() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                                    IPipelineResourceSignature**         ppSignature) override final;
+
+    /// Implementation of IRenderDevice::CreateDeviceMemory() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                                       IDeviceMemory**               ppMemory) override final;
+
+    /// Implementation of IRenderDevice::CreatePipelineStateCache() in null backend.
+    virtual void DILIGENT_CALL_TYPE CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                             IPipelineStateCache**               ppPSOCache) override final;
+
+    /// Implementation of IRenderDevice::ReleaseStaleResources() in null backend.
+    virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
+
+    /// Implementation of IRenderDevice::IdleGPU() in null backend.
+    virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
+
+    /// Implementation of IRenderDevice::GetSparseTextureFormatInfo() in null backend.
+    virtual SparseTextureFormatInfo DILIGENT_CALL_TYPE GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
+                                                                                  RESOURCE_DIMENSION Dimension,
+                                                                                  Uint32             SampleCount) const override final;
+
+    void CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                         IPipelineResourceSignature**         ppSignature,
+                                         SHADER_TYPE                          ShaderStages,
+                                         bool                                 IsDeviceInternal);
+
+    void CreateBuffer(const BufferDesc& BuffDesc,
+                      const BufferData* pBuffData,
+                      IBuffer**         ppBuffer,
+                      bool              IsDeviceInternal);
+
+    void CreateTexture(const TextureDesc& TexDesc,
+                       const TextureData* pData,
+                       ITexture**         ppTexture,
+                       bool               IsDeviceInternal);
+
+    void CreateSampler(const SamplerDesc& SamplerDesc,
+                       ISampler**         ppSampler,
+                       bool               IsDeviceInternal);
+
+    // Submits an empty command buffer to the queue so that stale resources are released
+    // when the queue completes it. Called by DeviceContextNextGenBase::EndFrame().
+    void FlushStaleResources(SoftwareQueueIndex CmdQueueIndex);
+
+private:
+    virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
+};
+
+} // namespace Diligent
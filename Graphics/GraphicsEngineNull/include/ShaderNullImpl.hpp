@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "ShaderBase.hpp"
+
+namespace Diligent
+{
+
+/// Shader implementation in null backend.
+
+/// Shaders are not compiled and are not reflected: the shader has no resources,
+/// and GetBytecode() returns the byte code or the source code the shader was created from.
+class ShaderNullImpl final : public ShaderBase<EngineNullImplTraits>
+{
+public:
+    using TShaderBase = ShaderBase<EngineNullImplTraits>;
+
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x71b2e6d4, 0x0c9f, 0x4a85, {0xb3, 0x47, 0x9a, 0xe5, 0x20, 0x6c, 0xf1, 0x3d}};
+
+    ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                   RenderDeviceNullImpl*   pDevice,
+                   const ShaderCreateInfo& ShaderCI,
+                   bool                    IsDeviceInternal = false);
+    ~ShaderNullImpl() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TShaderBase)
+
+    /// Implementation of IShader::GetResourceCount() in null backend.
+    virtual Uint32 DILIGENT_CALL_TYPE GetResourceCount() const override final { return 0; }
+
+    /// Implementation of IShader::GetResourceDesc() in null backend.
+    virtual void DILIGENT_CALL_TYPE GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const override final;
+
+    /// Implementation of IShader::GetConstantBufferDesc() in null backend.
+    virtual const ShaderCodeBufferDesc* DILIGENT_CALL_TYPE GetConstantBufferDesc(Uint32 Index) const override final;
+
+    /// Implementation of IShader::GetBytecode() in null backend.
+    virtual void DILIGENT_CALL_TYPE GetBytecode(const void** ppBytecode, Uint64& Size) const override final;
+
+private:
+    std::vector<Uint8> m_Bytecode;
+};
+
+} // namespace Diligent
@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderResourceCacheNull class
+
+#include <memory>
+#include <vector>
+
+#include "ShaderResourceCacheCommon.hpp"
+#include "ShaderResourceVariable.h"
+#include "STDAllocator.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+struct IMemoryAllocator;
+class DeviceContextNullImpl;
+
+/// Shader resource cache of the null backend.
+
+/// Unlike the caches of other backends, the null cache has no descriptor sets or
+/// bind groups: all resources are stored in a single flat array.
+class ShaderResourceCacheNull : public ShaderResourceCacheBase
+{
+public:
+    explicit ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept;
+
+    // clang-format off
+    ShaderResourceCacheNull           (const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull& operator=(const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull           (      ShaderResourceCacheNull&&) = delete;
+    ShaderResourceCacheNull& operator=(      ShaderResourceCacheNull&&) = delete;
+    // clang-format on
+
+    ~ShaderResourceCacheNull();
+
+    static size_t GetRequiredMemorySize(Uint32 NumResources);
+
+    void Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources);
+    void InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type, bool HasImmutableSampler);
+
+    struct Resource
+    {
+        explicit Resource(SHADER_RESOURCE_TYPE _Type, bool _HasImmutableSampler) noexcept :
+            Type{_Type},
+            HasImmutableSampler{_HasImmutableSampler}
+        {
+            VERIFY(Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV || Type == SHADER_RESOURCE_TYPE_SAMPLER || !HasImmutableSampler,
+                   "Immutable sampler can only be assigned to a texture or a sampler");
+        }
+
+        // clang-format off
+        Resource           (const Resource&)  = delete;
+        Resource           (      Resource&&) = delete;
+        Resource& operator=(const Resource&)  = delete;
+        Resource& operator=(      Resource&&) = delete;
+
+/* 0 */ const SHADER_RESOURCE_TYPE   Type;
+/* 1 */ const bool                   HasImmutableSampler;
+/*2-3*/ // Unused
+/* 4 */ Uint32                       BufferDynamicOffset = 0;
+/* 8 */ RefCntAutoPtr<IDeviceObject> pObject;
+
+        // For constant buffers only
+/*16 */ Uint64                       BufferBaseOffset = 0;
+/*24 */ Uint64                       BufferRangeSize  = 0;
+        // clang-format on
+
+        explicit operator bool() const { return pObject != nullptr; }
+    };
+
+    const Resource& GetResource(Uint32 CacheOffset) const
+    {
+        VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+        return m_pResources[CacheOffset];
+    }
+
+    Uint32 GetSize() const { return m_NumResources; }
+
+    const Resource& SetResource(Uint32                       CacheOffset,
+                                RefCntAutoPtr<IDeviceObject> pObject,
+                                Uint64                       BufferBaseOffset = 0,
+                                Uint64                       BufferRangeSize  = 0);
+
+    const Resource& ResetResource(Uint32 CacheOffset)
+    {
+        return SetResource(CacheOffset, {});
+    }
+
+    void SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset);
+
+    bool HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
+
+    ResourceCacheContentType GetContentType() const { return static_cast<ResourceCacheContentType>(m_ContentType); }
+
+    template <bool VerifyOnly>
+    void TransitionResources(DeviceContextNullImpl* pCtxNullImpl);
+
+#ifdef DILIGENT_DEBUG
+    // For debug purposes only
+    void DbgVerifyResourceInitialization() const;
+    void DbgVerifyDynamicBuffersCounter() const;
+#endif
+
+private:
+    Resource& GetResource(Uint32 CacheOffset)
+    {
+        VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+        return m_pResources[CacheOffset];
+    }
+
+private:
+    std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
+
+    Resource* m_pResources = nullptr;
+
+    // The total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
+    // regardless of the variable type.
+    Uint32 m_NumDynamicBuffers = 0;
+    Uint32 m_NumResources : 31;
+
+    // Indicates what types of resources are stored in the cache
+    const Uint32 m_ContentType : 1;
+
+#ifdef DILIGENT_DEBUG
+    // Debug array that stores flags indicating if resources in the cache have been initialized
+    std::vector<bool> m_DbgInitializedResources;
+#endif
+};
+
+} // namespace Diligent
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp" // Required by TextureBase
+
+namespace Diligent
+{
+
+/// Texture implementation in null backend.
+
+/// Staging textures keep their contents in system memory so that they can be mapped.
+/// Contents of other textures is never stored.
+class TextureNullImpl final : public TextureBase<EngineNullImplTraits>
+{
+public:
+    using TTextureBase = TextureBase<EngineNullImplTraits>;
+
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x4b7e2f90, 0xa3c1, 0x4d58, {0x9f, 0x26, 0x1c, 0x8d, 0x5e, 0x73, 0xb0, 0x4a}};
+
+    // Staging texture subresources are aligned by this value in system memory
+    static constexpr Uint32 StagingDataAlignment = 16;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDevice,
+                    const TextureDesc&         Desc,
+                    const TextureData*         pInitData,
+                    bool                       bIsDeviceInternal = false);
+    ~TextureNullImpl() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TTextureBase)
+
+    /// Implementation of ITexture::GetNativeHandle() in null backend.
+    virtual Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return 0; }
+
+    /// Returns a pointer to the staging texture data in system memory, or null if the
+    /// texture contents is not stored.
+    Uint8* GetCPUData() { return !m_CPUData.empty() ? m_CPUData.data() : nullptr; }
+
+    Uint64 GetSubresourceOffset(Uint32 MipLevel, Uint32 ArraySlice) const
+    {
+        return GetStagingTextureSubresourceOffset(m_Desc, ArraySlice, MipLevel, StagingDataAlignment);
+    }
+
+private:
+    virtual void CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8> m_CPUData;
+};
+
+} // namespace Diligent
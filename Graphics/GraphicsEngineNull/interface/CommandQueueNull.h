@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ICommandQueueNull interface
+
+#include "../../GraphicsEngine/interface/CommandQueue.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {6A3B9F4E-2C71-4D8A-9E05-B7F1C2D34A68}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_CommandQueueNull =
+    {0x6a3b9f4e, 0x2c71, 0x4d8a, {0x9e, 0x5, 0xb7, 0xf1, 0xc2, 0xd3, 0x4a, 0x68}};
+
+#define DILIGENT_INTERFACE_NAME ICommandQueueNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define ICommandQueueNullInclusiveMethods \
+    ICommandQueueInclusiveMethods;        \
+    ICommandQueueNullMethods CommandQueueNull
+
+// clang-format off
+
+/// Command queue interface of the null backend
+DILIGENT_BEGIN_INTERFACE(ICommandQueueNull, ICommandQueue)
+{
+    /// Submits recorded commands for execution.
+
+    /// \param[in]  NumCommands - The number of commands in the submitted command buffer.
+    ///
+    /// \return Fence value associated with the submitted commands.
+    ///
+    /// \remarks    The commands are never executed. The returned fence value is
+    ///             completed immediately or after the latency specified by
+    ///             EngineNullCreateInfo::FenceLatencyMicroseconds.
+    VIRTUAL Uint64 METHOD(Submit)(THIS_
+                                  Uint32 NumCommands) PURE;
+
+    /// Returns the total number of commands submitted to the queue.
+    VIRTUAL Uint64 METHOD(GetSubmittedCommandCount)(THIS) CONST PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define ICommandQueueNull_Submit(This, ...)              CALL_IFACE_METHOD(CommandQueueNull, Submit,                   This, __VA_ARGS__)
+#    define ICommandQueueNull_GetSubmittedCommandCount(This) CALL_IFACE_METHOD(CommandQueueNull, GetSubmittedCommandCount, This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of functions that initialize the null engine implementation
+
+#include "../../GraphicsEngine/interface/EngineFactory.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/SwapChain.h"
+
+#if PLATFORM_LINUX || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS || PLATFORM_ANDROID || PLATFORM_EMSCRIPTEN || (PLATFORM_WIN32 && !defined(_MSC_VER))
+// https://gcc.gnu.org/wiki/Visibility
+#    define API_QUALIFIER __attribute__((visibility("default")))
+#elif PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+#    define API_QUALIFIER
+#else
+#    error Unsupported platform
+#endif
+
+#if ENGINE_DLL && PLATFORM_WIN32 && defined(_MSC_VER)
+#    include "../../GraphicsEngine/interface/LoadEngineDll.h"
+#    define EXPLICITLY_LOAD_ENGINE_NULL_DLL 1
+#endif
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {4E1B2C7D-93A5-4F60-8D2E-5C8A1F07B3E9}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactoryNull =
+    {0x4e1b2c7d, 0x93a5, 0x4f60, {0x8d, 0x2e, 0x5c, 0x8a, 0x1f, 0x7, 0xb3, 0xe9}};
+
+#define DILIGENT_INTERFACE_NAME IEngineFactoryNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IEngineFactoryNullInclusiveMethods \
+    IEngineFactoryInclusiveMethods;        \
+    IEngineFactoryNullMethods EngineFactoryNull
+
+// clang-format off
+
+/// Engine factory for the null rendering backend.
+
+/// The null backend implements resources, pipeline states, shader resource bindings,
+/// state transitions and command recording on the CPU side, but never performs any GPU work.
+/// It is intended for measuring the CPU overhead of the engine and the application.
+DILIGENT_BEGIN_INTERFACE(IEngineFactoryNull, IEngineFactory)
+{
+    /// Creates a render device and device contexts for the null engine implementation.
+
+    /// \param [in] EngineCI    - Engine creation info.
+    /// \param [out] ppDevice   - Address of the memory location where pointer to
+    ///                           the created device will be written.
+    /// \param [out] ppContexts - Address of the memory location where pointers to
+    ///                           the contexts will be written. Immediate contexts go first
+    ///                           (NumImmediateContexts), followed by the deferred contexts
+    ///                           (NumDeferredContexts).
+    VIRTUAL void METHOD(CreateDeviceAndContextsNull)(THIS_
+                                                     const EngineNullCreateInfo REF EngineCI,
+                                                     IRenderDevice**                ppDevice,
+                                                     IDeviceContext**               ppContexts) PURE;
+
+    /// Creates an off-screen swap chain for the null engine implementation.
+
+    /// \param [in] pDevice           - Pointer to the render device.
+    /// \param [in] pImmediateContext - Pointer to the immediate device context.
+    /// \param [in] SCDesc            - Swap chain description.
+    /// \param [out] ppSwapChain      - Address of the memory location where pointer to the new
+    ///                                 swap chain will be written.
+    VIRTUAL void METHOD(CreateSwapChainNull)(THIS_
+                                             IRenderDevice*          pDevice,
+                                             IDeviceContext*         pImmediateContext,
+                                             const SwapChainDesc REF SCDesc,
+                                             ISwapChain**            ppSwapChain) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IEngineFactoryNull_CreateDeviceAndContextsNull(This, ...) CALL_IFACE_METHOD(EngineFactoryNull, CreateDeviceAndContextsNull, This, __VA_ARGS__)
+#    define IEngineFactoryNull_CreateSwapChainNull(This, ...)         CALL_IFACE_METHOD(EngineFactoryNull, CreateSwapChainNull,         This, __VA_ARGS__)
+
+// clang-format on
+
+#endif
+
+
+#if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+
+typedef struct IEngineFactoryNull* (*GetEngineFactoryNullType)();
+
+inline GetEngineFactoryNullType DILIGENT_GLOBAL_FUNCTION(LoadGraphicsEngineNull)()
+{
+    return (GetEngineFactoryNullType)LoadEngineDll("GraphicsEngineNull", "GetEngineFactoryNull");
+}
+
+#else
+
+API_QUALIFIER
+struct IEngineFactoryNull* DILIGENT_GLOBAL_FUNCTION(GetEngineFactoryNull)();
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <thread>
+
+#include "CommandQueueNullImpl.hpp"
+
+namespace Diligent
+{
+
+CommandQueueNullImpl::CommandQueueNullImpl(IReferenceCounters* pRefCounters,
+                                           Uint32              FenceLatencyMicroseconds) noexcept :
+    // clang-format off
+    TBase         {pRefCounters},
+    m_FenceLatency{FenceLatencyMicroseconds}
+// clang-format on
+{
+}
+
+CommandQueueNullImpl::~CommandQueueNullImpl()
+{
+    // Wait for all pending submissions to complete so that the release queues
+    // of the device observe consistent fence values.
+    WaitForIdle();
+}
+
+void CommandQueueNullImpl::UpdateCompletedFenceValue(ClockType::time_point Now)
+{
+    while (!m_PendingSubmissions.empty() && m_PendingSubmissions.front().CompletionTime <= Now)
+    {
+        m_LastCompletedFenceValue.store(m_PendingSubmissions.front().FenceValue);
+        m_PendingSubmissions.pop_front();
+    }
+}
+
+Uint64 CommandQueueNullImpl::GetCompletedFenceValue()
+{
+    if (m_FenceLatency.count() == 0)
+        return m_LastCompletedFenceValue.load();
+
+    std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+    UpdateCompletedFenceValue(ClockType::now());
+    return m_LastCompletedFenceValue.load();
+}
+
+Uint64 CommandQueueNullImpl::Submit(Uint32 NumCommands)
+{
+    std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+
+    // Increment the value before submitting the buffer to be overly safe
+    const Uint64 FenceValue = m_NextFenceValue.fetch_add(1);
+    m_SubmittedCommandCount.fetch_add(NumCommands);
+
+    if (m_FenceLatency.count() == 0)
+    {
+        // Submissions complete immediately
+        m_LastCompletedFenceValue.store(FenceValue);
+    }
+    else
+    {
+        m_PendingSubmissions.push_back({FenceValue, ClockType::now() + m_FenceLatency});
+    }
+
+    return FenceValue;
+}
+
+Uint64 CommandQueueNullImpl::WaitForIdle()
+{
+    std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+    if (!m_PendingSubmissions.empty())
+    {
+        std::this_thread::sleep_until(m_PendingSubmissions.back().CompletionTime);
+        UpdateCompletedFenceValue(ClockType::now());
+        VERIFY_EXPR(m_PendingSubmissions.empty());
+    }
+
+    const Uint64 LastSubmittedFenceValue = m_NextFenceValue.load() - 1;
+    VERIFY_EXPR(m_LastCompletedFenceValue.load() == LastSubmittedFenceValue);
+    return LastSubmittedFenceValue;
+}
+
+} // namespace Diligent
@@ -0,0 +1,1143 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <cstring>
+
+#include "DeviceContextNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "ShaderResourceCacheNull.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+NODISCARD inline bool ResourceStateHasWriteAccess(RESOURCE_STATE State)
+{
+    static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
+    constexpr RESOURCE_STATE WriteAccessStates =
+        RESOURCE_STATE_RENDER_TARGET |
+        RESOURCE_STATE_UNORDERED_ACCESS |
+        RESOURCE_STATE_COPY_DEST |
+        RESOURCE_STATE_RESOLVE_DEST |
+        RESOURCE_STATE_BUILD_AS_WRITE;
+
+    return State & WriteAccessStates;
+}
+
+} // namespace
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+DeviceContextNullImpl::~DeviceContextNullImpl()
+{
+    if (m_NumCommands != 0)
+    {
+        if (IsDeferred())
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred context #", GetContextId(),
+                              " being destroyed, which indicates that FinishCommandList() has not been called.");
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate context being destroyed, "
+                              "which indicates the context has not been Flush()'ed.");
+        }
+    }
+
+    if (!IsDeferred())
+    {
+        Flush();
+    }
+
+    // For deferred contexts, m_SubmittedBuffersCmdQueueMask is reset to 0 after every call to FinishFrame().
+    // In this case there are no resources to release, so there will be no issues.
+    FinishFrame();
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "Immediate context id (", ImmediateContextId, ") is out of range");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    RefCntAutoPtr<PipelineStateNullImpl> pPipelineStateNull{pPipelineState, PipelineStateNullImpl::IID_InternalImpl};
+    VERIFY(pPipelineState == nullptr || pPipelineStateNull != nullptr, "Unknown pipeline state object implementation");
+    if (PipelineStateNullImpl::IsSameObject(m_pPipelineState, pPipelineStateNull))
+        return;
+
+    TDeviceContextBase::SetPipelineState(std::move(pPipelineStateNull), 0 /*Dummy*/);
+    ++m_NumCommands;
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(m_BindInfo, DvpCompatibleSRBCount);
+    // Commit all SRBs when PSO changes
+    m_BindInfo.StaleSRBMask |= m_BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass.");
+
+    ShaderResourceBindingNullImpl* pResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    ShaderResourceCacheNull&       ResourceCache   = pResBindingNull->GetResourceCache();
+
+    ResourceCache.TransitionResources<false>(this);
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                  RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    ShaderResourceBindingNullImpl* pResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    ShaderResourceCacheNull&       ResourceCache   = pResBindingNull->GetResourceCache();
+    if (ResourceCache.GetSize() == 0)
+    {
+        // Ignore SRBs that contain no resources
+        return;
+    }
+
+#ifdef DILIGENT_DEBUG
+    ResourceCache.DbgVerifyDynamicBuffersCounter();
+#endif
+
+    if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        ResourceCache.TransitionResources<false>(this);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        ResourceCache.TransitionResources<true>(this);
+    }
+#endif
+
+    m_BindInfo.Set(pResBindingNull->GetBindingIndex(), pResBindingNull);
+}
+
+void DeviceContextNullImpl::CommitSRBs(Uint32 CommitMask)
+{
+    VERIFY(CommitMask != 0, "This method should not be called when there is nothing to commit");
+
+    // Committed SRBs are no longer stale
+    m_BindInfo.StaleSRBMask &= ~static_cast<CommittedShaderResources::SRBMaskType>(CommitMask);
+
+    while (CommitMask != 0)
+    {
+        const Uint32 SRBBit = ExtractLSB(CommitMask);
+        const Uint32 SRBInd = PlatformMisc::GetLSB(SRBBit);
+        VERIFY_EXPR(m_BindInfo.ResourceCaches[SRBInd] != nullptr);
+        (void)SRBInd;
+
+        // Every SRB is bound by a separate command
+        ++m_NumCommands;
+    }
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources()
+{
+    if (m_BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(m_BindInfo);
+
+    const Uint32 SignCount = m_pPipelineState->GetResourceSignatureCount();
+    for (Uint32 i = 0; i < SignCount; ++i)
+    {
+        const PipelineResourceSignatureNullImpl* pSign = m_pPipelineState->GetResourceSignature(i);
+        if (pSign == nullptr || pSign->GetTotalResourceCount() == 0)
+            continue; // Skip null and empty signatures
+
+        VERIFY(i == pSign->GetDesc().BindingIndex, "Resource signature index mismatch");
+
+        // Missing SRBs are reported by DvpVerifySRBCompatibility
+        if (const ShaderResourceCacheNull* pResourceCache = m_BindInfo.ResourceCaches[i])
+            pSign->DvpValidateCommittedResources(*pResourceCache);
+    }
+
+    m_BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    if (m_NumCommands != 0)
+        LOG_WARNING_MESSAGE("Invalidating context that has outstanding commands in it. Call Flush() to submit commands for execution");
+
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo = {};
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    for (Uint32 Buff = 0; Buff < m_NumVertexStreams; ++Buff)
+    {
+        if (BufferNullImpl* pBufferNull = m_VertexStreams[Buff].pBuffer.RawPtr())
+        {
+            TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER,
+                                          "Setting vertex buffers (DeviceContextNullImpl::SetVertexBuffers)");
+        }
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                           Uint64                         ByteOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    if (m_pIndexBuffer)
+    {
+        TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER,
+                                      "Binding buffer as index buffer (DeviceContextNullImpl::SetIndexBuffer)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32          NumViewports,
+                                         const Viewport* pViewports,
+                                         Uint32          RTWidth,
+                                         Uint32          RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+    {
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+        {
+            if (TextureViewNullImpl* pRTView = m_pBoundRenderTargets[rt])
+            {
+                TransitionOrVerifyTextureState(*pRTView->GetTexture<TextureNullImpl>(), Attribs.StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                               "Setting render targets (DeviceContextNullImpl::SetRenderTargetsExt)");
+            }
+        }
+
+        if (m_pBoundDepthStencil)
+        {
+            const RESOURCE_STATE NewState = m_pBoundDepthStencil->GetDesc().ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL ?
+                RESOURCE_STATE_DEPTH_READ :
+                RESOURCE_STATE_DEPTH_WRITE;
+            TransitionOrVerifyTextureState(*m_pBoundDepthStencil->GetTexture<TextureNullImpl>(), Attribs.StateTransitionMode, NewState,
+                                           "Setting depth-stencil buffer (DeviceContextNullImpl::SetRenderTargetsExt)");
+        }
+
+        ++m_NumCommands;
+        SetViewports(1, nullptr, 0, 0);
+    }
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+    ++m_NumCommands;
+
+    // Set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
+        DvpVerifyRenderTargets();
+
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        for (Uint32 slot = 0; slot < m_NumVertexStreams; ++slot)
+        {
+            if (const BufferNullImpl* pBufferNull = m_VertexStreams[slot].pBuffer.RawPtr())
+            {
+                DvpVerifyBufferState(*pBufferNull, RESOURCE_STATE_VERTEX_BUFFER, "Using vertex buffers (DeviceContextNullImpl::Draw)");
+            }
+        }
+    }
+#endif
+
+    if (Uint32 CommitMask = m_BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
+    {
+        CommitSRBs(CommitMask);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
+{
+    PrepareForDraw(Flags);
+
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        DvpVerifyBufferState(*m_pIndexBuffer, RESOURCE_STATE_INDEX_BUFFER, "Indexed draw call (DeviceContextNullImpl::Draw)");
+    }
+#endif
+    DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
+}
+
+void DeviceContextNullImpl::PrepareForDispatchCompute()
+{
+    if (Uint32 CommitMask = m_BindInfo.GetCommitMask())
+    {
+        CommitSRBs(CommitMask);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForIndirectCommand(IBuffer* pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode)
+{
+    DEV_CHECK_ERR(pAttribsBuffer != nullptr, "Indirect command attribs buffer must not be null");
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(pAttribsBuffer), TransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT,
+                                  "Indirect command (DeviceContextNullImpl::PrepareForIndirectCommand)");
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    TDeviceContextBase::Draw(Attribs, 0);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDraw(Attribs, 0);
+
+    PrepareForDraw(Attribs.Flags);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        if (Attribs.pDrawItems[i].NumVertices > 0)
+            ++m_NumCommands;
+    }
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexed(Attribs, 0);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    if (Attribs.NumInstances == 0)
+        return;
+
+    for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+    {
+        if (Attribs.pDrawItems[i].NumIndices > 0)
+            ++m_NumCommands;
+    }
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndirect(Attribs, 0);
+
+    // State transitions must be performed before the draw command, as in other backends
+    PrepareForIndirectCommand(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode);
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareForIndirectCommand(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode);
+
+    PrepareForDraw(Attribs.Flags);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
+
+    PrepareForIndirectCommand(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode);
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareForIndirectCommand(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode);
+
+    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMesh is not supported in null backend");
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("DrawMeshIndirect is not supported in null backend");
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchCompute(Attribs, 0);
+
+    PrepareForDispatchCompute();
+
+    if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
+
+    PrepareForIndirectCommand(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode);
+    PrepareForDispatchCompute();
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+
+    TextureViewNullImpl* pViewNull = ClassPtrCast<TextureViewNullImpl>(pView);
+    if (m_pActiveRenderPass == nullptr)
+    {
+        TransitionOrVerifyTextureState(*pViewNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_DEPTH_WRITE,
+                                       "Clearing depth-stencil buffer (DeviceContextNullImpl::ClearDepthStencil)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView*                  pView,
+                                              const void*                    RGBA,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+
+    TextureViewNullImpl* pViewNull = ClassPtrCast<TextureViewNullImpl>(pView);
+    if (m_pActiveRenderPass == nullptr)
+    {
+        TransitionOrVerifyTextureState(*pViewNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                       "Clearing render target (DeviceContextNullImpl::ClearRenderTarget)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    BufferNullImpl* pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    DEV_CHECK_ERR(pBufferNull->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
+
+    TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                  "Updating buffer (DeviceContextNullImpl::UpdateBuffer)");
+
+    if (Uint8* pCPUData = pBufferNull->GetCPUData())
+        memcpy(pCPUData + Offset, pData, StaticCast<size_t>(Size));
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    BufferNullImpl* pSrcBufferNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    BufferNullImpl* pDstBufferNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+
+    DEV_CHECK_ERR(pDstBufferNull->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be copy destinations");
+
+    TransitionOrVerifyBufferState(*pSrcBufferNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::CopyBuffer)");
+    TransitionOrVerifyBufferState(*pDstBufferNull, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Using buffer as copy destination (DeviceContextNullImpl::CopyBuffer)");
+
+    // Contents is only preserved when both buffers keep their data in system memory
+    Uint8* pSrcData = pSrcBufferNull->GetCPUData();
+    Uint8* pDstData = pDstBufferNull->GetCPUData();
+    if (pSrcData != nullptr && pDstData != nullptr)
+        memmove(pDstData + DstOffset, pSrcData + SrcOffset, StaticCast<size_t>(Size));
+
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    BufferNullImpl*   pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    const BufferDesc& BuffDesc    = pBufferNull->GetDesc();
+
+    pMappedData = pBufferNull->GetCPUData();
+    if (pMappedData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to map buffer '", BuffDesc.Name, "': ", GetUsageString(BuffDesc.Usage),
+                          " buffers without CPU access flags can't be mapped");
+    }
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(SubresData.pSrcBuffer), SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE,
+                                      "Using buffer as copy source (DeviceContextNullImpl::UpdateTexture)");
+    }
+    TransitionOrVerifyTextureState(*ClassPtrCast<TextureNullImpl>(pTexture), TextureStateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                   "Updating texture (DeviceContextNullImpl::UpdateTexture)");
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    TransitionOrVerifyTextureState(*ClassPtrCast<TextureNullImpl>(CopyAttribs.pSrcTexture), CopyAttribs.SrcTextureTransitionMode, RESOURCE_STATE_COPY_SOURCE,
+                                   "Using texture as copy source (DeviceContextNullImpl::CopyTexture)");
+    TransitionOrVerifyTextureState(*ClassPtrCast<TextureNullImpl>(CopyAttribs.pDstTexture), CopyAttribs.DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                   "Using texture as copy destination (DeviceContextNullImpl::CopyTexture)");
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    TextureNullImpl&            TextureNull = *ClassPtrCast<TextureNullImpl>(pTexture);
+    const TextureDesc&          TexDesc     = TextureNull.GetDesc();
+    const TextureFormatAttribs& FmtAttribs  = GetTextureFormatAttribs(TexDesc.Format);
+
+    Box FullExtentBox;
+    if (pMapRegion == nullptr)
+    {
+        const MipLevelProperties MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
+
+        FullExtentBox.MaxX = MipLevelAttribs.LogicalWidth;
+        FullExtentBox.MaxY = MipLevelAttribs.LogicalHeight;
+        FullExtentBox.MaxZ = MipLevelAttribs.Depth;
+        pMapRegion         = &FullExtentBox;
+    }
+
+    if (TexDesc.Usage == USAGE_DYNAMIC)
+    {
+        if (MapType != MAP_WRITE)
+        {
+            LOG_ERROR("Dynamic textures can be mapped for writing only");
+            MappedData = MappedTextureSubresource{};
+            return;
+        }
+
+        const BufferToTextureCopyInfo CopyInfo = GetBufferToTextureCopyInfo(TexDesc.Format, *pMapRegion, TextureNullImpl::StagingDataAlignment);
+
+        auto it = m_MappedTextures.emplace(MappedTextureKey{&TextureNull, MipLevel, ArraySlice}, std::vector<Uint8>{});
+        if (!it.second)
+            LOG_ERROR_MESSAGE("Mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", TexDesc.Name, "' has already been mapped");
+
+        std::vector<Uint8>& Data = it.first->second;
+        Data.resize(StaticCast<size_t>(CopyInfo.MemorySize));
+
+        MappedData.pData       = Data.data();
+        MappedData.Stride      = CopyInfo.RowStride;
+        MappedData.DepthStride = CopyInfo.DepthStride;
+    }
+    else if (TexDesc.Usage == USAGE_STAGING)
+    {
+        const Uint64             SubresourceOffset = TextureNull.GetSubresourceOffset(MipLevel, ArraySlice);
+        const MipLevelProperties MipLevelAttribs   = GetMipLevelProperties(TexDesc, MipLevel);
+
+        const Uint64 MapStartOffset = SubresourceOffset +
+            // For compressed-block formats, RowSize is the size of one compressed row.
+            // For non-compressed formats, BlockHeight is 1.
+            (pMapRegion->MinZ * MipLevelAttribs.StorageHeight + pMapRegion->MinY) / FmtAttribs.BlockHeight * MipLevelAttribs.RowSize +
+            // For non-compressed formats, BlockWidth is 1.
+            pMapRegion->MinX / FmtAttribs.BlockWidth * Uint64{FmtAttribs.GetElementSize()};
+
+        MappedData.pData       = TextureNull.GetCPUData() + MapStartOffset;
+        MappedData.Stride      = MipLevelAttribs.RowSize;
+        MappedData.DepthStride = MipLevelAttribs.DepthSliceSize;
+
+        DEV_CHECK_ERR(MapType != MAP_READ || (TexDesc.CPUAccessFlags & CPU_ACCESS_READ), "Texture '", TexDesc.Name, "' was not created with CPU_ACCESS_READ flag and can't be mapped for reading");
+        DEV_CHECK_ERR(MapType != MAP_WRITE || (TexDesc.CPUAccessFlags & CPU_ACCESS_WRITE), "Texture '", TexDesc.Name, "' was not created with CPU_ACCESS_WRITE flag and can't be mapped for writing");
+    }
+    else
+    {
+        UNSUPPORTED(GetUsageString(TexDesc.Usage), " textures cannot be mapped in null backend");
+    }
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+
+    TextureNullImpl&   TextureNull = *ClassPtrCast<TextureNullImpl>(pTexture);
+    const TextureDesc& TexDesc     = TextureNull.GetDesc();
+
+    if (TexDesc.Usage == USAGE_DYNAMIC)
+    {
+        auto it = m_MappedTextures.find(MappedTextureKey{&TextureNull, MipLevel, ArraySlice});
+        if (it != m_MappedTextures.end())
+        {
+            // Other backends copy the data into the texture
+            TransitionOrVerifyTextureState(TextureNull, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_COPY_DEST,
+                                           "Unmapping texture (DeviceContextNullImpl::UnmapTextureSubresource)");
+            ++m_NumCommands;
+            m_MappedTextures.erase(it);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to unmap mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", TexDesc.Name, "'. The texture has either been unmapped already or has not been mapped");
+        }
+    }
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull{NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this, m_NumCommands)};
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    m_NumCommands    = 0;
+    m_pPipelineState = nullptr;
+
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    Flush(NumCommandLists, ppCommandLists);
+
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    m_SignalFences.emplace_back(Value, ClassPtrCast<FenceNullImpl>(pFence));
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+    // Commands are never executed, so there is nothing to wait for
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+    Flush();
+    m_pDevice->IdleCommandQueue(GetCommandQueueId(), true);
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+
+    const QUERY_TYPE QueryType = pQuery->GetDesc().Type;
+    if (QueryType != QUERY_TYPE_TIMESTAMP && QueryType != QUERY_TYPE_DURATION)
+        ++m_ActiveQueriesCounter;
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+
+    const QUERY_TYPE QueryType = pQuery->GetDesc().Type;
+    if (QueryType != QUERY_TYPE_TIMESTAMP && QueryType != QUERY_TYPE_DURATION)
+    {
+        VERIFY(m_ActiveQueriesCounter > 0, "Active query counter is 0 which means there was a mismatch between BeginQuery() / EndQuery() calls");
+        --m_ActiveQueriesCounter;
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    Flush(0, nullptr);
+}
+
+void DeviceContextNullImpl::Flush(Uint32               NumCommandLists,
+                                  ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+
+#ifdef DILIGENT_DEVELOPMENT
+    DEV_CHECK_ERR(m_DvpDebugGroupCount == 0, "Not all debug groups have been ended");
+    m_DvpDebugGroupCount = 0;
+#endif
+
+    Uint32 NumCommands = m_NumCommands;
+
+    std::vector<RefCntAutoPtr<DeviceContextNullImpl>> DeferredCtxs;
+    DeferredCtxs.reserve(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        CommandListNullImpl* pCmdListNull = ClassPtrCast<CommandListNullImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListNull != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListNull->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListNull->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+
+        Uint32 NumListCommands = 0;
+        DeferredCtxs.emplace_back();
+        pCmdListNull->Close(DeferredCtxs.back(), NumListCommands);
+        VERIFY_EXPR(DeferredCtxs.back() != nullptr);
+        NumCommands += NumListCommands;
+    }
+
+    // Submit command buffer even if there are no commands to release stale resources.
+    const auto SubmittedCmdBuffInfo = m_pDevice->SubmitCommandBuffer(GetCommandQueueId(), true, NumCommands);
+
+    for (auto& val_fence : m_SignalFences)
+    {
+        val_fence.second->EnqueueSignal(GetCommandQueueId(), SubmittedCmdBuffInfo.FenceValue, val_fence.first);
+    }
+    m_SignalFences.clear();
+
+    for (RefCntAutoPtr<DeviceContextNullImpl>& pDeferredCtx : DeferredCtxs)
+    {
+        // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
+        pDeferredCtx->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+    }
+
+    m_NumCommands       = 0;
+    m_BindInfo          = {};
+    m_pPipelineState    = nullptr;
+    m_pActiveRenderPass = nullptr;
+    m_pBoundFramebuffer = nullptr;
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in null backend");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported in null backend");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported in null backend");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported in null backend");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported in null backend");
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+
+    TextureViewNullImpl* pTexViewNull = ClassPtrCast<TextureViewNullImpl>(pTexView);
+    TransitionOrVerifyTextureState(*pTexViewNull->GetTexture<TextureNullImpl>(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_SHADER_RESOURCE,
+                                   "Generating mipmaps (DeviceContextNullImpl::GenerateMips)");
+
+    // Other backends record one blit or dispatch per mip level
+    const TextureViewDesc& ViewDesc = pTexViewNull->GetDesc();
+    m_NumCommands += ViewDesc.NumMipLevels > 1 ? ViewDesc.NumMipLevels - 1 : 0;
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    if (GetNumCommandsInCtx() != 0)
+    {
+        if (IsDeferred())
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred device context #", GetContextId(),
+                              " when finishing the frame. This is an error and may cause unpredicted behaviour."
+                              " Close all deferred contexts and execute them before finishing the frame.");
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate device context when finishing the frame."
+                              " This is an error and may cause unpredicted behaviour. Call Flush() to submit all commands"
+                              " for execution before finishing the frame.");
+        }
+    }
+
+    if (m_ActiveQueriesCounter > 0)
+    {
+        LOG_ERROR_MESSAGE("There are ", m_ActiveQueriesCounter,
+                          " active queries in the device context when finishing the frame. "
+                          "All queries must be ended before the frame is finished.");
+    }
+
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+    }
+
+    if (!m_MappedTextures.empty())
+        LOG_ERROR_MESSAGE("There are mapped textures in the device context when finishing the frame. All dynamic resources must be used in the same frame in which they are mapped.");
+
+    EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const StateTransitionDesc& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        {
+            // Skip begin-split barriers
+            VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            continue;
+        }
+
+        if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
+        {
+            ++m_NumCommands;
+            continue;
+        }
+
+        VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
+
+        const bool UpdateState = (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0;
+        if (RefCntAutoPtr<TextureNullImpl> pTexture{Barrier.pResource, TextureNullImpl::IID_InternalImpl})
+        {
+            // Subresource ranges are not tracked: the state applies to the whole texture
+            TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else if (RefCntAutoPtr<BufferNullImpl> pBuffer{Barrier.pResource, BufferNullImpl::IID_InternalImpl})
+        {
+            TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, UpdateState);
+        }
+        else
+        {
+            UNEXPECTED("unsupported resource type");
+        }
+    }
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    TransitionOrVerifyTextureState(*ClassPtrCast<TextureNullImpl>(pSrcTexture), ResolveAttribs.SrcTextureTransitionMode, RESOURCE_STATE_RESOLVE_SOURCE,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    TransitionOrVerifyTextureState(*ClassPtrCast<TextureNullImpl>(pDstTexture), ResolveAttribs.DstTextureTransitionMode, RESOURCE_STATE_RESOLVE_DEST,
+                                   "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::TransitionTextureState(TextureNullImpl& TextureNull,
+                                                   RESOURCE_STATE   OldState,
+                                                   RESOURCE_STATE   NewState,
+                                                   bool             UpdateTextureState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (TextureNull.IsInKnownState())
+        {
+            OldState = TextureNull.GetState();
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to transition the state of texture '", TextureNull.GetDesc().Name, "' because the state is unknown and is not explicitly specified.");
+            return;
+        }
+    }
+    else
+    {
+        if (TextureNull.IsInKnownState() && TextureNull.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(TextureNull.GetState()), " of texture '",
+                              TextureNull.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+    }
+
+    // Always add barrier after writes.
+    const bool AfterWrite = ResourceStateHasWriteAccess(OldState);
+    if (((OldState & NewState) != NewState) || AfterWrite)
+    {
+        // Other backends record a barrier command
+        ++m_NumCommands;
+        if (UpdateTextureState)
+            TextureNull.SetState(NewState);
+    }
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                                           RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                           RESOURCE_STATE                 RequiredState,
+                                                           const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Texture.IsInKnownState())
+        {
+            TransitionTextureState(Texture, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+        }
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTextureState(Texture, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionBufferState(BufferNullImpl& BufferNull, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (BufferNull.IsInKnownState())
+        {
+            OldState = BufferNull.GetState();
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to transition the state of buffer '", BufferNull.GetDesc().Name, "' because the buffer state is unknown and is not explicitly specified");
+            return;
+        }
+    }
+    else
+    {
+        if (BufferNull.IsInKnownState() && BufferNull.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(BufferNull.GetState()), " of buffer '",
+                              BufferNull.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+    }
+
+    // Always add barrier after writes.
+    const bool AfterWrite = ResourceStateHasWriteAccess(OldState);
+    if (((OldState & NewState) != NewState) || AfterWrite)
+    {
+        // Other backends record a barrier command
+        ++m_NumCommands;
+        if (UpdateBufferState)
+            BufferNull.SetState(NewState);
+    }
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                          RESOURCE_STATE                 RequiredState,
+                                                          const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Buffer.IsInKnownState())
+        {
+            TransitionBufferState(Buffer, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+        }
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBufferState(Buffer, RequiredState, OperationName);
+    }
+#endif
+}
+
+} // namespace Diligent
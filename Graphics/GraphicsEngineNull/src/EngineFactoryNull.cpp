@@ -0,0 +1,391 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+/// \file
+/// Routines that initialize null-based engine implementation
+
+#include "pch.h"
+
+#include <cstring>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+#include "EngineFactoryBase.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "SwapChainNullImpl.hpp"
+#include "CommandQueueNullImpl.hpp"
+
+namespace Diligent
+{
+
+/// Engine factory for null implementation
+class EngineFactoryNullImpl final : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase;
+
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull}
+    {}
+
+    void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppContexts) override final;
+
+    void DILIGENT_CALL_TYPE CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                IDeviceContext*      pImmediateContext,
+                                                const SwapChainDesc& SCDesc,
+                                                ISwapChain**         ppSwapChain) override final;
+};
+
+namespace
+{
+
+GraphicsAdapterInfo GetNullAdapterInfo()
+{
+    GraphicsAdapterInfo AdapterInfo;
+
+    // Set graphics adapter properties
+    {
+        static constexpr char Description[] = "Diligent null adapter";
+        static_assert(sizeof(Description) <= sizeof(AdapterInfo.Description), "Adapter description is too long");
+        memcpy(AdapterInfo.Description, Description, sizeof(Description));
+
+        AdapterInfo.Type       = ADAPTER_TYPE_SOFTWARE;
+        AdapterInfo.Vendor     = ADAPTER_VENDOR_UNKNOWN;
+        AdapterInfo.NumOutputs = 0;
+    }
+
+    // Enable features
+    {
+        DeviceFeatures& Features{AdapterInfo.Features};
+        Features.SeparablePrograms             = DEVICE_FEATURE_STATE_ENABLED;
+        Features.WireframeFill                 = DEVICE_FEATURE_STATE_ENABLED;
+        Features.MultithreadedResourceCreation = DEVICE_FEATURE_STATE_ENABLED;
+        Features.ComputeShaders                = DEVICE_FEATURE_STATE_ENABLED;
+        Features.GeometryShaders               = DEVICE_FEATURE_STATE_ENABLED;
+        Features.Tessellation                  = DEVICE_FEATURE_STATE_ENABLED;
+        Features.OcclusionQueries              = DEVICE_FEATURE_STATE_ENABLED;
+        Features.BinaryOcclusionQueries        = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TimestampQueries              = DEVICE_FEATURE_STATE_ENABLED;
+        Features.PipelineStatisticsQueries     = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DurationQueries               = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DepthBiasClamp                = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DepthClamp                    = DEVICE_FEATURE_STATE_ENABLED;
+        Features.IndependentBlend              = DEVICE_FEATURE_STATE_ENABLED;
+        Features.DualSourceBlend               = DEVICE_FEATURE_STATE_ENABLED;
+        Features.MultiViewport                 = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureCompressionBC          = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureCompressionETC2        = DEVICE_FEATURE_STATE_ENABLED;
+        Features.PixelUAVWritesAndAtomics      = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureUAVExtendedFormats     = DEVICE_FEATURE_STATE_ENABLED;
+        Features.ShaderResourceStaticArrays    = DEVICE_FEATURE_STATE_ENABLED;
+        Features.InstanceDataStepRate          = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureComponentSwizzle       = DEVICE_FEATURE_STATE_ENABLED;
+        Features.TextureSubresourceViews       = DEVICE_FEATURE_STATE_ENABLED;
+        Features.AsyncShaderCompilation        = DEVICE_FEATURE_STATE_ENABLED;
+        Features.FormattedBuffers              = DEVICE_FEATURE_STATE_ENABLED;
+
+        // Shaders are not compiled, so there is no reflection information
+        Features.ShaderResourceQueries = DEVICE_FEATURE_STATE_DISABLED;
+
+        // Ray tracing, mesh shaders, sparse resources and variable rate shading are not implemented
+        Features.MeshShaders         = DEVICE_FEATURE_STATE_DISABLED;
+        Features.RayTracing          = DEVICE_FEATURE_STATE_DISABLED;
+        Features.SparseResources     = DEVICE_FEATURE_STATE_DISABLED;
+        Features.VariableRateShading = DEVICE_FEATURE_STATE_DISABLED;
+    }
+    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+
+    // Set memory properties
+    {
+        AdapterInfo.Memory.UnifiedMemoryCPUAccess = CPU_ACCESS_NONE;
+        AdapterInfo.Memory.UnifiedMemory          = 0;
+    }
+
+    // Draw command properties
+    {
+        DrawCommandProperties& DrawCommandInfo = AdapterInfo.DrawCommand;
+        DrawCommandInfo.MaxDrawIndirectCount   = ~0u;
+        DrawCommandInfo.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_BASE_VERTEX;
+        DrawCommandInfo.MaxIndexValue = ~0u;
+    }
+
+    // Set queue info: a single graphics queue that can be shared by all immediate contexts
+    {
+        AdapterInfo.NumQueues = 1;
+
+        CommandQueueInfo& QueueInfo         = AdapterInfo.Queues[0];
+        QueueInfo.QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+        QueueInfo.MaxDeviceContexts         = MAX_COMMAND_QUEUES - 1;
+        QueueInfo.TextureCopyGranularity[0] = 1;
+        QueueInfo.TextureCopyGranularity[1] = 1;
+        QueueInfo.TextureCopyGranularity[2] = 1;
+    }
+
+    // Set compute shader info
+    {
+        ComputeShaderProperties& ComputeShaderInfo = AdapterInfo.ComputeShader;
+
+        ComputeShaderInfo.SharedMemorySize          = 32768;
+        ComputeShaderInfo.MaxThreadGroupInvocations = 1024;
+
+        ComputeShaderInfo.MaxThreadGroupSizeX = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeY = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeZ = 64;
+
+        ComputeShaderInfo.MaxThreadGroupCountX = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountY = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountZ = 65535;
+    }
+
+    // Set texture info
+    {
+        TextureProperties& TextureInfo = AdapterInfo.Texture;
+
+        TextureInfo.MaxTexture1DDimension      = 16384;
+        TextureInfo.MaxTexture1DArraySlices    = 2048;
+        TextureInfo.MaxTexture2DDimension      = 16384;
+        TextureInfo.MaxTexture2DArraySlices    = 2048;
+        TextureInfo.MaxTexture3DDimension      = 2048;
+        TextureInfo.MaxTextureCubeDimension    = 16384;
+        TextureInfo.Texture2DMSSupported       = True;
+        TextureInfo.Texture2DMSArraySupported  = True;
+        TextureInfo.TextureViewSupported       = True;
+        TextureInfo.CubemapArraysSupported     = True;
+        TextureInfo.TextureView2DOn3DSupported = True;
+    }
+
+    // Set buffer info
+    {
+        BufferProperties& BufferInfo = AdapterInfo.Buffer;
+
+        BufferInfo.ConstantBufferOffsetAlignment   = 256;
+        BufferInfo.StructuredBufferOffsetAlignment = 16;
+    }
+
+    // Set sampler info
+    {
+        SamplerProperties& SamplerInfo = AdapterInfo.Sampler;
+
+        SamplerInfo.BorderSamplingModeSupported = True;
+        SamplerInfo.MaxAnisotropy               = 16;
+        SamplerInfo.LODBiasSupported            = True;
+    }
+
+    return AdapterInfo;
+}
+
+} // namespace
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+        NumAdapters = 1;
+    else
+    {
+        NumAdapters = (std::min)(NumAdapters, 1u);
+        if (NumAdapters > 0)
+            Adapters[0] = GetNullAdapterInfo();
+    }
+}
+
+void EngineFactoryNullImpl::CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const
+{
+    UNSUPPORTED("Dearchiver is not supported in null backend");
+    if (ppDearchiver != nullptr)
+        *ppDearchiver = nullptr;
+}
+
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineNullCreateInfo& EngineCI,
+                                                        IRenderDevice**             ppDevice,
+                                                        IDeviceContext**            ppContexts)
+{
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
+        return;
+
+    ImmediateContextCreateInfo DefaultImmediateCtxCI;
+
+    const Uint32                            NumImmediateContexts  = EngineCI.NumImmediateContexts > 0 ? EngineCI.NumImmediateContexts : 1;
+    const ImmediateContextCreateInfo* const pImmediateContextInfo = EngineCI.NumImmediateContexts > 0 ? EngineCI.pImmediateContextInfo : &DefaultImmediateCtxCI;
+
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (size_t{NumImmediateContexts} + size_t{EngineCI.NumDeferredContexts}));
+
+    try
+    {
+        const GraphicsAdapterInfo AdapterInfo = GetNullAdapterInfo();
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        SetRawAllocator(EngineCI.pRawMemAllocator);
+        IMemoryAllocator& RawMemAllocator = GetRawAllocator();
+
+        // Every immediate context has its own command queue
+        std::vector<RefCntAutoPtr<CommandQueueNullImpl>> CommandQueues{NumImmediateContexts};
+        std::vector<ICommandQueueNull*>                  ppCommandQueues(NumImmediateContexts);
+        for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
+        {
+            CommandQueues[CtxInd]   = NEW_RC_OBJ(RawMemAllocator, "CommandQueueNull instance", CommandQueueNullImpl)(EngineCI.FenceLatencyMicroseconds);
+            ppCommandQueues[CtxInd] = CommandQueues[CtxInd];
+        }
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RawMemAllocator, this, EngineCI, AdapterInfo, ppCommandQueues.size(), ppCommandQueues.data()) //
+        };
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+
+        for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
+        {
+            const Uint8 QueueId = pImmediateContextInfo[CtxInd].QueueId;
+
+            RefCntAutoPtr<DeviceContextNullImpl> pImmediateCtxNull{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        pImmediateContextInfo[CtxInd].Name,
+                        AdapterInfo.Queues[QueueId].QueueType,
+                        false,   // IsDeferred
+                        CtxInd,  // Context id
+                        QueueId} //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pImmediateCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + CtxInd));
+            pRenderDeviceNull->SetImmediateContext(CtxInd, pImmediateCtxNull);
+        }
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            RefCntAutoPtr<DeviceContextNullImpl> pDeferredCtxNull{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        nullptr,
+                        COMMAND_QUEUE_TYPE_UNKNOWN,
+                        true,                              // IsDeferred
+                        NumImmediateContexts + DeferredCtx // Context id
+                    }                                      //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pDeferredCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + NumImmediateContexts + DeferredCtx));
+            pRenderDeviceNull->SetDeferredContext(DeferredCtx, pDeferredCtxNull);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+        for (Uint32 ctx = 0; ctx < NumImmediateContexts + EngineCI.NumDeferredContexts; ++ctx)
+        {
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
+        }
+
+        LOG_ERROR("Failed to create null render device and contexts");
+    }
+}
+
+void EngineFactoryNullImpl::CreateSwapChainNull(IRenderDevice*       pDevice,
+                                                IDeviceContext*      pImmediateContext,
+                                                const SwapChainDesc& SCDesc,
+                                                ISwapChain**         ppSwapChain)
+{
+    DEV_CHECK_ERR(ppSwapChain, "Null pointer provided");
+    if (!ppSwapChain)
+        return;
+
+    *ppSwapChain = nullptr;
+
+    try
+    {
+        RenderDeviceNullImpl*  pDeviceNull        = ClassPtrCast<RenderDeviceNullImpl>(pDevice);
+        DeviceContextNullImpl* pDeviceContextNull = ClassPtrCast<DeviceContextNullImpl>(pImmediateContext);
+        IMemoryAllocator&      RawMemAllocator    = GetRawAllocator();
+
+        SwapChainNullImpl* pSwapChainNull = NEW_RC_OBJ(RawMemAllocator, "SwapChainNullImpl instance", SwapChainNullImpl)(SCDesc, pDeviceNull, pDeviceContextNull);
+        pSwapChainNull->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppSwapChain)
+        {
+            (*ppSwapChain)->Release();
+            *ppSwapChain = nullptr;
+        }
+
+        LOG_ERROR("Failed to create null swap chain");
+    }
+}
+
+API_QUALIFIER IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    API_QUALIFIER Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
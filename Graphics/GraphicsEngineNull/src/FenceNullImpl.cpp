@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include <thread>
+
+#include "FenceNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+FenceNullImpl::FenceNullImpl(IReferenceCounters*   pRefCounters,
+                             RenderDeviceNullImpl* pDevice,
+                             const FenceDesc&      Desc) :
+    TFenceBase{pRefCounters, pDevice, Desc}
+{
+}
+
+FenceNullImpl::~FenceNullImpl() = default;
+
+Uint64 FenceNullImpl::GetCompletedValue()
+{
+    std::lock_guard<std::mutex> Lock{m_PendingSignalsMtx};
+    while (!m_PendingSignals.empty())
+    {
+        const PendingSignal& Signal = m_PendingSignals.front();
+        if (m_pDevice->GetCompletedFenceValue(Signal.QueueId) < Signal.QueueFenceValue)
+            break;
+
+        UpdateLastCompletedFenceValue(Signal.Value);
+        m_PendingSignals.pop_front();
+    }
+    return m_LastCompletedFenceValue.load();
+}
+
+void FenceNullImpl::Signal(Uint64 Value)
+{
+    DEV_CHECK_ERR(m_Desc.Type == FENCE_TYPE_GENERAL, "Fence must have been created with FENCE_TYPE_GENERAL");
+    DvpSignal(Value);
+    UpdateLastCompletedFenceValue(Value);
+}
+
+void FenceNullImpl::EnqueueSignal(SoftwareQueueIndex QueueId, Uint64 QueueFenceValue, Uint64 Value)
+{
+    DvpSignal(Value);
+
+    std::lock_guard<std::mutex> Lock{m_PendingSignalsMtx};
+    m_PendingSignals.push_back({QueueId, QueueFenceValue, Value});
+}
+
+void FenceNullImpl::Wait(Uint64 Value)
+{
+    // Command queues complete submissions after a fixed latency,
+    // so the wait is always finite.
+    while (GetCompletedValue() < Value)
+    {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,340 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), Desc, /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                CreateLayout();
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_TotalSRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+void PipelineResourceSignatureNullImpl::CreateLayout()
+{
+    // Resources are laid out in the SRB cache as follows:
+    //
+    //      | Immutable samplers | Static | Mutable | Dynamic |
+    //
+    // Note that resources in m_Desc.Resources are sorted by variable type
+
+    // The total number of static resources in all stages accounting for array sizes.
+    Uint32 StaticResourceCount = 0;
+
+    // Index of the immutable sampler for every sampler in m_Desc.Resources, or InvalidImmutableSamplerIndex.
+    std::vector<Uint32> ResourceToImmutableSamplerInd(m_Desc.NumResources, InvalidImmutableSamplerIndex);
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+
+        bool IsImmutableSampler = false;
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            // We only need to search for immutable samplers for SHADER_RESOURCE_TYPE_SAMPLER.
+            // For SHADER_RESOURCE_TYPE_TEXTURE_SRV, we will look for the assigned sampler and check if it is immutable.
+            const Uint32 SrcImmutableSamplerInd = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+            if (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex)
+            {
+                ResourceToImmutableSamplerInd[i] = SrcImmutableSamplerInd;
+                // One immutable sampler may be used by different arrays in different shader stages - use the maximum array size
+                ImmutableSamplerAttribsNull& DstImtblSampAttribs = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd];
+                DstImtblSampAttribs.ArraySize                    = std::max(DstImtblSampAttribs.ArraySize, ResDesc.ArraySize);
+
+                IsImmutableSampler = true;
+            }
+        }
+
+        if (!IsImmutableSampler && ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            StaticResourceCount += ResDesc.ArraySize;
+    }
+
+    VERIFY_EXPR((StaticResourceCount != 0) == (GetNumStaticResStages() != 0));
+    // Initialize static resource cache
+    if (StaticResourceCount != 0)
+    {
+        VERIFY_EXPR(m_pStaticResCache != nullptr);
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticResourceCount);
+    }
+
+    m_TotalSRBCacheSize = 0;
+
+    // Allocate immutable samplers first
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        ImmutableSamplerAttribsNull& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        ImtblSampAttribs.CacheOffset                  = m_TotalSRBCacheSize;
+        m_TotalSRBCacheSize += ImtblSampAttribs.ArraySize;
+    }
+
+    // Current offset in the static resource cache
+    Uint32 StaticCacheOffset = 0;
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        Uint32 AssignedSamplerInd     = ResourceAttribs::InvalidSamplerInd;
+        Uint32 SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            VERIFY_EXPR(SrcImmutableSamplerInd == InvalidImmutableSamplerIndex);
+            AssignedSamplerInd = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+            if (AssignedSamplerInd != ResourceAttribs::InvalidSamplerInd)
+            {
+                SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[AssignedSamplerInd];
+            }
+        }
+
+        const bool IsImmutableSampler = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+
+        Uint32 CacheOffset = ~0u;
+        if (IsImmutableSampler)
+        {
+            // Note that the same immutable sampler may be assigned to multiple sampler resources in different shader stages
+            CacheOffset = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd].CacheOffset;
+        }
+        else
+        {
+            CacheOffset = m_TotalSRBCacheSize;
+            m_TotalSRBCacheSize += ResDesc.ArraySize;
+        }
+
+        new (m_pResourceAttribs + i) ResourceAttribs{
+            AssignedSamplerInd,
+            ResDesc.ArraySize,
+            SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
+            CacheOffset,
+            (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsImmutableSampler) ? StaticCacheOffset : ~0u,
+        };
+
+        if (!IsImmutableSampler && ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+        {
+            m_pStaticResCache->InitializeResources(StaticCacheOffset, ResDesc.ArraySize, ResDesc.ResourceType,
+                                                   SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+            StaticCacheOffset += ResDesc.ArraySize;
+        }
+    }
+    VERIFY_EXPR(StaticCacheOffset == StaticResourceCount);
+
+#ifdef DILIGENT_DEBUG
+    if (m_pStaticResCache != nullptr)
+        m_pStaticResCache->DbgVerifyResourceInitialization();
+#endif
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    auto& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_TotalSRBCacheSize);
+
+    const Uint32                   TotalResources = GetTotalResourceCount();
+    const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
+    for (Uint32 r = 0; r < TotalResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers
+            continue;
+        }
+
+        ResourceCache.InitializeResources(Attr.CacheOffset(CacheType), ResDesc.ArraySize,
+                                          ResDesc.ResourceType, Attr.IsImmutableSamplerAssigned());
+    }
+
+    // Initialize immutable samplers
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsNull& ImtblSampAttr = m_pImmutableSamplerAttribs[i];
+        VERIFY_EXPR(ImtblSampAttr.IsAllocated());
+        VERIFY_EXPR(ImtblSampAttr.ArraySize > 0);
+        ResourceCache.InitializeResources(ImtblSampAttr.CacheOffset, ImtblSampAttr.ArraySize,
+                                          SHADER_RESOURCE_TYPE_SAMPLER, /*HasImmutableSampler = */ true);
+
+        if (const RefCntAutoPtr<SamplerNullImpl>& pSampler = m_pImmutableSamplers[i])
+        {
+            for (Uint32 elem = 0; elem < ImtblSampAttr.ArraySize; ++elem)
+            {
+                ResourceCache.SetResource(ImtblSampAttr.CacheOffset + elem, pSampler);
+            }
+        }
+    }
+
+#ifdef DILIGENT_DEBUG
+    ResourceCache.DbgVerifyResourceInitialization();
+#endif
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // In case of SRB, DstResourceCache contains static, mutable and dynamic resources.
+    // In case of Signature, DstResourceCache contains only static resources.
+    const ShaderResourceCacheNull&  SrcResourceCache = *m_pStaticResCache;
+    const std::pair<Uint32, Uint32> ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const ResourceCacheContentType  SrcCacheType     = SrcResourceCache.GetContentType();
+    const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers as they are initialized in InitSRBResourceCache()
+            continue;
+        }
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const Uint32                             SrcCacheOffset = Attr.CacheOffset(SrcCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& SrcCachedRes   = SrcResourceCache.GetResource(SrcCacheOffset);
+            IDeviceObject*                           pObject        = SrcCachedRes.pObject;
+            if (pObject == nullptr)
+            {
+                if (DstCacheType == ResourceCacheContentType::SRB)
+                    LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+                continue;
+            }
+
+            const Uint32                             DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& DstCachedRes   = const_cast<const ShaderResourceCacheNull&>(DstResourceCache).GetResource(DstCacheOffset);
+            VERIFY_EXPR(SrcCachedRes.Type == DstCachedRes.Type);
+
+            const IDeviceObject* pCachedResource = DstCachedRes.pObject;
+            if (pCachedResource != pObject)
+            {
+                DEV_CHECK_ERR(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset,
+                                             SrcCachedRes.pObject,
+                                             SrcCachedRes.BufferBaseOffset,
+                                             SrcCachedRes.BufferRangeSize);
+            }
+        }
+    }
+
+#ifdef DILIGENT_DEBUG
+    DstResourceCache.DbgVerifyDynamicBuffersCounter();
+#endif
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+bool PipelineResourceSignatureNullImpl::DvpValidateCommittedResources(const ShaderResourceCacheNull& ResourceCache) const
+{
+    // Shaders are not reflected in null backend, so every resource in the signature
+    // is considered to be used by the pipeline.
+    const ResourceCacheContentType CacheType = ResourceCache.GetContentType();
+
+    bool BindingsOK = true;
+    for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc    = m_Desc.Resources[r];
+        const ResourceAttribs&      ResAttribs = m_pResourceAttribs[r];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && ResAttribs.IsImmutableSamplerAssigned())
+            continue;
+
+        const Uint32 CacheOffset = ResAttribs.CacheOffset(CacheType);
+        for (Uint32 ArrIndex = 0; ArrIndex < ResDesc.ArraySize; ++ArrIndex)
+        {
+            const ShaderResourceCacheNull::Resource& Res = ResourceCache.GetResource(CacheOffset + ArrIndex);
+            if (!Res)
+            {
+                LOG_ERROR_MESSAGE("No resource is bound to variable '", GetShaderResourcePrintName(ResDesc, ArrIndex),
+                                  "' in pipeline resource signature '", m_Desc.Name, "'");
+                BindingsOK = false;
+                continue;
+            }
+
+            if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV && ResAttribs.IsCombinedWithSampler())
+            {
+                const PipelineResourceDesc& SamplerResDesc = GetResourceDesc(ResAttribs.SamplerInd);
+                const ResourceAttribs&      SamplerAttribs = GetResourceAttribs(ResAttribs.SamplerInd);
+                VERIFY_EXPR(SamplerResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER);
+                VERIFY_EXPR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == ResDesc.ArraySize);
+                if (ArrIndex < SamplerResDesc.ArraySize)
+                {
+                    const ShaderResourceCacheNull::Resource& Sam = ResourceCache.GetResource(SamplerAttribs.CacheOffset(CacheType) + ArrIndex);
+                    if (!Sam)
+                    {
+                        if (!SamplerAttribs.IsImmutableSamplerAssigned())
+                        {
+                            LOG_ERROR_MESSAGE("No sampler is bound to sampler variable '", GetShaderResourcePrintName(SamplerResDesc, ArrIndex),
+                                              "' combined with texture '", ResDesc.Name, "' in pipeline resource signature '", m_Desc.Name, "'.");
+                        }
+                        else
+                        {
+                            UNEXPECTED("Immutable sampler must have been initialized in InitSRBResourceCache(). This is likely a bug.");
+                        }
+                        BindingsOK = false;
+                    }
+                }
+            }
+        }
+    }
+
+    return BindingsOK;
+}
+#endif
+
+} // namespace Diligent
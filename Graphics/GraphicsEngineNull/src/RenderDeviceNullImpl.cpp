@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+class BottomLevelASNullImpl
+{};
+
+class TopLevelASNullImpl
+{};
+
+class ShaderBindingTableNullImpl
+{};
+
+class DeviceMemoryNullImpl
+{};
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters*         pRefCounters,
+                                           IMemoryAllocator&           RawMemAllocator,
+                                           IEngineFactory*             pEngineFactory,
+                                           const EngineNullCreateInfo& EngineCI,
+                                           const GraphicsAdapterInfo&  AdapterInfo,
+                                           size_t                      CommandQueueCount,
+                                           ICommandQueueNull**         ppCmdQueues) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        RawMemAllocator,
+        pEngineFactory,
+        CommandQueueCount,
+        ppCmdQueues,
+        EngineCI,
+        AdapterInfo
+    }
+// clang-format on
+{
+    m_DeviceInfo.Type = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.NDC  = NDCAttribs{0.0f, 1.0f, -0.5f};
+
+    m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
+
+    // All formats are supported. Bind flags and dimensions are filled in by TestTextureFormat().
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+        m_TextureFormatsInfo[Fmt].Supported = true;
+
+    InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+    IdleGPU();
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer,
+                                        bool              IsDeviceInternal)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer)
+{
+    CreateBuffer(BuffDesc, pBuffData, ppBuffer, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture,
+                                         bool               IsDeviceInternal)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture)
+{
+    CreateTexture(TexDesc, pData, ppTexture, false);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler,
+                                         bool               IsDeviceInternal)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler)
+{
+    CreateSampler(SamplerDesc, ppSampler, false);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
+                                        IShader**               ppShader,
+                                        IDataBlob**             ppCompilerOutput)
+{
+    // Shaders are never compiled, so there is no compiler output
+    if (ppCompilerOutput != nullptr)
+        *ppCompilerOutput = nullptr;
+
+    CreateShaderImpl(ppShader, ShaderCI);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                       IPipelineState**                       ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                      IPipelineState**                      ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                         IPipelineState**                         ppPipelineState)
+{
+    UNSUPPORTED("Ray tracing is not supported in null backend");
+    *ppPipelineState = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc,
+                                       IFence**         ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc,
+                                       IQuery**         ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc,
+                                            IRenderPass**         ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc,
+                                             IFramebuffer**         ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    UNSUPPORTED("CreateBLAS is not supported in null backend");
+    *ppBLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    UNSUPPORTED("CreateTLAS is not supported in null backend");
+    *ppTLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    UNSUPPORTED("CreateSBT is not supported in null backend");
+    *ppSBT = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                              IDeviceMemory**               ppMemory)
+{
+    UNSUPPORTED("CreateDeviceMemory is not supported in null backend");
+    *ppMemory = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                    IPipelineStateCache**               ppPSOCache)
+{
+    *ppPSOCache = nullptr;
+}
+
+SparseTextureFormatInfo RenderDeviceNullImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
+                                                                         RESOURCE_DIMENSION Dimension,
+                                                                         Uint32             SampleCount) const
+{
+    UNSUPPORTED("GetSparseTextureFormatInfo is not supported in null backend");
+    return {};
+}
+
+void RenderDeviceNullImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
+{
+    // Submit empty command buffer to the queue. This will effectively signal the fence and
+    // discard all resources
+    SubmitCommandBuffer(CmdQueueIndex, true, 0u);
+}
+
+void RenderDeviceNullImpl::ReleaseStaleResources(bool ForceRelease)
+{
+    PurgeReleaseQueues(ForceRelease);
+}
+
+void RenderDeviceNullImpl::IdleGPU()
+{
+    IdleAllCommandQueues(true);
+    ReleaseStaleResources();
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    TextureFormatInfoExt& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
+    VERIFY(TexFormatInfo.Supported, "Texture format is not supported");
+
+    TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE;
+    TexFormatInfo.Dimensions   = RESOURCE_DIMENSION_SUPPORT_TEX_1D | RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D | RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_3D |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE | RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+    TexFormatInfo.SampleCounts = SAMPLE_COUNT_1;
+
+    switch (TexFormatInfo.ComponentType)
+    {
+        case COMPONENT_TYPE_DEPTH:
+        case COMPONENT_TYPE_DEPTH_STENCIL:
+            TexFormatInfo.BindFlags |= BIND_DEPTH_STENCIL;
+            break;
+
+        case COMPONENT_TYPE_COMPRESSED:
+            TexFormatInfo.Dimensions &= ~RESOURCE_DIMENSION_SUPPORT_TEX_1D & ~RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY;
+            break;
+
+        default:
+            if (!TexFormatInfo.IsTypeless)
+                TexFormatInfo.BindFlags |= BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+    }
+
+    if ((TexFormatInfo.BindFlags & (BIND_RENDER_TARGET | BIND_DEPTH_STENCIL)) != 0)
+        TexFormatInfo.SampleCounts |= SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+}
+
+} // namespace Diligent
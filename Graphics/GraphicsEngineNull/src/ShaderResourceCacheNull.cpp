@@ -0,0 +1,328 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+#include "EngineMemory.h"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderResourceCacheNull::GetRequiredMemorySize(Uint32 NumResources)
+{
+    return NumResources * sizeof(Resource);
+}
+
+ShaderResourceCacheNull::ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept :
+    m_NumResources{0},
+    m_ContentType{static_cast<Uint32>(ContentType)}
+{
+}
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    if (m_pMemory)
+    {
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            m_pResources[res].~Resource();
+    }
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_NumResources = NumResources;
+    VERIFY(m_NumResources == NumResources, "NumResources (", NumResources, ") exceeds maximum representable value");
+
+    const size_t MemorySize = GetRequiredMemorySize(NumResources);
+#ifdef DILIGENT_DEBUG
+    m_DbgInitializedResources.resize(NumResources);
+#endif
+
+    if (MemorySize > 0)
+    {
+        m_pMemory = decltype(m_pMemory){
+            ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", MemorySize),
+            STDDeleter<void, IMemoryAllocator>(MemAllocator),
+        };
+        memset(m_pMemory.get(), 0, MemorySize);
+
+        m_pResources = reinterpret_cast<Resource*>(m_pMemory.get());
+    }
+}
+
+void ShaderResourceCacheNull::InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type, bool HasImmutableSampler)
+{
+    for (Uint32 res = 0; res < ArraySize; ++res)
+    {
+        new (&GetResource(Offset + res)) Resource{Type, HasImmutableSampler};
+#ifdef DILIGENT_DEBUG
+        m_DbgInitializedResources[size_t{Offset} + res] = true;
+#endif
+    }
+}
+
+static const BufferNullImpl* GetResourceBuffer(const ShaderResourceCacheNull::Resource& Res)
+{
+    if (!Res.pObject)
+        return nullptr;
+
+    switch (Res.Type)
+    {
+        case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+            return Res.pObject.ConstPtr<BufferNullImpl>();
+
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+            return Res.pObject.ConstPtr<BufferViewNullImpl>()->GetBuffer<const BufferNullImpl>();
+
+        default:
+            return nullptr;
+    }
+}
+
+static bool IsDynamicBuffer(const ShaderResourceCacheNull::Resource& Res)
+{
+    const BufferNullImpl* pBuffer = GetResourceBuffer(Res);
+    if (pBuffer == nullptr)
+        return false;
+
+    const BufferDesc& BuffDesc = pBuffer->GetDesc();
+
+    // Buffers that are not bound as a whole are also counted as dynamic
+    return (BuffDesc.Usage == USAGE_DYNAMIC) || (Res.BufferRangeSize != 0 && Res.BufferRangeSize < BuffDesc.Size);
+}
+
+const ShaderResourceCacheNull::Resource& ShaderResourceCacheNull::SetResource(Uint32                       CacheOffset,
+                                                                              RefCntAutoPtr<IDeviceObject> pObject,
+                                                                              Uint64                       BufferBaseOffset,
+                                                                              Uint64                       BufferRangeSize)
+{
+    Resource& DstRes = GetResource(CacheOffset);
+
+    if (IsDynamicBuffer(DstRes))
+    {
+        VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
+        --m_NumDynamicBuffers;
+    }
+
+    DstRes.pObject             = std::move(pObject);
+    DstRes.BufferDynamicOffset = 0; // It is essential to reset dynamic offset
+    DstRes.BufferBaseOffset    = 0;
+    DstRes.BufferRangeSize     = 0;
+
+    if (DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER)
+    {
+        const BufferNullImpl* pBuffNull = DstRes.pObject.ConstPtr<BufferNullImpl>();
+        const Uint64          BuffSize  = pBuffNull != nullptr ? pBuffNull->GetDesc().Size : 0;
+        VERIFY(BufferBaseOffset + BufferRangeSize <= BuffSize, "Specified range is out of buffer bounds");
+
+        DstRes.BufferBaseOffset = BufferBaseOffset;
+        DstRes.BufferRangeSize  = BufferRangeSize != 0 ? BufferRangeSize : BuffSize - BufferBaseOffset;
+    }
+    else if ((DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV || DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV) && DstRes.pObject)
+    {
+        VERIFY(BufferBaseOffset == 0 && BufferRangeSize == 0, "Buffer range can only be specified for constant buffers");
+
+        const BufferViewDesc& ViewDesc = DstRes.pObject.ConstPtr<BufferViewNullImpl>()->GetDesc();
+        DstRes.BufferBaseOffset        = ViewDesc.ByteOffset;
+        DstRes.BufferRangeSize         = ViewDesc.ByteWidth;
+    }
+    else
+    {
+        VERIFY(BufferBaseOffset == 0 && BufferRangeSize == 0, "Buffer range can only be specified for constant buffers");
+    }
+
+    if (IsDynamicBuffer(DstRes))
+    {
+        ++m_NumDynamicBuffers;
+    }
+
+    return DstRes;
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    Resource& DstRes = GetResource(CacheOffset);
+    DEV_CHECK_ERR(DstRes.pObject, "Setting dynamic offset when no object is bound");
+    DEV_CHECK_ERR(DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER ||
+                      DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ||
+                      DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV,
+                  "Dynamic offsets can only be set for buffers");
+    DstRes.BufferDynamicOffset = DynamicBufferOffset;
+}
+
+namespace
+{
+
+template <bool VerifyOnly>
+void TransitionBuffer(DeviceContextNullImpl* pCtxNullImpl,
+                      BufferNullImpl*        pBufferNull,
+                      RESOURCE_STATE         RequiredState)
+{
+    if (pBufferNull == nullptr || !pBufferNull->IsInKnownState())
+        return;
+
+    const bool IsInRequiredState = pBufferNull->CheckState(RequiredState);
+    if (VerifyOnly)
+    {
+        if (!IsInRequiredState)
+        {
+            LOG_ERROR_MESSAGE("State of buffer '", pBufferNull->GetDesc().Name, "' is incorrect. Required state: ",
+                              GetResourceStateString(RequiredState), ". Actual state: ",
+                              GetResourceStateString(pBufferNull->GetState()),
+                              ". Call IDeviceContext::TransitionShaderResources(), use RESOURCE_STATE_TRANSITION_MODE_TRANSITION "
+                              "when calling IDeviceContext::CommitShaderResources() or explicitly transition the buffer state "
+                              "with IDeviceContext::TransitionResourceStates().");
+        }
+    }
+    else
+    {
+        // When both old and new states are RESOURCE_STATE_UNORDERED_ACCESS, other backends
+        // execute a UAV barrier. Record the transition the same way.
+        if (!IsInRequiredState || RequiredState == RESOURCE_STATE_UNORDERED_ACCESS)
+        {
+            pCtxNullImpl->TransitionBufferState(*pBufferNull, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+        }
+    }
+}
+
+template <bool VerifyOnly>
+void TransitionTexture(DeviceContextNullImpl* pCtxNullImpl,
+                       TextureViewNullImpl*   pTexViewNull,
+                       RESOURCE_STATE         RequiredState)
+{
+    if (pTexViewNull == nullptr)
+        return;
+
+    TextureNullImpl* pTextureNull = pTexViewNull->GetTexture<TextureNullImpl>();
+    if (!pTextureNull->IsInKnownState())
+        return;
+
+    if (RequiredState == RESOURCE_STATE_SHADER_RESOURCE && (pTextureNull->GetDesc().BindFlags & BIND_DEPTH_STENCIL) != 0)
+        RequiredState = RESOURCE_STATE_DEPTH_READ;
+
+    const bool IsInRequiredState = pTextureNull->CheckState(RequiredState);
+    if (VerifyOnly)
+    {
+        if (!IsInRequiredState)
+        {
+            LOG_ERROR_MESSAGE("State of texture '", pTextureNull->GetDesc().Name, "' is incorrect. Required state: ",
+                              GetResourceStateString(RequiredState), ". Actual state: ",
+                              GetResourceStateString(pTextureNull->GetState()),
+                              ". Call IDeviceContext::TransitionShaderResources(), use RESOURCE_STATE_TRANSITION_MODE_TRANSITION "
+                              "when calling IDeviceContext::CommitShaderResources() or explicitly transition the texture state "
+                              "with IDeviceContext::TransitionResourceStates().");
+        }
+    }
+    else
+    {
+        if (!IsInRequiredState || RequiredState == RESOURCE_STATE_UNORDERED_ACCESS)
+        {
+            pCtxNullImpl->TransitionTextureState(*pTextureNull, RESOURCE_STATE_UNKNOWN, RequiredState, true);
+        }
+    }
+}
+
+} // namespace
+
+template <bool VerifyOnly>
+void ShaderResourceCacheNull::TransitionResources(DeviceContextNullImpl* pCtxNullImpl)
+{
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+    {
+        Resource& Res = m_pResources[res];
+        if (!Res.pObject)
+            continue;
+
+        static_assert(SHADER_RESOURCE_TYPE_LAST == SHADER_RESOURCE_TYPE_ACCEL_STRUCT, "Please update the switch below to handle the new shader resource type");
+        switch (Res.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                TransitionBuffer<VerifyOnly>(pCtxNullImpl, Res.pObject.RawPtr<BufferNullImpl>(), RESOURCE_STATE_CONSTANT_BUFFER);
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+                TransitionBuffer<VerifyOnly>(pCtxNullImpl, Res.pObject.RawPtr<BufferViewNullImpl>()->GetBuffer<BufferNullImpl>(), RESOURCE_STATE_SHADER_RESOURCE);
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                TransitionBuffer<VerifyOnly>(pCtxNullImpl, Res.pObject.RawPtr<BufferViewNullImpl>()->GetBuffer<BufferNullImpl>(), RESOURCE_STATE_UNORDERED_ACCESS);
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+                TransitionTexture<VerifyOnly>(pCtxNullImpl, Res.pObject.RawPtr<TextureViewNullImpl>(), RESOURCE_STATE_SHADER_RESOURCE);
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                TransitionTexture<VerifyOnly>(pCtxNullImpl, Res.pObject.RawPtr<TextureViewNullImpl>(), RESOURCE_STATE_UNORDERED_ACCESS);
+                break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+                // Nothing to do with samplers
+                break;
+
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+                // Nothing to do with input attachments - they are transitioned by the render pass.
+                break;
+
+            default: UNEXPECTED("Unexpected resource type");
+        }
+    }
+}
+
+template void ShaderResourceCacheNull::TransitionResources<false>(DeviceContextNullImpl* pCtxNullImpl);
+template void ShaderResourceCacheNull::TransitionResources<true>(DeviceContextNullImpl* pCtxNullImpl);
+
+#ifdef DILIGENT_DEBUG
+void ShaderResourceCacheNull::DbgVerifyResourceInitialization() const
+{
+    for (bool ResInitialized : m_DbgInitializedResources)
+        VERIFY(ResInitialized, "Not all resources in the cache have been initialized. This is a bug.");
+}
+
+void ShaderResourceCacheNull::DbgVerifyDynamicBuffersCounter() const
+{
+    Uint32 NumDynamicBuffers = 0;
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+    {
+        if (IsDynamicBuffer(m_pResources[res]))
+            ++NumDynamicBuffers;
+    }
+    VERIFY(NumDynamicBuffers == m_NumDynamicBuffers, "The number of dynamic buffers (", m_NumDynamicBuffers, ") does not match the actual number (", NumDynamicBuffers, ")");
+}
+#endif
+
+} // namespace Diligent
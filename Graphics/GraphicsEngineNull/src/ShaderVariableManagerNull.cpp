@@ -0,0 +1,501 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderVariableManagerNull.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+
+namespace Diligent
+{
+
+template <typename HandlerType>
+void ProcessSignatureResources(const PipelineResourceSignatureNullImpl& Signature,
+                               const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                               Uint32                                   NumAllowedTypes,
+                               SHADER_TYPE                              ShaderStages,
+                               HandlerType&&                            Handler)
+{
+    const bool UsingSeparateSamplers = Signature.IsUsingSeparateSamplers();
+    Signature.ProcessResources(AllowedVarTypes, NumAllowedTypes, ShaderStages,
+                               [&](const PipelineResourceDesc& ResDesc, Uint32 Index) //
+                               {
+                                   const PipelineResourceAttribsNull& ResAttr = Signature.GetResourceAttribs(Index);
+
+                                   // When using HLSL-style combined image samplers, we need to skip separate samplers.
+                                   // Also always skip immutable separate samplers.
+                                   if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER &&
+                                       (!UsingSeparateSamplers || ResAttr.IsImmutableSamplerAssigned()))
+                                       return;
+
+                                   Handler(Index);
+                               });
+}
+
+size_t ShaderVariableManagerNull::GetRequiredMemorySize(const PipelineResourceSignatureNullImpl& Signature,
+                                                        const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                                                        Uint32                                   NumAllowedTypes,
+                                                        SHADER_TYPE                              ShaderStages,
+                                                        Uint32*                                  pNumVariables)
+{
+    Uint32 NumVariables = 0;
+    if (pNumVariables == nullptr)
+        pNumVariables = &NumVariables;
+    *pNumVariables = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderStages,
+                              [pNumVariables](Uint32) //
+                              {
+                                  ++(*pNumVariables);
+                              });
+
+    return (*pNumVariables) * sizeof(ShaderVariableNullImpl);
+}
+
+// Creates shader variable for every resource whose type is one of AllowedVarTypes
+void ShaderVariableManagerNull::Initialize(const PipelineResourceSignatureNullImpl& Signature,
+                                           IMemoryAllocator&                        Allocator,
+                                           const SHADER_RESOURCE_VARIABLE_TYPE*     AllowedVarTypes,
+                                           Uint32                                   NumAllowedTypes,
+                                           SHADER_TYPE                              ShaderType)
+{
+    VERIFY_EXPR(m_NumVariables == 0);
+    const size_t MemSize = GetRequiredMemorySize(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType, &m_NumVariables);
+
+    if (m_NumVariables == 0)
+        return;
+
+    TBase::Initialize(Signature, Allocator, MemSize);
+
+    Uint32 VarInd = 0;
+    ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
+                              [this, &VarInd](Uint32 ResIndex) //
+                              {
+                                  ::new (m_pVariables + VarInd) ShaderVariableNullImpl{*this, ResIndex};
+                                  ++VarInd;
+                              });
+    VERIFY_EXPR(VarInd == m_NumVariables);
+}
+
+void ShaderVariableManagerNull::Destroy(IMemoryAllocator& Allocator)
+{
+    if (m_pVariables != nullptr)
+    {
+        for (Uint32 v = 0; v < m_NumVariables; ++v)
+            m_pVariables[v].~ShaderVariableNullImpl();
+    }
+    TBase::Destroy(Allocator);
+}
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(const Char* Name) const
+{
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? m_pVariables + VarIndex : nullptr;
+    }
+
+    for (Uint32 v = 0; v < m_NumVariables; ++v)
+    {
+        ShaderVariableNullImpl& Var = m_pVariables[v];
+        if (strcmp(Var.GetDesc().Name, Name) == 0)
+            return &Var;
+    }
+    return nullptr;
+}
+
+ShaderVariableNullImpl* ShaderVariableManagerNull::GetVariable(Uint32 Index) const
+{
+    if (Index >= m_NumVariables)
+    {
+        LOG_ERROR("Index ", Index, " is out of range");
+        return nullptr;
+    }
+
+    return m_pVariables + Index;
+}
+
+Uint32 ShaderVariableManagerNull::GetVariableIndex(const ShaderVariableNullImpl& Variable)
+{
+    if (m_pVariables == nullptr)
+    {
+        LOG_ERROR("This shader variable manager has no variables");
+        return ~0u;
+    }
+
+    const auto Offset = reinterpret_cast<const Uint8*>(&Variable) - reinterpret_cast<Uint8*>(m_pVariables);
+    DEV_CHECK_ERR(Offset % sizeof(ShaderVariableNullImpl) == 0, "Offset is not multiple of ShaderVariableNullImpl class size");
+    const Uint32 Index = static_cast<Uint32>(Offset / sizeof(ShaderVariableNullImpl));
+    if (Index < m_NumVariables)
+        return Index;
+    else
+    {
+        LOG_ERROR("Failed to get variable index. The variable ", &Variable, " does not belong to this shader variable manager");
+        return ~0u;
+    }
+}
+
+const PipelineResourceDesc& ShaderVariableManagerNull::GetResourceDesc(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceDesc(Index);
+}
+
+const ShaderVariableManagerNull::ResourceAttribs& ShaderVariableManagerNull::GetResourceAttribs(Uint32 Index) const
+{
+    VERIFY_EXPR(m_pSignature);
+    return m_pSignature->GetResourceAttribs(Index);
+}
+
+void ShaderVariableManagerNull::BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+{
+    TBase::BindResources(pResourceMapping, Flags);
+}
+
+void ShaderVariableManagerNull::CheckResources(IResourceMapping*                    pResourceMapping,
+                                               BIND_SHADER_RESOURCES_FLAGS          Flags,
+                                               SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const
+{
+    TBase::CheckResources(pResourceMapping, Flags, StaleVarTypes);
+}
+
+namespace
+{
+
+struct BindResourceHelper
+{
+    BindResourceHelper(const PipelineResourceSignatureNullImpl& Signature,
+                       ShaderResourceCacheNull&                 ResourceCache,
+                       Uint32                                   ResIndex,
+                       Uint32                                   ArrayIndex);
+
+    void operator()(const BindResourceInfo& BindInfo) const;
+
+private:
+    // clang-format off
+    void CacheConstantBuffer(const BindResourceInfo& BindInfo) const;
+    void CacheBufferView    (const BindResourceInfo& BindInfo) const;
+    void CacheTextureView   (const BindResourceInfo& BindInfo) const;
+    void CacheSampler       (const BindResourceInfo& BindInfo) const;
+    // clang-format on
+
+    template <typename ObjectType>
+    bool UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObject,
+                              SET_SHADER_RESOURCE_FLAGS   Flags,
+                              Uint64                      BufferBaseOffset = 0,
+                              Uint64                      BufferRangeSize  = 0) const;
+
+private:
+    using ResourceAttribs = PipelineResourceSignatureNullImpl::ResourceAttribs;
+
+    const PipelineResourceSignatureNullImpl& m_Signature;
+    ShaderResourceCacheNull&                 m_ResourceCache;
+    const Uint32                             m_ArrayIndex;
+    const ResourceCacheContentType           m_CacheType;
+    const PipelineResourceDesc&              m_ResDesc;
+    const ResourceAttribs&                   m_Attribs;
+    const Uint32                             m_DstResCacheOffset;
+    const ShaderResourceCacheNull::Resource& m_DstRes;
+};
+
+BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureNullImpl& Signature,
+                                       ShaderResourceCacheNull&                 ResourceCache,
+                                       Uint32                                   ResIndex,
+                                       Uint32                                   ArrayIndex) :
+    // clang-format off
+    m_Signature         {Signature},
+    m_ResourceCache     {ResourceCache},
+    m_ArrayIndex        {ArrayIndex},
+    m_CacheType         {ResourceCache.GetContentType()},
+    m_ResDesc           {Signature.GetResourceDesc(ResIndex)},
+    m_Attribs           {Signature.GetResourceAttribs(ResIndex)},
+    m_DstResCacheOffset {m_Attribs.CacheOffset(m_CacheType) + ArrayIndex},
+    m_DstRes            {const_cast<const ShaderResourceCacheNull&>(ResourceCache).GetResource(m_DstResCacheOffset)}
+// clang-format on
+{
+    VERIFY(ArrayIndex < m_ResDesc.ArraySize, "Array index is out of range, but it should've been corrected by ShaderVariableBase::SetArray()");
+    VERIFY(m_DstRes.Type == m_ResDesc.ResourceType, "Inconsistent types");
+}
+
+void BindResourceHelper::operator()(const BindResourceInfo& BindInfo) const
+{
+    VERIFY_EXPR(m_ArrayIndex == BindInfo.ArrayIndex);
+
+    if (BindInfo.pObject != nullptr)
+    {
+        static_assert(SHADER_RESOURCE_TYPE_LAST == SHADER_RESOURCE_TYPE_ACCEL_STRUCT, "Please update the switch below to handle the new shader resource type");
+        switch (m_DstRes.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                CacheConstantBuffer(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                CacheBufferView(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+                CacheTextureView(BindInfo);
+                break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+                if (!m_Attribs.IsImmutableSamplerAssigned())
+                {
+                    CacheSampler(BindInfo);
+                }
+                else
+                {
+                    UNEXPECTED("Attempting to assign a sampler to an immutable sampler '", m_ResDesc.Name, '\'');
+                }
+                break;
+
+            case SHADER_RESOURCE_TYPE_ACCEL_STRUCT:
+                UNSUPPORTED("Acceleration structures are not supported in null backend");
+                break;
+
+            default:
+                UNEXPECTED("Unknown resource type ", static_cast<Uint32>(m_DstRes.Type));
+        }
+    }
+    else
+    {
+        DEV_CHECK_ERR((m_DstRes.pObject == nullptr ||
+                       m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC ||
+                       (BindInfo.Flags & SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE) != 0),
+                      "Shader variable '", m_ResDesc.Name, "' is not dynamic, but is being reset to null. This is an error and may cause unpredicted behavior. ",
+                      "If this is intended and you ensured proper synchronization, use the SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE flag. "
+                      "Otherwise, use another shader resource binding instance or label the variable as dynamic.");
+
+        m_ResourceCache.ResetResource(m_DstResCacheOffset);
+    }
+}
+
+template <typename ObjectType>
+bool BindResourceHelper::UpdateCachedResource(RefCntAutoPtr<ObjectType>&& pObject,
+                                              SET_SHADER_RESOURCE_FLAGS   Flags,
+                                              Uint64                      BufferBaseOffset,
+                                              Uint64                      BufferRangeSize) const
+{
+    if (pObject)
+    {
+        if (m_DstRes.pObject != nullptr &&
+            m_ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC &&
+            (Flags & SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE) == 0)
+        {
+            DEV_CHECK_ERR(m_DstRes.pObject == pObject, "Binding another object to a non-dynamic variable is not allowed");
+            // Do not update resource if one is already bound unless it is dynamic. Other backends
+            // behave the same way, so keep the null backend consistent with them.
+            return false;
+        }
+
+        m_ResourceCache.SetResource(m_DstResCacheOffset,
+                                    std::move(pObject),
+                                    BufferBaseOffset,
+                                    BufferRangeSize);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+void BindResourceHelper::CacheConstantBuffer(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting constant buffer to null is handled by BindResourceHelper::operator()");
+    VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, "Constant buffer resource is expected");
+
+    // We cannot use ClassPtrCast<> here as the resource can have wrong type
+    RefCntAutoPtr<BufferNullImpl> pBufferNull{BindInfo.pObject, BufferNullImpl::IID_InternalImpl};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifyConstantBufferBinding(m_ResDesc, BindInfo, pBufferNull.RawPtr(), m_DstRes.pObject.RawPtr(),
+                                m_DstRes.BufferBaseOffset, m_DstRes.BufferRangeSize, m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pBufferNull), BindInfo.Flags, BindInfo.BufferBaseOffset, BindInfo.BufferRangeSize);
+}
+
+void BindResourceHelper::CacheBufferView(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting buffer view to null is handled by BindResourceHelper::operator()");
+    VERIFY((m_DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ||
+            m_DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_UAV),
+           "Buffer view resource is expected");
+
+    RefCntAutoPtr<BufferViewNullImpl> pBufferViewNull{BindInfo.pObject, BufferViewNullImpl::IID_InternalImpl};
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const BUFFER_VIEW_TYPE RequiredViewType = m_DstRes.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ?
+            BUFFER_VIEW_SHADER_RESOURCE :
+            BUFFER_VIEW_UNORDERED_ACCESS;
+        VerifyResourceViewBinding(m_ResDesc, BindInfo, pBufferViewNull.RawPtr(),
+                                  {RequiredViewType},
+                                  RESOURCE_DIM_BUFFER, // Expected resource dim
+                                  false,               // IsMultisample (ignored when resource dim is buffer)
+                                  m_DstRes.pObject.RawPtr(),
+                                  m_Signature.GetDesc().Name);
+        ValidateBufferMode(m_ResDesc, m_ArrayIndex, pBufferViewNull.RawPtr());
+    }
+#endif
+
+    UpdateCachedResource(std::move(pBufferViewNull), BindInfo.Flags);
+}
+
+void BindResourceHelper::CacheTextureView(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting texture view to null is handled by BindResourceHelper::operator()");
+    VERIFY((m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV ||
+            m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_UAV ||
+            m_DstRes.Type == SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT),
+           "Texture view resource is expected");
+
+    RefCntAutoPtr<TextureViewNullImpl> pTexViewNull0{BindInfo.pObject, TextureViewNullImpl::IID_InternalImpl};
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const TEXTURE_VIEW_TYPE RequiredViewType = m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_UAV ?
+            TEXTURE_VIEW_UNORDERED_ACCESS :
+            TEXTURE_VIEW_SHADER_RESOURCE;
+        VerifyResourceViewBinding(m_ResDesc, BindInfo, pTexViewNull0.RawPtr(),
+                                  {RequiredViewType},
+                                  RESOURCE_DIM_UNDEFINED, // Required resource dimension is not known
+                                  false,                  // IsMultisample (ignored when resource dim is unknown)
+                                  m_DstRes.pObject.RawPtr(),
+                                  m_Signature.GetDesc().Name);
+    }
+#endif
+
+    TextureViewNullImpl* pTexViewNull = pTexViewNull0;
+    if (UpdateCachedResource(std::move(pTexViewNull0), BindInfo.Flags))
+    {
+        if (m_Attribs.IsCombinedWithSampler())
+        {
+            VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV, "Only texture SRVs can be combined with samplers.");
+
+            const PipelineResourceDesc&        SamplerResDesc = m_Signature.GetResourceDesc(m_Attribs.SamplerInd);
+            const PipelineResourceAttribsNull& SamplerAttribs = m_Signature.GetResourceAttribs(m_Attribs.SamplerInd);
+            VERIFY_EXPR(SamplerResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER);
+
+            if (!SamplerAttribs.IsImmutableSamplerAssigned())
+            {
+                if (ISampler* pSampler = pTexViewNull->GetSampler())
+                {
+                    DEV_CHECK_ERR(SamplerResDesc.ArraySize == 1 || SamplerResDesc.ArraySize == m_ResDesc.ArraySize,
+                                  "Array size (", SamplerResDesc.ArraySize,
+                                  ") of texture variable '",
+                                  SamplerResDesc.Name,
+                                  "' must be one or the same as the array size (", m_ResDesc.ArraySize,
+                                  ") of texture variable '", m_ResDesc.Name, "' it is assigned to");
+
+                    BindResourceHelper BindSeparateSampler{
+                        m_Signature,
+                        m_ResourceCache,
+                        m_Attribs.SamplerInd,
+                        SamplerResDesc.ArraySize == 1 ? 0 : m_ArrayIndex};
+                    BindSeparateSampler(BindResourceInfo{BindSeparateSampler.m_ArrayIndex, pSampler, BindInfo.Flags});
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Failed to bind sampler to sampler variable '", SamplerResDesc.Name,
+                                      "' assigned to texture '", GetShaderResourcePrintName(m_ResDesc, m_ArrayIndex),
+                                      "': no sampler is set in texture view '", pTexViewNull->GetDesc().Name, '\'');
+                }
+            }
+        }
+    }
+}
+
+void BindResourceHelper::CacheSampler(const BindResourceInfo& BindInfo) const
+{
+    VERIFY(BindInfo.pObject != nullptr, "Setting separate sampler to null is handled by BindResourceHelper::operator()");
+    VERIFY(m_DstRes.Type == SHADER_RESOURCE_TYPE_SAMPLER, "Separate sampler resource is expected");
+    VERIFY(!m_Attribs.IsImmutableSamplerAssigned(), "This separate sampler is assigned an immutable sampler");
+
+    RefCntAutoPtr<SamplerNullImpl> pSamplerNull{BindInfo.pObject, SamplerNullImpl::IID_InternalImpl};
+#ifdef DILIGENT_DEVELOPMENT
+    VerifySamplerBinding(m_ResDesc, BindInfo, pSamplerNull.RawPtr(), m_DstRes.pObject, m_Signature.GetDesc().Name);
+#endif
+
+    UpdateCachedResource(std::move(pSamplerNull), BindInfo.Flags);
+}
+
+} // namespace
+
+
+void ShaderVariableManagerNull::BindResource(Uint32 ResIndex, const BindResourceInfo& BindInfo)
+{
+    BindResourceHelper BindHelper{
+        *m_pSignature,
+        m_ResourceCache,
+        ResIndex,
+        BindInfo.ArrayIndex};
+
+    BindHelper(BindInfo);
+}
+
+void ShaderVariableManagerNull::SetBufferDynamicOffset(Uint32 ResIndex,
+                                                       Uint32 ArrayIndex,
+                                                       Uint32 BufferDynamicOffset)
+{
+    const PipelineResourceAttribsNull& Attribs           = m_pSignature->GetResourceAttribs(ResIndex);
+    const Uint32                       DstResCacheOffset = Attribs.CacheOffset(m_ResourceCache.GetContentType()) + ArrayIndex;
+#ifdef DILIGENT_DEVELOPMENT
+    {
+        const PipelineResourceDesc&              ResDesc = m_pSignature->GetResourceDesc(ResIndex);
+        const ShaderResourceCacheNull::Resource& DstRes  = const_cast<const ShaderResourceCacheNull&>(m_ResourceCache).GetResource(DstResCacheOffset);
+        VerifyDynamicBufferOffset<BufferNullImpl, BufferViewNullImpl>(ResDesc, DstRes.pObject, DstRes.BufferBaseOffset, DstRes.BufferRangeSize, BufferDynamicOffset);
+    }
+#endif
+    m_ResourceCache.SetDynamicBufferOffset(DstResCacheOffset, BufferDynamicOffset);
+}
+
+
+IDeviceObject* ShaderVariableManagerNull::Get(Uint32 ArrayIndex, Uint32 ResIndex) const
+{
+    const PipelineResourceDesc&        ResDesc     = GetResourceDesc(ResIndex);
+    const PipelineResourceAttribsNull& Attribs     = GetResourceAttribs(ResIndex);
+    const Uint32                       CacheOffset = Attribs.CacheOffset(m_ResourceCache.GetContentType());
+
+    VERIFY_EXPR(ArrayIndex < ResDesc.ArraySize);
+
+    if (CacheOffset + ArrayIndex < m_ResourceCache.GetSize())
+    {
+        const ShaderResourceCacheNull::Resource& CachedRes = const_cast<const ShaderResourceCacheNull&>(m_ResourceCache).GetResource(CacheOffset + ArrayIndex);
+        return CachedRes.pObject;
+    }
+
+    return nullptr;
+}
+
+} // namespace Diligent
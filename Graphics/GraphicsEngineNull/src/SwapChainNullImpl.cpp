@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "SwapChainNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+
+namespace Diligent
+{
+
+SwapChainNullImpl::SwapChainNullImpl(IReferenceCounters*    pRefCounters,
+                                     const SwapChainDesc&   SCDesc,
+                                     RenderDeviceNullImpl*  pDevice,
+                                     DeviceContextNullImpl* pDeviceContext) :
+    // clang-format off
+    TSwapChainBase
+    {
+        pRefCounters,
+        pDevice,
+        pDeviceContext,
+        SCDesc
+    }
+// clang-format on
+{
+    if (m_SwapChainDesc.Width == 0 || m_SwapChainDesc.Height == 0)
+        LOG_ERROR_AND_THROW("Null swap chain is not associated with a window, so its width and height must be specified explicitly");
+
+    m_DesiredPreTransform        = SURFACE_TRANSFORM_OPTIMAL;
+    m_SwapChainDesc.PreTransform = SURFACE_TRANSFORM_IDENTITY;
+
+    CreateBuffersAndViews();
+}
+
+SwapChainNullImpl::~SwapChainNullImpl() = default;
+
+void SwapChainNullImpl::CreateBuffersAndViews()
+{
+    TextureDesc BackBufferDesc;
+    BackBufferDesc.Type      = RESOURCE_DIM_TEX_2D;
+    BackBufferDesc.Width     = m_SwapChainDesc.Width;
+    BackBufferDesc.Height    = m_SwapChainDesc.Height;
+    BackBufferDesc.Format    = m_SwapChainDesc.ColorBufferFormat;
+    BackBufferDesc.Usage     = USAGE_DEFAULT;
+    BackBufferDesc.BindFlags = BIND_RENDER_TARGET;
+    if (m_SwapChainDesc.Usage & SWAP_CHAIN_USAGE_SHADER_RESOURCE)
+        BackBufferDesc.BindFlags |= BIND_SHADER_RESOURCE;
+    BackBufferDesc.Name = "Main back buffer";
+
+    RefCntAutoPtr<ITexture> pBackBufferTex;
+    m_pRenderDevice->CreateTexture(BackBufferDesc, nullptr, &pBackBufferTex);
+    if (!pBackBufferTex)
+        LOG_ERROR_AND_THROW("Failed to create the swap chain back buffer");
+    m_pBackBufferRTV = pBackBufferTex->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+
+    if (m_SwapChainDesc.DepthBufferFormat != TEX_FORMAT_UNKNOWN)
+    {
+        TextureDesc DepthBufferDesc;
+        DepthBufferDesc.Type      = RESOURCE_DIM_TEX_2D;
+        DepthBufferDesc.Width     = m_SwapChainDesc.Width;
+        DepthBufferDesc.Height    = m_SwapChainDesc.Height;
+        DepthBufferDesc.Format    = m_SwapChainDesc.DepthBufferFormat;
+        DepthBufferDesc.Usage     = USAGE_DEFAULT;
+        DepthBufferDesc.BindFlags = BIND_DEPTH_STENCIL;
+
+        DepthBufferDesc.ClearValue.Format               = DepthBufferDesc.Format;
+        DepthBufferDesc.ClearValue.DepthStencil.Depth   = m_SwapChainDesc.DefaultDepthValue;
+        DepthBufferDesc.ClearValue.DepthStencil.Stencil = m_SwapChainDesc.DefaultStencilValue;
+        DepthBufferDesc.Name                            = "Main depth buffer";
+
+        RefCntAutoPtr<ITexture> pDepthBufferTex;
+        m_pRenderDevice->CreateTexture(DepthBufferDesc, nullptr, &pDepthBufferTex);
+        if (!pDepthBufferTex)
+            LOG_ERROR_AND_THROW("Failed to create the swap chain depth buffer");
+        m_pDepthBufferDSV = pDepthBufferTex->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+    }
+}
+
+void SwapChainNullImpl::Present(Uint32 SyncInterval)
+{
+    RefCntAutoPtr<IDeviceContext> pDeviceContext = m_wpDeviceContext.Lock();
+    if (!pDeviceContext)
+    {
+        LOG_ERROR_MESSAGE("Immediate context has been released");
+        return;
+    }
+
+    DeviceContextNullImpl* pImmediateCtxNull = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+    RenderDeviceNullImpl*  pRenderDevice     = m_pRenderDevice.RawPtr<RenderDeviceNullImpl>();
+
+    pImmediateCtxNull->Flush();
+
+    if (m_SwapChainDesc.IsPrimary)
+    {
+        pImmediateCtxNull->FinishFrame();
+        pRenderDevice->ReleaseStaleResources();
+    }
+}
+
+void SwapChainNullImpl::Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform)
+{
+    if (!TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
+        return;
+
+    if (RefCntAutoPtr<IDeviceContext> pDeviceContext = m_wpDeviceContext.Lock())
+    {
+        DeviceContextNullImpl* pImmediateCtxNull = pDeviceContext.RawPtr<DeviceContextNullImpl>();
+        pImmediateCtxNull->UnbindTextureFromFramebuffer(ClassPtrCast<TextureNullImpl>(m_pBackBufferRTV->GetTexture()), false);
+        if (m_pDepthBufferDSV)
+            pImmediateCtxNull->UnbindTextureFromFramebuffer(ClassPtrCast<TextureNullImpl>(m_pDepthBufferDSV->GetTexture()), false);
+    }
+
+    m_pBackBufferRTV.Release();
+    m_pDepthBufferDSV.Release();
+
+    try
+    {
+        CreateBuffersAndViews();
+    }
+    catch (const std::runtime_error&)
+    {
+        LOG_ERROR("Failed to resize the swap chain");
+    }
+}
+
+} // namespace Diligent
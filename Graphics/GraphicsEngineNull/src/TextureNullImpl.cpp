@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "TextureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+TextureNullImpl::TextureNullImpl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                 RenderDeviceNullImpl*      pDevice,
+                                 const TextureDesc&         Desc,
+                                 const TextureData*         pInitData,
+                                 bool                       bIsDeviceInternal) :
+    // clang-format off
+    TTextureBase
+    {
+        pRefCounters,
+        TexViewObjAllocator,
+        pDevice,
+        Desc,
+        bIsDeviceInternal
+    }
+// clang-format on
+{
+    if (m_Desc.Usage == USAGE_IMMUTABLE && (pInitData == nullptr || pInitData->pSubResources == nullptr))
+        LOG_ERROR_AND_THROW("Immutable textures must be initialized with data at creation time: pInitData can't be null");
+
+    if (m_Desc.Usage == USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Sparse resources are not supported in null backend");
+
+    const bool InitializeTexture = (pInitData != nullptr && pInitData->pSubResources != nullptr && pInitData->NumSubresources > 0);
+    if (InitializeTexture)
+    {
+        const Uint32 ExpectedNumSubresources = m_Desc.MipLevels * m_Desc.GetArraySize();
+        if (pInitData->NumSubresources != ExpectedNumSubresources)
+            LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", ExpectedNumSubresources, " expected, while ", pInitData->NumSubresources, " provided");
+    }
+
+    if (m_Desc.Usage == USAGE_STAGING)
+    {
+        m_CPUData.resize(StaticCast<size_t>(GetStagingTextureDataSize(m_Desc, StagingDataAlignment)));
+
+        if (InitializeTexture)
+        {
+            const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+
+            Uint32 CurrSubRes = 0;
+            for (Uint32 LayerIdx = 0; LayerIdx < m_Desc.GetArraySize(); ++LayerIdx)
+            {
+                for (Uint32 MipIdx = 0; MipIdx < m_Desc.MipLevels; ++MipIdx)
+                {
+                    const MipLevelProperties MipProps   = GetMipLevelProperties(m_Desc, MipIdx);
+                    const TextureSubResData& SubResData = pInitData->pSubResources[CurrSubRes++];
+
+                    const Uint64 DstSubResOffset = GetSubresourceOffset(MipIdx, LayerIdx);
+                    CopyTextureSubresource(SubResData,
+                                           MipProps.StorageHeight / FmtAttribs.BlockHeight, // NumRows
+                                           MipProps.Depth,
+                                           MipProps.RowSize,
+                                           &m_CPUData[static_cast<size_t>(DstSubResOffset)],
+                                           MipProps.RowSize,       // DstRowStride
+                                           MipProps.DepthSliceSize // DstDepthStride
+                    );
+                }
+            }
+        }
+    }
+
+    SetState(InitializeTexture ? RESOURCE_STATE_COPY_DEST : RESOURCE_STATE_UNDEFINED);
+}
+
+TextureNullImpl::~TextureNullImpl() = default;
+
+void TextureNullImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "View pointer address is null");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto& TexViewAllocator = m_pDevice->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        TextureViewDesc UpdatedViewDesc = ViewDesc;
+        ValidatedAndCorrectTextureViewDesc(m_Desc, UpdatedViewDesc);
+
+        TextureViewNullImpl* pViewNull = NEW_RC_OBJ(TexViewAllocator, "TextureViewNullImpl instance", TextureViewNullImpl, bIsDefaultView ? this : nullptr)(
+            GetDevice(), UpdatedViewDesc, this, bIsDefaultView, m_bIsDeviceInternal);
+        VERIFY(pViewNull->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
+
+        if (bIsDefaultView)
+            *ppView = pViewNull;
+        else
+            pViewNull->QueryInterface(IID_TextureView, reinterpret_cast<IObject**>(ppView));
+    }
+    catch (const std::runtime_error&)
+    {
+        const char* ViewTypeName = GetTexViewTypeLiteralName(ViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", ViewDesc.Name ? ViewDesc.Name : "", "\" (", ViewTypeName, ") for texture \"", m_Desc.Name ? m_Desc.Name : "", "\"");
+    }
+}
+
+} // namespace Diligent
@@ -64,7 +64,7 @@ namespace Diligent
 
 class PipelineResourceSignatureGLImpl;
 
-// sizeof(ShaderVariableManagerGL) == 40 (x64, msvc, Release)
+// sizeof(ShaderVariableManagerGL) == 48 (x64, msvc, Release)
 class ShaderVariableManagerGL : ShaderVariableManagerBase<EngineGLImplTraits, void>
 {
 public:
@@ -196,6 +196,8 @@ public:
                         BIND_SHADER_RESOURCES_FLAGS          Flags,
                         SHADER_RESOURCE_VARIABLE_TYPE_FLAGS& StaleVarTypes) const;
 
+    using TBase::SetNameHash;
+
     IShaderResourceVariable* GetVariable(const Char* Name) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
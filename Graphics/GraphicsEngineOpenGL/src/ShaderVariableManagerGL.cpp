@@ -463,6 +463,12 @@ IShaderResourceVariable* ShaderVariableManagerGL::GetResourceByName(const Char*
 
 IShaderResourceVariable* ShaderVariableManagerGL::GetVariable(const Char* Name) const
 {
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? GetVariable(VarIndex) : nullptr;
+    }
+
     if (auto* pUB = GetResourceByName<UniformBuffBindInfo>(Name))
         return pUB;
 
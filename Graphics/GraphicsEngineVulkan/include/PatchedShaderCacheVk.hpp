@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PatchedShaderCacheVk class
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "UniqueIdentifier.hpp"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+/// Device-level cache of shader byte code patched for a specific resource layout.
+
+/// When a pipeline is created, resource bindings and descriptor sets in the SPIR-V of every shader
+/// are remapped to match the pipeline resource signatures, after which reflection information
+/// is stripped from the byte code. Since many pipelines use the same shader with the same
+/// signatures, the cache stores the resulting byte code and the Vulkan shader module.
+///
+/// Entries are keyed by the shader unique ID and the (binding, descriptor set) pairs
+/// assigned to the shader resources, which is the only part of the signature layout that
+/// affects the byte code. The entries of a shader are removed by RemoveShader() when the
+/// shader is destroyed.
+///
+/// The cache is thread-safe.
+class PatchedShaderCacheVk
+{
+public:
+    PatchedShaderCacheVk() = default;
+
+    // clang-format off
+    PatchedShaderCacheVk             (const PatchedShaderCacheVk&) = delete;
+    PatchedShaderCacheVk             (PatchedShaderCacheVk&&)      = delete;
+    PatchedShaderCacheVk& operator = (const PatchedShaderCacheVk&) = delete;
+    PatchedShaderCacheVk& operator = (PatchedShaderCacheVk&&)      = delete;
+    // clang-format on
+
+    using CreateModuleFuncType = std::function<VulkanUtilities::ShaderModuleWrapper(const std::vector<uint32_t>& SPIRV)>;
+
+    /// Patched shader byte code and the shader module created from it.
+    class Entry
+    {
+    public:
+        explicit Entry(std::vector<uint32_t>&& _SPIRV) :
+            SPIRV{std::move(_SPIRV)}
+        {}
+
+        /// Returns the shader module, creating it when the method is called for the first time.
+
+        /// \param [in] CreateModule - Function that creates the shader module from the byte code.
+        ///
+        /// \return     The module that remains valid while the entry is alive.
+        VkShaderModule GetShaderModule(const CreateModuleFuncType& CreateModule) noexcept(false);
+
+        const std::vector<uint32_t> SPIRV;
+
+    private:
+        std::mutex                           m_ModuleMtx;
+        VulkanUtilities::ShaderModuleWrapper m_Module;
+    };
+    using EntryPtr = std::shared_ptr<Entry>;
+
+    /// Finds the entry for the given shader and resource bindings.
+    /// Returns null if there is no such entry.
+    EntryPtr Find(UniqueIdentifier ShaderId, const std::vector<Uint32>& Bindings) const;
+
+    /// Adds the patched byte code for the given shader and resource bindings.
+    /// If another thread has already added the same entry, the existing entry is returned.
+    EntryPtr Add(UniqueIdentifier ShaderId, std::vector<Uint32>&& Bindings, std::vector<uint32_t>&& SPIRV);
+
+    /// Removes all entries of the given shader.
+    /// Pipelines that are being created keep the entries they use alive until they are initialized.
+    void RemoveShader(UniqueIdentifier ShaderId);
+
+    /// Returns the total number of entries in the cache.
+    size_t GetEntryCount() const;
+
+private:
+    struct BindingsHasher
+    {
+        size_t operator()(const std::vector<Uint32>& Bindings) const;
+    };
+    using ShaderEntries = std::unordered_map<std::vector<Uint32>, EntryPtr, BindingsHasher>;
+
+    mutable std::mutex m_Mtx;
+
+    std::unordered_map<UniqueIdentifier, ShaderEntries> m_Shaders;
+};
+
+} // namespace Diligent
@@ -177,6 +177,7 @@ private:
     void Destruct();
 
     void CreateSetLayouts(bool IsSerialized);
+    void CreateDynamicSetUpdateTemplate();
 
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
@@ -187,6 +188,14 @@ private:
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Descriptor update template that writes all descriptors of the dynamic set from
+    // the descriptor image of the SRB resource cache (see ShaderResourceCacheVk::GetDescriptorImage()).
+    // Null if the device does not support descriptor update templates.
+    VulkanUtilities::DescrUpdateTemplateWrapper m_VkDynamicSetUpdateTemplate;
+
+    // The number of descriptors written by m_VkDynamicSetUpdateTemplate
+    Uint32 m_DynamicSetTemplateDescriptorCount = 0;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
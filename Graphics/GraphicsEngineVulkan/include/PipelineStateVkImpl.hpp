@@ -41,6 +41,8 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
+#include "PatchedShaderCacheVk.hpp"
+#include "ShaderModuleCacheVk.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 
@@ -58,9 +60,13 @@ public:
     static constexpr INTERFACE_ID IID_InternalImpl =
         {0xdbac0281, 0x36de, 0x4550, {0x80, 0x2d, 0xa3, 0x8c, 0x6e, 0xfb, 0x92, 0x57}};
 
-    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const GraphicsPipelineStateCreateInfo& CreateInfo);
-    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const ComputePipelineStateCreateInfo& CreateInfo);
-    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const RayTracingPipelineStateCreateInfo& CreateInfo);
+    using TShaderModuleCache = ShaderModuleCacheVk;
+
+    // pShaderModuleCache is an optional cache that lets the pipeline share shader modules with
+    // other pipelines, see RenderDeviceVkImpl::CreatePipelineStates().
+    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const GraphicsPipelineStateCreateInfo& CreateInfo, const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache = {});
+    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const ComputePipelineStateCreateInfo& CreateInfo, const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache = {});
+    PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const RayTracingPipelineStateCreateInfo& CreateInfo, const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache = {});
     ~PipelineStateVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_PipelineStateVk, IID_InternalImpl, TPipelineStateBase)
@@ -103,6 +109,11 @@ public:
     using TShaderResources         = std::vector<std::shared_ptr<const SPIRVShaderResources>>;
     using TResourceAttibutions     = std::vector<ResourceAttribution>;
     using TBindIndexToDescSetIndex = std::array<Uint32, MAX_RESOURCE_SIGNATURES>;
+    using TPatchedShaders          = std::vector<PatchedShaderCacheVk::EntryPtr>;
+
+    // When pPatchedShaderCache is not null, every shader is looked up in the cache before its byte code is
+    // patched, and the patched byte code is moved to the cache if not found. The cache entries for all
+    // shaders in all stages are then written to pPatchedShaders, and the SPIR-V in ShaderStages must not be used.
     static void RemapOrVerifyShaderResources(
         TShaderStages&                                       ShaderStages,
         const RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSignatures[],
@@ -112,7 +123,9 @@ public:
         bool                                                 bStripReflection,
         const char*                                          PipelineName,
         TShaderResources*                                    pShaderResources     = nullptr,
-        TResourceAttibutions*                                pResourceAttibutions = nullptr) noexcept(false);
+        TResourceAttibutions*                                pResourceAttibutions = nullptr,
+        PatchedShaderCacheVk*                                pPatchedShaderCache  = nullptr,
+        TPatchedShaders*                                     pPatchedShaders      = nullptr) noexcept(false);
 
     static PipelineResourceSignatureDescWrapper GetDefaultResourceSignatureDesc(
         const TShaderStages&              ShaderStages,
@@ -123,11 +136,14 @@ public:
 private:
     template <typename PSOCreateInfoType>
     TShaderStages InitInternalObjects(const PSOCreateInfoType&                           CreateInfo,
+                                      TShaderModuleCache*                                pModuleCache,
                                       std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-                                      std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules) noexcept(false);
+                                      std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
+                                      TPatchedShaders&                                   PatchedShaders) noexcept(false);
 
     void InitPipelineLayout(const PipelineStateCreateInfo& CreateInfo,
-                            TShaderStages&                 ShaderStages) noexcept(false);
+                            TShaderStages&                 ShaderStages,
+                            TPatchedShaders&               PatchedShaders) noexcept(false);
 
     void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
@@ -141,6 +157,10 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Shader module cache shared by the pipelines created in one batch.
+    // Released by InitializePipeline() once the pipeline has been created.
+    std::shared_ptr<TShaderModuleCache> m_pShaderModuleCache;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
@@ -51,6 +51,8 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PatchedShaderCacheVk.hpp"
+#include "ShaderCompilationCacheVk.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -88,6 +90,11 @@ public:
     /// Implementation of IRenderDevice::CreateRayTracingPipelineState() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState) override final;
 
+    /// Implementation of IRenderDevice::CreatePipelineStates() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE CreatePipelineStates(const PipelineStateCreateInfo* const* ppCreateInfos,
+                                                         Uint32                                NumPipelines,
+                                                         IPipelineState**                      ppPipelineStates) override final;
+
     /// Implementation of IRenderDevice::CreateBuffer() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE CreateBuffer(const BufferDesc& BuffDesc,
                                                  const BufferData* pBuffData,
@@ -234,7 +241,10 @@ public:
     const VulkanUtilities::VulkanLogicalDevice&  GetLogicalDevice() const { return *m_LogicalVkDevice; }
 
     FramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
-    RenderPassCache&  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
+
+    PatchedShaderCacheVk&     GetPatchedShaderCache() { return m_PatchedShaderCache; }
+    ShaderCompilationCacheVk& GetShaderCompilationCache() { return m_ShaderCompilationCache; }
+    RenderPassCache&          GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
 
     VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
@@ -295,10 +305,12 @@ private:
     std::unique_ptr<VulkanUtilities::VulkanPhysicalDevice> m_PhysicalDevice;
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice>  m_LogicalVkDevice;
 
-    FramebufferCache       m_FramebufferCache;
-    RenderPassCache        m_ImplicitRenderPassCache;
-    DescriptorSetAllocator m_DescriptorSetAllocator;
-    DescriptorPoolManager  m_DynamicDescriptorPool;
+    FramebufferCache         m_FramebufferCache;
+    RenderPassCache          m_ImplicitRenderPassCache;
+    DescriptorSetAllocator   m_DescriptorSetAllocator;
+    DescriptorPoolManager    m_DynamicDescriptorPool;
+    PatchedShaderCacheVk     m_PatchedShaderCache;
+    ShaderCompilationCacheVk m_ShaderCompilationCache;
 
     // These one-time command pools are used by buffer and texture constructors to
     // issue copy commands. Vulkan requires that every command pool is used by one thread
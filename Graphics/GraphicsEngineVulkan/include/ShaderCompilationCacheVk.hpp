@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderCompilationCacheVk class
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Shader.h"
+#include "ShaderBase.hpp"
+#include "SPIRVShaderResources.hpp"
+#include "../../GraphicsTools/interface/XXH128Hasher.hpp"
+
+namespace Diligent
+{
+
+/// Device-level cache of the intermediate results of shader compilation.
+
+/// Shader creation is split into three stages:
+/// - Preprocessing: includes are unrolled and the preprocessed source is combined with
+///   the compilation parameters into the key of the SPIR-V cache. Entries are looked up by
+///   the XXH128 hash of the key, and the key itself is only kept to detect hash collisions.
+/// - Compilation: the shader is compiled to SPIR-V. Shaders with identical preprocessed sources
+///   and parameters share one compilation, e.g. the same shader created multiple times, or the same
+///   source loaded from different files. Macros are part of the parameters, so permutations never
+///   share the compilation even if they differ only by macros that the source does not use.
+///   The compiler is given the original create info, so that compiler messages refer to
+///   the original files and line numbers.
+/// - Reflection: shader resources are loaded from the SPIR-V. Reflection is cached per SPIR-V
+///   entry and is reused by shaders with the same description.
+///
+/// When shaders are compiled asynchronously, every stage runs as a separate task in the
+/// compilation thread pool, so that reflection of one shader overlaps with compilation of others.
+///
+/// The cache only keeps weak references to the entries: an entry is released when
+/// the last shader that uses it is destroyed.
+class ShaderCompilationCacheVk
+{
+public:
+    ShaderCompilationCacheVk() = default;
+
+    // clang-format off
+    ShaderCompilationCacheVk             (const ShaderCompilationCacheVk&) = delete;
+    ShaderCompilationCacheVk             (ShaderCompilationCacheVk&&)      = delete;
+    ShaderCompilationCacheVk& operator = (const ShaderCompilationCacheVk&) = delete;
+    ShaderCompilationCacheVk& operator = (ShaderCompilationCacheVk&&)      = delete;
+    // clang-format on
+
+    using CompileFuncType = std::function<std::vector<uint32_t>(const ShaderCreateInfo&)>;
+
+    /// Reflection of the SPIR-V byte code.
+    struct Reflection
+    {
+        std::shared_ptr<const SPIRVShaderResources> pResources;
+        std::string                                 EntryPoint;
+    };
+
+    /// SPIR-V byte code shared by all shaders with the same preprocessed source and compilation parameters.
+    class SPIRVEntry
+    {
+    public:
+        SPIRVEntry(ShaderCreateInfoWrapper&& ShaderCI, CompileFuncType&& CompileFunc, std::string&& Key = {}) noexcept;
+
+        /// Compiles the byte code, if it has not been compiled yet.
+
+        /// \param [in] Wait - Whether to wait for the compilation if it is being
+        ///                    performed by another thread.
+        ///
+        /// \return     true if the compilation is complete (successfully or not), and false if
+        ///             the byte code is being compiled by another thread and Wait is false.
+        bool Compile(bool Wait);
+
+        /// Returns true if the compilation is complete (successfully or not).
+        bool IsCompiled() const { return m_Status.load() != Status::Pending; }
+
+        /// Returns true if the byte code has been compiled successfully.
+        bool IsValid() const { return m_Status.load() == Status::Compiled; }
+
+        /// Returns the compiled byte code. Must only be called after the compilation is complete.
+
+        /// \remarks   Vertex inputs of HLSL vertex shaders are remapped by the first call to GetReflection(),
+        ///             so the byte code must only be used after the reflection has been loaded.
+        const std::vector<uint32_t>& GetSPIRV() const
+        {
+            VERIFY(IsCompiled(), "SPIR-V has not been compiled");
+            return m_SPIRV;
+        }
+
+        /// Returns the reflection of the byte code for the given shader description, loading it if necessary.
+        Reflection GetReflection(const ShaderDesc& Desc,
+                                 const char*       CombinedSamplerSuffix,
+                                 bool              LoadShaderInputs,
+                                 bool              LoadConstantBufferReflection) noexcept(false);
+
+    private:
+        friend class ShaderCompilationCacheVk;
+
+        enum class Status
+        {
+            Pending,
+            Compiled,
+            Failed
+        };
+
+        std::mutex          m_CompileMtx;
+        std::atomic<Status> m_Status{Status::Pending};
+
+        // Released when the compilation is complete
+        ShaderCreateInfoWrapper m_ShaderCI;
+        CompileFuncType         m_CompileFunc;
+
+        std::vector<uint32_t> m_SPIRV;
+
+        // The compilation key, used by the cache to detect hash collisions.
+        // Empty if the entry is not shared.
+        const std::string m_Key;
+
+        struct ReflectionInfo
+        {
+            std::string Name;
+            std::string CombinedSamplerSuffix;
+            bool        UseCombinedSamplers          = false;
+            SHADER_TYPE ShaderType                   = SHADER_TYPE_UNKNOWN;
+            bool        LoadShaderInputs             = false;
+            bool        LoadConstantBufferReflection = false;
+            Reflection  Refl;
+        };
+        std::mutex                  m_ReflectionsMtx;
+        std::vector<ReflectionInfo> m_Reflections;
+        // Protected by m_ReflectionsMtx
+        bool m_HLSLVertexInputsMapped = false;
+    };
+    using SPIRVEntryPtr = std::shared_ptr<SPIRVEntry>;
+
+    /// Preprocesses the shader and returns the SPIR-V entry for it.
+
+    /// \param [in]  ShaderCI    - Shader create info.
+    /// \param [in]  Compiler    - The compiler that will be used to compile the shader.
+    /// \param [in]  CompileFunc - The function that compiles the shader.
+    /// \param [out] IsNew       - Whether the entry has been created by this call and
+    ///                            needs to be compiled.
+    ///
+    /// \return     The SPIR-V entry. An existing entry may be compiled or being compiled by another thread.
+    ///
+    /// \remarks    The new entry compiles the original create info. The preprocessed source
+    ///             is only used to find the entries that can be shared.
+    ///
+    ///             If the shader can't be preprocessed (e.g. one of its includes can't be found),
+    ///             an entry that is not shared with other shaders is returned, and the error
+    ///             is reported by the compiler.
+    SPIRVEntryPtr Preprocess(const ShaderCreateInfo& ShaderCI,
+                             SHADER_COMPILER         Compiler,
+                             CompileFuncType         CompileFunc,
+                             bool&                   IsNew) noexcept(false);
+
+    /// Returns the number of live entries in the cache.
+    size_t GetEntryCount() const;
+
+private:
+    static std::string GetCompilationKey(const ShaderCreateInfo& ShaderCI, SHADER_COMPILER Compiler, const std::string& Source);
+
+    void PurgeUnsafe();
+
+    mutable std::mutex m_Mtx;
+
+    // Compilation key hash -> entry
+    std::unordered_map<XXH128Hash, std::weak_ptr<SPIRVEntry>> m_Entries;
+
+    static constexpr size_t MinPurgeThreshold = 64;
+
+    // The number of entries that triggers the next purge of expired entries
+    size_t m_PurgeThreshold = MinPurgeThreshold;
+};
+
+} // namespace Diligent
@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderModuleCacheVk class
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+/// Shader module cache that lets pipelines created together share Vulkan shader modules
+/// with identical SPIR-V byte code.
+
+/// The cache owns the modules it creates and destroys them when it is destroyed.
+/// Since shader modules are not needed after the pipeline has been created, the cache
+/// only needs to live as long as the pipelines that use it are being initialized.
+/// The cache is thread-safe.
+class ShaderModuleCacheVk
+{
+public:
+    ShaderModuleCacheVk() = default;
+
+    // clang-format off
+    ShaderModuleCacheVk             (const ShaderModuleCacheVk&) = delete;
+    ShaderModuleCacheVk             (ShaderModuleCacheVk&&)      = delete;
+    ShaderModuleCacheVk& operator = (const ShaderModuleCacheVk&) = delete;
+    ShaderModuleCacheVk& operator = (ShaderModuleCacheVk&&)      = delete;
+    // clang-format on
+
+    using CreateModuleFuncType = std::function<VulkanUtilities::ShaderModuleWrapper(const std::vector<uint32_t>& SPIRV)>;
+
+    /// Returns the shader module for the given SPIR-V byte code, creating it if necessary.
+
+    /// \param [in] SPIRV        - SPIR-V byte code.
+    /// \param [in] CreateModule - Function that creates the shader module from the byte code.
+    ///
+    /// \return     The module that remains valid until the cache is destroyed.
+    VkShaderModule GetShaderModule(const std::vector<uint32_t>& SPIRV, const CreateModuleFuncType& CreateModule) noexcept(false);
+
+    /// Returns the number of shader modules in the cache.
+    size_t GetModuleCount() const;
+
+private:
+    VkShaderModule FindModule(size_t Hash, const std::vector<uint32_t>& SPIRV) const;
+
+    struct ModuleInfo
+    {
+        std::vector<uint32_t>                SPIRV;
+        VulkanUtilities::ShaderModuleWrapper Module;
+    };
+
+    mutable std::mutex m_Mtx;
+    // SPIR-V hash -> shader module
+    std::unordered_multimap<size_t, ModuleInfo> m_Modules;
+};
+
+} // namespace Diligent
@@ -44,7 +44,7 @@ namespace Diligent
 class PipelineResourceSignatureVkImpl;
 
 /// Implementation of the Diligent::IShaderResourceBindingVk interface
-// sizeof(ShaderResourceBindingVkImpl) == 64 (x64, msvc, Release)
+// sizeof(ShaderResourceBindingVkImpl) == 72 (x64, msvc, Release)
 class ShaderResourceBindingVkImpl final : public ShaderResourceBindingBase<EngineVkImplTraits>
 {
 public:
@@ -55,6 +55,9 @@ public:
     ~ShaderResourceBindingVkImpl();
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBindingVk, TBase)
+
+    /// Implementation of IShaderResourceBinding::SetVariables() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings) override final;
 };
 
 } // namespace Diligent
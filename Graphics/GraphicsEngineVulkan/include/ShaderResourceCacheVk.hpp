@@ -55,6 +55,7 @@
 
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
@@ -68,7 +69,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 56 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -245,6 +246,56 @@ public:
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
 
+    // Accumulates descriptor writes so that they can be issued with a single vkUpdateDescriptorSets call.
+    // Writes to consecutive elements of the same binding are merged into one VkWriteDescriptorSet.
+    class DescriptorWriteBatch
+    {
+    public:
+        void Add(const VkWriteDescriptorSet& Write);
+        void Flush(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice);
+
+        bool IsEmpty() const { return m_Writes.empty(); }
+
+    private:
+        std::vector<VkWriteDescriptorSet> m_Writes;
+        // Index of the first descriptor info of every write in the array that corresponds to its type
+        std::vector<size_t> m_FirstInfoIndices;
+
+        std::vector<VkDescriptorImageInfo>                        m_ImageInfos;
+        std::vector<VkDescriptorBufferInfo>                       m_BufferInfos;
+        std::vector<VkBufferView>                                 m_TexelBufferViews;
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR> m_AccelStructInfos;
+        // Copies of the acceleration structure handles referenced by m_AccelStructInfos,
+        // so that the batch does not point to the memory of the TLAS objects.
+        std::vector<VkAccelerationStructureKHR> m_AccelStructs;
+    };
+
+    // Sets the batch that accumulates descriptor writes made by SetResource().
+    // When the batch is null, descriptors are written immediately.
+    void SetDescriptorWriteBatch(DescriptorWriteBatch* pBatch)
+    {
+        VERIFY(pBatch == nullptr || m_pWriteBatch == nullptr, "Another descriptor write batch is already active");
+        m_pWriteBatch = pBatch;
+    }
+
+    // The descriptor image is a packed array of descriptor infos (VkDescriptorImageInfo, VkDescriptorBufferInfo,
+    // VkBufferView or VkAccelerationStructureKHR) of one descriptor set, one entry of DescriptorImageStride bytes
+    // per cache offset. It is kept up to date by SetResource() and is the source data of the descriptor update
+    // template that writes the set with a single vkUpdateDescriptorSetWithTemplate call.
+    static constexpr size_t DescriptorImageStride = std::max({sizeof(VkDescriptorImageInfo),
+                                                              sizeof(VkDescriptorBufferInfo),
+                                                              sizeof(VkBufferView),
+                                                              sizeof(VkAccelerationStructureKHR)});
+
+    // Allocates the descriptor image for the given descriptor set.
+    // Must be called after the resources have been initialized and before any resource is set.
+    void InitializeDescriptorImage(IMemoryAllocator& MemAllocator, Uint32 SetIndex);
+
+    const void* GetDescriptorImage() const { return m_pDescriptorImage.get(); }
+
+    // Returns the number of non-null descriptors in the descriptor image.
+    // Separate immutable samplers are not counted as they are never written.
+    Uint32 GetDescriptorImageEntryCount() const { return m_NumDescriptorImageEntries; }
 
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
@@ -280,8 +331,16 @@ private:
         return reinterpret_cast<DescriptorSet*>(m_pMemory.get())[Index];
     }
 
+    void WriteDescriptorImageEntry(Uint32 CacheOffset, const Resource& Res);
+
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    // Active descriptor write batch, see SetDescriptorWriteBatch()
+    DescriptorWriteBatch* m_pWriteBatch = nullptr;
+
+    // Descriptor image of the set with index m_DescriptorImageSet, see InitializeDescriptorImage()
+    std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pDescriptorImage;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
@@ -292,6 +351,9 @@ private:
     // Indicates what types of resources are stored in the cache
     const Uint32 m_ContentType : 1;
 
+    Uint32 m_NumDescriptorImageEntries = 0;
+    Uint16 m_DescriptorImageSet        = 0;
+
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
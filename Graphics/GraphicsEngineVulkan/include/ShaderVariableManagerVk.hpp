@@ -71,7 +71,7 @@ namespace Diligent
 
 class ShaderVariableVkImpl;
 
-// sizeof(ShaderVariableManagerVk) == 40 (x64, msvc, Release)
+// sizeof(ShaderVariableManagerVk) == 48 (x64, msvc, Release)
 class ShaderVariableManagerVk : ShaderVariableManagerBase<EngineVkImplTraits, ShaderVariableVkImpl>
 {
 public:
@@ -89,6 +89,8 @@ public:
 
     void Destroy(IMemoryAllocator& Allocator);
 
+    using TBase::SetNameHash;
+
     ShaderVariableVkImpl* GetVariable(const Char* Name) const;
     ShaderVariableVkImpl* GetVariable(Uint32 Index) const;
 
@@ -33,6 +33,7 @@
 #include "EngineVkImplTraits.hpp"
 #include "ShaderBase.hpp"
 #include "SPIRVShaderResources.hpp"
+#include "ShaderCompilationCacheVk.hpp"
 #include "ThreadPool.h"
 #include "RefCntAutoPtr.hpp"
 
@@ -58,6 +59,10 @@ public:
         const bool                 HasSpirv14;
         IDataBlob** const          ppCompilerOutput;
         IThreadPool* const         pCompilationThreadPool;
+
+        // Optional cache that is used to share the byte code and the reflection
+        // between shaders with the same preprocessed source.
+        ShaderCompilationCacheVk* const pCompilationCache = nullptr;
     };
     ShaderVkImpl(IReferenceCounters*     pRefCounters,
                  RenderDeviceVkImpl*     pRenderDeviceVk,
@@ -85,9 +90,9 @@ public:
     virtual const std::vector<uint32_t>& DILIGENT_CALL_TYPE GetSPIRV() const override final
     {
         static const std::vector<uint32_t> NullSPIRV;
-        // NOTE: while shader is compiled asynchronously, m_SPIRV may be modified by
+        // NOTE: while shader is compiled asynchronously, m_pSPIRVEntry may be modified by
         //       another thread and thus can't be accessed.
-        return !IsCompiling() ? m_SPIRV : NullSPIRV;
+        return !IsCompiling() && m_pSPIRVEntry ? m_pSPIRVEntry->GetSPIRV() : NullSPIRV;
     }
 
     const std::shared_ptr<const SPIRVShaderResources>& GetShaderResources() const
@@ -106,19 +111,27 @@ public:
                                                 Uint64&      Size) const override final
     {
         DEV_CHECK_ERR(!IsCompiling(), "Shader byte code is not available until the shader is compiled. Use GetStatus() to check the shader status.");
-        *ppBytecode = !m_SPIRV.empty() ? m_SPIRV.data() : nullptr;
-        Size        = m_SPIRV.size() * sizeof(m_SPIRV[0]);
+        const std::vector<uint32_t>& SPIRV = GetSPIRV();
+
+        *ppBytecode = !SPIRV.empty() ? SPIRV.data() : nullptr;
+        Size        = SPIRV.size() * sizeof(SPIRV[0]);
     }
 
 private:
-    void Initialize(const ShaderCreateInfo& ShaderCI,
-                    const CreateInfo&       VkShaderCI) noexcept(false);
+    // Initializes the shader from the compiled byte code and loads the reflection.
+    void Initialize(ShaderCompilationCacheVk::SPIRVEntry& SPIRVEntry,
+                    SHADER_COMPILE_FLAGS                  CompileFlags,
+                    bool                                  LoadConstantBufferReflection,
+                    const char*                           EntryPoint) noexcept(false);
 
 private:
     std::shared_ptr<const SPIRVShaderResources> m_pShaderResources;
 
-    std::string           m_EntryPoint;
-    std::vector<uint32_t> m_SPIRV;
+    // The byte code of the shader. When the compilation cache is used, the entry is shared
+    // with other shaders, which keeps the byte code and reflection alive for them.
+    ShaderCompilationCacheVk::SPIRVEntryPtr m_pSPIRVEntry;
+
+    std::string m_EntryPoint;
 };
 
 } // namespace Diligent
@@ -2204,7 +2204,41 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
 
     if (SubresData.pSrcBuffer != nullptr)
     {
-        UNSUPPORTED("Copying buffer to texture is not implemented");
+        auto* pSrcBuffVk = ClassPtrCast<BufferVkImpl>(SubresData.pSrcBuffer);
+        DEV_CHECK_ERR(pSrcBuffVk->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers can't be used as the source of texture updates");
+
+        const auto& FmtAttribs = GetTextureFormatAttribs(pTexVk->GetDesc().Format);
+        // bufferRowLength is specified in texels, so the stride must be a multiple of the texel block size
+        const auto TexelBlockSize = Uint64{FmtAttribs.GetElementSize()};
+        DEV_CHECK_ERR((SubresData.Stride % TexelBlockSize) == 0, "Source buffer stride (", SubresData.Stride,
+                      ") must be a multiple of the texel block size (", TexelBlockSize, ")");
+        const auto BlockWidth        = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ? Uint64{FmtAttribs.BlockWidth} : Uint64{1};
+        const auto RowStrideInTexels = StaticCast<Uint32>(SubresData.Stride / TexelBlockSize * BlockWidth);
+
+        const auto UpdateRegionDepth = DstBox.Depth();
+        // bufferImageHeight can only express the depth stride that is a multiple of the row stride,
+        // so depth slices are copied one by one, each from its own offset.
+        DEV_CHECK_ERR(UpdateRegionDepth == 1 || (SubresData.DepthStride % TexelBlockSize) == 0,
+                      "Source buffer depth stride (", SubresData.DepthStride, ") must be a multiple of the texel block size (", TexelBlockSize, ")");
+
+        EnsureVkCmdBuffer();
+        TransitionOrVerifyBufferState(*pSrcBuffVk, SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT,
+                                      "Using buffer as copy source (DeviceContextVkImpl::UpdateTexture)");
+        for (Uint32 DepthSlice = 0; DepthSlice < UpdateRegionDepth; ++DepthSlice)
+        {
+            Box SliceBox  = DstBox;
+            SliceBox.MinZ = DstBox.MinZ + DepthSlice;
+            SliceBox.MaxZ = SliceBox.MinZ + 1;
+            CopyBufferToTexture(pSrcBuffVk->GetVkBuffer(),
+                                SubresData.SrcOffset + DepthSlice * SubresData.DepthStride,
+                                RowStrideInTexels,
+                                *pTexVk,
+                                SliceBox,
+                                MipLevel,
+                                Slice,
+                                TextureStateTransitionMode);
+            ++m_State.NumCommands;
+        }
     }
     else
     {
@@ -1136,6 +1136,11 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+#if DILIGENT_USE_VOLK
+            // Descriptor update templates are used to write dynamic descriptor sets when available.
+            EnabledExtFeats.DescriptorUpdateTemplate = DeviceExtFeatures.DescriptorUpdateTemplate;
+#endif
+
             {
                 vkEnabledFeatures.multiDrawIndirect = vkDeviceFeatures.multiDrawIndirect;
                 if (DeviceExtFeatures.DrawIndirectCount)
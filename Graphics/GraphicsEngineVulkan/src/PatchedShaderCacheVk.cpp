@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "PatchedShaderCacheVk.hpp"
+
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+VkShaderModule PatchedShaderCacheVk::Entry::GetShaderModule(const CreateModuleFuncType& CreateModule) noexcept(false)
+{
+    std::lock_guard<std::mutex> Lock{m_ModuleMtx};
+    if (m_Module == VK_NULL_HANDLE)
+        m_Module = CreateModule(SPIRV);
+    return m_Module;
+}
+
+size_t PatchedShaderCacheVk::BindingsHasher::operator()(const std::vector<Uint32>& Bindings) const
+{
+    return ComputeHashRaw(Bindings.data(), Bindings.size() * sizeof(Uint32));
+}
+
+PatchedShaderCacheVk::EntryPtr PatchedShaderCacheVk::Find(UniqueIdentifier ShaderId, const std::vector<Uint32>& Bindings) const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto shader_it = m_Shaders.find(ShaderId);
+    if (shader_it == m_Shaders.end())
+        return {};
+
+    const auto& Entries  = shader_it->second;
+    auto        entry_it = Entries.find(Bindings);
+    return entry_it != Entries.end() ? entry_it->second : EntryPtr{};
+}
+
+PatchedShaderCacheVk::EntryPtr PatchedShaderCacheVk::Add(UniqueIdentifier ShaderId, std::vector<Uint32>&& Bindings, std::vector<uint32_t>&& SPIRV)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto& pEntry = m_Shaders[ShaderId][std::move(Bindings)];
+    if (!pEntry)
+        pEntry = std::make_shared<Entry>(std::move(SPIRV));
+
+    return pEntry;
+}
+
+void PatchedShaderCacheVk::RemoveShader(UniqueIdentifier ShaderId)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_Shaders.erase(ShaderId);
+}
+
+size_t PatchedShaderCacheVk::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    size_t Count = 0;
+    for (const auto& it : m_Shaders)
+        Count += it.second.size();
+    return Count;
+}
+
+} // namespace Diligent
@@ -88,19 +88,20 @@ DescriptorType GetDescriptorType(const PipelineResourceDesc& Res)
     }
 }
 
-Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
-                              DescriptorType                       DescType,
-                              const PipelineResourceSignatureDesc& Desc,
-                              const char*                          SamplerSuffix)
+Uint32 FindImmutableSamplerVk(const PipelineResourceSignatureVkImpl& Signature,
+                              const PipelineResourceDesc&            Res,
+                              DescriptorType                         DescType)
 {
+    bool UseCombinedSamplerSuffix = false;
     if (DescType == DescriptorType::CombinedImageSampler)
     {
-        SamplerSuffix = nullptr;
+        UseCombinedSamplerSuffix = false;
     }
     else if (DescType == DescriptorType::Sampler)
     {
         // Use SamplerSuffix. If HLSL-style combined image samplers are not used,
         // SamplerSuffix will be null and we will be looking for the sampler itself.
+        UseCombinedSamplerSuffix = true;
     }
     else
     {
@@ -108,7 +109,7 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
         return InvalidImmutableSamplerIndex;
     }
 
-    return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
+    return Signature.FindImmutableSampler(Res.ShaderStages, Res.Name, UseCombinedSamplerSuffix);
 }
 
 } // namespace
@@ -277,7 +278,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             // Only search for immutable sampler for combined image samplers and separate samplers.
             // Note that for DescriptorType::SeparateImage with immutable sampler, we will initialize
             // a separate immutable sampler below. It will not be assigned to the image variable.
-            const Uint32 SrcImmutableSamplerInd = FindImmutableSamplerVk(ResDesc, DescrType, m_Desc, GetCombinedSamplerSuffix());
+            const Uint32 SrcImmutableSamplerInd = FindImmutableSamplerVk(*this, ResDesc, DescrType);
             if (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex)
             {
                 const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk = m_pImmutableSamplers[SrcImmutableSamplerInd];
@@ -470,9 +471,60 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && LogicalDevice.GetEnabledExtFeatures().DescriptorUpdateTemplate)
+            CreateDynamicSetUpdateTemplate();
     }
 }
 
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    VERIFY_EXPR(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC));
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    // Every resource is read from the descriptor image at its cache offset, see ShaderResourceCacheVk::WriteDescriptorImageEntry().
+    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+    Entries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+
+    Uint32 NumDescriptors = 0;
+    for (Uint32 r = DynResIdxRange.first; r < DynResIdxRange.second; ++r)
+    {
+        const PipelineResourceAttribsType& Attr      = GetResourceAttribs(r);
+        const DescriptorType               DescrType = Attr.GetDescriptorType();
+        VERIFY_EXPR(GetResourceDesc(r).VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+        // Immutable samplers are permanently bound into the set layout and must not be written
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = size_t{Attr.CacheOffset(CacheType)} * ShaderResourceCacheVk::DescriptorImageStride;
+        Entry.stride          = ShaderResourceCacheVk::DescriptorImageStride;
+        Entries.push_back(Entry);
+
+        NumDescriptors += Attr.ArraySize;
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_VkDynamicSetUpdateTemplate        = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+    m_DynamicSetTemplateDescriptorCount = NumDescriptors;
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
@@ -480,6 +532,9 @@ PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 
 void PipelineResourceSignatureVkImpl::Destruct()
 {
+    if (m_VkDynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_VkDynamicSetUpdateTemplate), ~0ull);
+
     for (auto& Layout : m_VkDescrSetLayouts)
     {
         if (Layout)
@@ -514,6 +569,9 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    if (m_VkDynamicSetUpdateTemplate)
+        ResourceCache.InitializeDescriptorImage(GetRawAllocator(), GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>());
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -612,6 +670,15 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    // Null descriptors can't be skipped by the update template, so the template is only
+    // used when all dynamic resources are bound. Otherwise, fall back to individual writes.
+    if (m_VkDynamicSetUpdateTemplate && ResourceCache.GetDescriptorImageEntryCount() == m_DynamicSetTemplateDescriptorCount)
+    {
+        VERIFY_EXPR(ResourceCache.GetDescriptorImage() != nullptr);
+        GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_VkDynamicSetUpdateTemplate, ResourceCache.GetDescriptorImage());
+        return;
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -57,6 +57,8 @@ namespace
 
 void InitPipelineShaderStages(const VulkanUtilities::VulkanLogicalDevice&        LogicalDevice,
                               PipelineStateVkImpl::TShaderStages&                ShaderStages,
+                              const PipelineStateVkImpl::TPatchedShaders&        PatchedShaders,
+                              PipelineStateVkImpl::TShaderModuleCache*           pModuleCache,
                               std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
                               std::vector<VkPipelineShaderStageCreateInfo>&      Stages)
 {
@@ -74,22 +76,42 @@ void InitPipelineShaderStages(const VulkanUtilities::VulkanLogicalDevice&
         StageCI.flags = 0; //  reserved for future use
         StageCI.stage = ShaderTypeToVkShaderStageFlagBit(ShaderType);
 
-        VkShaderModuleCreateInfo ShaderModuleCI{};
-        ShaderModuleCI.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        ShaderModuleCI.pNext = nullptr;
-        ShaderModuleCI.flags = 0;
-
         for (size_t i = 0; i < Shaders.size(); ++i)
         {
             auto* pShader = Shaders[i];
-            auto& SPIRV   = SPIRVs[i];
 
-            ShaderModuleCI.codeSize = SPIRV.size() * sizeof(uint32_t);
-            ShaderModuleCI.pCode    = SPIRV.data();
+            // Patched shaders are in the same order as the stages
+            PatchedShaderCacheVk::Entry* pPatchedShader = !PatchedShaders.empty() ? PatchedShaders[Stages.size()].get() : nullptr;
+
+            // When the shader is found in the patched shader cache, the stage byte code is not patched
+            const auto& SPIRV = pPatchedShader != nullptr ? pPatchedShader->SPIRV : SPIRVs[i];
 
-            ShaderModules.push_back(LogicalDevice.CreateShaderModule(ShaderModuleCI, pShader->GetDesc().Name));
+            const auto CreateShaderModule = [&](const std::vector<uint32_t>& ModuleSPIRV) {
+                VkShaderModuleCreateInfo ShaderModuleCI{};
+                ShaderModuleCI.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+                ShaderModuleCI.pNext    = nullptr;
+                ShaderModuleCI.flags    = 0;
+                ShaderModuleCI.codeSize = ModuleSPIRV.size() * sizeof(uint32_t);
+                ShaderModuleCI.pCode    = ModuleSPIRV.data();
+                return LogicalDevice.CreateShaderModule(ShaderModuleCI, pShader->GetDesc().Name);
+            };
 
-            StageCI.module              = ShaderModules.back();
+            if (pModuleCache != nullptr)
+            {
+                // Modules with identical byte code are shared with other pipelines that use the same cache
+                StageCI.module = pModuleCache->GetShaderModule(SPIRV, CreateShaderModule);
+            }
+            else if (pPatchedShader != nullptr)
+            {
+                // The module is owned by the device-level cache entry
+                StageCI.module = pPatchedShader->GetShaderModule(CreateShaderModule);
+            }
+            else
+            {
+                ShaderModules.push_back(CreateShaderModule(SPIRV));
+
+                StageCI.module = ShaderModules.back();
+            }
             StageCI.pName               = pShader->GetEntryPoint();
             StageCI.pSpecializationInfo = nullptr;
 
@@ -97,7 +119,8 @@ void InitPipelineShaderStages(const VulkanUtilities::VulkanLogicalDevice&
         }
     }
 
-    VERIFY_EXPR(ShaderModules.size() == Stages.size());
+    VERIFY_EXPR(PatchedShaders.empty() || PatchedShaders.size() == Stages.size());
+    VERIFY_EXPR(pModuleCache != nullptr || !PatchedShaders.empty() || ShaderModules.size() == Stages.size());
 }
 
 
@@ -633,8 +656,13 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
     bool                                                 bStripReflection,
     const char*                                          PipelineName,
     TShaderResources*                                    pDvpShaderResources,
-    TResourceAttibutions*                                pDvpResourceAttibutions) noexcept(false)
+    TResourceAttibutions*                                pDvpResourceAttibutions,
+    PatchedShaderCacheVk*                                pPatchedShaderCache,
+    TPatchedShaders*                                     pPatchedShaders) noexcept(false)
 {
+    VERIFY(pPatchedShaderCache == nullptr || bStripReflection, "Patched shader cache is only used when reflection is stripped");
+    VERIFY((pPatchedShaderCache != nullptr) == (pPatchedShaders != nullptr), "Patched shader cache and patched shaders must both be null or non-null");
+
     if (PipelineName == nullptr)
         PipelineName = "<null>";
 
@@ -659,8 +687,12 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
             if (pDvpShaderResources)
                 pDvpShaderResources->emplace_back(pShaderResources);
 
+            // (binding, descriptor set) pairs of all shader resources. This is the only part of the
+            // pipeline layout that affects the patched byte code, and it is used as the cache key.
+            std::vector<Uint32> Bindings(size_t{pShaderResources->GetTotalResources()} * 2);
+
             pShaderResources->ProcessResources(
-                [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32) //
+                [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32 ResIndex) //
                 {
                     const auto ResAttribution = GetResourceAttribution(SPIRVAttribs.Name, ShaderType, pSignatures, SignatureCount);
                     if (!ResAttribution)
@@ -723,16 +755,36 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                                                 SignDesc.Name, "' is mapped to set ", DescriptorSet, '.');
                         }
                     }
-                    else
-                    {
-                        SPIRV[SPIRVAttribs.BindingDecorationOffset]       = ResourceBinding;
-                        SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset] = DescriptorSet;
-                    }
+
+                    Bindings[size_t{ResIndex} * 2 + 0] = ResourceBinding;
+                    Bindings[size_t{ResIndex} * 2 + 1] = DescriptorSet;
 
                     if (pDvpResourceAttibutions)
                         pDvpResourceAttibutions->emplace_back(ResAttribution);
                 });
 
+            if (pPatchedShaderCache != nullptr)
+            {
+                if (PatchedShaderCacheVk::EntryPtr pPatchedShader = pPatchedShaderCache->Find(pShader->GetUniqueID(), Bindings))
+                {
+                    // Another pipeline has already patched the shader for the same bindings and
+                    // stripped reflection. The shader module is created from the entry byte code,
+                    // so the SPIR-V of the stage is left unpatched.
+                    pPatchedShaders->emplace_back(std::move(pPatchedShader));
+                    continue;
+                }
+            }
+
+            if (!bVerifyOnly)
+            {
+                pShaderResources->ProcessResources(
+                    [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32 ResIndex) //
+                    {
+                        SPIRV[SPIRVAttribs.BindingDecorationOffset]       = Bindings[size_t{ResIndex} * 2 + 0];
+                        SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset] = Bindings[size_t{ResIndex} * 2 + 1];
+                    });
+            }
+
             if (bStripReflection)
             {
 #if !DILIGENT_NO_HLSL
@@ -747,11 +799,17 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                     LOG_ERROR("Failed to strip reflection information from shader '", pShader->GetDesc().Name, "'. This may indicate a problem with the byte code.");
 #endif
             }
+
+            if (pPatchedShaderCache != nullptr)
+            {
+                // The byte code is moved to the cache entry, and the shader module is created from the entry
+                pPatchedShaders->emplace_back(pPatchedShaderCache->Add(pShader->GetUniqueID(), std::move(Bindings), std::move(SPIRV)));
+            }
         }
     }
 }
 
-void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& CreateInfo, TShaderStages& ShaderStages) noexcept(false)
+void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& CreateInfo, TShaderStages& ShaderStages, TPatchedShaders& PatchedShaders) noexcept(false)
 {
     const auto InternalFlags = GetInternalCreateFlags(CreateInfo);
     if (m_UsingImplicitSignature && (InternalFlags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
@@ -785,19 +843,22 @@ void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& Crea
                                      true,           // bStripReflection
                                      m_Desc.Name,
 #ifdef DILIGENT_DEVELOPMENT
-                                     &m_ShaderResources, &m_ResourceAttibutions
+                                     &m_ShaderResources, &m_ResourceAttibutions,
 #else
-                                     nullptr, nullptr
+                                     nullptr, nullptr,
 #endif
-        );
+                                     &GetDevice()->GetPatchedShaderCache(),
+                                     &PatchedShaders);
     }
 }
 
 template <typename PSOCreateInfoType>
 PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
     const PSOCreateInfoType&                           CreateInfo,
+    TShaderModuleCache*                                pModuleCache,
     std::vector<VkPipelineShaderStageCreateInfo>&      vkShaderStages,
-    std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules) noexcept(false)
+    std::vector<VulkanUtilities::ShaderModuleWrapper>& ShaderModules,
+    TPatchedShaders&                                   PatchedShaders) noexcept(false)
 {
     TShaderStages ShaderStages;
     ExtractShaders<ShaderVkImpl>(CreateInfo, ShaderStages, /*WaitUntilShadersReady = */ true);
@@ -812,20 +873,24 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
 
     InitializePipelineDesc(CreateInfo, MemPool);
 
-    InitPipelineLayout(CreateInfo, ShaderStages);
+    InitPipelineLayout(CreateInfo, ShaderStages, PatchedShaders);
 
     // Create shader modules and initialize shader stages
-    InitPipelineShaderStages(LogicalDevice, ShaderStages, ShaderModules, vkShaderStages);
+    InitPipelineShaderStages(LogicalDevice, ShaderStages, PatchedShaders, pModuleCache, ShaderModules, vkShaderStages);
 
     return ShaderStages;
 }
 
 void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
 {
+    // Keep the shared module cache alive until the pipeline is created and release it afterwards
+    const std::shared_ptr<TShaderModuleCache> pModuleCache = std::move(m_pShaderModuleCache);
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TPatchedShaders                                   PatchedShaders;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    InitInternalObjects(CreateInfo, pModuleCache.get(), vkShaderStages, ShaderModules, PatchedShaders);
 
     const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
     CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
@@ -833,10 +898,14 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
+    // Keep the shared module cache alive until the pipeline is created and release it afterwards
+    const std::shared_ptr<TShaderModuleCache> pModuleCache = std::move(m_pShaderModuleCache);
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TPatchedShaders                                   PatchedShaders;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    InitInternalObjects(CreateInfo, pModuleCache.get(), vkShaderStages, ShaderModules, PatchedShaders);
 
     const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
     CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
@@ -846,10 +915,14 @@ void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreate
 {
     const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
 
+    // Keep the shared module cache alive until the pipeline is created and release it afterwards
+    const std::shared_ptr<TShaderModuleCache> pModuleCache = std::move(m_pShaderModuleCache);
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+    TPatchedShaders                                   PatchedShaders;
 
-    const auto ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const auto ShaderStages   = InitInternalObjects(CreateInfo, pModuleCache.get(), vkShaderStages, ShaderModules, PatchedShaders);
     const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
     const auto vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
 
@@ -869,20 +942,32 @@ inline std::vector<const ShaderVkImpl*> GetStageShaders(const PipelineStateVkImp
     return Stage.Shaders;
 }
 
-PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const GraphicsPipelineStateCreateInfo& CreateInfo) :
-    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo}
+PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                        pRefCounters,
+                                         RenderDeviceVkImpl*                        pDeviceVk,
+                                         const GraphicsPipelineStateCreateInfo&     CreateInfo,
+                                         const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache) :
+    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo},
+    m_pShaderModuleCache{pShaderModuleCache}
 {
     Construct<ShaderVkImpl>(CreateInfo);
 }
 
-PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const ComputePipelineStateCreateInfo& CreateInfo) :
-    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo}
+PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                        pRefCounters,
+                                         RenderDeviceVkImpl*                        pDeviceVk,
+                                         const ComputePipelineStateCreateInfo&      CreateInfo,
+                                         const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache) :
+    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo},
+    m_pShaderModuleCache{pShaderModuleCache}
 {
     Construct<ShaderVkImpl>(CreateInfo);
 }
 
-PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters* pRefCounters, RenderDeviceVkImpl* pDeviceVk, const RayTracingPipelineStateCreateInfo& CreateInfo) :
-    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo}
+PipelineStateVkImpl::PipelineStateVkImpl(IReferenceCounters*                        pRefCounters,
+                                         RenderDeviceVkImpl*                        pDeviceVk,
+                                         const RayTracingPipelineStateCreateInfo&   CreateInfo,
+                                         const std::shared_ptr<TShaderModuleCache>& pShaderModuleCache) :
+    TPipelineStateBase{pRefCounters, pDeviceVk, CreateInfo},
+    m_pShaderModuleCache{pShaderModuleCache}
 {
     Construct<ShaderVkImpl>(CreateInfo);
 }
@@ -579,6 +579,24 @@ void RenderDeviceVkImpl::CreateRayTracingPipelineState(const RayTracingPipelineS
     CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
 }
 
+void RenderDeviceVkImpl::CreatePipelineStates(const PipelineStateCreateInfo* const* ppCreateInfos,
+                                              Uint32                                NumPipelines,
+                                              IPipelineState**                      ppPipelineStates)
+{
+    // Pipelines in the batch share shader modules with identical SPIR-V.
+    // Every pipeline keeps a reference to the cache until it is initialized, so the
+    // modules are destroyed as soon as the last pipeline in the batch has been created.
+    std::shared_ptr<PipelineStateVkImpl::TShaderModuleCache> pModuleCache;
+    if (NumPipelines > 1)
+        pModuleCache = std::make_shared<PipelineStateVkImpl::TShaderModuleCache>();
+
+    CreatePipelineStatesImpl(ppCreateInfos, NumPipelines, ppPipelineStates,
+                             [&](const auto& PSOCreateInfo, IPipelineState** ppPipelineState) //
+                             {
+                                 CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo, pModuleCache);
+                             });
+}
+
 void RenderDeviceVkImpl::CreateBufferFromVulkanResource(VkBuffer vkBuffer, const BufferDesc& BuffDesc, RESOURCE_STATE InitialState, IBuffer** ppBuffer)
 {
     CreateBufferImpl(ppBuffer, BuffDesc, InitialState, vkBuffer);
@@ -602,6 +620,7 @@ void RenderDeviceVkImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
         GetLogicalDevice().GetEnabledExtFeatures().Spirv14,
         ppCompilerOutput,
         m_pShaderCompilationThreadPool,
+        &m_ShaderCompilationCache,
     };
     CreateShaderImpl(ppShader, ShaderCI, VkShaderCI);
 }
@@ -0,0 +1,310 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "ShaderCompilationCacheVk.hpp"
+
+#include <algorithm>
+
+#include "xxhash.h"
+
+#include "ShaderToolsCommon.hpp"
+#include "EngineMemory.h"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+XXH128Hash ComputeKeyHash(const std::string& Key)
+{
+    const XXH128_hash_t Hash = XXH3_128bits(Key.data(), Key.size());
+    return XXH128Hash{Hash.low64, Hash.high64};
+}
+
+} // namespace
+
+constexpr size_t ShaderCompilationCacheVk::MinPurgeThreshold;
+
+ShaderCompilationCacheVk::SPIRVEntry::SPIRVEntry(ShaderCreateInfoWrapper&& ShaderCI, CompileFuncType&& CompileFunc, std::string&& Key) noexcept :
+    m_ShaderCI{std::move(ShaderCI)},
+    m_CompileFunc{std::move(CompileFunc)},
+    m_Key{std::move(Key)}
+{}
+
+bool ShaderCompilationCacheVk::SPIRVEntry::Compile(bool Wait)
+{
+    if (IsCompiled())
+        return true;
+
+    std::unique_lock<std::mutex> Lock{m_CompileMtx, std::defer_lock};
+    if (Wait)
+        Lock.lock();
+    else if (!Lock.try_lock())
+        return false;
+
+    // The byte code may have been compiled by another thread while we were waiting for the lock
+    if (IsCompiled())
+        return true;
+
+    Status NewStatus = Status::Failed;
+    try
+    {
+        m_SPIRV = m_CompileFunc(m_ShaderCI);
+        if (!m_SPIRV.empty())
+            NewStatus = Status::Compiled;
+    }
+    catch (...)
+    {
+        m_SPIRV.clear();
+    }
+
+    // Release the source and the compiler state that are no longer needed
+    m_ShaderCI    = ShaderCreateInfoWrapper{};
+    m_CompileFunc = nullptr;
+
+    m_Status.store(NewStatus);
+
+    return true;
+}
+
+ShaderCompilationCacheVk::Reflection ShaderCompilationCacheVk::SPIRVEntry::GetReflection(const ShaderDesc& Desc,
+                                                                                         const char*       CombinedSamplerSuffix,
+                                                                                         bool              LoadShaderInputs,
+                                                                                         bool              LoadConstantBufferReflection) noexcept(false)
+{
+    VERIFY(IsValid(), "Reflection can only be loaded from successfully compiled byte code");
+
+    const char* Name = Desc.Name != nullptr ? Desc.Name : "";
+
+    std::lock_guard<std::mutex> Lock{m_ReflectionsMtx};
+    for (const ReflectionInfo& Info : m_Reflections)
+    {
+        // clang-format off
+        if (Info.Name                         == Name                                    &&
+            Info.ShaderType                   == Desc.ShaderType                         &&
+            Info.UseCombinedSamplers          == (CombinedSamplerSuffix != nullptr)      &&
+            (CombinedSamplerSuffix == nullptr || Info.CombinedSamplerSuffix == CombinedSamplerSuffix) &&
+            Info.LoadShaderInputs             == LoadShaderInputs                        &&
+            Info.LoadConstantBufferReflection == LoadConstantBufferReflection)
+        // clang-format on
+        {
+            return Info.Refl;
+        }
+    }
+
+    IMemoryAllocator& Allocator = GetRawAllocator();
+
+    std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
+        ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
+        STDDeleterRawMem<void>(Allocator),
+    };
+
+    ReflectionInfo Info;
+    new (pRawMem.get()) SPIRVShaderResources // May throw
+        {
+            Allocator,
+            m_SPIRV,
+            Desc,
+            CombinedSamplerSuffix,
+            LoadShaderInputs,
+            LoadConstantBufferReflection,
+            Info.Refl.EntryPoint //
+        };
+    Info.Refl.pResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
+
+    if (LoadShaderInputs && Info.Refl.pResources->IsHLSLSource() && !m_HLSLVertexInputsMapped)
+    {
+        // The mapping only depends on the byte code, so it is performed once for all shaders that share the entry.
+        // Shaders read the byte code after they load the reflection, so no shader can observe it before the mapping.
+        Info.Refl.pResources->MapHLSLVertexShaderInputs(m_SPIRV);
+        m_HLSLVertexInputsMapped = true;
+    }
+
+    Info.Name                         = Name;
+    Info.CombinedSamplerSuffix        = CombinedSamplerSuffix != nullptr ? CombinedSamplerSuffix : "";
+    Info.UseCombinedSamplers          = CombinedSamplerSuffix != nullptr;
+    Info.ShaderType                   = Desc.ShaderType;
+    Info.LoadShaderInputs             = LoadShaderInputs;
+    Info.LoadConstantBufferReflection = LoadConstantBufferReflection;
+    m_Reflections.emplace_back(std::move(Info));
+
+    return m_Reflections.back().Refl;
+}
+
+// Returns the string that uniquely identifies the result of the compilation of the preprocessed source
+std::string ShaderCompilationCacheVk::GetCompilationKey(const ShaderCreateInfo& ShaderCI, SHADER_COMPILER Compiler, const std::string& Source)
+{
+    // Flags that do not affect the byte code.
+    // Note that SHADER_COMPILE_FLAG_SKIP_REFLECTION does affect it as vertex inputs of HLSL
+    // shaders are only remapped when reflection is loaded.
+    constexpr SHADER_COMPILE_FLAGS IgnoredFlags = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+    const auto AppendString = [](std::string& Key, const char* Str) {
+        if (Str != nullptr)
+            Key.append(Str);
+        Key.push_back('\n');
+    };
+    const auto AppendValue = [](std::string& Key, Uint32 Value) {
+        Key.append(std::to_string(Value));
+        Key.push_back('\n');
+    };
+    const auto AppendVersion = [&](std::string& Key, const ShaderVersion& Version) {
+        AppendValue(Key, Version.Major);
+        AppendValue(Key, Version.Minor);
+    };
+
+    std::string Key;
+    Key.reserve(Source.length() + 256);
+
+    AppendValue(Key, static_cast<Uint32>(ShaderCI.SourceLanguage));
+    AppendValue(Key, static_cast<Uint32>(Compiler));
+    AppendValue(Key, static_cast<Uint32>(ShaderCI.Desc.ShaderType));
+    AppendValue(Key, static_cast<Uint32>(ShaderCI.CompileFlags & ~IgnoredFlags));
+    AppendValue(Key, ShaderCI.Desc.UseCombinedTextureSamplers ? 1 : 0);
+    AppendString(Key, ShaderCI.Desc.CombinedSamplerSuffix);
+    AppendVersion(Key, ShaderCI.HLSLVersion);
+    AppendVersion(Key, ShaderCI.GLSLVersion);
+    AppendVersion(Key, ShaderCI.GLESSLVersion);
+    AppendString(Key, ShaderCI.EntryPoint);
+    AppendString(Key, ShaderCI.GLSLExtensions);
+    for (size_t i = 0; i < ShaderCI.Macros.Count; ++i)
+    {
+        AppendString(Key, ShaderCI.Macros[i].Name);
+        AppendString(Key, ShaderCI.Macros[i].Definition);
+    }
+
+    // Separate the parameters from the source so that a source that
+    // starts with a newline can't be confused with another macro.
+    Key.push_back('\0');
+    Key.append(Source);
+
+    return Key;
+}
+
+ShaderCompilationCacheVk::SPIRVEntryPtr ShaderCompilationCacheVk::Preprocess(const ShaderCreateInfo& ShaderCI,
+                                                                             SHADER_COMPILER         Compiler,
+                                                                             CompileFuncType         CompileFunc,
+                                                                             bool&                   IsNew) noexcept(false)
+{
+    VERIFY(ShaderCI.ByteCode == nullptr, "Shaders created from byte code do not need to be compiled");
+
+    IsNew = true;
+
+    std::string Source;
+    try
+    {
+        Source = UnrollShaderIncludes(ShaderCI);
+    }
+    catch (...)
+    {
+        // Let the compiler report the error
+        return std::make_shared<SPIRVEntry>(ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()}, std::move(CompileFunc));
+    }
+
+    std::string      Key  = GetCompilationKey(ShaderCI, Compiler, Source);
+    const XXH128Hash Hash = ComputeKeyHash(Key);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Entries.find(Hash);
+        if (it != m_Entries.end())
+        {
+            SPIRVEntryPtr pEntry = it->second.lock();
+            if (pEntry && pEntry->m_Key == Key)
+            {
+                IsNew = false;
+                return pEntry;
+            }
+        }
+    }
+
+    // The preprocessed source is only used as the key: the entry compiles the original create info,
+    // so that compiler messages refer to the original files and line numbers.
+    // Create the entry outside of the lock as copying the create info may be expensive.
+    SPIRVEntryPtr pNewEntry = std::make_shared<SPIRVEntry>(ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()}, std::move(CompileFunc), std::move(Key));
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto it = m_Entries.find(Hash);
+    if (it != m_Entries.end())
+    {
+        if (SPIRVEntryPtr pEntry = it->second.lock())
+        {
+            if (pEntry->m_Key == pNewEntry->m_Key)
+            {
+                // Another thread has added the same entry
+                IsNew = false;
+                return pEntry;
+            }
+
+            // Hash collision: the new entry is not shared
+            return pNewEntry;
+        }
+        it->second = pNewEntry;
+    }
+    else
+    {
+        if (m_Entries.size() >= m_PurgeThreshold)
+        {
+            PurgeUnsafe();
+            // Amortize the cost of the purge over the number of entries in the cache
+            m_PurgeThreshold = std::max(size_t{MinPurgeThreshold}, m_Entries.size() * 2);
+        }
+        m_Entries.emplace(Hash, pNewEntry);
+    }
+
+    return pNewEntry;
+}
+
+size_t ShaderCompilationCacheVk::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    size_t Count = 0;
+    for (const auto& it : m_Entries)
+    {
+        if (!it.second.expired())
+            ++Count;
+    }
+    return Count;
+}
+
+void ShaderCompilationCacheVk::PurgeUnsafe()
+{
+    for (auto it = m_Entries.begin(); it != m_Entries.end();)
+    {
+        if (it->second.expired())
+            it = m_Entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,75 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "ShaderModuleCacheVk.hpp"
+
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+VkShaderModule ShaderModuleCacheVk::FindModule(size_t Hash, const std::vector<uint32_t>& SPIRV) const
+{
+    auto Range = m_Modules.equal_range(Hash);
+    for (auto it = Range.first; it != Range.second; ++it)
+    {
+        if (it->second.SPIRV == SPIRV)
+            return it->second.Module;
+    }
+    return VK_NULL_HANDLE;
+}
+
+VkShaderModule ShaderModuleCacheVk::GetShaderModule(const std::vector<uint32_t>& SPIRV, const CreateModuleFuncType& CreateModule) noexcept(false)
+{
+    const size_t Hash = ComputeHashRaw(SPIRV.data(), SPIRV.size() * sizeof(uint32_t));
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        if (VkShaderModule vkModule = FindModule(Hash, SPIRV))
+            return vkModule;
+    }
+
+    // Create the module without holding the lock so that other threads are not blocked
+    VulkanUtilities::ShaderModuleWrapper Module = CreateModule(SPIRV);
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    // Another thread may have created the same module in the meantime,
+    // in which case the new one is destroyed when it goes out of scope.
+    if (VkShaderModule vkModule = FindModule(Hash, SPIRV))
+        return vkModule;
+
+    auto it = m_Modules.emplace(Hash, ModuleInfo{SPIRV, std::move(Module)});
+    return it->second.Module;
+}
+
+size_t ShaderModuleCacheVk::GetModuleCount() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_Modules.size();
+}
+
+} // namespace Diligent
@@ -43,4 +43,15 @@ ShaderResourceBindingVkImpl::~ShaderResourceBindingVkImpl()
 {
 }
 
+void ShaderResourceBindingVkImpl::SetVariables(const ShaderVariableBinding* pBindings, Uint32 NumBindings)
+{
+    // Accumulate the descriptor writes of all bindings and issue them with a single call.
+    ShaderResourceCacheVk::DescriptorWriteBatch WriteBatch;
+    m_ShaderResourceCache.SetDescriptorWriteBatch(&WriteBatch);
+    TBase::SetVariables(pBindings, NumBindings);
+    m_ShaderResourceCache.SetDescriptorWriteBatch(nullptr);
+
+    WriteBatch.Flush(GetSignature()->GetDevice()->GetLogicalDevice());
+}
+
 } // namespace Diligent
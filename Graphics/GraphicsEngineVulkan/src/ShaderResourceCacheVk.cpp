@@ -112,6 +112,77 @@ void ShaderResourceCacheVk::InitializeResources(Uint32 Set, Uint32 Offset, Uint3
     }
 }
 
+void ShaderResourceCacheVk::InitializeDescriptorImage(IMemoryAllocator& MemAllocator, Uint32 SetIndex)
+{
+    VERIFY(!m_pDescriptorImage, "Descriptor image has already been initialized");
+
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    VERIFY(DescrSet.GetVkDescriptorSet() == VK_NULL_HANDLE, "Descriptor image is only used for sets that are written at commit time");
+#ifdef DILIGENT_DEBUG
+    for (Uint32 res = 0; res < DescrSet.GetSize(); ++res)
+        VERIFY(DescrSet.GetResource(res).IsNull(), "Descriptor image must be initialized before any resource is set");
+#endif
+
+    m_DescriptorImageSet = static_cast<Uint16>(SetIndex);
+    m_pDescriptorImage   = decltype(m_pDescriptorImage){
+        ALLOCATE_RAW(MemAllocator, "Memory for descriptor image", DescrSet.GetSize() * DescriptorImageStride),
+        STDDeleter<void, IMemoryAllocator>(MemAllocator) //
+    };
+    m_NumDescriptorImageEntries = 0;
+}
+
+void ShaderResourceCacheVk::WriteDescriptorImageEntry(Uint32 CacheOffset, const Resource& Res)
+{
+    VERIFY_EXPR(m_pDescriptorImage && !Res.IsNull());
+
+    void* pEntry = static_cast<Uint8*>(m_pDescriptorImage.get()) + size_t{CacheOffset} * DescriptorImageStride;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            *static_cast<VkDescriptorImageInfo*>(pEntry) = Res.GetSamplerDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            *static_cast<VkDescriptorImageInfo*>(pEntry) = Res.GetImageDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            *static_cast<VkBufferView*>(pEntry) = Res.GetBufferViewWriteInfo();
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            *static_cast<VkDescriptorBufferInfo*>(pEntry) = Res.GetUniformBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            *static_cast<VkDescriptorBufferInfo*>(pEntry) = Res.GetStorageBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            *static_cast<VkDescriptorImageInfo*>(pEntry) = Res.GetInputAttachmentDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            // Templates read acceleration structure handles directly
+            *static_cast<VkAccelerationStructureKHR*>(pEntry) = *Res.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
 inline bool IsDynamicDescriptorType(DescriptorType DescrType)
 {
     return (DescrType == DescriptorType::UniformBufferDynamic ||
@@ -297,6 +368,15 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
 
+    // Separate immutable samplers are never written to the descriptor set
+    const bool UseDescriptorImage = (m_pDescriptorImage && DescrSetIndex == m_DescriptorImageSet &&
+                                     !(DstRes.Type == DescriptorType::Sampler && DstRes.HasImmutableSampler));
+    if (UseDescriptorImage && !DstRes.IsNull())
+    {
+        VERIFY_EXPR(m_NumDescriptorImageEntries > 0);
+        --m_NumDescriptorImageEntries;
+    }
+
     if (IsDynamicBuffer(DstRes))
     {
         VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
@@ -328,6 +408,12 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
+    if (UseDescriptorImage && !DstRes.IsNull())
+    {
+        WriteDescriptorImageEntry(CacheOffset, DstRes);
+        ++m_NumDescriptorImageEntries;
+    }
+
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
     if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
     {
@@ -407,7 +493,10 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
                 UNEXPECTED("Unexpected descriptor type");
         }
 
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        if (m_pWriteBatch != nullptr)
+            m_pWriteBatch->Add(WriteDescrSet);
+        else
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
     }
 
     UpdateRevision();
@@ -415,6 +504,106 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     return DstRes;
 }
 
+void ShaderResourceCacheVk::DescriptorWriteBatch::Add(const VkWriteDescriptorSet& Write)
+{
+    VERIFY_EXPR(Write.descriptorCount == 1);
+
+    if (!m_Writes.empty() && Write.pNext == nullptr)
+    {
+        // Merge the write with the previous one if it sets the next element of the same binding.
+        // The descriptor infos of the last write are always at the end of the corresponding array.
+        VkWriteDescriptorSet& Last = m_Writes.back();
+        if (Last.pNext == nullptr &&
+            Last.dstSet == Write.dstSet &&
+            Last.dstBinding == Write.dstBinding &&
+            Last.descriptorType == Write.descriptorType &&
+            Last.dstArrayElement + Last.descriptorCount == Write.dstArrayElement)
+        {
+            if (Write.pImageInfo != nullptr)
+                m_ImageInfos.push_back(*Write.pImageInfo);
+            else if (Write.pBufferInfo != nullptr)
+                m_BufferInfos.push_back(*Write.pBufferInfo);
+            else if (Write.pTexelBufferView != nullptr)
+                m_TexelBufferViews.push_back(*Write.pTexelBufferView);
+            else
+                UNEXPECTED("Descriptor write does not reference any descriptor info");
+
+            ++Last.descriptorCount;
+            return;
+        }
+    }
+
+    // The pointers are resolved in Flush() as the arrays may be reallocated
+    size_t FirstInfoIdx = 0;
+    if (Write.pImageInfo != nullptr)
+    {
+        FirstInfoIdx = m_ImageInfos.size();
+        m_ImageInfos.push_back(*Write.pImageInfo);
+    }
+    else if (Write.pBufferInfo != nullptr)
+    {
+        FirstInfoIdx = m_BufferInfos.size();
+        m_BufferInfos.push_back(*Write.pBufferInfo);
+    }
+    else if (Write.pTexelBufferView != nullptr)
+    {
+        FirstInfoIdx = m_TexelBufferViews.size();
+        m_TexelBufferViews.push_back(*Write.pTexelBufferView);
+    }
+    else if (Write.pNext != nullptr)
+    {
+        // Acceleration structure is the only descriptor type that uses pNext
+        const auto& AccelStructInfo = *static_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(Write.pNext);
+        VERIFY_EXPR(AccelStructInfo.accelerationStructureCount == 1);
+        FirstInfoIdx = m_AccelStructInfos.size();
+        m_AccelStructInfos.push_back(AccelStructInfo);
+        m_AccelStructs.push_back(*AccelStructInfo.pAccelerationStructures);
+    }
+    else
+    {
+        UNEXPECTED("Descriptor write does not reference any descriptor info");
+        return;
+    }
+
+    m_Writes.push_back(Write);
+    m_FirstInfoIndices.push_back(FirstInfoIdx);
+}
+
+void ShaderResourceCacheVk::DescriptorWriteBatch::Flush(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice)
+{
+    if (m_Writes.empty())
+        return;
+
+    VERIFY_EXPR(m_Writes.size() == m_FirstInfoIndices.size());
+    for (size_t i = 0; i < m_Writes.size(); ++i)
+    {
+        VkWriteDescriptorSet& Write        = m_Writes[i];
+        const size_t          FirstInfoIdx = m_FirstInfoIndices[i];
+        if (Write.pImageInfo != nullptr)
+            Write.pImageInfo = &m_ImageInfos[FirstInfoIdx];
+        else if (Write.pBufferInfo != nullptr)
+            Write.pBufferInfo = &m_BufferInfos[FirstInfoIdx];
+        else if (Write.pTexelBufferView != nullptr)
+            Write.pTexelBufferView = &m_TexelBufferViews[FirstInfoIdx];
+        else if (Write.pNext != nullptr)
+        {
+            VkWriteDescriptorSetAccelerationStructureKHR& AccelStructInfo = m_AccelStructInfos[FirstInfoIdx];
+            AccelStructInfo.pAccelerationStructures                       = &m_AccelStructs[FirstInfoIdx];
+            Write.pNext                                                   = &AccelStructInfo;
+        }
+    }
+
+    LogicalDevice.UpdateDescriptorSets(static_cast<uint32_t>(m_Writes.size()), m_Writes.data(), 0, nullptr);
+
+    m_Writes.clear();
+    m_FirstInfoIndices.clear();
+    m_ImageInfos.clear();
+    m_BufferInfos.clear();
+    m_TexelBufferViews.clear();
+    m_AccelStructInfos.clear();
+    m_AccelStructs.clear();
+}
+
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
                                                    Uint32 CacheOffset,
                                                    Uint32 DynamicBufferOffset)
@@ -116,6 +116,12 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? m_pVariables + VarIndex : nullptr;
+    }
+
     for (Uint32 v = 0; v < m_NumVariables; ++v)
     {
         ShaderVariableVkImpl& Var = m_pVariables[v];
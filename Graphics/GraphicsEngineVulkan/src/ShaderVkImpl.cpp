@@ -159,98 +159,121 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
     return SPIRV;
 }
 
-} // namespace
-
-void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
-                              const CreateInfo&       VkShaderCI)
+SHADER_COMPILER GetShaderCompiler(const ShaderCreateInfo&         ShaderCI,
+                                  const ShaderVkImpl::CreateInfo& VkShaderCI)
 {
-    if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
+    SHADER_COMPILER ShaderCompiler = ShaderCI.ShaderCompiler;
+    if (ShaderCompiler == SHADER_COMPILER_DXC)
     {
-        DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
-
-        auto ShaderCompiler = ShaderCI.ShaderCompiler;
-        if (ShaderCompiler == SHADER_COMPILER_DXC)
+        auto* pDXCompiler = VkShaderCI.pDXCompiler;
+        if (pDXCompiler == nullptr || !pDXCompiler->IsLoaded())
         {
-            auto* pDXCompiler = VkShaderCI.pDXCompiler;
-            if (pDXCompiler == nullptr || !pDXCompiler->IsLoaded())
-            {
-                LOG_WARNING_MESSAGE("DX Compiler is not loaded. Using default shader compiler");
-                ShaderCompiler = SHADER_COMPILER_DEFAULT;
-            }
+            LOG_WARNING_MESSAGE("DX Compiler is not loaded. Using default shader compiler");
+            ShaderCompiler = SHADER_COMPILER_DEFAULT;
         }
+    }
+    return ShaderCompiler;
+}
 
-        switch (ShaderCompiler)
-        {
-            case SHADER_COMPILER_DXC:
-                m_SPIRV = CompileShaderDXC(ShaderCI, VkShaderCI);
-                break;
+std::vector<uint32_t> CompileShader(const ShaderCreateInfo&         ShaderCI,
+                                    const ShaderVkImpl::CreateInfo& VkShaderCI,
+                                    SHADER_COMPILER                 ShaderCompiler)
+{
+    switch (ShaderCompiler)
+    {
+        case SHADER_COMPILER_DXC:
+            return CompileShaderDXC(ShaderCI, VkShaderCI);
 
-            case SHADER_COMPILER_DEFAULT:
-            case SHADER_COMPILER_GLSLANG:
-                m_SPIRV = CompileShaderGLSLang(ShaderCI, VkShaderCI);
-                break;
+        case SHADER_COMPILER_DEFAULT:
+        case SHADER_COMPILER_GLSLANG:
+            return CompileShaderGLSLang(ShaderCI, VkShaderCI);
 
-            default:
-                LOG_ERROR_AND_THROW("Unsupported shader compiler");
-        }
-
-        if (m_SPIRV.empty())
-        {
-            LOG_ERROR_AND_THROW("Failed to compile shader '", m_Desc.Name, '\'');
-        }
+        default:
+            LOG_ERROR_AND_THROW("Unsupported shader compiler");
+            return {};
     }
-    else if (ShaderCI.ByteCode != nullptr)
+}
+
+// Returns the function that compiles the shader. The function may be called asynchronously
+// after the create info is released, so it keeps copies of all the parameters.
+ShaderCompilationCacheVk::CompileFuncType GetCompileFunc(const ShaderVkImpl::CreateInfo& VkShaderCI,
+                                                         SHADER_COMPILER                 ShaderCompiler)
+{
+    return [ShaderCompiler,
+            pDXCompiler      = VkShaderCI.pDXCompiler,
+            DeviceInfo       = VkShaderCI.DeviceInfo,
+            AdapterInfo      = VkShaderCI.AdapterInfo,
+            VkVersion        = VkShaderCI.VkVersion,
+            HasSpirv14       = VkShaderCI.HasSpirv14,
+            ppCompilerOutput = VkShaderCI.ppCompilerOutput](const ShaderCreateInfo& ShaderCI) //
     {
-        DEV_CHECK_ERR(ShaderCI.ByteCodeSize != 0, "ByteCodeSize must not be 0");
-        DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
-        m_SPIRV.resize(ShaderCI.ByteCodeSize / 4);
-        memcpy(m_SPIRV.data(), ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
-    }
-    else
+        const ShaderVkImpl::CreateInfo VkShaderCI{
+            pDXCompiler,
+            DeviceInfo,
+            AdapterInfo,
+            VkVersion,
+            HasSpirv14,
+            ppCompilerOutput,
+            nullptr,
+        };
+        return CompileShader(ShaderCI, VkShaderCI, ShaderCompiler);
+    };
+}
+
+// Preprocessing stage: returns the SPIR-V entry for the shader. If the compilation cache is null,
+// the entry is not shared with other shaders.
+ShaderCompilationCacheVk::SPIRVEntryPtr PreprocessShader(const ShaderCreateInfo&                     ShaderCI,
+                                                         SHADER_COMPILER                             ShaderCompiler,
+                                                         ShaderCompilationCacheVk::CompileFuncType&& CompileFunc,
+                                                         ShaderCompilationCacheVk*                   pCompilationCache,
+                                                         bool&                                       IsNew) noexcept(false)
+{
+    if (pCompilationCache != nullptr)
+        return pCompilationCache->Preprocess(ShaderCI, ShaderCompiler, std::move(CompileFunc), IsNew);
+
+    IsNew = true;
+    return std::make_shared<ShaderCompilationCacheVk::SPIRVEntry>(ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()}, std::move(CompileFunc));
+}
+
+} // namespace
+
+void ShaderVkImpl::Initialize(ShaderCompilationCacheVk::SPIRVEntry& SPIRVEntry,
+                              SHADER_COMPILE_FLAGS                  CompileFlags,
+                              bool                                  LoadConstantBufferReflection,
+                              const char*                           EntryPoint)
+{
+    VERIFY(SPIRVEntry.IsCompiled(), "The byte code must be compiled");
+    if (!SPIRVEntry.IsValid())
     {
-        LOG_ERROR_AND_THROW("Shader source must be provided through one of the 'Source', 'FilePath' or 'ByteCode' members");
+        LOG_ERROR_AND_THROW("Failed to compile shader '", m_Desc.Name, '\'');
     }
 
     // We cannot create shader module here because resource bindings are assigned when
     // pipeline state is created
 
     // Load shader resources
-    if (!m_SPIRV.empty())
+    if ((CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
     {
-        if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
-        {
-            auto& Allocator = GetRawAllocator();
-
-            std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
-                ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
-                STDDeleterRawMem<void>(Allocator),
-            };
-            auto LoadShaderInputs = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
-            new (pRawMem.get()) SPIRVShaderResources // May throw
-                {
-                    Allocator,
-                    m_SPIRV,
-                    m_Desc,
-                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
-                    LoadShaderInputs,
-                    ShaderCI.LoadConstantBufferReflection,
-                    m_EntryPoint //
-                };
-            VERIFY_EXPR(ShaderCI.ByteCode != nullptr || m_EntryPoint == ShaderCI.EntryPoint);
-            m_pShaderResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
-
-            if (LoadShaderInputs && m_pShaderResources->IsHLSLSource())
-            {
-                m_pShaderResources->MapHLSLVertexShaderInputs(m_SPIRV);
-            }
-        }
-        else
-        {
-            m_EntryPoint = ShaderCI.EntryPoint;
-        }
-
-        m_Status.store(SHADER_STATUS_READY);
+        const bool LoadShaderInputs = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
+
+        // Reflection is shared by all shaders with the same byte code and description.
+        // Vertex inputs of HLSL shaders are remapped by the entry.
+        ShaderCompilationCacheVk::Reflection Reflection = SPIRVEntry.GetReflection( // May throw
+            m_Desc,
+            m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
+            LoadShaderInputs,
+            LoadConstantBufferReflection);
+
+        m_pShaderResources = std::move(Reflection.pResources);
+        m_EntryPoint       = std::move(Reflection.EntryPoint);
+        VERIFY_EXPR(EntryPoint == nullptr || m_EntryPoint == EntryPoint);
     }
+    else
+    {
+        m_EntryPoint = EntryPoint != nullptr ? EntryPoint : "";
+    }
+
+    m_Status.store(SHADER_STATUS_READY);
 }
 
 
@@ -272,41 +295,113 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
 // clang-format on
 {
     m_Status.store(SHADER_STATUS_COMPILING);
-    if (VkShaderCI.pCompilationThreadPool == nullptr || (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0 || ShaderCI.ByteCode != nullptr)
+
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
     {
-        Initialize(ShaderCI, VkShaderCI);
+        if (ShaderCI.ByteCode == nullptr)
+        {
+            LOG_ERROR_AND_THROW("Shader source must be provided through one of the 'Source', 'FilePath' or 'ByteCode' members");
+        }
+
+        DEV_CHECK_ERR(ShaderCI.ByteCodeSize != 0, "ByteCodeSize must not be 0");
+        DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
+
+        // The byte code is not cached as there is nothing to compile
+        m_pSPIRVEntry = std::make_shared<ShaderCompilationCacheVk::SPIRVEntry>(
+            ShaderCreateInfoWrapper{},
+            [&ShaderCI](const ShaderCreateInfo&) {
+                std::vector<uint32_t> SPIRV(ShaderCI.ByteCodeSize / 4);
+                memcpy(SPIRV.data(), ShaderCI.ByteCode, SPIRV.size() * 4);
+                return SPIRV;
+            });
+        m_pSPIRVEntry->Compile(/*Wait = */ true);
+        Initialize(*m_pSPIRVEntry, ShaderCI.CompileFlags, ShaderCI.LoadConstantBufferReflection, nullptr);
+        return;
+    }
+
+    DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
+
+    const SHADER_COMPILER ShaderCompiler = GetShaderCompiler(ShaderCI, VkShaderCI);
+
+    // Compiler output is specific to this shader, so the byte code can't be shared
+    ShaderCompilationCacheVk* const pCompilationCache = VkShaderCI.ppCompilerOutput == nullptr ? VkShaderCI.pCompilationCache : nullptr;
+
+    if (VkShaderCI.pCompilationThreadPool == nullptr || (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0)
+    {
+        bool IsNew = false;
+
+        m_pSPIRVEntry = PreprocessShader(ShaderCI, ShaderCompiler, GetCompileFunc(VkShaderCI, ShaderCompiler), pCompilationCache, IsNew);
+        // If another thread is compiling the same byte code, wait for it
+        m_pSPIRVEntry->Compile(/*Wait = */ true);
+        Initialize(*m_pSPIRVEntry, ShaderCI.CompileFlags, ShaderCI.LoadConstantBufferReflection, ShaderCI.EntryPoint);
     }
     else
     {
-        this->m_AsyncInitializer = AsyncInitializer::Start(
-            VkShaderCI.pCompilationThreadPool,
+        // Preprocessing, compilation and reflection are performed by separate tasks so that
+        // the thread pool can overlap the stages of different shaders, and shaders that share
+        // the same byte code only wait for the compilation instead of compiling it again.
+        IThreadPool* const pThreadPool = VkShaderCI.pCompilationThreadPool;
+
+        RefCntAutoPtr<IAsyncTask> pPreprocessTask = EnqueueAsyncWork(
+            pThreadPool,
             [this,
-             ShaderCI         = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()},
-             pDXCompiler      = VkShaderCI.pDXCompiler,
-             DeviceInfo       = VkShaderCI.DeviceInfo,
-             AdapterInfo      = VkShaderCI.AdapterInfo,
-             VkVersion        = VkShaderCI.VkVersion,
-             HasSpirv14       = VkShaderCI.HasSpirv14,
-             ppCompilerOutput = VkShaderCI.ppCompilerOutput](Uint32 ThreadId) mutable //
+             pThreadPool,
+             pCompilationCache,
+             ShaderCompiler,
+             ShaderCI    = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()},
+             CompileFunc = GetCompileFunc(VkShaderCI, ShaderCompiler)](Uint32 ThreadId) mutable //
             {
                 try
                 {
-                    const CreateInfo VkShaderCI{
-                        pDXCompiler,
-                        DeviceInfo,
-                        AdapterInfo,
-                        VkVersion,
-                        HasSpirv14,
-                        ppCompilerOutput,
-                        nullptr,
-                    };
-                    Initialize(ShaderCI, VkShaderCI);
+                    bool IsNew    = false;
+                    m_pSPIRVEntry = PreprocessShader(ShaderCI, ShaderCompiler, std::move(CompileFunc), pCompilationCache, IsNew);
+                    if (IsNew)
+                    {
+                        // The task only keeps a weak reference to the entry: if all shaders that use the entry are
+                        // released before the task starts, there is no need to compile it.
+                        EnqueueAsyncWork(pThreadPool,
+                                         [wpSPIRVEntry = std::weak_ptr<ShaderCompilationCacheVk::SPIRVEntry>{m_pSPIRVEntry}](Uint32 ThreadId) {
+                                             if (auto pSPIRVEntry = wpSPIRVEntry.lock())
+                                                 pSPIRVEntry->Compile(/*Wait = */ false);
+                                             return ASYNC_TASK_STATUS_COMPLETE;
+                                         });
+                    }
                 }
                 catch (...)
                 {
                     m_Status.store(SHADER_STATUS_FAILED);
                 }
                 ShaderCI = ShaderCreateInfoWrapper{};
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+
+        this->m_AsyncInitializer = AsyncInitializer::Start(
+            pThreadPool,
+            {pPreprocessTask},
+            [this,
+             CompileFlags                 = ShaderCI.CompileFlags,
+             LoadConstantBufferReflection = ShaderCI.LoadConstantBufferReflection,
+             EntryPoint                   = std::string{ShaderCI.EntryPoint != nullptr ? ShaderCI.EntryPoint : ""}](Uint32 ThreadId) //
+            {
+                if (!m_pSPIRVEntry)
+                {
+                    VERIFY_EXPR(m_Status.load() == SHADER_STATUS_FAILED);
+                    return;
+                }
+
+                // Compile the byte code in this thread if no other thread has started doing this.
+                // Otherwise, wait for the thread that compiles it. The compilation does not depend on
+                // other tasks, so the wait can't deadlock.
+                m_pSPIRVEntry->Compile(/*Wait = */ true);
+
+                try
+                {
+                    Initialize(*m_pSPIRVEntry, CompileFlags, LoadConstantBufferReflection, EntryPoint.c_str());
+                }
+                catch (...)
+                {
+                    m_Status.store(SHADER_STATUS_FAILED);
+                }
             });
     }
 }
@@ -316,6 +411,10 @@ ShaderVkImpl::~ShaderVkImpl()
     // Make sure that asynchrous task is complete as it references the shader object.
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion = */ true);
+
+    // Shaders created by the archiver may not have a device
+    if (m_pDevice != nullptr)
+        m_pDevice->GetPatchedShaderCache().RemoveShader(GetUniqueID());
 }
 
 void ShaderVkImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
@@ -447,6 +447,18 @@ PipelineCacheWrapper VulkanLogicalDevice::CreatePipelineCache(const VkPipelineCa
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescrUpdateTemplateWrapper VulkanLogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    VERIFY_EXPR(m_EnabledExtFeatures.DescriptorUpdateTemplate);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, CI, DebugName, "descriptor update template");
+#else
+    UNSUPPORTED("vkCreateDescriptorUpdateTemplate is only available through Volk");
+    return DescrUpdateTemplateWrapper{};
+#endif
+}
+
 void VulkanLogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -565,6 +577,16 @@ void VulkanLogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache)
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void VulkanLogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyDescriptorUpdateTemplate is only available through Volk");
+#endif
+}
+
 void VulkanLogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -707,6 +729,17 @@ void VulkanLogicalDevice::UpdateDescriptorSets(uint32_t                    descr
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void VulkanLogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                          VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                          const void*                pData) const
+{
+#if DILIGENT_USE_VOLK
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+#else
+    UNSUPPORTED("vkUpdateDescriptorSetWithTemplate is only available through Volk");
+#endif
+}
+
 VkResult VulkanLogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                                VkCommandPoolResetFlags flags) const
 {
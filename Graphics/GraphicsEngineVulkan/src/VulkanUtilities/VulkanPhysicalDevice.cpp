@@ -227,6 +227,12 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.Subgroup.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
         }
 
+        // Descriptor update templates are core in Vulkan 1.1.
+        if (m_VkVersion >= VK_API_VERSION_1_1)
+        {
+            m_ExtFeatures.DescriptorUpdateTemplate = true;
+        }
+
         if (IsExtensionSupported(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME))
         {
             *NextFeat = &m_ExtFeatures.VertexAttributeDivisor;
@@ -56,6 +56,8 @@ public:
 
     void Destroy(IMemoryAllocator& Allocator);
 
+    using TBase::SetNameHash;
+
     ShaderVariableWebGPUImpl* GetVariable(const Char* Name) const;
     ShaderVariableWebGPUImpl* GetVariable(Uint32 Index) const;
 
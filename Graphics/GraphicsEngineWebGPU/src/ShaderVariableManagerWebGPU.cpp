@@ -117,6 +117,12 @@ void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(const Char* Name) const
 {
+    if (m_pNameHash != nullptr)
+    {
+        const Uint32 VarIndex = m_pNameHash->Find(Name);
+        return VarIndex != ShaderVariableNameHash::InvalidIndex ? m_pVariables + VarIndex : nullptr;
+    }
+
     for (Uint32 v = 0; v < m_NumVariables; ++v)
     {
         ShaderVariableWebGPUImpl& Var = m_pVariables[v];
@@ -34,10 +34,10 @@
 #include "HLSLUtils.hpp"
 #include "HLSLParsingTools.hpp"
 #include "SPIRVUtils.hpp"
+#include "SPIRVModuleIndex.hpp"
 
 #if !DILIGENT_NO_GLSLANG
 #    include "GLSLangUtils.hpp"
-#    include "SPIRVShaderResources.hpp"
 #endif
 
 #if !DILIGENT_NO_HLSL
@@ -69,35 +69,30 @@ std::vector<uint32_t> CompileShaderToSPIRV(const ShaderCreateInfo&             S
     {
         SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, WebGPUDefine, WebGPUShaderCI.ppCompilerOutput);
 
-        std::string EntryPoint;
-
-        SPIRVShaderResources Resources{
-            GetRawAllocator(),
-            SPIRV,
-            ShaderCI.Desc,
-            ShaderCI.Desc.UseCombinedTextureSamplers ? ShaderCI.Desc.CombinedSamplerSuffix : nullptr,
-            ShaderCI.Desc.ShaderType == SHADER_TYPE_VERTEX, // LoadShaderStageInputs
-            false,                                          // LoadUniformBufferReflection
-            EntryPoint,
-        };
-
-        if (ShaderCI.Desc.ShaderType == SHADER_TYPE_VERTEX)
+        if (!SPIRV.empty())
         {
-            Resources.MapHLSLVertexShaderInputs(SPIRV);
-        }
+            // Full reflection is not needed here: vertex shader inputs and image formats
+            // are patched using the module index.
+            const SPIRVModuleIndex SPIRVIndex{SPIRV};
 
-        if (Resources.GetNumImgs() > 0)
-        {
-            // Image formats are lost during HLSL->SPIRV conversion, so we need to patch them manually
-            const std::string HLSLSource = BuildHLSLSourceString(ShaderCI);
-            if (!HLSLSource.empty())
+            if (ShaderCI.Desc.ShaderType == SHADER_TYPE_VERTEX)
+            {
+                MapHLSLVertexShaderInputs(SPIRV, SPIRVIndex);
+            }
+
+            if (HasStorageImages(SPIRVIndex))
             {
-                // Extract image formats from special comments in HLSL code:
-                //    Texture2D<float4 /*format=rgba32f*/> g_RWTexture;
-                const auto ImageFormats = Parsing::ExtractGLSLImageFormatsFromHLSL(HLSLSource);
-                if (!ImageFormats.empty())
+                // Image formats are lost during HLSL->SPIRV conversion, so we need to patch them manually
+                const std::string HLSLSource = BuildHLSLSourceString(ShaderCI);
+                if (!HLSLSource.empty())
                 {
-                    SPIRV = PatchImageFormats(SPIRV, ImageFormats);
+                    // Extract image formats from special comments in HLSL code:
+                    //    Texture2D<float4 /*format=rgba32f*/> g_RWTexture;
+                    const auto ImageFormats = Parsing::ExtractGLSLImageFormatsFromHLSL(HLSLSource);
+                    if (!ImageFormats.empty())
+                    {
+                        PatchImageFormats(SPIRV, SPIRVIndex, ImageFormats);
+                    }
                 }
             }
         }
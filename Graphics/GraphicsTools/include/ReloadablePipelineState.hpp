@@ -30,6 +30,7 @@
 /// Definition of the Diligent::ReloadablePipelineState class
 
 #include <memory>
+#include <unordered_set>
 
 #include "PipelineState.h"
 #include "RenderStateCache.h"
@@ -68,14 +69,32 @@ public:
                        const PipelineStateCreateInfo& CreateInfo,
                        IPipelineState**               ppReloadablePipeline);
 
-    bool Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData);
+    /// Lets the application modify the graphics pipeline create info before the pipeline is reloaded.
+    /// Does nothing for non-graphics pipelines.
+    void ModifyCreateInfo(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData);
+
+    /// Re-creates the internal pipeline. If the new pipeline is not ready yet,
+    /// the previous pipeline is used until the new one is ready.
+    bool Reload();
+
+    /// Returns true if the pipeline uses any of the given shaders.
+    bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const;
+
+    /// Returns true if the pipeline is a graphics or mesh pipeline.
+    bool IsGraphicsPipeline() const
+    {
+        return m_Type == PIPELINE_TYPE_GRAPHICS || m_Type == PIPELINE_TYPE_MESH;
+    }
 
 private:
     void CopyStaticResources();
 
+    // Replaces the current pipeline with the pending one once the latter is ready
+    void UpdatePendingPipeline(bool WaitForCompletion);
+
 private:
     template <typename CreateInfoType>
-    bool Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData);
+    bool Reload();
 
     struct CreateInfoWrapperBase;
 
@@ -88,6 +107,9 @@ private:
 
     // Old pipeline state kept around to copy static resources from
     RefCntAutoPtr<IPipelineState> m_pOldPipeline;
+
+    // Reloaded pipeline that is not ready yet
+    RefCntAutoPtr<IPipelineState> m_pPendingPipeline;
 };
 
 } // namespace Diligent
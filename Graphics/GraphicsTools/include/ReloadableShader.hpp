@@ -29,6 +29,9 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <string>
+#include <vector>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
 
@@ -99,10 +102,7 @@ public:
         m_pShader->GetBytecode(ppBytecode, Size);
     }
 
-    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final
-    {
-        return m_pShader->GetStatus(WaitForCompletion);
-    }
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
 
     static void Create(RenderStateCacheImpl*   pStateCache,
                        IShader*                pShader,
@@ -111,10 +111,28 @@ public:
 
     bool Reload();
 
+    /// Returns true if the shader source or any of the files it includes
+    /// is in the list of changed files, or is located in a directory from the list.
+    /// The paths in the list must be normalized with NormalizeSourcePath().
+    bool DependsOnAnyFile(const std::vector<std::string>& ChangedFiles) const;
+
+    /// Normalizes the path to compare it with the shader source files.
+    static std::string NormalizeSourcePath(const char* Path);
+
+private:
+    void UpdateSourceFiles();
+    void UpdatePendingShader(bool WaitForCompletion);
+
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
+    // The reloaded shader that is still being compiled.
+    // It replaces m_pShader when it is ready.
+    RefCntAutoPtr<IShader>              m_pPendingShader;
     ShaderCreateInfoWrapper             m_CreateInfo;
+
+    // Shader source file and all files it includes
+    std::vector<std::string> m_SourceFiles;
 };
 
 } // namespace Diligent
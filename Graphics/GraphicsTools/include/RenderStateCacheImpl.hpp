@@ -29,8 +29,11 @@
 /// \file
 /// Definition of the Diligent::RenderStateCacheImpl class
 
-#include <unordered_map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +41,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "FileChangeWatcher.hpp"
 
 namespace Diligent
 {
@@ -100,6 +104,8 @@ public:
 
     virtual Uint32 DILIGENT_CALL_TYPE Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData) override final;
 
+    virtual void DILIGENT_CALL_TYPE NotifyFileChanged(const Char* FilePath) override final;
+
     virtual Uint32 DILIGENT_CALL_TYPE GetContentVersion() const override final
     {
         return m_pDearchiver ? m_pDearchiver->GetContentVersion() : ~0u;
@@ -150,6 +156,13 @@ private:
 
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
+
+    // Files that changed since the last reload. Protected by m_ChangedFilesMtx as well as the watcher.
+    std::mutex                         m_ChangedFilesMtx;
+    std::unique_ptr<FileChangeWatcher> m_pFileWatcher;
+    std::vector<std::string>           m_ChangedFiles;
+    // Whether the application reported any changed files through NotifyFileChanged
+    bool m_FileChangesNotified = false;
 };
 
 } // namespace Diligent
@@ -76,6 +76,16 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional semicolon-separated list of directories to watch for shader source
+    /// file changes when hot reload is enabled.
+    ///
+    /// \remarks   When the directories are watched, IRenderStateCache::Reload only reloads
+    ///             the shaders that depend on the files that changed, and the pipelines that
+    ///             use these shaders. Directories are watched recursively.
+    ///             Watching is currently only supported on Linux and Android. On other platforms,
+    ///             the application should use IRenderStateCache::NotifyFileChanged.
+    const Char* WatchDirectories DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -85,12 +95,14 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_LOG_LEVEL     _LogLevel          = RenderStateCacheCreateInfo{}.LogLevel,
         bool                             _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                             _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        const Char*                      _WatchDirectories  = RenderStateCacheCreateInfo{}.WatchDirectories) noexcept :
         pDevice{_pDevice},
         LogLevel{_LogLevel},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        WatchDirectories{_WatchDirectories}
     {}
 #endif
 };
@@ -243,10 +255,42 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// \remars     Reloading is only enabled if the cache was created with the EnableHotReload member of
     ///             RenderStateCacheCreateInfo member set to true.
+    ///
+    ///             If the cache watches source directories (see RenderStateCacheCreateInfo::WatchDirectories),
+    ///             or the application reported changed files through NotifyFileChanged(), only the shaders
+    ///             that include any of the changed files are reloaded, followed by the pipelines that use
+    ///             these shaders. If ReloadGraphicsPipeline is not null, all graphics pipelines are reloaded.
+    ///             Otherwise, all shaders and pipelines are reloaded.
+    ///
+    ///             Shaders and pipelines are reloaded in parallel using the device shader compilation
+    ///             thread pool, if it is available. ReloadGraphicsPipeline is always called from the
+    ///             calling thread.
+    ///
+    ///             A reloaded shader keeps using the previous internal shader until the new one is
+    ///             compiled. The method waits for the reloaded shaders before it reloads the pipelines,
+    ///             so that the pipelines use the new shaders.
+    ///
+    ///             A reloaded pipeline keeps using the previous internal pipeline until the new one is
+    ///             ready. The new pipeline replaces the previous one only when it is found to be ready
+    ///             by IPipelineState::GetStatus() or by the next call to Reload(), so an application that
+    ///             creates pipelines asynchronously should call GetStatus() for the reloaded pipelines
+    ///             to start using them as soon as they are ready.
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
 
+    /// Notifies the cache that a shader source file has changed.
+
+    /// \param [in]  FilePath - Path to the file that was modified, created, or deleted.
+    ///                         The path may be absolute or relative. It is matched against
+    ///                         the files included by every shader by comparing trailing path
+    ///                         components, e.g. "/Project/shaders/Common.fxh" matches "Common.fxh".
+    ///
+    /// \remarks    The changes are accumulated and processed by the next call to Reload().
+    ///             The method is thread-safe.
+    VIRTUAL void METHOD(NotifyFileChanged)(THIS_
+                                           const Char* FilePath) PURE;
+
     /// Returns the content version of the cache data.
     /// If no data has been loaded, returns ~0u (aka 0xFFFFFFFF).
     VIRTUAL Uint32 METHOD(GetContentVersion)(THIS) CONST PURE;
@@ -268,6 +312,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_WriteToStream(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, WriteToStream,                This, __VA_ARGS__)
 #    define IRenderStateCache_Reset(This)                              CALL_IFACE_METHOD(RenderStateCache, Reset,                        This)
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
+#    define IRenderStateCache_NotifyFileChanged(This, ...)             CALL_IFACE_METHOD(RenderStateCache, NotifyFileChanged,            This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
 // clang-format on
 
@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::IResolvingShaderSourceFactory interface
+
+#include "../../GraphicsEngine/interface/Shader.h"
+#include "../../../Primitives/interface/DataBlob.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+/// Resolving shader source factory create info.
+struct ResolvingShaderSourceFactoryCreateInfo
+{
+    /// Semicolon-separated list of search directories.
+    const Char* SearchDirectories DEFAULT_INITIALIZER(nullptr);
+
+    /// An optional thread pool that is used to load source files in parallel.
+    /// If null, all files are loaded by the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ResolvingShaderSourceFactoryCreateInfo() noexcept
+    {}
+
+    constexpr ResolvingShaderSourceFactoryCreateInfo(const Char*  _SearchDirectories,
+                                                     IThreadPool* _pThreadPool = nullptr) noexcept :
+        SearchDirectories{_SearchDirectories},
+        pThreadPool{_pThreadPool}
+    {}
+#endif
+};
+typedef struct ResolvingShaderSourceFactoryCreateInfo ResolvingShaderSourceFactoryCreateInfo;
+
+
+// {844EDE6F-E5B8-4F8D-B725-2D0A23A72E3E}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_ResolvingShaderSourceFactory =
+    {0x844ede6f, 0xe5b8, 0x4f8d, {0xb7, 0x25, 0x2d, 0xa, 0x23, 0xa7, 0x2e, 0x3e}};
+
+#define DILIGENT_INTERFACE_NAME IResolvingShaderSourceFactory
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IResolvingShaderSourceFactoryInclusiveMethods \
+    IShaderSourceInputStreamFactoryInclusiveMethods;  \
+    IResolvingShaderSourceFactoryMethods ResolvingShaderSourceFactory
+
+// clang-format off
+
+/// Shader source factory that caches file path resolution and file contents
+/// and tracks the include dependencies between the source files.
+
+/// The factory resolves file names against the search directories the same way
+/// the default shader source stream factory does, but it only does this once for every name,
+/// including the names that were not found. The contents of every file are read once and
+/// are then served from memory. Include directives in every loaded file are recorded
+/// in a dependency graph that can be stored and loaded from a data blob, which allows
+/// prefetching the whole include closure of a shader in parallel.
+///
+/// The factory never looks at the file system again until Refresh() is called, so
+/// the changes made to the source files are not visible until then.
+///
+/// All methods of the factory are thread-safe.
+DILIGENT_BEGIN_INTERFACE(IResolvingShaderSourceFactory, IShaderSourceInputStreamFactory)
+{
+    /// Loads the files and all their includes.
+
+    /// \param [in] ppFileNames - An array of file names to load.
+    /// \param [in] NumFiles    - The number of elements in ppFileNames array.
+    ///
+    /// \return     The number of files that were read from the file system.
+    ///
+    /// \remarks    Files are loaded in waves: all files that are known to be included by the
+    ///             current wave (including the dependencies recorded in the graph loaded by Load())
+    ///             are read in parallel by the thread pool threads and the calling thread.
+    VIRTUAL Uint32 METHOD(Prefetch)(THIS_
+                                    const Char* const* ppFileNames,
+                                    Uint32             NumFiles) PURE;
+
+    /// Returns the hash of the include closure of the file.
+
+    /// \param [in] FileName - File name.
+    ///
+    /// \return     The hash of the contents of the file and all files it includes,
+    ///             directly or indirectly. The hash of the file that can't be found is zero.
+    ///
+    /// \remarks    The method loads the file and its includes if they have not been loaded yet.
+    ///             The hash can be used to detect whether any file in the closure has changed
+    ///             after the call to Refresh().
+    VIRTUAL Uint64 METHOD(GetClosureHash)(THIS_
+                                          const Char* FileName) PURE;
+
+    /// Re-resolves and re-reads all files known to the factory.
+
+    /// \return     The number of files whose resolved path or contents have changed.
+    VIRTUAL Uint32 METHOD(Refresh)(THIS) PURE;
+
+    /// Loads the dependency graph from the data blob.
+
+    /// \param [in] pData - A pointer to the data produced by the Store method.
+    /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The loaded graph is only used to predict the files that need to be loaded
+    ///             by Prefetch(). File paths are always resolved and file contents are always read anew.
+    VIRTUAL bool METHOD(Load)(THIS_
+                              IDataBlob* pData) PURE;
+
+    /// Writes the dependency graph to the data blob.
+
+    /// \param [out] ppDataBlob - Address of the memory location where a pointer to the
+    ///                           data blob containing the graph will be written.
+    ///                           The function calls AddRef(), so that the new object will have
+    ///                           one reference.
+    VIRTUAL void METHOD(Store)(THIS_
+                               IDataBlob** ppDataBlob) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+#    define IResolvingShaderSourceFactory_Prefetch(This, ...)       CALL_IFACE_METHOD(ResolvingShaderSourceFactory, Prefetch,       This, __VA_ARGS__)
+#    define IResolvingShaderSourceFactory_GetClosureHash(This, ...) CALL_IFACE_METHOD(ResolvingShaderSourceFactory, GetClosureHash, This, __VA_ARGS__)
+#    define IResolvingShaderSourceFactory_Refresh(This)             CALL_IFACE_METHOD(ResolvingShaderSourceFactory, Refresh,        This)
+#    define IResolvingShaderSourceFactory_Load(This, ...)           CALL_IFACE_METHOD(ResolvingShaderSourceFactory, Load,           This, __VA_ARGS__)
+#    define IResolvingShaderSourceFactory_Store(This, ...)          CALL_IFACE_METHOD(ResolvingShaderSourceFactory, Store,          This, __VA_ARGS__)
+// clang-format on
+
+#endif
+
+#include "../../../Primitives/interface/DefineGlobalFuncHelperMacros.h"
+
+/// Creates a resolving shader source factory.
+///
+/// \param [in]  CreateInfo - Resolving shader source factory create info, see Diligent::ResolvingShaderSourceFactoryCreateInfo.
+/// \param [out] ppFactory  - Address of the memory location where the pointer to the created factory will be written.
+void DILIGENT_GLOBAL_FUNCTION(CreateResolvingShaderSourceFactory)(const ResolvingShaderSourceFactoryCreateInfo REF CreateInfo,
+                                                                  IResolvingShaderSourceFactory**                   ppFactory);
+
+#include "../../../Primitives/interface/UndefGlobalFuncHelperMacros.h"
+
+DILIGENT_END_NAMESPACE // namespace Diligent
@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <functional>
+
+#include "TextureUploader.hpp"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Texture streaming request identifier.
+using TextureStreamingRequestId = Uint64;
+
+/// Invalid texture streaming request identifier.
+static constexpr TextureStreamingRequestId InvalidTextureStreamingRequestId = 0;
+
+/// Texture streaming request description.
+struct TextureStreamingRequestDesc
+{
+    /// Destination texture.
+    ITexture* pDstTexture = nullptr;
+
+    /// Destination array slice.
+    Uint32 ArraySlice = 0;
+
+    /// The first mip level to upload.
+    Uint32 FirstMip = 0;
+
+    /// The number of mip levels to upload. Zero means all remaining mip levels.
+    Uint32 NumMips = 0;
+
+    /// Request priority. Requests with higher priority are loaded and uploaded first.
+    /// Requests with equal priority are processed in the order they were enqueued.
+    float Priority = 0;
+
+    /// Callback that writes the texture data into the upload buffer.
+
+    /// The callback is executed by a thread pool worker thread or, if the scheduler
+    /// was created without a thread pool, by the thread that calls
+    /// ITextureStreamingScheduler::Update(). This is the place to decode or convert
+    /// the source data. The callback must return false if the data could not be loaded.
+    std::function<bool(IUploadBuffer* pBuffer)> LoadData;
+
+    /// Optional callback that is executed by the thread that calls ITextureStreamingScheduler::Update()
+    /// after the GPU copy has been scheduled (Success is true) or loading the data failed (Success is false).
+    /// The callback is not executed for cancelled requests.
+    std::function<void(bool Success)> OnComplete;
+};
+
+
+/// Texture streaming scheduler create info.
+struct TextureStreamingSchedulerCreateInfo
+{
+    /// Texture uploader that is used to allocate upload buffers and schedule GPU copies.
+    ITextureUploader* pUploader = nullptr;
+
+    /// Optional thread pool that executes TextureStreamingRequestDesc::LoadData callbacks.
+    /// If null, the callbacks are executed by ITextureStreamingScheduler::Update().
+    IThreadPool* pThreadPool = nullptr;
+
+    /// The maximum number of requests that may hold upload buffers at the same time,
+    /// i.e. requests whose data is being loaded or that wait for the GPU copy.
+    Uint32 MaxRequestsInFlight = 16;
+
+    /// The maximum number of bytes that may be copied to textures by a single Update() call.
+    /// Zero means no limit.
+    Uint64 MaxBytesPerUpdate = 0;
+
+    /// The maximum time, in seconds, that a single Update() call may spend scheduling
+    /// GPU copies and, when no thread pool is used, loading the data. Zero means no limit.
+    double MaxTimePerUpdate = 0;
+};
+
+
+/// Texture streaming scheduler statistics.
+struct TextureStreamingSchedulerStats
+{
+    /// The number of requests that wait for an upload buffer.
+    Uint32 NumPendingRequests = 0;
+
+    /// The number of requests whose data is being loaded.
+    Uint32 NumLoadingRequests = 0;
+
+    /// The number of requests whose data is loaded and that wait for the GPU copy.
+    Uint32 NumReadyRequests = 0;
+
+    /// The total number of requests whose GPU copies have been scheduled.
+    Uint64 NumCompletedRequests = 0;
+
+    /// The total number of requests whose data could not be loaded.
+    Uint64 NumFailedRequests = 0;
+
+    /// The total number of cancelled requests.
+    Uint64 NumCancelledRequests = 0;
+
+    /// The total number of bytes copied to textures.
+    Uint64 BytesUploaded = 0;
+
+    /// The number of GPU copies scheduled by the last Update() call.
+    Uint32 LastUpdateNumCopies = 0;
+
+    /// The number of bytes copied by the last Update() call.
+    Uint64 LastUpdateBytes = 0;
+};
+
+
+/// Priority-aware texture streaming scheduler.
+
+/// The scheduler loads texture data asynchronously and uploads it to GPU
+/// through a texture uploader in the order of request priorities, while
+/// keeping the amount of work done by every Update() call within the budget.
+///
+/// EnqueueRequest(), SetRequestPriority(), CancelRequest() and GetStats() may be called
+/// from any thread. Update() must only be called by the thread that owns the device context.
+class ITextureStreamingScheduler : public IObject
+{
+public:
+    /// Enqueues a new streaming request and returns its identifier.
+    /// Returns InvalidTextureStreamingRequestId if the request is not valid.
+    virtual TextureStreamingRequestId EnqueueRequest(const TextureStreamingRequestDesc& Desc) = 0;
+
+
+    /// Changes the priority of a request that has not been completed yet.
+    /// Returns false if the request is not found.
+    virtual bool SetRequestPriority(TextureStreamingRequestId Id, float Priority) = 0;
+
+
+    /// Cancels the request. Returns false if the request is not found, e.g.
+    /// it has already been completed.
+
+    /// \remarks    If the request's data is being loaded, the LoadData callback may still be running
+    ///             when the method returns, but the data will never be copied to the texture.
+    ///             Upload buffers of cancelled requests are returned to the texture uploader
+    ///             through ITextureUploader::DiscardBuffer() and are recycled by the next
+    ///             ITextureUploader::RenderThreadUpdate() call.
+    virtual bool CancelRequest(TextureStreamingRequestId Id) = 0;
+
+
+    /// Executes texture uploader render-thread operations, schedules GPU copies for requests
+    /// whose data has been loaded and starts loading data for the pending requests.
+
+    /// \param [in] pContext - Device context that is used to schedule the copies.
+    ///
+    /// \remarks    At least one GPU copy is scheduled by every call, if there are
+    ///             ready requests, regardless of the budget.
+    virtual void Update(IDeviceContext* pContext) = 0;
+
+
+    /// Returns scheduler statistics, see Diligent::TextureStreamingSchedulerStats.
+    virtual TextureStreamingSchedulerStats GetStats() = 0;
+};
+
+void CreateTextureStreamingScheduler(const TextureStreamingSchedulerCreateInfo& CreateInfo, ITextureStreamingScheduler** ppScheduler);
+
+} // namespace Diligent
@@ -47,10 +47,12 @@ struct UploadBufferDesc
 
     bool operator == (const UploadBufferDesc &rhs) const
     {
-        return Width  == rhs.Width  &&
-                Height == rhs.Height &&
-                Depth  == rhs.Depth  &&
-                Format == rhs.Format;
+        return Width     == rhs.Width     &&
+               Height    == rhs.Height    &&
+               Depth     == rhs.Depth     &&
+               MipLevels == rhs.MipLevels &&
+               ArraySize == rhs.ArraySize &&
+               Format    == rhs.Format;
     }
 };
 // clang-format on
@@ -66,13 +68,46 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// Staging memory page size, in bytes.
+
+    /// When non-zero, D3D12 and Vulkan texture uploaders suballocate upload buffers
+    /// from a few large staging buffers of this size instead of creating a dedicated
+    /// staging texture for every distinct upload buffer description.
+    /// Upload buffers that are larger than the page size get a dedicated page.
+    /// Other backends ignore this member.
+    Uint64 StagingMemoryPageSize = 0;
+
+    /// The maximum amount of staging memory, in bytes, that the uploader may allocate
+    /// when StagingMemoryPageSize is not zero. Zero means no limit.
+
+    /// \remarks    When the budget is exhausted, AllocateUploadBuffer() called from a worker
+    ///             thread blocks until the GPU finishes copies that use the staging memory and
+    ///             the memory is released by RenderThreadUpdate(). When the method is called
+    ///             from the render thread, it waits for the GPU to complete the scheduled copies.
+    ///             In both cases, only the memory of recycled upload buffers is waited for. If all
+    ///             staging memory is held by buffers that have not been recycled yet, the budget
+    ///             is exceeded and a warning is logged.
+    ///             Upload buffers that are larger than the budget can't be allocated.
+    Uint64 StagingMemoryBudget = 0;
 };
 
 
 /// Texture uploader statistics.
 struct TextureUploaderStats
 {
+    /// The number of operations waiting to be executed by the render thread.
     Uint32 NumPendingOperations = 0;
+
+    /// The amount of staging memory, in bytes, used by the upload buffers
+    /// that are currently allocated or whose GPU copies have not completed yet.
+    /// Only available when pooled staging memory is used.
+    Uint64 BytesInFlight = 0;
+
+    /// The total size of the staging memory, in bytes, allocated by the uploader.
+    Uint64 StagingMemorySize = 0;
+
+    /// The peak size of the staging memory, in bytes.
+    Uint64 PeakStagingMemorySize = 0;
 };
 
 /// Asynchronous texture uploader
@@ -140,6 +175,20 @@ public:
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) = 0;
 
 
+    /// Discards the upload buffer whose data will never be copied to a texture and recycles it.
+
+    /// \param [in] pContext      - Pointer to the device context when the method is executed by
+    ///                             render thread, or null when it is called from any other thread.
+    /// \param [in] pUploadBuffer - Upload buffer to discard.
+    ///
+    /// \remarks  Use this method instead of RecycleBuffer() to release a buffer for which
+    ///           ScheduleGPUCopy() has not been called, for example, when the data failed to load.
+    ///           The buffer must not be used after the call.
+    ///           When pContext is null, the buffer is unmapped and recycled by the next RenderThreadUpdate()
+    ///           call, and the method does not block.
+    virtual void DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer) = 0;
+
+
     /// Returns texture uploader statistics, see Diligent::TextureUploaderStats.
     virtual TextureUploaderStats GetStats() = 0;
 };
@@ -42,7 +42,7 @@ struct hash<Diligent::UploadBufferDesc>
 {
     size_t operator()(const Diligent::UploadBufferDesc& Desc) const
     {
-        return Diligent::ComputeHash(Desc.Width, Desc.Height, Desc.Depth, static_cast<Diligent::Int32>(Desc.Format));
+        return Diligent::ComputeHash(Desc.Width, Desc.Height, Desc.Depth, Desc.MipLevels, Desc.ArraySize, static_cast<Diligent::Int32>(Desc.Format));
     }
 };
 
@@ -97,11 +97,13 @@ class TextureUploaderBase : public ObjectBase<ITextureUploader>
 public:
     TextureUploaderBase(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
         ObjectBase<ITextureUploader>{pRefCounters},
-        m_pDevice{pDevice}
+        m_pDevice{pDevice},
+        m_Desc{Desc}
     {}
 
 protected:
     RefCntAutoPtr<IRenderDevice> m_pDevice;
+    const TextureUploaderDesc    m_Desc;
 };
 
 } // namespace Diligent
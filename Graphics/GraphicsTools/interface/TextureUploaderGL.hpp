@@ -54,6 +54,8 @@ public:
 
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final;
 
+    virtual void DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer) override final;
+
     virtual TextureUploaderStats GetStats() override final;
 
 private:
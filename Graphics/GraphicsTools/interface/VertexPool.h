@@ -52,6 +52,10 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_VertexPool =
 struct IVertexPoolAllocation : public IObject
 {
     /// Returns the start vertex of the allocation.
+
+    /// \remarks   If the pool was created with compaction enabled, the allocation may be
+    ///             moved by IVertexPool::Compact(). When this happens, the pool version
+    ///             returned by IVertexPool::GetVersion() is incremented.
     virtual Uint32 GetStartVertex() const = 0;
 
     /// Returns the number of vertices in the allocation.
@@ -105,8 +109,26 @@ struct VertexPoolUsageStats
     /// The number of allocations.
     Uint32 AllocationCount = 0;
 
+    /// Free space fragmentation, in range [0, 1].
+
+    /// The fragmentation is defined as 1 - LargestFreeRange / TotalFreeSpace.
+    /// Zero means that all free vertices form a single contiguous range, while
+    /// values close to one indicate that the free space is scattered across many
+    /// small ranges that can't accommodate large allocations.
+    float Fragmentation = 0;
+
     VertexPoolUsageStats& operator+=(const VertexPoolUsageStats& RHS)
     {
+        // Weight fragmentation by the number of free vertices in each pool
+        const auto FreeVertexCount    = TotalVertexCount - AllocatedVertexCount;
+        const auto RHSFreeVertexCount = RHS.TotalVertexCount - RHS.AllocatedVertexCount;
+        if (FreeVertexCount + RHSFreeVertexCount > 0)
+        {
+            Fragmentation = static_cast<float>((static_cast<double>(Fragmentation) * static_cast<double>(FreeVertexCount) +
+                                                static_cast<double>(RHS.Fragmentation) * static_cast<double>(RHSFreeVertexCount)) /
+                                               static_cast<double>(FreeVertexCount + RHSFreeVertexCount));
+        }
+
         TotalVertexCount += RHS.TotalVertexCount;
         AllocatedVertexCount += RHS.AllocatedVertexCount;
         CommittedMemorySize += RHS.CommittedMemorySize;
@@ -253,8 +275,42 @@ struct IVertexPool : public IObject
     /// Returns the usage stats, see Diligent::VertexPoolUsageStats.
     virtual void GetUsageStats(VertexPoolUsageStats& UsageStats) = 0;
 
-    /// Returns the internal buffer version. The version is incremented every time
-    /// any internal buffer is recreated.
+    /// Compacts the pool by moving allocations towards the beginning of the pool.
+
+    /// \param[in]  pDevice        - A pointer to the render device that will be used to
+    ///                              create internal buffers, if necessary.
+    /// \param[in]  pContext       - A pointer to the device context that will be used to
+    ///                              record the copy commands.
+    /// \param[in]  MaxBytesToMove - The maximum number of bytes to copy in this call.
+    ///                              Zero means no limit. At least one allocation is always
+    ///                              moved if possible, even if it is larger than the limit.
+    ///
+    /// \return     The number of allocations that have been moved. Zero indicates that
+    ///             no allocation can be moved to a lower offset.
+    ///
+    /// \remarks    The pool must be created with VertexPoolCreateInfo::EnableCompaction set to true.
+    ///
+    ///             The method plans the moves using the first-fit strategy: starting from the
+    ///             allocation with the highest offset, every allocation is moved to the lowest
+    ///             free range that can accommodate it. The data is copied by the GPU through an
+    ///             intermediate buffer. The method can be called every frame with a small
+    ///             MaxBytesToMove to spread the work over multiple frames.
+    ///
+    ///             When any allocation is moved, the pool version returned by GetVersion() is
+    ///             incremented, and the application must query the new start vertex of
+    ///             the allocations it uses with IVertexPoolAllocation::GetStartVertex().
+    ///             The old vertex range may be reused by a new allocation right away,
+    ///             so draw commands that use the old start vertex must not be recorded
+    ///             after the call.
+    ///
+    ///             The method is not thread-safe with respect to the device context and Update() calls,
+    ///             but Allocate() can be safely called simultaneously from other threads.
+    virtual Uint32 Compact(IRenderDevice*  pDevice,
+                           IDeviceContext* pContext,
+                           Uint64          MaxBytesToMove) = 0;
+
+    /// Returns the pool version. The version is incremented every time
+    /// any internal buffer is recreated or allocations are moved by Compact().
     virtual Uint32 GetVersion() const = 0;
 
     /// Returns the pool description.
@@ -288,13 +344,22 @@ struct VertexPoolCreateInfo
     ///             The flag is ignored in release builds as the validation is always disabled.
     bool DisableDebugValidation = false;
 
+    /// Whether to enable pool compaction, see IVertexPool::Compact().
+
+    /// \remarks    Compaction requires that all pool elements use USAGE_DEFAULT or
+    ///             USAGE_SPARSE buffers. When compaction is enabled, the pool keeps
+    ///             track of all allocations, which adds a small overhead to
+    ///             Allocate() and to allocation release.
+    bool EnableCompaction = false;
+
 
     bool operator==(const VertexPoolCreateInfo& RHS) const
     {
         return Desc == RHS.Desc &&
             ExtraVertexCount == RHS.ExtraVertexCount &&
             MaxVertexCount == RHS.MaxVertexCount &&
-            DisableDebugValidation == RHS.DisableDebugValidation;
+            DisableDebugValidation == RHS.DisableDebugValidation &&
+            EnableCompaction == RHS.EnableCompaction;
     }
 
     bool operator!=(const VertexPoolCreateInfo& RHS) const
@@ -188,6 +188,12 @@ struct VertexPoolCreateInfoX : private _VertexPoolCreateInfo, public VertexPoolD
         return *this;
     }
 
+    VertexPoolCreateInfoX& SetEnableCompaction(bool _EnableCompaction)
+    {
+        m_PrivateCI.EnableCompaction = _EnableCompaction;
+        return *this;
+    }
+
     operator const VertexPoolCreateInfo&() const
     {
         return m_PrivateCI;
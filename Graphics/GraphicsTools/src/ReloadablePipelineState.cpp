@@ -38,6 +38,8 @@ constexpr INTERFACE_ID ReloadablePipelineState::IID_InternalImpl;
 struct ReloadablePipelineState::CreateInfoWrapperBase
 {
     virtual ~CreateInfoWrapperBase() {}
+
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const = 0;
 };
 
 template <typename CreateInfoType>
@@ -64,6 +66,16 @@ struct ReloadablePipelineState::CreateInfoWrapper : CreateInfoWrapperBase
         return m_CI;
     }
 
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const override final
+    {
+        bool UsesShader = false;
+        ProcessPipelineStateCreateInfoShaders(static_cast<const CreateInfoType&>(m_CI), [&](IShader* pShader) {
+            if (pShader != nullptr && Shaders.find(pShader) != Shaders.end())
+                UsesShader = true;
+        });
+        return UsesShader;
+    }
+
     operator const CreateInfoType&() const
     {
         return m_CI;
@@ -139,58 +151,81 @@ void ReloadablePipelineState::QueryInterface(const INTERFACE_ID& IID, IObject**
     }
 }
 
-template <typename CreateInfoType>
-void ModifyPsoCreateInfo(CreateInfoType& PsoCreateInfo, ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
+void ReloadablePipelineState::ModifyCreateInfo(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
 {
-}
+    if (ReloadGraphicsPipeline == nullptr || !IsGraphicsPipeline())
+        return;
 
-template <>
-void ModifyPsoCreateInfo(GraphicsPipelineStateCreateInfo& PsoCreateInfo, ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
-{
-    if (ReloadGraphicsPipeline != nullptr)
-    {
-        ReloadGraphicsPipeline(PsoCreateInfo.PSODesc.Name, PsoCreateInfo.GraphicsPipeline, pUserData);
-    }
+    auto& CreateInfo = static_cast<GraphicsPipelineStateCreateInfo&>(static_cast<CreateInfoWrapper<GraphicsPipelineStateCreateInfo>&>(*m_pCreateInfo));
+    ReloadGraphicsPipeline(CreateInfo.PSODesc.Name, CreateInfo.GraphicsPipeline, pUserData);
 }
 
 template <typename CreateInfoType>
-bool ReloadablePipelineState::Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
+bool ReloadablePipelineState::Reload()
 {
-    auto& CreateInfo = static_cast<CreateInfoWrapper<CreateInfoType>&>(*m_pCreateInfo);
-    ModifyPsoCreateInfo<CreateInfoType>(static_cast<CreateInfoType&>(CreateInfo), ReloadGraphicsPipeline, pUserData);
+    const auto& CreateInfo = static_cast<const CreateInfoWrapper<CreateInfoType>&>(*m_pCreateInfo);
 
     RefCntAutoPtr<IPipelineState> pNewPSO;
 
     // Note that the create info struct references reloadable shaders, so that the pipeline will use the updated shaders
-    const auto FoundInCache = m_pStateCache->CreatePipelineStateInternal(static_cast<const CreateInfoType&>(CreateInfo), &pNewPSO);
+    const auto FoundInCache = m_pStateCache->CreatePipelineStateInternal(CreateInfo.Get(), &pNewPSO);
 
     if (pNewPSO)
     {
         if (m_pPipeline != pNewPSO)
         {
-            // Do not update old pipeline if it is not null.
-            // If multiple reloads are requested, we need to keep the original pipeline that keeps the original resources.
-            if (!m_pOldPipeline)
-            {
-                m_pOldPipeline = m_pPipeline;
-            }
-            m_pPipeline = pNewPSO;
-
-            // If any of the pipelines is not ready, we will copy static resources when both are ready in GetStatus()
-            if (m_pPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY && m_pOldPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY)
-            {
-                CopyStaticResources();
-            }
+            // Keep using the current pipeline until the new one is ready
+            m_pPendingPipeline = pNewPSO;
+            UpdatePendingPipeline(false);
+        }
+        else
+        {
+            m_pPendingPipeline.Release();
         }
     }
     else
     {
         const auto* Name = CreateInfo.Get().PSODesc.Name;
-        LOG_ERROR_MESSAGE("Failed to reload pipeline state '", (Name ? Name : "<unnamed>"), "'.");
+        LOG_ERROR_MESSAGE("Failed to reload pipeline state '", (Name ? Name : "<unnamed>"), "'. The previous version of the pipeline will be used.");
     }
     return !FoundInCache;
 }
 
+void ReloadablePipelineState::UpdatePendingPipeline(bool WaitForCompletion)
+{
+    if (!m_pPendingPipeline)
+        return;
+
+    const PIPELINE_STATE_STATUS Status = m_pPendingPipeline->GetStatus(WaitForCompletion);
+    if (Status == PIPELINE_STATE_STATUS_READY)
+    {
+        // Do not update old pipeline if it is not null.
+        // If multiple reloads are requested, we need to keep the original pipeline that keeps the original resources.
+        if (!m_pOldPipeline)
+        {
+            m_pOldPipeline = m_pPipeline;
+        }
+        m_pPipeline = std::move(m_pPendingPipeline);
+
+        // If the old pipeline is not ready, we will copy static resources when it is ready in GetStatus()
+        if (m_pOldPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY)
+        {
+            CopyStaticResources();
+        }
+    }
+    else if (Status == PIPELINE_STATE_STATUS_FAILED)
+    {
+        const auto* Name = m_pPendingPipeline->GetDesc().Name;
+        LOG_ERROR_MESSAGE("Failed to reload pipeline state '", (Name ? Name : "<unnamed>"), "'. The previous version of the pipeline will be used.");
+        m_pPendingPipeline.Release();
+    }
+}
+
+bool ReloadablePipelineState::UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const
+{
+    return m_pCreateInfo && m_pCreateInfo->UsesAnyShader(Shaders);
+}
+
 void ReloadablePipelineState::CopyStaticResources()
 {
     const Uint32 SrcSignCount = m_pOldPipeline->GetResourceSignatureCount();
@@ -217,6 +252,8 @@ void ReloadablePipelineState::CopyStaticResources()
 
 PIPELINE_STATE_STATUS ReloadablePipelineState::GetStatus(bool WaitForCompletion)
 {
+    UpdatePendingPipeline(WaitForCompletion);
+
     const PIPELINE_STATE_STATUS Status = m_pPipeline ? m_pPipeline->GetStatus(WaitForCompletion) : PIPELINE_STATE_STATUS_FAILED;
     if (Status != PIPELINE_STATE_STATUS_READY)
         return Status;
@@ -244,7 +281,7 @@ PIPELINE_STATE_STATUS ReloadablePipelineState::GetStatus(bool WaitForCompletion)
     return Status;
 }
 
-bool ReloadablePipelineState::Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
+bool ReloadablePipelineState::Reload()
 {
     static_assert(PIPELINE_TYPE_COUNT == 5, "Did you add a new pipeline type? You may need to handle it here.");
     // Note that all shaders in Create Info are reloadable shaders, so they will automatically redirect all calls
@@ -253,16 +290,16 @@ bool ReloadablePipelineState::Reload(ReloadGraphicsPipelineCallbackType ReloadGr
     {
         case PIPELINE_TYPE_GRAPHICS:
         case PIPELINE_TYPE_MESH:
-            return Reload<GraphicsPipelineStateCreateInfo>(ReloadGraphicsPipeline, pUserData);
+            return Reload<GraphicsPipelineStateCreateInfo>();
 
         case PIPELINE_TYPE_COMPUTE:
-            return Reload<ComputePipelineStateCreateInfo>(ReloadGraphicsPipeline, pUserData);
+            return Reload<ComputePipelineStateCreateInfo>();
 
         case PIPELINE_TYPE_RAY_TRACING:
-            return Reload<RayTracingPipelineStateCreateInfo>(ReloadGraphicsPipeline, pUserData);
+            return Reload<RayTracingPipelineStateCreateInfo>();
 
         case PIPELINE_TYPE_TILE:
-            return Reload<TilePipelineStateCreateInfo>(ReloadGraphicsPipeline, pUserData);
+            return Reload<TilePipelineStateCreateInfo>();
 
         default:
             UNEXPECTED("Unexpected pipeline type");
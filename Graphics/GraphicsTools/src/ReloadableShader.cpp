@@ -25,7 +25,12 @@
  */
 
 #include "ReloadableShader.hpp"
+
+#include <algorithm>
+
 #include "RenderStateCacheImpl.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "FileSystem.hpp"
 
 namespace Diligent
 {
@@ -45,6 +50,8 @@ ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+
+    UpdateSourceFiles();
 }
 
 ReloadableShader::~ReloadableShader()
@@ -88,16 +95,126 @@ bool ReloadableShader::Reload()
     const bool FoundInCache = m_pStateCache->CreateShaderInternal(m_CreateInfo, &pNewShader);
     if (pNewShader)
     {
-        m_pShader = pNewShader;
+        if (m_pShader != pNewShader)
+        {
+            // Keep using the current shader until the new one is compiled
+            m_pPendingShader = pNewShader;
+            UpdatePendingShader(false);
+        }
+        else
+        {
+            m_pPendingShader.Release();
+        }
     }
     else
     {
         const char* Name = m_CreateInfo.Get().Desc.Name;
-        LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'.");
+        LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'. The previous version of the shader will be used.");
     }
+
+    // The list of included files may have changed
+    UpdateSourceFiles();
+
     return !FoundInCache;
 }
 
+void ReloadableShader::UpdatePendingShader(bool WaitForCompletion)
+{
+    if (!m_pPendingShader)
+        return;
+
+    const SHADER_STATUS Status = m_pPendingShader->GetStatus(WaitForCompletion);
+    if (Status == SHADER_STATUS_READY)
+    {
+        m_pShader = std::move(m_pPendingShader);
+    }
+    else if (Status == SHADER_STATUS_FAILED)
+    {
+        const char* Name = m_CreateInfo.Get().Desc.Name;
+        LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'. The previous version of the shader will be used.");
+        m_pPendingShader.Release();
+    }
+}
+
+SHADER_STATUS ReloadableShader::GetStatus(bool WaitForCompletion)
+{
+    UpdatePendingShader(WaitForCompletion);
+    return m_pShader->GetStatus(WaitForCompletion);
+}
+
+std::string ReloadableShader::NormalizeSourcePath(const char* Path)
+{
+    return FileSystem::SimplifyPath(Path, '/');
+}
+
+void ReloadableShader::UpdateSourceFiles()
+{
+    const ShaderCreateInfo& ShaderCI = m_CreateInfo;
+    if (ShaderCI.FilePath == nullptr && ShaderCI.Source == nullptr)
+        return; // Byte code
+
+    std::vector<std::string> SourceFiles;
+    const bool               Succeeded = ProcessShaderIncludes(ShaderCI, [&SourceFiles](const ShaderIncludePreprocessInfo& ProcessInfo) {
+        if (!ProcessInfo.FilePath.empty())
+            SourceFiles.emplace_back(NormalizeSourcePath(ProcessInfo.FilePath.c_str()));
+    });
+
+    if (!Succeeded)
+    {
+        // Keep the files we know about so that the shader is reloaded once the error is fixed
+        SourceFiles.insert(SourceFiles.end(), m_SourceFiles.begin(), m_SourceFiles.end());
+    }
+
+    std::sort(SourceFiles.begin(), SourceFiles.end());
+    SourceFiles.erase(std::unique(SourceFiles.begin(), SourceFiles.end()), SourceFiles.end());
+    m_SourceFiles = std::move(SourceFiles);
+}
+
+// Returns true if one path is a suffix of the other one that starts at a path component
+// boundary, e.g. "shaders/common/Lighting.fxh" and "common/Lighting.fxh".
+static bool IsSameSourceFile(const std::string& Path0, const std::string& Path1)
+{
+    const std::string& Long  = Path0.length() >= Path1.length() ? Path0 : Path1;
+    const std::string& Short = Path0.length() >= Path1.length() ? Path1 : Path0;
+    if (Short.empty())
+        return false;
+
+    const size_t Offset = Long.length() - Short.length();
+    if (Long.compare(Offset, Short.length(), Short) != 0)
+        return false;
+
+    return Offset == 0 || Long[Offset - 1] == '/' || Short.front() == '/';
+}
+
+// Returns true if the source file is affected by the change of the given path, i.e. if the path
+// is the same file or one of the directories the file is located in. Directories are reported
+// as changed when they are deleted or moved.
+static bool IsSourceFileAffected(const std::string& ChangedPath, const std::string& SourceFile)
+{
+    if (IsSameSourceFile(ChangedPath, SourceFile))
+        return true;
+
+    for (size_t Pos = SourceFile.find('/', 1); Pos != std::string::npos; Pos = SourceFile.find('/', Pos + 1))
+    {
+        if (IsSameSourceFile(ChangedPath, SourceFile.substr(0, Pos)))
+            return true;
+    }
+    return false;
+}
+
+bool ReloadableShader::DependsOnAnyFile(const std::vector<std::string>& ChangedFiles) const
+{
+    for (const std::string& ChangedFile : ChangedFiles)
+    {
+        for (const std::string& SourceFile : m_SourceFiles)
+        {
+            if (IsSourceFileAffected(ChangedFile, SourceFile))
+                return true;
+        }
+    }
+    return false;
+}
+
 
 void ReloadableShader::Create(RenderStateCacheImpl*   pStateCache,
                               IShader*                pShader,
@@ -32,8 +32,13 @@
 #include "ReloadablePipelineState.hpp"
 #include "AsyncPipelineState.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "Archiver.h"
@@ -49,6 +54,7 @@
 #include "GraphicsAccessories.hpp"
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -228,6 +234,17 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    if (m_CI.EnableHotReload && CreateInfo.WatchDirectories != nullptr)
+    {
+        m_pFileWatcher = std::make_unique<FileChangeWatcher>(CreateInfo.WatchDirectories);
+        if (!m_pFileWatcher->IsActive())
+        {
+            LOG_WARNING_MESSAGE("Render state cache is unable to watch shader source directories '", CreateInfo.WatchDirectories,
+                                "'. Use IRenderStateCache::NotifyFileChanged to report changed files.");
+            m_pFileWatcher.reset();
+        }
+    }
 }
 
 #define RENDER_STATE_CACHE_LOG(Level, ...)                         \
@@ -887,6 +904,78 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     return false;
 }
 
+// Reloads the objects using the thread pool threads and the calling thread.
+// Returns the number of objects that were not found in the cache.
+template <typename ObjectType>
+static Uint32 ReloadObjects(IThreadPool* pThreadPool, std::vector<RefCntAutoPtr<ObjectType>> Objects)
+{
+    if (pThreadPool == nullptr || Objects.size() < 2)
+    {
+        Uint32 NumReloaded = 0;
+        for (auto& pObject : Objects)
+        {
+            if (pObject->Reload())
+                ++NumReloaded;
+        }
+        return NumReloaded;
+    }
+
+    // The state is shared with the thread pool tasks, which may start after this function returns
+    struct ReloadState
+    {
+        explicit ReloadState(std::vector<RefCntAutoPtr<ObjectType>>&& _Objects) :
+            Objects{std::move(_Objects)}
+        {}
+
+        void Process()
+        {
+            size_t NumProcessed = 0;
+            for (size_t Idx = NextIdx.fetch_add(1); Idx < Objects.size(); Idx = NextIdx.fetch_add(1))
+            {
+                if (Objects[Idx]->Reload())
+                    NumReloaded.fetch_add(1);
+                ++NumProcessed;
+            }
+
+            if (NumProcessed > 0 && NumDone.fetch_add(NumProcessed) + NumProcessed == Objects.size())
+            {
+                std::lock_guard<std::mutex> Lock{Mtx};
+                DoneCV.notify_one();
+            }
+        }
+
+        const std::vector<RefCntAutoPtr<ObjectType>> Objects;
+
+        std::atomic<size_t> NextIdx{0};
+        std::atomic<size_t> NumDone{0};
+        std::atomic<Uint32> NumReloaded{0};
+
+        std::mutex              Mtx;
+        std::condition_variable DoneCV;
+    };
+    auto pState = std::make_shared<ReloadState>(std::move(Objects));
+
+    const size_t NumTasks = std::min<size_t>(pState->Objects.size() - 1, std::max(std::thread::hardware_concurrency(), 1u));
+    for (size_t i = 0; i < NumTasks; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [pState](Uint32 ThreadId) {
+                             pState->Process();
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    // The calling thread reloads the objects too, so that the function makes progress
+    // even if all thread pool threads are busy.
+    pState->Process();
+    {
+        std::unique_lock<std::mutex> Lock{pState->Mtx};
+        pState->DoneCV.wait(Lock, [&pState]() { return pState->NumDone.load() == pState->Objects.size(); });
+    }
+
+    return pState->NumReloaded.load();
+}
+
 Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData)
 {
     if (!m_CI.EnableHotReload)
@@ -895,9 +984,29 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         return 0;
     }
 
-    Uint32 NumStatesReloaded = 0;
+    std::vector<std::string> ChangedFiles;
+    // If we don't know which files changed, reload everything
+    bool ReloadAll = true;
+    {
+        std::lock_guard<std::mutex> Guard{m_ChangedFilesMtx};
+
+        bool NoEventsLost = true;
+        if (m_pFileWatcher)
+        {
+            std::vector<std::string> WatchedFiles;
+            NoEventsLost = m_pFileWatcher->PollChanges(WatchedFiles);
+            for (const std::string& File : WatchedFiles)
+                m_ChangedFiles.emplace_back(ReloadableShader::NormalizeSourcePath(File.c_str()));
+        }
+
+        ReloadAll = !NoEventsLost || (!m_pFileWatcher && !m_FileChangesNotified);
+        ChangedFiles.swap(m_ChangedFiles);
+    }
 
-    // Reload all shaders first
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+
+    // Reload affected shaders first
+    std::vector<RefCntAutoPtr<ReloadableShader>> Shaders;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
         for (auto shader_it : m_ReloadableShaders)
@@ -907,8 +1016,8 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
                 RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
                 if (pReloadableShader)
                 {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
+                    if (ReloadAll || pReloadableShader->DependsOnAnyFile(ChangedFiles))
+                        Shaders.emplace_back(std::move(pReloadableShader));
                 }
                 else
                 {
@@ -918,9 +1027,23 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
-    // Reload pipelines.
+    std::unordered_set<const IShader*> ReloadedShaders;
+    for (const auto& pShader : Shaders)
+        ReloadedShaders.emplace(pShader.RawPtr());
+
+    Uint32 NumStatesReloaded = ReloadObjects(pThreadPool, Shaders);
+
+    // Reloaded shaders may still be compiling asynchronously. Wait for them in this thread
+    // so that the reloaded pipelines use the new shaders, and the pipeline reload tasks
+    // do not block the thread pool threads waiting for the shaders.
+    for (auto& pShader : Shaders)
+        pShader->GetStatus(/*WaitForCompletion = */ true);
+    Shaders.clear();
+
+    // Reload pipelines that use the reloaded shaders.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    std::vector<RefCntAutoPtr<ReloadablePipelineState>> Pipelines;
     {
         std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
         for (auto pso_it : m_ReloadablePipelines)
@@ -928,10 +1051,13 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             if (auto pPSO = pso_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (pReloadablePSO)
                 {
-                    if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
-                        ++NumStatesReloaded;
+                    // The callback may modify any graphics pipeline
+                    if (ReloadAll ||
+                        (ReloadGraphicsPipeline != nullptr && pReloadablePSO->IsGraphicsPipeline()) ||
+                        pReloadablePSO->UsesAnyShader(ReloadedShaders))
+                        Pipelines.emplace_back(std::move(pReloadablePSO));
                 }
                 else
                 {
@@ -941,9 +1067,28 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
+    // Always run the application callback in this thread
+    for (auto& pPSO : Pipelines)
+        pPSO->ModifyCreateInfo(ReloadGraphicsPipeline, pUserData);
+
+    NumStatesReloaded += ReloadObjects(pThreadPool, std::move(Pipelines));
+
     return NumStatesReloaded;
 }
 
+void RenderStateCacheImpl::NotifyFileChanged(const Char* FilePath)
+{
+    if (FilePath == nullptr || FilePath[0] == '\0')
+    {
+        DEV_ERROR("File path must not be null or empty");
+        return;
+    }
+
+    std::lock_guard<std::mutex> Guard{m_ChangedFilesMtx};
+    m_ChangedFiles.emplace_back(ReloadableShader::NormalizeSourcePath(FilePath));
+    m_FileChangesNotified = true;
+}
+
 static constexpr char RenderStateCacheFileExtension[] = ".diligentcache";
 
 std::string GetRenderStateCacheFilePath(const char* CacheLocation, const char* AppName, RENDER_DEVICE_TYPE DeviceType)
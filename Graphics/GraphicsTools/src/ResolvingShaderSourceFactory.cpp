@@ -0,0 +1,609 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ResolvingShaderSourceFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "HashUtils.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "Serializer.hpp"
+#include "ThreadPool.hpp"
+#include "XXH128Hasher.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "ShaderToolsCommon.hpp"
+
+namespace Diligent
+{
+
+class ResolvingShaderSourceFactoryImpl final : public ObjectBase<IResolvingShaderSourceFactory>
+{
+public:
+    using TBase = ObjectBase<IResolvingShaderSourceFactory>;
+
+    struct GraphHeader
+    {
+        static constexpr Uint32 HeaderMagic   = 0x5DE9C0DE;
+        static constexpr Uint32 HeaderVersion = 1;
+
+        Uint32 Magic   = HeaderMagic;
+        Uint32 Version = HeaderVersion;
+
+        Uint64 FileCount = 0;
+
+        template <typename SerType>
+        bool Serialize(SerType& Stream)
+        {
+            return Stream(Magic, Version, FileCount);
+        }
+    };
+
+public:
+    ResolvingShaderSourceFactoryImpl(IReferenceCounters*                           pRefCounters,
+                                     const ResolvingShaderSourceFactoryCreateInfo& CreateInfo) :
+        TBase{pRefCounters},
+        m_pThreadPool{CreateInfo.pThreadPool}
+    {
+        if (CreateInfo.SearchDirectories != nullptr)
+        {
+            FileSystem::SplitPathList(CreateInfo.SearchDirectories,
+                                      [&](const char* Path, size_t Len) //
+                                      {
+                                          String SearchPath{Path, Len};
+                                          VERIFY_EXPR(!SearchPath.empty());
+                                          if (!FileSystem::IsSlash(SearchPath.back()))
+                                              SearchPath.push_back(FileSystem::SlashSymbol);
+                                          m_SearchDirectories.emplace_back(std::move(SearchPath));
+                                          return true;
+                                      });
+        }
+        m_SearchDirectories.push_back("");
+    }
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_ResolvingShaderSourceFactory, IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        DEV_CHECK_ERR(ppStream != nullptr, "ppStream must not be null");
+        DEV_CHECK_ERR(*ppStream == nullptr, "*ppStream is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
+
+        RefCntAutoPtr<IDataBlob> pData;
+        if (Name != nullptr && Name[0] != '\0')
+            pData = GetFileData(Name);
+
+        if (pData)
+        {
+            RefCntAutoPtr<MemoryFileStream> pMemStream{MakeNewRCObj<MemoryFileStream>()(pData)};
+            pMemStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+        }
+        else
+        {
+            *ppStream = nullptr;
+            if ((Flags & CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT) == 0)
+            {
+                LOG_ERROR("Failed to create input stream for source file ", (Name != nullptr ? Name : "<null>"));
+            }
+        }
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE Prefetch(const Char* const* ppFileNames,
+                                               Uint32             NumFiles) override final
+    {
+        std::vector<std::string> Names;
+        Names.reserve(NumFiles);
+        for (Uint32 i = 0; i < NumFiles; ++i)
+        {
+            if (ppFileNames[i] != nullptr && ppFileNames[i][0] != '\0')
+                Names.emplace_back(ppFileNames[i]);
+        }
+        return PrefetchClosure(std::move(Names));
+    }
+
+    virtual Uint64 DILIGENT_CALL_TYPE GetClosureHash(const Char* FileName) override final
+    {
+        if (FileName == nullptr || FileName[0] == '\0')
+            return 0;
+
+        PrefetchClosure({FileName});
+
+        std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+        auto it = m_Files.find(FileName);
+        if (it == m_Files.end() || it->second.Path.empty())
+            return 0;
+
+        XXH128State Hasher;
+
+        // Visit the files in the include order so that the hash does not depend on
+        // the order in which they were loaded.
+        std::unordered_set<std::string> Visited;
+        std::vector<const char*>        Stack{FileName};
+        while (!Stack.empty())
+        {
+            const char* Name = Stack.back();
+            Stack.pop_back();
+            if (!Visited.emplace(Name).second)
+                continue;
+
+            Hasher.UpdateStr(Name);
+
+            auto file_it = m_Files.find(Name);
+            if (file_it == m_Files.end())
+                continue;
+
+            const FileInfo& Info = file_it->second;
+            // Hash the resolved path too so that moving a file to another search directory changes the hash
+            Hasher.Update(Info.Path, Info.Hash.LowPart, Info.Hash.HighPart);
+            for (auto inc_it = Info.Includes.rbegin(); inc_it != Info.Includes.rend(); ++inc_it)
+                Stack.push_back(inc_it->c_str());
+        }
+
+        return Hasher.Digest().LowPart;
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE Refresh() override final
+    {
+        std::vector<std::string> Names;
+        {
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+            Names.reserve(m_Files.size());
+            for (const auto& it : m_Files)
+                Names.emplace_back(it.first.GetStr());
+        }
+
+        std::vector<FileInfo> Files = LoadFiles(Names);
+
+        Uint32                   NumChanged = 0;
+        std::vector<std::string> NewIncludes;
+        {
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+            for (size_t i = 0; i < Names.size(); ++i)
+            {
+                FileInfo& NewInfo = Files[i];
+
+                auto it = m_Files.find(Names[i].c_str());
+                if (it == m_Files.end())
+                    it = m_Files.emplace(HashMapStringKey{Names[i]}, FileInfo{}).first;
+
+                FileInfo& Info = it->second;
+                if (Info.IsLoaded && (Info.Path != NewInfo.Path || !(Info.Hash == NewInfo.Hash)))
+                    ++NumChanged;
+
+                for (const std::string& Include : NewInfo.Includes)
+                {
+                    if (m_Files.find(Include.c_str()) == m_Files.end())
+                        NewIncludes.emplace_back(Include);
+                }
+                Info = std::move(NewInfo);
+            }
+        }
+
+        // Load the files that were added to the closures of the changed files
+        if (!NewIncludes.empty())
+            PrefetchClosure(std::move(NewIncludes));
+
+        return NumChanged;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE Load(IDataBlob* pDataBlob) override final
+    {
+        if (pDataBlob == nullptr)
+        {
+            DEV_ERROR("Data blob must not be null");
+            return false;
+        }
+
+        Serializer<SerializerMode::Read> Stream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+
+        GraphHeader Header;
+        if (!Header.Serialize(Stream) || Header.Magic != GraphHeader::HeaderMagic)
+        {
+            LOG_ERROR_MESSAGE("Incorrect shader dependency graph header magic number");
+            return false;
+        }
+
+        if (Header.Version != GraphHeader::HeaderVersion)
+        {
+            LOG_ERROR_MESSAGE("Incorrect shader dependency graph version (", Header.Version, "). ", Uint32{GraphHeader::HeaderVersion}, " is expected.");
+            return false;
+        }
+
+        std::vector<std::pair<std::string, FileInfo>> Files;
+        for (Uint64 FileIdx = 0; FileIdx < Header.FileCount; ++FileIdx)
+        {
+            const char* Name        = nullptr;
+            const char* Path        = nullptr;
+            Uint32      NumIncludes = 0;
+            FileInfo    Info;
+            if (!Stream(Name, Path, Info.Hash.LowPart, Info.Hash.HighPart, NumIncludes))
+            {
+                LOG_ERROR_MESSAGE("Shader dependency graph data is corrupted");
+                return false;
+            }
+            Info.Path = Path;
+
+            Info.Includes.resize(NumIncludes);
+            for (std::string& Include : Info.Includes)
+            {
+                const char* IncludeName = nullptr;
+                if (!Stream(IncludeName))
+                {
+                    LOG_ERROR_MESSAGE("Shader dependency graph data is corrupted");
+                    return false;
+                }
+                Include = IncludeName;
+            }
+
+            Files.emplace_back(Name, std::move(Info));
+        }
+        VERIFY_EXPR(Stream.IsEnded());
+
+        std::lock_guard<std::mutex> Guard{m_FilesMtx};
+        for (auto& File : Files)
+        {
+            // Files that have already been loaded take precedence
+            m_Files.emplace(HashMapStringKey{File.first}, std::move(File.second));
+        }
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final
+    {
+        DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
+        DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
+
+        std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+        auto WriteData = [&](auto& Stream) //
+        {
+            GraphHeader Header{};
+            Header.FileCount = m_Files.size();
+            Header.Serialize(Stream);
+
+            for (const auto& it : m_Files)
+            {
+                const FileInfo& Info = it.second;
+
+                const char* Name        = it.first.GetStr();
+                const char* Path        = Info.Path.c_str();
+                Uint32      NumIncludes = static_cast<Uint32>(Info.Includes.size());
+                Stream(Name, Path, Info.Hash.LowPart, Info.Hash.HighPart, NumIncludes);
+                for (const std::string& Include : Info.Includes)
+                {
+                    const char* IncludeName = Include.c_str();
+                    Stream(IncludeName);
+                }
+            }
+        };
+
+        Serializer<SerializerMode::Measure> MeasureStream{};
+        WriteData(MeasureStream);
+
+        const auto Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+
+        Serializer<SerializerMode::Write> WriteStream{Memory};
+        WriteData(WriteStream);
+        VERIFY_EXPR(WriteStream.IsEnded());
+
+        *ppDataBlob = DataBlobImpl::Create(Memory.Size(), Memory.Ptr()).Detach();
+    }
+
+private:
+    struct FileInfo
+    {
+        // Resolved file path. Empty if the file was not found.
+        std::string Path;
+
+        // File contents. Null if the file has not been loaded yet.
+        RefCntAutoPtr<IDataBlob> pData;
+
+        XXH128Hash Hash;
+
+        // Unique names of the files included by this file, in the order of the include directives
+        std::vector<std::string> Includes;
+
+        // Whether the file has been resolved and read by this factory.
+        // Files that are only known from the graph loaded by Load() are not.
+        bool IsLoaded = false;
+    };
+
+    std::string ResolvePath(const char* Name) const
+    {
+        if (FileSystem::IsPathAbsolute(Name))
+            return FileSystem::FileExists(Name) ? std::string{Name} : std::string{};
+
+        if (Name[0] == '\\' || Name[0] == '/')
+            ++Name;
+
+        for (const std::string& SearchDir : m_SearchDirectories)
+        {
+            std::string FullPath = SearchDir + Name;
+            if (FileSystem::FileExists(FullPath.c_str()))
+                return FullPath;
+        }
+
+        return {};
+    }
+
+    // Resolves the file path, reads the file and finds its includes.
+    // Does not access the file map and can be called by any thread.
+    FileInfo LoadFile(const char* Name) const
+    {
+        FileInfo Info;
+        Info.IsLoaded = true;
+        Info.Path     = ResolvePath(Name);
+        if (Info.Path.empty())
+            return Info;
+
+        if (!FileWrapper::ReadWholeFile(Info.Path.c_str(), &Info.pData, /*Silent = */ true))
+        {
+            Info.Path.clear();
+            return Info;
+        }
+
+        const char*  pSource      = Info.pData->GetConstDataPtr<char>();
+        const size_t SourceLength = Info.pData->GetSize();
+
+        XXH128State Hasher;
+        Hasher.UpdateRaw(pSource, SourceLength);
+        Info.Hash = Hasher.Digest();
+
+        std::unordered_set<std::string> UniqueIncludes;
+        // Parsing errors are ignored here as they will be reported by the shader compiler
+        FindShaderIncludes(pSource, SourceLength, [&](const std::string& Include) {
+            if (UniqueIncludes.insert(Include).second)
+                Info.Includes.push_back(Include);
+        });
+
+        return Info;
+    }
+
+    // Loads the files using the thread pool threads and the calling thread.
+    std::vector<FileInfo> LoadFiles(const std::vector<std::string>& Names)
+    {
+        if (!m_pThreadPool || Names.size() < 2)
+        {
+            std::vector<FileInfo> Files;
+            Files.reserve(Names.size());
+            for (const std::string& Name : Names)
+                Files.emplace_back(LoadFile(Name.c_str()));
+            return Files;
+        }
+
+        // The state is shared with the thread pool tasks, which may start after this function returns
+        struct LoadState
+        {
+            LoadState(const ResolvingShaderSourceFactoryImpl& _Factory, const std::vector<std::string>& _Names) :
+                Factory{_Factory},
+                Names{_Names},
+                Files(_Names.size())
+            {}
+
+            void Process()
+            {
+                size_t NumProcessed = 0;
+                for (size_t Idx = NextIdx.fetch_add(1); Idx < Names.size(); Idx = NextIdx.fetch_add(1))
+                {
+                    Files[Idx] = Factory.LoadFile(Names[Idx].c_str());
+                    ++NumProcessed;
+                }
+
+                if (NumProcessed > 0 && NumDone.fetch_add(NumProcessed) + NumProcessed == Names.size())
+                {
+                    std::lock_guard<std::mutex> Lock{Mtx};
+                    DoneCV.notify_one();
+                }
+            }
+
+            const ResolvingShaderSourceFactoryImpl& Factory;
+            const std::vector<std::string>          Names;
+            std::vector<FileInfo>                   Files;
+
+            std::atomic<size_t> NextIdx{0};
+            std::atomic<size_t> NumDone{0};
+
+            std::mutex              Mtx;
+            std::condition_variable DoneCV;
+        };
+        auto pState = std::make_shared<LoadState>(*this, Names);
+
+        // Keep the factory alive while the tasks may still use it
+        RefCntAutoPtr<IResolvingShaderSourceFactory> pThis{this};
+
+        const size_t NumTasks = std::min<size_t>(Names.size() - 1, std::max(std::thread::hardware_concurrency(), 1u));
+        for (size_t i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(m_pThreadPool,
+                             [pState, pThis](Uint32 ThreadId) {
+                                 pState->Process();
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+
+        // The calling thread processes the files too, so that the function makes progress
+        // even if all thread pool threads are busy.
+        pState->Process();
+        {
+            std::unique_lock<std::mutex> Lock{pState->Mtx};
+            pState->DoneCV.wait(Lock, [&pState]() { return pState->NumDone.load() == pState->Names.size(); });
+        }
+
+        return std::move(pState->Files);
+    }
+
+    Uint32 PrefetchClosure(std::vector<std::string> Wave)
+    {
+        Uint32 NumFilesRead = 0;
+
+        std::unordered_set<std::string> Visited;
+        while (!Wave.empty())
+        {
+            // Expand the wave with all files that are known to be included by it
+            // and select the ones that need to be loaded.
+            std::vector<std::string> FilesToLoad;
+            {
+                std::lock_guard<std::mutex> Guard{m_FilesMtx};
+                while (!Wave.empty())
+                {
+                    std::string Name = std::move(Wave.back());
+                    Wave.pop_back();
+                    if (Visited.find(Name) != Visited.end())
+                        continue;
+
+                    auto it = m_Files.find(Name.c_str());
+                    if (it != m_Files.end())
+                    {
+                        const FileInfo& Info = it->second;
+                        for (const std::string& Include : Info.Includes)
+                        {
+                            if (Visited.find(Include) == Visited.end())
+                                Wave.push_back(Include);
+                        }
+                        if (Info.IsLoaded)
+                        {
+                            Visited.emplace(std::move(Name));
+                            continue;
+                        }
+                    }
+
+                    FilesToLoad.push_back(Name);
+                    Visited.emplace(std::move(Name));
+                }
+            }
+
+            if (FilesToLoad.empty())
+                break;
+
+            std::vector<FileInfo> Files = LoadFiles(FilesToLoad);
+
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+            for (size_t i = 0; i < FilesToLoad.size(); ++i)
+            {
+                FileInfo& NewInfo = Files[i];
+                if (!NewInfo.Path.empty())
+                    ++NumFilesRead;
+
+                // Includes that were not predicted by the loaded graph form the next wave
+                for (const std::string& Include : NewInfo.Includes)
+                {
+                    if (Visited.find(Include) == Visited.end())
+                        Wave.push_back(Include);
+                }
+
+                auto it = m_Files.find(FilesToLoad[i].c_str());
+                if (it == m_Files.end())
+                    m_Files.emplace(HashMapStringKey{FilesToLoad[i]}, std::move(NewInfo));
+                else if (!it->second.IsLoaded) // Another thread may have loaded the file
+                    it->second = std::move(NewInfo);
+            }
+        }
+
+        return NumFilesRead;
+    }
+
+    RefCntAutoPtr<IDataBlob> GetFileData(const char* Name)
+    {
+        {
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+            auto it = m_Files.find(Name);
+            if (it != m_Files.end() && it->second.IsLoaded)
+                return it->second.pData;
+        }
+
+        FileInfo NewInfo = LoadFile(Name);
+
+        std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+        auto it = m_Files.find(Name);
+        if (it == m_Files.end())
+            it = m_Files.emplace(HashMapStringKey{Name, true}, std::move(NewInfo)).first;
+        else if (!it->second.IsLoaded)
+            it->second = std::move(NewInfo);
+
+        return it->second.pData;
+    }
+
+private:
+    std::vector<String> m_SearchDirectories;
+
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+
+    std::mutex                                     m_FilesMtx;
+    std::unordered_map<HashMapStringKey, FileInfo> m_Files;
+};
+
+void CreateResolvingShaderSourceFactory(const ResolvingShaderSourceFactoryCreateInfo& CreateInfo,
+                                        IResolvingShaderSourceFactory**               ppFactory)
+{
+    DEV_CHECK_ERR(ppFactory != nullptr, "ppFactory must not be null.");
+    DEV_CHECK_ERR(*ppFactory == nullptr, "*ppFactory is not null. Make sure the pointer is null to avoid memory leaks.");
+
+    try
+    {
+        RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory{MakeNewRCObj<ResolvingShaderSourceFactoryImpl>()(CreateInfo)};
+        if (pFactory)
+            pFactory->QueryInterface(IID_ResolvingShaderSourceFactory, reinterpret_cast<IObject**>(ppFactory));
+    }
+    catch (...)
+    {
+        LOG_ERROR("Failed to create the resolving shader source factory");
+    }
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    void Diligent_CreateResolvingShaderSourceFactory(const Diligent::ResolvingShaderSourceFactoryCreateInfo& CreateInfo,
+                                                     Diligent::IResolvingShaderSourceFactory**               ppFactory)
+    {
+        Diligent::CreateResolvingShaderSourceFactory(CreateInfo, ppFactory);
+    }
+}
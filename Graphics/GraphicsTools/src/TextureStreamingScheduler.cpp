@@ -0,0 +1,508 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureStreamingScheduler.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+
+#include "TextureUploaderBase.hpp"
+#include "ThreadPool.hpp"
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+class TextureStreamingSchedulerImpl final : public ObjectBase<ITextureStreamingScheduler>
+{
+public:
+    using TBase = ObjectBase<ITextureStreamingScheduler>;
+
+    TextureStreamingSchedulerImpl(IReferenceCounters* pRefCounters, const TextureStreamingSchedulerCreateInfo& CI) :
+        // clang-format off
+        TBase                {pRefCounters},
+        m_pUploader          {CI.pUploader},
+        m_pThreadPool        {CI.pThreadPool},
+        m_MaxRequestsInFlight{std::max(CI.MaxRequestsInFlight, 1u)},
+        m_MaxBytesPerUpdate  {CI.MaxBytesPerUpdate},
+        m_MaxTimePerUpdate   {CI.MaxTimePerUpdate}
+    // clang-format on
+    {
+        if (!m_pUploader)
+            LOG_ERROR_AND_THROW("Texture uploader must not be null");
+    }
+
+    ~TextureStreamingSchedulerImpl()
+    {
+        std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            for (auto& it : m_Requests)
+            {
+                auto& Req     = *it.second;
+                Req.Cancelled = true;
+                if (Req.pTask)
+                    Tasks.emplace_back(Req.pTask);
+            }
+        }
+
+        // Tasks that have started must finish before the scheduler is destroyed
+        for (auto& pTask : Tasks)
+        {
+            if (!m_pThreadPool->RemoveTask(pTask))
+                pTask->WaitForCompletion();
+        }
+
+        // Buffers of the remaining requests are still mapped and must be returned to the uploader
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        for (auto& it : m_Requests)
+            ReleaseRequestBuffer(*it.second);
+    }
+
+    virtual TextureStreamingRequestId EnqueueRequest(const TextureStreamingRequestDesc& Desc) override final
+    {
+        if (Desc.pDstTexture == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Destination texture must not be null");
+            return InvalidTextureStreamingRequestId;
+        }
+        if (!Desc.LoadData)
+        {
+            LOG_ERROR_MESSAGE("LoadData callback must not be empty");
+            return InvalidTextureStreamingRequestId;
+        }
+
+        const auto& TexDesc = Desc.pDstTexture->GetDesc();
+        if (Desc.FirstMip >= TexDesc.MipLevels)
+        {
+            LOG_ERROR_MESSAGE("First mip level (", Desc.FirstMip, ") is out of range for texture '", TexDesc.Name, "' with ", TexDesc.MipLevels, " mip levels");
+            return InvalidTextureStreamingRequestId;
+        }
+        if (Desc.ArraySlice >= TexDesc.GetArraySize())
+        {
+            LOG_ERROR_MESSAGE("Array slice (", Desc.ArraySlice, ") is out of range for texture '", TexDesc.Name, "' with ", TexDesc.GetArraySize(), " slices");
+            return InvalidTextureStreamingRequestId;
+        }
+
+        auto pReq = std::make_shared<RequestInfo>(Desc);
+
+        const auto NumMips = Desc.NumMips != 0 ? std::min(Desc.NumMips, TexDesc.MipLevels - Desc.FirstMip) : TexDesc.MipLevels - Desc.FirstMip;
+
+        const auto FirstMipProps = GetMipLevelProperties(TexDesc, Desc.FirstMip);
+
+        auto& BuffDesc     = pReq->BufferDesc;
+        BuffDesc.Width     = FirstMipProps.LogicalWidth;
+        BuffDesc.Height    = FirstMipProps.LogicalHeight;
+        BuffDesc.Depth     = FirstMipProps.Depth;
+        BuffDesc.MipLevels = NumMips;
+        BuffDesc.ArraySize = 1;
+        BuffDesc.Format    = TexDesc.Format;
+
+        for (Uint32 Mip = Desc.FirstMip; Mip < Desc.FirstMip + NumMips; ++Mip)
+            pReq->DataSize += GetMipLevelProperties(TexDesc, Mip).MipSize;
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        pReq->Id = m_NextRequestId++;
+        m_Requests.emplace(pReq->Id, pReq);
+        m_PendingQueue.emplace(pReq->Priority, pReq->Id);
+
+        return pReq->Id;
+    }
+
+    virtual bool SetRequestPriority(TextureStreamingRequestId Id, float Priority) override final
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Requests.find(Id);
+        if (it == m_Requests.end() || it->second->Cancelled)
+            return false;
+
+        auto& Req = *it->second;
+        switch (Req.State)
+        {
+            case REQUEST_STATE_PENDING:
+                m_PendingQueue.erase({Req.Priority, Req.Id});
+                m_PendingQueue.emplace(Priority, Req.Id);
+                break;
+
+            case REQUEST_STATE_LOADING:
+                if (Req.pTask)
+                {
+                    Req.pTask->SetPriority(Priority);
+                    m_pThreadPool->ReprioritizeTask(Req.pTask);
+                }
+                break;
+
+            case REQUEST_STATE_READY:
+                m_ReadyQueue.erase({Req.Priority, Req.Id});
+                m_ReadyQueue.emplace(Priority, Req.Id);
+                break;
+
+            default:
+                UNEXPECTED("Unexpected request state");
+        }
+        Req.Priority = Priority;
+
+        return true;
+    }
+
+    virtual bool CancelRequest(TextureStreamingRequestId Id) override final
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Requests.find(Id);
+        if (it == m_Requests.end() || it->second->Cancelled)
+            return false;
+
+        auto& Req     = *it->second;
+        Req.Cancelled = true;
+        ++m_Stats.NumCancelledRequests;
+        switch (Req.State)
+        {
+            case REQUEST_STATE_PENDING:
+                m_PendingQueue.erase({Req.Priority, Req.Id});
+                m_Requests.erase(it);
+                break;
+
+            case REQUEST_STATE_LOADING:
+                // If the task has not started yet, remove it from the queue and reclaim the buffer now.
+                // Otherwise, the request will be released when the task finishes.
+                // Note that the buffer may not be allocated yet if Update() is running.
+                if (Req.pTask && m_pThreadPool->RemoveTask(Req.pTask))
+                {
+                    --m_NumLoadingRequests;
+                    ReleaseRequestBuffer(Req);
+                    m_Requests.erase(it);
+                }
+                break;
+
+            case REQUEST_STATE_READY:
+                m_ReadyQueue.erase({Req.Priority, Req.Id});
+                ReleaseRequestBuffer(Req);
+                m_Requests.erase(it);
+                break;
+
+            default:
+                UNEXPECTED("Unexpected request state");
+        }
+
+        return true;
+    }
+
+    virtual void Update(IDeviceContext* pContext) override final
+    {
+        Timer UpdateTimer;
+
+        m_pUploader->RenderThreadUpdate(pContext);
+
+        ScheduleCopies(pContext, UpdateTimer);
+        StartLoading(pContext, UpdateTimer);
+    }
+
+    virtual TextureStreamingSchedulerStats GetStats() override final
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto Stats               = m_Stats;
+        Stats.NumPendingRequests = static_cast<Uint32>(m_PendingQueue.size());
+        Stats.NumLoadingRequests = m_NumLoadingRequests;
+        Stats.NumReadyRequests   = static_cast<Uint32>(m_ReadyQueue.size());
+        return Stats;
+    }
+
+private:
+    enum REQUEST_STATE : Uint8
+    {
+        REQUEST_STATE_PENDING,
+        REQUEST_STATE_LOADING,
+        REQUEST_STATE_READY
+    };
+
+    struct RequestInfo
+    {
+        explicit RequestInfo(const TextureStreamingRequestDesc& _Desc) :
+            Desc{_Desc},
+            pDstTexture{_Desc.pDstTexture},
+            Priority{_Desc.Priority}
+        {}
+
+        const TextureStreamingRequestDesc Desc;
+        const RefCntAutoPtr<ITexture>     pDstTexture;
+
+        TextureStreamingRequestId Id = InvalidTextureStreamingRequestId;
+
+        UploadBufferDesc BufferDesc;
+        Uint64           DataSize = 0;
+
+        // All members below are protected by m_Mtx
+        float         Priority  = 0;
+        REQUEST_STATE State     = REQUEST_STATE_PENDING;
+        bool          Cancelled = false;
+        bool          Loaded    = false;
+
+        RefCntAutoPtr<IUploadBuffer> pBuffer;
+        RefCntAutoPtr<IAsyncTask>    pTask;
+    };
+    using RequestPtr = std::shared_ptr<RequestInfo>;
+
+    // Orders requests by decreasing priority and then by increasing id
+    struct QueueKeyCompare
+    {
+        bool operator()(const std::pair<float, TextureStreamingRequestId>& lhs,
+                        const std::pair<float, TextureStreamingRequestId>& rhs) const
+        {
+            return lhs.first != rhs.first ?
+                lhs.first > rhs.first :
+                lhs.second < rhs.second;
+        }
+    };
+    using RequestQueue = std::set<std::pair<float, TextureStreamingRequestId>, QueueKeyCompare>;
+
+    // Must be called while m_Mtx is locked.
+    // Returns the upload buffer of a request that will never be copied to the uploader.
+    // The buffer is unmapped and recycled by the next RenderThreadUpdate() call.
+    void ReleaseRequestBuffer(RequestInfo& Req)
+    {
+        if (Req.pBuffer)
+        {
+            m_pUploader->DiscardBuffer(nullptr, Req.pBuffer);
+            Req.pBuffer.Release();
+        }
+    }
+
+    // Must be called while m_Mtx is locked.
+    void OnLoadingFinished(const RequestPtr& pReq, bool Loaded)
+    {
+        VERIFY_EXPR(pReq->State == REQUEST_STATE_LOADING);
+        VERIFY_EXPR(m_NumLoadingRequests > 0);
+        --m_NumLoadingRequests;
+        pReq->pTask.Release();
+
+        if (pReq->Cancelled)
+        {
+            ReleaseRequestBuffer(*pReq);
+            m_Requests.erase(pReq->Id);
+        }
+        else
+        {
+            pReq->Loaded = Loaded;
+            pReq->State  = REQUEST_STATE_READY;
+            m_ReadyQueue.emplace(pReq->Priority, pReq->Id);
+        }
+    }
+
+    bool IsBudgetExhausted(const Timer& UpdateTimer, Uint64 UpdateBytes, Uint64 NextCopySize) const
+    {
+        if (m_MaxBytesPerUpdate != 0 && UpdateBytes + NextCopySize > m_MaxBytesPerUpdate)
+            return true;
+        if (m_MaxTimePerUpdate != 0 && UpdateTimer.GetElapsedTime() >= m_MaxTimePerUpdate)
+            return true;
+        return false;
+    }
+
+    void ScheduleCopies(IDeviceContext* pContext, const Timer& UpdateTimer)
+    {
+        Uint32 NumCopies   = 0;
+        Uint64 UpdateBytes = 0;
+        while (true)
+        {
+            RequestPtr pReq;
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                if (m_ReadyQueue.empty())
+                    break;
+
+                auto it = m_Requests.find(m_ReadyQueue.begin()->second);
+                VERIFY_EXPR(it != m_Requests.end());
+                pReq = it->second;
+                // Failed requests do not count against the budget
+                if (pReq->Loaded && NumCopies > 0 && IsBudgetExhausted(UpdateTimer, UpdateBytes, pReq->DataSize))
+                    break;
+
+                m_ReadyQueue.erase(m_ReadyQueue.begin());
+                m_Requests.erase(it);
+                if (!pReq->Loaded)
+                {
+                    ReleaseRequestBuffer(*pReq);
+                    ++m_Stats.NumFailedRequests;
+                }
+            }
+
+            if (pReq->Loaded)
+            {
+                m_pUploader->ScheduleGPUCopy(pContext, pReq->pDstTexture, pReq->Desc.ArraySlice, pReq->Desc.FirstMip, pReq->pBuffer);
+                m_pUploader->RecycleBuffer(pReq->pBuffer);
+                pReq->pBuffer.Release();
+
+                ++NumCopies;
+                UpdateBytes += pReq->DataSize;
+            }
+
+            if (pReq->Desc.OnComplete)
+                pReq->Desc.OnComplete(pReq->Loaded);
+        }
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Stats.NumCompletedRequests += NumCopies;
+        m_Stats.BytesUploaded += UpdateBytes;
+        m_Stats.LastUpdateNumCopies = NumCopies;
+        m_Stats.LastUpdateBytes     = UpdateBytes;
+    }
+
+    void StartLoading(IDeviceContext* pContext, const Timer& UpdateTimer)
+    {
+        bool LoadedInline = false;
+        while (true)
+        {
+            RequestPtr pReq;
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                if (m_PendingQueue.empty() || m_NumLoadingRequests + m_ReadyQueue.size() >= m_MaxRequestsInFlight)
+                    break;
+
+                // When the data is loaded by this thread, at least one request is processed every update
+                if (!m_pThreadPool && LoadedInline && IsBudgetExhausted(UpdateTimer, 0, 0))
+                    break;
+
+                auto it = m_Requests.find(m_PendingQueue.begin()->second);
+                VERIFY_EXPR(it != m_Requests.end());
+                pReq = it->second;
+                m_PendingQueue.erase(m_PendingQueue.begin());
+                pReq->State = REQUEST_STATE_LOADING;
+                ++m_NumLoadingRequests;
+            }
+
+            // The request may be cancelled while the buffer is being allocated,
+            // so the buffer is written to the request only after the mutex is acquired.
+            RefCntAutoPtr<IUploadBuffer> pBuffer;
+            m_pUploader->AllocateUploadBuffer(pContext, pReq->BufferDesc, &pBuffer);
+            if (!pBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to allocate upload buffer for texture '", pReq->pDstTexture->GetDesc().Name, "'");
+            }
+
+            if (m_pThreadPool)
+            {
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                if (pBuffer)
+                    pReq->pBuffer = std::move(pBuffer);
+
+                if (pReq->Cancelled || !pReq->pBuffer)
+                {
+                    OnLoadingFinished(pReq, false);
+                    continue;
+                }
+
+                pReq->pTask = EnqueueAsyncWork(
+                    m_pThreadPool,
+                    [this, pReq](Uint32 /*ThreadId*/) {
+                        bool Loaded = false;
+
+                        bool Cancelled = false;
+                        {
+                            std::lock_guard<std::mutex> Lock{m_Mtx};
+                            Cancelled = pReq->Cancelled;
+                        }
+                        if (!Cancelled)
+                            Loaded = pReq->Desc.LoadData(pReq->pBuffer);
+
+                        std::lock_guard<std::mutex> Lock{m_Mtx};
+                        OnLoadingFinished(pReq, Loaded);
+                        return ASYNC_TASK_STATUS_COMPLETE;
+                    },
+                    pReq->Priority);
+            }
+            else
+            {
+                bool Cancelled = false;
+                {
+                    std::lock_guard<std::mutex> Lock{m_Mtx};
+                    if (pBuffer)
+                        pReq->pBuffer = std::move(pBuffer);
+                    Cancelled = pReq->Cancelled;
+                }
+
+                const bool Loaded = !Cancelled && pReq->pBuffer && pReq->Desc.LoadData(pReq->pBuffer);
+                LoadedInline      = true;
+
+                std::lock_guard<std::mutex> Lock{m_Mtx};
+                OnLoadingFinished(pReq, Loaded);
+            }
+        }
+    }
+
+private:
+    RefCntAutoPtr<ITextureUploader> m_pUploader;
+    RefCntAutoPtr<IThreadPool>      m_pThreadPool;
+
+    const Uint32 m_MaxRequestsInFlight;
+    const Uint64 m_MaxBytesPerUpdate;
+    const double m_MaxTimePerUpdate;
+
+    std::mutex m_Mtx;
+
+    TextureStreamingRequestId                                 m_NextRequestId = 1;
+    std::unordered_map<TextureStreamingRequestId, RequestPtr> m_Requests;
+
+    RequestQueue m_PendingQueue;
+    RequestQueue m_ReadyQueue;
+    Uint32       m_NumLoadingRequests = 0;
+
+    TextureStreamingSchedulerStats m_Stats;
+};
+
+} // namespace
+
+void CreateTextureStreamingScheduler(const TextureStreamingSchedulerCreateInfo& CreateInfo, ITextureStreamingScheduler** ppScheduler)
+{
+    DEV_CHECK_ERR(ppScheduler != nullptr, "ppScheduler must not be null");
+    if (ppScheduler == nullptr)
+        return;
+
+    *ppScheduler = nullptr;
+    try
+    {
+        *ppScheduler = MakeNewRCObj<TextureStreamingSchedulerImpl>()(CreateInfo);
+        (*ppScheduler)->AddRef();
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create texture streaming scheduler");
+    }
+}
+
+} // namespace Diligent
@@ -118,7 +118,8 @@ struct TextureUploaderD3D11::InternalData
         enum Operation
         {
             Map,
-            Copy
+            Copy,
+            Discard
         } operation;
         RefCntAutoPtr<UploadBufferD3D11> pUploadBuffer;
         CComPtr<ID3D11Resource>          pd3d11NativeDstTexture;
@@ -168,6 +169,21 @@ struct TextureUploaderD3D11::InternalData
         m_PendingOperations.emplace_back(Op, pUploadBuffer);
     }
 
+    void EnqueueDiscard(UploadBufferD3D11* pUploadBuffer)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Discard, pUploadBuffer);
+    }
+
+    void RecycleBuffer(UploadBufferD3D11* pUploadBuffer)
+    {
+        VERIFY(pUploadBuffer->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+        pUploadBuffer->Reset();
+
+        std::lock_guard<std::mutex> CacheLock(m_UploadBuffCacheMtx);
+        m_UploadBufferCache[pUploadBuffer->GetDesc()].emplace_back(pUploadBuffer);
+    }
+
     void Execute(ID3D11DeviceContext* pd3d11NativeCtx, PendingBufferOperation& OperationInfo, bool ExecuteImmediately);
 
     void ExecuteImmediately(IDeviceContext* pContext, PendingBufferOperation& OperationInfo)
@@ -328,6 +344,19 @@ void TextureUploaderD3D11::InternalData::Execute(ID3D11DeviceContext*    pd3d11N
             pBuffer->SignalCopyScheduled();
         }
         break;
+
+        case InternalData::PendingBufferOperation::Discard:
+        {
+            VERIFY(pBuffer->DbgIsMapped(), "Upload buffer must be discarded only after it has been mapped");
+            for (Uint32 Subres = 0; Subres < UploadBuffDesc.MipLevels * UploadBuffDesc.ArraySize; ++Subres)
+            {
+                pd3d11NativeCtx->Unmap(pBuffer->GetStagingTex(), Subres);
+            }
+            // The buffer has never been used by the GPU and can be reused right away
+            pBuffer->SignalCopyScheduled();
+            RecycleBuffer(pBuffer);
+        }
+        break;
     }
 }
 
@@ -444,12 +473,23 @@ void TextureUploaderD3D11::ScheduleGPUCopy(IDeviceContext* pContext,
 
 void TextureUploaderD3D11::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
-    auto* pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(pUploadBuffer);
-    VERIFY(pUploadBufferD3D11->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
-    pUploadBufferD3D11->Reset();
+    m_pInternalData->RecycleBuffer(ClassPtrCast<UploadBufferD3D11>(pUploadBuffer));
+}
 
-    std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
-    m_pInternalData->m_UploadBufferCache[pUploadBufferD3D11->GetDesc()].emplace_back(pUploadBufferD3D11);
+void TextureUploaderD3D11::DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer)
+{
+    auto* pUploadBufferD3D11 = ClassPtrCast<UploadBufferD3D11>(pUploadBuffer);
+    if (pContext != nullptr)
+    {
+        // Main thread
+        InternalData::PendingBufferOperation DiscardOp{InternalData::PendingBufferOperation::Discard, pUploadBufferD3D11};
+        m_pInternalData->ExecuteImmediately(pContext, DiscardOp);
+    }
+    else
+    {
+        // Worker thread
+        m_pInternalData->EnqueueDiscard(pUploadBufferD3D11);
+    }
 }
 
 TextureUploaderStats TextureUploaderD3D11::GetStats()
@@ -26,13 +26,20 @@
  */
 
 #include <mutex>
+#include <condition_variable>
 #include <unordered_map>
 #include <deque>
 #include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
 
 #include "TextureUploaderD3D12_Vk.hpp"
 #include "ThreadSignal.hpp"
 #include "GraphicsAccessories.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -40,15 +47,86 @@ namespace Diligent
 namespace
 {
 
-class UploadTexture : public UploadBufferBase
+class UploadBufferD3D12_Vk : public UploadBufferBase
+{
+public:
+    UploadBufferD3D12_Vk(IReferenceCounters* pRefCounters, const UploadBufferDesc& Desc) :
+        UploadBufferBase{pRefCounters, Desc}
+    {
+    }
+
+    // Maps all subresources of the upload buffer. Must be called by the render thread.
+    virtual void Map(IDeviceContext* pDeviceContext) = 0;
+
+    // Records copy commands from the upload buffer to the destination texture.
+    // Must be called by the render thread.
+    virtual void Copy(IDeviceContext* pDeviceContext, ITexture* pDstTexture, Uint32 DstSlice, Uint32 DstMip) = 0;
+
+    // Unmaps all subresources of the upload buffer without copying the data.
+    // Must be called by the render thread.
+    virtual void Discard(IDeviceContext* pDeviceContext) = 0;
+
+    void WaitForMap()
+    {
+        m_BufferMappedSignal.Wait();
+    }
+
+    void SignalMapped()
+    {
+        m_BufferMappedSignal.Trigger();
+    }
+
+    void SignalCopyScheduled(Uint64 FenceValue)
+    {
+        m_CopyScheduledFenceValue = FenceValue;
+        m_CopyScheduledSignal.Trigger();
+    }
+
+    void Reset()
+    {
+        m_CopyScheduledSignal.Reset();
+        m_BufferMappedSignal.Reset();
+        m_CopyScheduledFenceValue = 0;
+        UploadBufferBase::Reset();
+    }
+
+    virtual void WaitForCopyScheduled() override final
+    {
+        m_CopyScheduledSignal.Wait();
+    }
+
+    bool DbgIsCopyScheduled() const
+    {
+        return m_CopyScheduledSignal.IsTriggered();
+    }
+
+    bool DbgIsMapped()
+    {
+        return m_BufferMappedSignal.IsTriggered();
+    }
+
+    Uint64 GetCopyScheduledFenceValue() const
+    {
+        VERIFY(m_CopyScheduledFenceValue != 0, "Fence value has not been initialized");
+        return m_CopyScheduledFenceValue;
+    }
+
+protected:
+    Threading::Signal m_CopyScheduledSignal;
+    Threading::Signal m_BufferMappedSignal;
+
+    Uint64 m_CopyScheduledFenceValue = 0;
+};
+
+class UploadTexture final : public UploadBufferD3D12_Vk
 {
 public:
     UploadTexture(IReferenceCounters*     pRefCounters,
                   const UploadBufferDesc& Desc,
                   ITexture*               pStagingTexture) :
         // clang-format off
-        UploadBufferBase {pRefCounters, Desc},
-        m_pStagingTexture{pStagingTexture}
+        UploadBufferD3D12_Vk{pRefCounters, Desc},
+        m_pStagingTexture   {pStagingTexture}
     // clang-format on
     {
     }
@@ -64,74 +142,488 @@ public:
         }
     }
 
-    void WaitForMap()
+    virtual void Map(IDeviceContext* pDeviceContext) override final
     {
-        m_TextureMappedSignal.Wait();
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                VERIFY(!IsMapped(Mip, Slice), "This subresource is already mapped");
+                MappedTextureSubresource MappedData;
+                pDeviceContext->MapTextureSubresource(m_pStagingTexture, Mip, Slice, MAP_WRITE, MAP_FLAG_NO_OVERWRITE, nullptr, MappedData);
+                SetMappedData(Mip, Slice, MappedData);
+            }
+        }
     }
 
-    void SignalMapped()
+    virtual void Copy(IDeviceContext* pDeviceContext, ITexture* pDstTexture, Uint32 DstSlice, Uint32 DstMip) override final
     {
-        m_TextureMappedSignal.Trigger();
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                VERIFY(IsMapped(Mip, Slice), "This subresource is not mapped");
+                pDeviceContext->UnmapTextureSubresource(m_pStagingTexture, Mip, Slice);
+                SetMappedData(Mip, Slice, MappedTextureSubresource{});
+
+                CopyTextureAttribs CopyInfo //
+                    {
+                        m_pStagingTexture,
+                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                        pDstTexture,
+                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
+                    };
+                CopyInfo.SrcMipLevel = Mip;
+                CopyInfo.SrcSlice    = Slice;
+                CopyInfo.DstMipLevel = DstMip + Mip;
+                CopyInfo.DstSlice    = DstSlice + Slice;
+                pDeviceContext->CopyTexture(CopyInfo);
+            }
+        }
     }
 
-    void SignalCopyScheduled(Uint64 FenceValue)
+    virtual void Discard(IDeviceContext* pDeviceContext) override final
     {
-        m_CopyScheduledFenceValue = FenceValue;
-        m_CopyScheduledSignal.Trigger();
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                VERIFY(IsMapped(Mip, Slice), "This subresource is not mapped");
+                pDeviceContext->UnmapTextureSubresource(m_pStagingTexture, Mip, Slice);
+                SetMappedData(Mip, Slice, MappedTextureSubresource{});
+            }
+        }
     }
 
-    void Unmap(IDeviceContext* pDeviceContext, Uint32 Mip, Uint32 Slice)
+private:
+    RefCntAutoPtr<ITexture> m_pStagingTexture;
+};
+
+
+// Staging memory pool suballocates upload buffers from a few large staging buffers.
+class StagingMemoryPool final : public ObjectBase<IObject>
+{
+public:
+    using TBase = ObjectBase<IObject>;
+
+    struct Page
+    {
+        Page(RefCntAutoPtr<IBuffer>&& _pBuffer, bool _IsDedicated) :
+            // clang-format off
+            pBuffer    {std::move(_pBuffer)},
+            Mgr        {VariableSizeAllocationsManager::CreateInfo{DefaultRawMemoryAllocator::GetAllocator(), StaticCast<size_t>(pBuffer->GetDesc().Size)}},
+            IsDedicated{_IsDedicated}
+        // clang-format on
+        {
+        }
+
+        RefCntAutoPtr<IBuffer>         pBuffer;
+        VariableSizeAllocationsManager Mgr;
+
+        // Dedicated pages are created for allocations that do not fit into
+        // a regular page and are released as soon as they become empty.
+        const bool IsDedicated;
+
+        // The number of regions allocated from this page, including stale regions
+        Uint32 NumRegions = 0;
+
+        // CPU address of the mapped buffer. The page is mapped while it has allocated
+        // regions. Only accessed by the render thread.
+        Uint8* pCPUAddress = nullptr;
+    };
+
+    struct Region
+    {
+        Page*                                      pPage = nullptr;
+        VariableSizeAllocationsManager::Allocation Allocation;
+
+        // Aligned offset from the beginning of the page
+        Uint64 Offset = 0;
+        Uint64 Size   = 0;
+
+        explicit operator bool() const { return pPage != nullptr; }
+    };
+
+    StagingMemoryPool(IReferenceCounters* pRefCounters,
+                      IRenderDevice*      pDevice,
+                      Uint64              PageSize,
+                      Uint64              Budget) :
+        // clang-format off
+        TBase     {pRefCounters},
+        m_pDevice {pDevice},
+        m_PageSize{PageSize},
+        m_Budget  {Budget}
+    // clang-format on
     {
-        VERIFY(IsMapped(Mip, Slice), "This subresource is not mapped");
-        pDeviceContext->UnmapTextureSubresource(m_pStagingTexture, Mip, Slice);
-        SetMappedData(Mip, Slice, MappedTextureSubresource{});
+        VERIFY_EXPR(m_PageSize != 0);
     }
 
-    void Map(IDeviceContext* pDeviceContext, Uint32 Mip, Uint32 Slice)
+    // Returns true if the region of the given size can be allocated without exceeding the memory budget
+    // once all memory in flight is released.
+    bool FitsInBudget(Uint64 Size, Uint64 Alignment) const
     {
-        VERIFY(!IsMapped(Mip, Slice), "This subresource is already mapped");
-        MappedTextureSubresource MappedData;
-        pDeviceContext->MapTextureSubresource(m_pStagingTexture, Mip, Slice, MAP_WRITE, MAP_FLAG_NO_OVERWRITE, nullptr, MappedData);
-        SetMappedData(Mip, Slice, MappedData);
+        return m_Budget == 0 || AlignUp(Size, Alignment) <= m_Budget;
     }
 
-    void Reset()
+    Uint64 GetBudget() const { return m_Budget; }
+
+    // Allocates a region from the pool. When the memory budget is exhausted, either blocks until the memory
+    // is released by ReleaseStaleRegions() (Wait == true), or returns an empty region (Wait == false).
+    // The method only blocks while there are stale regions, i.e. recycled regions whose GPU copies are fenced.
+    // The memory of other regions is held by upload buffers that may belong to the calling thread and will
+    // never be released while it waits, so an empty region is returned when there are no stale regions.
+    Region Allocate(Uint64 Size, Uint64 Alignment, bool Wait, bool IgnoreBudget = false)
     {
-        m_CopyScheduledSignal.Reset();
-        m_TextureMappedSignal.Reset();
-        m_CopyScheduledFenceValue = 0;
-        UploadBufferBase::Reset();
+        VERIFY_EXPR(Size > 0 && IsPowerOfTwo(Alignment));
+        VERIFY(!Wait || IgnoreBudget || FitsInBudget(Size, Alignment), "Waiting for the region that exceeds the budget may never end");
+
+        std::unique_lock<std::mutex> Lock{m_Mtx};
+
+        Region NewRegion;
+        while (!TryAllocate(Size, Alignment, IgnoreBudget, NewRegion))
+        {
+            if (!Wait || m_StaleRegions.empty())
+                break;
+
+            m_MemoryReleasedCV.wait(Lock);
+        }
+        return NewRegion;
     }
 
-    virtual void WaitForCopyScheduled() override final
+    // Returns the region to the pool. The memory will be reused after the fence reaches the FenceValue.
+    // Zero fence value indicates that the region has never been used by the GPU and can be reused immediately.
+    void Free(Region&& OldRegion, Uint64 FenceValue)
     {
-        m_CopyScheduledSignal.Wait();
+        VERIFY_EXPR(OldRegion);
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            if (FenceValue != 0)
+            {
+                m_StaleRegions.emplace_back(std::move(OldRegion), FenceValue);
+                OldRegion = {};
+                return;
+            }
+            FreeRegion(OldRegion);
+        }
+        m_MemoryReleasedCV.notify_all();
     }
 
-    ITexture* GetStagingTexture() { return m_pStagingTexture; }
+    // Frees all regions whose GPU copies have completed. Must be called by the render thread.
+    void ReleaseStaleRegions(IDeviceContext* pContext, Uint64 CompletedFenceValue)
+    {
+        bool MemoryReleased = false;
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
 
-    bool DbgIsCopyScheduled() const
+            auto FirstRetainedIt = std::partition(m_StaleRegions.begin(), m_StaleRegions.end(),
+                                                  [CompletedFenceValue](const StaleRegion& Stale) {
+                                                      return Stale.FenceValue <= CompletedFenceValue;
+                                                  });
+            for (auto it = m_StaleRegions.begin(); it != FirstRetainedIt; ++it)
+                FreeRegion(it->Reg);
+            MemoryReleased = FirstRetainedIt != m_StaleRegions.begin();
+            m_StaleRegions.erase(m_StaleRegions.begin(), FirstRetainedIt);
+
+            // Unmap pages that are not used anymore and release empty dedicated pages
+            for (auto it = m_Pages.begin(); it != m_Pages.end();)
+            {
+                auto& pPage = *it;
+                if (pPage->NumRegions == 0)
+                {
+                    if (pPage->pCPUAddress != nullptr)
+                    {
+                        pContext->UnmapBuffer(pPage->pBuffer, MAP_WRITE);
+                        pPage->pCPUAddress = nullptr;
+                    }
+
+                    if (pPage->IsDedicated)
+                    {
+                        m_CommittedSize -= pPage->pBuffer->GetDesc().Size;
+                        it = m_Pages.erase(it);
+                        continue;
+                    }
+                }
+                ++it;
+            }
+        }
+
+        if (MemoryReleased)
+            m_MemoryReleasedCV.notify_all();
+    }
+
+    // Returns the largest fence value stale regions are waiting for, or zero if there are no stale regions.
+    Uint64 GetLastStaleFenceValue()
     {
-        return m_CopyScheduledSignal.IsTriggered();
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        Uint64 FenceValue = 0;
+        for (const auto& Stale : m_StaleRegions)
+            FenceValue = std::max(FenceValue, Stale.FenceValue);
+        return FenceValue;
     }
 
-    bool DbgIsMapped()
+    // Maps the page if it is not mapped yet. Must be called by the render thread.
+    void MapPage(IDeviceContext* pContext, Page& MemPage)
     {
-        return m_TextureMappedSignal.IsTriggered();
+        if (MemPage.pCPUAddress == nullptr)
+        {
+            PVoid pData = nullptr;
+            pContext->MapBuffer(MemPage.pBuffer, MAP_WRITE, MAP_FLAG_NONE, pData);
+            MemPage.pCPUAddress = static_cast<Uint8*>(pData);
+        }
     }
 
-    Uint64 GetCopyScheduledFenceValue() const
+    void GetStats(TextureUploaderStats& Stats)
     {
-        VERIFY(m_CopyScheduledFenceValue != 0, "Fence value has not been initialized");
-        return m_CopyScheduledFenceValue;
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        Stats.BytesInFlight         = m_BytesInFlight;
+        Stats.StagingMemorySize     = m_CommittedSize;
+        Stats.PeakStagingMemorySize = m_PeakCommittedSize;
     }
 
 private:
-    Threading::Signal m_CopyScheduledSignal;
-    Threading::Signal m_TextureMappedSignal;
+    bool TryAllocate(Uint64 Size, Uint64 Alignment, bool IgnoreBudget, Region& NewRegion)
+    {
+        for (auto& pPage : m_Pages)
+        {
+            if (AllocateFromPage(*pPage, Size, Alignment, NewRegion))
+                return true;
+        }
 
-    RefCntAutoPtr<ITexture> m_pStagingTexture;
-    Uint64                  m_CopyScheduledFenceValue = 0;
+        const auto AlignedSize = AlignUp(Size, Alignment);
+        const auto IsDedicated = AlignedSize > m_PageSize;
+        const auto NewPageSize = std::max(m_PageSize, AlignedSize);
+        // When there is no memory in flight, waiting will not help, so always allocate a new page
+        if (!IgnoreBudget && m_Budget != 0 && m_CommittedSize + NewPageSize > m_Budget && m_BytesInFlight != 0)
+            return false;
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Texture uploader staging memory page";
+        BuffDesc.Size           = NewPageSize;
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        if (!pBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create ", NewPageSize, "-byte staging memory page");
+            return false;
+        }
+
+        LOG_INFO_MESSAGE("TextureUploaderD3D12_Vk: created ", NewPageSize, "-byte ", (IsDedicated ? "dedicated " : ""), "staging memory page");
+
+        m_Pages.emplace_back(new Page{std::move(pBuffer), IsDedicated});
+        m_CommittedSize += NewPageSize;
+        m_PeakCommittedSize = std::max(m_PeakCommittedSize, m_CommittedSize);
+
+        const auto Allocated = AllocateFromPage(*m_Pages.back(), Size, Alignment, NewRegion);
+        VERIFY(Allocated, "Allocation from the new page must always succeed");
+        return Allocated;
+    }
+
+    bool AllocateFromPage(Page& MemPage, Uint64 Size, Uint64 Alignment, Region& NewRegion)
+    {
+        auto Allocation = MemPage.Mgr.Allocate(StaticCast<size_t>(Size), StaticCast<size_t>(Alignment));
+        if (!Allocation.IsValid())
+            return false;
+
+        NewRegion.pPage      = &MemPage;
+        NewRegion.Offset     = AlignUp(Uint64{Allocation.UnalignedOffset}, Alignment);
+        NewRegion.Size       = Size;
+        NewRegion.Allocation = std::move(Allocation);
+
+        ++MemPage.NumRegions;
+        m_BytesInFlight += NewRegion.Allocation.Size;
+        return true;
+    }
+
+    void FreeRegion(Region& OldRegion)
+    {
+        auto& MemPage = *OldRegion.pPage;
+        VERIFY_EXPR(MemPage.NumRegions > 0 && m_BytesInFlight >= OldRegion.Allocation.Size);
+        m_BytesInFlight -= OldRegion.Allocation.Size;
+        MemPage.Mgr.Free(std::move(OldRegion.Allocation));
+        --MemPage.NumRegions;
+        OldRegion = {};
+    }
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint64 m_PageSize;
+    const Uint64 m_Budget;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_MemoryReleasedCV;
+
+    std::vector<std::unique_ptr<Page>> m_Pages;
+
+    struct StaleRegion
+    {
+        StaleRegion(Region&& _Reg, Uint64 _FenceValue) :
+            Reg{std::move(_Reg)},
+            FenceValue{_FenceValue}
+        {}
+
+        Region Reg;
+        Uint64 FenceValue = 0;
+    };
+    std::vector<StaleRegion> m_StaleRegions;
+
+    Uint64 m_CommittedSize     = 0;
+    Uint64 m_PeakCommittedSize = 0;
+    Uint64 m_BytesInFlight     = 0;
+};
+
+
+class PooledUploadBuffer final : public UploadBufferD3D12_Vk
+{
+public:
+    // D3D12 requires texture data rows to be aligned by 256 bytes and subresources to be placed
+    // at 512-byte boundaries. These values also satisfy Vulkan buffer-to-image copy requirements.
+    static constexpr Uint32 RowPitchAlignment  = 256;
+    static constexpr Uint32 PlacementAlignment = 512;
+
+    struct SubresourceLayout
+    {
+        Uint64 Offset      = 0;
+        Uint64 Stride      = 0;
+        Uint64 DepthStride = 0;
+        Box    Region;
+    };
+
+    // Computes the layout of all subresources and returns the total memory size
+    static Uint64 ComputeLayout(const UploadBufferDesc& Desc, std::vector<SubresourceLayout>& Layout)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Type      = Desc.Depth > 1 ? RESOURCE_DIM_TEX_3D : (Desc.ArraySize == 1 ? RESOURCE_DIM_TEX_2D : RESOURCE_DIM_TEX_2D_ARRAY);
+        TexDesc.Width     = Desc.Width;
+        TexDesc.Height    = Desc.Height;
+        TexDesc.Format    = Desc.Format;
+        TexDesc.MipLevels = Desc.MipLevels;
+        if (TexDesc.Type == RESOURCE_DIM_TEX_3D)
+            TexDesc.Depth = Desc.Depth;
+        else
+            TexDesc.ArraySize = Desc.ArraySize;
+
+        Layout.resize(size_t{Desc.ArraySize} * size_t{Desc.MipLevels});
+
+        Uint64 MemorySize = 0;
+        for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            {
+                const auto MipProps = GetMipLevelProperties(TexDesc, Mip);
+                const Box  MipRegion{0, MipProps.LogicalWidth, 0, MipProps.LogicalHeight, 0, MipProps.Depth};
+                const auto CopyInfo = GetBufferToTextureCopyInfo(Desc.Format, MipRegion, RowPitchAlignment);
+
+                auto& SubresLayout       = Layout[size_t{Desc.MipLevels} * size_t{Slice} + size_t{Mip}];
+                SubresLayout.Offset      = AlignUp(MemorySize, Uint64{PlacementAlignment});
+                SubresLayout.Stride      = CopyInfo.RowStride;
+                SubresLayout.DepthStride = CopyInfo.DepthStride;
+                SubresLayout.Region      = MipRegion;
+
+                MemorySize = SubresLayout.Offset + CopyInfo.MemorySize;
+            }
+        }
+        return MemorySize;
+    }
+
+    PooledUploadBuffer(IReferenceCounters*              pRefCounters,
+                       const UploadBufferDesc&          Desc,
+                       StagingMemoryPool*               pPool,
+                       StagingMemoryPool::Region&&      MemRegion,
+                       std::vector<SubresourceLayout>&& Layout) :
+        // clang-format off
+        UploadBufferD3D12_Vk{pRefCounters, Desc},
+        m_pPool             {pPool},
+        m_Region            {std::move(MemRegion)},
+        m_Layout            {std::move(Layout)}
+    // clang-format on
+    {
+        VERIFY_EXPR(m_pPool && m_Region);
+        VERIFY_EXPR(m_Layout.size() == size_t{m_Desc.ArraySize} * size_t{m_Desc.MipLevels});
+    }
+
+    ~PooledUploadBuffer()
+    {
+        ReleaseRegion();
+    }
+
+    virtual void Map(IDeviceContext* pDeviceContext) override final
+    {
+        VERIFY(m_Region, "The region has already been released");
+        auto& MemPage = *m_Region.pPage;
+        m_pPool->MapPage(pDeviceContext, MemPage);
+
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                const auto& SubresLayout = GetLayout(Mip, Slice);
+
+                MappedTextureSubresource MappedData;
+                MappedData.pData       = MemPage.pCPUAddress + m_Region.Offset + SubresLayout.Offset;
+                MappedData.Stride      = SubresLayout.Stride;
+                MappedData.DepthStride = SubresLayout.DepthStride;
+                SetMappedData(Mip, Slice, MappedData);
+            }
+        }
+    }
+
+    virtual void Copy(IDeviceContext* pDeviceContext, ITexture* pDstTexture, Uint32 DstSlice, Uint32 DstMip) override final
+    {
+        VERIFY(m_Region, "The region has already been released");
+        IBuffer* pStagingBuffer = m_Region.pPage->pBuffer;
+        if ((pStagingBuffer->GetMemoryProperties() & MEMORY_PROPERTY_HOST_COHERENT) == 0)
+            pStagingBuffer->FlushMappedRange(m_Region.Offset, m_Region.Size);
+
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                VERIFY(IsMapped(Mip, Slice), "This subresource is not mapped");
+                SetMappedData(Mip, Slice, MappedTextureSubresource{});
+
+                const auto&       SubresLayout = GetLayout(Mip, Slice);
+                TextureSubResData SubresData{pStagingBuffer, m_Region.Offset + SubresLayout.Offset, SubresLayout.Stride, SubresLayout.DepthStride};
+                pDeviceContext->UpdateTexture(pDstTexture, DstMip + Mip, DstSlice + Slice, SubresLayout.Region, SubresData,
+                                              RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+    }
+
+    virtual void Discard(IDeviceContext* pDeviceContext) override final
+    {
+        // The page remains mapped until all its regions are released
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+                SetMappedData(Mip, Slice, MappedTextureSubresource{});
+        }
+    }
+
+    // Returns the memory to the pool. The memory will be reused once the GPU copy completes.
+    void ReleaseRegion()
+    {
+        if (m_Region)
+            m_pPool->Free(std::move(m_Region), m_CopyScheduledFenceValue);
+    }
+
+private:
+    const SubresourceLayout& GetLayout(Uint32 Mip, Uint32 Slice) const
+    {
+        VERIFY_EXPR(Mip < m_Desc.MipLevels && Slice < m_Desc.ArraySize);
+        return m_Layout[size_t{m_Desc.MipLevels} * size_t{Slice} + size_t{Mip}];
+    }
+
+private:
+    // Keep the pool alive while the buffer references its memory
+    RefCntAutoPtr<StagingMemoryPool> m_pPool;
+    StagingMemoryPool::Region        m_Region;
+    std::vector<SubresourceLayout>   m_Layout;
 };
 
 } // namespace
@@ -144,33 +636,39 @@ struct TextureUploaderD3D12_Vk::InternalData
         enum Operation
         {
             Copy,
-            Map
+            Map,
+            Discard
         } operation;
-        RefCntAutoPtr<UploadTexture> pUploadTexture;
-        RefCntAutoPtr<ITexture>      pDstTexture;
-        Uint32                       DstSlice = 0;
-        Uint32                       DstMip   = 0;
+        RefCntAutoPtr<UploadBufferD3D12_Vk> pUploadBuffer;
+        RefCntAutoPtr<ITexture>             pDstTexture;
+        Uint32                              DstSlice = 0;
+        Uint32                              DstMip   = 0;
 
         // clang-format off
-        PendingBufferOperation(Operation op, UploadTexture* pUploadTex) :
-            operation     {op        },
-            pUploadTexture{pUploadTex}
+        PendingBufferOperation(Operation op, UploadBufferD3D12_Vk* pUploadBuff) :
+            operation    {op         },
+            pUploadBuffer{pUploadBuff}
         {}
-        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
-            operation      {op        },
-            pUploadTexture {pUploadTex},
-            pDstTexture    {pDstTex   },
-            DstSlice       {dstSlice  },
-            DstMip         {dstMip    }
+        PendingBufferOperation(Operation op, UploadBufferD3D12_Vk* pUploadBuff, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
+            operation     {op         },
+            pUploadBuffer {pUploadBuff},
+            pDstTexture   {pDstTex    },
+            DstSlice      {dstSlice   },
+            DstMip        {dstMip     }
         {}
         // clang-format on
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, const TextureUploaderDesc& Desc)
     {
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
         pDevice->CreateFence(fenceDesc, &m_pFence);
+
+        if (Desc.StagingMemoryPageSize != 0)
+        {
+            m_pStagingMemPool = MakeNewRCObj<StagingMemoryPool>()(pDevice, Desc.StagingMemoryPageSize, Desc.StagingMemoryBudget);
+        }
     }
 
     ~InternalData()
@@ -195,18 +693,24 @@ struct TextureUploaderD3D12_Vk::InternalData
         return m_InWorkOperations;
     }
 
-    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadBufferD3D12_Vk* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
         m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
     }
 
-    void EnqueueMap(UploadTexture* pUploadBuffer)
+    void EnqueueMap(UploadBufferD3D12_Vk* pUploadBuffer)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
         m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Map, pUploadBuffer);
     }
 
+    void EnqueueDiscard(UploadBufferD3D12_Vk* pUploadBuffer)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Discard, pUploadBuffer);
+    }
+
     Uint64 SignalFence(IDeviceContext* pContext)
     {
         // Fences can't be accessed from multiple threads simultaneously even
@@ -216,11 +720,14 @@ struct TextureUploaderD3D12_Vk::InternalData
         return FenceValue;
     }
 
-    void UpdatedCompletedFenceValue()
+    void UpdatedCompletedFenceValue(IDeviceContext* pContext)
     {
         // Fences can't be accessed from multiple threads simultaneously even
         // when protected by mutex
         m_CompletedFenceValue = m_pFence->GetCompletedValue();
+
+        if (m_pStagingMemPool)
+            m_pStagingMemPool->ReleaseStaleRegions(pContext, m_CompletedFenceValue);
     }
 
     RefCntAutoPtr<UploadTexture> FindCachedUploadTexture(const UploadBufferDesc& Desc)
@@ -253,6 +760,8 @@ struct TextureUploaderD3D12_Vk::InternalData
         Deque.emplace_back(pUploadTexture);
     }
 
+    RefCntAutoPtr<PooledUploadBuffer> AllocatePooledUploadBuffer(IDeviceContext* pContext, const UploadBufferDesc& Desc);
+
     Uint32 GetNumPendingOperations()
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
@@ -261,6 +770,11 @@ struct TextureUploaderD3D12_Vk::InternalData
 
     void Execute(IDeviceContext* pContext, PendingBufferOperation& OperationInfo);
 
+    RefCntAutoPtr<StagingMemoryPool> m_pStagingMemPool;
+
+    // Total size of the staging textures created by the uploader
+    std::atomic<Uint64> m_StagingTexturesSize{0};
+
 private:
     std::mutex                          m_PendingOperationsMtx;
     std::vector<PendingBufferOperation> m_PendingOperations;
@@ -276,7 +790,7 @@ private:
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc)}
 {
 }
 
@@ -301,7 +815,7 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
         for (auto& OperationInfo : InWorkOperations)
         {
             m_pInternalData->Execute(pContext, OperationInfo);
-            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+            if (OperationInfo.operation != InternalData::PendingBufferOperation::Map)
                 ++NumCopyOperations;
         }
 
@@ -314,7 +828,15 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
             for (auto& OperationInfo : InWorkOperations)
             {
                 if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                    OperationInfo.pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
+                {
+                    OperationInfo.pUploadBuffer->SignalCopyScheduled(SignaledFenceValue);
+                }
+                else if (OperationInfo.operation == InternalData::PendingBufferOperation::Discard)
+                {
+                    // Discarded buffers are not waited for by other threads and are recycled right away
+                    OperationInfo.pUploadBuffer->SignalCopyScheduled(SignaledFenceValue);
+                    RecycleBuffer(OperationInfo.pUploadBuffer);
+                }
             }
         }
 
@@ -322,101 +844,159 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
     }
 
     // This must be called by the same thread that signals the fence
-    m_pInternalData->UpdatedCompletedFenceValue();
+    m_pInternalData->UpdatedCompletedFenceValue(pContext);
 }
 
 
 void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pContext,
                                                     PendingBufferOperation& OperationInfo)
 {
-    auto&       pUploadTex     = OperationInfo.pUploadTexture;
-    const auto& StagingTexDesc = pUploadTex->GetDesc();
+    auto& pUploadBuff = OperationInfo.pUploadBuffer;
 
     switch (OperationInfo.operation)
     {
         case InternalData::PendingBufferOperation::Map:
         {
-            for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
-            {
-                for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
-                {
-                    pUploadTex->Map(pContext, Mip, Slice);
-                }
-            }
-            pUploadTex->SignalMapped();
+            pUploadBuff->Map(pContext);
+            pUploadBuff->SignalMapped();
         }
         break;
 
         case InternalData::PendingBufferOperation::Copy:
         {
-            VERIFY(pUploadTex->DbgIsMapped(), "Upload texture must be copied only after it has been mapped");
-            for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
+            VERIFY(pUploadBuff->DbgIsMapped(), "Upload buffer must be copied only after it has been mapped");
+            pUploadBuff->Copy(pContext, OperationInfo.pDstTexture, OperationInfo.DstSlice, OperationInfo.DstMip);
+        }
+        break;
+
+        case InternalData::PendingBufferOperation::Discard:
+        {
+            VERIFY(pUploadBuff->DbgIsMapped(), "Upload buffer must be discarded only after it has been mapped");
+            pUploadBuff->Discard(pContext);
+        }
+        break;
+    }
+}
+
+RefCntAutoPtr<PooledUploadBuffer> TextureUploaderD3D12_Vk::InternalData::AllocatePooledUploadBuffer(IDeviceContext*         pContext,
+                                                                                                    const UploadBufferDesc& Desc)
+{
+    VERIFY_EXPR(m_pStagingMemPool);
+
+    std::vector<PooledUploadBuffer::SubresourceLayout> Layout;
+
+    const auto MemorySize = PooledUploadBuffer::ComputeLayout(Desc, Layout);
+    const auto Alignment  = Uint64{PooledUploadBuffer::PlacementAlignment};
+
+    if (!m_pStagingMemPool->FitsInBudget(MemorySize, Alignment))
+    {
+        // Releasing the memory in flight will not make room for the buffer, so a worker thread would wait forever
+        LOG_ERROR_MESSAGE("TextureUploaderD3D12_Vk: upload buffer size (", MemorySize, " bytes) exceeds the staging memory budget (",
+                          m_pStagingMemPool->GetBudget(), " bytes)");
+        return {};
+    }
+
+    StagingMemoryPool::Region MemRegion;
+    if (pContext != nullptr)
+    {
+        // Render thread: we can't block until the memory is released by RenderThreadUpdate()
+        MemRegion = m_pStagingMemPool->Allocate(MemorySize, Alignment, /*Wait = */ false);
+        if (!MemRegion)
+        {
+            const auto StaleFenceValue = m_pStagingMemPool->GetLastStaleFenceValue();
+            if (StaleFenceValue != 0)
             {
-                for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
-                {
-                    pUploadTex->Unmap(pContext, Mip, Slice);
-
-                    CopyTextureAttribs CopyInfo //
-                        {
-                            pUploadTex->GetStagingTexture(),
-                            RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
-                            OperationInfo.pDstTexture,
-                            RESOURCE_STATE_TRANSITION_MODE_TRANSITION //
-                        };
-                    CopyInfo.SrcMipLevel = Mip;
-                    CopyInfo.SrcSlice    = Slice;
-                    CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
-                    CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
-                    pContext->CopyTexture(CopyInfo);
-                }
+                // Wait for the GPU to finish copies that use the staging memory
+                pContext->Flush();
+                m_pFence->Wait(StaleFenceValue);
+                UpdatedCompletedFenceValue(pContext);
+                MemRegion = m_pStagingMemPool->Allocate(MemorySize, Alignment, /*Wait = */ false);
             }
         }
-        break;
+
+    }
+    else
+    {
+        // Worker thread: block until the render thread releases the memory of the recycled buffers.
+        // If there are none, the memory may be held by this thread's own upload buffers, and the pool
+        // returns immediately.
+        MemRegion = m_pStagingMemPool->Allocate(MemorySize, Alignment, /*Wait = */ true);
+    }
+
+    if (!MemRegion)
+    {
+        // All staging memory is held by upload buffers that have not been recycled yet.
+        LOG_WARNING_MESSAGE("TextureUploaderD3D12_Vk: staging memory budget is exceeded");
+        MemRegion = m_pStagingMemPool->Allocate(MemorySize, Alignment, /*Wait = */ false, /*IgnoreBudget = */ true);
     }
+
+    if (!MemRegion)
+        return {};
+
+    return RefCntAutoPtr<PooledUploadBuffer>{MakeNewRCObj<PooledUploadBuffer>()(Desc, m_pStagingMemPool, std::move(MemRegion), std::move(Layout))};
 }
 
 void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pContext,
                                                    const UploadBufferDesc& Desc,
                                                    IUploadBuffer**         ppBuffer)
 {
-    RefCntAutoPtr<UploadTexture> pUploadTexture = m_pInternalData->FindCachedUploadTexture(Desc);
+    *ppBuffer = nullptr;
 
-    // No available buffer found in the cache
-    if (!pUploadTexture)
+    RefCntAutoPtr<UploadBufferD3D12_Vk> pUploadBuffer;
+    if (m_pInternalData->m_pStagingMemPool)
+    {
+        pUploadBuffer = m_pInternalData->AllocatePooledUploadBuffer(pContext, Desc);
+        if (!pUploadBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to allocate staging memory for ", Desc.Width, "x", Desc.Height, 'x', Desc.Depth, ' ',
+                              GetTextureFormatAttribs(Desc.Format).Name, " upload buffer");
+            return;
+        }
+    }
+    else
     {
-        TextureDesc StagingTexDesc;
-        StagingTexDesc.Type           = Desc.ArraySize == 1 ? RESOURCE_DIM_TEX_2D : RESOURCE_DIM_TEX_2D_ARRAY;
-        StagingTexDesc.Width          = Desc.Width;
-        StagingTexDesc.Height         = Desc.Height;
-        StagingTexDesc.Format         = Desc.Format;
-        StagingTexDesc.MipLevels      = Desc.MipLevels;
-        StagingTexDesc.ArraySize      = Desc.ArraySize;
-        StagingTexDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
-        StagingTexDesc.Usage          = USAGE_STAGING;
+        RefCntAutoPtr<UploadTexture> pUploadTexture = m_pInternalData->FindCachedUploadTexture(Desc);
+
+        // No available buffer found in the cache
+        if (!pUploadTexture)
+        {
+            TextureDesc StagingTexDesc;
+            StagingTexDesc.Type           = Desc.ArraySize == 1 ? RESOURCE_DIM_TEX_2D : RESOURCE_DIM_TEX_2D_ARRAY;
+            StagingTexDesc.Width          = Desc.Width;
+            StagingTexDesc.Height         = Desc.Height;
+            StagingTexDesc.Format         = Desc.Format;
+            StagingTexDesc.MipLevels      = Desc.MipLevels;
+            StagingTexDesc.ArraySize      = Desc.ArraySize;
+            StagingTexDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+            StagingTexDesc.Usage          = USAGE_STAGING;
+
+            RefCntAutoPtr<ITexture> pStagingTexture;
+            m_pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTexture);
 
-        RefCntAutoPtr<ITexture> pStagingTexture;
-        m_pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTexture);
+            LOG_INFO_MESSAGE("Created ", Desc.Width, "x", Desc.Height, 'x', Desc.Depth, ' ', Desc.MipLevels, "-mip ",
+                             Desc.ArraySize, "-slice ",
+                             GetTextureFormatAttribs(Desc.Format).Name, " staging texture");
 
-        LOG_INFO_MESSAGE("Created ", Desc.Width, "x", Desc.Height, 'x', Desc.Depth, ' ', Desc.MipLevels, "-mip ",
-                         Desc.ArraySize, "-slice ",
-                         GetTextureFormatAttribs(Desc.Format).Name, " staging texture");
+            m_pInternalData->m_StagingTexturesSize.fetch_add(GetStagingTextureDataSize(StagingTexDesc));
 
-        pUploadTexture = MakeNewRCObj<UploadTexture>()(Desc, pStagingTexture);
+            pUploadTexture = MakeNewRCObj<UploadTexture>()(Desc, pStagingTexture);
+        }
+        pUploadBuffer = std::move(pUploadTexture);
     }
 
     if (pContext != nullptr)
     {
         // Render thread
-        InternalData::PendingBufferOperation MapOp{InternalData::PendingBufferOperation::Operation::Map, pUploadTexture};
+        InternalData::PendingBufferOperation MapOp{InternalData::PendingBufferOperation::Operation::Map, pUploadBuffer};
         m_pInternalData->Execute(pContext, MapOp);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueMap(pUploadTexture);
-        pUploadTexture->WaitForMap();
+        m_pInternalData->EnqueueMap(pUploadBuffer);
+        pUploadBuffer->WaitForMap();
     }
-    *ppBuffer = pUploadTexture.Detach();
+    *ppBuffer = pUploadBuffer.Detach();
 }
 
 void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
@@ -425,14 +1005,14 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                                               Uint32          MipLevel,
                                               IUploadBuffer*  pUploadBuffer)
 {
-    auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
+    auto* pUploadBufferD3D12Vk = ClassPtrCast<UploadBufferD3D12_Vk>(pUploadBuffer);
     if (pContext != nullptr)
     {
         // Render thread
         InternalData::PendingBufferOperation CopyOp //
             {
                 InternalData::PendingBufferOperation::Operation::Copy,
-                pUploadTexture,
+                pUploadBufferD3D12Vk,
                 pDstTexture,
                 ArraySlice,
                 MipLevel //
@@ -442,29 +1022,71 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
         // The buffer may be recycled immediately after the copy scheduled is signaled,
         // so we must signal the fence first.
         auto SignaledFenceValue = m_pInternalData->SignalFence(pContext);
-        pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
+        pUploadBufferD3D12Vk->SignalCopyScheduled(SignaledFenceValue);
         // This must be called by the same thread that signals the fence
-        m_pInternalData->UpdatedCompletedFenceValue();
+        m_pInternalData->UpdatedCompletedFenceValue(pContext);
     }
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadBufferD3D12Vk, pDstTexture, ArraySlice, MipLevel);
     }
 }
 
 void TextureUploaderD3D12_Vk::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
-    auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
-    VERIFY(pUploadTexture->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    auto* pUploadBufferD3D12Vk = ClassPtrCast<UploadBufferD3D12_Vk>(pUploadBuffer);
+    VERIFY(pUploadBufferD3D12Vk->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+
+    if (m_pInternalData->m_pStagingMemPool)
+    {
+        // Pooled upload buffers are not reused. Their memory is returned to the pool
+        // and is released once the GPU copy completes.
+        ClassPtrCast<PooledUploadBuffer>(pUploadBufferD3D12Vk)->ReleaseRegion();
+    }
+    else
+    {
+        m_pInternalData->RecycleUploadTexture(ClassPtrCast<UploadTexture>(pUploadBufferD3D12Vk));
+    }
+}
+
+void TextureUploaderD3D12_Vk::DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer)
+{
+    auto* pUploadBufferD3D12Vk = ClassPtrCast<UploadBufferD3D12_Vk>(pUploadBuffer);
+    if (pContext != nullptr)
+    {
+        // Render thread
+        InternalData::PendingBufferOperation DiscardOp{InternalData::PendingBufferOperation::Operation::Discard, pUploadBufferD3D12Vk};
+        m_pInternalData->Execute(pContext, DiscardOp);
 
-    m_pInternalData->RecycleUploadTexture(pUploadTexture);
+        // The staging memory is released through the same path as the memory of copied buffers
+        auto SignaledFenceValue = m_pInternalData->SignalFence(pContext);
+        pUploadBufferD3D12Vk->SignalCopyScheduled(SignaledFenceValue);
+        RecycleBuffer(pUploadBufferD3D12Vk);
+        // This must be called by the same thread that signals the fence
+        m_pInternalData->UpdatedCompletedFenceValue(pContext);
+    }
+    else
+    {
+        // Worker thread
+        m_pInternalData->EnqueueDiscard(pUploadBufferD3D12Vk);
+    }
 }
 
 TextureUploaderStats TextureUploaderD3D12_Vk::GetStats()
 {
     TextureUploaderStats Stats;
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->GetNumPendingOperations());
+    if (m_pInternalData->m_pStagingMemPool)
+    {
+        m_pInternalData->m_pStagingMemPool->GetStats(Stats);
+    }
+    else
+    {
+        // Staging textures are never released while the uploader is alive
+        Stats.StagingMemorySize     = m_pInternalData->m_StagingTexturesSize.load();
+        Stats.PeakStagingMemorySize = Stats.StagingMemorySize;
+    }
     return Stats;
 }
 
@@ -167,13 +167,31 @@ struct TextureUploaderGL::InternalData
         m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Map, pUploadBuffer);
     }
 
+    void EnqueueDiscard(UploadBufferGL* pUploadBuffer)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Discard, pUploadBuffer);
+    }
+
+    void RecycleBuffer(UploadBufferGL* pUploadBuffer)
+    {
+        VERIFY(pUploadBuffer->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+        pUploadBuffer->Reset();
+
+        std::lock_guard<std::mutex> CacheLock(m_UploadBuffCacheMtx);
+
+        auto& Deque = m_UploadBufferCache[pUploadBuffer->GetDesc()];
+        Deque.emplace_back(pUploadBuffer);
+    }
+
 
     struct PendingBufferOperation
     {
         enum Operation
         {
             Map,
-            Copy
+            Copy,
+            Discard
         } operation;
         RefCntAutoPtr<UploadBufferGL> pUploadBuffer;
         RefCntAutoPtr<ITexture>       pDstTexture;
@@ -303,6 +321,15 @@ void TextureUploaderGL::InternalData::Execute(IRenderDevice*          pDevice,
             pBuffer->SignalCopyScheduled();
         }
         break;
+
+        case InternalData::PendingBufferOperation::Discard:
+        {
+            pContext->UnmapBuffer(pBuffer->m_pStagingBuffer, MAP_WRITE);
+            // The buffer has never been used by the GPU and can be reused right away
+            pBuffer->SignalCopyScheduled();
+            RecycleBuffer(pBuffer);
+        }
+        break;
     }
 }
 
@@ -383,15 +410,23 @@ void TextureUploaderGL::ScheduleGPUCopy(IDeviceContext* pContext,
 
 void TextureUploaderGL::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
-    auto* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(pUploadBuffer);
-    VERIFY(pUploadBufferGL->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
-    pUploadBufferGL->Reset();
-
-    std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
+    m_pInternalData->RecycleBuffer(ClassPtrCast<UploadBufferGL>(pUploadBuffer));
+}
 
-    auto& Cache = m_pInternalData->m_UploadBufferCache;
-    auto& Deque = Cache[pUploadBufferGL->GetDesc()];
-    Deque.emplace_back(pUploadBufferGL);
+void TextureUploaderGL::DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer)
+{
+    auto* pUploadBufferGL = ClassPtrCast<UploadBufferGL>(pUploadBuffer);
+    if (pContext != nullptr)
+    {
+        // Render thread
+        InternalData::PendingBufferOperation DiscardOp{InternalData::PendingBufferOperation::Operation::Discard, pUploadBufferGL};
+        m_pInternalData->Execute(m_pDevice, pContext, DiscardOp);
+    }
+    else
+    {
+        // Worker thread
+        m_pInternalData->EnqueueDiscard(pUploadBufferGL);
+    }
 }
 
 TextureUploaderStats TextureUploaderGL::GetStats()
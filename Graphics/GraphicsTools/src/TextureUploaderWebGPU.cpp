@@ -162,7 +162,8 @@ struct TextureUploaderWebGPU::InternalData
         enum Operation
         {
             Map,
-            Copy
+            Copy,
+            Discard
         } operation;
 
         RefCntAutoPtr<UploadBufferWebGPU> pUploadBuffer;
@@ -211,6 +212,23 @@ struct TextureUploaderWebGPU::InternalData
         m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Map, pUploadBuffer);
     }
 
+    void EnqueueDiscard(UploadBufferWebGPU* pUploadBuffer)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Discard, pUploadBuffer);
+    }
+
+    void RecycleBuffer(UploadBufferWebGPU* pUploadBuffer)
+    {
+        VERIFY(pUploadBuffer->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+        pUploadBuffer->Reset();
+
+        std::lock_guard<std::mutex> CacheLock(m_UploadBuffCacheMtx);
+
+        auto& Deque = m_UploadBufferCache[pUploadBuffer->GetDesc()];
+        Deque.emplace_back(pUploadBuffer);
+    }
+
     void Execute(IDeviceContext*         pContext,
                  PendingBufferOperation& OperationInfo)
     {
@@ -268,6 +286,16 @@ struct TextureUploaderWebGPU::InternalData
                 pBuffer->SignalCopyScheduled();
             }
             break;
+
+            case PendingBufferOperation::Discard:
+            {
+                VERIFY_EXPR(pBuffer->m_pStagingBuffer != nullptr);
+                pContext->UnmapBuffer(pBuffer->m_pStagingBuffer, MAP_WRITE);
+                // The buffer has never been used by the GPU and can be reused right away
+                pBuffer->SignalCopyScheduled();
+                RecycleBuffer(pBuffer);
+            }
+            break;
         }
     }
     std::mutex                          m_PendingOperationsMtx;
@@ -389,15 +417,23 @@ void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext* pContext,
 
 void TextureUploaderWebGPU::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
-    auto* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
-    VERIFY(pUploadBufferWebGPU->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
-    pUploadBufferWebGPU->Reset();
-
-    std::lock_guard<std::mutex> CacheLock(m_pInternalData->m_UploadBuffCacheMtx);
+    m_pInternalData->RecycleBuffer(ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer));
+}
 
-    auto& Cache = m_pInternalData->m_UploadBufferCache;
-    auto& Deque = Cache[pUploadBufferWebGPU->GetDesc()];
-    Deque.emplace_back(pUploadBufferWebGPU);
+void TextureUploaderWebGPU::DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer)
+{
+    auto* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
+    if (pContext != nullptr)
+    {
+        // Render thread
+        InternalData::PendingBufferOperation DiscardOp{InternalData::PendingBufferOperation::Operation::Discard, pUploadBufferWebGPU};
+        m_pInternalData->Execute(pContext, DiscardOp);
+    }
+    else
+    {
+        // Worker thread
+        m_pInternalData->EnqueueDiscard(pUploadBufferWebGPU);
+    }
 }
 
 TextureUploaderStats TextureUploaderWebGPU::GetStats()
@@ -29,6 +29,8 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <map>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -38,6 +40,7 @@
 #include "Align.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
+#include "GraphicsAccessories.hpp"
 
 namespace Diligent
 {
@@ -83,7 +86,7 @@ public:
 
     virtual Uint32 GetStartVertex() const override final
     {
-        return m_StartVertex;
+        return m_StartVertex.load();
     }
 
     virtual Uint32 GetVertexCount() const override final
@@ -108,12 +111,16 @@ public:
     }
 
 private:
+    friend class VertexPoolImpl;
+
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
+    // Protected by the parent pool mutex when compaction is enabled
     VariableSizeAllocationsManager::Allocation m_Region;
 
-    const Uint32 m_StartVertex;
-    const Uint32 m_VertexCount;
+    // The start vertex may be changed by the pool compaction
+    std::atomic<Uint32> m_StartVertex;
+    const Uint32        m_VertexCount;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -156,6 +163,7 @@ public:
                 return MaxVertexCount;
             }(CreateInfo.Desc.VertexCount, CreateInfo.MaxVertexCount),
         },
+        m_CompactionEnabled{CreateInfo.EnableCompaction},
         m_AllocationObjAllocator{
             DefaultRawMemoryAllocator::GetAllocator(),
             sizeof(VertexPoolAllocationImpl),
@@ -170,6 +178,12 @@ public:
         {
             const auto& VtxElem = m_Desc.pElements[i];
 
+            if (m_CompactionEnabled && VtxElem.Usage != USAGE_DEFAULT && VtxElem.Usage != USAGE_SPARSE)
+            {
+                LOG_ERROR_AND_THROW("Vertex pool '", m_Name, "': compaction requires USAGE_DEFAULT or USAGE_SPARSE buffers, but element ", i,
+                                    " uses ", GetUsageString(VtxElem.Usage), '.');
+            }
+
             std::string Name = m_Desc.Name;
             Name += " - buffer ";
             Name += std::to_string(i);
@@ -315,34 +329,138 @@ public:
 
         if (Region.IsValid())
         {
+            const auto StartVertex = static_cast<Uint32>(Region.UnalignedOffset);
+
             // clang-format off
             VertexPoolAllocationImpl* pSuballocation{
                 NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
                 (
                     this,
-                    static_cast<Uint32>(Region.UnalignedOffset),
+                    StartVertex,
                     NumVertices,
                     std::move(Region)
                 )
             };
             // clang-format on
 
+            if (m_CompactionEnabled)
+            {
+                // The allocation can't be moved until it is registered, so it is safe
+                // to use the start vertex obtained before the mutex was released.
+                std::lock_guard<std::mutex> Lock{m_MgrMtx};
+                m_Allocations.emplace(StartVertex, pSuballocation);
+            }
+
             pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
             m_AllocationCount.fetch_add(1);
         }
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Region)
+    void Free(VertexPoolAllocationImpl& Allocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Region));
+        if (m_CompactionEnabled)
+        {
+            VERIFY_EXPR(m_Allocations.find(Allocation.m_StartVertex.load()) != m_Allocations.end());
+            m_Allocations.erase(Allocation.m_StartVertex.load());
+        }
+        m_Mgr.Free(std::move(Allocation.m_Region));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
     }
 
+    virtual Uint32 Compact(IRenderDevice*  pDevice,
+                           IDeviceContext* pContext,
+                           Uint64          MaxBytesToMove) override final
+    {
+        if (!m_CompactionEnabled)
+        {
+            DEV_ERROR("Vertex pool '", m_Name, "' was not created with compaction enabled");
+            return 0;
+        }
+        DEV_CHECK_ERR(pDevice != nullptr, "Render device must not be null");
+        DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+        // Make sure that all buffers are initialized and large enough
+        UpdateAll(pDevice, pContext);
+        for (const auto& Buffer : m_Buffers)
+        {
+            if (Buffer->GetBuffer() == nullptr)
+                return 0;
+        }
+
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // Allocations made by other threads after UpdateAll() may reside in the
+        // pool space that is not yet backed by the buffers.
+        Uint64 BufferCapacity = ~Uint64{0};
+        for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+            BufferCapacity = std::min(BufferCapacity, m_Buffers[i]->GetDesc().Size / m_Elements[i].Size);
+
+        Uint64 VertexSize = 0;
+        for (const auto& Elem : m_Elements)
+            VertexSize += Elem.Size;
+
+        struct MoveInfo
+        {
+            VertexPoolAllocationImpl* pAllocation;
+            Uint32                    OldStartVertex;
+        };
+        std::vector<MoveInfo> Moves;
+
+        Uint64 BytesMoved = 0;
+        // Start from the allocation with the highest offset and move every allocation to
+        // the lowest free range that can fit it.
+        for (auto it = m_Allocations.rbegin(); it != m_Allocations.rend(); ++it)
+        {
+            auto&        Allocation  = *it->second;
+            const Uint32 StartVertex = it->first;
+            const Uint32 VertexCount = Allocation.m_VertexCount;
+            VERIFY_EXPR(Allocation.m_StartVertex.load() == StartVertex);
+
+            const auto MoveSize = Uint64{VertexCount} * VertexSize;
+            if (MaxBytesToMove != 0 && !Moves.empty() && BytesMoved + MoveSize > MaxBytesToMove)
+                break;
+
+            if (Uint64{StartVertex} + VertexCount > BufferCapacity)
+                continue;
+
+            auto NewRegion = m_Mgr.AllocateFirstFit(VertexCount, 1, StartVertex);
+            if (!NewRegion.IsValid())
+                continue;
+
+            // The new range can't overlap the old one because the old range is still allocated
+            const auto NewStartVertex = static_cast<Uint32>(NewRegion.UnalignedOffset);
+            VERIFY_EXPR(NewStartVertex + VertexCount <= StartVertex);
+            for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+                CopyVertices(pDevice, pContext, i, StartVertex, NewStartVertex, VertexCount);
+
+            m_Mgr.Free(std::move(Allocation.m_Region));
+            Allocation.m_Region = std::move(NewRegion);
+            Allocation.m_StartVertex.store(NewStartVertex);
+
+            Moves.push_back({&Allocation, StartVertex});
+            BytesMoved += MoveSize;
+        }
+
+        for (const auto& Move : Moves)
+        {
+            m_Allocations.erase(Move.OldStartVertex);
+            m_Allocations.emplace(Move.pAllocation->m_StartVertex.load(), Move.pAllocation);
+        }
+
+        if (!Moves.empty())
+        {
+            m_CompactionVersion.fetch_add(1);
+            UpdateUsageStats();
+        }
+
+        return static_cast<Uint32>(Moves.size());
+    }
+
     virtual Uint32 GetVersion() const override final
     {
-        Uint32 Version = 0;
+        Uint32 Version = m_CompactionVersion.load();
         for (const auto& Buffer : m_Buffers)
             Version += Buffer->GetVersion();
         return Version;
@@ -366,6 +484,12 @@ public:
         UsageStats.UsedMemorySize = UsageStats.AllocatedVertexCount * VertexSize;
 
         UsageStats.AllocationCount = m_AllocationCount.load();
+
+        const auto FreeVertexCount  = UsageStats.TotalVertexCount - std::min(UsageStats.AllocatedVertexCount, UsageStats.TotalVertexCount);
+        const auto LargestFreeRange = std::min(m_LargestFreeVertexRange.load(), FreeVertexCount);
+        UsageStats.Fragmentation    = FreeVertexCount > 0 ?
+            1.f - static_cast<float>(static_cast<double>(LargestFreeRange) / static_cast<double>(FreeVertexCount)) :
+            0.f;
     }
 
 private:
@@ -373,8 +497,37 @@ private:
     {
         m_AllocatedVertexCount.store(m_Mgr.GetUsedSize());
         m_TotalVertexCount.store(m_Mgr.GetMaxSize());
+        m_LargestFreeVertexRange.store(m_Mgr.GetMaxFreeBlockSize());
         UpdateCommittedMemorySize();
     }
+
+    // Copies vertices of the given element to a non-overlapping range of the same buffer.
+    // The copy goes through the scratch buffer since copying within the same buffer is
+    // not supported by all backends.
+    void CopyVertices(IRenderDevice* pDevice, IDeviceContext* pContext, Uint32 Index, Uint32 SrcVertex, Uint32 DstVertex, Uint32 VertexCount)
+    {
+        const Uint64 ElemSize = m_Elements[Index].Size;
+        const Uint64 CopySize = Uint64{VertexCount} * ElemSize;
+        if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < CopySize)
+        {
+            std::string Name = m_Name + " - compaction scratch buffer";
+
+            BufferDesc ScratchDesc;
+            ScratchDesc.Name  = Name.c_str();
+            ScratchDesc.Size  = std::max(AlignUp(CopySize, Uint64{1} << 16u), m_pScratchBuffer ? m_pScratchBuffer->GetDesc().Size * 2 : 0);
+            ScratchDesc.Usage = USAGE_DEFAULT;
+
+            m_pScratchBuffer.Release();
+            pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+            VERIFY_EXPR(m_pScratchBuffer);
+        }
+
+        auto* pBuffer = m_Buffers[Index]->GetBuffer();
+        pContext->CopyBuffer(pBuffer, SrcVertex * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             m_pScratchBuffer, 0, CopySize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CopyBuffer(m_pScratchBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pBuffer, DstVertex * ElemSize, CopySize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
     void UpdateCommittedMemorySize()
     {
         Uint64 CommittedMemorySize = 0;
@@ -399,11 +552,19 @@ private:
 
     const Uint32 m_ExtraVertexCount;
     const Uint32 m_MaxVertexCount;
+    const bool   m_CompactionEnabled;
+
+    // Live allocations sorted by their start vertex. Only used when compaction is enabled.
+    std::map<Uint32, VertexPoolAllocationImpl*> m_Allocations;
+    // Intermediate buffer used to move vertex data during compaction
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
+    std::atomic<Uint32>    m_CompactionVersion{0};
 
     std::atomic<Int32>  m_AllocationCount{0};
     std::atomic<Uint64> m_AllocatedVertexCount{0};
     std::atomic<Uint64> m_CommittedMemorySize{0};
     std::atomic<Uint64> m_TotalVertexCount{0};
+    std::atomic<Uint64> m_LargestFreeVertexRange{0};
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
 };
@@ -411,7 +572,7 @@ private:
 
 VertexPoolAllocationImpl::~VertexPoolAllocationImpl()
 {
-    m_pParentPool->Free(std::move(m_Region));
+    m_pParentPool->Free(*this);
 }
 
 IVertexPool* VertexPoolAllocationImpl::GetPool()
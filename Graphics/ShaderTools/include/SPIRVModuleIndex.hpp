@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SPIRVInstructionIterator and Diligent::SPIRVModuleIndex classes
+
+#include <vector>
+#include <algorithm>
+
+#include "BasicTypes.h"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Iterates over the instructions of a SPIR-V module.
+
+/// Instruction opcodes and operands are raw SPIR-V words (e.g. spv::Op values).
+/// The iterator never reads past the end of the module: an instruction with zero word count
+/// or one that does not fit into the module terminates the iteration.
+class SPIRVInstructionIterator
+{
+public:
+    SPIRVInstructionIterator(const uint32_t* pModule, size_t ModuleSize, size_t Offset) noexcept :
+        m_pModule{pModule},
+        m_ModuleSize{ModuleSize},
+        m_Offset{Offset}
+    {
+        Validate();
+    }
+
+    /// Returns the instruction opcode.
+    uint32_t GetOpCode() const { return m_pModule[m_Offset] & 0xFFFFu; }
+
+    /// Returns the number of words in the instruction, including the opcode word.
+    uint32_t GetWordCount() const { return m_pModule[m_Offset] >> 16u; }
+
+    /// Returns the offset of the first instruction word from the beginning of the module.
+    size_t GetOffset() const { return m_Offset; }
+
+    /// Returns the instruction word at the given index. Index 0 is the opcode word.
+    uint32_t operator[](uint32_t Idx) const
+    {
+        VERIFY_EXPR(Idx < GetWordCount());
+        return m_pModule[m_Offset + Idx];
+    }
+
+    SPIRVInstructionIterator& operator++()
+    {
+        m_Offset += GetWordCount();
+        Validate();
+        return *this;
+    }
+
+    const SPIRVInstructionIterator& operator*() const { return *this; }
+
+    bool operator==(const SPIRVInstructionIterator& rhs) const { return m_Offset == rhs.m_Offset; }
+    bool operator!=(const SPIRVInstructionIterator& rhs) const { return m_Offset != rhs.m_Offset; }
+
+private:
+    void Validate()
+    {
+        if (m_Offset < m_ModuleSize)
+        {
+            const uint32_t WordCount = GetWordCount();
+            if (WordCount == 0 || m_Offset + WordCount > m_ModuleSize)
+                m_Offset = m_ModuleSize;
+        }
+        else
+        {
+            m_Offset = m_ModuleSize;
+        }
+    }
+
+    const uint32_t* m_pModule    = nullptr;
+    size_t          m_ModuleSize = 0;
+    size_t          m_Offset     = 0;
+};
+
+
+/// The range of instructions of a SPIR-V module that can be used in a range-based for loop:
+///
+///     for (const auto& Instr : SPIRVInstructions{SPIRV})
+///     {
+///         if (Instr.GetOpCode() == spv::OpTypeImage)
+///             ...
+///     }
+class SPIRVInstructions
+{
+public:
+    /// Number of words in the SPIR-V module header.
+    static constexpr size_t HeaderSize = 5;
+
+    explicit SPIRVInstructions(const std::vector<uint32_t>& SPIRV) noexcept :
+        m_pModule{SPIRV.data()},
+        m_ModuleSize{SPIRV.size()}
+    {}
+
+    SPIRVInstructionIterator begin() const
+    {
+        return {m_pModule, m_ModuleSize, std::min(HeaderSize, m_ModuleSize)};
+    }
+
+    SPIRVInstructionIterator end() const
+    {
+        return {m_pModule, m_ModuleSize, m_ModuleSize};
+    }
+
+private:
+    const uint32_t* const m_pModule;
+    const size_t          m_ModuleSize;
+};
+
+
+/// Index of the SPIR-V module ids.
+
+/// The index is built in a single pass over the module instructions and only allocates
+/// the table of ids. For every id it records the offset of the instruction that defines it,
+/// the offset of its name, and the offsets of the binding, descriptor set and location decorations,
+/// so that the byte code can be queried and patched without full reflection.
+///
+/// The index references the SPIR-V words, but does not own them. The words may be modified in place
+/// as long as the module layout does not change (e.g. decoration literals or image formats
+/// are patched).
+class SPIRVModuleIndex
+{
+public:
+    static constexpr uint32_t InvalidOffset = ~0u;
+
+    /// Builds the index. Throws an exception if the SPIR-V module header is invalid.
+    explicit SPIRVModuleIndex(const std::vector<uint32_t>& SPIRV) noexcept(false);
+
+    /// Returns the upper bound of the module ids.
+    uint32_t GetIdBound() const { return static_cast<uint32_t>(m_Ids.size()); }
+
+    /// Returns the offset of the instruction that defines the id, or InvalidOffset.
+    uint32_t GetDefinitionOffset(uint32_t Id) const
+    {
+        return Id < m_Ids.size() ? m_Ids[Id].DefOffset : InvalidOffset;
+    }
+
+    /// Returns the opcode of the instruction that defines the id, or spv::OpNop if the id is not defined.
+    uint32_t GetOpCode(uint32_t Id) const;
+
+    /// Returns the instruction that defines the id.
+    /// The id must be defined.
+    SPIRVInstructionIterator GetDefinition(uint32_t Id) const;
+
+    /// Returns the name assigned to the id by OpName, or null if the id has no name.
+    const char* GetName(uint32_t Id) const;
+
+    /// Returns the offset of the first literal of the decoration applied to the id by OpDecorate,
+    /// or InvalidOffset if the id does not have this decoration or the decoration has no literals.
+    ///
+    /// \remarks    Binding, descriptor set and location decorations are looked up in the index.
+    ///             Other decorations are found by scanning the annotation section of the module.
+    ///             Decorations applied through decoration groups are not supported.
+    uint32_t GetDecorationOffset(uint32_t Id, uint32_t Decoration) const;
+
+    /// Returns the string literal of the decoration applied to the id by OpDecorateString
+    /// (e.g. the HLSL semantic), or null if the id does not have this decoration.
+    const char* GetDecorationString(uint32_t Id, uint32_t Decoration) const;
+
+    /// Returns the storage class of the variable, or ~0u if the id is not a variable.
+    uint32_t GetStorageClass(uint32_t VarId) const;
+
+    /// Returns the type of the variable with pointer and array types stripped,
+    /// or zero if the id is not a variable.
+    uint32_t GetBaseTypeId(uint32_t VarId) const;
+
+    /// Calls the handler for every global variable (i.e. OpVariable declared outside of functions)
+    /// in the order of their ids.
+    template <typename HandlerType>
+    void ProcessGlobalVariables(HandlerType&& Handler) const
+    {
+        for (uint32_t Id = 0; Id < m_Ids.size(); ++Id)
+        {
+            if (IsGlobalVariable(Id))
+                Handler(Id);
+        }
+    }
+
+private:
+    bool IsGlobalVariable(uint32_t Id) const;
+
+    const uint32_t* const m_pModule;
+    const size_t          m_ModuleSize;
+
+    struct IdInfo
+    {
+        uint32_t DefOffset           = InvalidOffset;
+        uint32_t NameOffset          = InvalidOffset;
+        uint32_t BindingOffset       = InvalidOffset;
+        uint32_t DescriptorSetOffset = InvalidOffset;
+        uint32_t LocationOffset      = InvalidOffset;
+    };
+    std::vector<IdInfo> m_Ids;
+
+    // The range of the annotation (OpDecorate*) instructions
+    uint32_t m_AnnotationsStart = InvalidOffset;
+    uint32_t m_AnnotationsEnd   = InvalidOffset;
+
+    // The offset of the first function. All variables declared before it are global.
+    uint32_t m_FunctionsStart = InvalidOffset;
+};
+
+} // namespace Diligent
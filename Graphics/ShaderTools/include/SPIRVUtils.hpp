@@ -35,6 +35,8 @@
 namespace Diligent
 {
 
+class SPIRVModuleIndex;
+
 /// Patches image format declarations in the SPIRV code using the provided mapping.
 ///
 /// \param [in] SPIRV        - SPIRV code.
@@ -44,4 +46,29 @@ namespace Diligent
 std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&                                SPIRV,
                                         const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats);
 
+/// Patches image format declarations in the SPIRV code in place using the provided mapping.
+///
+/// \param [in, out] SPIRV    - SPIRV code.
+/// \param [in] Index         - Index of the SPIRV code.
+/// \param [in] ImageFormats  - Mapping from image format names to texture formats.
+void PatchImageFormats(std::vector<uint32_t>&                                      SPIRV,
+                       const SPIRVModuleIndex&                                     Index,
+                       const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats);
+
+/// Returns true if the SPIRV module declares storage images (excluding texel buffers).
+bool HasStorageImages(const SPIRVModuleIndex& Index);
+
+/// Assigns the location N to the vertex shader input with the HLSL semantic ATTRIBN.
+///
+/// \param [in, out] SPIRV                 - SPIRV code.
+/// \param [in] Semantic                   - HLSL semantic of the input.
+/// \param [in] LocationDecorationOffset   - Offset of the input location decoration in the SPIRV code.
+void MapHLSLVertexShaderInput(std::vector<uint32_t>& SPIRV, const char* Semantic, uint32_t LocationDecorationOffset);
+
+/// Assigns the locations to all vertex shader inputs with ATTRIBN semantics.
+///
+/// \param [in, out] SPIRV - SPIRV code compiled from HLSL.
+/// \param [in] Index      - Index of the SPIRV code.
+void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV, const SPIRVModuleIndex& Index);
+
 } // namespace Diligent
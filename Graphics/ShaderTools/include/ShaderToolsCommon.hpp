@@ -137,6 +137,14 @@ struct ShaderIncludePreprocessInfo
 /// Includes are processed in a depth-first order such that original source file is processed last.
 bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept;
 
+/// Finds all include directives in the shader source and calls the IncludeHandler function
+/// for each of them. Unlike ProcessShaderIncludes, the function does not load the included files.
+/// If the source can't be parsed, the function returns false and writes the error message to pError.
+bool FindShaderIncludes(const char*                                    Source,
+                        size_t                                         SourceLength,
+                        const std::function<void(const std::string&)>& IncludeHandler,
+                        std::string*                                   pError = nullptr) noexcept;
+
 ///  Unrolls all include files into a single file
 std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false);
 
@@ -0,0 +1,254 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVModuleIndex.hpp"
+
+#include "Errors.hpp"
+
+#define SPV_ENABLE_UTILITY_CODE
+#include "spirv.hpp"
+
+namespace Diligent
+{
+
+constexpr size_t   SPIRVInstructions::HeaderSize;
+constexpr uint32_t SPIRVModuleIndex::InvalidOffset;
+
+namespace
+{
+
+// Checks that the string literal that starts at the given word of the instruction is null-terminated
+bool IsStringLiteralTerminated(const SPIRVInstructionIterator& Instr, uint32_t FirstWord)
+{
+    const uint32_t WordCount = Instr.GetWordCount();
+    if (WordCount <= FirstWord)
+        return false;
+
+    // The string is padded with zeroes to the word boundary, so the last byte of the
+    // last word is always zero (SPIR-V strings are stored in little-endian order).
+    return (Instr[WordCount - 1] >> 24u) == 0;
+}
+
+} // namespace
+
+SPIRVModuleIndex::SPIRVModuleIndex(const std::vector<uint32_t>& SPIRV) noexcept(false) :
+    m_pModule{SPIRV.data()},
+    m_ModuleSize{SPIRV.size()}
+{
+    if (SPIRV.size() < SPIRVInstructions::HeaderSize)
+        LOG_ERROR_AND_THROW("SPIRV module is too small (", SPIRV.size(), " words)");
+
+    if (SPIRV[0] != spv::MagicNumber)
+        LOG_ERROR_AND_THROW("Invalid SPIRV magic number");
+
+    // Word 3 is the bound: all ids in the module are less than it
+    m_Ids.resize(SPIRV[3]);
+
+    for (const SPIRVInstructionIterator& Instr : SPIRVInstructions{SPIRV})
+    {
+        const uint32_t OpCode    = Instr.GetOpCode();
+        const uint32_t WordCount = Instr.GetWordCount();
+        const uint32_t Offset    = static_cast<uint32_t>(Instr.GetOffset());
+
+        switch (OpCode)
+        {
+            case spv::OpName:
+                // OpName | Target | Name
+                if (IsStringLiteralTerminated(Instr, 2) && Instr[1] < m_Ids.size())
+                    m_Ids[Instr[1]].NameOffset = Offset + 2;
+                break;
+
+            case spv::OpDecorate:
+            case spv::OpDecorateId:
+            case spv::OpDecorateString:
+                if (m_AnnotationsStart == InvalidOffset)
+                    m_AnnotationsStart = Offset;
+                m_AnnotationsEnd = Offset + WordCount;
+
+                // OpDecorate | Target | Decoration | Literals...
+                if (OpCode == spv::OpDecorate && WordCount > 3 && Instr[1] < m_Ids.size())
+                {
+                    IdInfo& Info = m_Ids[Instr[1]];
+                    switch (Instr[2])
+                    {
+                        // clang-format off
+                        case spv::DecorationBinding:       Info.BindingOffset       = Offset + 3; break;
+                        case spv::DecorationDescriptorSet: Info.DescriptorSetOffset = Offset + 3; break;
+                        case spv::DecorationLocation:      Info.LocationOffset      = Offset + 3; break;
+                        // clang-format on
+                        default: break;
+                    }
+                }
+                break;
+
+            case spv::OpFunction:
+                if (m_FunctionsStart == InvalidOffset)
+                    m_FunctionsStart = Offset;
+                break;
+
+            default:
+                break;
+        }
+
+        bool HasResult     = false;
+        bool HasResultType = false;
+        spv::HasResultAndType(static_cast<spv::Op>(OpCode), &HasResult, &HasResultType);
+        if (HasResult)
+        {
+            // Result id follows the result type, if the instruction has one
+            const uint32_t ResultIdx = HasResultType ? 2 : 1;
+            if (ResultIdx < WordCount && Instr[ResultIdx] < m_Ids.size())
+                m_Ids[Instr[ResultIdx]].DefOffset = Offset;
+        }
+    }
+}
+
+uint32_t SPIRVModuleIndex::GetOpCode(uint32_t Id) const
+{
+    const uint32_t DefOffset = GetDefinitionOffset(Id);
+    return DefOffset != InvalidOffset ? (m_pModule[DefOffset] & 0xFFFFu) : static_cast<uint32_t>(spv::OpNop);
+}
+
+SPIRVInstructionIterator SPIRVModuleIndex::GetDefinition(uint32_t Id) const
+{
+    const uint32_t DefOffset = GetDefinitionOffset(Id);
+    VERIFY(DefOffset != InvalidOffset, "Id ", Id, " is not defined");
+    return {m_pModule, m_ModuleSize, DefOffset != InvalidOffset ? DefOffset : m_ModuleSize};
+}
+
+const char* SPIRVModuleIndex::GetName(uint32_t Id) const
+{
+    if (Id >= m_Ids.size() || m_Ids[Id].NameOffset == InvalidOffset)
+        return nullptr;
+
+    const char* Name = reinterpret_cast<const char*>(&m_pModule[m_Ids[Id].NameOffset]);
+    return Name[0] != '\0' ? Name : nullptr;
+}
+
+uint32_t SPIRVModuleIndex::GetDecorationOffset(uint32_t Id, uint32_t Decoration) const
+{
+    if (Id >= m_Ids.size())
+        return InvalidOffset;
+
+    switch (Decoration)
+    {
+        // clang-format off
+        case spv::DecorationBinding:       return m_Ids[Id].BindingOffset;
+        case spv::DecorationDescriptorSet: return m_Ids[Id].DescriptorSetOffset;
+        case spv::DecorationLocation:      return m_Ids[Id].LocationOffset;
+        // clang-format on
+        default: break;
+    }
+
+    if (m_AnnotationsStart == InvalidOffset)
+        return InvalidOffset;
+
+    for (SPIRVInstructionIterator Instr{m_pModule, m_AnnotationsEnd, m_AnnotationsStart}, End{m_pModule, m_AnnotationsEnd, m_AnnotationsEnd}; Instr != End; ++Instr)
+    {
+        // OpDecorate | Target | Decoration | Literals...
+        const uint32_t OpCode = Instr.GetOpCode();
+        if ((OpCode == spv::OpDecorate || OpCode == spv::OpDecorateId) &&
+            Instr.GetWordCount() > 3 && Instr[1] == Id && Instr[2] == Decoration)
+        {
+            return static_cast<uint32_t>(Instr.GetOffset()) + 3;
+        }
+    }
+
+    return InvalidOffset;
+}
+
+const char* SPIRVModuleIndex::GetDecorationString(uint32_t Id, uint32_t Decoration) const
+{
+    if (m_AnnotationsStart == InvalidOffset)
+        return nullptr;
+
+    for (SPIRVInstructionIterator Instr{m_pModule, m_AnnotationsEnd, m_AnnotationsStart}, End{m_pModule, m_AnnotationsEnd, m_AnnotationsEnd}; Instr != End; ++Instr)
+    {
+        // OpDecorateString | Target | Decoration | String
+        if (Instr.GetOpCode() == spv::OpDecorateString &&
+            IsStringLiteralTerminated(Instr, 3) && Instr[1] == Id && Instr[2] == Decoration)
+        {
+            return reinterpret_cast<const char*>(&m_pModule[Instr.GetOffset() + 3]);
+        }
+    }
+
+    return nullptr;
+}
+
+uint32_t SPIRVModuleIndex::GetStorageClass(uint32_t VarId) const
+{
+    if (GetOpCode(VarId) != spv::OpVariable)
+        return ~0u;
+
+    // OpVariable | Result Type | Result | Storage Class
+    const SPIRVInstructionIterator Var = GetDefinition(VarId);
+    return Var.GetWordCount() > 3 ? Var[3] : ~0u;
+}
+
+uint32_t SPIRVModuleIndex::GetBaseTypeId(uint32_t VarId) const
+{
+    if (GetOpCode(VarId) != spv::OpVariable)
+        return 0;
+
+    // OpVariable | Result Type | Result | Storage Class
+    const uint32_t PointerTypeId = GetDefinition(VarId)[1];
+    if (GetOpCode(PointerTypeId) != spv::OpTypePointer)
+        return 0;
+
+    // OpTypePointer | Result | Storage Class | Type
+    const SPIRVInstructionIterator PointerType = GetDefinition(PointerTypeId);
+    if (PointerType.GetWordCount() <= 3)
+        return 0;
+
+    uint32_t TypeId = PointerType[3];
+    // Types are declared before they are used, so the loop always terminates in a valid module.
+    // The number of iterations is limited to handle malformed modules.
+    for (size_t i = 0; i < m_Ids.size(); ++i)
+    {
+        // OpTypeArray        | Result | Element Type | Length
+        // OpTypeRuntimeArray | Result | Element Type
+        const uint32_t OpCode = GetOpCode(TypeId);
+        if (OpCode != spv::OpTypeArray && OpCode != spv::OpTypeRuntimeArray)
+            break;
+
+        const SPIRVInstructionIterator ArrayType = GetDefinition(TypeId);
+        if (ArrayType.GetWordCount() <= 2)
+            return 0;
+        TypeId = ArrayType[2];
+    }
+
+    return TypeId;
+}
+
+bool SPIRVModuleIndex::IsGlobalVariable(uint32_t Id) const
+{
+    const uint32_t DefOffset = m_Ids[Id].DefOffset;
+    return DefOffset != InvalidOffset &&
+        (m_FunctionsStart == InvalidOffset || DefOffset < m_FunctionsStart) &&
+        (m_pModule[DefOffset] & 0xFFFFu) == spv::OpVariable;
+}
+
+} // namespace Diligent
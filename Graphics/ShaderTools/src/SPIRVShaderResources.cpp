@@ -34,6 +34,7 @@
 #include "StringTools.hpp"
 #include "Align.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "SPIRVUtils.hpp"
 
 namespace Diligent
 {
@@ -824,30 +825,7 @@ void SPIRVShaderResources::MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIR
     for (Uint32 i = 0; i < GetNumShaderStageInputs(); ++i)
     {
         const SPIRVShaderStageInputAttribs& Input = GetShaderStageInputAttribs(i);
-
-        const char*        s      = Input.Semantic;
-        static const char* Prefix = "attrib";
-        const char*        p      = Prefix;
-        while (*s != 0 && *p != 0 && *p == std::tolower(static_cast<unsigned char>(*s)))
-        {
-            ++p;
-            ++s;
-        }
-
-        if (*p != 0)
-        {
-            LOG_ERROR_MESSAGE("Unable to map semantic '", Input.Semantic, "' to input location: semantics must have '", Prefix, "x' format.");
-            continue;
-        }
-
-        char*    EndPtr   = nullptr;
-        uint32_t Location = static_cast<uint32_t>(strtol(s, &EndPtr, 10));
-        if (*EndPtr != 0)
-        {
-            LOG_ERROR_MESSAGE("Unable to map semantic '", Input.Semantic, "' to input location: semantics must have '", Prefix, "x' format.");
-            continue;
-        }
-        SPIRV[Input.LocationDecorationOffset] = Location;
+        MapHLSLVertexShaderInput(SPIRV, Input.Semantic, Input.LocationDecorationOffset);
     }
 }
 
@@ -25,9 +25,16 @@
  */
 
 #include "SPIRVUtils.hpp"
-#include "SPIRVShaderResources.hpp" // required for diligent_spirv_cross
 
-#include "spirv_cross.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <utility>
+
+#include "SPIRVModuleIndex.hpp"
+#include "Errors.hpp"
+
+#include "spirv.hpp"
 
 namespace Diligent
 {
@@ -95,64 +102,136 @@ static spv::ImageFormat TextureFormatToSpvImageFormat(TEXTURE_FORMAT Format)
     }
 }
 
-std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&                                SPIRV,
-                                        const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats)
+// Calls the handler for every storage image variable declared in the module
+template <typename HandlerType>
+static void ProcessStorageImages(const SPIRVModuleIndex& Index, HandlerType&& Handler)
 {
-    diligent_spirv_cross::Compiler Compiler{SPIRV};
+    Index.ProcessGlobalVariables([&](uint32_t VarId) {
+        if (Index.GetStorageClass(VarId) != spv::StorageClassUniformConstant)
+            return;
 
-    diligent_spirv_cross::ShaderResources resources = Compiler.get_shader_resources();
+        const uint32_t TypeId = Index.GetBaseTypeId(VarId);
+        if (Index.GetOpCode(TypeId) != spv::OpTypeImage)
+            return;
 
-    std::unordered_map<uint32_t, uint32_t> ImageTypeIdToFormat;
-    for (uint32_t i = 0; i < SPIRV.size(); ++i)
-    {
         // OpTypeImage
         //      0          1          2          3      4        5      6       7           8               9
         // |  OpCode  | Result | Sampled Type | Dim | Depth | Arrayed | MS | Sampled | Image Format | Access Qualifier
+        const SPIRVInstructionIterator ImageType = Index.GetDefinition(TypeId);
+        if (ImageType.GetWordCount() < 9)
+            return;
+
+        // Sampled == 2 indicates an image that is used without a sampler
+        const uint32_t Dim = ImageType[3];
+        if (ImageType[7] == 2 && Dim != spv::DimBuffer && Dim != spv::DimSubpassData)
+            Handler(VarId, ImageType);
+    });
+}
+
+void PatchImageFormats(std::vector<uint32_t>&                                      SPIRV,
+                       const SPIRVModuleIndex&                                     Index,
+                       const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats)
+{
+    // Images may share the same type. Original formats of the patched types are
+    // kept to detect inconsistent format specifiers.
+    std::vector<std::pair<uint32_t, uint32_t>> PatchedTypes;
+
+    ProcessStorageImages(Index, [&](uint32_t VarId, const SPIRVInstructionIterator& ImageType) {
+        const uint32_t Dim = ImageType[3];
+        if (Dim != spv::Dim1D && Dim != spv::Dim2D && Dim != spv::Dim3D)
+            return;
+
+        const char* Name = Index.GetName(VarId);
+        if (Name == nullptr)
+            return;
+
+        auto FormatIt = ImageFormats.find(HashMapStringKey{Name});
+        if (FormatIt == ImageFormats.end())
+            return;
+
+        const spv::ImageFormat spvFormat = TextureFormatToSpvImageFormat(FormatIt->second);
+        if (spvFormat == spv::ImageFormatUnknown)
+            return;
+
         constexpr uint32_t ImageFormatOffset = 8;
 
-        uint32_t OpCode = SPIRV[i] & 0xFFFF;
-        if (OpCode == spv::OpTypeImage && i + ImageFormatOffset < SPIRV.size())
+        const uint32_t ImageTypeId = ImageType[1];
+        uint32_t&      FormatWord  = SPIRV[ImageType.GetOffset() + ImageFormatOffset];
+
+        auto PatchedTypeIt = std::find_if(PatchedTypes.begin(), PatchedTypes.end(),
+                                          [ImageTypeId](const std::pair<uint32_t, uint32_t>& Type) { return Type.first == ImageTypeId; });
+        if (PatchedTypeIt == PatchedTypes.end())
         {
-            const uint32_t ImageTypeId       = SPIRV[i + 1];
-            ImageTypeIdToFormat[ImageTypeId] = i + ImageFormatOffset;
+            PatchedTypes.emplace_back(ImageTypeId, FormatWord);
         }
+        else if (FormatWord != PatchedTypeIt->second && FormatWord != static_cast<uint32_t>(spvFormat))
+        {
+            LOG_ERROR_MESSAGE("Inconsistent formats encountered while patching format for image '", Name,
+                              "'.\nThis likely is the result of the same-format textures using inconsistent format specifiers in HLSL, for example:"
+                              "\n  RWTexture2D<float4/*format=rgba32f>  g_RWTex1;"
+                              "\n  RWTexture2D<float4/*format=rgba32ui> g_RWTex2;");
+        }
+        FormatWord = spvFormat;
+    });
+}
+
+std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&                                SPIRV,
+                                        const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats)
+{
+    std::vector<uint32_t>  PatchedSPIRV = SPIRV;
+    const SPIRVModuleIndex Index{PatchedSPIRV};
+    PatchImageFormats(PatchedSPIRV, Index, ImageFormats);
+    return PatchedSPIRV;
+}
+
+bool HasStorageImages(const SPIRVModuleIndex& Index)
+{
+    bool Found = false;
+    ProcessStorageImages(Index, [&Found](uint32_t, const SPIRVInstructionIterator&) { Found = true; });
+    return Found;
+}
+
+void MapHLSLVertexShaderInput(std::vector<uint32_t>& SPIRV, const char* Semantic, uint32_t LocationDecorationOffset)
+{
+    const char*        s      = Semantic;
+    static const char* Prefix = "attrib";
+    const char*        p      = Prefix;
+    while (*s != 0 && *p != 0 && *p == std::tolower(static_cast<unsigned char>(*s)))
+    {
+        ++p;
+        ++s;
     }
 
-    std::vector<uint32_t> PatchedSPIRV = SPIRV;
-    for (const diligent_spirv_cross::Resource& Img : resources.storage_images)
+    if (*p != 0)
     {
-        const diligent_spirv_cross::SPIRType& type = Compiler.get_type(Img.type_id);
-        if (type.image.dim == spv::Dim1D ||
-            type.image.dim == spv::Dim2D ||
-            type.image.dim == spv::Dim3D)
-        {
-            auto FormatIt = ImageFormats.find(HashMapStringKey{Img.name.c_str()});
-            if (FormatIt != ImageFormats.end())
-            {
-                auto spvFormat = TextureFormatToSpvImageFormat(FormatIt->second);
-                if (spvFormat != spv::ImageFormatUnknown)
-                {
-                    auto FormatOffsetIt = ImageTypeIdToFormat.find(Img.base_type_id);
-                    if (FormatOffsetIt != ImageTypeIdToFormat.end())
-                    {
-                        const uint32_t ImageFormatOffset = FormatOffsetIt->second;
-                        uint32_t&      FormatWord        = PatchedSPIRV[ImageFormatOffset];
-                        if (FormatWord != static_cast<uint32_t>(type.image.format) &&
-                            FormatWord != static_cast<uint32_t>(spvFormat))
-                        {
-                            LOG_ERROR_MESSAGE("Inconsistent formats encountered while patching format for image '", Img.name,
-                                              "'.\nThis likely is the result of the same-format textures using inconsistent format specifiers in HLSL, for example:"
-                                              "\n  RWTexture2D<float4/*format=rgba32f>  g_RWTex1;"
-                                              "\n  RWTexture2D<float4/*format=rgba32ui> g_RWTex2;");
-                        }
-                        FormatWord = spvFormat;
-                    }
-                }
-            }
-        }
+        LOG_ERROR_MESSAGE("Unable to map semantic '", Semantic, "' to input location: semantics must have '", Prefix, "x' format.");
+        return;
     }
 
-    return PatchedSPIRV;
+    char*    EndPtr   = nullptr;
+    uint32_t Location = static_cast<uint32_t>(strtol(s, &EndPtr, 10));
+    if (*EndPtr != 0)
+    {
+        LOG_ERROR_MESSAGE("Unable to map semantic '", Semantic, "' to input location: semantics must have '", Prefix, "x' format.");
+        return;
+    }
+    SPIRV[LocationDecorationOffset] = Location;
+}
+
+void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV, const SPIRVModuleIndex& Index)
+{
+    Index.ProcessGlobalVariables([&](uint32_t VarId) {
+        if (Index.GetStorageClass(VarId) != spv::StorageClassInput)
+            return;
+
+        // Built-in inputs (e.g. SV_VertexID) have semantics, but no locations
+        const uint32_t LocationOffset = Index.GetDecorationOffset(VarId, spv::DecorationLocation);
+        if (LocationOffset == SPIRVModuleIndex::InvalidOffset)
+            return;
+
+        if (const char* Semantic = Index.GetDecorationString(VarId, spv::DecorationHlslSemanticGOOGLE))
+            MapHLSLVertexShaderInput(SPIRV, Semantic, LocationOffset);
+    });
 }
 
 } // namespace Diligent
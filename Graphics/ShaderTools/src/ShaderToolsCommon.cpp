@@ -471,6 +471,24 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
+bool FindShaderIncludes(const char*                                    Source,
+                        size_t                                         SourceLength,
+                        const std::function<void(const std::string&)>& IncludeHandler,
+                        std::string*                                   pError) noexcept
+{
+    return FindIncludes(
+        Source, SourceLength,
+        [&](const std::string& FilePath, size_t Start, size_t End) //
+        {
+            IncludeHandler(FilePath);
+        },
+        [pError](const std::string& Error) //
+        {
+            if (pError != nullptr)
+                *pError = Error;
+        });
+}
+
 static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
 {
     const auto SourceData = ReadShaderSourceFile(ShaderCI);
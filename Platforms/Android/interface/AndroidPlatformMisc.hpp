@@ -39,6 +39,15 @@ struct AndroidMisc : public LinuxMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Sets the current thread affinity to the given set of logical processors.
+    /// Returns true on success and false on failure.
+    static bool SetCurrentThreadAffinity(const ProcessorSet& Processors);
+
+    static CPUTopology GetCPUTopology()
+    {
+        return BasicPlatformMisc::GetCPUTopology();
+    }
 };
 
 } // namespace Diligent
@@ -34,4 +34,9 @@ Uint64 AndroidMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+bool AndroidMisc::SetCurrentThreadAffinity(const ProcessorSet& Processors)
+{
+    return false;
+}
+
 } // namespace Diligent
@@ -37,6 +37,12 @@ namespace Diligent
 struct AppleMisc : public LinuxMisc
 {
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+    static bool   SetCurrentThreadAffinity(const ProcessorSet& Processors);
+
+    static CPUTopology GetCPUTopology()
+    {
+        return BasicPlatformMisc::GetCPUTopology();
+    }
 };
 
 } // namespace Diligent
@@ -35,4 +35,9 @@ Uint64 AppleMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+bool AppleMisc::SetCurrentThreadAffinity(const ProcessorSet& Processors)
+{
+    return false;
+}
+
 } // namespace Diligent
@@ -27,6 +27,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "../../../Primitives/interface/BasicTypes.h"
 
 namespace Diligent
@@ -42,6 +45,165 @@ enum class ThreadPriority
     Highest
 };
 
+/// Set of logical processors of arbitrary size.
+
+/// Unlike a 64-bit affinity mask, the set can address any number of
+/// logical processors, which is required on systems with more than 64 hardware threads.
+class ProcessorSet
+{
+public:
+    ProcessorSet() = default;
+
+    /// Initializes the set from the 64-bit mask of processors 0-63.
+    explicit ProcessorSet(Uint64 Mask)
+    {
+        if (Mask != 0)
+            m_Words.push_back(Mask);
+    }
+
+    /// Adds the processor to the set.
+    void Set(Uint32 Processor)
+    {
+        const size_t Word = Processor / 64;
+        if (Word >= m_Words.size())
+            m_Words.resize(Word + 1, 0);
+        m_Words[Word] |= Uint64{1} << (Processor % 64);
+    }
+
+    /// Removes the processor from the set.
+    void Reset(Uint32 Processor)
+    {
+        const size_t Word = Processor / 64;
+        if (Word < m_Words.size())
+            m_Words[Word] &= ~(Uint64{1} << (Processor % 64));
+    }
+
+    /// Adds all processors from another set to this set.
+    ProcessorSet& operator|=(const ProcessorSet& Other)
+    {
+        if (Other.m_Words.size() > m_Words.size())
+            m_Words.resize(Other.m_Words.size(), 0);
+        for (size_t i = 0; i < Other.m_Words.size(); ++i)
+            m_Words[i] |= Other.m_Words[i];
+        return *this;
+    }
+
+    /// Checks if the processor is in the set.
+    bool IsSet(Uint32 Processor) const
+    {
+        const size_t Word = Processor / 64;
+        return Word < m_Words.size() && (m_Words[Word] & (Uint64{1} << (Processor % 64))) != 0;
+    }
+
+    /// Returns the number of processors in the set.
+    Uint32 Count() const
+    {
+        Uint32 NumProcessors = 0;
+        for (Uint64 Word : m_Words)
+        {
+            for (; Word != 0; Word &= Word - 1)
+                ++NumProcessors;
+        }
+        return NumProcessors;
+    }
+
+    /// Returns true if the set contains no processors.
+    bool IsEmpty() const
+    {
+        for (Uint64 Word : m_Words)
+        {
+            if (Word != 0)
+                return false;
+        }
+        return true;
+    }
+
+    /// Returns the index of the first processor in the set that is greater than or
+    /// equal to StartProcessor, or ~0u if there is no such processor.
+    Uint32 FindNext(Uint32 StartProcessor = 0) const
+    {
+        for (size_t Word = StartProcessor / 64; Word < m_Words.size(); ++Word)
+        {
+            Uint64 Bits = m_Words[Word];
+            if (Word == StartProcessor / 64)
+                Bits &= ~Uint64{0} << (StartProcessor % 64);
+            for (Uint32 Bit = 0; Bits != 0; ++Bit, Bits >>= 1)
+            {
+                if (Bits & 1)
+                    return static_cast<Uint32>(Word * 64 + Bit);
+            }
+        }
+        return ~0u;
+    }
+
+    /// Returns the mask of processors 0-63.
+    Uint64 GetMask64() const
+    {
+        return !m_Words.empty() ? m_Words[0] : 0;
+    }
+
+    /// Returns the 64-bit words of the set, where bit j of word i corresponds to processor i*64 + j.
+    const std::vector<Uint64>& GetWords() const
+    {
+        return m_Words;
+    }
+
+    bool operator==(const ProcessorSet& Other) const
+    {
+        const size_t NumWords = std::max(m_Words.size(), Other.m_Words.size());
+        for (size_t i = 0; i < NumWords; ++i)
+        {
+            const Uint64 Word0 = i < m_Words.size() ? m_Words[i] : 0;
+            const Uint64 Word1 = i < Other.m_Words.size() ? Other.m_Words[i] : 0;
+            if (Word0 != Word1)
+                return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const ProcessorSet& Other) const
+    {
+        return !(*this == Other);
+    }
+
+private:
+    std::vector<Uint64> m_Words;
+};
+
+/// CPU topology information.
+struct CPUTopology
+{
+    /// Logical processor information.
+    struct Processor
+    {
+        /// Operating system index of the logical processor.
+        Uint32 Id = 0;
+
+        /// Index of the physical core the processor belongs to.
+        /// Logical processors of the same core are SMT siblings.
+        Uint32 CoreId = 0;
+
+        /// Index of the group of cores that share the same last-level (L3) cache,
+        /// e.g. the CCX on AMD processors.
+        Uint32 L3DomainId = 0;
+
+        /// Index of the NUMA node the processor belongs to.
+        Uint32 NUMANodeId = 0;
+    };
+
+    /// Online logical processors sorted by Id.
+    std::vector<Processor> Processors;
+
+    /// The number of physical cores. Core indices are in the range [0, NumCores).
+    Uint32 NumCores = 0;
+
+    /// The number of L3 domains. Domain indices are in the range [0, NumL3Domains).
+    Uint32 NumL3Domains = 0;
+
+    /// The number of NUMA nodes. Node indices are in the range [0, NumNUMANodes).
+    Uint32 NumNUMANodes = 0;
+};
+
 struct BasicPlatformMisc
 {
     template <typename Type>
@@ -110,6 +272,17 @@ struct BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
 
+    /// Sets the current thread affinity to the given set of logical processors.
+    /// Returns true on success and false on failure.
+    static bool SetCurrentThreadAffinity(const ProcessorSet& Processors);
+
+    /// Returns the CPU topology.
+    ///
+    /// \remarks   The base implementation reports std::thread::hardware_concurrency()
+    ///             logical processors, each being a separate core, that share
+    ///             a single L3 domain and NUMA node.
+    static CPUTopology GetCPUTopology();
+
 private:
     static void SwapBytes16(Uint16& Val)
     {
@@ -25,6 +25,9 @@
  */
 
 #include "BasicPlatformMisc.hpp"
+
+#include <thread>
+
 #include "DebugUtilities.hpp"
 
 namespace Diligent
@@ -48,4 +51,29 @@ Uint64 BasicPlatformMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+bool BasicPlatformMisc::SetCurrentThreadAffinity(const ProcessorSet& Processors)
+{
+    LOG_WARNING_MESSAGE_ONCE("SetCurrentThreadAffinity is not implemented on this platform.");
+    return false;
+}
+
+CPUTopology BasicPlatformMisc::GetCPUTopology()
+{
+    CPUTopology Topology;
+
+    const Uint32 NumProcessors = std::max(std::thread::hardware_concurrency(), 1u);
+    Topology.Processors.resize(NumProcessors);
+    for (Uint32 i = 0; i < NumProcessors; ++i)
+    {
+        CPUTopology::Processor& Proc{Topology.Processors[i]};
+        Proc.Id     = i;
+        Proc.CoreId = i;
+    }
+    Topology.NumCores     = NumProcessors;
+    Topology.NumL3Domains = 1;
+    Topology.NumNUMANodes = 1;
+
+    return Topology;
+}
+
 } // namespace Diligent
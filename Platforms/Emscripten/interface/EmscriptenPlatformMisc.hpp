@@ -33,6 +33,11 @@ namespace Diligent
 {
 
 struct EmscriptenMisc : public LinuxMisc
-{};
+{
+    static CPUTopology GetCPUTopology()
+    {
+        return BasicPlatformMisc::GetCPUTopology();
+    }
+};
 
 } // namespace Diligent
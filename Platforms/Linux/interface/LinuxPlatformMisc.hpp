@@ -111,6 +111,20 @@ struct LinuxMisc : public BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Sets the current thread affinity to the given set of logical processors.
+    /// Returns true on success and false on failure.
+    static bool SetCurrentThreadAffinity(const ProcessorSet& Processors);
+
+    /// Returns the CPU topology read from sysfs.
+    ///
+    /// \param [in] SysfsPath - Path to the sysfs system devices directory.
+    ///
+    /// \remarks   SMT siblings are identified by the core_cpus_list (or thread_siblings_list) files,
+    ///             L3 domains by the shared_cpu_list of the level-3 cache, and NUMA nodes
+    ///             by the node cpulist files. If the topology information is not available,
+    ///             the function falls back to BasicPlatformMisc::GetCPUTopology().
+    static CPUTopology GetCPUTopology(const char* SysfsPath = "/sys/devices/system");
 };
 
 } // namespace Diligent
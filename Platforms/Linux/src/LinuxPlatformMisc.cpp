@@ -27,6 +27,13 @@
 #include "LinuxPlatformMisc.hpp"
 
 #include <pthread.h>
+#include <sched.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
 
 namespace Diligent
 {
@@ -60,4 +67,192 @@ Uint64 LinuxMisc::SetCurrentThreadAffinity(Uint64 Mask)
         return 0;
 }
 
+bool LinuxMisc::SetCurrentThreadAffinity(const ProcessorSet& Processors)
+{
+    if (Processors.IsEmpty())
+        return false;
+
+    const size_t NumCPUs = Processors.GetWords().size() * 64;
+    cpu_set_t*   pCPUSet = CPU_ALLOC(NumCPUs);
+    if (pCPUSet == nullptr)
+        return false;
+
+    const size_t CPUSetSize = CPU_ALLOC_SIZE(NumCPUs);
+    CPU_ZERO_S(CPUSetSize, pCPUSet);
+    for (Uint32 CPU = Processors.FindNext(0); CPU != ~0u; CPU = Processors.FindNext(CPU + 1))
+    {
+        CPU_SET_S(CPU, CPUSetSize, pCPUSet);
+    }
+
+    const bool Res = pthread_setaffinity_np(pthread_self(), CPUSetSize, pCPUSet) == 0;
+    CPU_FREE(pCPUSet);
+
+    return Res;
+}
+
+namespace
+{
+
+bool ReadSysfsFile(const std::string& Path, std::string& Contents)
+{
+    std::ifstream File{Path};
+    if (!File)
+        return false;
+
+    std::stringstream Stream;
+    Stream << File.rdbuf();
+    Contents = Stream.str();
+    return true;
+}
+
+// Parses the CPU list in the sysfs format, e.g. "0-3,8,10-11"
+ProcessorSet ParseCPUList(const std::string& List)
+{
+    ProcessorSet CPUs;
+
+    const char* Pos = List.c_str();
+    while (*Pos != '\0')
+    {
+        if (*Pos < '0' || *Pos > '9')
+        {
+            ++Pos;
+            continue;
+        }
+
+        char*               End   = nullptr;
+        const unsigned long First = strtoul(Pos, &End, 10);
+        unsigned long       Last  = First;
+        Pos                       = End;
+        if (*Pos == '-')
+        {
+            Last = strtoul(Pos + 1, &End, 10);
+            Pos  = End;
+        }
+
+        for (unsigned long CPU = First; CPU <= Last; ++CPU)
+            CPUs.Set(static_cast<Uint32>(CPU));
+    }
+
+    return CPUs;
+}
+
+bool ReadCPUList(const std::string& Path, ProcessorSet& CPUs)
+{
+    std::string List;
+    if (!ReadSysfsFile(Path, List))
+        return false;
+
+    CPUs = ParseCPUList(List);
+    return !CPUs.IsEmpty();
+}
+
+// Assigns dense indices to arbitrary keys in the order of their first appearance
+class DenseIndexMap
+{
+public:
+    Uint32 operator()(Uint32 Key)
+    {
+        return m_Indices.emplace(Key, static_cast<Uint32>(m_Indices.size())).first->second;
+    }
+
+    Uint32 GetCount() const
+    {
+        return static_cast<Uint32>(m_Indices.size());
+    }
+
+private:
+    std::unordered_map<Uint32, Uint32> m_Indices;
+};
+
+} // namespace
+
+CPUTopology LinuxMisc::GetCPUTopology(const char* SysfsPath)
+{
+    const std::string CPUPath = std::string{SysfsPath} + "/cpu/";
+
+    ProcessorSet OnlineCPUs;
+    if (!ReadCPUList(CPUPath + "online", OnlineCPUs))
+        return BasicPlatformMisc::GetCPUTopology();
+
+    // Map every CPU to its NUMA node. Nodes are indexed in the ascending order of their ids.
+    std::unordered_map<Uint32, Uint32> CPUToNode;
+    DenseIndexMap                      NUMANodeIndices;
+    {
+        const std::string NodePath = std::string{SysfsPath} + "/node/";
+
+        ProcessorSet Nodes;
+        if (ReadCPUList(NodePath + "online", Nodes))
+        {
+            for (Uint32 Node = Nodes.FindNext(0); Node != ~0u; Node = Nodes.FindNext(Node + 1))
+            {
+                ProcessorSet NodeCPUs;
+                if (!ReadCPUList(NodePath + "node" + std::to_string(Node) + "/cpulist", NodeCPUs))
+                    continue;
+
+                NUMANodeIndices(Node);
+                for (Uint32 CPU = NodeCPUs.FindNext(0); CPU != ~0u; CPU = NodeCPUs.FindNext(CPU + 1))
+                    CPUToNode.emplace(CPU, Node);
+            }
+        }
+    }
+
+    // CPUs that are not listed by any node form a separate node. Using an id that no real
+    // node can have prevents them from being merged into a node that may not even exist.
+    constexpr Uint32 UnknownNode = ~0u;
+
+    CPUTopology   Topology;
+    DenseIndexMap CoreIndices;
+    DenseIndexMap L3DomainIndices;
+    for (Uint32 CPU = OnlineCPUs.FindNext(0); CPU != ~0u; CPU = OnlineCPUs.FindNext(CPU + 1))
+    {
+        const std::string CPUDir = CPUPath + "cpu" + std::to_string(CPU);
+
+        // SMT siblings share the core. The lowest sibling index is used as the core key.
+        ProcessorSet Siblings;
+        if (!ReadCPUList(CPUDir + "/topology/core_cpus_list", Siblings) &&
+            !ReadCPUList(CPUDir + "/topology/thread_siblings_list", Siblings))
+        {
+            Siblings.Set(CPU);
+        }
+
+        // Cores that share the last-level cache form an L3 domain. If there is no L3 cache,
+        // use the highest-level cache available.
+        Uint32 L3DomainKey = 0;
+        {
+            int CacheLevel = 0;
+            for (Uint32 Index = 0;; ++Index)
+            {
+                const std::string IndexDir = CPUDir + "/cache/index" + std::to_string(Index);
+
+                std::string Level;
+                if (!ReadSysfsFile(IndexDir + "/level", Level))
+                    break;
+
+                ProcessorSet SharedCPUs;
+                const int    LevelVal = atoi(Level.c_str());
+                if (LevelVal > CacheLevel && LevelVal <= 3 && ReadCPUList(IndexDir + "/shared_cpu_list", SharedCPUs))
+                {
+                    CacheLevel  = LevelVal;
+                    L3DomainKey = SharedCPUs.FindNext(0);
+                }
+            }
+        }
+
+        const auto NodeIt = CPUToNode.find(CPU);
+
+        CPUTopology::Processor Proc;
+        Proc.Id         = CPU;
+        Proc.CoreId     = CoreIndices(Siblings.FindNext(0));
+        Proc.L3DomainId = L3DomainIndices(L3DomainKey);
+        Proc.NUMANodeId = NUMANodeIndices(NodeIt != CPUToNode.end() ? NodeIt->second : UnknownNode);
+        Topology.Processors.push_back(Proc);
+    }
+
+    Topology.NumCores     = CoreIndices.GetCount();
+    Topology.NumL3Domains = L3DomainIndices.GetCount();
+    Topology.NumNUMANodes = NUMANodeIndices.GetCount();
+
+    return Topology;
+}
+
 } // namespace Diligent
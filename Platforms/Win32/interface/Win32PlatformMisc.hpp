@@ -168,6 +168,14 @@ struct WindowsMisc : public BasicPlatformMisc
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
 
+    /// Sets the current thread affinity to the given set of logical processors.
+    /// Returns true on success and false on failure.
+    ///
+    /// \remarks   Processors are numbered consecutively across processor groups.
+    ///             Since a thread can only run on processors of one group, the affinity
+    ///             is set to the processors of the first group that intersects the set.
+    static bool SetCurrentThreadAffinity(const ProcessorSet& Processors);
+
     static ThreadPriority GetCurrentThreadPriority();
 
     /// Sets the current thread priority and on success returns the previous priority.
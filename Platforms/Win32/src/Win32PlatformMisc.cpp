@@ -39,6 +39,36 @@ Uint64 WindowsMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return SetThreadAffinityMask(hCurrThread, static_cast<DWORD_PTR>(Mask));
 }
 
+bool WindowsMisc::SetCurrentThreadAffinity(const ProcessorSet& Processors)
+{
+    const WORD NumGroups = GetActiveProcessorGroupCount();
+
+    Uint32 FirstGroupProcessor = 0;
+    for (WORD Group = 0; Group < NumGroups; ++Group)
+    {
+        const Uint32 NumGroupProcessors = std::min(Uint32{GetActiveProcessorCount(Group)}, Uint32{sizeof(KAFFINITY) * 8});
+
+        KAFFINITY Mask = 0;
+        for (Uint32 i = 0; i < NumGroupProcessors; ++i)
+        {
+            if (Processors.IsSet(FirstGroupProcessor + i))
+                Mask |= KAFFINITY{1} << i;
+        }
+
+        if (Mask != 0)
+        {
+            GROUP_AFFINITY Affinity{};
+            Affinity.Mask  = Mask;
+            Affinity.Group = Group;
+            return SetThreadGroupAffinity(GetCurrentThread(), &Affinity, nullptr) != FALSE;
+        }
+
+        FirstGroupProcessor += NumGroupProcessors;
+    }
+
+    return false;
+}
+
 
 static ThreadPriority WndPriorityToThreadPiority(int priority)
 {
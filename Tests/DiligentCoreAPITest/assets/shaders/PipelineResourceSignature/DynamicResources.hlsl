@@ -0,0 +1,56 @@
+Texture2D g_Tex2DArr_Dyn[TEX_ARRAY_SIZE];
+
+SamplerState g_Sampler;
+
+cbuffer g_RefColors
+{
+    float4 g_TexRef[TEX_ARRAY_SIZE];
+}
+
+float4 CheckValue(float4 Val, float4 Expected)
+{
+    return float4(Val.x == Expected.x ? 1.0 : 0.0,
+                  Val.y == Expected.y ? 1.0 : 0.0,
+                  Val.z == Expected.z ? 1.0 : 0.0,
+                  Val.w == Expected.w ? 1.0 : 0.0);
+}
+
+float4 VerifyResources()
+{
+    float4 AllCorrect = float4(1.0, 1.0, 1.0, 1.0);
+
+    float2 UV = float2(0.5, 0.5);
+
+    AllCorrect *= CheckValue(g_Tex2DArr_Dyn[0].SampleLevel(g_Sampler, UV.xy, 0.0), g_TexRef[0]);
+    AllCorrect *= CheckValue(g_Tex2DArr_Dyn[1].SampleLevel(g_Sampler, UV.xy, 0.0), g_TexRef[1]);
+    AllCorrect *= CheckValue(g_Tex2DArr_Dyn[2].SampleLevel(g_Sampler, UV.xy, 0.0), g_TexRef[2]);
+
+    return AllCorrect;
+}
+
+void VSMain(in  uint    VertId    : SV_VertexID,
+            out float4 f4Color    : COLOR,
+            out float4 f4Position : SV_Position)
+{
+    float4 Pos[6];
+    Pos[0] = float4(-1.0, -0.5, 0.0, 1.0);
+    Pos[1] = float4(-0.5, +0.5, 0.0, 1.0);
+    Pos[2] = float4( 0.0, -0.5, 0.0, 1.0);
+
+    Pos[3] = float4(+0.0, -0.5, 0.0, 1.0);
+    Pos[4] = float4(+0.5, +0.5, 0.0, 1.0);
+    Pos[5] = float4(+1.0, -0.5, 0.0, 1.0);
+
+    f4Color = float4(VertId % 3 == 0 ? 1.0 : 0.0,
+                     VertId % 3 == 1 ? 1.0 : 0.0,
+                     VertId % 3 == 2 ? 1.0 : 0.0,
+                     1.0) * VerifyResources();
+
+    f4Position = Pos[VertId];
+}
+
+float4 PSMain(in float4 in_f4Color : COLOR,
+              in float4 f4Position : SV_Position) : SV_Target
+{
+    return in_f4Color * VerifyResources();
+}
@@ -31,6 +31,7 @@
 #include <thread>
 #include <random>
 #include <vector>
+#include <string>
 
 #include "ShaderMacroHelper.hpp"
 #include "Timer.hpp"
@@ -232,4 +233,90 @@ TEST(Shader, AsyncPipeline_AsyncShaders)
     TestAsyncPipeline(SHADER_COMPILE_FLAG_ASYNCHRONOUS, PSO_CREATE_FLAG_ASYNCHRONOUS);
 }
 
+void TestPipelineBatch(SHADER_COMPILE_FLAGS ShaderFlags)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    IRenderDevice* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.AsyncShaderCompilation)
+        ShaderFlags = SHADER_COMPILE_FLAG_NONE;
+
+    constexpr bool SimplifiedShader = true;
+
+    auto pVS = CreateShader("AsyncShaderCompilationTest.vsh", "Pipeline batch test VS", SHADER_TYPE_VERTEX, ShaderFlags, SimplifiedShader);
+    ASSERT_NE(pVS, nullptr);
+
+    InputLayoutDescX InputLayout;
+    InputLayout.Add(0u, 0u, 3u, VT_FLOAT32, False);
+
+    PipelineResourceLayoutDescX ResourceLayout;
+    ResourceLayout.AddVariable(SHADER_TYPE_PIXEL, "g_Tex2D", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    constexpr Uint32 NumPipelines = 16;
+
+    std::vector<RefCntAutoPtr<IShader>>           PixelShaders;
+    std::vector<GraphicsPipelineStateCreateInfoX> PSOCreateInfos(NumPipelines);
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        // Every other pipeline reuses the previous pixel shader, so that
+        // the batch contains pipelines with identical shader stages.
+        if (i % 2 == 0)
+        {
+            auto pPS = CreateShader("AsyncShaderCompilationTest.psh", "Pipeline batch test PS", SHADER_TYPE_PIXEL, ShaderFlags, SimplifiedShader);
+            ASSERT_NE(pPS, nullptr);
+            PixelShaders.emplace_back(std::move(pPS));
+        }
+
+        const std::string Name = "Pipeline batch test PSO " + std::to_string(i);
+        PSOCreateInfos[i]
+            .SetName(Name.c_str())
+            .AddShader(pVS)
+            .AddShader(PixelShaders.back())
+            .AddRenderTarget(TEX_FORMAT_RGBA8_UNORM)
+            .SetInputLayout(InputLayout)
+            .SetResourceLayout(ResourceLayout)
+            .SetFlags(i % 4 == 3 ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE);
+    }
+
+    std::vector<const PipelineStateCreateInfo*> pCreateInfos;
+    for (const auto& CI : PSOCreateInfos)
+        pCreateInfos.push_back(&CI);
+
+    std::vector<IPipelineState*> ppPSOs(NumPipelines);
+    pDevice->CreatePipelineStates(pCreateInfos.data(), NumPipelines, ppPSOs.data());
+
+    std::vector<RefCntAutoPtr<IPipelineState>> pPSOs(NumPipelines);
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+        pPSOs[i].Attach(ppPSOs[i]);
+
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        ASSERT_NE(pPSOs[i], nullptr);
+        EXPECT_STREQ(pPSOs[i]->GetDesc().Name, PSOCreateInfos[i].PSODesc.Name);
+        if ((PSOCreateInfos[i].Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0)
+        {
+            // Synchronous pipelines must be ready when the method returns
+            EXPECT_EQ(pPSOs[i]->GetStatus(), PIPELINE_STATE_STATUS_READY);
+        }
+        else
+        {
+            EXPECT_EQ(pPSOs[i]->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+        }
+    }
+
+    // Pipelines that use identical shaders must be compatible
+    for (Uint32 i = 0; i + 1 < NumPipelines; i += 2)
+        EXPECT_TRUE(pPSOs[i]->IsCompatibleWith(pPSOs[i + 1]));
+}
+
+TEST(Shader, PipelineBatch_SyncShaders)
+{
+    TestPipelineBatch(SHADER_COMPILE_FLAG_NONE);
+}
+
+TEST(Shader, PipelineBatch_AsyncShaders)
+{
+    TestPipelineBatch(SHADER_COMPILE_FLAG_ASYNCHRONOUS);
+}
+
 } // namespace
@@ -33,6 +33,7 @@
 #include "ShaderMacroHelper.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ResourceLayoutTestCommon.hpp"
+#include "MapHelper.hpp"
 
 #if VULKAN_SUPPORTED
 #    include "Vulkan/TestingEnvironmentVk.hpp"
@@ -2031,4 +2032,340 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+// Dynamic resources are written to the descriptor set when the SRB is committed. In Vulkan, the whole
+// dynamic set is written with a descriptor update template when all of its resources are bound.
+TEST_F(PipelineResourceSignatureTest, DynamicResources)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    if (pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "Separate samplers are not supported in OpenGL";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    float ClearColor[] = {0.25, 0.625, 0.375, 0.875};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    static constexpr Uint32 TexArraySize = 3;
+
+    // The first draw uses textures 0, 1, 2. The second draw replaces array element 1 with texture 3.
+    ReferenceTextures RefTextures{
+        TexArraySize + 1,
+        128, 128,
+        USAGE_DEFAULT,
+        BIND_SHADER_RESOURCE,
+        TEXTURE_VIEW_SHADER_RESOURCE //
+    };
+
+    std::array<float4, TexArraySize + 1> RefColors;
+    for (size_t i = 0; i < RefColors.size(); ++i)
+        RefColors[i] = RefTextures.GetColor(i);
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TEX_ARRAY_SIZE", static_cast<int>(TexArraySize));
+
+    auto ModifyShaderCI = [pEnv](ShaderCreateInfo& ShaderCI) {
+        if (pEnv->NeedWARPResourceArrayIndexingBugWorkaround())
+        {
+            // Shader resource array indexing always references array element 0 in D3D12 WARP
+            // when shaders are compiled with shader model 5.1.
+            ShaderCI.ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            ShaderCI.HLSLVersion    = ShaderVersion{5, 0};
+        }
+        ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+    };
+
+    auto pVS = CreateShaderFromFile(SHADER_TYPE_VERTEX, "DynamicResources.hlsl", "VSMain", "PRS dynamic resources test: VS", Macros, ModifyShaderCI);
+    auto pPS = CreateShaderFromFile(SHADER_TYPE_PIXEL, "DynamicResources.hlsl", "PSMain", "PRS dynamic resources test: PS", Macros, ModifyShaderCI);
+    ASSERT_TRUE(pVS && pPS);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Dynamic resources test";
+
+    // All resources are dynamic so that they are all placed in the dynamic descriptor set.
+    // The sampler is immutable and is never written to the set.
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_VS_PS, "g_RefColors",    1,            SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Dyn", TexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VS_PS, "g_Sampler",      1,            SHADER_RESOURCE_TYPE_SAMPLER,         SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    ImmutableSamplerDesc ImmutableSamplers[] = //
+        {
+            {SHADER_TYPE_VS_PS, "g_Sampler", SamplerDesc{}} //
+        };
+    PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+    PRSDesc.UseCombinedTextureSamplers = false;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    auto pPSO = CreateGraphicsPSO(pVS, pPS, {pPRS});
+    ASSERT_TRUE(pPSO);
+
+    // Dynamic buffer that is bound to the set with a dynamic offset
+    RefCntAutoPtr<IBuffer> pRefColorsCB;
+    {
+        BufferDesc BuffDesc{"Reference colors", sizeof(float4) * TexArraySize, BIND_UNIFORM_BUFFER, USAGE_DYNAMIC, CPU_ACCESS_WRITE};
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pRefColorsCB);
+        ASSERT_TRUE(pRefColorsCB);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_Sampler"), nullptr);
+
+    SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_RefColors", Set, pRefColorsCB);
+    SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2DArr_Dyn", SetArray, RefTextures.GetViewObjects(0), 0, TexArraySize);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+
+    // Each draw renders one triangle, so that an incorrect descriptor set in either draw fails the test.
+    auto DrawTriangle = [&](Uint32 StartVertex, const std::array<size_t, TexArraySize>& TexIndices) {
+        {
+            MapHelper<float4> RefColorsData{pContext, pRefColorsCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            for (Uint32 i = 0; i < TexArraySize; ++i)
+                RefColorsData[i] = RefColors[TexIndices[i]];
+        }
+
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+        DrawAttrs.StartVertexLocation = StartVertex;
+        pContext->Draw(DrawAttrs);
+    };
+
+    DrawTriangle(0, {0, 1, 2});
+
+    // Update a single array element. The next commit must write a new descriptor set that
+    // includes both the new texture and the descriptors that have not changed.
+    SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2DArr_Dyn", SetArray, RefTextures.GetViewObjects(3), 1, 1);
+
+    DrawTriangle(3, {0, 3, 2});
+
+    pSwapChain->Present();
+}
+
+TEST_F(PipelineResourceSignatureTest, SetVariables)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "SetVariables test";
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "g_MutableBuffer",   1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL,                      "g_MutableTexture",  4, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL,                      "g_DynamicTexture",  2, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_TRUE(pSRB);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    {
+        BufferDesc BuffDesc{"SetVariables test buffer", 256, BIND_UNIFORM_BUFFER, USAGE_DEFAULT};
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    }
+    ASSERT_TRUE(pBuffer);
+
+    std::array<IDeviceObject*, 4>          pTexSRVs{};
+    std::array<RefCntAutoPtr<ITexture>, 4> pTextures;
+    for (size_t i = 0; i < pTextures.size(); ++i)
+    {
+        pTextures[i] = pEnv->CreateTexture("SetVariables test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 64, 64);
+        ASSERT_TRUE(pTextures[i]);
+        pTexSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    }
+
+    auto* pBufferVar  = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_MutableBuffer");
+    auto* pMutTexVar  = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableTexture");
+    auto* pDynTexVar  = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicTexture");
+    auto* pBufferVar2 = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableBuffer");
+    ASSERT_NE(pBufferVar, nullptr);
+    ASSERT_NE(pMutTexVar, nullptr);
+    ASSERT_NE(pDynTexVar, nullptr);
+    ASSERT_NE(pBufferVar2, nullptr);
+
+    IDeviceObject* pBuffObj = pBuffer;
+
+    // clang-format off
+    const ShaderVariableBinding Bindings[] =
+    {
+        {pBufferVar,  &pBuffObj},
+        {pBufferVar2, &pBuffObj},
+        {pMutTexVar,  pTexSRVs.data(), 0, 4},
+        {pDynTexVar,  &pTexSRVs[1],    1, 1},
+        {pDynTexVar,  &pTexSRVs[2],    0, 1},
+    };
+    // clang-format on
+    pSRB->SetVariables(Bindings, _countof(Bindings));
+
+    EXPECT_EQ(pBufferVar->Get(0), pBuffer);
+    EXPECT_EQ(pBufferVar2->Get(0), pBuffer);
+    for (Uint32 i = 0; i < 4; ++i)
+        EXPECT_EQ(pMutTexVar->Get(i), pTexSRVs[i]);
+    EXPECT_EQ(pDynTexVar->Get(0), pTexSRVs[2]);
+    EXPECT_EQ(pDynTexVar->Get(1), pTexSRVs[1]);
+
+    // Dynamic variables can be overwritten
+    const ShaderVariableBinding Rebinding{pDynTexVar, &pTexSRVs[3], 1, 1};
+    pSRB->SetVariables(&Rebinding, 1);
+    EXPECT_EQ(pDynTexVar->Get(1), pTexSRVs[3]);
+
+    // Empty batch
+    pSRB->SetVariables(nullptr, 0);
+}
+
+TEST_F(PipelineResourceSignatureTest, SetVariables_Render)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    if (pDevice->GetDeviceInfo().IsGLDevice())
+        GTEST_SKIP() << "Separate samplers are not supported in OpenGL";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    float ClearColor[] = {0.625, 0.25, 0.875, 0.375};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    static constexpr Uint32 TexArraySize = 3;
+
+    ReferenceTextures RefTextures{
+        TexArraySize,
+        128, 128,
+        USAGE_DEFAULT,
+        BIND_SHADER_RESOURCE,
+        TEXTURE_VIEW_SHADER_RESOURCE //
+    };
+
+    std::array<float4, TexArraySize> RefColors;
+    for (size_t i = 0; i < RefColors.size(); ++i)
+        RefColors[i] = RefTextures.GetColor(i);
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TEX_ARRAY_SIZE", static_cast<int>(TexArraySize));
+
+    auto ModifyShaderCI = [pEnv](ShaderCreateInfo& ShaderCI) {
+        if (pEnv->NeedWARPResourceArrayIndexingBugWorkaround())
+        {
+            // Shader resource array indexing always references array element 0 in D3D12 WARP
+            // when shaders are compiled with shader model 5.1.
+            ShaderCI.ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            ShaderCI.HLSLVersion    = ShaderVersion{5, 0};
+        }
+        ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+    };
+
+    auto pVS = CreateShaderFromFile(SHADER_TYPE_VERTEX, "DynamicResources.hlsl", "VSMain", "PRS set variables test: VS", Macros, ModifyShaderCI);
+    auto pPS = CreateShaderFromFile(SHADER_TYPE_PIXEL, "DynamicResources.hlsl", "PSMain", "PRS set variables test: PS", Macros, ModifyShaderCI);
+    ASSERT_TRUE(pVS && pPS);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Set variables render test";
+
+    // Mutable resources are written to the descriptor set when they are bound,
+    // so that SetVariables() writes all of them with one batch.
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_VS_PS, "g_RefColors",    1,            SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Dyn", TexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Sampler",      1,            SHADER_RESOURCE_TYPE_SAMPLER,         SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    ImmutableSamplerDesc ImmutableSamplers[] = //
+        {
+            {SHADER_TYPE_VS_PS, "g_Sampler", SamplerDesc{}} //
+        };
+    PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+    PRSDesc.UseCombinedTextureSamplers = false;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    auto pPSO = CreateGraphicsPSO(pVS, pPS, {pPRS});
+    ASSERT_TRUE(pPSO);
+
+    RefCntAutoPtr<IBuffer> pRefColorsCB;
+    {
+        BufferDesc BuffDesc{"Reference colors", sizeof(RefColors), BIND_UNIFORM_BUFFER, USAGE_DEFAULT};
+        BufferData InitData{RefColors.data(), sizeof(RefColors)};
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pRefColorsCB);
+        ASSERT_TRUE(pRefColorsCB);
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    auto* pRefColorsVar = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_RefColors");
+    auto* pTexArrVar    = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex2DArr_Dyn");
+    ASSERT_NE(pRefColorsVar, nullptr);
+    ASSERT_NE(pTexArrVar, nullptr);
+
+    IDeviceObject* pRefColorsObj = pRefColorsCB;
+
+    // The texture array is set by two bindings in reverse order, so that the batch
+    // has to handle both separate and consecutive elements of the same binding.
+    // clang-format off
+    const ShaderVariableBinding Bindings[] =
+    {
+        {pTexArrVar,    RefTextures.GetViewObjects(2), 2, 1},
+        {pRefColorsVar, &pRefColorsObj},
+        {pTexArrVar,    RefTextures.GetViewObjects(0), 0, 2},
+    };
+    // clang-format on
+    pSRB->SetVariables(Bindings, _countof(Bindings));
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+    pContext->Draw(DrawAttrs);
+
+    pSwapChain->Present();
+}
+
 } // namespace Diligent
@@ -1857,7 +1857,13 @@ TEST_P(RT6, InlineRayTracing_GraphicsPSO)
     RefCntAutoPtr<ITopLevelAS> pTLAS;
     TLASCompaction(TestId, pDevice, pContext, pTempTLAS, pTLAS);
 
-    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_TLAS")->Set(pTLAS);
+    // Bind the TLAS with SetVariables() so that the acceleration structure descriptor goes through the batched write path
+    {
+        IDeviceObject*              pTLASObj = pTLAS;
+        const ShaderVariableBinding Binding{pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_TLAS"), &pTLASObj};
+        ASSERT_NE(Binding.pVariable, nullptr);
+        pSRB->SetVariables(&Binding, 1);
+    }
 
     ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
     pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
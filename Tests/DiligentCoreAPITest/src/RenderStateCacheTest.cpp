@@ -1152,6 +1152,8 @@ enum TEST_PIPELINE_RELOAD_FLAGS : Uint32
     TEST_PIPELINE_RELOAD_FLAG_CREATE_SRB_BEFORE_RELOAD = 1u << 1u,
     TEST_PIPELINE_RELOAD_FLAG_USE_SIGNATURES           = 1u << 2u,
     TEST_PIPELINE_RELOAD_FLAG_ASYNC_COMPILE            = 1u << 3u,
+    TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES      = 1u << 4u,
+    TEST_PIPELINE_RELOAD_FLAG_NO_CALLBACK              = 1u << 5u,
 };
 DEFINE_FLAG_ENUM_OPERATORS(TEST_PIPELINE_RELOAD_FLAGS);
 
@@ -1161,6 +1163,8 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
     const bool CreateSrbBeforeReload = Flags & TEST_PIPELINE_RELOAD_FLAG_CREATE_SRB_BEFORE_RELOAD;
     const bool UseSignatures         = Flags & TEST_PIPELINE_RELOAD_FLAG_USE_SIGNATURES;
     const bool AsyncCompile          = Flags & TEST_PIPELINE_RELOAD_FLAG_ASYNC_COMPILE;
+    const bool NotifyFileChanges     = Flags & TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES;
+    const bool UseCallback           = !(Flags & TEST_PIPELINE_RELOAD_FLAG_NO_CALLBACK);
 
     auto* pEnv       = GPUTestingEnvironment::GetInstance();
     auto* pDevice    = pEnv->GetDevice();
@@ -1253,7 +1257,8 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
             PsoCI.Flags        = AsyncCompile ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
 
             auto& GraphicsPipeline{PsoCI.GraphicsPipeline};
-            GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+            // The callback sets the topology that is required to render the reference image
+            GraphicsPipeline.PrimitiveTopology            = UseCallback ? PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
             GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
             GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
 
@@ -1396,7 +1401,29 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
                 GraphicsPipeline.PrimitiveTopology = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
             });
 
-        Uint32 NumStatesReloaded = pCache->Reload(ModifyPSO, ModifyPSO);
+        RefCntAutoPtr<IShader>        pCS;
+        RefCntAutoPtr<IPipelineState> pComputePSO;
+        if (NotifyFileChanges)
+        {
+            // The compute shader only includes Defines.h, while the graphics shaders also include GraphicsCommon.h.
+            // The reload directory contains a version of the compute shader that produces a different image,
+            // so the compute pipeline will fail verification if it is reloaded.
+            CreateComputeShader(pCache, pShaderSourceFactory, CompileFlags, pCS, pData != nullptr);
+            ASSERT_NE(pCS, nullptr);
+            CreateComputePSO(pCache, pData != nullptr, pCS, /*UseSignature = */ false, AsyncCompile, &pComputePSO);
+            ASSERT_NE(pComputePSO, nullptr);
+
+            // The file is not used by any shader, so nothing should be reloaded
+            pCache->NotifyFileChanged("shaders/RenderStateCache/PixelShader2.psh");
+            EXPECT_EQ(pCache->Reload(), 0u);
+            ASSERT_EQ(pPSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
+
+            // Only the graphics shaders and the graphics pipeline should be reloaded
+            pCache->NotifyFileChanged("shaders/RenderStateCache/GraphicsCommon.h");
+        }
+
+        // Without the callback, the graphics pipeline is only reloaded because its shaders were reloaded
+        Uint32 NumStatesReloaded = UseCallback ? pCache->Reload(ModifyPSO, ModifyPSO) : pCache->Reload();
         if (!AsyncCompile)
             EXPECT_EQ(NumStatesReloaded, pass == 0 ? 3u : 0u);
         ASSERT_EQ(pPSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
@@ -1416,6 +1443,12 @@ void TestPipelineReload(TEST_PIPELINE_RELOAD_FLAGS Flags)
                          pCtx->CommitShaderResources(pSRB1, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
                  });
 
+        if (pComputePSO)
+        {
+            ASSERT_EQ(pComputePSO->GetStatus(AsyncCompile), PIPELINE_STATE_STATUS_READY);
+            VerifyComputePSO(pComputePSO);
+        }
+
         pData.Release();
         pCache->WriteToBlob(pass == 0 ? ContentVersion : ~0u, &pData);
     }
@@ -1446,6 +1479,11 @@ TEST(RenderStateCacheTest, Reload_Signatures_SrbBeforeReload)
     TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_CREATE_SRB_BEFORE_RELOAD | TEST_PIPELINE_RELOAD_FLAG_USE_SIGNATURES);
 }
 
+TEST(RenderStateCacheTest, Reload_NotifyFileChanged)
+{
+    TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES);
+}
+
 
 TEST(RenderStateCacheTest, Reload_Async)
 {
@@ -1472,6 +1510,21 @@ TEST(RenderStateCacheTest, Reload_Signatures_SrbBeforeReload_Async)
     TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_CREATE_SRB_BEFORE_RELOAD | TEST_PIPELINE_RELOAD_FLAG_USE_SIGNATURES | TEST_PIPELINE_RELOAD_FLAG_ASYNC_COMPILE);
 }
 
+TEST(RenderStateCacheTest, Reload_NotifyFileChanged_Async)
+{
+    TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES | TEST_PIPELINE_RELOAD_FLAG_ASYNC_COMPILE);
+}
+
+TEST(RenderStateCacheTest, Reload_NotifyFileChanged_NoCallback)
+{
+    TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES | TEST_PIPELINE_RELOAD_FLAG_NO_CALLBACK);
+}
+
+TEST(RenderStateCacheTest, Reload_NotifyFileChanged_NoCallback_Async)
+{
+    TestPipelineReload(TEST_PIPELINE_RELOAD_FLAG_NOTIFY_FILE_CHANGES | TEST_PIPELINE_RELOAD_FLAG_NO_CALLBACK | TEST_PIPELINE_RELOAD_FLAG_ASYNC_COMPILE);
+}
+
 
 TEST(RenderStateCacheTest, Reload_Signatures2)
 {
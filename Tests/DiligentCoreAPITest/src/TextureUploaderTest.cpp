@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <thread>
+#include <vector>
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -220,4 +221,334 @@ TEST(TextureUploaderTest, WorkerThread)
     TextureUploaderTest(false);
 }
 
+// Pooled staging memory is only used by D3D12 and Vulkan uploaders
+bool IsPooledMemorySupported(IRenderDevice* pDevice)
+{
+    const auto DeviceType = pDevice->GetDeviceInfo().Type;
+    return DeviceType == RENDER_DEVICE_TYPE_D3D12 || DeviceType == RENDER_DEVICE_TYPE_VULKAN;
+}
+
+TEST(TextureUploaderTest, DiscardBuffer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (pDevice->GetDeviceInfo().IsMetalDevice())
+    {
+        GTEST_SKIP() << "Texture uploader is not currently implemented in Metal";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    UploadBufferDesc UploadBuffDesc;
+    UploadBuffDesc.Width  = 64;
+    UploadBuffDesc.Height = 64;
+    UploadBuffDesc.Format = TEX_FORMAT_RGBA8_UNORM;
+
+    for (Uint64 PageSize : {Uint64{0}, Uint64{1 << 20}})
+    {
+        TextureUploaderDesc UploaderDesc;
+        UploaderDesc.StagingMemoryPageSize = PageSize;
+        RefCntAutoPtr<ITextureUploader> pTexUploader;
+        CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
+        ASSERT_TRUE(pTexUploader);
+
+        // Buffer discarded by the render thread
+        {
+            RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+            pTexUploader->AllocateUploadBuffer(pContext, UploadBuffDesc, &pUploadBuffer);
+            ASSERT_TRUE(pUploadBuffer);
+            pTexUploader->DiscardBuffer(pContext, pUploadBuffer);
+        }
+
+        // Buffer discarded by a worker thread is released by RenderThreadUpdate()
+        std::atomic_bool BufferDiscarded;
+        BufferDiscarded.store(false);
+
+        std::thread WorkerThread{
+            [&]() {
+                RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+                pTexUploader->AllocateUploadBuffer(nullptr, UploadBuffDesc, &pUploadBuffer);
+                if (pUploadBuffer)
+                    pTexUploader->DiscardBuffer(nullptr, pUploadBuffer);
+                else
+                    ADD_FAILURE() << "Failed to allocate upload buffer";
+                BufferDiscarded.store(true);
+            } //
+        };
+        while (!BufferDiscarded)
+        {
+            pTexUploader->RenderThreadUpdate(pContext);
+        }
+        WorkerThread.join();
+
+        pTexUploader->RenderThreadUpdate(pContext);
+        EXPECT_EQ(pTexUploader->GetStats().NumPendingOperations, 0u);
+
+        pContext->WaitForIdle();
+        pTexUploader->RenderThreadUpdate(pContext);
+        if (PageSize != 0 && IsPooledMemorySupported(pDevice))
+        {
+            EXPECT_EQ(pTexUploader->GetStats().BytesInFlight, 0u);
+        }
+    }
+}
+
+TEST(TextureUploaderTest, PooledMemory_Texture3D)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!IsPooledMemorySupported(pDevice))
+    {
+        GTEST_SKIP() << "Pooled staging memory is only supported in D3D12 and Vulkan";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.StagingMemoryPageSize = 1 << 20;
+    RefCntAutoPtr<ITextureUploader> pTexUploader;
+    CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
+    ASSERT_TRUE(pTexUploader);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Texture uploading 3D dst texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_3D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 32;
+    TexDesc.Depth     = 8;
+    TexDesc.MipLevels = 1;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    RefCntAutoPtr<ITexture> pDstTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDstTexture);
+    ASSERT_TRUE(pDstTexture);
+
+    TexDesc.Name           = "Texture uploading 3D staging texture";
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    TexDesc.BindFlags      = BIND_NONE;
+    RefCntAutoPtr<ITexture> pStagingTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTexture);
+    ASSERT_TRUE(pStagingTexture);
+
+    UploadBufferDesc UploadBuffDesc;
+    UploadBuffDesc.Width  = TexDesc.Width;
+    UploadBuffDesc.Height = TexDesc.Height;
+    UploadBuffDesc.Depth  = TexDesc.Depth;
+    UploadBuffDesc.Format = TexDesc.Format;
+
+    Uint32 cnt     = 0;
+    Uint32 ref_cnt = cnt;
+
+    std::atomic_bool BufferPopulated;
+    BufferPopulated.store(false);
+
+    // Every depth slice of the upload buffer is written at its own depth stride
+    std::thread WorkerThread{
+        [&]() {
+            RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+            pTexUploader->AllocateUploadBuffer(nullptr, UploadBuffDesc, &pUploadBuffer);
+            if (pUploadBuffer)
+            {
+                const auto MappedData = pUploadBuffer->GetMappedData(0, 0);
+                for (Uint32 z = 0; z < UploadBuffDesc.Depth; ++z)
+                {
+                    auto SliceData  = MappedData;
+                    SliceData.pData = static_cast<Uint8*>(MappedData.pData) + MappedData.DepthStride * z;
+                    WriteOrVerifyRGBAData(SliceData, UploadBuffDesc, 0, z, cnt, false);
+                }
+                pTexUploader->ScheduleGPUCopy(nullptr, pDstTexture, 0, 0, pUploadBuffer);
+                pUploadBuffer->WaitForCopyScheduled();
+                pTexUploader->RecycleBuffer(pUploadBuffer);
+            }
+            else
+            {
+                ADD_FAILURE() << "Failed to allocate upload buffer";
+            }
+            BufferPopulated.store(true);
+        } //
+    };
+    while (!BufferPopulated)
+    {
+        pTexUploader->RenderThreadUpdate(pContext);
+    }
+    WorkerThread.join();
+
+    CopyTextureAttribs CopyAttribs{pDstTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    pContext->CopyTexture(CopyAttribs);
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    ASSERT_NE(MappedData.pData, nullptr);
+    for (Uint32 z = 0; z < UploadBuffDesc.Depth; ++z)
+    {
+        auto SliceData  = MappedData;
+        SliceData.pData = static_cast<Uint8*>(MappedData.pData) + MappedData.DepthStride * z;
+        WriteOrVerifyRGBAData(SliceData, UploadBuffDesc, 0, z, ref_cnt, true);
+    }
+    pContext->UnmapTextureSubresource(pStagingTexture, 0, 0);
+}
+
+TEST(TextureUploaderTest, PooledMemory_BufferLargerThanBudget)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!IsPooledMemorySupported(pDevice))
+    {
+        GTEST_SKIP() << "Pooled staging memory is only supported in D3D12 and Vulkan";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.StagingMemoryPageSize = 64 << 10;
+    UploaderDesc.StagingMemoryBudget   = 256 << 10;
+    RefCntAutoPtr<ITextureUploader> pTexUploader;
+    CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
+    ASSERT_TRUE(pTexUploader);
+
+    // 1 MB buffer can never fit into the budget
+    UploadBufferDesc UploadBuffDesc;
+    UploadBuffDesc.Width  = 512;
+    UploadBuffDesc.Height = 512;
+    UploadBuffDesc.Format = TEX_FORMAT_RGBA8_UNORM;
+
+    for (bool IsRenderThread : {true, false})
+    {
+        // Expected errors are matched in reverse order
+        TestingEnvironment::ErrorScope ExpectedErrors{
+            "Failed to allocate staging memory",
+            "exceeds the staging memory budget",
+        };
+
+        RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+        if (IsRenderThread)
+        {
+            pTexUploader->AllocateUploadBuffer(pContext, UploadBuffDesc, &pUploadBuffer);
+        }
+        else
+        {
+            // The worker thread must fail instead of waiting for the memory that will never be available
+            std::atomic_bool AllocationDone;
+            AllocationDone.store(false);
+
+            std::thread WorkerThread{
+                [&]() {
+                    pTexUploader->AllocateUploadBuffer(nullptr, UploadBuffDesc, &pUploadBuffer);
+                    AllocationDone.store(true);
+                } //
+            };
+            while (!AllocationDone)
+            {
+                pTexUploader->RenderThreadUpdate(pContext);
+            }
+            WorkerThread.join();
+        }
+        EXPECT_EQ(pUploadBuffer, nullptr) << (IsRenderThread ? "Render thread" : "Worker thread");
+    }
+}
+
+
+TEST(TextureUploaderTest, PooledMemory_FillBudgetFromWorker)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!IsPooledMemorySupported(pDevice))
+    {
+        GTEST_SKIP() << "Pooled staging memory is only supported in D3D12 and Vulkan";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.StagingMemoryPageSize = 64 << 10;
+    UploaderDesc.StagingMemoryBudget   = 256 << 10;
+    RefCntAutoPtr<ITextureUploader> pTexUploader;
+    CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
+    ASSERT_TRUE(pTexUploader);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Texture uploading dst texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Width     = 128;
+    TexDesc.Height    = 128;
+    TexDesc.ArraySize = 8;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    RefCntAutoPtr<ITexture> pDstTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDstTexture);
+    ASSERT_TRUE(pDstTexture);
+
+    // Every buffer takes a whole page, so the worker exhausts the budget with its own buffers
+    UploadBufferDesc UploadBuffDesc;
+    UploadBuffDesc.Width  = TexDesc.Width;
+    UploadBuffDesc.Height = TexDesc.Height;
+    UploadBuffDesc.Format = TexDesc.Format;
+
+    std::atomic_bool UploadDone;
+    UploadDone.store(false);
+
+    // The worker must not wait for the memory held by the buffers it has not recycled yet
+    std::thread WorkerThread{
+        [&]() {
+            std::vector<RefCntAutoPtr<IUploadBuffer>> UploadBuffers(TexDesc.ArraySize);
+            for (auto& pUploadBuffer : UploadBuffers)
+            {
+                pTexUploader->AllocateUploadBuffer(nullptr, UploadBuffDesc, &pUploadBuffer);
+                if (!pUploadBuffer)
+                    ADD_FAILURE() << "Failed to allocate upload buffer";
+            }
+
+            for (Uint32 Slice = 0; Slice < TexDesc.ArraySize; ++Slice)
+            {
+                if (UploadBuffers[Slice])
+                    pTexUploader->ScheduleGPUCopy(nullptr, pDstTexture, Slice, 0, UploadBuffers[Slice]);
+            }
+
+            for (auto& pUploadBuffer : UploadBuffers)
+            {
+                if (pUploadBuffer)
+                {
+                    pUploadBuffer->WaitForCopyScheduled();
+                    pTexUploader->RecycleBuffer(pUploadBuffer);
+                }
+            }
+
+            // Now the memory is held by the recycled buffers, so the worker may wait for it
+            RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+            pTexUploader->AllocateUploadBuffer(nullptr, UploadBuffDesc, &pUploadBuffer);
+            if (pUploadBuffer)
+            {
+                pTexUploader->ScheduleGPUCopy(nullptr, pDstTexture, 0, 0, pUploadBuffer);
+                pUploadBuffer->WaitForCopyScheduled();
+                pTexUploader->RecycleBuffer(pUploadBuffer);
+            }
+            else
+            {
+                ADD_FAILURE() << "Failed to allocate upload buffer";
+            }
+            UploadDone.store(true);
+        } //
+    };
+    while (!UploadDone)
+    {
+        pTexUploader->RenderThreadUpdate(pContext);
+    }
+    WorkerThread.join();
+
+    const auto Stats = pTexUploader->GetStats();
+    EXPECT_GT(Stats.PeakStagingMemorySize, UploaderDesc.StagingMemoryBudget);
+
+    pContext->WaitForIdle();
+}
+
 } // namespace
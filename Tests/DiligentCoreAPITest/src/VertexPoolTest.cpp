@@ -183,4 +183,119 @@ TEST(VertexPoolTest, Allocate)
     }
 }
 
+
+TEST(VertexPoolTest, Compact)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{8, BIND_SHADER_RESOURCE, USAGE_DEFAULT, BUFFER_MODE_STRUCTURED, CPU_ACCESS_NONE},
+        };
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Test vertex pool";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 1024;
+    CI.EnableCompaction = true;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+    pVtxPool->UpdateAll(pDevice, pContext);
+
+    constexpr Uint32 NumAllocations = 16;
+    constexpr Uint32 AllocSize      = 64;
+
+    std::vector<RefCntAutoPtr<IVertexPoolAllocation>> pAllocations(NumAllocations);
+    for (Uint32 i = 0; i < NumAllocations; ++i)
+    {
+        pVtxPool->Allocate(AllocSize, &pAllocations[i]);
+        ASSERT_NE(pAllocations[i], nullptr);
+
+        // Fill every element with the allocation index
+        for (Uint32 elem = 0; elem < CI.Desc.NumElements; ++elem)
+        {
+            const auto          ElemSize = Elements[elem].Size;
+            std::vector<Uint32> Data(AllocSize * ElemSize / sizeof(Uint32), i);
+            pContext->UpdateBuffer(pVtxPool->GetBuffer(elem), Uint64{pAllocations[i]->GetStartVertex()} * ElemSize, AllocSize * ElemSize,
+                                   Data.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        }
+    }
+
+    // Release every other allocation
+    for (Uint32 i = 0; i < NumAllocations; i += 2)
+        pAllocations[i].Release();
+
+    VertexPoolUsageStats Stats;
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_GT(Stats.Fragmentation, 0.f);
+
+    const auto Version = pVtxPool->GetVersion();
+
+    // Move at most one allocation per call
+    EXPECT_EQ(pVtxPool->Compact(pDevice, pContext, 1), 1u);
+    EXPECT_NE(pVtxPool->GetVersion(), Version);
+
+    Uint32 NumMoved = 1;
+    while (Uint32 Moved = pVtxPool->Compact(pDevice, pContext, 0))
+        NumMoved += Moved;
+    // Allocations from the upper half of the pool fill the holes in the lower half
+    EXPECT_EQ(NumMoved, NumAllocations / 4);
+
+    pVtxPool->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.Fragmentation, 0.f);
+    EXPECT_EQ(Stats.AllocationCount, NumAllocations / 2);
+
+    // All allocations must now be packed at the beginning of the pool
+    std::vector<Uint32> StartVertices;
+    for (Uint32 i = 1; i < NumAllocations; i += 2)
+        StartVertices.push_back(pAllocations[i]->GetStartVertex());
+    std::sort(StartVertices.begin(), StartVertices.end());
+    for (Uint32 i = 0; i < StartVertices.size(); ++i)
+        EXPECT_EQ(StartVertices[i], i * AllocSize);
+
+    // Verify that the data has been moved
+    for (Uint32 elem = 0; elem < CI.Desc.NumElements; ++elem)
+    {
+        const auto ElemSize = Elements[elem].Size;
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Vertex pool compaction staging buffer";
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        BuffDesc.Size           = Uint64{AllocSize} * NumAllocations / 2 * ElemSize;
+
+        RefCntAutoPtr<IBuffer> pStagingBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+
+        pContext->CopyBuffer(pVtxPool->GetBuffer(elem), 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, 0, BuffDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->WaitForIdle();
+
+        void* pData = nullptr;
+        pContext->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        for (Uint32 i = 1; i < NumAllocations; i += 2)
+        {
+            const auto* pAllocData = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(pData) + Uint64{pAllocations[i]->GetStartVertex()} * ElemSize);
+            for (size_t j = 0; j < AllocSize * ElemSize / sizeof(Uint32); ++j)
+            {
+                if (pAllocData[j] != i)
+                {
+                    ADD_FAILURE() << "Data of allocation " << i << " has not been moved correctly";
+                    break;
+                }
+            }
+        }
+        pContext->UnmapBuffer(pStagingBuffer, MAP_READ);
+    }
+}
+
 } // namespace
@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PatchedShaderCacheVk.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+// Returns a wrapper that does not own the module, so that the test does not need a device
+VulkanUtilities::ShaderModuleWrapper CreateTestShaderModule(uintptr_t Id)
+{
+    // Non-dispatchable handles are pointers on 64-bit platforms and integers on 32-bit platforms
+    return VulkanUtilities::ShaderModuleWrapper{(VkShaderModule)Id};
+}
+
+TEST(PatchedShaderCacheVkTest, FindAndAdd)
+{
+    PatchedShaderCacheVk Cache;
+
+    const std::vector<Uint32>   Bindings = {0, 0, 1, 0, 0, 1};
+    const std::vector<uint32_t> SPIRV    = {0x07230203, 1, 2, 3};
+
+    EXPECT_EQ(Cache.Find(1, Bindings), nullptr);
+
+    auto pEntry = Cache.Add(1, std::vector<Uint32>{Bindings}, std::vector<uint32_t>{SPIRV});
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_EQ(pEntry->SPIRV, SPIRV);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+
+    // Hit
+    EXPECT_EQ(Cache.Find(1, Bindings), pEntry);
+
+    // Adding the same entry again returns the existing one
+    EXPECT_EQ(Cache.Add(1, std::vector<Uint32>{Bindings}, std::vector<uint32_t>{4, 5, 6}), pEntry);
+    EXPECT_EQ(pEntry->SPIRV, SPIRV);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+
+    // Different shader with the same bindings
+    EXPECT_EQ(Cache.Find(2, Bindings), nullptr);
+}
+
+TEST(PatchedShaderCacheVkTest, DifferentLayout)
+{
+    PatchedShaderCacheVk Cache;
+
+    const std::vector<Uint32> Bindings0 = {0, 0, 1, 0};
+    const std::vector<Uint32> Bindings1 = {0, 1, 1, 1}; // Same bindings in a different descriptor set
+    const std::vector<Uint32> Bindings2 = {1, 0, 0, 0}; // Swapped bindings
+
+    auto pEntry0 = Cache.Add(1, std::vector<Uint32>{Bindings0}, {10, 11});
+    ASSERT_NE(pEntry0, nullptr);
+
+    EXPECT_EQ(Cache.Find(1, Bindings1), nullptr);
+    EXPECT_EQ(Cache.Find(1, Bindings2), nullptr);
+
+    auto pEntry1 = Cache.Add(1, std::vector<Uint32>{Bindings1}, {20, 21});
+    auto pEntry2 = Cache.Add(1, std::vector<Uint32>{Bindings2}, {30, 31});
+    ASSERT_NE(pEntry1, nullptr);
+    ASSERT_NE(pEntry2, nullptr);
+    EXPECT_NE(pEntry0, pEntry1);
+    EXPECT_NE(pEntry0, pEntry2);
+    EXPECT_NE(pEntry1, pEntry2);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{3});
+
+    EXPECT_EQ(Cache.Find(1, Bindings0), pEntry0);
+    EXPECT_EQ(Cache.Find(1, Bindings1), pEntry1);
+    EXPECT_EQ(Cache.Find(1, Bindings2), pEntry2);
+    EXPECT_EQ(pEntry1->SPIRV, (std::vector<uint32_t>{20, 21}));
+}
+
+TEST(PatchedShaderCacheVkTest, RemoveShader)
+{
+    PatchedShaderCacheVk Cache;
+
+    const std::vector<Uint32> Bindings0 = {0, 0};
+    const std::vector<Uint32> Bindings1 = {1, 0};
+
+    auto pEntry = Cache.Add(1, std::vector<Uint32>{Bindings0}, {1, 2, 3});
+    Cache.Add(1, std::vector<Uint32>{Bindings1}, {4, 5, 6});
+    Cache.Add(2, std::vector<Uint32>{Bindings0}, {7, 8, 9});
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{3});
+
+    // All entries of the released shader are removed right away
+    Cache.RemoveShader(1);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+    EXPECT_EQ(Cache.Find(1, Bindings0), nullptr);
+    EXPECT_EQ(Cache.Find(1, Bindings1), nullptr);
+    EXPECT_NE(Cache.Find(2, Bindings0), nullptr);
+
+    // The pipeline that still references the entry keeps it alive
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_EQ(pEntry.use_count(), 1);
+    EXPECT_EQ(pEntry->SPIRV, (std::vector<uint32_t>{1, 2, 3}));
+
+    // Removing unknown shader is a no-op
+    Cache.RemoveShader(3);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+
+    Cache.RemoveShader(2);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{0});
+}
+
+TEST(PatchedShaderCacheVkTest, ShaderModule)
+{
+    PatchedShaderCacheVk Cache;
+
+    const std::vector<Uint32> Bindings = {0, 0};
+
+    auto pEntry = Cache.Add(1, std::vector<Uint32>{Bindings}, {1, 2, 3});
+    ASSERT_NE(pEntry, nullptr);
+
+    std::atomic<int> NumCreated{0};
+
+    auto CreateModule = [&NumCreated](const std::vector<uint32_t>& SPIRV) {
+        EXPECT_EQ(SPIRV, (std::vector<uint32_t>{1, 2, 3}));
+        return CreateTestShaderModule(++NumCreated);
+    };
+
+    // Pipelines that use the same entry share the module that is created once
+    std::vector<std::thread>    Threads(8);
+    std::vector<VkShaderModule> Modules(Threads.size());
+    for (size_t i = 0; i < Threads.size(); ++i)
+    {
+        Threads[i] = std::thread{[&, i]() {
+            auto pPipelineEntry = Cache.Find(1, Bindings);
+            ASSERT_NE(pPipelineEntry, nullptr);
+            Modules[i] = pPipelineEntry->GetShaderModule(CreateModule);
+        }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(NumCreated, 1);
+    for (VkShaderModule vkModule : Modules)
+    {
+        EXPECT_NE(vkModule, VK_NULL_HANDLE);
+        EXPECT_EQ(vkModule, Modules[0]);
+    }
+
+    // The module of the removed shader is still available to the pipeline that holds the entry
+    Cache.RemoveShader(1);
+    EXPECT_EQ(pEntry->GetShaderModule(CreateModule), Modules[0]);
+    EXPECT_EQ(NumCreated, 1);
+
+    // The new entry of the same shader creates a new module
+    auto pNewEntry = Cache.Add(1, std::vector<Uint32>{Bindings}, {1, 2, 3});
+    ASSERT_NE(pNewEntry, nullptr);
+    EXPECT_NE(pNewEntry, pEntry);
+    EXPECT_NE(pNewEntry->GetShaderModule(CreateModule), Modules[0]);
+    EXPECT_EQ(NumCreated, 2);
+}
+
+} // namespace
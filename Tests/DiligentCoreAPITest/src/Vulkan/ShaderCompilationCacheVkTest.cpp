@@ -0,0 +1,465 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderCompilationCacheVk.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "ThreadPool.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr char TestSource[] = R"(
+#include "Common.h"
+void main()
+{
+}
+)";
+
+ShaderCreateInfo GetTestShaderCI()
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source          = TestSource;
+    ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.Name       = "Test shader";
+    ShaderCI.EntryPoint      = "main";
+    return ShaderCI;
+}
+
+// Returns the compile function that counts the number of calls
+ShaderCompilationCacheVk::CompileFuncType GetCompileFunc(std::atomic<int>& NumCalls)
+{
+    return [&NumCalls](const ShaderCreateInfo&) {
+        ++NumCalls;
+        return std::vector<uint32_t>{0x07230203, 1, 2, 3};
+    };
+}
+
+TEST(ShaderCompilationCacheVkTest, SharedEntry)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 1\n"}});
+
+    ShaderCompilationCacheVk Cache;
+    std::atomic<int>         NumCalls{0};
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    bool IsNew0  = false;
+    auto pEntry0 = Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, GetCompileFunc(NumCalls), IsNew0);
+    ASSERT_NE(pEntry0, nullptr);
+    EXPECT_TRUE(IsNew0);
+
+    // Identical create info
+    bool IsNew1  = true;
+    auto pEntry1 = Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, GetCompileFunc(NumCalls), IsNew1);
+    EXPECT_FALSE(IsNew1);
+    EXPECT_EQ(pEntry0, pEntry1);
+
+    // Same source in a different string and the asynchronous flag do not affect the byte code
+    const std::string SourceCopy{TestSource};
+
+    ShaderCreateInfo ShaderCI2 = ShaderCI;
+    ShaderCI2.Source           = SourceCopy.c_str();
+    ShaderCI2.CompileFlags     = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+    ShaderCI2.Desc.Name        = "Test shader 2";
+
+    bool IsNew2  = true;
+    auto pEntry2 = Cache.Preprocess(ShaderCI2, SHADER_COMPILER_DEFAULT, GetCompileFunc(NumCalls), IsNew2);
+    EXPECT_FALSE(IsNew2);
+    EXPECT_EQ(pEntry0, pEntry2);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+
+    EXPECT_TRUE(pEntry0->Compile(/*Wait = */ true));
+    EXPECT_TRUE(pEntry1->Compile(/*Wait = */ true));
+    EXPECT_TRUE(pEntry2->Compile(/*Wait = */ false));
+    EXPECT_EQ(NumCalls, 1);
+    EXPECT_TRUE(pEntry1->IsValid());
+    EXPECT_EQ(pEntry2->GetSPIRV(), (std::vector<uint32_t>{0x07230203, 1, 2, 3}));
+
+    // The entry is released with the last shader that uses it
+    pEntry0.reset();
+    pEntry1.reset();
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{1});
+    pEntry2.reset();
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{0});
+}
+
+TEST(ShaderCompilationCacheVkTest, DifferentParameters)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 1\n"}});
+
+    ShaderCompilationCacheVk Cache;
+    std::atomic<int>         NumCalls{0};
+
+    ShaderCreateInfo RefCI           = GetTestShaderCI();
+    RefCI.pShaderSourceStreamFactory = pFactory;
+
+    std::vector<ShaderCompilationCacheVk::SPIRVEntryPtr> Entries;
+
+    auto AddEntry = [&](const ShaderCreateInfo& ShaderCI, SHADER_COMPILER Compiler = SHADER_COMPILER_DEFAULT) {
+        bool IsNew  = false;
+        auto pEntry = Cache.Preprocess(ShaderCI, Compiler, GetCompileFunc(NumCalls), IsNew);
+        EXPECT_TRUE(IsNew);
+        for (const auto& pOtherEntry : Entries)
+            EXPECT_NE(pEntry, pOtherEntry);
+        Entries.emplace_back(std::move(pEntry));
+    };
+
+    AddEntry(RefCI);
+
+    // Different macros. The macro is not used by the source, but macros are part of the key.
+    {
+        ShaderMacroHelper Macros;
+        Macros.Add("MACRO", 1);
+
+        ShaderCreateInfo ShaderCI = RefCI;
+        ShaderCI.Macros           = Macros;
+        AddEntry(ShaderCI);
+
+        ShaderMacroHelper Macros2;
+        Macros2.Add("MACRO", 2);
+        ShaderCI.Macros = Macros2;
+        AddEntry(ShaderCI);
+    }
+
+    // Different entry point
+    {
+        ShaderCreateInfo ShaderCI = RefCI;
+        ShaderCI.EntryPoint       = "main2";
+        AddEntry(ShaderCI);
+    }
+
+    // Different compile flags
+    {
+        ShaderCreateInfo ShaderCI = RefCI;
+        ShaderCI.CompileFlags     = SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR;
+        AddEntry(ShaderCI);
+
+        // Vertex inputs of HLSL shaders are only remapped when reflection is loaded
+        ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_SKIP_REFLECTION;
+        AddEntry(ShaderCI);
+    }
+
+    // Different shader type
+    {
+        ShaderCreateInfo ShaderCI = RefCI;
+        ShaderCI.Desc.ShaderType  = SHADER_TYPE_VERTEX;
+        AddEntry(ShaderCI);
+    }
+
+    // Different compiler
+    AddEntry(RefCI, SHADER_COMPILER_DXC);
+
+    // Different include file
+    {
+        auto pFactory2 = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 2\n"}});
+
+        ShaderCreateInfo ShaderCI           = RefCI;
+        ShaderCI.pShaderSourceStreamFactory = pFactory2;
+        AddEntry(ShaderCI);
+    }
+
+    EXPECT_EQ(Cache.GetEntryCount(), Entries.size());
+}
+
+TEST(ShaderCompilationCacheVkTest, OriginalCreateInfo)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory(
+        {
+            {"Main.psh", TestSource},
+            {"Common.h", "#define VALUE 1\n"},
+        });
+
+    ShaderCompilationCacheVk Cache;
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.Source                     = nullptr;
+    ShaderCI.FilePath                   = "Main.psh";
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    // The compiler must get the original file, so that its messages refer to the original files and line numbers
+    std::atomic<int> NumCalls{0};
+
+    auto CompileFunc = [&](const ShaderCreateInfo& CompileCI) {
+        ++NumCalls;
+        EXPECT_EQ(CompileCI.Source, nullptr);
+        EXPECT_STREQ(CompileCI.FilePath, "Main.psh");
+        EXPECT_EQ(CompileCI.pShaderSourceStreamFactory, pFactory);
+        EXPECT_STREQ(CompileCI.Desc.Name, "Test shader");
+        EXPECT_STREQ(CompileCI.EntryPoint, "main");
+        return std::vector<uint32_t>{0x07230203};
+    };
+
+    bool IsNew  = false;
+    auto pEntry = Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, CompileFunc, IsNew);
+    ASSERT_NE(pEntry, nullptr);
+    EXPECT_TRUE(IsNew);
+
+    // The same source provided directly shares the entry
+    ShaderCreateInfo ShaderCI2           = GetTestShaderCI();
+    ShaderCI2.pShaderSourceStreamFactory = pFactory;
+
+    bool IsNew2  = true;
+    auto pEntry2 = Cache.Preprocess(ShaderCI2, SHADER_COMPILER_DEFAULT, nullptr, IsNew2);
+    EXPECT_FALSE(IsNew2);
+    EXPECT_EQ(pEntry, pEntry2);
+
+    EXPECT_TRUE(pEntry->Compile(/*Wait = */ true));
+    EXPECT_EQ(NumCalls, 1);
+    EXPECT_TRUE(pEntry2->IsValid());
+}
+
+TEST(ShaderCompilationCacheVkTest, PreprocessingFailure)
+{
+    // The include file is missing
+    auto pFactory = CreateMemoryShaderSourceFactory({});
+
+    ShaderCompilationCacheVk Cache;
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    // The original create info is compiled, so that the compiler reports the error
+    std::atomic<int> NumCalls{0};
+
+    auto CompileFunc = [&](const ShaderCreateInfo& CompileCI) {
+        ++NumCalls;
+        EXPECT_STREQ(CompileCI.Source, ShaderCI.Source);
+        return std::vector<uint32_t>{};
+    };
+
+    const auto Preprocess = [&](bool& IsNew) {
+        // Expected errors are matched in reverse order
+        TestingEnvironment::ErrorScope ExpectedErrors{
+            "Failed to unroll includes in shader 'Test shader'",
+            "Failed to load shader source file 'Common.h'",
+            "Failed to create input stream for source file Common.h",
+        };
+        return Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, CompileFunc, IsNew);
+    };
+
+    bool IsNew0  = false;
+    auto pEntry0 = Preprocess(IsNew0);
+    ASSERT_NE(pEntry0, nullptr);
+    EXPECT_TRUE(IsNew0);
+
+    // Entries that failed to preprocess are not shared
+    bool IsNew1  = false;
+    auto pEntry1 = Preprocess(IsNew1);
+    EXPECT_TRUE(IsNew1);
+    EXPECT_NE(pEntry0, pEntry1);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{0});
+
+    EXPECT_TRUE(pEntry0->Compile(/*Wait = */ true));
+    EXPECT_FALSE(pEntry0->IsValid());
+    EXPECT_EQ(NumCalls, 1);
+}
+
+TEST(ShaderCompilationCacheVkTest, FailedCompilation)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 1\n"}});
+
+    ShaderCompilationCacheVk Cache;
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    auto TestFailure = [&](ShaderCompilationCacheVk::CompileFuncType CompileFunc, std::atomic<int>& NumCalls) {
+        std::vector<ShaderCompilationCacheVk::SPIRVEntryPtr> Entries;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            bool IsNew = false;
+            Entries.emplace_back(Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, CompileFunc, IsNew));
+            EXPECT_EQ(IsNew, i == 0);
+        }
+
+        EXPECT_TRUE(Entries[0]->Compile(/*Wait = */ true));
+        for (const auto& pEntry : Entries)
+        {
+            EXPECT_EQ(pEntry, Entries[0]);
+            // Other shaders must not try to compile the entry again
+            EXPECT_TRUE(pEntry->Compile(/*Wait = */ false));
+            EXPECT_TRUE(pEntry->IsCompiled());
+            EXPECT_FALSE(pEntry->IsValid());
+            EXPECT_TRUE(pEntry->GetSPIRV().empty());
+        }
+        EXPECT_EQ(NumCalls, 1);
+    };
+
+    {
+        std::atomic<int> NumCalls{0};
+        TestFailure(
+            [&NumCalls](const ShaderCreateInfo&) {
+                ++NumCalls;
+                return std::vector<uint32_t>{};
+            },
+            NumCalls);
+    }
+
+    {
+        std::atomic<int> NumCalls{0};
+        TestFailure(
+            [&NumCalls](const ShaderCreateInfo&) -> std::vector<uint32_t> {
+                ++NumCalls;
+                throw std::runtime_error{"Compilation failed"};
+            },
+            NumCalls);
+    }
+}
+
+TEST(ShaderCompilationCacheVkTest, ConcurrentRequests)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 1\n"}});
+
+    ShaderCompilationCacheVk Cache;
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    ShaderMacroHelper Macros;
+    Macros.Add("MACRO", 1);
+
+    ShaderCreateInfo ShaderCI2 = ShaderCI;
+    ShaderCI2.Macros           = Macros;
+
+    constexpr size_t NumThreads = 8;
+
+    std::atomic<int> NumCalls{0};
+    std::atomic<int> NumNewEntries{0};
+
+    std::vector<ShaderCompilationCacheVk::SPIRVEntryPtr> Entries(NumThreads);
+    std::vector<std::thread>                             Threads;
+    std::atomic<bool>                                    Start{false};
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            while (!Start)
+                std::this_thread::yield();
+
+            // Odd threads create the permutation with a different macro
+            bool IsNew = false;
+            Entries[t] = Cache.Preprocess(t % 2 == 0 ? ShaderCI : ShaderCI2, SHADER_COMPILER_DEFAULT, GetCompileFunc(NumCalls), IsNew);
+            if (IsNew)
+                ++NumNewEntries;
+
+            // Every thread tries to compile the entry, and those that don't win wait for the result
+            EXPECT_TRUE(Entries[t]->Compile(/*Wait = */ true));
+            EXPECT_TRUE(Entries[t]->IsValid());
+        });
+    }
+    Start = true;
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    // Every permutation is compiled once
+    EXPECT_EQ(NumNewEntries, 2);
+    EXPECT_EQ(NumCalls, 2);
+    EXPECT_EQ(Cache.GetEntryCount(), size_t{2});
+    EXPECT_NE(Entries[0], Entries[1]);
+    for (size_t t = 2; t < NumThreads; ++t)
+        EXPECT_EQ(Entries[t], Entries[t % 2]);
+}
+
+// Replicates asynchronous shader creation: the task of the shader that shares the entry
+// waits while another thread compiles it instead of being requeued by the thread pool.
+TEST(ShaderCompilationCacheVkTest, AsyncCompilation)
+{
+    auto pFactory = CreateMemoryShaderSourceFactory({{"Common.h", "#define VALUE 1\n"}});
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    ShaderCompilationCacheVk Cache;
+
+    ShaderCreateInfo ShaderCI           = GetTestShaderCI();
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+
+    std::atomic<int>  NumCalls{0};
+    std::atomic<bool> CompilationStarted{false};
+    std::atomic<bool> WaitStarted{false};
+
+    auto CompileFunc = [&](const ShaderCreateInfo&) {
+        ++NumCalls;
+        CompilationStarted.store(true);
+        // Do not finish until the other task has started waiting for the compilation
+        while (!WaitStarted.load())
+            std::this_thread::yield();
+        return std::vector<uint32_t>{0x07230203, 1, 2, 3};
+    };
+
+    bool IsNew0  = false;
+    auto pEntry0 = Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, CompileFunc, IsNew0);
+    EXPECT_TRUE(IsNew0);
+
+    bool IsNew1  = true;
+    auto pEntry1 = Cache.Preprocess(ShaderCI, SHADER_COMPILER_DEFAULT, GetCompileFunc(NumCalls), IsNew1);
+    EXPECT_FALSE(IsNew1);
+    ASSERT_EQ(pEntry0, pEntry1);
+
+    EnqueueAsyncWork(pThreadPool,
+                     [pEntry0](Uint32 ThreadId) {
+                         EXPECT_TRUE(pEntry0->Compile(/*Wait = */ false));
+                         return ASYNC_TASK_STATUS_COMPLETE;
+                     });
+
+    while (!CompilationStarted.load())
+        std::this_thread::yield();
+
+    std::atomic<int> NumRuns{0};
+
+    bool IsValid = false;
+    EnqueueAsyncWork(pThreadPool,
+                     [&, pEntry1](Uint32 ThreadId) {
+                         ++NumRuns;
+                         EXPECT_FALSE(pEntry1->IsCompiled());
+                         WaitStarted.store(true);
+                         EXPECT_TRUE(pEntry1->Compile(/*Wait = */ true));
+                         IsValid = pEntry1->IsValid();
+                         return ASYNC_TASK_STATUS_COMPLETE;
+                     });
+
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_EQ(NumCalls, 1);
+    EXPECT_EQ(NumRuns, 1);
+    EXPECT_TRUE(IsValid);
+    EXPECT_EQ(pEntry1->GetSPIRV(), (std::vector<uint32_t>{0x07230203, 1, 2, 3}));
+}
+
+} // namespace
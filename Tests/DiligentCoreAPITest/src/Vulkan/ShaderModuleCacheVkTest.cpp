@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderModuleCacheVk.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+// Returns a wrapper that does not own the module, so that the test does not need a device
+VulkanUtilities::ShaderModuleWrapper CreateTestShaderModule(uintptr_t Id)
+{
+    // Non-dispatchable handles are pointers on 64-bit platforms and integers on 32-bit platforms
+    return VulkanUtilities::ShaderModuleWrapper{(VkShaderModule)Id};
+}
+
+TEST(ShaderModuleCacheVkTest, PipelinesShareModule)
+{
+    std::atomic<int> NumCreated{0};
+
+    const auto CreateModule = [&](const std::vector<uint32_t>&) {
+        return CreateTestShaderModule(++NumCreated);
+    };
+
+    // The cache is shared by the pipelines in the batch, and every pipeline
+    // releases its reference once it has been initialized.
+    auto pCache = std::make_shared<ShaderModuleCacheVk>();
+
+    // Every pipeline patches its own copy of the byte code of the same shader
+    const std::vector<uint32_t> PSO0_VS = {0x07230203, 1, 2, 3};
+    const std::vector<uint32_t> PSO1_VS = {0x07230203, 1, 2, 3};
+    const std::vector<uint32_t> PSO1_PS = {0x07230203, 4, 5, 6};
+
+    const VkShaderModule PSO0_VSModule = pCache->GetShaderModule(PSO0_VS, CreateModule);
+    const VkShaderModule PSO1_VSModule = pCache->GetShaderModule(PSO1_VS, CreateModule);
+    EXPECT_NE(PSO0_VSModule, VK_NULL_HANDLE);
+    EXPECT_EQ(PSO0_VSModule, PSO1_VSModule);
+    EXPECT_EQ(NumCreated, 1);
+
+    // Different byte code gets its own module
+    const VkShaderModule PSO1_PSModule = pCache->GetShaderModule(PSO1_PS, CreateModule);
+    EXPECT_NE(PSO1_PSModule, PSO0_VSModule);
+    EXPECT_EQ(NumCreated, 2);
+    EXPECT_EQ(pCache->GetModuleCount(), size_t{2});
+}
+
+TEST(ShaderModuleCacheVkTest, HashCollision)
+{
+    std::atomic<int> NumCreated{0};
+
+    ShaderModuleCacheVk Cache;
+
+    // Byte code of different sizes whose prefixes are identical must not be confused
+    const std::vector<uint32_t> SPIRV0 = {0x07230203, 1, 2};
+    const std::vector<uint32_t> SPIRV1 = {0x07230203, 1, 2, 0};
+
+    const auto CreateModule = [&](const std::vector<uint32_t>&) {
+        return CreateTestShaderModule(++NumCreated);
+    };
+
+    const VkShaderModule Module0 = Cache.GetShaderModule(SPIRV0, CreateModule);
+    const VkShaderModule Module1 = Cache.GetShaderModule(SPIRV1, CreateModule);
+    EXPECT_NE(Module0, Module1);
+    EXPECT_EQ(Cache.GetShaderModule(SPIRV0, CreateModule), Module0);
+    EXPECT_EQ(Cache.GetShaderModule(SPIRV1, CreateModule), Module1);
+    EXPECT_EQ(Cache.GetModuleCount(), size_t{2});
+}
+
+TEST(ShaderModuleCacheVkTest, ParallelPipelines)
+{
+    std::atomic<int> NumCreated{0};
+
+    ShaderModuleCacheVk Cache;
+
+    constexpr size_t NumThreads   = 8;
+    constexpr int    NumPipelines = 64;
+
+    const auto CreateModule = [&](const std::vector<uint32_t>&) {
+        return CreateTestShaderModule(++NumCreated);
+    };
+
+    // Pipelines in the batch are initialized in parallel by the compilation thread pool
+    std::vector<std::thread>    Threads;
+    std::vector<VkShaderModule> Modules(NumThreads * NumPipelines);
+    std::atomic<bool>           Start{false};
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            while (!Start)
+                std::this_thread::yield();
+
+            for (int i = 0; i < NumPipelines; ++i)
+            {
+                // Pipelines with the same index use the same shader
+                const std::vector<uint32_t> SPIRV{0x07230203, static_cast<uint32_t>(i)};
+
+                Modules[t * NumPipelines + i] = Cache.GetShaderModule(SPIRV, CreateModule);
+            }
+        });
+    }
+    Start = true;
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    // Modules created by threads that lost the race are not added to the cache
+    EXPECT_EQ(Cache.GetModuleCount(), size_t{NumPipelines});
+    for (size_t t = 1; t < NumThreads; ++t)
+    {
+        for (int i = 0; i < NumPipelines; ++i)
+            EXPECT_EQ(Modules[t * NumPipelines + i], Modules[i]);
+    }
+}
+
+} // namespace
@@ -84,4 +84,5 @@ void TestShaderResourceBindingC_API(struct IShaderResourceBinding* pSRB)
 {
     struct IResourceMapping* pResMapping = NULL;
     IShaderResourceBinding_BindResources(pSRB, SHADER_TYPE_VERTEX, pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+    IShaderResourceBinding_SetVariables(pSRB, NULL, 0);
 }
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "RenderDevice.h"
+#include "DeviceContext.h"
+#include "RefCntAutoPtr.hpp"
+#if ARCHIVER_SUPPORTED
+#    include "ArchiverFactory.h"
+#endif
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+/// Owns the render device used by the benchmarks.
+
+/// Only backends that can be created without a window are supported:
+/// null, Direct3D11, Direct3D12 and Vulkan (including software adapters such as WARP or lavapipe).
+class BenchmarkEnvironment
+{
+public:
+    struct CreateInfo
+    {
+        RENDER_DEVICE_TYPE DeviceType      = RENDER_DEVICE_TYPE_UNDEFINED;
+        ADAPTER_TYPE       AdapterType     = ADAPTER_TYPE_UNKNOWN;
+        VALIDATION_LEVEL   ValidationLevel = VALIDATION_LEVEL_DISABLED;
+    };
+
+    /// Parses --mode=<null|d3d11|d3d11_sw|d3d12|d3d12_sw|vk|vk_sw> and --validation=<level>.
+    /// If the mode is not specified, the null backend is used when available.
+    static CreateInfo ParseArgs(int argc, char** argv);
+
+    explicit BenchmarkEnvironment(const CreateInfo& CI);
+    ~BenchmarkEnvironment();
+
+    // clang-format off
+    BenchmarkEnvironment           (const BenchmarkEnvironment&)  = delete;
+    BenchmarkEnvironment           (      BenchmarkEnvironment&&) = delete;
+    BenchmarkEnvironment& operator=(const BenchmarkEnvironment&)  = delete;
+    BenchmarkEnvironment& operator=(      BenchmarkEnvironment&&) = delete;
+    // clang-format on
+
+    static BenchmarkEnvironment* GetInstance() { return m_pTheEnvironment; }
+
+    IRenderDevice*  GetDevice() { return m_pDevice; }
+    IDeviceContext* GetDeviceContext() { return m_pContext; }
+
+    RENDER_DEVICE_TYPE GetDeviceType() const { return m_pDevice->GetDeviceInfo().Type; }
+
+#if ARCHIVER_SUPPORTED
+    IArchiverFactory* GetArchiverFactory()
+    {
+        return m_ArchiverFactory;
+    }
+#endif
+
+    /// Flushes the context and releases stale resources so that the
+    /// state left by one benchmark does not affect the next one.
+    void Reset();
+
+private:
+    static BenchmarkEnvironment* m_pTheEnvironment;
+
+    RefCntAutoPtr<IRenderDevice>  m_pDevice;
+    RefCntAutoPtr<IDeviceContext> m_pContext;
+
+#if ARCHIVER_SUPPORTED
+    IArchiverFactory* m_ArchiverFactory = nullptr;
+#endif
+};
+
+} // namespace Benchmark
+
+} // namespace Diligent
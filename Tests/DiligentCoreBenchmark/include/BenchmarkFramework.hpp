@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+/// Benchmark state passed to every benchmark function.
+
+/// The benchmark function performs its setup, then runs the measured
+/// code in a loop controlled by KeepRunning():
+///
+///     DILIGENT_BENCHMARK(MyBenchmark)
+///     {
+///         // Setup (not measured)
+///         while (State.KeepRunning())
+///         {
+///             // Measured code
+///         }
+///     }
+class BenchmarkState
+{
+public:
+    explicit BenchmarkState(Uint64 MaxIterations) noexcept :
+        m_MaxIterations{MaxIterations}
+    {}
+
+    // clang-format off
+    BenchmarkState           (const BenchmarkState&)  = delete;
+    BenchmarkState           (      BenchmarkState&&) = delete;
+    BenchmarkState& operator=(const BenchmarkState&)  = delete;
+    BenchmarkState& operator=(      BenchmarkState&&) = delete;
+    // clang-format on
+
+    /// Starts the timer on the first call and returns true until
+    /// the requested number of iterations has been executed.
+    bool KeepRunning()
+    {
+        if (m_Iteration < m_MaxIterations && !m_Skipped)
+        {
+            if (m_Iteration == 0)
+                StartTimer();
+            ++m_Iteration;
+            return true;
+        }
+
+        if (m_Running)
+            StopTimer();
+        return false;
+    }
+
+    /// Excludes the code that follows from the measurement until ResumeTiming() is called.
+    void PauseTiming()
+    {
+        if (m_Running)
+            StopTimer();
+    }
+
+    /// Resumes the measurement paused by PauseTiming().
+    void ResumeTiming()
+    {
+        if (!m_Running)
+            StartTimer();
+    }
+
+    /// Sets the number of items processed by the benchmark to report the throughput.
+    void SetItemsProcessed(Uint64 Items)
+    {
+        m_ItemsProcessed = Items;
+    }
+
+    /// Marks the benchmark as skipped, e.g. when it is not supported by the device.
+    /// The measurement loop terminates on the next call to KeepRunning().
+    void SkipWithMessage(const char* Message)
+    {
+        m_Skipped    = true;
+        m_SkipReason = Message != nullptr ? Message : "";
+    }
+
+    Uint64 GetIteration() const { return m_Iteration; }
+    Uint64 GetMaxIterations() const { return m_MaxIterations; }
+    Uint64 GetItemsProcessed() const { return m_ItemsProcessed; }
+
+    bool               IsSkipped() const { return m_Skipped; }
+    const std::string& GetSkipReason() const { return m_SkipReason; }
+
+    /// Returns the measured wall-clock time, in seconds.
+    double GetRealTime() const { return m_RealTime; }
+
+    /// Returns the measured process CPU time, in seconds.
+    double GetCPUTime() const { return m_CPUTime; }
+
+private:
+    void StartTimer()
+    {
+        m_Running       = true;
+        m_RealStartTime = std::chrono::high_resolution_clock::now();
+        m_CPUStartTime  = std::clock();
+    }
+
+    void StopTimer()
+    {
+        const auto CPUEndTime  = std::clock();
+        const auto RealEndTime = std::chrono::high_resolution_clock::now();
+
+        m_RealTime += std::chrono::duration<double>(RealEndTime - m_RealStartTime).count();
+        m_CPUTime += static_cast<double>(CPUEndTime - m_CPUStartTime) / CLOCKS_PER_SEC;
+        m_Running = false;
+    }
+
+private:
+    const Uint64 m_MaxIterations;
+
+    Uint64 m_Iteration      = 0;
+    Uint64 m_ItemsProcessed = 0;
+
+    bool        m_Running = false;
+    bool        m_Skipped = false;
+    std::string m_SkipReason;
+
+    std::chrono::high_resolution_clock::time_point m_RealStartTime;
+    std::clock_t                                   m_CPUStartTime = 0;
+
+    double m_RealTime = 0;
+    double m_CPUTime  = 0;
+};
+
+using BenchmarkFunctionType = void (*)(BenchmarkState& State);
+
+/// Registers the benchmark function. Called by the DILIGENT_BENCHMARK macro.
+bool RegisterBenchmark(const char* Name, BenchmarkFunctionType Func);
+
+/// Benchmark runner settings.
+struct BenchmarkRunSettings
+{
+    /// Only benchmarks whose names contain this substring are executed.
+    /// An empty string runs all benchmarks.
+    std::string Filter;
+
+    /// The minimum time, in seconds, each repetition must run.
+    /// The number of iterations is increased until this time is reached.
+    double MinTime = 0.5;
+
+    /// Fixed number of iterations. When non-zero, MinTime is ignored.
+    Uint64 Iterations = 0;
+
+    /// The number of times each benchmark is repeated.
+    /// When greater than one, mean, median and standard deviation are reported.
+    Uint32 Repetitions = 3;
+
+    /// Path to the JSON report file. If empty, the report is not written.
+    std::string OutputFile;
+
+    /// Whether to print the JSON report to stdout instead of the console table.
+    bool JSONToStdout = false;
+
+    /// Additional key-value pairs written to the "context" section of the report.
+    std::vector<std::pair<std::string, std::string>> Context;
+
+    /// Function called after every benchmark run, e.g. to release stale resources.
+    void (*OnRunFinished)() = nullptr;
+};
+
+/// Parses the command line arguments recognized by the runner:
+///
+///     --filter=<substring>
+///     --min_time=<seconds>
+///     --iterations=<count>
+///     --repetitions=<count>
+///     --out=<file.json>
+///     --format=json
+///
+/// Unrecognized arguments are ignored.
+void ParseBenchmarkArgs(int argc, char** argv, BenchmarkRunSettings& Settings);
+
+/// Runs all registered benchmarks that match the filter and writes the report.
+/// The report uses the Google Benchmark JSON schema so that the results can be
+/// compared with the standard tools (e.g. compare.py).
+///
+/// \return     Zero on success, or a non-zero value if the report could not be written.
+int RunBenchmarks(const BenchmarkRunSettings& Settings);
+
+} // namespace Benchmark
+
+} // namespace Diligent
+
+/// Defines and registers a benchmark function.
+#define DILIGENT_BENCHMARK(Name)                                                               \
+    static void       Name(Diligent::Benchmark::BenchmarkState& State);                        \
+    static const bool Name##_Registered = Diligent::Benchmark::RegisterBenchmark(#Name, Name); \
+    static void       Name(Diligent::Benchmark::BenchmarkState& State)
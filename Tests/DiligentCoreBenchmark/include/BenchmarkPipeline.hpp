@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include "PipelineState.h"
+#include "Shader.h"
+#include "GraphicsTypes.h"
+#include "DebugUtilities.hpp"
+
+#include "InlineShaders/BenchmarkShadersHLSL.h"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+/// Returns the create info of the benchmark shader of the given type.
+inline ShaderCreateInfo GetBenchmarkShaderCI(SHADER_TYPE ShaderType)
+{
+    VERIFY_EXPR(ShaderType == SHADER_TYPE_VERTEX || ShaderType == SHADER_TYPE_PIXEL);
+
+    const auto& Source = ShaderType == SHADER_TYPE_VERTEX ? HLSL::Benchmark_VS : HLSL::Benchmark_PS;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                          = Source.c_str();
+    ShaderCI.SourceLength                    = Source.length();
+    ShaderCI.SourceLanguage                  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint                      = "main";
+    ShaderCI.Desc.Name                       = ShaderType == SHADER_TYPE_VERTEX ? "Benchmark VS" : "Benchmark PS";
+    ShaderCI.Desc.ShaderType                 = ShaderType;
+    ShaderCI.Desc.UseCombinedTextureSamplers = true;
+    return ShaderCI;
+}
+
+/// Returns the create info of the benchmark graphics pipeline.
+/// The shaders must be set by the caller.
+inline GraphicsPipelineStateCreateInfo GetBenchmarkPipelineCI(const char* Name)
+{
+    // clang-format off
+    static constexpr LayoutElement LayoutElems[] =
+    {
+        LayoutElement{0, 0, 3, VT_FLOAT32},
+        LayoutElement{1, 0, 2, VT_FLOAT32}
+    };
+    static constexpr ShaderResourceVariableDesc Variables[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE}
+    };
+    static constexpr ImmutableSamplerDesc ImmutableSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_Texture", SamplerDesc{}}
+    };
+    // clang-format on
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = Name;
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+    auto& ResLayout                = PSOCreateInfo.PSODesc.ResourceLayout;
+    ResLayout.DefaultVariableType  = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+    ResLayout.Variables            = Variables;
+    ResLayout.NumVariables         = _countof(Variables);
+    ResLayout.ImmutableSamplers    = ImmutableSamplers;
+    ResLayout.NumImmutableSamplers = _countof(ImmutableSamplers);
+
+    auto& GraphicsPipeline                        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM;
+    GraphicsPipeline.DSVFormat                    = TEX_FORMAT_D32_FLOAT;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.InputLayout.LayoutElements   = LayoutElems;
+    GraphicsPipeline.InputLayout.NumElements      = _countof(LayoutElems);
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_BACK;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = True;
+
+    return PSOCreateInfo;
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
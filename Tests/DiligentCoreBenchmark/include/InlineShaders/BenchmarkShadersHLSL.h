@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+namespace
+{
+
+namespace HLSL
+{
+
+// clang-format off
+const std::string Benchmark_VS{
+R"(
+cbuffer cbConstants
+{
+    float4x4 g_WorldViewProj;
+};
+
+struct VSInput
+{
+    float3 Pos : ATTRIB0;
+    float2 UV  : ATTRIB1;
+};
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+void main(in  VSInput VSIn,
+          out PSInput PSIn)
+{
+    PSIn.Pos = mul(float4(VSIn.Pos, 1.0), g_WorldViewProj);
+    PSIn.UV  = VSIn.UV;
+}
+)"
+};
+
+const std::string Benchmark_PS{
+R"(
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+    float2 UV  : TEX_COORD;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return g_Texture.Sample(g_Texture_sampler, PSIn.UV);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+} // namespace
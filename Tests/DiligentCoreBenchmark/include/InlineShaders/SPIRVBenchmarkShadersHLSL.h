@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+namespace
+{
+
+namespace HLSL
+{
+
+// Shaders used by the SPIR-V benchmarks. They are representative of the shaders
+// found in typical applications: a skinned mesh vertex shader, a PBR material
+// pixel shader and compute shaders that write to storage images.
+
+// clang-format off
+const std::string SPIRVBenchmark_SkinnedVS{
+R"(
+cbuffer cbCameraAttribs
+{
+    float4x4 g_ViewProj;
+    float4x4 g_PrevViewProj;
+    float4   g_CameraPos;
+};
+
+cbuffer cbJointTransforms
+{
+    float4x4 g_Joints[64];
+};
+
+struct VSInput
+{
+    float3 Pos     : ATTRIB0;
+    float3 Normal  : ATTRIB1;
+    float2 UV0     : ATTRIB2;
+    float2 UV1     : ATTRIB3;
+    float4 Joint0  : ATTRIB4;
+    float4 Weight0 : ATTRIB5;
+    float4 Tangent : ATTRIB6;
+};
+
+struct VSOutput
+{
+    float4 ClipPos  : SV_Position;
+    float3 WorldPos : WORLD_POS;
+    float3 Normal   : NORMAL;
+    float4 Tangent  : TANGENT;
+    float2 UV0      : UV0;
+    float2 UV1      : UV1;
+    uint   InstID   : INSTANCE_ID;
+};
+
+void main(in  VSInput  VSIn,
+          in  uint     InstID : SV_InstanceID,
+          out VSOutput VSOut)
+{
+    float4x4 Skin =
+        g_Joints[int(VSIn.Joint0.x)] * VSIn.Weight0.x +
+        g_Joints[int(VSIn.Joint0.y)] * VSIn.Weight0.y +
+        g_Joints[int(VSIn.Joint0.z)] * VSIn.Weight0.z +
+        g_Joints[int(VSIn.Joint0.w)] * VSIn.Weight0.w;
+
+    float4 WorldPos = mul(float4(VSIn.Pos, 1.0), Skin);
+    VSOut.ClipPos   = mul(WorldPos, g_ViewProj);
+    VSOut.WorldPos  = WorldPos.xyz;
+    VSOut.Normal    = normalize(mul(float4(VSIn.Normal, 0.0), Skin).xyz);
+    VSOut.Tangent   = float4(normalize(mul(float4(VSIn.Tangent.xyz, 0.0), Skin).xyz), VSIn.Tangent.w);
+    VSOut.UV0       = VSIn.UV0;
+    VSOut.UV1       = VSIn.UV1;
+    VSOut.InstID    = InstID;
+}
+)"
+};
+
+const std::string SPIRVBenchmark_MaterialPS{
+R"(
+cbuffer cbMaterialAttribs
+{
+    float4 g_BaseColorFactor;
+    float4 g_EmissiveFactor;
+    float  g_MetallicFactor;
+    float  g_RoughnessFactor;
+    float  g_OcclusionStrength;
+    float  g_AlphaCutoff;
+};
+
+cbuffer cbLightAttribs
+{
+    float4 g_LightDirection;
+    float4 g_LightIntensity;
+};
+
+Texture2D    g_BaseColorMap;
+SamplerState g_BaseColorMap_sampler;
+Texture2D    g_NormalMap;
+SamplerState g_NormalMap_sampler;
+Texture2D    g_PhysicalDescriptorMap;
+SamplerState g_PhysicalDescriptorMap_sampler;
+Texture2D    g_OcclusionMap;
+SamplerState g_OcclusionMap_sampler;
+Texture2D    g_EmissiveMap;
+SamplerState g_EmissiveMap_sampler;
+TextureCube  g_IrradianceMap;
+SamplerState g_IrradianceMap_sampler;
+TextureCube  g_PrefilteredEnvMap;
+SamplerState g_PrefilteredEnvMap_sampler;
+Texture2D    g_BRDF_LUT;
+SamplerState g_BRDF_LUT_sampler;
+
+struct PSInput
+{
+    float4 ClipPos  : SV_Position;
+    float3 WorldPos : WORLD_POS;
+    float3 Normal   : NORMAL;
+    float4 Tangent  : TANGENT;
+    float2 UV0      : UV0;
+    float2 UV1      : UV1;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    float4 BaseColor = g_BaseColorMap.Sample(g_BaseColorMap_sampler, PSIn.UV0) * g_BaseColorFactor;
+    clip(BaseColor.a - g_AlphaCutoff);
+
+    float3 TSNormal  = g_NormalMap.Sample(g_NormalMap_sampler, PSIn.UV0).xyz * 2.0 - 1.0;
+    float3 Bitangent = cross(PSIn.Normal, PSIn.Tangent.xyz) * PSIn.Tangent.w;
+    float3 N         = normalize(TSNormal.x * PSIn.Tangent.xyz + TSNormal.y * Bitangent + TSNormal.z * PSIn.Normal);
+
+    float4 PhysDesc  = g_PhysicalDescriptorMap.Sample(g_PhysicalDescriptorMap_sampler, PSIn.UV0);
+    float  Roughness = saturate(PhysDesc.g * g_RoughnessFactor);
+    float  Metallic  = saturate(PhysDesc.b * g_MetallicFactor);
+    float  Occlusion = lerp(1.0, g_OcclusionMap.Sample(g_OcclusionMap_sampler, PSIn.UV1).r, g_OcclusionStrength);
+
+    float3 V     = normalize(-PSIn.WorldPos);
+    float  NdotV = saturate(dot(N, V));
+    float2 BRDF  = g_BRDF_LUT.Sample(g_BRDF_LUT_sampler, float2(NdotV, Roughness)).rg;
+
+    float3 F0       = lerp(float3(0.04, 0.04, 0.04), BaseColor.rgb, Metallic);
+    float3 Diffuse  = g_IrradianceMap.Sample(g_IrradianceMap_sampler, N).rgb * BaseColor.rgb * (1.0 - Metallic);
+    float3 Specular = g_PrefilteredEnvMap.SampleLevel(g_PrefilteredEnvMap_sampler, reflect(-V, N), Roughness * 8.0).rgb * (F0 * BRDF.x + BRDF.y);
+
+    float  NdotL  = saturate(dot(N, -g_LightDirection.xyz));
+    float3 Color  = (Diffuse + Specular) * Occlusion + BaseColor.rgb * NdotL * g_LightIntensity.rgb;
+    Color        += g_EmissiveMap.Sample(g_EmissiveMap_sampler, PSIn.UV0).rgb * g_EmissiveFactor.rgb;
+
+    return float4(Color, BaseColor.a);
+}
+)"
+};
+
+const std::string SPIRVBenchmark_DownsampleCS{
+R"(
+cbuffer cbDownsampleAttribs
+{
+    uint2 g_SrcSize;
+    uint  g_SrcMip;
+    uint  g_NumMips;
+};
+
+Texture2D<float4>                            g_SrcTexture;
+RWTexture2D<float4 /*format=rgba16f*/>       g_DstMip0;
+RWTexture2D<float4 /*format=rgba16f*/>       g_DstMip1;
+RWTexture2D<float  /*format=r32f*/>          g_DstDepth;
+RWTexture2DArray<float4 /*format=rgba8*/>    g_DstArray;
+RWStructuredBuffer<uint>                     g_Counter;
+
+groupshared float4 g_Tile[8][8];
+
+[numthreads(8, 8, 1)]
+void main(uint3 DTid : SV_DispatchThreadID, uint3 GTid : SV_GroupThreadID)
+{
+    float4 Color = g_SrcTexture.Load(int3(min(DTid.xy * 2, g_SrcSize - 1), g_SrcMip));
+    g_DstMip0[DTid.xy] = Color;
+    g_DstDepth[DTid.xy] = Color.a;
+
+    g_Tile[GTid.y][GTid.x] = Color;
+    GroupMemoryBarrierWithGroupSync();
+
+    if ((GTid.x & 1) == 0 && (GTid.y & 1) == 0)
+    {
+        float4 Avg = (g_Tile[GTid.y][GTid.x] + g_Tile[GTid.y][GTid.x + 1] +
+                      g_Tile[GTid.y + 1][GTid.x] + g_Tile[GTid.y + 1][GTid.x + 1]) * 0.25;
+        g_DstMip1[DTid.xy / 2] = Avg;
+        g_DstArray[uint3(DTid.xy / 2, g_NumMips)] = Avg;
+        InterlockedAdd(g_Counter[0], 1);
+    }
+}
+)"
+};
+
+const std::string SPIRVBenchmark_ParticlesCS{
+R"(
+struct Particle
+{
+    float3 Pos;
+    float  Age;
+    float3 Vel;
+    float  Size;
+};
+
+cbuffer cbSimulationAttribs
+{
+    float4 g_Gravity;
+    float  g_DeltaTime;
+    uint   g_NumParticles;
+};
+
+RWStructuredBuffer<Particle>          g_Particles;
+RWBuffer<uint /*format=r32ui*/>       g_ParticleListHead;
+Buffer<float4>                        g_ForceField;
+Texture3D<float4>                     g_VelocityField;
+SamplerState                          g_VelocityField_sampler;
+RWTexture3D<float /*format=r32f*/>    g_DensityField;
+
+[numthreads(64, 1, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    if (DTid.x >= g_NumParticles)
+        return;
+
+    Particle P = g_Particles[DTid.x];
+    float3   Field = g_VelocityField.SampleLevel(g_VelocityField_sampler, P.Pos * 0.5 + 0.5, 0).xyz;
+    P.Vel += (g_Gravity.xyz + g_ForceField[DTid.x % 16].xyz + Field) * g_DeltaTime;
+    P.Pos += P.Vel * g_DeltaTime;
+    P.Age += g_DeltaTime;
+    g_Particles[DTid.x] = P;
+
+    uint3 Cell = uint3(saturate(P.Pos * 0.5 + 0.5) * 63.0);
+    g_DensityField[Cell] = P.Size;
+    InterlockedAdd(g_ParticleListHead[Cell.x], 1);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+} // namespace
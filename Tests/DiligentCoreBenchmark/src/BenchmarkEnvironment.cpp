@@ -0,0 +1,293 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkEnvironment.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
+#if D3D11_SUPPORTED
+#    include "EngineFactoryD3D11.h"
+#endif
+
+#if D3D12_SUPPORTED
+#    include "EngineFactoryD3D12.h"
+#endif
+
+#if VULKAN_SUPPORTED
+#    include "EngineFactoryVk.h"
+#endif
+
+#if ARCHIVER_SUPPORTED
+#    include "ArchiverFactoryLoader.h"
+#endif
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+BenchmarkEnvironment* BenchmarkEnvironment::m_pTheEnvironment = nullptr;
+
+namespace
+{
+
+#if D3D11_SUPPORTED || D3D12_SUPPORTED || VULKAN_SUPPORTED
+Uint32 FindAdapter(IEngineFactory* pFactory, Version MinVersion, ADAPTER_TYPE AdapterType)
+{
+    if (AdapterType == ADAPTER_TYPE_UNKNOWN)
+        return DEFAULT_ADAPTER_ID;
+
+    Uint32 NumAdapters = 0;
+    pFactory->EnumerateAdapters(MinVersion, NumAdapters, nullptr);
+    std::vector<GraphicsAdapterInfo> Adapters(NumAdapters);
+    if (NumAdapters > 0)
+        pFactory->EnumerateAdapters(MinVersion, NumAdapters, Adapters.data());
+
+    for (Uint32 i = 0; i < NumAdapters; ++i)
+    {
+        if (Adapters[i].Type == AdapterType)
+            return i;
+    }
+
+    LOG_WARNING_MESSAGE("Unable to find a ", GetAdapterTypeString(AdapterType), " adapter. Default adapter will be used");
+    return DEFAULT_ADAPTER_ID;
+}
+#endif
+
+} // namespace
+
+BenchmarkEnvironment::CreateInfo BenchmarkEnvironment::ParseArgs(int argc, char** argv)
+{
+    CreateInfo CI;
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--mode=null") == 0)
+        {
+            CI.DeviceType = RENDER_DEVICE_TYPE_NULL;
+        }
+        else if (strcmp(arg, "--mode=d3d11") == 0)
+        {
+            CI.DeviceType = RENDER_DEVICE_TYPE_D3D11;
+        }
+        else if (strcmp(arg, "--mode=d3d11_sw") == 0)
+        {
+            CI.DeviceType  = RENDER_DEVICE_TYPE_D3D11;
+            CI.AdapterType = ADAPTER_TYPE_SOFTWARE;
+        }
+        else if (strcmp(arg, "--mode=d3d12") == 0)
+        {
+            CI.DeviceType = RENDER_DEVICE_TYPE_D3D12;
+        }
+        else if (strcmp(arg, "--mode=d3d12_sw") == 0)
+        {
+            CI.DeviceType  = RENDER_DEVICE_TYPE_D3D12;
+            CI.AdapterType = ADAPTER_TYPE_SOFTWARE;
+        }
+        else if (strcmp(arg, "--mode=vk") == 0)
+        {
+            CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+        }
+        else if (strcmp(arg, "--mode=vk_sw") == 0)
+        {
+            CI.DeviceType  = RENDER_DEVICE_TYPE_VULKAN;
+            CI.AdapterType = ADAPTER_TYPE_SOFTWARE;
+        }
+        else if (strncmp(arg, "--validation=", 13) == 0)
+        {
+            const int Level    = std::atoi(arg + 13);
+            CI.ValidationLevel = static_cast<VALIDATION_LEVEL>(std::min(std::max(Level, 0), static_cast<int>(VALIDATION_LEVEL_2)));
+        }
+    }
+
+    if (CI.DeviceType == RENDER_DEVICE_TYPE_UNDEFINED)
+    {
+#if NULL_SUPPORTED
+        CI.DeviceType = RENDER_DEVICE_TYPE_NULL;
+#elif VULKAN_SUPPORTED
+        CI.DeviceType = RENDER_DEVICE_TYPE_VULKAN;
+#elif D3D12_SUPPORTED
+        CI.DeviceType = RENDER_DEVICE_TYPE_D3D12;
+#elif D3D11_SUPPORTED
+        CI.DeviceType = RENDER_DEVICE_TYPE_D3D11;
+#endif
+    }
+
+    return CI;
+}
+
+BenchmarkEnvironment::BenchmarkEnvironment(const CreateInfo& CI)
+{
+    VERIFY(m_pTheEnvironment == nullptr, "Benchmark environment has already been created");
+
+    IDeviceContext** ppContext = &m_pContext;
+    switch (CI.DeviceType)
+    {
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            auto GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            EngineNullCreateInfo EngineCI;
+            EngineCI.SetValidationLevel(CI.ValidationLevel);
+            GetEngineFactoryNull()->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, ppContext);
+        }
+        break;
+#endif
+
+#if D3D11_SUPPORTED
+        case RENDER_DEVICE_TYPE_D3D11:
+        {
+#    if ENGINE_DLL
+            auto GetEngineFactoryD3D11 = LoadGraphicsEngineD3D11();
+            if (GetEngineFactoryD3D11 == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            auto* pFactoryD3D11 = GetEngineFactoryD3D11();
+
+            EngineD3D11CreateInfo EngineCI;
+            EngineCI.GraphicsAPIVersion = Version{11, 0};
+            EngineCI.SetValidationLevel(CI.ValidationLevel);
+            EngineCI.AdapterId = FindAdapter(pFactoryD3D11, EngineCI.GraphicsAPIVersion, CI.AdapterType);
+            pFactoryD3D11->CreateDeviceAndContextsD3D11(EngineCI, &m_pDevice, ppContext);
+        }
+        break;
+#endif
+
+#if D3D12_SUPPORTED
+        case RENDER_DEVICE_TYPE_D3D12:
+        {
+#    if ENGINE_DLL
+            auto GetEngineFactoryD3D12 = LoadGraphicsEngineD3D12();
+            if (GetEngineFactoryD3D12 == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            auto* pFactoryD3D12 = GetEngineFactoryD3D12();
+            if (!pFactoryD3D12->LoadD3D12())
+            {
+                LOG_ERROR_AND_THROW("Failed to load d3d12 dll");
+            }
+
+            EngineD3D12CreateInfo EngineCI;
+            EngineCI.GraphicsAPIVersion = Version{11, 0};
+            EngineCI.SetValidationLevel(CI.ValidationLevel);
+            EngineCI.AdapterId = FindAdapter(pFactoryD3D12, EngineCI.GraphicsAPIVersion, CI.AdapterType);
+            pFactoryD3D12->CreateDeviceAndContextsD3D12(EngineCI, &m_pDevice, ppContext);
+        }
+        break;
+#endif
+
+#if VULKAN_SUPPORTED
+        case RENDER_DEVICE_TYPE_VULKAN:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_VK_DLL
+            auto GetEngineFactoryVk = LoadGraphicsEngineVk();
+            if (GetEngineFactoryVk == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            auto* pFactoryVk = GetEngineFactoryVk();
+
+            EngineVkCreateInfo EngineCI;
+            EngineCI.SetValidationLevel(CI.ValidationLevel);
+            EngineCI.AdapterId = FindAdapter(pFactoryVk, Version{}, CI.AdapterType);
+            pFactoryVk->CreateDeviceAndContextsVk(EngineCI, &m_pDevice, ppContext);
+        }
+        break;
+#endif
+
+        default:
+            LOG_ERROR_AND_THROW("Device type ", GetRenderDeviceTypeString(CI.DeviceType),
+                                " is not supported by the benchmarks or can't be created without a window");
+    }
+
+    if (!m_pDevice || !m_pContext)
+    {
+        LOG_ERROR_AND_THROW("Failed to create ", GetRenderDeviceTypeString(CI.DeviceType), " device");
+    }
+
+#if ARCHIVER_SUPPORTED
+    {
+#    if EXPLICITLY_LOAD_ARCHIVER_FACTORY_DLL
+        auto GetArchiverFactory = LoadArchiverFactory();
+        if (GetArchiverFactory != nullptr)
+        {
+            m_ArchiverFactory = GetArchiverFactory();
+        }
+#    else
+        m_ArchiverFactory = Diligent::GetArchiverFactory();
+#    endif
+    }
+#endif
+
+    m_pTheEnvironment = this;
+}
+
+BenchmarkEnvironment::~BenchmarkEnvironment()
+{
+    if (m_pContext)
+    {
+        m_pContext->Flush();
+        m_pContext->FinishFrame();
+    }
+    if (m_pDevice)
+        m_pDevice->IdleGPU();
+
+    m_pTheEnvironment = nullptr;
+}
+
+void BenchmarkEnvironment::Reset()
+{
+    m_pContext->Flush();
+    m_pContext->FinishFrame();
+    m_pContext->InvalidateState();
+    m_pDevice->IdleGPU();
+    m_pDevice->ReleaseStaleResources();
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
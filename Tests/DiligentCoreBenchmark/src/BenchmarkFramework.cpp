@@ -0,0 +1,421 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkFramework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmark
+{
+
+namespace
+{
+
+struct RegisteredBenchmark
+{
+    std::string           Name;
+    BenchmarkFunctionType Func = nullptr;
+};
+
+std::vector<RegisteredBenchmark>& GetRegistry()
+{
+    // Function-local static avoids static initialization order issues
+    // as benchmarks are registered during static initialization.
+    static std::vector<RegisteredBenchmark> Registry;
+    return Registry;
+}
+
+struct RunResult
+{
+    std::string Name;
+    std::string RunName;
+    std::string RunType; // "iteration" or "aggregate"
+    std::string AggregateName;
+    Uint32      RepetitionIndex = 0;
+    Uint64      Iterations      = 0;
+    double      RealTimeNs      = 0; // Per iteration
+    double      CPUTimeNs       = 0; // Per iteration
+    double      ItemsPerSecond  = 0;
+    bool        Skipped         = false;
+    std::string SkipReason;
+};
+
+std::string EscapeJSONString(const std::string& Str)
+{
+    std::string Escaped;
+    Escaped.reserve(Str.size() + 2);
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\r': Escaped += "\\r"; break;
+            case '\t': Escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char Buff[8];
+                    snprintf(Buff, sizeof(Buff), "\\u%04x", static_cast<unsigned int>(c));
+                    Escaped += Buff;
+                }
+                else
+                {
+                    Escaped += c;
+                }
+        }
+    }
+    return Escaped;
+}
+
+RunResult RunOnce(const RegisteredBenchmark& Benchmark, Uint64 Iterations)
+{
+    BenchmarkState State{Iterations};
+    Benchmark.Func(State);
+
+    RunResult Result;
+    Result.Name       = Benchmark.Name;
+    Result.RunName    = Benchmark.Name;
+    Result.RunType    = "iteration";
+    Result.Iterations = State.GetIteration();
+    Result.Skipped    = State.IsSkipped();
+    Result.SkipReason = State.GetSkipReason();
+    if (Result.Iterations > 0)
+    {
+        Result.RealTimeNs = State.GetRealTime() * 1e9 / static_cast<double>(Result.Iterations);
+        Result.CPUTimeNs  = State.GetCPUTime() * 1e9 / static_cast<double>(Result.Iterations);
+    }
+    if (State.GetItemsProcessed() > 0 && State.GetRealTime() > 0)
+    {
+        Result.ItemsPerSecond = static_cast<double>(State.GetItemsProcessed()) / State.GetRealTime();
+    }
+    return Result;
+}
+
+// Finds the number of iterations that makes a single run take at least MinTime seconds.
+Uint64 CalibrateIterations(const RegisteredBenchmark& Benchmark, double MinTime, const BenchmarkRunSettings& Settings)
+{
+    constexpr Uint64 MaxIterations = 1000000000;
+
+    Uint64 Iterations = 1;
+    while (true)
+    {
+        BenchmarkState State{Iterations};
+        Benchmark.Func(State);
+        if (Settings.OnRunFinished != nullptr)
+            Settings.OnRunFinished();
+
+        if (State.IsSkipped())
+            return 0;
+
+        const double Elapsed = State.GetRealTime();
+        if (Elapsed >= MinTime || Iterations >= MaxIterations)
+            break;
+
+        // Predict the number of iterations required to reach the min time with a 40% margin,
+        // but do not grow faster than 10x per step to cope with noisy short runs.
+        double Multiplier = Elapsed > 0 ? MinTime * 1.4 / Elapsed : 10.0;
+        Multiplier        = std::min(std::max(Multiplier, 2.0), 10.0);
+        Iterations        = std::min(static_cast<Uint64>(static_cast<double>(Iterations) * Multiplier), MaxIterations);
+    }
+    return Iterations;
+}
+
+void ComputeAggregates(const std::vector<RunResult>& Runs, std::vector<RunResult>& Results)
+{
+    if (Runs.size() < 2)
+        return;
+
+    auto MakeAggregate = [&Runs](const char* AggregateName) {
+        RunResult Aggr;
+        Aggr.Name          = Runs[0].Name + "_" + AggregateName;
+        Aggr.RunName       = Runs[0].Name;
+        Aggr.RunType       = "aggregate";
+        Aggr.AggregateName = AggregateName;
+        Aggr.Iterations    = static_cast<Uint64>(Runs.size());
+        return Aggr;
+    };
+
+    const double N = static_cast<double>(Runs.size());
+
+    RunResult Mean = MakeAggregate("mean");
+    for (const auto& Run : Runs)
+    {
+        Mean.RealTimeNs += Run.RealTimeNs / N;
+        Mean.CPUTimeNs += Run.CPUTimeNs / N;
+        Mean.ItemsPerSecond += Run.ItemsPerSecond / N;
+    }
+
+    auto GetMedian = [&Runs](double RunResult::*Member) {
+        std::vector<double> Values;
+        Values.reserve(Runs.size());
+        for (const auto& Run : Runs)
+            Values.push_back(Run.*Member);
+        std::sort(Values.begin(), Values.end());
+        const size_t Mid = Values.size() / 2;
+        return (Values.size() % 2 != 0) ? Values[Mid] : (Values[Mid - 1] + Values[Mid]) * 0.5;
+    };
+    RunResult Median      = MakeAggregate("median");
+    Median.RealTimeNs     = GetMedian(&RunResult::RealTimeNs);
+    Median.CPUTimeNs      = GetMedian(&RunResult::CPUTimeNs);
+    Median.ItemsPerSecond = GetMedian(&RunResult::ItemsPerSecond);
+
+    auto GetStdDev = [&Runs, N](double RunResult::*Member, double MeanValue) {
+        double Sum = 0;
+        for (const auto& Run : Runs)
+            Sum += (Run.*Member - MeanValue) * (Run.*Member - MeanValue);
+        return std::sqrt(Sum / (N - 1));
+    };
+    RunResult StdDev      = MakeAggregate("stddev");
+    StdDev.RealTimeNs     = GetStdDev(&RunResult::RealTimeNs, Mean.RealTimeNs);
+    StdDev.CPUTimeNs      = GetStdDev(&RunResult::CPUTimeNs, Mean.CPUTimeNs);
+    StdDev.ItemsPerSecond = GetStdDev(&RunResult::ItemsPerSecond, Mean.ItemsPerSecond);
+
+    Results.push_back(std::move(Mean));
+    Results.push_back(std::move(Median));
+    Results.push_back(std::move(StdDev));
+}
+
+std::string GetCurrentDateTime()
+{
+    std::time_t Now = std::time(nullptr);
+    std::tm     LocalTime{};
+#if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+    localtime_s(&LocalTime, &Now);
+#else
+    localtime_r(&Now, &LocalTime);
+#endif
+    char Buff[64];
+    std::strftime(Buff, sizeof(Buff), "%Y-%m-%dT%H:%M:%S", &LocalTime);
+    return Buff;
+}
+
+void WriteJSONReport(std::ostream& Stream, const BenchmarkRunSettings& Settings, const std::vector<RunResult>& Results)
+{
+    Stream << std::setprecision(10);
+    Stream << "{\n";
+    Stream << "  \"context\": {\n";
+    Stream << "    \"date\": \"" << GetCurrentDateTime() << "\",\n";
+    Stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    for (const auto& KeyValue : Settings.Context)
+    {
+        Stream << "    \"" << EscapeJSONString(KeyValue.first) << "\": \"" << EscapeJSONString(KeyValue.second) << "\",\n";
+    }
+#ifdef DILIGENT_DEBUG
+    Stream << "    \"library_build_type\": \"debug\"\n";
+#else
+    Stream << "    \"library_build_type\": \"release\"\n";
+#endif
+    Stream << "  },\n";
+    Stream << "  \"benchmarks\": [";
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        const auto& Res = Results[i];
+        Stream << (i > 0 ? ",\n" : "\n");
+        Stream << "    {\n";
+        Stream << "      \"name\": \"" << EscapeJSONString(Res.Name) << "\",\n";
+        Stream << "      \"run_name\": \"" << EscapeJSONString(Res.RunName) << "\",\n";
+        Stream << "      \"run_type\": \"" << Res.RunType << "\",\n";
+        Stream << "      \"repetitions\": " << Settings.Repetitions << ",\n";
+        if (Res.RunType == "aggregate")
+            Stream << "      \"aggregate_name\": \"" << Res.AggregateName << "\",\n";
+        else
+            Stream << "      \"repetition_index\": " << Res.RepetitionIndex << ",\n";
+        if (Res.Skipped)
+        {
+            Stream << "      \"error_occurred\": true,\n";
+            Stream << "      \"error_message\": \"" << EscapeJSONString(Res.SkipReason) << "\",\n";
+        }
+        if (Res.ItemsPerSecond > 0)
+            Stream << "      \"items_per_second\": " << Res.ItemsPerSecond << ",\n";
+        Stream << "      \"iterations\": " << Res.Iterations << ",\n";
+        Stream << "      \"real_time\": " << Res.RealTimeNs << ",\n";
+        Stream << "      \"cpu_time\": " << Res.CPUTimeNs << ",\n";
+        Stream << "      \"time_unit\": \"ns\"\n";
+        Stream << "    }";
+    }
+    Stream << "\n  ]\n";
+    Stream << "}\n";
+}
+
+void PrintResult(const RunResult& Res)
+{
+    std::cout << std::left << std::setw(60) << Res.Name << std::right;
+    if (Res.Skipped)
+    {
+        std::cout << " SKIPPED: " << Res.SkipReason << '\n';
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(14) << Res.RealTimeNs << " ns"
+              << std::setw(14) << Res.CPUTimeNs << " ns"
+              << std::setw(12) << Res.Iterations;
+    if (Res.ItemsPerSecond > 0)
+        std::cout << std::setw(14) << std::setprecision(3) << Res.ItemsPerSecond / 1e6 << " M items/s";
+    std::cout << std::defaultfloat << '\n';
+}
+
+const char* GetArgValue(const char* Arg, const char* Name)
+{
+    const size_t Len = strlen(Name);
+    return strncmp(Arg, Name, Len) == 0 ? Arg + Len : nullptr;
+}
+
+} // namespace
+
+bool RegisterBenchmark(const char* Name, BenchmarkFunctionType Func)
+{
+    VERIFY_EXPR(Name != nullptr && Func != nullptr);
+    GetRegistry().push_back({Name, Func});
+    return true;
+}
+
+void ParseBenchmarkArgs(int argc, char** argv, BenchmarkRunSettings& Settings)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg = argv[i];
+        if (const char* Filter = GetArgValue(Arg, "--filter="))
+        {
+            Settings.Filter = Filter;
+        }
+        else if (const char* MinTime = GetArgValue(Arg, "--min_time="))
+        {
+            Settings.MinTime = std::max(std::atof(MinTime), 0.0);
+        }
+        else if (const char* Iterations = GetArgValue(Arg, "--iterations="))
+        {
+            Settings.Iterations = std::strtoull(Iterations, nullptr, 10);
+        }
+        else if (const char* Repetitions = GetArgValue(Arg, "--repetitions="))
+        {
+            Settings.Repetitions = std::max(std::atoi(Repetitions), 1);
+        }
+        else if (const char* OutputFile = GetArgValue(Arg, "--out="))
+        {
+            Settings.OutputFile = OutputFile;
+        }
+        else if (strcmp(Arg, "--format=json") == 0)
+        {
+            Settings.JSONToStdout = true;
+        }
+    }
+}
+
+int RunBenchmarks(const BenchmarkRunSettings& Settings)
+{
+    auto Registry = GetRegistry();
+    std::sort(Registry.begin(), Registry.end(),
+              [](const RegisteredBenchmark& lhs, const RegisteredBenchmark& rhs) {
+                  return lhs.Name < rhs.Name;
+              });
+
+    const bool PrintTable = !Settings.JSONToStdout;
+    if (PrintTable)
+    {
+        std::cout << std::left << std::setw(60) << "Benchmark" << std::right
+                  << std::setw(17) << "Time"
+                  << std::setw(17) << "CPU"
+                  << std::setw(12) << "Iterations" << '\n'
+                  << std::string(106, '-') << '\n';
+    }
+
+    std::vector<RunResult> Results;
+    for (const auto& Benchmark : Registry)
+    {
+        if (!Settings.Filter.empty() && Benchmark.Name.find(Settings.Filter) == std::string::npos)
+            continue;
+
+        Uint64 Iterations = Settings.Iterations;
+        if (Iterations == 0)
+            Iterations = CalibrateIterations(Benchmark, Settings.MinTime, Settings);
+
+        std::vector<RunResult> Runs;
+        for (Uint32 rep = 0; rep < std::max(Settings.Repetitions, 1u); ++rep)
+        {
+            // Calibration returns zero iterations for skipped benchmarks; run once to get the reason.
+            RunResult Res = RunOnce(Benchmark, std::max(Iterations, Uint64{1}));
+            if (Settings.OnRunFinished != nullptr)
+                Settings.OnRunFinished();
+
+            Res.RepetitionIndex = rep;
+            if (PrintTable)
+                PrintResult(Res);
+
+            const bool Skipped = Res.Skipped;
+            Runs.push_back(std::move(Res));
+            if (Skipped)
+                break;
+        }
+
+        Results.insert(Results.end(), Runs.begin(), Runs.end());
+        if (!Runs.back().Skipped)
+        {
+            const size_t NumResults = Results.size();
+            ComputeAggregates(Runs, Results);
+            if (PrintTable)
+            {
+                for (size_t i = NumResults; i < Results.size(); ++i)
+                    PrintResult(Results[i]);
+            }
+        }
+    }
+
+    if (Settings.JSONToStdout)
+        WriteJSONReport(std::cout, Settings, Results);
+
+    if (!Settings.OutputFile.empty())
+    {
+        std::ofstream File{Settings.OutputFile};
+        if (!File)
+        {
+            LOG_ERROR_MESSAGE("Failed to open benchmark report file '", Settings.OutputFile, "'");
+            return 1;
+        }
+        WriteJSONReport(File, Settings, Results);
+    }
+
+    return 0;
+}
+
+} // namespace Benchmark
+
+} // namespace Diligent
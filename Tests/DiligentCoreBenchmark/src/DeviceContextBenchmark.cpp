@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+#include "BenchmarkEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+// Dynamic allocations and recorded barriers are only released when the frame is finished.
+// To keep the memory usage bounded, the benchmarks below finish the frame periodically.
+// This is done with the timer paused so that only the measured operation is accounted for.
+constexpr Uint32 IterationsPerFrame = 256;
+
+void FinishFrame(BenchmarkState& State, IDeviceContext* pContext)
+{
+    State.PauseTiming();
+    pContext->Flush();
+    pContext->FinishFrame();
+    BenchmarkEnvironment::GetInstance()->GetDevice()->ReleaseStaleResources();
+    State.ResumeTiming();
+}
+
+void MapDynamicBuffer(BenchmarkState& State, Uint64 BufferSize)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Map benchmark dynamic buffer";
+    BuffDesc.Size           = BufferSize;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    if (!pBuffer)
+    {
+        State.SkipWithMessage("Failed to create dynamic buffer");
+        return;
+    }
+
+    std::vector<Uint8> Data(static_cast<size_t>(BufferSize), 0xCD);
+    while (State.KeepRunning())
+    {
+        void* pMappedData = nullptr;
+        pContext->MapBuffer(pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+        if (pMappedData != nullptr)
+            memcpy(pMappedData, Data.data(), Data.size());
+        pContext->UnmapBuffer(pBuffer, MAP_WRITE);
+
+        if (State.GetIteration() % IterationsPerFrame == 0)
+            FinishFrame(State, pContext);
+    }
+    State.SetItemsProcessed(State.GetIteration());
+}
+
+// Creates textures and buffers in the default usage that can be transitioned
+// between two states each.
+struct TransitionBenchmarkResources
+{
+    std::vector<RefCntAutoPtr<ITexture>> Textures;
+    std::vector<RefCntAutoPtr<IBuffer>>  Buffers;
+
+    TransitionBenchmarkResources(IRenderDevice* pDevice, Uint32 NumTextures, Uint32 NumBuffers)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Transition benchmark texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        Textures.resize(NumTextures);
+        for (auto& pTex : Textures)
+            pDevice->CreateTexture(TexDesc, nullptr, &pTex);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Transition benchmark buffer";
+        BuffDesc.Size              = 1024;
+        BuffDesc.BindFlags         = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = 16;
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        Buffers.resize(NumBuffers);
+        for (auto& pBuff : Buffers)
+            pDevice->CreateBuffer(BuffDesc, nullptr, &pBuff);
+    }
+
+    bool IsValid() const
+    {
+        for (const auto& pTex : Textures)
+        {
+            if (!pTex)
+                return false;
+        }
+        for (const auto& pBuff : Buffers)
+        {
+            if (!pBuff)
+                return false;
+        }
+        return true;
+    }
+
+    // Prepares the barriers that transition all resources to the shader resource state (Phase 0)
+    // or to the render target/unordered access state (Phase 1).
+    void GetBarriers(Uint32 Phase, std::vector<StateTransitionDesc>& Barriers) const
+    {
+        Barriers.clear();
+        for (const auto& pTex : Textures)
+        {
+            const RESOURCE_STATE NewState = Phase == 0 ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_RENDER_TARGET;
+            Barriers.emplace_back(pTex, RESOURCE_STATE_UNKNOWN, NewState, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        }
+        for (const auto& pBuff : Buffers)
+        {
+            const RESOURCE_STATE NewState = Phase == 0 ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_UNORDERED_ACCESS;
+            Barriers.emplace_back(pBuff, RESOURCE_STATE_UNKNOWN, NewState, STATE_TRANSITION_FLAG_UPDATE_STATE);
+        }
+    }
+};
+
+void TransitionResourceStates(BenchmarkState& State, Uint32 NumTextures, Uint32 NumBuffers)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    TransitionBenchmarkResources Res{pEnv->GetDevice(), NumTextures, NumBuffers};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    std::vector<StateTransitionDesc> Barriers[2];
+    Res.GetBarriers(0, Barriers[0]);
+    Res.GetBarriers(1, Barriers[1]);
+
+    Uint32 Phase = 0;
+    while (State.KeepRunning())
+    {
+        const auto& CurrBarriers = Barriers[Phase];
+        pContext->TransitionResourceStates(static_cast<Uint32>(CurrBarriers.size()), CurrBarriers.data());
+        Phase = 1 - Phase;
+
+        if (State.GetIteration() % IterationsPerFrame == 0)
+            FinishFrame(State, pContext);
+    }
+    State.SetItemsProcessed(State.GetIteration() * (NumTextures + NumBuffers));
+}
+
+} // namespace
+
+
+DILIGENT_BENCHMARK(DeviceContext_MapDynamicBuffer_256B)
+{
+    MapDynamicBuffer(State, 256);
+}
+
+DILIGENT_BENCHMARK(DeviceContext_MapDynamicBuffer_16KB)
+{
+    MapDynamicBuffer(State, 16 << 10);
+}
+
+DILIGENT_BENCHMARK(DeviceContext_TransitionResourceStates_1Texture)
+{
+    TransitionResourceStates(State, 1, 0);
+}
+
+DILIGENT_BENCHMARK(DeviceContext_TransitionResourceStates_1Buffer)
+{
+    TransitionResourceStates(State, 0, 1);
+}
+
+DILIGENT_BENCHMARK(DeviceContext_TransitionResourceStates_32Resources)
+{
+    TransitionResourceStates(State, 16, 16);
+}
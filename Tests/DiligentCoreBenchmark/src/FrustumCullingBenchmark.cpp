@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "FrustumCulling.hpp"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr size_t NumCullingBoxes = 262144;
+
+struct CullingScene
+{
+    ViewFrustumExt Frustum;
+
+    std::vector<BoundBox> Boxes;
+
+    std::array<std::vector<float>, 6> MinMax;
+    BoundBoxArrays                    Arrays;
+
+    CullingScene()
+    {
+        const float4x4 View = float4x4::RotationY(0.3f) * float4x4::Translation(0.f, -2.f, 0.f);
+        const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 16.f / 9.f, 0.1f, 500.f, false);
+        ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+
+        // Scatter the instances around the camera so that roughly
+        // one sixth of them is inside the frustum.
+        FastRandFloat Pos{0, -500.f, +500.f};
+        FastRandFloat Size{1, 0.5f, 5.f};
+
+        Boxes.resize(NumCullingBoxes);
+        for (auto& Arr : MinMax)
+            Arr.resize(NumCullingBoxes);
+        for (size_t i = 0; i < NumCullingBoxes; ++i)
+        {
+            const float3 Center{Pos(), Pos() * 0.1f, Pos()};
+            const float3 HalfExtent{Size(), Size(), Size()};
+
+            BoundBox& Box = Boxes[i];
+            Box.Min       = Center - HalfExtent;
+            Box.Max       = Center + HalfExtent;
+            for (int c = 0; c < 3; ++c)
+            {
+                MinMax[c][i]     = Box.Min[c];
+                MinMax[3 + c][i] = Box.Max[c];
+            }
+        }
+
+        for (int c = 0; c < 3; ++c)
+        {
+            Arrays.pMinOrCenter[c]     = MinMax[c].data();
+            Arrays.pMaxOrHalfExtent[c] = MinMax[3 + c].data();
+        }
+        Arrays.Count  = NumCullingBoxes;
+        Arrays.Layout = BoundBoxArrays::LAYOUT_MIN_MAX;
+    }
+};
+
+const CullingScene& GetCullingScene()
+{
+    static const CullingScene Scene;
+    return Scene;
+}
+
+} // namespace
+
+// Scalar baseline: tests every box with GetBoxVisibility().
+DILIGENT_BENCHMARK(FrustumCulling_Scalar)
+{
+    const CullingScene& Scene = GetCullingScene();
+
+    std::vector<Uint32> Indices(NumCullingBoxes);
+    size_t              NumVisible = 0;
+    while (State.KeepRunning())
+    {
+        NumVisible = 0;
+        for (size_t i = 0; i < Scene.Boxes.size(); ++i)
+        {
+            if (GetBoxVisibility(Scene.Frustum, Scene.Boxes[i]) != BoxVisibility::Invisible)
+                Indices[NumVisible++] = static_cast<Uint32>(i);
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumCullingBoxes);
+    VERIFY_EXPR(NumVisible > 0);
+}
+
+// Batch culling of the boxes in the structure-of-arrays layout on the calling thread.
+DILIGENT_BENCHMARK(FrustumCulling_Batch)
+{
+    const CullingScene& Scene = GetCullingScene();
+
+    std::vector<Uint32> Indices(NumCullingBoxes);
+    size_t              NumVisible = 0;
+    while (State.KeepRunning())
+    {
+        NumVisible = GetVisibleBoxes(Scene.Frustum, Scene.Arrays, Indices.data());
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumCullingBoxes);
+    VERIFY_EXPR(NumVisible > 0);
+}
+
+// Batch culling distributed between the calling thread and three worker threads.
+DILIGENT_BENCHMARK(FrustumCulling_BatchParallel)
+{
+    const CullingScene& Scene = GetCullingScene();
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+
+    std::vector<Uint32> Indices(NumCullingBoxes);
+    size_t              NumVisible = 0;
+    while (State.KeepRunning())
+    {
+        NumVisible = GetVisibleBoxes(Scene.Frustum, Scene.Arrays, Indices.data(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumCullingBoxes);
+    VERIFY_EXPR(NumVisible > 0);
+}
@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "BasicMathSIMD.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+// The number of joint or instance matrices processed every frame
+constexpr size_t NumMatrices = 4096;
+
+// The number of vertices transformed every frame
+constexpr size_t NumPoints = 65536;
+
+struct MatrixData
+{
+    std::vector<float4x4> Matrices;
+    std::vector<float4x4> Transforms;
+    std::vector<float3>   Points;
+    float4x4              ViewProj;
+
+    MatrixData()
+    {
+        FastRandFloat Rnd{0, -10.f, +10.f};
+
+        Matrices.resize(NumMatrices);
+        Transforms.resize(NumMatrices);
+        for (size_t i = 0; i < NumMatrices; ++i)
+        {
+            Matrices[i]   = float4x4::RotationY(Rnd()) * float4x4::Translation(Rnd(), Rnd(), Rnd());
+            Transforms[i] = float4x4::RotationX(Rnd()) * float4x4::Scale(Rnd());
+        }
+
+        Points.resize(NumPoints);
+        for (float3& Point : Points)
+            Point = float3{Rnd(), Rnd(), Rnd()};
+
+        ViewProj = float4x4::Translation(0.f, -2.f, 20.f) * float4x4::Projection(PI_F / 3.f, 16.f / 9.f, 0.1f, 500.f, false);
+    }
+};
+
+const MatrixData& GetMatrixData()
+{
+    static const MatrixData Data;
+    return Data;
+}
+
+} // namespace
+
+// Scalar baseline: multiplies every matrix by the corresponding transform with operator*.
+DILIGENT_BENCHMARK(MatrixMath_MultiplyScalar)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float4x4> Results(NumMatrices);
+    while (State.KeepRunning())
+    {
+        for (size_t i = 0; i < NumMatrices; ++i)
+            Results[i] = Data.Matrices[i] * Data.Transforms[i];
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumMatrices);
+}
+
+DILIGENT_BENCHMARK(MatrixMath_MultiplyBatch)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float4x4> Results(NumMatrices);
+    while (State.KeepRunning())
+    {
+        MultiplyMatrices(Data.Matrices.data(), Data.Transforms.data(), Results.data(), NumMatrices);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumMatrices);
+}
+
+// Scalar baseline: transforms every point with float3 * float4x4.
+DILIGENT_BENCHMARK(MatrixMath_TransformPointsScalar)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float3> Results(NumPoints);
+    while (State.KeepRunning())
+    {
+        for (size_t i = 0; i < NumPoints; ++i)
+            Results[i] = Data.Points[i] * Data.ViewProj;
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumPoints);
+}
+
+DILIGENT_BENCHMARK(MatrixMath_TransformPointsBatch)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float3> Results(NumPoints);
+    while (State.KeepRunning())
+    {
+        TransformPoints(Data.Points.data(), NumPoints, Data.ViewProj, Results.data());
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumPoints);
+}
+
+// Scalar baseline: transposes every matrix and copies it to the instance buffer.
+DILIGENT_BENCHMARK(MatrixMath_WriteShaderMatricesScalar)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float4x4> InstanceData(NumMatrices);
+    while (State.KeepRunning())
+    {
+        for (size_t i = 0; i < NumMatrices; ++i)
+        {
+            const float4x4 Transposed = Data.Matrices[i].Transpose();
+            memcpy(&InstanceData[i], &Transposed, sizeof(Transposed));
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumMatrices);
+}
+
+DILIGENT_BENCHMARK(MatrixMath_WriteShaderMatricesBatch)
+{
+    const MatrixData& Data = GetMatrixData();
+
+    std::vector<float4x4> InstanceData(NumMatrices);
+    while (State.KeepRunning())
+    {
+        WriteShaderMatrices(Data.Matrices.data(), NumMatrices, InstanceData.data(), 0, true);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumMatrices);
+}
@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "ObjectsRegistry.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr int NumRegistryKeys = 256;
+
+// The number of lookups performed by every benchmark iteration
+constexpr int NumLookupsPerIteration = 1024;
+
+struct RegistryObject : public ObjectBase<IObject>
+{
+    RegistryObject(IReferenceCounters* pRefCounters, int _Value) :
+        ObjectBase<IObject>{pRefCounters},
+        Value{_Value}
+    {}
+
+    const int Value;
+};
+
+using RegistryType = ObjectsRegistry<int, RefCntAutoPtr<RegistryObject>>;
+
+// Performs lookups in the registry, optionally while the background threads
+// look up the same keys, and reports the number of lookups on the calling thread.
+void RunRegistryLookups(BenchmarkState& State, bool ReadOptimized, Uint32 NumBackgroundThreads)
+{
+    RegistryType Registry{1024, ReadOptimized};
+
+    std::vector<RefCntAutoPtr<RegistryObject>> Objects(NumRegistryKeys);
+    for (int i = 0; i < NumRegistryKeys; ++i)
+    {
+        Objects[i] = Registry.Get(i, [i]() {
+            return RefCntAutoPtr<RegistryObject>{MakeNewRCObj<RegistryObject>()(i)};
+        });
+    }
+
+    std::atomic<bool>        Stop{false};
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumBackgroundThreads; ++t)
+    {
+        Threads.emplace_back([&Registry, &Stop, t]() {
+            int Key = static_cast<int>(t);
+            while (!Stop.load(std::memory_order_relaxed))
+            {
+                auto pObject = Registry.Get(Key);
+                VERIFY_EXPR(pObject);
+                Key = (Key + 17) % NumRegistryKeys;
+            }
+        });
+    }
+
+    int Key = 0;
+    int Sum = 0;
+    while (State.KeepRunning())
+    {
+        for (int i = 0; i < NumLookupsPerIteration; ++i)
+        {
+            auto pObject = Registry.Get(Key);
+            Sum += pObject->Value;
+            Key = (Key + 17) % NumRegistryKeys;
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumLookupsPerIteration);
+
+    Stop.store(true);
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    VERIFY_EXPR(Sum >= 0);
+    (void)Sum;
+}
+
+} // namespace
+
+DILIGENT_BENCHMARK(ObjectsRegistry_Get)
+{
+    RunRegistryLookups(State, false, 0);
+}
+
+DILIGENT_BENCHMARK(ObjectsRegistry_Get_ReadOptimized)
+{
+    RunRegistryLookups(State, true, 0);
+}
+
+// Lookups while three other threads read from the same registry.
+DILIGENT_BENCHMARK(ObjectsRegistry_Get_Contended)
+{
+    RunRegistryLookups(State, false, 3);
+}
+
+DILIGENT_BENCHMARK(ObjectsRegistry_Get_ReadOptimized_Contended)
+{
+    RunRegistryLookups(State, true, 3);
+}
@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "OcclusionCulling.hpp"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr size_t NumOccluders     = 256;
+constexpr size_t NumOccludedBoxes = 65536;
+
+struct OcclusionScene
+{
+    float4x4 ViewProj;
+
+    // Every occluder is a box made of 12 triangles
+    std::vector<float3>       Vertices;
+    std::vector<Uint32>       Indices;
+    std::vector<OccluderMesh> Occluders;
+
+    std::vector<BoundBox> Boxes;
+
+    OcclusionScene()
+    {
+        const float4x4 View = float4x4::RotationY(0.3f) * float4x4::Translation(0.f, -2.f, 0.f);
+        const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 16.f / 9.f, 0.1f, 500.f, false);
+        ViewProj            = View * Proj;
+
+        // clang-format off
+        static constexpr Uint32 BoxIndices[] =
+        {
+            0,2,3, 0,3,1, // -z
+            4,5,7, 4,7,6, // +z
+            0,4,6, 0,6,2, // -x
+            1,3,7, 1,7,5, // +x
+            0,1,5, 0,5,4, // -y
+            2,6,7, 2,7,3  // +y
+        };
+        // clang-format on
+
+        FastRandFloat Pos{0, -150.f, +150.f};
+        FastRandFloat Size{1, 2.f, 10.f};
+
+        Vertices.reserve(NumOccluders * 8);
+        for (size_t i = 0; i < NumOccluders; ++i)
+        {
+            const float3 Center{Pos(), 0, Pos()};
+            const float3 HalfSize{Size(), Size(), Size() * 0.25f};
+            for (Uint32 v = 0; v < 8; ++v)
+            {
+                Vertices.emplace_back(
+                    (v & 1) ? Center.x + HalfSize.x : Center.x - HalfSize.x,
+                    (v & 2) ? Center.y + HalfSize.y : Center.y - HalfSize.y,
+                    (v & 4) ? Center.z + HalfSize.z : Center.z - HalfSize.z);
+            }
+        }
+        Indices.assign(BoxIndices, BoxIndices + _countof(BoxIndices));
+
+        Occluders.resize(NumOccluders);
+        for (size_t i = 0; i < NumOccluders; ++i)
+        {
+            OccluderMesh& Mesh = Occluders[i];
+            Mesh.pVertices     = Vertices.data() + i * 8;
+            Mesh.NumVertices   = 8;
+            Mesh.pIndices      = Indices.data();
+            Mesh.NumIndices    = static_cast<Uint32>(Indices.size());
+            Mesh.WorldViewProj = ViewProj;
+            // The winding of the box faces is not consistent
+            Mesh.CullBackFaces = false;
+        }
+
+        FastRandFloat BoxSize{2, 0.5f, 2.f};
+        Boxes.resize(NumOccludedBoxes);
+        for (BoundBox& Box : Boxes)
+        {
+            const float3 Center{Pos(), BoxSize(), Pos()};
+            const float3 HalfSize{BoxSize(), BoxSize(), BoxSize()};
+            Box = BoundBox{Center - HalfSize, Center + HalfSize};
+        }
+    }
+};
+
+const OcclusionScene& GetOcclusionScene()
+{
+    static const OcclusionScene Scene;
+    return Scene;
+}
+
+} // namespace
+
+// Clears the depth buffer and rasterizes the occluders on the calling thread.
+DILIGENT_BENCHMARK(OcclusionCulling_Rasterize)
+{
+    const OcclusionScene& Scene = GetOcclusionScene();
+
+    SoftwareOcclusionCuller Culler{{}};
+    while (State.KeepRunning())
+    {
+        Culler.Clear();
+        Culler.RasterizeOccluders(Scene.Occluders.data(), Scene.Occluders.size());
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumOccluders);
+}
+
+// Clears the depth buffer and rasterizes the occluders with the calling thread and three worker threads.
+DILIGENT_BENCHMARK(OcclusionCulling_RasterizeParallel)
+{
+    const OcclusionScene& Scene = GetOcclusionScene();
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+
+    SoftwareOcclusionCuller Culler{{}};
+    while (State.KeepRunning())
+    {
+        Culler.Clear();
+        Culler.RasterizeOccluders(Scene.Occluders.data(), Scene.Occluders.size(), pThreadPool);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumOccluders);
+}
+
+// Tests the boxes against the depth buffer on the calling thread.
+DILIGENT_BENCHMARK(OcclusionCulling_TestBoxes)
+{
+    const OcclusionScene& Scene = GetOcclusionScene();
+
+    SoftwareOcclusionCuller Culler{{}};
+    Culler.RasterizeOccluders(Scene.Occluders.data(), Scene.Occluders.size());
+
+    std::vector<Uint32> Indices(NumOccludedBoxes);
+    size_t              NumVisible = 0;
+    while (State.KeepRunning())
+    {
+        NumVisible = Culler.GetVisibleBoxes(Scene.ViewProj, Scene.Boxes.data(), Scene.Boxes.size(), Indices.data());
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumOccludedBoxes);
+    VERIFY_EXPR(NumVisible > 0 && NumVisible < NumOccludedBoxes);
+}
@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkFramework.hpp"
+#include "BenchmarkEnvironment.hpp"
+#include "BenchmarkPipeline.hpp"
+
+#include "GraphicsAccessories.hpp"
+#include "Dearchiver.h"
+#include "Archiver.h"
+#include "SerializationDevice.h"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr Uint32 ContentVersion = 1;
+constexpr char   PSOName[]      = "Archive benchmark PSO";
+
+// Serializes the benchmark pipeline for the current device and loads it into a new dearchiver.
+RefCntAutoPtr<IDearchiver> CreateDearchiver(BenchmarkState& State)
+{
+    auto* pEnv             = BenchmarkEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    const auto DeviceFlag = RenderDeviceTypeToArchiveDataFlag(pEnv->GetDeviceType());
+    if (DeviceFlag == ARCHIVE_DEVICE_DATA_FLAG_NONE)
+    {
+        State.SkipWithMessage("Archives are not supported by this device");
+        return {};
+    }
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCreateInfo{}, &pDearchiver);
+    if (!pDearchiver || pArchiverFactory == nullptr)
+    {
+        State.SkipWithMessage("Archiver library is not loaded");
+        return {};
+    }
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pSerializationDevice);
+    RefCntAutoPtr<IArchiver> pArchiver;
+    if (pSerializationDevice)
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+    if (!pArchiver)
+    {
+        State.SkipWithMessage("Failed to create the archiver");
+        return {};
+    }
+
+    RefCntAutoPtr<IShader> pVS;
+    RefCntAutoPtr<IShader> pPS;
+    pSerializationDevice->CreateShader(GetBenchmarkShaderCI(SHADER_TYPE_VERTEX), ShaderArchiveInfo{DeviceFlag}, &pVS);
+    pSerializationDevice->CreateShader(GetBenchmarkShaderCI(SHADER_TYPE_PIXEL), ShaderArchiveInfo{DeviceFlag}, &pPS);
+    if (!pVS || !pPS)
+    {
+        State.SkipWithMessage("Failed to create serialized shaders");
+        return {};
+    }
+
+    auto PSOCreateInfo = GetBenchmarkPipelineCI(PSOName);
+    PSOCreateInfo.pVS  = pVS;
+    PSOCreateInfo.pPS  = pPS;
+
+    PipelineStateArchiveInfo ArchiveInfo;
+    ArchiveInfo.DeviceFlags = DeviceFlag;
+
+    RefCntAutoPtr<IPipelineState> pSerializedPSO;
+    pSerializationDevice->CreateGraphicsPipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+    if (!pSerializedPSO || !pArchiver->AddPipelineState(pSerializedPSO))
+    {
+        State.SkipWithMessage("Failed to serialize the pipeline state");
+        return {};
+    }
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    if (!pArchiver->SerializeToBlob(ContentVersion, &pArchive) || !pDearchiver->LoadArchive(pArchive, ContentVersion, true))
+    {
+        State.SkipWithMessage("Failed to create the archive");
+        return {};
+    }
+
+    return pDearchiver;
+}
+
+} // namespace
+
+
+// Unpacks the pipeline state from the archive, creating a new PSO every time.
+// The dearchiver caches unpacked pipelines, so a no-op modify callback is used to bypass the cache.
+DILIGENT_BENCHMARK(PSO_UnpackFromArchive)
+{
+    auto pDearchiver = CreateDearchiver(State);
+    if (!pDearchiver)
+        return;
+
+    PipelineStateUnpackInfo UnpackInfo;
+    UnpackInfo.pDevice                       = BenchmarkEnvironment::GetInstance()->GetDevice();
+    UnpackInfo.Name                          = PSOName;
+    UnpackInfo.PipelineType                  = PIPELINE_TYPE_GRAPHICS;
+    UnpackInfo.ModifyPipelineStateCreateInfo = [](PipelineStateCreateInfo&, void*) {};
+
+    while (State.KeepRunning())
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+        if (!pPSO)
+        {
+            State.SkipWithMessage("Failed to unpack the pipeline state");
+            break;
+        }
+    }
+}
+
+// Unpacks the pipeline state that is already alive, which is served from the dearchiver cache.
+DILIGENT_BENCHMARK(PSO_UnpackFromArchive_Cached)
+{
+    auto pDearchiver = CreateDearchiver(State);
+    if (!pDearchiver)
+        return;
+
+    PipelineStateUnpackInfo UnpackInfo;
+    UnpackInfo.pDevice      = BenchmarkEnvironment::GetInstance()->GetDevice();
+    UnpackInfo.Name         = PSOName;
+    UnpackInfo.PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+    // Keep the PSO alive as the cache does not hold strong references
+    RefCntAutoPtr<IPipelineState> pCachedPSO;
+    pDearchiver->UnpackPipelineState(UnpackInfo, &pCachedPSO);
+    if (!pCachedPSO)
+    {
+        State.SkipWithMessage("Failed to unpack the pipeline state");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+    }
+}
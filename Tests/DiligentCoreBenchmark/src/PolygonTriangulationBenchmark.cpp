@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "AdvancedMath.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr size_t NumPolygonVerts = 10000;
+
+// Star-shaped polygon with random radii, where about half of the vertices are reflex,
+// similar to glyph outlines and navigation mesh contours
+const std::vector<float2>& GetStarPolygon()
+{
+    static const std::vector<float2> Polygon = []() {
+        FastRandFloat       Rnd{0, 0.f, 1.f};
+        std::vector<float2> Polygon(NumPolygonVerts);
+        for (size_t i = 0; i < NumPolygonVerts; ++i)
+        {
+            const float Angle  = (static_cast<float>(i) + Rnd() * 0.5f) / static_cast<float>(NumPolygonVerts) * 2.f * PI_F;
+            const float Radius = 0.5f + Rnd() * 0.5f;
+            Polygon[i]         = float2{std::cos(Angle) * Radius, std::sin(Angle) * Radius};
+        }
+        return Polygon;
+    }();
+    return Polygon;
+}
+
+// Comb-shaped polygon with long narrow teeth
+const std::vector<float2>& GetCombPolygon()
+{
+    static const std::vector<float2> Polygon = []() {
+        constexpr size_t    NumTeeth = (NumPolygonVerts - 2) / 4;
+        std::vector<float2> Polygon;
+        Polygon.reserve(NumPolygonVerts);
+        for (size_t i = 0; i < NumTeeth; ++i)
+        {
+            const float x = static_cast<float>(i);
+            Polygon.emplace_back(x, 0.f);
+            Polygon.emplace_back(x + 0.5f, 0.f);
+            Polygon.emplace_back(x + 0.5f, -10.f);
+            Polygon.emplace_back(x + 1.f, -10.f);
+        }
+        Polygon.emplace_back(static_cast<float>(NumTeeth), 1.f);
+        Polygon.emplace_back(0.f, 1.f);
+        return Polygon;
+    }();
+    return Polygon;
+}
+
+void RunTriangulation(BenchmarkState& State, const std::vector<float2>& Polygon, TRIANGULATE_POLYGON_MODE Mode)
+{
+    Polygon2DTriangulator<Uint32> Triangulator{Mode};
+
+    size_t NumIndices = 0;
+    while (State.KeepRunning())
+    {
+        NumIndices = Triangulator.Triangulate(Polygon).size();
+    }
+    State.SetItemsProcessed(State.GetIteration() * Polygon.size());
+    VERIFY_EXPR(NumIndices == (Polygon.size() - 2) * 3);
+}
+
+} // namespace
+
+// Triangulates a 10k-vertex star-shaped polygon, testing every ear candidate against all remaining vertices.
+DILIGENT_BENCHMARK(PolygonTriangulation_Star_EarClipping)
+{
+    RunTriangulation(State, GetStarPolygon(), TRIANGULATE_POLYGON_MODE_EAR_CLIPPING);
+}
+
+// Triangulates a 10k-vertex star-shaped polygon using the spatial hash to find vertices inside ear candidates.
+DILIGENT_BENCHMARK(PolygonTriangulation_Star_SpatialHash)
+{
+    RunTriangulation(State, GetStarPolygon(), TRIANGULATE_POLYGON_MODE_SPATIAL_HASH);
+}
+
+// Triangulates a 10k-vertex comb-shaped polygon, testing every ear candidate against all remaining vertices.
+DILIGENT_BENCHMARK(PolygonTriangulation_Comb_EarClipping)
+{
+    RunTriangulation(State, GetCombPolygon(), TRIANGULATE_POLYGON_MODE_EAR_CLIPPING);
+}
+
+// Triangulates a 10k-vertex comb-shaped polygon using the spatial hash to find vertices inside ear candidates.
+DILIGENT_BENCHMARK(PolygonTriangulation_Comb_SpatialHash)
+{
+    RunTriangulation(State, GetCombPolygon(), TRIANGULATE_POLYGON_MODE_SPATIAL_HASH);
+}
@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkFramework.hpp"
+#include "BenchmarkEnvironment.hpp"
+#include "BenchmarkPipeline.hpp"
+
+#include "RenderStateCache.h"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+RefCntAutoPtr<IRenderStateCache> CreateCache(BenchmarkState& State)
+{
+    auto* pEnv = BenchmarkEnvironment::GetInstance();
+    if (pEnv->GetDeviceType() == RENDER_DEVICE_TYPE_NULL)
+    {
+        State.SkipWithMessage("Render state cache is not supported by the null device");
+        return {};
+    }
+
+    RenderStateCacheCreateInfo CacheCI;
+    CacheCI.pDevice  = pEnv->GetDevice();
+    CacheCI.LogLevel = RENDER_STATE_CACHE_LOG_LEVEL_DISABLED;
+
+    RefCntAutoPtr<IRenderStateCache> pCache;
+    CreateRenderStateCache(CacheCI, &pCache);
+    if (!pCache)
+        State.SkipWithMessage("Failed to create the render state cache");
+
+    return pCache;
+}
+
+} // namespace
+
+
+// Requests the shader that is already in the cache. This includes hashing the
+// shader create info and the source, which is what every lookup pays for.
+DILIGENT_BENCHMARK(RenderStateCache_CreateShader_Hit)
+{
+    auto pCache = CreateCache(State);
+    if (!pCache)
+        return;
+
+    const auto ShaderCI = GetBenchmarkShaderCI(SHADER_TYPE_PIXEL);
+
+    RefCntAutoPtr<IShader> pCachedShader;
+    pCache->CreateShader(ShaderCI, &pCachedShader);
+    if (!pCachedShader)
+    {
+        State.SkipWithMessage("Failed to create the shader");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        RefCntAutoPtr<IShader> pShader;
+        pCache->CreateShader(ShaderCI, &pShader);
+    }
+}
+
+// Requests the graphics pipeline state that is already in the cache.
+DILIGENT_BENCHMARK(RenderStateCache_CreateGraphicsPipelineState_Hit)
+{
+    auto pCache = CreateCache(State);
+    if (!pCache)
+        return;
+
+    RefCntAutoPtr<IShader> pVS;
+    RefCntAutoPtr<IShader> pPS;
+    pCache->CreateShader(GetBenchmarkShaderCI(SHADER_TYPE_VERTEX), &pVS);
+    pCache->CreateShader(GetBenchmarkShaderCI(SHADER_TYPE_PIXEL), &pPS);
+    if (!pVS || !pPS)
+    {
+        State.SkipWithMessage("Failed to create shaders");
+        return;
+    }
+
+    auto PSOCreateInfo = GetBenchmarkPipelineCI("Render state cache benchmark PSO");
+    PSOCreateInfo.pVS  = pVS;
+    PSOCreateInfo.pPS  = pPS;
+
+    RefCntAutoPtr<IPipelineState> pCachedPSO;
+    pCache->CreateGraphicsPipelineState(PSOCreateInfo, &pCachedPSO);
+    if (!pCachedPSO)
+    {
+        State.SkipWithMessage("Failed to create the pipeline state");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pCache->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    }
+}
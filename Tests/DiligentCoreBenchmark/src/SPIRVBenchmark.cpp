@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <string>
+
+#include "BenchmarkFramework.hpp"
+
+#include "SPIRVModuleIndex.hpp"
+#include "SPIRVUtils.hpp"
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "HLSLParsingTools.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "InlineShaders/BenchmarkShadersHLSL.h"
+#include "InlineShaders/SPIRVBenchmarkShadersHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+struct CorpusShader
+{
+    const char*           Name = nullptr;
+    SHADER_TYPE           Type = SHADER_TYPE_UNKNOWN;
+    std::vector<uint32_t> SPIRV;
+
+    std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ImageFormats;
+};
+
+// Compiles the HLSL shader corpus to SPIR-V once. The benchmarks only measure
+// the processing of the compiled byte code.
+const std::vector<CorpusShader>& GetShaderCorpus()
+{
+    static const std::vector<CorpusShader> Corpus = []() {
+        // clang-format off
+        const struct
+        {
+            const char*        Name;
+            SHADER_TYPE        Type;
+            const std::string& Source;
+        } Shaders[] =
+        {
+            {"Benchmark VS",  SHADER_TYPE_VERTEX,  HLSL::Benchmark_VS},
+            {"Benchmark PS",  SHADER_TYPE_PIXEL,   HLSL::Benchmark_PS},
+            {"Skinned VS",    SHADER_TYPE_VERTEX,  HLSL::SPIRVBenchmark_SkinnedVS},
+            {"Material PS",   SHADER_TYPE_PIXEL,   HLSL::SPIRVBenchmark_MaterialPS},
+            {"Downsample CS", SHADER_TYPE_COMPUTE, HLSL::SPIRVBenchmark_DownsampleCS},
+            {"Particles CS",  SHADER_TYPE_COMPUTE, HLSL::SPIRVBenchmark_ParticlesCS},
+        };
+        // clang-format on
+
+        GLSLangUtils::InitializeGlslang();
+
+        std::vector<CorpusShader> Corpus;
+        for (const auto& Shader : Shaders)
+        {
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.Source          = Shader.Source.c_str();
+            ShaderCI.SourceLength    = Shader.Source.length();
+            ShaderCI.EntryPoint      = "main";
+            ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.Desc.Name       = Shader.Name;
+            ShaderCI.Desc.ShaderType = Shader.Type;
+
+            CorpusShader Compiled;
+            Compiled.Name  = Shader.Name;
+            Compiled.Type  = Shader.Type;
+            Compiled.SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+            if (Compiled.SPIRV.empty())
+                continue;
+
+            Compiled.ImageFormats = Parsing::ExtractGLSLImageFormatsFromHLSL(Shader.Source);
+            Corpus.emplace_back(std::move(Compiled));
+        }
+
+        GLSLangUtils::FinalizeGlslang();
+
+        return Corpus;
+    }();
+
+    return Corpus;
+}
+
+const std::vector<CorpusShader>* GetShaderCorpus(BenchmarkState& State)
+{
+    const std::vector<CorpusShader>& Corpus = GetShaderCorpus();
+    if (Corpus.empty())
+    {
+        State.SkipWithMessage("Failed to compile the shader corpus");
+        return nullptr;
+    }
+    return &Corpus;
+}
+
+} // namespace
+
+
+// Builds the module index for every shader in the corpus.
+DILIGENT_BENCHMARK(SPIRV_BuildModuleIndex)
+{
+    const auto* pCorpus = GetShaderCorpus(State);
+    if (pCorpus == nullptr)
+        return;
+
+    Uint32 IdBound = 0;
+    while (State.KeepRunning())
+    {
+        for (const CorpusShader& Shader : *pCorpus)
+        {
+            const SPIRVModuleIndex Index{Shader.SPIRV};
+            IdBound += Index.GetIdBound();
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * pCorpus->size());
+    VERIFY_EXPR(IdBound > 0);
+}
+
+// Copies the byte code of every shader, maps vertex shader inputs and patches image formats
+// as is done when an HLSL shader is compiled with glslang.
+DILIGENT_BENCHMARK(SPIRV_PatchWithModuleIndex)
+{
+    const auto* pCorpus = GetShaderCorpus(State);
+    if (pCorpus == nullptr)
+        return;
+
+    while (State.KeepRunning())
+    {
+        for (const CorpusShader& Shader : *pCorpus)
+        {
+            std::vector<uint32_t>  SPIRV = Shader.SPIRV;
+            const SPIRVModuleIndex Index{SPIRV};
+            if (Shader.Type == SHADER_TYPE_VERTEX)
+                MapHLSLVertexShaderInputs(SPIRV, Index);
+            if (!Shader.ImageFormats.empty() && HasStorageImages(Index))
+                PatchImageFormats(SPIRV, Index, Shader.ImageFormats);
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * pCorpus->size());
+}
+
+// The same processing performed with full reflection. This is the baseline for
+// SPIRV_PatchWithModuleIndex.
+DILIGENT_BENCHMARK(SPIRV_PatchWithFullReflection)
+{
+    const auto* pCorpus = GetShaderCorpus(State);
+    if (pCorpus == nullptr)
+        return;
+
+    while (State.KeepRunning())
+    {
+        for (const CorpusShader& Shader : *pCorpus)
+        {
+            ShaderDesc Desc;
+            Desc.Name       = Shader.Name;
+            Desc.ShaderType = Shader.Type;
+
+            std::string          EntryPoint;
+            SPIRVShaderResources Resources{
+                DefaultRawMemoryAllocator::GetAllocator(),
+                Shader.SPIRV,
+                Desc,
+                nullptr,
+                Shader.Type == SHADER_TYPE_VERTEX, // LoadShaderStageInputs
+                false,                             // LoadUniformBufferReflection
+                EntryPoint,
+            };
+
+            std::vector<uint32_t> SPIRV = Shader.SPIRV;
+            if (Shader.Type == SHADER_TYPE_VERTEX)
+                Resources.MapHLSLVertexShaderInputs(SPIRV);
+            if (!Shader.ImageFormats.empty() && Resources.GetNumImgs() > 0)
+                SPIRV = PatchImageFormats(SPIRV, Shader.ImageFormats);
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * pCorpus->size());
+}
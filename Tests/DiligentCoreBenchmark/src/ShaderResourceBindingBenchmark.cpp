@@ -0,0 +1,610 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
+
+#include "BenchmarkFramework.hpp"
+#include "BenchmarkEnvironment.hpp"
+
+#include "GraphicsAccessories.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+// Resources and the resource signature shared by the SRB benchmarks.
+// The signature is defined explicitly so that the benchmarks do not depend on
+// shader compilation and run on backends without shader reflection.
+struct SRBBenchmarkResources
+{
+    static constexpr Uint32 NumTextures = 2;
+
+    RefCntAutoPtr<IPipelineResourceSignature>        pSignature;
+    RefCntAutoPtr<IBuffer>                           pConstants;
+    RefCntAutoPtr<IBuffer>                           pDynamicConstants;
+    std::array<RefCntAutoPtr<ITexture>, NumTextures> pTextures;
+    std::array<ITextureView*, NumTextures>           pTextureSRVs{};
+
+    explicit SRBBenchmarkResources(IRenderDevice* pDevice)
+    {
+        // clang-format off
+        const PipelineResourceDesc Resources[] =
+        {
+            {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants",    1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbFrameAttribs", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_PIXEL,                      "g_Texture",      1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL,                      "g_DynTexture",   1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        const ImmutableSamplerDesc ImmutableSamplers[] =
+        {
+            {SHADER_TYPE_PIXEL, "g_Texture",    SamplerDesc{}},
+            {SHADER_TYPE_PIXEL, "g_DynTexture", SamplerDesc{}},
+        };
+        // clang-format on
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                       = "SRB benchmark signature";
+        PRSDesc.Resources                  = Resources;
+        PRSDesc.NumResources               = _countof(Resources);
+        PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+        PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+        PRSDesc.UseCombinedTextureSamplers = true;
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "SRB benchmark constants";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+
+        BuffDesc.Name           = "SRB benchmark dynamic constants";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pDynamicConstants);
+
+        TextureDesc TexDesc;
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+        for (Uint32 i = 0; i < NumTextures; ++i)
+        {
+            TexDesc.Name = i == 0 ? "SRB benchmark texture 0" : "SRB benchmark texture 1";
+            pDevice->CreateTexture(TexDesc, nullptr, &pTextures[i]);
+            if (pTextures[i])
+                pTextureSRVs[i] = pTextures[i]->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+        }
+    }
+
+    bool IsValid() const
+    {
+        return pSignature && pConstants && pDynamicConstants && pTextures[0] && pTextures[1];
+    }
+
+    RefCntAutoPtr<IShaderResourceBinding> CreateSRB(bool Initialize) const
+    {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pSignature->CreateShaderResourceBinding(&pSRB, true);
+        if (pSRB && Initialize)
+        {
+            pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(pConstants);
+            pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbFrameAttribs")->Set(pDynamicConstants);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTextureSRVs[0]);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynTexture")->Set(pTextureSRVs[1]);
+        }
+        return pSRB;
+    }
+};
+
+} // namespace
+
+
+// Creates and immediately releases a shader resource binding.
+DILIGENT_BENCHMARK(SRB_CreateAndRelease)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        Res.pSignature->CreateShaderResourceBinding(&pSRB, true);
+    }
+}
+
+namespace
+{
+
+// The number of SRBs created by the calling thread in every benchmark iteration
+constexpr Uint32 NumSRBsPerIteration = 64;
+
+// Creates and releases SRBs on the calling thread while NumThreads - 1 background threads
+// do the same with the same signature. Reports the number of SRBs created by all threads
+// while the measurement is running, so that the throughput shows how SRB allocation scales.
+void CreateAndReleaseSRBsBenchmark(BenchmarkState& State, Uint32 NumThreads)
+{
+    if (NumThreads > std::thread::hardware_concurrency())
+    {
+        State.SkipWithMessage("The number of threads exceeds the number of hardware threads");
+        return;
+    }
+
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    std::atomic<bool>   Stop{false};
+    std::atomic<bool>   Measuring{false};
+    std::atomic<Uint64> NumBackgroundSRBs{0};
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 1; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&]() {
+            Uint64 NumSRBs = 0;
+            while (!Stop.load(std::memory_order_relaxed))
+            {
+                RefCntAutoPtr<IShaderResourceBinding> pSRB;
+                Res.pSignature->CreateShaderResourceBinding(&pSRB, true);
+                if (Measuring.load(std::memory_order_relaxed))
+                    ++NumSRBs;
+            }
+            NumBackgroundSRBs.fetch_add(NumSRBs);
+        });
+    }
+
+    Measuring.store(true);
+    while (State.KeepRunning())
+    {
+        for (Uint32 i = 0; i < NumSRBsPerIteration; ++i)
+        {
+            RefCntAutoPtr<IShaderResourceBinding> pSRB;
+            Res.pSignature->CreateShaderResourceBinding(&pSRB, true);
+        }
+    }
+    Measuring.store(false);
+
+    Stop.store(true);
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    State.SetItemsProcessed(State.GetIteration() * NumSRBsPerIteration + NumBackgroundSRBs.load());
+}
+
+} // namespace
+
+DILIGENT_BENCHMARK(SRB_CreateAndRelease_Threads_1)
+{
+    CreateAndReleaseSRBsBenchmark(State, 1);
+}
+
+DILIGENT_BENCHMARK(SRB_CreateAndRelease_Threads_2)
+{
+    CreateAndReleaseSRBsBenchmark(State, 2);
+}
+
+DILIGENT_BENCHMARK(SRB_CreateAndRelease_Threads_4)
+{
+    CreateAndReleaseSRBsBenchmark(State, 4);
+}
+
+DILIGENT_BENCHMARK(SRB_CreateAndRelease_Threads_8)
+{
+    CreateAndReleaseSRBsBenchmark(State, 8);
+}
+
+DILIGENT_BENCHMARK(SRB_CreateAndRelease_Threads_16)
+{
+    CreateAndReleaseSRBsBenchmark(State, 16);
+}
+
+// Creates a shader resource binding and binds all its resources.
+DILIGENT_BENCHMARK(SRB_CreateAndBindResources)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        auto pSRB = Res.CreateSRB(true);
+    }
+}
+
+// Looks up the variable by name and sets it, as applications that do not cache variables do.
+DILIGENT_BENCHMARK(SRB_GetVariableByNameAndSet)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(Res.pTextureSRVs[i++ & 0x01], SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+}
+
+namespace
+{
+
+// Returns the number of constant buffers that the device is guaranteed to support in one shader stage.
+// Vulkan and OpenGL only guarantee 12, and D3D11 has 14 slots. The null device has no limit.
+Uint32 GetMaxConstantBuffersPerStage(IRenderDevice* pDevice)
+{
+    return pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_NULL ? ~0u : 12u;
+}
+
+// Looks up every variable of a signature with NumVariables mutable constant buffers
+// by name, in order. Signatures with few variables use linear search, while larger
+// ones use the variable name hash.
+void GetVariableByNameBenchmark(BenchmarkState& State, Uint32 NumVariables)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+    if (NumVariables > GetMaxConstantBuffersPerStage(pDevice))
+    {
+        State.SkipWithMessage("The number of constant buffers exceeds the per-stage limit of the device");
+        return;
+    }
+
+    std::vector<std::string> Names(NumVariables);
+    for (Uint32 i = 0; i < NumVariables; ++i)
+        Names[i] = "cbVariable" + std::to_string(i);
+
+    std::vector<PipelineResourceDesc> Resources(NumVariables);
+    for (Uint32 i = 0; i < NumVariables; ++i)
+    {
+        Resources[i] = {SHADER_TYPE_PIXEL, Names[i].c_str(), 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE};
+    }
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "GetVariableByName benchmark signature";
+    PRSDesc.Resources    = Resources.data();
+    PRSDesc.NumResources = NumVariables;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    if (pSignature)
+        pSignature->CreateShaderResourceBinding(&pSRB);
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    Uint32 NumFound = 0;
+    Uint32 i        = 0;
+    while (State.KeepRunning())
+    {
+        if (pSRB->GetVariableByName(SHADER_TYPE_PIXEL, Names[i].c_str()) != nullptr)
+            ++NumFound;
+        if (++i == NumVariables)
+            i = 0;
+    }
+
+    if (NumFound == 0)
+        State.SkipWithMessage("Variables were not found");
+}
+
+} // namespace
+
+DILIGENT_BENCHMARK(SRB_GetVariableByName_8)
+{
+    GetVariableByNameBenchmark(State, 8);
+}
+
+DILIGENT_BENCHMARK(SRB_GetVariableByName_64)
+{
+    GetVariableByNameBenchmark(State, 64);
+}
+
+DILIGENT_BENCHMARK(SRB_GetVariableByName_512)
+{
+    GetVariableByNameBenchmark(State, 512);
+}
+
+// Sets a cached mutable variable, alternating between two resources.
+DILIGENT_BENCHMARK(SRB_SetMutableVariable)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture");
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        pVar->Set(Res.pTextureSRVs[i++ & 0x01], SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+}
+
+// Sets a cached dynamic variable, alternating between two resources.
+DILIGENT_BENCHMARK(SRB_SetDynamicVariable)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynTexture");
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        pVar->Set(Res.pTextureSRVs[i++ & 0x01]);
+    }
+}
+
+// Sets all mutable variables of the SRB one by one.
+DILIGENT_BENCHMARK(SRB_SetMutableVariables_Individually)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    auto* pCBVar  = pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants");
+    auto* pTexVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture");
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        pCBVar->Set(Res.pConstants, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+        pTexVar->Set(Res.pTextureSRVs[i++ & 0x01], SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+}
+
+// Sets all mutable variables of the SRB with a single IShaderResourceBinding::SetVariables call.
+DILIGENT_BENCHMARK(SRB_SetMutableVariables_Batch)
+{
+    auto* pDevice = BenchmarkEnvironment::GetInstance()->GetDevice();
+
+    SRBBenchmarkResources Res{pDevice};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    IDeviceObject* pCBObj = Res.pConstants;
+
+    ShaderVariableBinding Bindings[2];
+    Bindings[0] = {pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants"), &pCBObj, 0, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE};
+    Bindings[1] = {pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture"), nullptr, 0, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE};
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        IDeviceObject* pTexObj = Res.pTextureSRVs[i++ & 0x01];
+        Bindings[1].ppObjects  = &pTexObj;
+        pSRB->SetVariables(Bindings, _countof(Bindings));
+    }
+}
+
+// Commits the SRB with state transitions. After the first commit, all resources
+// are already in the required states, so this measures the steady-state cost.
+DILIGENT_BENCHMARK(SRB_CommitShaderResources_Transition)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SRBBenchmarkResources Res{pEnv->GetDevice()};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+}
+
+// Commits the SRB without state transitions.
+DILIGENT_BENCHMARK(SRB_CommitShaderResources_NoTransition)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SRBBenchmarkResources Res{pEnv->GetDevice()};
+    auto                  pSRB = Res.IsValid() ? Res.CreateSRB(true) : RefCntAutoPtr<IShaderResourceBinding>{};
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    // Transition the resources once so that the state is valid
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    while (State.KeepRunning())
+    {
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    }
+}
+
+// Alternates between several SRBs, which defeats the redundant-commit checks
+// and is closer to a real draw loop.
+DILIGENT_BENCHMARK(SRB_CommitShaderResources_Alternating)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SRBBenchmarkResources Res{pEnv->GetDevice()};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    constexpr Uint32 NumSRBs = 8;
+
+    std::array<RefCntAutoPtr<IShaderResourceBinding>, NumSRBs> pSRBs;
+    for (auto& pSRB : pSRBs)
+    {
+        pSRB = Res.CreateSRB(true);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        pContext->CommitShaderResources(pSRBs[i++ % NumSRBs], RESOURCE_STATE_TRANSITION_MODE_NONE);
+    }
+}
+
+// Commits an SRB whose signature only contains dynamic resources. Dynamic descriptors are
+// written every time the SRB is committed, which makes this benchmark sensitive to the cost
+// of descriptor updates (e.g. descriptor update templates on Vulkan).
+DILIGENT_BENCHMARK(SRB_CommitShaderResources_DynamicResources)
+{
+    auto* pEnv     = BenchmarkEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    SRBBenchmarkResources Res{pDevice};
+    if (!Res.IsValid())
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    constexpr Uint32 NumBuffers  = 16;
+    constexpr Uint32 NumTextures = SRBBenchmarkResources::NumTextures;
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_DynBuffers",  NumBuffers,  SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_PIXEL, "g_DynTextures", NumTextures, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    const ImmutableSamplerDesc ImmutableSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_DynTextures", SamplerDesc{}},
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name                       = "Dynamic resources benchmark signature";
+    PRSDesc.Resources                  = Resources;
+    PRSDesc.NumResources               = _countof(Resources);
+    PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+    PRSDesc.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pSignature);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    if (pSignature)
+        pSignature->CreateShaderResourceBinding(&pSRB);
+    if (!pSRB)
+    {
+        State.SkipWithMessage("Failed to create resources");
+        return;
+    }
+
+    std::array<IDeviceObject*, NumBuffers> pBuffers;
+    pBuffers.fill(Res.pConstants);
+    std::array<IDeviceObject*, NumTextures> pTexSRVs;
+    for (Uint32 i = 0; i < NumTextures; ++i)
+        pTexSRVs[i] = Res.pTextureSRVs[i];
+
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynBuffers")->SetArray(pBuffers.data(), 0, NumBuffers);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynTextures")->SetArray(pTexSRVs.data(), 0, NumTextures);
+
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    // Dynamic descriptor sets are released when the frame is finished
+    constexpr Uint32 IterationsPerFrame = 256;
+    while (State.KeepRunning())
+    {
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+        if (State.GetIteration() % IterationsPerFrame == 0)
+        {
+            State.PauseTiming();
+            pContext->Flush();
+            pContext->FinishFrame();
+            pDevice->ReleaseStaleResources();
+            State.ResumeTiming();
+        }
+    }
+    State.SetItemsProcessed(State.GetIteration() * (NumBuffers + NumTextures));
+}
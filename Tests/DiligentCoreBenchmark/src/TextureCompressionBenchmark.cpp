@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "TextureCompression.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr Uint32 ImageWidth  = 1024;
+constexpr Uint32 ImageHeight = 1024;
+constexpr size_t NumPixels   = size_t{ImageWidth} * ImageHeight;
+
+// Smooth gradients rather than noise, which is not representative of compressed textures
+const std::vector<Uint8>& GetSourceData()
+{
+    static const std::vector<Uint8> Data = []() {
+        std::vector<Uint8> Data(NumPixels * 4);
+        for (Uint32 y = 0; y < ImageHeight; ++y)
+        {
+            for (Uint32 x = 0; x < ImageWidth; ++x)
+            {
+                const float u = static_cast<float>(x) / static_cast<float>(ImageWidth);
+                const float v = static_cast<float>(y) / static_cast<float>(ImageHeight);
+
+                Uint8* pPixel = &Data[(size_t{y} * ImageWidth + x) * 4];
+                pPixel[0]     = static_cast<Uint8>(127.5f + 127.5f * std::sin(u * 40.f + v * 13.f));
+                pPixel[1]     = static_cast<Uint8>(127.5f + 127.5f * std::cos(v * 31.f - u * 7.f));
+                pPixel[2]     = static_cast<Uint8>((u * u + v) * 127.f);
+                pPixel[3]     = static_cast<Uint8>(127.5f + 127.5f * std::sin(u * v * 200.f));
+            }
+        }
+        return Data;
+    }();
+    return Data;
+}
+
+void RunCompression(BenchmarkState& State, TEXTURE_FORMAT Format, bool UseThreadPool = false)
+{
+    // The source data is interpreted as R8, RG8 or RGBA8 depending on the format
+    std::vector<Uint8> DstData(NumPixels);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (UseThreadPool)
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+
+    CompressTextureDataAttribs Attribs;
+    Attribs.Format      = Format;
+    Attribs.Width       = ImageWidth;
+    Attribs.Height      = ImageHeight;
+    Attribs.pSrcData    = GetSourceData().data();
+    Attribs.pDstData    = DstData.data();
+    Attribs.pThreadPool = pThreadPool;
+    while (State.KeepRunning())
+    {
+        CompressTextureData(Attribs);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumPixels);
+}
+
+} // namespace
+
+// Compresses RGBA8 data to BC1.
+DILIGENT_BENCHMARK(TextureCompression_BC1)
+{
+    RunCompression(State, TEX_FORMAT_BC1_UNORM);
+}
+
+// Compresses RGBA8 data to BC3.
+DILIGENT_BENCHMARK(TextureCompression_BC3)
+{
+    RunCompression(State, TEX_FORMAT_BC3_UNORM);
+}
+
+// Compresses R8 data to BC4.
+DILIGENT_BENCHMARK(TextureCompression_BC4)
+{
+    RunCompression(State, TEX_FORMAT_BC4_UNORM);
+}
+
+// Compresses RG8 data to BC5.
+DILIGENT_BENCHMARK(TextureCompression_BC5)
+{
+    RunCompression(State, TEX_FORMAT_BC5_UNORM);
+}
+
+// Compresses RGBA8 data to BC7.
+DILIGENT_BENCHMARK(TextureCompression_BC7)
+{
+    RunCompression(State, TEX_FORMAT_BC7_UNORM);
+}
+
+// Compresses RGBA8 data to BC7 using a thread pool with 3 threads.
+DILIGENT_BENCHMARK(TextureCompression_BC7_Parallel)
+{
+    RunCompression(State, TEX_FORMAT_BC7_UNORM, true);
+}
@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+#include "TextureConversion.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+namespace
+{
+
+constexpr Uint32 ImageWidth  = 1024;
+constexpr Uint32 ImageHeight = 1024;
+constexpr size_t NumPixels   = size_t{ImageWidth} * ImageHeight;
+
+const std::vector<Uint8>& GetSourceData()
+{
+    static const std::vector<Uint8> Data = []() {
+        FastRandInt        Rnd{0, 0, 255};
+        std::vector<Uint8> Data(NumPixels * 16);
+        for (Uint8& Val : Data)
+            Val = static_cast<Uint8>(Rnd());
+        return Data;
+    }();
+    return Data;
+}
+
+const std::vector<float>& GetSourceFloatData()
+{
+    static const std::vector<float> Data = []() {
+        FastRandFloat      Rnd{0, -0.25f, 1.25f};
+        std::vector<float> Data(NumPixels * 4);
+        for (float& Val : Data)
+            Val = Rnd();
+        return Data;
+    }();
+    return Data;
+}
+
+void RunConversion(BenchmarkState& State,
+                   TEXTURE_FORMAT  SrcFormat,
+                   Uint32          SrcNumComponents,
+                   const void*     pSrcData,
+                   TEXTURE_FORMAT  DstFormat,
+                   Uint32          DstNumComponents = 0)
+{
+    std::vector<Uint8> DstData(NumPixels * 16);
+
+    ConvertTextureDataAttribs Attribs;
+    Attribs.SrcFormat        = SrcFormat;
+    Attribs.SrcNumComponents = SrcNumComponents;
+    Attribs.pSrcData         = pSrcData;
+    Attribs.DstFormat        = DstFormat;
+    Attribs.DstNumComponents = DstNumComponents;
+    Attribs.pDstData         = DstData.data();
+    Attribs.Width            = ImageWidth;
+    Attribs.Height           = ImageHeight;
+    while (State.KeepRunning())
+    {
+        ConvertTextureData(Attribs);
+    }
+    State.SetItemsProcessed(State.GetIteration() * NumPixels);
+}
+
+} // namespace
+
+// Expands 24-bit RGB data to RGBA8.
+DILIGENT_BENCHMARK(TextureConversion_RGB8ToRGBA8)
+{
+    RunConversion(State, TEX_FORMAT_RGBA8_UNORM, 3, GetSourceData().data(), TEX_FORMAT_RGBA8_UNORM);
+}
+
+// Swaps red and blue channels of BGRA8 data.
+DILIGENT_BENCHMARK(TextureConversion_BGRA8ToRGBA8)
+{
+    RunConversion(State, TEX_FORMAT_BGRA8_UNORM, 0, GetSourceData().data(), TEX_FORMAT_RGBA8_UNORM);
+}
+
+// Converts sRGB RGBA8 data to linear RGBA8.
+DILIGENT_BENCHMARK(TextureConversion_SRGB8ToLinear8)
+{
+    RunConversion(State, TEX_FORMAT_RGBA8_UNORM_SRGB, 0, GetSourceData().data(), TEX_FORMAT_RGBA8_UNORM);
+}
+
+// Converts RGBA8 data to RGBA32_FLOAT.
+DILIGENT_BENCHMARK(TextureConversion_RGBA8ToRGBA32F)
+{
+    RunConversion(State, TEX_FORMAT_RGBA8_UNORM, 0, GetSourceData().data(), TEX_FORMAT_RGBA32_FLOAT);
+}
+
+// Converts RGBA32_FLOAT data to RGBA8.
+DILIGENT_BENCHMARK(TextureConversion_RGBA32FToRGBA8)
+{
+    RunConversion(State, TEX_FORMAT_RGBA32_FLOAT, 0, GetSourceFloatData().data(), TEX_FORMAT_RGBA8_UNORM);
+}
+
+// Converts RGBA32_FLOAT data to RGBA16_FLOAT.
+DILIGENT_BENCHMARK(TextureConversion_RGBA32FToRGBA16F)
+{
+    RunConversion(State, TEX_FORMAT_RGBA32_FLOAT, 0, GetSourceFloatData().data(), TEX_FORMAT_RGBA16_FLOAT);
+}
+
+// Packs RGBA32_FLOAT data to RGB10A2_UNORM.
+DILIGENT_BENCHMARK(TextureConversion_RGBA32FToRGB10A2)
+{
+    RunConversion(State, TEX_FORMAT_RGBA32_FLOAT, 0, GetSourceFloatData().data(), TEX_FORMAT_RGB10A2_UNORM);
+}
+
+// Converts RGBA32_FLOAT data to RGBA16_UNORM, which uses the generic per-component path.
+DILIGENT_BENCHMARK(TextureConversion_RGBA32FToRGBA16Generic)
+{
+    RunConversion(State, TEX_FORMAT_RGBA32_FLOAT, 0, GetSourceFloatData().data(), TEX_FORMAT_RGBA16_UNORM);
+}
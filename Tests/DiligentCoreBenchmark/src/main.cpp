@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "BenchmarkFramework.hpp"
+#include "BenchmarkEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+#include "APIInfo.h"
+
+using namespace Diligent;
+using namespace Diligent::Benchmark;
+
+int main(int argc, char** argv)
+{
+    std::unique_ptr<BenchmarkEnvironment> pEnv;
+    try
+    {
+        pEnv.reset(new BenchmarkEnvironment{BenchmarkEnvironment::ParseArgs(argc, argv)});
+    }
+    catch (...)
+    {
+        std::cerr << "Failed to create the benchmark environment\n";
+        return -1;
+    }
+
+    BenchmarkRunSettings Settings;
+    ParseBenchmarkArgs(argc, argv, Settings);
+
+    const auto& DeviceInfo  = pEnv->GetDevice()->GetDeviceInfo();
+    const auto& AdapterInfo = pEnv->GetDevice()->GetAdapterInfo();
+
+    Settings.Context = {
+        {"executable", argv[0]},
+        {"device_type", GetRenderDeviceTypeString(DeviceInfo.Type)},
+        {"api_version", std::to_string(DeviceInfo.APIVersion.Major) + "." + std::to_string(DeviceInfo.APIVersion.Minor)},
+        {"adapter", AdapterInfo.Description},
+        {"adapter_type", GetAdapterTypeString(AdapterInfo.Type)},
+        {"diligent_api_version", std::to_string(DILIGENT_API_VERSION)},
+    };
+    Settings.OnRunFinished = []() {
+        BenchmarkEnvironment::GetInstance()->Reset();
+    };
+
+    return RunBenchmarks(Settings);
+}
@@ -0,0 +1,290 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AsyncFileIO.hpp"
+#include "AsyncFileStream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "FastRand.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr ASYNC_FILE_IO_BACKEND TestBackends[] = {ASYNC_FILE_IO_BACKEND_THREAD_POOL, ASYNC_FILE_IO_BACKEND_AUTO};
+
+// Temporary file filled with random data
+class TestFile
+{
+public:
+    explicit TestFile(size_t Size = 3 * 1024 * 1024 + 123) :
+        m_Path{m_TmpDir.Get() + FileSystem::SlashSymbol + "AsyncFileIOTest.bin"},
+        m_Data(Size)
+    {
+        FastRandInt Rnd{0, 0, 255};
+        for (Uint8& Val : m_Data)
+            Val = static_cast<Uint8>(Rnd());
+
+        const bool Written = FileWrapper::WriteFile(m_Path.c_str(), m_Data.data(), m_Data.size());
+        EXPECT_TRUE(Written) << "Failed to write " << m_Path;
+    }
+
+    const char*               GetPath() const { return m_Path.c_str(); }
+    const std::vector<Uint8>& GetData() const { return m_Data; }
+
+private:
+    TempDirectory      m_TmpDir;
+    std::string        m_Path;
+    std::vector<Uint8> m_Data;
+};
+
+RefCntAutoPtr<AsyncFileIO> CreateTestFileIO(ASYNC_FILE_IO_BACKEND Backend, IThreadPool* pCompletionThreadPool = nullptr)
+{
+    AsyncFileIOCreateInfo CI;
+    CI.Backend               = Backend;
+    CI.QueueDepth            = 8;
+    CI.pCompletionThreadPool = pCompletionThreadPool;
+    return CreateAsyncFileIO(CI);
+}
+
+TEST(Common_AsyncFileIO, BatchedReads)
+{
+    const TestFile            File;
+    const std::vector<Uint8>& FileData = File.GetData();
+
+    for (ASYNC_FILE_IO_BACKEND Backend : TestBackends)
+    {
+        for (bool UseCompletionThreadPool : {false, true})
+        {
+            RefCntAutoPtr<IThreadPool> pThreadPool;
+            if (UseCompletionThreadPool)
+                pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+
+            RefCntAutoPtr<AsyncFileIO> pFileIO = CreateTestFileIO(Backend, pThreadPool);
+            ASSERT_NE(pFileIO, nullptr);
+            if (Backend == ASYNC_FILE_IO_BACKEND_THREAD_POOL)
+            {
+                EXPECT_EQ(pFileIO->GetBackend(), ASYNC_FILE_IO_BACKEND_THREAD_POOL);
+            }
+
+            RefCntAutoPtr<AsyncFile> pFile = pFileIO->OpenFile(File.GetPath());
+            ASSERT_NE(pFile, nullptr);
+            EXPECT_EQ(pFile->GetSize(), FileData.size());
+
+            // More requests than the queue depth, including the reads that cross
+            // and start past the end of the file
+            constexpr size_t NumRequests = 100;
+
+            FastRandInt         Rnd{1, 0, 32766};
+            std::vector<size_t> Offsets(NumRequests);
+            std::vector<size_t> Sizes(NumRequests);
+            for (size_t i = 0; i < NumRequests; ++i)
+            {
+                Offsets[i] = static_cast<size_t>(Rnd()) * 97 % FileData.size();
+                Sizes[i]   = static_cast<size_t>(Rnd()) * 2 + 1;
+            }
+            Offsets[0] = FileData.size() - 10;
+            Sizes[0]   = 100;
+            Offsets[1] = FileData.size() + 10;
+            Sizes[1]   = 100;
+
+            std::vector<std::vector<Uint8>>   Data(NumRequests);
+            std::vector<AsyncFileReadRequest> Requests(NumRequests);
+            std::vector<size_t>               BytesRead(NumRequests, ~size_t{0});
+            std::atomic<size_t>               NumCompleted{0};
+            for (size_t i = 0; i < NumRequests; ++i)
+            {
+                Data[i].resize(Sizes[i]);
+
+                AsyncFileReadRequest& Request = Requests[i];
+
+                Request.pFile      = pFile;
+                Request.Offset     = Offsets[i];
+                Request.pData      = Data[i].data();
+                Request.Size       = Sizes[i];
+                Request.OnComplete = [&, i](size_t Size) {
+                    BytesRead[i] = Size;
+                    NumCompleted.fetch_add(1);
+                };
+            }
+            pFileIO->SubmitReads(Requests.data(), Requests.size());
+            pFileIO->WaitForAllReads();
+            EXPECT_EQ(NumCompleted, NumRequests);
+
+            for (size_t i = 0; i < NumRequests; ++i)
+            {
+                const size_t ExpectedSize = Offsets[i] < FileData.size() ? std::min(Sizes[i], FileData.size() - Offsets[i]) : 0;
+                ASSERT_EQ(BytesRead[i], ExpectedSize) << i;
+                if (ExpectedSize > 0)
+                {
+                    EXPECT_EQ(memcmp(Data[i].data(), &FileData[Offsets[i]], ExpectedSize), 0) << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(Common_AsyncFileIO, ReadTaskPrerequisite)
+{
+    const TestFile            File;
+    const std::vector<Uint8>& FileData = File.GetData();
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    for (ASYNC_FILE_IO_BACKEND Backend : TestBackends)
+    {
+        RefCntAutoPtr<AsyncFileIO> pFileIO = CreateTestFileIO(Backend);
+        ASSERT_NE(pFileIO, nullptr);
+
+        RefCntAutoPtr<AsyncFile> pFile = pFileIO->OpenFile(File.GetPath());
+        ASSERT_NE(pFile, nullptr);
+
+        // Processing tasks start when the corresponding reads are complete
+        constexpr size_t NumChunks   = 16;
+        constexpr size_t ChunkSize   = 4096;
+        constexpr size_t ChunkStride = ChunkSize * 7;
+
+        std::vector<std::vector<Uint8>>        Data(NumChunks, std::vector<Uint8>(ChunkSize));
+        std::vector<Uint32>                    Checksums(NumChunks);
+        std::vector<RefCntAutoPtr<IAsyncTask>> ProcessTasks(NumChunks);
+        for (size_t i = 0; i < NumChunks; ++i)
+        {
+            AsyncFileReadRequest Request;
+            Request.pFile  = pFile;
+            Request.Offset = i * ChunkStride;
+            Request.pData  = Data[i].data();
+            Request.Size   = ChunkSize;
+
+            RefCntAutoPtr<IAsyncTask> pReadTask = pFileIO->ReadAsync(Request);
+            ASSERT_NE(pReadTask, nullptr);
+
+            IAsyncTask* pPrereq = pReadTask;
+            ProcessTasks[i]     = EnqueueAsyncWork(pThreadPool, &pPrereq, 1,
+                                                   [&Data, &Checksums, i](Uint32 ThreadId) {
+                                                   Uint32 Checksum = 0;
+                                                   for (Uint8 Val : Data[i])
+                                                       Checksum = Checksum * 31 + Val;
+                                                   Checksums[i] = Checksum;
+                                                   return ASYNC_TASK_STATUS_COMPLETE;
+                                               });
+        }
+        pThreadPool->WaitForAllTasks();
+
+        for (size_t i = 0; i < NumChunks; ++i)
+        {
+            EXPECT_TRUE(ProcessTasks[i]->IsFinished());
+            Uint32 Checksum = 0;
+            for (size_t j = 0; j < ChunkSize; ++j)
+                Checksum = Checksum * 31 + FileData[i * ChunkStride + j];
+            EXPECT_EQ(Checksums[i], Checksum) << i;
+        }
+    }
+}
+
+TEST(Common_AsyncFileIO, ReadFileAsync)
+{
+    const TestFile File;
+    for (ASYNC_FILE_IO_BACKEND Backend : TestBackends)
+    {
+        RefCntAutoPtr<AsyncFileIO> pFileIO = CreateTestFileIO(Backend);
+        ASSERT_NE(pFileIO, nullptr);
+
+        RefCntAutoPtr<AsyncFile> pFile = pFileIO->OpenFile(File.GetPath());
+        ASSERT_NE(pFile, nullptr);
+
+        RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+        RefCntAutoPtr<IAsyncTask>   pTask = ReadFileAsync(pFileIO, pFile, pData, 256 << 10);
+        ASSERT_NE(pTask, nullptr);
+        pTask->WaitForCompletion();
+        EXPECT_EQ(pTask->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+        ASSERT_EQ(pData->GetSize(), File.GetData().size());
+        EXPECT_EQ(memcmp(pData->GetConstDataPtr(), File.GetData().data(), pData->GetSize()), 0);
+    }
+}
+
+TEST(Common_AsyncFileIO, FileStream)
+{
+    const TestFile            File;
+    const std::vector<Uint8>& FileData = File.GetData();
+
+    for (ASYNC_FILE_IO_BACKEND Backend : TestBackends)
+    {
+        RefCntAutoPtr<AsyncFileIO> pFileIO = CreateTestFileIO(Backend);
+        ASSERT_NE(pFileIO, nullptr);
+
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+            EXPECT_EQ(AsyncFileStream::Create(pFileIO, (std::string{File.GetPath()} + ".missing").c_str()), nullptr);
+        }
+
+        RefCntAutoPtr<AsyncFileStream> pStream = AsyncFileStream::Create(pFileIO, File.GetPath(), 64 << 10, 3);
+        ASSERT_NE(pStream, nullptr);
+        EXPECT_TRUE(pStream->IsValid());
+        EXPECT_EQ(pStream->GetSize(), FileData.size());
+
+        // Sequential reads of varying sizes that cross the chunk boundaries
+        std::vector<Uint8> Data(FileData.size());
+        for (size_t Offset = 0, Size = 1; Offset < Data.size(); Size = Size * 3 + 7)
+        {
+            Size = std::min(Size, Data.size() - Offset);
+            ASSERT_TRUE(pStream->Read(&Data[Offset], Size));
+            Offset += Size;
+            EXPECT_EQ(pStream->GetPos(), Offset);
+        }
+        EXPECT_EQ(Data, FileData);
+
+        Uint8 Byte = 0;
+        EXPECT_FALSE(pStream->Read(&Byte, 1));
+
+        // Seek backwards
+        constexpr size_t Offset = 1000;
+        EXPECT_TRUE(pStream->SetPos(Offset, static_cast<int>(FilePosOrigin::Start)));
+        std::vector<Uint8> Data2(200000);
+        ASSERT_TRUE(pStream->Read(Data2.data(), Data2.size()));
+        EXPECT_EQ(memcmp(Data2.data(), &FileData[Offset], Data2.size()), 0);
+
+        // Read the rest of the file
+        RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create();
+        pStream->ReadBlob(pBlob);
+        ASSERT_EQ(pBlob->GetSize(), FileData.size() - Offset - Data2.size());
+        EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), &FileData[Offset + Data2.size()], pBlob->GetSize()), 0);
+    }
+}
+
+} // namespace
@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<float4x4> GetRandomMatrices(size_t Count, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -10.f, +10.f};
+
+    std::vector<float4x4> Matrices(Count);
+    for (float4x4& m : Matrices)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+                m.m[i][j] = Rnd();
+        }
+    }
+    return Matrices;
+}
+
+void CheckIdentity(const float4x4& m, float Tolerance)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            EXPECT_NEAR(m.m[i][j], i == j ? 1.f : 0.f, Tolerance) << "i=" << i << " j=" << j;
+        }
+    }
+}
+
+TEST(Common_BasicMathSIMD, MultiplyMatrices)
+{
+    constexpr size_t            Count = 37;
+    const std::vector<float4x4> Left  = GetRandomMatrices(Count, 0);
+    const std::vector<float4x4> Right = GetRandomMatrices(Count, 1);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        EXPECT_EQ(MultiplyMatrices(Left[i], Right[i]), Left[i] * Right[i]) << i;
+    }
+
+    {
+        std::vector<float4x4> Results(Count);
+        MultiplyMatrices(Left.data(), Right[0], Results.data(), Count);
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Left[i] * Right[0]) << i;
+
+        Results = Left;
+        MultiplyMatrices(Results.data(), Right[0], Results.data(), Count);
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Left[i] * Right[0]) << i;
+    }
+
+    {
+        std::vector<float4x4> Results(Count);
+        MultiplyMatrices(Left.data(), Right.data(), Results.data(), Count);
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Left[i] * Right[i]) << i;
+
+        // The result overlaps with the right matrices
+        Results = Right;
+        MultiplyMatrices(Left.data(), Results.data(), Results.data(), Count);
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Left[i] * Right[i]) << i;
+    }
+}
+
+TEST(Common_BasicMathSIMD, TransformPoints)
+{
+    constexpr size_t Count = 45;
+
+    const float4x4 m = float4x4::Scale(2.f, 3.f, 0.5f) *
+        float4x4::RotationY(0.7f) *
+        float4x4::Translation(1.f, -2.f, 5.f) *
+        float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    FastRandFloat Rnd{2, -50.f, +50.f};
+
+    std::vector<float4> Vectors(Count);
+    std::vector<float3> Points(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Vectors[i] = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+        Points[i]  = float3{Rnd(), Rnd(), Rnd()};
+    }
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        EXPECT_EQ(TransformVector(Vectors[i], m), Vectors[i] * m) << i;
+    }
+
+    {
+        std::vector<float4> Results(Count);
+        TransformPoints(Vectors.data(), Count, m, Results.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Vectors[i] * m) << i;
+
+        Results = Vectors;
+        TransformPoints(Results.data(), Count, m, Results.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Vectors[i] * m) << i;
+    }
+
+    {
+        std::vector<float3> Results(Count);
+        TransformPoints(Points.data(), Count, m, Results.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Points[i] * m) << i;
+
+        Results = Points;
+        TransformPoints(Results.data(), Count, m, Results.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Results[i], Points[i] * m) << i;
+    }
+}
+
+TEST(Common_BasicMathSIMD, InvertMatrix)
+{
+    {
+        const float4x4 m = float4x4::Scale(2.f, 3.f, 0.5f) *
+            float4x4::RotationX(-0.4f) *
+            float4x4::RotationY(0.7f) *
+            float4x4::Translation(1.f, -2.f, 5.f);
+
+        const float4x4 inv = InvertMatrix(m);
+        CheckIdentity(m * inv, 1e-5f);
+        CheckIdentity(inv * m, 1e-5f);
+    }
+
+    {
+        const float4x4 m = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+        const float4x4 inv = InvertMatrix(m);
+        CheckIdentity(m * inv, 1e-5f);
+    }
+
+    const std::vector<float4x4> Matrices = GetRandomMatrices(32, 3);
+    for (const float4x4& m : Matrices)
+    {
+        const float4x4 Ref = m.Inverse();
+        const float4x4 inv = InvertMatrix(m);
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                EXPECT_NEAR(inv.m[i][j], Ref.m[i][j], 1e-4f * std::max(1.f, std::abs(Ref.m[i][j])));
+            }
+        }
+    }
+}
+
+TEST(Common_BasicMathSIMD, WriteShaderMatrices)
+{
+    constexpr size_t            Count    = 5;
+    const std::vector<float4x4> Matrices = GetRandomMatrices(Count, 4);
+
+    for (bool Transpose : {false, true})
+    {
+        for (size_t Stride : {size_t{0}, sizeof(float4x4), sizeof(float4x4) + 16})
+        {
+            const size_t DstStride = Stride != 0 ? Stride : sizeof(float4x4);
+
+            // Offset the destination by 4 bytes to test unaligned writes
+            constexpr Uint8    Pattern = 0xCD;
+            std::vector<Uint8> Buffer(4 + Count * DstStride, Pattern);
+            WriteShaderMatrices(Matrices.data(), Count, Buffer.data() + 4, Stride, Transpose);
+
+            for (size_t i = 0; i < Count; ++i)
+            {
+                const Uint8* pDst = Buffer.data() + 4 + i * DstStride;
+
+                float4x4 Written;
+                memcpy(&Written, pDst, sizeof(float4x4));
+                EXPECT_EQ(Written, Transpose ? Matrices[i].Transpose() : Matrices[i]) << i;
+
+                for (size_t b = sizeof(float4x4); b < DstStride; ++b)
+                    EXPECT_EQ(pDst[b], Pattern) << "Padding must not be overwritten";
+            }
+            for (size_t b = 0; b < 4; ++b)
+                EXPECT_EQ(Buffer[b], Pattern);
+        }
+    }
+}
+
+} // namespace
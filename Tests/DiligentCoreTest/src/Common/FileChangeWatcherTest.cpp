@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FileChangeWatcher.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+bool HasFile(const std::vector<std::string>& ChangedFiles, const std::string& Path)
+{
+    return std::find(ChangedFiles.begin(), ChangedFiles.end(), Path) != ChangedFiles.end();
+}
+
+void WriteTextFile(const std::string& Path, const char* Text)
+{
+    const bool Written = FileWrapper::WriteFile(Path.c_str(), Text, strlen(Text));
+    EXPECT_TRUE(Written) << "Failed to write " << Path;
+}
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+TEST(Common_FileChangeWatcher, PollChanges)
+{
+    TempDirectory     TmpDir;
+    const std::string Root = FileSystem::SimplifyPath(TmpDir.Get().c_str(), '/');
+    ASSERT_TRUE(FileSystem::CreateDirectory((Root + "/Sub").c_str()));
+    WriteTextFile(Root + "/Existing.txt", "0");
+
+    FileChangeWatcher Watcher{Root.c_str()};
+    ASSERT_TRUE(Watcher.IsActive());
+
+    std::vector<std::string> ChangedFiles;
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(ChangedFiles.empty());
+
+    WriteTextFile(Root + "/Existing.txt", "1");
+    WriteTextFile(Root + "/Sub/New.txt", "2");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Existing.txt"));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Sub/New.txt"));
+
+    // Files in new directories must be reported, too
+    ChangedFiles.clear();
+    ASSERT_TRUE(FileSystem::CreateDirectory((Root + "/Sub/Dir").c_str()));
+    WriteTextFile(Root + "/Sub/Dir/File0.txt", "3");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Sub/Dir/File0.txt"));
+
+    ChangedFiles.clear();
+    WriteTextFile(Root + "/Sub/Dir/File1.txt", "4");
+    FileSystem::DeleteFile((Root + "/Existing.txt").c_str());
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Sub/Dir/File1.txt"));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Existing.txt"));
+
+    ChangedFiles.clear();
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(ChangedFiles.empty());
+}
+
+TEST(Common_FileChangeWatcher, RemovedDirectories)
+{
+    TempDirectory     TmpDir;
+    const std::string Root = FileSystem::SimplifyPath(TmpDir.Get().c_str(), '/');
+    ASSERT_TRUE(FileSystem::CreateDirectory((Root + "/Moved/Sub").c_str()));
+    ASSERT_TRUE(FileSystem::CreateDirectory((Root + "/Deleted").c_str()));
+    WriteTextFile(Root + "/Moved/Sub/File.txt", "0");
+    WriteTextFile(Root + "/Deleted/File.txt", "0");
+
+    FileChangeWatcher Watcher{Root.c_str()};
+    ASSERT_TRUE(Watcher.IsActive());
+
+    // Removed directories must be reported rather than their files
+    std::vector<std::string> ChangedFiles;
+    ASSERT_EQ(std::rename((Root + "/Moved").c_str(), (Root + "/Renamed").c_str()), 0);
+    EXPECT_TRUE(FileSystem::DeleteDirectory((Root + "/Deleted").c_str()));
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Moved"));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Deleted"));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Renamed/Sub/File.txt"));
+
+    // Changes in the moved directory must be reported under the new path only
+    ChangedFiles.clear();
+    WriteTextFile(Root + "/Renamed/Sub/File.txt", "1");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    ASSERT_EQ(ChangedFiles.size(), size_t{1});
+    EXPECT_EQ(ChangedFiles[0], Root + "/Renamed/Sub/File.txt");
+
+    // Directories that are created at the old paths must be watched
+    ChangedFiles.clear();
+    ASSERT_TRUE(FileSystem::CreateDirectory((Root + "/Moved/Sub").c_str()));
+    WriteTextFile(Root + "/Moved/Sub/File.txt", "2");
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(HasFile(ChangedFiles, Root + "/Moved/Sub/File.txt"));
+    EXPECT_FALSE(HasFile(ChangedFiles, Root + "/Renamed/Sub/File.txt"));
+}
+#endif
+
+TEST(Common_FileChangeWatcher, NoDirectories)
+{
+    FileChangeWatcher Watcher{nullptr};
+    EXPECT_FALSE(Watcher.IsActive());
+
+    std::vector<std::string> ChangedFiles;
+    EXPECT_TRUE(Watcher.PollChanges(ChangedFiles));
+    EXPECT_TRUE(ChangedFiles.empty());
+}
+
+} // namespace
@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+ViewFrustumExt GetTestFrustum(bool IsGL)
+{
+    const float4x4 View     = float4x4::RotationY(0.3f) * float4x4::Translation(1.f, -2.f, 5.f);
+    const float4x4 Proj     = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, IsGL);
+    const float4x4 ViewProj = View * Proj;
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(ViewProj, Frustum, IsGL);
+    return Frustum;
+}
+
+struct TestBoxes
+{
+    std::array<std::vector<float>, 6> MinMax;
+    std::array<std::vector<float>, 6> CenterExtents;
+    std::vector<BoundBox>             Boxes;
+
+    TestBoxes(size_t NumBoxes)
+    {
+        for (auto& Arr : MinMax)
+            Arr.resize(NumBoxes);
+        for (auto& Arr : CenterExtents)
+            Arr.resize(NumBoxes);
+        Boxes.resize(NumBoxes);
+
+        FastRandFloat Pos{0, -120.f, +120.f};
+        FastRandFloat Size{1, 0.f, 30.f};
+        for (size_t i = 0; i < NumBoxes; ++i)
+        {
+            const float3 Center{Pos(), Pos(), Pos()};
+            const float3 HalfExtent{Size(), Size(), Size()};
+            // Use exact min/max so that both layouts describe the same boxes
+            const BoundBox Box{Center - HalfExtent, Center + HalfExtent};
+            for (int c = 0; c < 3; ++c)
+            {
+                MinMax[c][i]            = Box.Min[c];
+                MinMax[3 + c][i]        = Box.Max[c];
+                CenterExtents[c][i]     = Center[c];
+                CenterExtents[3 + c][i] = HalfExtent[c];
+            }
+            Boxes[i] = Box;
+        }
+    }
+
+    BoundBoxArrays GetArrays(BoundBoxArrays::LAYOUT Layout) const
+    {
+        const auto&    Data = Layout == BoundBoxArrays::LAYOUT_MIN_MAX ? MinMax : CenterExtents;
+        BoundBoxArrays Arrays;
+        for (int c = 0; c < 3; ++c)
+        {
+            Arrays.pMinOrCenter[c]     = Data[c].data();
+            Arrays.pMaxOrHalfExtent[c] = Data[3 + c].data();
+        }
+        Arrays.Count  = Boxes.size();
+        Arrays.Layout = Layout;
+        return Arrays;
+    }
+};
+
+// Returns true if the box touches one of the planes, so that the result of the test
+// depends on floating-point rounding.
+bool IsBorderlineBox(const ViewFrustumExt& Frustum, const BoundBox& Box, FRUSTUM_PLANE_FLAGS PlaneFlags)
+{
+    constexpr double Eps = 1e-4;
+    for (Uint32 i = 0; i < ViewFrustum::NUM_PLANES; ++i)
+    {
+        if ((PlaneFlags & (1 << i)) == 0)
+            continue;
+
+        const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(i));
+
+        double Distance = Plane.Distance;
+        double ProjHalf = 0;
+        double Scale    = std::abs(Plane.Distance);
+        for (int c = 0; c < 3; ++c)
+        {
+            const double Center = (double{Box.Min[c]} + double{Box.Max[c]}) * 0.5;
+            const double Extent = (double{Box.Max[c]} - double{Box.Min[c]}) * 0.5;
+
+            Distance += Center * Plane.Normal[c];
+            ProjHalf += Extent * std::abs(Plane.Normal[c]);
+            Scale += (std::abs(Center) + Extent) * std::abs(Plane.Normal[c]);
+        }
+        if (std::abs(Distance - ProjHalf) <= Eps * Scale || std::abs(Distance + ProjHalf) <= Eps * Scale)
+            return true;
+    }
+
+    for (const float3& Corner : Frustum.FrustumCorners)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            const double Scale = std::abs(Corner[c]) + 1.0;
+            if (std::abs(Corner[c] - Box.Min[c]) <= Eps * Scale || std::abs(Corner[c] - Box.Max[c]) <= Eps * Scale)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void TestBatchVisibility(size_t NumBoxes, IThreadPool* pThreadPool)
+{
+    const TestBoxes Boxes{NumBoxes};
+    for (bool IsGL : {false, true})
+    {
+        const ViewFrustumExt Frustum = GetTestFrustum(IsGL);
+        for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_NONE})
+        {
+            std::vector<BoxVisibility> RefVisibility(NumBoxes);
+            std::vector<Uint32>        RefIndices;
+            size_t                     NumVisible[3] = {};
+            for (size_t i = 0; i < NumBoxes; ++i)
+            {
+                RefVisibility[i] = GetBoxVisibility(Frustum, Boxes.Boxes[i], PlaneFlags);
+                if (RefVisibility[i] != BoxVisibility::Invisible)
+                    RefIndices.push_back(static_cast<Uint32>(i));
+                ++NumVisible[static_cast<int>(RefVisibility[i])];
+            }
+            if (PlaneFlags != FRUSTUM_PLANE_FLAG_NONE && NumBoxes > 1000)
+            {
+                // Make sure that the test covers all cases
+                EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::Invisible)], 0u);
+                EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::Intersecting)], 0u);
+                EXPECT_GT(NumVisible[static_cast<int>(BoxVisibility::FullyVisible)], 0u);
+            }
+
+            for (BoundBoxArrays::LAYOUT Layout : {BoundBoxArrays::LAYOUT_MIN_MAX, BoundBoxArrays::LAYOUT_CENTER_HALF_EXTENTS})
+            {
+                const BoundBoxArrays Arrays = Boxes.GetArrays(Layout);
+
+                std::vector<BoxVisibility> Visibility(NumBoxes);
+                GetBoxVisibility(Frustum, Arrays, Visibility.data(), PlaneFlags, pThreadPool);
+
+                std::vector<Uint32> Indices(NumBoxes);
+                Indices.resize(GetVisibleBoxes(Frustum, Arrays, Indices.data(), PlaneFlags, pThreadPool));
+
+                size_t RefIdx = 0;
+                size_t Idx    = 0;
+                for (size_t i = 0; i < NumBoxes; ++i)
+                {
+                    const bool IsVisible = Idx < Indices.size() && Indices[Idx] == i;
+                    if (IsVisible)
+                        ++Idx;
+                    const bool IsRefVisible = RefIdx < RefIndices.size() && RefIndices[RefIdx] == i;
+                    if (IsRefVisible)
+                        ++RefIdx;
+
+                    if (Visibility[i] != RefVisibility[i] || IsVisible != IsRefVisible)
+                    {
+                        EXPECT_TRUE(IsBorderlineBox(Frustum, Boxes.Boxes[i], PlaneFlags)) << "Box " << i;
+                    }
+                    EXPECT_EQ(IsVisible, Visibility[i] != BoxVisibility::Invisible) << "Box " << i;
+                }
+                EXPECT_EQ(Idx, Indices.size()) << "Indices are not sorted";
+            }
+        }
+    }
+}
+
+TEST(Common_FrustumCulling, GetBoxVisibility)
+{
+    // Test all tail sizes
+    for (size_t NumBoxes = 1; NumBoxes <= 17; ++NumBoxes)
+        TestBatchVisibility(NumBoxes, nullptr);
+
+    TestBatchVisibility(10007, nullptr);
+}
+
+TEST(Common_FrustumCulling, GetBoxVisibilityParallel)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    TestBatchVisibility(100003, pThreadPool);
+
+    // All boxes must be processed even if the pool has no threads
+    RefCntAutoPtr<IThreadPool> pEmptyPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    TestBatchVisibility(50001, pEmptyPool);
+}
+
+TEST(Common_FrustumCulling, KnownBoxes)
+{
+    const ViewFrustumExt Frustum = GetTestFrustum(false);
+
+    // The camera is at (-1, 2, -5) looking along +Z rotated around Y
+    const float4x4 InvView  = (float4x4::RotationY(0.3f) * float4x4::Translation(1.f, -2.f, 5.f)).Inverse();
+    const float3   InFront  = float3{0, 0, 10} * InvView;
+    const float3   Behind   = float3{0, 0, -10} * InvView;
+    const float3   OnBorder = float3{0, 0, 100} * InvView;
+
+    const float MinX[] = {InFront.x - 1, Behind.x - 1, OnBorder.x - 1};
+    const float MinY[] = {InFront.y - 1, Behind.y - 1, OnBorder.y - 1};
+    const float MinZ[] = {InFront.z - 1, Behind.z - 1, OnBorder.z - 1};
+    const float MaxX[] = {InFront.x + 1, Behind.x + 1, OnBorder.x + 1};
+    const float MaxY[] = {InFront.y + 1, Behind.y + 1, OnBorder.y + 1};
+    const float MaxZ[] = {InFront.z + 1, Behind.z + 1, OnBorder.z + 1};
+
+    BoundBoxArrays Boxes;
+    Boxes.pMinOrCenter[0]     = MinX;
+    Boxes.pMinOrCenter[1]     = MinY;
+    Boxes.pMinOrCenter[2]     = MinZ;
+    Boxes.pMaxOrHalfExtent[0] = MaxX;
+    Boxes.pMaxOrHalfExtent[1] = MaxY;
+    Boxes.pMaxOrHalfExtent[2] = MaxZ;
+    Boxes.Count               = _countof(MinX);
+
+    BoxVisibility Visibility[3] = {};
+    GetBoxVisibility(Frustum, Boxes, Visibility);
+    EXPECT_EQ(Visibility[0], BoxVisibility::FullyVisible);
+    EXPECT_EQ(Visibility[1], BoxVisibility::Invisible);
+    EXPECT_EQ(Visibility[2], BoxVisibility::Intersecting);
+
+    Uint32 Indices[3] = {};
+    ASSERT_EQ(GetVisibleBoxes(Frustum, Boxes, Indices), 2u);
+    EXPECT_EQ(Indices[0], 0u);
+    EXPECT_EQ(Indices[1], 2u);
+}
+
+} // namespace
@@ -30,6 +30,7 @@
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -3272,6 +3273,69 @@ TEST(Common_AdvancedMath, TriangulatePolygon2D)
     }
 }
 
+template <typename ComponentType>
+std::vector<Vector2<ComponentType>> GenerateStarPolygon(size_t NumVerts, FastRandFloat& Rnd, float Scale)
+{
+    // Vertices sorted by the angle around the origin form a simple polygon
+    std::vector<Vector2<ComponentType>> Polygon(NumVerts);
+    for (size_t i = 0; i < NumVerts; ++i)
+    {
+        const float Angle  = (static_cast<float>(i) + Rnd() * 0.5f) / static_cast<float>(NumVerts) * 2.f * PI_F;
+        const float Radius = (0.25f + Rnd()) * Scale;
+        Polygon[i]         = Vector2<ComponentType>{
+            static_cast<ComponentType>(std::cos(Angle) * Radius),
+            static_cast<ComponentType>(std::sin(Angle) * Radius),
+        };
+    }
+    return Polygon;
+}
+
+template <typename ComponentType>
+void TestTriangulatePolygon2DModes(size_t NumVerts, FastRandFloat& Rnd, float Scale)
+{
+    Polygon2DTriangulator<Uint32> Triangulator;
+    Polygon2DTriangulator<Uint32> SpatialHashTriangulator{TRIANGULATE_POLYGON_MODE_SPATIAL_HASH};
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        std::vector<Vector2<ComponentType>> Polygon = GenerateStarPolygon<ComponentType>(NumVerts, Rnd, Scale);
+        if (i % 2 == 1)
+            std::reverse(Polygon.begin(), Polygon.end());
+
+        const std::vector<Uint32> RefTris = Triangulator.Triangulate(Polygon);
+        const std::vector<Uint32> Tris    = SpatialHashTriangulator.Triangulate(Polygon);
+        EXPECT_EQ(Tris, RefTris) << NumVerts << " vertices";
+        EXPECT_EQ(Tris.size(), (NumVerts - 2) * 3);
+        // Invalid ear flags may be set due to floating point imprecision with almost collinear vertices
+        EXPECT_EQ(SpatialHashTriangulator.GetResult() & ~TRIANGULATE_POLYGON_RESULT_INVALID_EAR, TRIANGULATE_POLYGON_RESULT_OK);
+    }
+}
+
+TEST(Common_AdvancedMath, TriangulatePolygon2DSpatialHash)
+{
+    FastRandFloat Rnd{0, 0.f, 1.f};
+    for (size_t NumVerts : {4, 5, 7, 16, 100, 1000, 2000})
+    {
+        TestTriangulatePolygon2DModes<float>(NumVerts, Rnd, 1.f);
+        TestTriangulatePolygon2DModes<double>(NumVerts, Rnd, 100.f);
+        TestTriangulatePolygon2DModes<int>(NumVerts, Rnd, 10000.f);
+    }
+
+    {
+        // All vertices on a horizontal line except one
+        const std::vector<float2> Verts = {{0, 0}, {1, 0}, {2, 0}, {3, 0}, {1.5, 1}};
+
+        Polygon2DTriangulator<Uint32> Triangulator;
+        Polygon2DTriangulator<Uint32> SpatialHashTriangulator{TRIANGULATE_POLYGON_MODE_SPATIAL_HASH};
+
+        const std::vector<Uint32> RefTris = {4, 0, 1, 4, 1, 2, 2, 3, 4};
+        EXPECT_EQ(Triangulator.Triangulate(Verts), RefTris);
+        const auto Tris = SpatialHashTriangulator.Triangulate(Verts);
+        EXPECT_EQ(SpatialHashTriangulator.GetResult(), TRIANGULATE_POLYGON_RESULT_OK);
+        EXPECT_EQ(Tris, RefTris);
+    }
+}
+
 TEST(Common_AdvancedMath, TriangulatePolygon3D)
 {
     for (size_t proj = 0; proj < 3; ++proj)
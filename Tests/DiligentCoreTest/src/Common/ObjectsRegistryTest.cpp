@@ -70,9 +70,9 @@ struct RegistryDataObj : public ObjectBase<IObject>
 };
 
 template <template <typename T> class StrongPtrType, typename DataType>
-void TestObjectRegistryGet()
+void TestObjectRegistryGet(bool ReadOptimized)
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry;
+    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{1024, ReadOptimized};
 
     {
         int    Key    = 999;
@@ -123,19 +123,29 @@ void TestObjectRegistryGet()
 
 TEST(Common_ObjectsRegistry, Get_SharedPtr)
 {
-    TestObjectRegistryGet<std::shared_ptr, RegistryData>();
+    TestObjectRegistryGet<std::shared_ptr, RegistryData>(false);
+}
+
+TEST(Common_ObjectsRegistry, Get_SharedPtr_ReadOptimized)
+{
+    TestObjectRegistryGet<std::shared_ptr, RegistryData>(true);
 }
 
 TEST(Common_ObjectsRegistry, Get_RefCntAutoPtr)
 {
-    TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj>(false);
+}
+
+TEST(Common_ObjectsRegistry, Get_RefCntAutoPtr_ReadOptimized)
+{
+    TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj>(true);
 }
 
 
 template <template <typename T> class StrongPtrType, typename DataType>
-void TestObjectRegistryCreateDestroyRace()
+void TestObjectRegistryCreateDestroyRace(bool ReadOptimized)
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{64};
+    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{64, ReadOptimized};
 
     constexpr Uint32         NumThreads = 16;
     std::vector<std::thread> Threads(NumThreads);
@@ -160,19 +170,29 @@ void TestObjectRegistryCreateDestroyRace()
 
 TEST(Common_ObjectsRegistry, CreateDestroyRace_SharedPtr)
 {
-    TestObjectRegistryCreateDestroyRace<std::shared_ptr, RegistryData>();
+    TestObjectRegistryCreateDestroyRace<std::shared_ptr, RegistryData>(false);
+}
+
+TEST(Common_ObjectsRegistry, CreateDestroyRace_SharedPtr_ReadOptimized)
+{
+    TestObjectRegistryCreateDestroyRace<std::shared_ptr, RegistryData>(true);
 }
 
 TEST(Common_ObjectsRegistry, CreateDestroyRace_RefCntAutoPtr)
 {
-    TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj>(false);
+}
+
+TEST(Common_ObjectsRegistry, CreateDestroyRace_RefCntAutoPtr_ReadOptimized)
+{
+    TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj>(true);
 }
 
 
 template <template <typename T> class StrongPtrType, typename DataType>
-void TestObjectRegistryExceptions()
+void TestObjectRegistryExceptions(bool ReadOptimized)
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{128};
+    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{128, ReadOptimized};
 
     constexpr Uint32         NumThreads = 15; // Use odd number
     std::vector<std::thread> Threads(NumThreads);
@@ -236,12 +256,98 @@ void TestObjectRegistryExceptions()
 
 TEST(Common_ObjectsRegistry, Exceptions_SharedPtr)
 {
-    TestObjectRegistryExceptions<std::shared_ptr, RegistryData>();
+    TestObjectRegistryExceptions<std::shared_ptr, RegistryData>(false);
+}
+
+TEST(Common_ObjectsRegistry, Exceptions_SharedPtr_ReadOptimized)
+{
+    TestObjectRegistryExceptions<std::shared_ptr, RegistryData>(true);
 }
 
 TEST(Common_ObjectsRegistry, Exceptions_RefCntAutoPtr)
 {
-    TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>(false);
+}
+
+TEST(Common_ObjectsRegistry, Exceptions_RefCntAutoPtr_ReadOptimized)
+{
+    TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>(true);
+}
+
+
+template <template <typename T> class StrongPtrType, typename DataType>
+void TestObjectRegistryConcurrentReadWrite()
+{
+    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{16, /*ReadOptimized = */ true};
+
+    constexpr int NumKeys = 64;
+
+    std::vector<StrongPtrType<DataType>> PersistentData(NumKeys / 2);
+    for (int i = 0; i < NumKeys / 2; ++i)
+        PersistentData[i] = Registry.Get(i, std::bind(DataType::Create, i));
+
+    constexpr Uint32         NumThreads = 8;
+    std::vector<std::thread> Threads(NumThreads);
+
+    Threading::Signal StartSignal;
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                StartSignal.Wait();
+                for (int iter = 0; iter < 2000; ++iter)
+                {
+                    const int Key = (iter * 7 + static_cast<int>(ThreadId)) % NumKeys;
+                    if (ThreadId % 2 == 0)
+                    {
+                        // Readers: persistent objects must always be found
+                        auto pData = Registry.Get(Key);
+                        if (Key < NumKeys / 2)
+                        {
+                            EXPECT_EQ(pData, PersistentData[Key]);
+                        }
+                        if (pData)
+                        {
+                            EXPECT_EQ(pData->Value, static_cast<Uint32>(Key));
+                        }
+                    }
+                    else
+                    {
+                        // Writers: create transient objects that expire immediately
+                        auto pData = Registry.Get(Key, std::bind(DataType::Create, Key));
+                        ASSERT_NE(pData, nullptr);
+                        EXPECT_EQ(pData->Value, static_cast<Uint32>(Key));
+                        if (iter % 128 == 0)
+                            Registry.Purge();
+                    }
+                }
+            },
+            i);
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    for (int i = 0; i < NumKeys / 2; ++i)
+        EXPECT_EQ(Registry.Get(i), PersistentData[i]);
+
+    Registry.Purge();
+    for (int i = NumKeys / 2; i < NumKeys; ++i)
+        EXPECT_EQ(Registry.Get(i), nullptr);
+
+    Registry.Clear();
+    EXPECT_EQ(Registry.Get(0), nullptr);
+}
+
+TEST(Common_ObjectsRegistry, ConcurrentReadWrite_SharedPtr)
+{
+    TestObjectRegistryConcurrentReadWrite<std::shared_ptr, RegistryData>();
+}
+
+TEST(Common_ObjectsRegistry, ConcurrentReadWrite_RefCntAutoPtr)
+{
+    TestObjectRegistryConcurrentReadWrite<RefCntAutoPtr, RegistryDataObj>();
 }
 
 } // namespace
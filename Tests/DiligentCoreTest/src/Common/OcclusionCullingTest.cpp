@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "OcclusionCulling.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 TestWidth  = 256;
+constexpr Uint32 TestHeight = 128;
+
+// Camera at the origin looking along +Z
+float4x4 GetTestViewProj(bool IsGL)
+{
+    return float4x4::Projection(PI_F / 2.f, static_cast<float>(TestWidth) / static_cast<float>(TestHeight), 1.f, 100.f, IsGL);
+}
+
+BoundBox MakeBox(const float3& Center, float HalfSize)
+{
+    return BoundBox{Center - float3{HalfSize, HalfSize, HalfSize}, Center + float3{HalfSize, HalfSize, HalfSize}};
+}
+
+// Wall at the given depth facing the camera
+struct Wall
+{
+    std::vector<float3> Verts;
+    std::vector<Uint32> Indices;
+
+    Wall(float Z, float HalfSize, bool Clockwise = true)
+    {
+        Verts = {
+            float3{-HalfSize, -HalfSize, Z}, // bottom left
+            float3{-HalfSize, +HalfSize, Z}, // top left
+            float3{+HalfSize, -HalfSize, Z}, // bottom right
+            float3{+HalfSize, +HalfSize, Z}, // top right
+        };
+        Indices = Clockwise ?
+            std::vector<Uint32>{0, 1, 2, 1, 3, 2} :
+            std::vector<Uint32>{0, 2, 1, 1, 2, 3};
+    }
+
+    OccluderMesh GetMesh(const float4x4& ViewProj) const
+    {
+        OccluderMesh Mesh;
+        Mesh.pVertices     = Verts.data();
+        Mesh.NumVertices   = static_cast<Uint32>(Verts.size());
+        Mesh.pIndices      = Indices.data();
+        Mesh.NumIndices    = static_cast<Uint32>(Indices.size());
+        Mesh.WorldViewProj = ViewProj;
+        return Mesh;
+    }
+};
+
+TEST(Common_OcclusionCulling, Wall)
+{
+    const float4x4 ViewProj = GetTestViewProj(false);
+
+    SoftwareOcclusionCuller Culler{{TestWidth, TestHeight, false}};
+
+    const Wall         WallMesh{10, 5};
+    const OccluderMesh Mesh = WallMesh.GetMesh(ViewProj);
+    Culler.RasterizeOccluders(&Mesh, 1);
+
+    // The wall covers the center of the screen, but not the corners
+    EXPECT_LT(Culler.GetDepth(TestWidth / 2, TestHeight / 2), 1.f);
+    EXPECT_EQ(Culler.GetDepth(0, 0), 1.f);
+    EXPECT_EQ(Culler.GetDepth(TestWidth - 1, TestHeight - 1), 1.f);
+
+    // Behind the wall
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 0, 20}, 1)));
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, MakeBox({7, 0, 20}, 1)));
+    // In front of the wall
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 0, 5}, 1)));
+    // Partially behind the wall
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({10, 0, 20}, 1)));
+    // Not behind the wall
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({30, 0, 20}, 1)));
+    // Intersects the wall
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 0, 10}, 1)));
+    // Intersects the near plane
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 0, 1}, 1)));
+    // Outside of the screen
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, MakeBox({100, 0, 20}, 1)));
+
+    Culler.Clear();
+    EXPECT_EQ(Culler.GetDepth(TestWidth / 2, TestHeight / 2), 1.f);
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 0, 20}, 1)));
+}
+
+TEST(Common_OcclusionCulling, BackFaceCulling)
+{
+    const float4x4 ViewProj = GetTestViewProj(false);
+    const BoundBox Box      = MakeBox({0, 0, 20}, 1);
+
+    const Wall WallMesh{10, 5, /*Clockwise = */ false};
+
+    SoftwareOcclusionCuller Culler{{TestWidth, TestHeight, false}};
+
+    OccluderMesh Mesh = WallMesh.GetMesh(ViewProj);
+    Culler.RasterizeOccluders(&Mesh, 1);
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, Box));
+
+    Mesh.CullBackFaces = false;
+    Culler.RasterizeOccluders(&Mesh, 1);
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, Box));
+}
+
+TEST(Common_OcclusionCulling, NearPlaneClipping)
+{
+    for (bool IsGL : {false, true})
+    {
+        const float4x4 ViewProj = GetTestViewProj(IsGL);
+
+        // The ground extends behind the camera and must be clipped by the near plane
+        const std::vector<float3> Verts = {
+            float3{-100, -1, -10},
+            float3{-100, -1, +100},
+            float3{+100, -1, -10},
+            float3{+100, -1, +100},
+        };
+
+        OccluderMesh Mesh;
+        Mesh.pVertices     = Verts.data();
+        Mesh.NumVertices   = 3;
+        Mesh.WorldViewProj = ViewProj;
+
+        SoftwareOcclusionCuller Culler{{TestWidth, TestHeight, IsGL}};
+
+        // Non-indexed triangles
+        const float3 Triangles[] = {Verts[0], Verts[1], Verts[2], Verts[1], Verts[3], Verts[2]};
+        Mesh.pVertices           = Triangles;
+        Mesh.NumVertices         = _countof(Triangles);
+        Culler.RasterizeOccluders(&Mesh, 1);
+
+        EXPECT_LT(Culler.GetDepth(TestWidth / 2, TestHeight - 1), 1.f);
+        EXPECT_EQ(Culler.GetDepth(TestWidth / 2, 0), 1.f);
+
+        // Under the ground
+        EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, MakeBox({0, -5, 20}, 1))) << "IsGL=" << IsGL;
+        EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, MakeBox({-10, -5, 40}, 1))) << "IsGL=" << IsGL;
+        // Above the ground
+        EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, MakeBox({0, 1, 20}, 1))) << "IsGL=" << IsGL;
+    }
+}
+
+TEST(Common_OcclusionCulling, HugeProjectedCoordinates)
+{
+    const float4x4 ViewProj = GetTestViewProj(false);
+
+    SoftwareOcclusionCuller Culler{{TestWidth, TestHeight, false}};
+
+    // Boxes right in front of the near plane that extend far to the sides project
+    // to coordinates that do not fit into 32-bit integers.
+    const BoundBox WideBox{float3{-1e9f, -1e9f, 1.001f}, float3{1e9f, 1e9f, 2.f}};
+    const BoundBox LeftBox{float3{-1e9f, -1.f, 1.001f}, float3{-1e8f, 1.f, 2.f}};
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, WideBox));
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, LeftBox));
+
+    // Wall that covers the whole screen
+    const Wall         WallMesh{1.5f, 100};
+    const OccluderMesh Mesh = WallMesh.GetMesh(ViewProj);
+    Culler.RasterizeOccluders(&Mesh, 1);
+
+    const BoundBox HiddenBox{float3{-1e9f, -1e9f, 10.f}, float3{1e9f, 1e9f, 11.f}};
+    EXPECT_FALSE(Culler.IsBoxVisible(ViewProj, HiddenBox));
+    EXPECT_TRUE(Culler.IsBoxVisible(ViewProj, WideBox));
+}
+
+TEST(Common_OcclusionCulling, Parallel)
+{
+    const float4x4 ViewProj = GetTestViewProj(false);
+
+    FastRandFloat Pos{0, -20.f, +20.f};
+    FastRandFloat Dist{1, 5.f, 60.f};
+    FastRandFloat Size{2, 0.5f, 4.f};
+
+    std::vector<Wall> Walls;
+    for (int i = 0; i < 64; ++i)
+        Walls.emplace_back(Dist(), Size());
+
+    std::vector<OccluderMesh> Meshes;
+    for (const Wall& WallMesh : Walls)
+    {
+        OccluderMesh Mesh  = WallMesh.GetMesh(float4x4::Translation(Pos(), Pos() * 0.5f, 0) * ViewProj);
+        Mesh.CullBackFaces = (Meshes.size() % 2) == 0;
+        Meshes.push_back(Mesh);
+    }
+
+    std::vector<BoundBox> Boxes(5000);
+    for (BoundBox& Box : Boxes)
+        Box = MakeBox({Pos() * 2.f, Pos(), Dist() * 1.5f}, Size() * 0.5f);
+
+    SoftwareOcclusionCuller Culler{{TestWidth, TestHeight, false}};
+    Culler.RasterizeOccluders(Meshes.data(), Meshes.size());
+
+    std::vector<Uint32> RefIndices(Boxes.size());
+    RefIndices.resize(Culler.GetVisibleBoxes(ViewProj, Boxes.data(), Boxes.size(), RefIndices.data()));
+    EXPECT_GT(RefIndices.size(), size_t{0});
+    EXPECT_LT(RefIndices.size(), Boxes.size());
+
+    size_t NumVisible = 0;
+    for (size_t i = 0; i < Boxes.size(); ++i)
+    {
+        if (Culler.IsBoxVisible(ViewProj, Boxes[i]))
+        {
+            ASSERT_LT(NumVisible, RefIndices.size());
+            EXPECT_EQ(RefIndices[NumVisible++], i);
+        }
+    }
+    EXPECT_EQ(NumVisible, RefIndices.size());
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+
+    SoftwareOcclusionCuller ParallelCuller{{TestWidth, TestHeight, false}};
+    ParallelCuller.RasterizeOccluders(Meshes.data(), Meshes.size(), pThreadPool);
+    for (Uint32 y = 0; y < TestHeight; ++y)
+    {
+        for (Uint32 x = 0; x < TestWidth; ++x)
+        {
+            ASSERT_EQ(ParallelCuller.GetDepth(x, y), Culler.GetDepth(x, y)) << "x=" << x << " y=" << y;
+        }
+    }
+
+    std::vector<Uint32> Indices(Boxes.size());
+    Indices.resize(ParallelCuller.GetVisibleBoxes(ViewProj, Boxes.data(), Boxes.size(), Indices.data(), pThreadPool));
+    EXPECT_EQ(Indices, RefIndices);
+}
+
+} // namespace
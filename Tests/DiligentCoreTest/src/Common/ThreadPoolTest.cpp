@@ -442,4 +442,168 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ParallelFor)
+{
+    constexpr size_t NumItems = 1000;
+
+    for (Uint32 NumThreads : {0u, 4u})
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        if (NumThreads > 0)
+        {
+            pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+            ASSERT_NE(pThreadPool, nullptr);
+        }
+
+        std::vector<std::atomic<int>> Counters(NumItems);
+        for (std::atomic<int>& Counter : Counters)
+            Counter = 0;
+
+        ParallelFor(pThreadPool, NumItems, 8,
+                    [&Counters](size_t Item) {
+                        Counters[Item].fetch_add(1);
+                    });
+        // All items must be processed when the function returns
+        for (size_t i = 0; i < NumItems; ++i)
+            EXPECT_EQ(Counters[i], 1) << i;
+    }
+}
+
+CPUTopology CreateTestTopology(Uint32 NumNodes, Uint32 DomainsPerNode, Uint32 CoresPerDomain, Uint32 ThreadsPerCore)
+{
+    CPUTopology Topology;
+    Topology.NumNUMANodes = NumNodes;
+    Topology.NumL3Domains = NumNodes * DomainsPerNode;
+    Topology.NumCores     = Topology.NumL3Domains * CoresPerDomain;
+    // SMT siblings of core N are processors N, N + NumCores, etc.
+    for (Uint32 Thread = 0; Thread < ThreadsPerCore; ++Thread)
+    {
+        for (Uint32 Core = 0; Core < Topology.NumCores; ++Core)
+        {
+            CPUTopology::Processor Proc;
+            Proc.Id         = Thread * Topology.NumCores + Core;
+            Proc.CoreId     = Core;
+            Proc.L3DomainId = Core / CoresPerDomain;
+            Proc.NUMANodeId = Proc.L3DomainId / DomainsPerNode;
+            Topology.Processors.push_back(Proc);
+        }
+    }
+    return Topology;
+}
+
+TEST(Common_ThreadPool, GetWorkerThreadAffinity)
+{
+    // 2 NUMA nodes x 2 L3 domains x 4 cores x 2 SMT threads = 32 processors
+    const CPUTopology Topology = CreateTestTopology(2, 2, 4, 2);
+
+    const auto GetCoreSiblings = [&Topology](Uint32 Core) {
+        ProcessorSet Siblings;
+        Siblings.Set(Core);
+        Siblings.Set(Core + Topology.NumCores);
+        return Siblings;
+    };
+
+    {
+        const std::vector<ProcessorSet> Affinity = GetWorkerThreadAffinity(Topology, THREAD_POOL_PLACEMENT_NONE, 0, 4);
+        ASSERT_EQ(Affinity.size(), 4u);
+        for (const ProcessorSet& Set : Affinity)
+            EXPECT_TRUE(Set.IsEmpty());
+    }
+
+    {
+        // Threads are spread across L3 domains first
+        const std::vector<ProcessorSet> Affinity = GetWorkerThreadAffinity(Topology, THREAD_POOL_PLACEMENT_PHYSICAL_CORES, 0, 20);
+        ASSERT_EQ(Affinity.size(), 20u);
+        const Uint32 ExpectedCores[] = {0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15};
+        for (size_t i = 0; i < Affinity.size(); ++i)
+            EXPECT_EQ(Affinity[i], GetCoreSiblings(ExpectedCores[i % 16])) << i;
+    }
+
+    {
+        // Cores of one L3 domain are filled first
+        const std::vector<ProcessorSet> Affinity = GetWorkerThreadAffinity(Topology, THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN, 0, 6);
+        ASSERT_EQ(Affinity.size(), 6u);
+        for (Uint32 i = 0; i < 6; ++i)
+            EXPECT_EQ(Affinity[i], GetCoreSiblings(i)) << i;
+    }
+
+    {
+        ProcessorSet Node1Processors;
+        for (Uint32 Core = 8; Core < 16; ++Core)
+            Node1Processors |= GetCoreSiblings(Core);
+
+        const std::vector<ProcessorSet> Affinity = GetWorkerThreadAffinity(Topology, THREAD_POOL_PLACEMENT_NUMA_LOCAL, 1, 3);
+        ASSERT_EQ(Affinity.size(), 3u);
+        for (const ProcessorSet& Set : Affinity)
+            EXPECT_EQ(Set, Node1Processors);
+    }
+}
+
+TEST(Common_ThreadPool, GetWorkerThreadAffinityLargeSystem)
+{
+    // 2 NUMA nodes x 6 L3 domains x 8 cores x 2 SMT threads = 192 processors
+    const CPUTopology Topology = CreateTestTopology(2, 6, 8, 2);
+
+    const std::vector<ProcessorSet> Affinity = GetWorkerThreadAffinity(Topology, THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN, 0, Topology.NumCores);
+    ASSERT_EQ(Affinity.size(), size_t{Topology.NumCores});
+
+    // Every core is used exactly once
+    ProcessorSet AllProcessors;
+    for (size_t i = 0; i < Affinity.size(); ++i)
+    {
+        EXPECT_EQ(Affinity[i].Count(), 2u) << i;
+        EXPECT_TRUE(Affinity[i].IsSet(static_cast<Uint32>(i + Topology.NumCores))) << i;
+        AllProcessors |= Affinity[i];
+    }
+    EXPECT_EQ(AllProcessors.Count(), Topology.Processors.size());
+    EXPECT_TRUE(AllProcessors.IsSet(191));
+}
+
+TEST(Common_ThreadPool, Placement)
+{
+    constexpr Uint32 NumThreads  = 4;
+    constexpr size_t ScratchSize = 64 << 10;
+
+    for (THREAD_POOL_PLACEMENT Placement : {THREAD_POOL_PLACEMENT_NONE,
+                                            THREAD_POOL_PLACEMENT_PHYSICAL_CORES,
+                                            THREAD_POOL_PLACEMENT_FILL_L3_DOMAIN,
+                                            THREAD_POOL_PLACEMENT_NUMA_LOCAL})
+    {
+        ThreadPoolCreateInfo PoolCI;
+        PoolCI.NumThreads        = NumThreads;
+        PoolCI.Placement         = Placement;
+        PoolCI.ThreadScratchSize = ScratchSize;
+
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+        EXPECT_EQ(pThreadPool->GetThreadScratchMemory(NumThreads), nullptr);
+
+        constexpr size_t    NumTasks = 32;
+        std::atomic<size_t> NumCompletedTasks{0};
+        std::vector<Uint8>  ScratchValid(NumTasks);
+        for (size_t i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&, i](Uint32 ThreadId) {
+                                 size_t Size     = 0;
+                                 Uint8* pScratch = static_cast<Uint8*>(pThreadPool->GetThreadScratchMemory(ThreadId, &Size));
+                                 if (pScratch != nullptr && Size == ScratchSize)
+                                 {
+                                     // The scratch memory must be writable by the worker thread
+                                     pScratch[0]        = static_cast<Uint8>(i);
+                                     pScratch[Size - 1] = static_cast<Uint8>(i);
+                                     ScratchValid[i]    = pScratch[0] == pScratch[Size - 1];
+                                 }
+                                 NumCompletedTasks.fetch_add(1);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+
+        EXPECT_EQ(NumCompletedTasks, NumTasks) << Placement;
+        for (size_t i = 0; i < NumTasks; ++i)
+            EXPECT_TRUE(ScratchValid[i]) << "Placement: " << Placement << ", task: " << i;
+    }
+}
+
 } // namespace
@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+
+#include "SRBMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr size_t ShaderVariableDataSizes[] = {64, 256};
+constexpr size_t ResourceCacheDataSizes[]  = {512};
+
+void InitializeTestAllocator(SRBMemoryAllocator& Allocator, Uint32 Granularity)
+{
+    Allocator.Initialize(Granularity,
+                         _countof(ShaderVariableDataSizes), ShaderVariableDataSizes,
+                         _countof(ResourceCacheDataSizes), ResourceCacheDataSizes);
+}
+
+TEST(GraphicsAccessories_SRBMemoryAllocator, AllocDealloc)
+{
+    SRBMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+    InitializeTestAllocator(Allocator, 16);
+
+    constexpr size_t NumSRBs = 100;
+
+    std::vector<void*> VarData0, VarData1, CacheData;
+    for (size_t i = 0; i < NumSRBs; ++i)
+    {
+        VarData0.push_back(Allocator.GetShaderVariableDataAllocator(0).Allocate(ShaderVariableDataSizes[0], "Test", __FILE__, __LINE__));
+        VarData1.push_back(Allocator.GetShaderVariableDataAllocator(1).Allocate(ShaderVariableDataSizes[1], "Test", __FILE__, __LINE__));
+        CacheData.push_back(Allocator.GetResourceCacheDataAllocator(0).Allocate(ResourceCacheDataSizes[0], "Test", __FILE__, __LINE__));
+        // Make sure the memory is writable
+        memset(VarData0.back(), 0xAB, ShaderVariableDataSizes[0]);
+        memset(VarData1.back(), 0xAB, ShaderVariableDataSizes[1]);
+        memset(CacheData.back(), 0xAB, ResourceCacheDataSizes[0]);
+    }
+
+    // All blocks must be unique
+    for (auto* pBlocks : {&VarData0, &VarData1, &CacheData})
+    {
+        auto Sorted = *pBlocks;
+        std::sort(Sorted.begin(), Sorted.end());
+        EXPECT_EQ(std::unique(Sorted.begin(), Sorted.end()), Sorted.end());
+    }
+
+    {
+        const auto Stats = Allocator.GetStats();
+        EXPECT_EQ(Stats.NumAllocatedBlocks, NumSRBs * 3);
+        EXPECT_EQ(Stats.AllocatedSize, NumSRBs * (ShaderVariableDataSizes[0] + ShaderVariableDataSizes[1] + ResourceCacheDataSizes[0]));
+        EXPECT_GE(Stats.ReservedSize, Stats.AllocatedSize);
+        EXPECT_EQ(Stats.TotalAllocations, NumSRBs * 3);
+        EXPECT_GT(Stats.NumSharedPoolAccesses, Uint64{0});
+        // Blocks are taken from the shared pool in batches
+        EXPECT_LT(Stats.NumSharedPoolAccesses, Stats.TotalAllocations);
+    }
+
+    for (size_t i = 0; i < NumSRBs; ++i)
+    {
+        Allocator.GetShaderVariableDataAllocator(0).Free(VarData0[i]);
+        Allocator.GetShaderVariableDataAllocator(1).Free(VarData1[i]);
+        Allocator.GetResourceCacheDataAllocator(0).Free(CacheData[i]);
+    }
+
+    {
+        const auto Stats = Allocator.GetStats();
+        EXPECT_EQ(Stats.NumAllocatedBlocks, Uint64{0});
+        EXPECT_EQ(Stats.AllocatedSize, Uint64{0});
+        EXPECT_EQ(Stats.TotalAllocations, NumSRBs * 3);
+    }
+}
+
+TEST(GraphicsAccessories_SRBMemoryAllocator, Uninitialized)
+{
+    SRBMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    // Uninitialized allocator falls back to the raw allocator
+    auto* pData = Allocator.GetShaderVariableDataAllocator(0).Allocate(64, "Test", __FILE__, __LINE__);
+    EXPECT_NE(pData, nullptr);
+    Allocator.GetShaderVariableDataAllocator(0).Free(pData);
+
+    const auto Stats = Allocator.GetStats();
+    EXPECT_EQ(Stats.NumAllocatedBlocks, Uint64{0});
+    EXPECT_EQ(Stats.ReservedSize, Uint64{0});
+    EXPECT_EQ(Stats.TotalAllocations, Uint64{0});
+}
+
+void CreateDestroySRBs(SRBMemoryAllocator& Allocator, size_t NumIterations, size_t NumLiveSRBs)
+{
+    struct SRBData
+    {
+        void* pVarData0  = nullptr;
+        void* pVarData1  = nullptr;
+        void* pCacheData = nullptr;
+    };
+    std::vector<SRBData> LiveSRBs(NumLiveSRBs);
+
+    for (size_t i = 0; i < NumIterations; ++i)
+    {
+        auto& SRB = LiveSRBs[i % NumLiveSRBs];
+        if (SRB.pVarData0 != nullptr)
+        {
+            Allocator.GetShaderVariableDataAllocator(0).Free(SRB.pVarData0);
+            Allocator.GetShaderVariableDataAllocator(1).Free(SRB.pVarData1);
+            Allocator.GetResourceCacheDataAllocator(0).Free(SRB.pCacheData);
+        }
+        SRB.pVarData0  = Allocator.GetShaderVariableDataAllocator(0).Allocate(ShaderVariableDataSizes[0], "Test", __FILE__, __LINE__);
+        SRB.pVarData1  = Allocator.GetShaderVariableDataAllocator(1).Allocate(ShaderVariableDataSizes[1], "Test", __FILE__, __LINE__);
+        SRB.pCacheData = Allocator.GetResourceCacheDataAllocator(0).Allocate(ResourceCacheDataSizes[0], "Test", __FILE__, __LINE__);
+        *reinterpret_cast<size_t*>(SRB.pVarData0)  = i;
+        *reinterpret_cast<size_t*>(SRB.pVarData1)  = i;
+        *reinterpret_cast<size_t*>(SRB.pCacheData) = i;
+    }
+
+    for (auto& SRB : LiveSRBs)
+    {
+        if (SRB.pVarData0 != nullptr)
+        {
+            Allocator.GetShaderVariableDataAllocator(0).Free(SRB.pVarData0);
+            Allocator.GetShaderVariableDataAllocator(1).Free(SRB.pVarData1);
+            Allocator.GetResourceCacheDataAllocator(0).Free(SRB.pCacheData);
+        }
+    }
+}
+
+TEST(GraphicsAccessories_SRBMemoryAllocator, Multithreaded)
+{
+    SRBMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+    InitializeTestAllocator(Allocator, 16);
+
+    const size_t NumThreads = std::max(std::thread::hardware_concurrency(), 4u);
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Allocator]() {
+            CreateDestroySRBs(Allocator, 4096, 64);
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    const auto Stats = Allocator.GetStats();
+    EXPECT_EQ(Stats.NumAllocatedBlocks, Uint64{0});
+    EXPECT_EQ(Stats.TotalAllocations, NumThreads * 4096 * 3);
+}
+
+TEST(GraphicsAccessories_SRBMemoryAllocator, CrossThreadFree)
+{
+    SRBMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+    InitializeTestAllocator(Allocator, 8);
+
+    constexpr size_t NumThreads = 4;
+    constexpr size_t NumBlocks  = 1024;
+
+    // Every thread allocates blocks that are released by the next thread
+    std::vector<std::vector<void*>> Blocks(NumThreads);
+    std::atomic<size_t>             NumAllocated{0};
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            auto& VarDataAllocator = Allocator.GetShaderVariableDataAllocator(0);
+            for (size_t i = 0; i < NumBlocks; ++i)
+                Blocks[t].push_back(VarDataAllocator.Allocate(ShaderVariableDataSizes[0], "Test", __FILE__, __LINE__));
+
+            NumAllocated.fetch_add(1);
+            while (NumAllocated.load() < NumThreads)
+                std::this_thread::yield();
+
+            for (auto* pBlock : Blocks[(t + 1) % NumThreads])
+                VarDataAllocator.Free(pBlock);
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    const auto Stats = Allocator.GetStats();
+    EXPECT_EQ(Stats.NumAllocatedBlocks, Uint64{0});
+    EXPECT_EQ(Stats.TotalAllocations, NumThreads * NumBlocks);
+}
+
+} // namespace
@@ -0,0 +1,488 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureCompression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Smooth gradients with a few sharp edges, similar to generated splat maps and decals
+std::vector<Uint8> GenerateImage(Uint32 Width, Uint32 Height, Uint32 NumChannels, bool IsSigned = false)
+{
+    std::vector<Uint8> Data(size_t{Width} * Height * NumChannels);
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float u = static_cast<float>(x) / static_cast<float>(Width);
+            const float v = static_cast<float>(y) / static_cast<float>(Height);
+
+            const float Values[4] = {
+                0.5f + 0.5f * std::sin(u * 9.f + v * 3.f),
+                0.5f + 0.5f * std::cos(v * 7.f - u * 2.f),
+                (u * u + v) * 0.5f,
+                (x / 16 + y / 16) % 3 == 0 ? 0.f : 0.5f + 0.5f * std::sin(u * v * 20.f),
+            };
+            for (Uint32 c = 0; c < NumChannels; ++c)
+            {
+                Uint8& Dst = Data[(size_t{y} * Width + x) * NumChannels + c];
+                if (IsSigned)
+                    Dst = static_cast<Uint8>(static_cast<Int8>(std::lrint(Values[c] * 254.f - 127.f)));
+                else
+                    Dst = static_cast<Uint8>(std::lrint(Values[c] * 255.f));
+            }
+        }
+    }
+    return Data;
+}
+
+// Reference decoders ---------------------------------------------------------
+
+void UnpackRGB565(Uint32 Color, int RGB[3])
+{
+    const Uint32 R = (Color >> 11) & 0x1F;
+    const Uint32 G = (Color >> 5) & 0x3F;
+    const Uint32 B = Color & 0x1F;
+    RGB[0]         = static_cast<int>((R << 3) | (R >> 2));
+    RGB[1]         = static_cast<int>((G << 2) | (G >> 4));
+    RGB[2]         = static_cast<int>((B << 3) | (B >> 2));
+}
+
+void DecodeBC1Block(const Uint8* pBlock, bool IsBC1, Uint8 Pixels[16][4])
+{
+    Uint16 Color0, Color1;
+    Uint32 Indices;
+    std::memcpy(&Color0, pBlock, 2);
+    std::memcpy(&Color1, pBlock + 2, 2);
+    std::memcpy(&Indices, pBlock + 4, 4);
+
+    int Palette[4][4] = {};
+    UnpackRGB565(Color0, Palette[0]);
+    UnpackRGB565(Color1, Palette[1]);
+    Palette[0][3] = Palette[1][3] = Palette[2][3] = Palette[3][3] = 255;
+    const bool FourColors = Color0 > Color1 || !IsBC1;
+    for (int c = 0; c < 3; ++c)
+    {
+        if (FourColors)
+        {
+            Palette[2][c] = (2 * Palette[0][c] + Palette[1][c] + 1) / 3;
+            Palette[3][c] = (Palette[0][c] + 2 * Palette[1][c] + 1) / 3;
+        }
+        else
+        {
+            Palette[2][c] = (Palette[0][c] + Palette[1][c] + 1) / 2;
+            Palette[3][c] = 0;
+        }
+    }
+    if (!FourColors)
+        Palette[3][3] = 0;
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        for (int c = 0; c < 4; ++c)
+            Pixels[i][c] = static_cast<Uint8>(Palette[(Indices >> (i * 2)) & 3][c]);
+    }
+}
+
+void DecodeBC4Block(const Uint8* pBlock, bool IsSigned, Uint8 Pixels[16][4], int Channel)
+{
+    Uint64 Bits;
+    std::memcpy(&Bits, pBlock, 8);
+
+    const int E0 = IsSigned ? std::max(static_cast<int>(static_cast<Int8>(pBlock[0])), -127) : pBlock[0];
+    const int E1 = IsSigned ? std::max(static_cast<int>(static_cast<Int8>(pBlock[1])), -127) : pBlock[1];
+
+    float Palette[8] = {static_cast<float>(E0), static_cast<float>(E1)};
+    if (E0 > E1)
+    {
+        for (int i = 1; i < 7; ++i)
+            Palette[i + 1] = static_cast<float>((7 - i) * E0 + i * E1) / 7.f;
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+            Palette[i + 1] = static_cast<float>((5 - i) * E0 + i * E1) / 5.f;
+        Palette[6] = IsSigned ? -127.f : 0.f;
+        Palette[7] = IsSigned ? 127.f : 255.f;
+    }
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const long Val = std::lrint(Palette[(Bits >> (16 + i * 3)) & 7]);
+        Pixels[i][Channel] = static_cast<Uint8>(IsSigned ? static_cast<Uint8>(static_cast<Int8>(Val)) : static_cast<Uint8>(Val));
+    }
+}
+
+void DecodeBC2AlphaBlock(const Uint8* pBlock, Uint8 Pixels[16][4])
+{
+    Uint64 Bits;
+    std::memcpy(&Bits, pBlock, 8);
+    for (Uint32 i = 0; i < 16; ++i)
+        Pixels[i][3] = static_cast<Uint8>(((Bits >> (i * 4)) & 0xF) * 17);
+}
+
+Uint32 ReadBits(const Uint8* pBlock, Uint32& Pos, Uint32 NumBits)
+{
+    Uint32 Val = 0;
+    for (Uint32 i = 0; i < NumBits; ++i, ++Pos)
+        Val |= ((pBlock[Pos / 8] >> (Pos % 8)) & 1u) << i;
+    return Val;
+}
+
+void DecodeBC7Block(const Uint8* pBlock, Uint8 Pixels[16][4])
+{
+    static constexpr Uint32 Weights2[] = {0, 21, 43, 64};
+    static constexpr Uint32 Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    Uint32 Pos = 0;
+    if (ReadBits(pBlock, Pos, 7) == 1u << 6)
+    {
+        // Mode 6
+        Uint32 Endpoints[2][4];
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            Endpoints[0][c] = ReadBits(pBlock, Pos, 7);
+            Endpoints[1][c] = ReadBits(pBlock, Pos, 7);
+        }
+        const Uint32 P0 = ReadBits(pBlock, Pos, 1);
+        const Uint32 P1 = ReadBits(pBlock, Pos, 1);
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            Endpoints[0][c] = (Endpoints[0][c] << 1) | P0;
+            Endpoints[1][c] = (Endpoints[1][c] << 1) | P1;
+        }
+
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 w = Weights4[ReadBits(pBlock, Pos, i == 0 ? 3 : 4)];
+            for (Uint32 c = 0; c < 4; ++c)
+                Pixels[i][c] = static_cast<Uint8>(((64 - w) * Endpoints[0][c] + w * Endpoints[1][c] + 32) >> 6);
+        }
+    }
+    else
+    {
+        Pos = 0;
+        ASSERT_EQ(ReadBits(pBlock, Pos, 6), 1u << 5) << "Only modes 5 and 6 are expected";
+        ASSERT_EQ(ReadBits(pBlock, Pos, 2), 0u) << "Channel rotation is not expected";
+
+        Uint32 Endpoints[2][4];
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            for (Uint32 e = 0; e < 2; ++e)
+            {
+                Endpoints[e][c] = ReadBits(pBlock, Pos, 7);
+                Endpoints[e][c] = (Endpoints[e][c] << 1) | (Endpoints[e][c] >> 6);
+            }
+        }
+        Endpoints[0][3] = ReadBits(pBlock, Pos, 8);
+        Endpoints[1][3] = ReadBits(pBlock, Pos, 8);
+
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 w = Weights2[ReadBits(pBlock, Pos, i == 0 ? 1 : 2)];
+            for (Uint32 c = 0; c < 3; ++c)
+                Pixels[i][c] = static_cast<Uint8>(((64 - w) * Endpoints[0][c] + w * Endpoints[1][c] + 32) >> 6);
+        }
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const Uint32 w = Weights2[ReadBits(pBlock, Pos, i == 0 ? 1 : 2)];
+            Pixels[i][3]   = static_cast<Uint8>(((64 - w) * Endpoints[0][3] + w * Endpoints[1][3] + 32) >> 6);
+        }
+    }
+    EXPECT_EQ(Pos, 128u);
+}
+
+std::vector<Uint8> Decompress(TEXTURE_FORMAT Format, const std::vector<Uint8>& Blocks, Uint32 Width, Uint32 Height, Uint32 NumChannels)
+{
+    const Uint32 NumBlocksX = (Width + 3) / 4;
+    const Uint32 NumBlocksY = (Height + 3) / 4;
+    const Uint32 BlockSize  = GetTextureFormatAttribs(Format).ComponentSize;
+
+    std::vector<Uint8> Data(size_t{Width} * Height * NumChannels);
+    for (Uint32 by = 0; by < NumBlocksY; ++by)
+    {
+        for (Uint32 bx = 0; bx < NumBlocksX; ++bx)
+        {
+            const Uint8* pBlock = &Blocks[(size_t{by} * NumBlocksX + bx) * BlockSize];
+
+            Uint8 Pixels[16][4] = {};
+            switch (Format)
+            {
+                case TEX_FORMAT_BC1_UNORM: DecodeBC1Block(pBlock, true, Pixels); break;
+                case TEX_FORMAT_BC2_UNORM:
+                    DecodeBC1Block(pBlock + 8, false, Pixels);
+                    DecodeBC2AlphaBlock(pBlock, Pixels);
+                    break;
+                case TEX_FORMAT_BC3_UNORM:
+                    DecodeBC1Block(pBlock + 8, false, Pixels);
+                    DecodeBC4Block(pBlock, false, Pixels, 3);
+                    break;
+                case TEX_FORMAT_BC4_UNORM: DecodeBC4Block(pBlock, false, Pixels, 0); break;
+                case TEX_FORMAT_BC4_SNORM: DecodeBC4Block(pBlock, true, Pixels, 0); break;
+                case TEX_FORMAT_BC5_UNORM:
+                    DecodeBC4Block(pBlock, false, Pixels, 0);
+                    DecodeBC4Block(pBlock + 8, false, Pixels, 1);
+                    break;
+                case TEX_FORMAT_BC5_SNORM:
+                    DecodeBC4Block(pBlock, true, Pixels, 0);
+                    DecodeBC4Block(pBlock + 8, true, Pixels, 1);
+                    break;
+                case TEX_FORMAT_BC7_UNORM: DecodeBC7Block(pBlock, Pixels); break;
+                default:
+                    UNEXPECTED("Unexpected format");
+            }
+
+            for (Uint32 y = 0; y < 4 && by * 4 + y < Height; ++y)
+            {
+                for (Uint32 x = 0; x < 4 && bx * 4 + x < Width; ++x)
+                {
+                    for (Uint32 c = 0; c < NumChannels; ++c)
+                        Data[((size_t{by} * 4 + y) * Width + bx * 4 + x) * NumChannels + c] = Pixels[y * 4 + x][c];
+                }
+            }
+        }
+    }
+    return Data;
+}
+
+std::vector<Uint8> Compress(TEXTURE_FORMAT Format, const std::vector<Uint8>& Data, Uint32 Width, Uint32 Height, IThreadPool* pThreadPool = nullptr)
+{
+    const Uint32 BlockSize = GetTextureFormatAttribs(Format).ComponentSize;
+
+    std::vector<Uint8> Blocks(size_t{(Width + 3) / 4} * ((Height + 3) / 4) * BlockSize);
+
+    CompressTextureDataAttribs Attribs;
+    Attribs.Format      = Format;
+    Attribs.Width       = Width;
+    Attribs.Height      = Height;
+    Attribs.pSrcData    = Data.data();
+    Attribs.pDstData    = Blocks.data();
+    Attribs.pThreadPool = pThreadPool;
+    EXPECT_TRUE(CompressTextureData(Attribs));
+
+    return Blocks;
+}
+
+// Computes the PSNR of the given channel, or of all channels if Channel is -1
+double ComputePSNR(const std::vector<Uint8>& Ref, const std::vector<Uint8>& Data, Uint32 NumChannels, int Channel, bool IsSigned = false)
+{
+    double SqError  = 0;
+    size_t NumElems = 0;
+    for (size_t i = 0; i < Ref.size(); ++i)
+    {
+        if (Channel >= 0 && static_cast<int>(i % NumChannels) != Channel)
+            continue;
+
+        const double Diff = IsSigned ?
+            static_cast<double>(static_cast<Int8>(Ref[i])) - static_cast<double>(static_cast<Int8>(Data[i])) :
+            static_cast<double>(Ref[i]) - static_cast<double>(Data[i]);
+        SqError += Diff * Diff;
+        ++NumElems;
+    }
+    const double MSE = SqError / static_cast<double>(NumElems);
+    return MSE > 0 ? 10.0 * std::log10(255.0 * 255.0 / MSE) : 100.0;
+}
+
+constexpr Uint32 TestWidth  = 128;
+constexpr Uint32 TestHeight = 64;
+
+void TestCompression(TEXTURE_FORMAT Format, Uint32 NumChannels, double MinPSNR, bool IsSigned = false)
+{
+    const std::vector<Uint8> Data   = GenerateImage(TestWidth, TestHeight, NumChannels, IsSigned);
+    const std::vector<Uint8> Blocks = Compress(Format, Data, TestWidth, TestHeight);
+    const std::vector<Uint8> Res    = Decompress(Format, Blocks, TestWidth, TestHeight, NumChannels);
+
+    for (Uint32 c = 0; c < NumChannels; ++c)
+    {
+        const double PSNR = ComputePSNR(Data, Res, NumChannels, static_cast<int>(c), IsSigned);
+        EXPECT_GE(PSNR, MinPSNR) << GetTextureFormatAttribs(Format).Name << ", channel " << c;
+    }
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC1)
+{
+    // BC1 treats pixels with alpha below 128 as transparent, so use an opaque image
+    std::vector<Uint8> Data = GenerateImage(TestWidth, TestHeight, 4);
+    for (size_t i = 3; i < Data.size(); i += 4)
+        Data[i] = 255;
+
+    const std::vector<Uint8> Res = Decompress(TEX_FORMAT_BC1_UNORM, Compress(TEX_FORMAT_BC1_UNORM, Data, TestWidth, TestHeight), TestWidth, TestHeight, 4);
+    EXPECT_GE(ComputePSNR(Data, Res, 4, -1), 36.0);
+    for (size_t i = 3; i < Res.size(); i += 4)
+        ASSERT_EQ(Res[i], 255);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC1Transparency)
+{
+    const std::vector<Uint8> Data = GenerateImage(TestWidth, TestHeight, 4);
+    const std::vector<Uint8> Res  = Decompress(TEX_FORMAT_BC1_UNORM, Compress(TEX_FORMAT_BC1_UNORM, Data, TestWidth, TestHeight), TestWidth, TestHeight, 4);
+
+    std::vector<Uint8> OpaqueRef;
+    std::vector<Uint8> OpaqueRes;
+    for (size_t i = 0; i < Data.size(); i += 4)
+    {
+        const bool IsTransparent = Data[i + 3] < 128;
+        ASSERT_EQ(Res[i + 3], IsTransparent ? 0 : 255);
+        if (!IsTransparent)
+        {
+            OpaqueRef.insert(OpaqueRef.end(), &Data[i], &Data[i + 3]);
+            OpaqueRes.insert(OpaqueRes.end(), &Res[i], &Res[i + 3]);
+        }
+    }
+    EXPECT_GE(ComputePSNR(OpaqueRef, OpaqueRes, 3, -1), 33.0);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC2)
+{
+    TestCompression(TEX_FORMAT_BC2_UNORM, 4, 31.0);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC3)
+{
+    TestCompression(TEX_FORMAT_BC3_UNORM, 4, 31.0);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC4)
+{
+    TestCompression(TEX_FORMAT_BC4_UNORM, 1, 44.0);
+    TestCompression(TEX_FORMAT_BC4_SNORM, 1, 44.0, true);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC5)
+{
+    TestCompression(TEX_FORMAT_BC5_UNORM, 2, 43.0);
+    TestCompression(TEX_FORMAT_BC5_SNORM, 2, 43.0, true);
+}
+
+TEST(GraphicsAccessories_TextureCompression, BC7)
+{
+    TestCompression(TEX_FORMAT_BC7_UNORM, 4, 32.0);
+}
+
+TEST(GraphicsAccessories_TextureCompression, SolidColor)
+{
+    // Solid blocks must be encoded with at most the endpoint quantization error
+    const std::vector<Uint8> Data = {0, 255, 132, 255, 0, 255, 132, 255, 0, 255, 132, 255, 0, 255, 132, 255};
+    for (TEXTURE_FORMAT Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        const std::vector<Uint8> Res = Decompress(Format, Compress(Format, Data, 2, 2), 2, 2, 4);
+        for (size_t i = 0; i < Data.size(); ++i)
+            EXPECT_NEAR(Res[i], Data[i], 2) << GetTextureFormatAttribs(Format).Name << ", element " << i;
+    }
+
+    const std::vector<Uint8> R8Data(16, 77);
+    EXPECT_EQ(Decompress(TEX_FORMAT_BC4_UNORM, Compress(TEX_FORMAT_BC4_UNORM, R8Data, 4, 4), 4, 4, 1), R8Data);
+}
+
+TEST(GraphicsAccessories_TextureCompression, PartialBlocks)
+{
+    constexpr Uint32 Width  = 37;
+    constexpr Uint32 Height = 14;
+
+    const std::vector<Uint8> Data = GenerateImage(Width, Height, 4);
+    for (TEXTURE_FORMAT Format : {TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        const std::vector<Uint8> Res = Decompress(Format, Compress(Format, Data, Width, Height), Width, Height, 4);
+        EXPECT_GE(ComputePSNR(Data, Res, 4, -1), 24.0) << GetTextureFormatAttribs(Format).Name;
+    }
+}
+
+TEST(GraphicsAccessories_TextureCompression, DstStride)
+{
+    constexpr Uint32 Width     = 16;
+    constexpr Uint32 Height    = 8;
+    constexpr size_t DstStride = 4 * 8 + 8;
+
+    const std::vector<Uint8> Data = GenerateImage(Width, Height, 1);
+    const std::vector<Uint8> Ref  = Compress(TEX_FORMAT_BC4_UNORM, Data, Width, Height);
+
+    std::vector<Uint8> Blocks(DstStride * 2, 0xCD);
+
+    CompressTextureDataAttribs Attribs;
+    Attribs.Format    = TEX_FORMAT_BC4_UNORM;
+    Attribs.Width     = Width;
+    Attribs.Height    = Height;
+    Attribs.pSrcData  = Data.data();
+    Attribs.pDstData  = Blocks.data();
+    Attribs.DstStride = DstStride;
+    EXPECT_TRUE(CompressTextureData(Attribs));
+
+    for (size_t Row = 0; Row < 2; ++Row)
+    {
+        EXPECT_EQ(std::memcmp(&Blocks[Row * DstStride], &Ref[Row * 32], 32), 0);
+        for (size_t i = 32; i < DstStride; ++i)
+            EXPECT_EQ(Blocks[Row * DstStride + i], 0xCD);
+    }
+}
+
+TEST(GraphicsAccessories_TextureCompression, Parallel)
+{
+    constexpr Uint32 Width  = 512;
+    constexpr Uint32 Height = 256;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    const std::vector<Uint8> Data = GenerateImage(Width, Height, 4);
+    for (TEXTURE_FORMAT Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        const std::vector<Uint8> Ref = Compress(Format, Data, Width, Height);
+        const std::vector<Uint8> Res = Compress(Format, Data, Width, Height, pThreadPool);
+        EXPECT_EQ(Ref, Res) << GetTextureFormatAttribs(Format).Name;
+    }
+}
+
+TEST(GraphicsAccessories_TextureCompression, UnsupportedFormat)
+{
+    std::vector<Uint8> Data(64);
+
+    CompressTextureDataAttribs Attribs;
+    Attribs.Format   = TEX_FORMAT_BC6H_UF16;
+    Attribs.Width    = 4;
+    Attribs.Height   = 4;
+    Attribs.pSrcData = Data.data();
+    Attribs.pDstData = Data.data();
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Format TEX_FORMAT_BC6H_UF16 is not supported"};
+    EXPECT_FALSE(CompressTextureData(Attribs));
+}
+
+} // namespace
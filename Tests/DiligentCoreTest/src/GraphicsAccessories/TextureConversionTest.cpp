@@ -0,0 +1,437 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureConversion.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "ColorConversion.h"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+template <typename T>
+std::vector<T> GenerateRandomData(size_t Count, T MinVal, T MaxVal, unsigned int Seed = 0)
+{
+    std::mt19937 gen{Seed};
+
+    std::vector<T> Data(Count);
+    for (T& Val : Data)
+    {
+        Val = static_cast<T>(std::uniform_real_distribution<double>{static_cast<double>(MinVal), static_cast<double>(MaxVal)}(gen));
+    }
+    return Data;
+}
+
+std::vector<Uint8> GenerateRandomBytes(size_t Count, unsigned int Seed = 0)
+{
+    std::mt19937 gen{Seed};
+
+    std::vector<Uint8> Data(Count);
+    for (Uint8& Val : Data)
+        Val = static_cast<Uint8>(gen() & 0xFF);
+    return Data;
+}
+
+Uint8 RefFloatToUnorm8(float f)
+{
+    if (std::isnan(f))
+        return 0;
+    return static_cast<Uint8>(std::lrint(std::min(std::max(f, 0.f), 1.f) * 255.f));
+}
+
+template <typename DstType, typename SrcType>
+std::vector<DstType> Convert(TEXTURE_FORMAT SrcFormat,
+                             Uint32         SrcNumComponents,
+                             const SrcType* pSrcData,
+                             TEXTURE_FORMAT DstFormat,
+                             Uint32         DstNumComponents,
+                             Uint32         DstValuesPerPixel,
+                             Uint32         Width,
+                             Uint32         Height,
+                             IThreadPool*   pThreadPool = nullptr)
+{
+    std::vector<DstType> DstData(size_t{Width} * Height * DstValuesPerPixel);
+
+    ConvertTextureDataAttribs Attribs;
+    Attribs.SrcFormat        = SrcFormat;
+    Attribs.SrcNumComponents = SrcNumComponents;
+    Attribs.pSrcData         = pSrcData;
+    Attribs.DstFormat        = DstFormat;
+    Attribs.DstNumComponents = DstNumComponents;
+    Attribs.pDstData         = DstData.data();
+    Attribs.Width            = Width;
+    Attribs.Height           = Height;
+    Attribs.pThreadPool      = pThreadPool;
+    EXPECT_TRUE(ConvertTextureData(Attribs));
+
+    return DstData;
+}
+
+// Odd sizes make sure that the vectorized loops process row tails
+constexpr Uint32 TestWidth  = 61;
+constexpr Uint32 TestHeight = 7;
+constexpr size_t NumPixels  = size_t{TestWidth} * TestHeight;
+
+TEST(GraphicsAccessories_TextureConversion, HalfFloat)
+{
+    EXPECT_EQ(FloatToHalf(0.f), 0x0000);
+    EXPECT_EQ(FloatToHalf(-0.f), 0x8000);
+    EXPECT_EQ(FloatToHalf(1.f), 0x3C00);
+    EXPECT_EQ(FloatToHalf(-2.f), 0xC000);
+    EXPECT_EQ(FloatToHalf(65504.f), 0x7BFF);
+    EXPECT_EQ(FloatToHalf(65519.f), 0x7BFF);
+    EXPECT_EQ(FloatToHalf(65520.f), 0x7C00);
+    EXPECT_EQ(FloatToHalf(1e10f), 0x7C00);
+    EXPECT_EQ(FloatToHalf(-std::numeric_limits<float>::infinity()), 0xFC00);
+    EXPECT_EQ(FloatToHalf(std::ldexp(1.f, -24)), 0x0001);
+    EXPECT_EQ(FloatToHalf(std::ldexp(1.f, -26)), 0x0000);
+    EXPECT_EQ(FloatToHalf(std::ldexp(3.f, -26)), 0x0001);
+    // Ties are rounded to even
+    EXPECT_EQ(FloatToHalf(1.f + std::ldexp(1.f, -11)), 0x3C00);
+    EXPECT_EQ(FloatToHalf(1.f + std::ldexp(3.f, -11)), 0x3C02);
+    EXPECT_EQ(FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7C00, 0x7C00);
+    EXPECT_NE(FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x03FF, 0);
+
+    EXPECT_EQ(HalfToFloat(0x3C00), 1.f);
+    EXPECT_EQ(HalfToFloat(0xC000), -2.f);
+    EXPECT_EQ(HalfToFloat(0x0001), std::ldexp(1.f, -24));
+    EXPECT_EQ(HalfToFloat(0x7C00), std::numeric_limits<float>::infinity());
+    EXPECT_TRUE(std::isnan(HalfToFloat(0x7E00)));
+
+    for (Uint32 h = 0; h <= 0xFFFF; ++h)
+    {
+        const float f = HalfToFloat(static_cast<Uint16>(h));
+        if ((h & 0x7C00) == 0x7C00 && (h & 0x3FF) != 0)
+            EXPECT_TRUE(std::isnan(f));
+        else
+            EXPECT_EQ(FloatToHalf(f), h) << "h = " << h;
+    }
+}
+
+TEST(GraphicsAccessories_TextureConversion, FloatToHalf)
+{
+    std::vector<float> SrcData = GenerateRandomData<float>(NumPixels * 4, -1.f, 1.f);
+    // Cover denormal, large and special values
+    for (size_t i = 0; i < SrcData.size(); i += 4)
+    {
+        SrcData[i + 1] *= std::ldexp(1.f, -14 - static_cast<int>(i % 12));
+        SrcData[i + 2] *= 70000.f;
+    }
+    SrcData[3] = std::numeric_limits<float>::infinity();
+    SrcData[7] = -std::numeric_limits<float>::infinity();
+    SrcData[8] = -0.f;
+
+    const std::vector<Uint16> DstData = Convert<Uint16>(TEX_FORMAT_RGBA32_FLOAT, 0, SrcData.data(), TEX_FORMAT_RGBA16_FLOAT, 0, 4, TestWidth, TestHeight);
+    for (size_t i = 0; i < SrcData.size(); ++i)
+        EXPECT_EQ(DstData[i], FloatToHalf(SrcData[i])) << "i = " << i << ", value = " << SrcData[i];
+
+    const std::vector<Uint16> NaN = {0x7E00};
+    const std::vector<float>  F32 = Convert<float>(TEX_FORMAT_R16_FLOAT, 0, NaN.data(), TEX_FORMAT_R32_FLOAT, 0, 1, 1, 1);
+    EXPECT_TRUE(std::isnan(F32[0]));
+}
+
+TEST(GraphicsAccessories_TextureConversion, HalfToFloat)
+{
+    std::vector<Uint16> SrcData(0x10000);
+    for (Uint32 h = 0; h < SrcData.size(); ++h)
+        SrcData[h] = static_cast<Uint16>(h);
+
+    const std::vector<float> DstData = Convert<float>(TEX_FORMAT_RG16_FLOAT, 0, SrcData.data(), TEX_FORMAT_RG32_FLOAT, 0, 2, 256, 128);
+    for (size_t h = 0; h < SrcData.size(); ++h)
+    {
+        const float Ref = HalfToFloat(SrcData[h]);
+        if (std::isnan(Ref))
+            EXPECT_TRUE(std::isnan(DstData[h]));
+        else
+            EXPECT_EQ(DstData[h], Ref) << "h = " << h;
+    }
+}
+
+TEST(GraphicsAccessories_TextureConversion, RGB8ToRGBA8)
+{
+    const std::vector<Uint8> SrcData = GenerateRandomBytes(NumPixels * 3);
+
+    const std::vector<Uint8> RGBA = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 3, SrcData.data(), TEX_FORMAT_RGBA8_UNORM, 0, 4, TestWidth, TestHeight);
+    const std::vector<Uint8> BGRA = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 3, SrcData.data(), TEX_FORMAT_BGRA8_UNORM, 0, 4, TestWidth, TestHeight);
+    const std::vector<Uint8> BGR  = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 3, SrcData.data(), TEX_FORMAT_BGRA8_UNORM, 3, 3, TestWidth, TestHeight);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const Uint8* RGB = &SrcData[i * 3];
+        EXPECT_EQ(RGBA[i * 4 + 0], RGB[0]);
+        EXPECT_EQ(RGBA[i * 4 + 1], RGB[1]);
+        EXPECT_EQ(RGBA[i * 4 + 2], RGB[2]);
+        EXPECT_EQ(RGBA[i * 4 + 3], 255);
+
+        EXPECT_EQ(BGRA[i * 4 + 0], RGB[2]);
+        EXPECT_EQ(BGRA[i * 4 + 1], RGB[1]);
+        EXPECT_EQ(BGRA[i * 4 + 2], RGB[0]);
+        EXPECT_EQ(BGRA[i * 4 + 3], 255);
+
+        EXPECT_EQ(BGR[i * 3 + 0], RGB[2]);
+        EXPECT_EQ(BGR[i * 3 + 1], RGB[1]);
+        EXPECT_EQ(BGR[i * 3 + 2], RGB[0]);
+    }
+
+    const std::vector<Uint8> RGB = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 0, RGBA.data(), TEX_FORMAT_RGBA8_UNORM, 3, 3, TestWidth, TestHeight);
+    EXPECT_EQ(RGB, SrcData);
+}
+
+TEST(GraphicsAccessories_TextureConversion, BGRA8ToRGBA8)
+{
+    const std::vector<Uint8> SrcData = GenerateRandomBytes(NumPixels * 4);
+
+    const std::vector<Uint8> RGBA = Convert<Uint8>(TEX_FORMAT_BGRA8_UNORM, 0, SrcData.data(), TEX_FORMAT_RGBA8_UNORM, 0, 4, TestWidth, TestHeight);
+    const std::vector<Uint8> BGRX = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 0, SrcData.data(), TEX_FORMAT_BGRX8_UNORM, 0, 4, TestWidth, TestHeight);
+    const std::vector<Uint8> RGBX = Convert<Uint8>(TEX_FORMAT_BGRX8_UNORM, 0, SrcData.data(), TEX_FORMAT_RGBA8_UNORM, 0, 4, TestWidth, TestHeight);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const Uint8* Src = &SrcData[i * 4];
+        EXPECT_EQ(RGBA[i * 4 + 0], Src[2]);
+        EXPECT_EQ(RGBA[i * 4 + 1], Src[1]);
+        EXPECT_EQ(RGBA[i * 4 + 2], Src[0]);
+        EXPECT_EQ(RGBA[i * 4 + 3], Src[3]);
+
+        EXPECT_EQ(BGRX[i * 4 + 0], Src[2]);
+        EXPECT_EQ(BGRX[i * 4 + 1], Src[1]);
+        EXPECT_EQ(BGRX[i * 4 + 2], Src[0]);
+        EXPECT_EQ(BGRX[i * 4 + 3], 255);
+
+        EXPECT_EQ(RGBX[i * 4 + 0], Src[2]);
+        EXPECT_EQ(RGBX[i * 4 + 1], Src[1]);
+        EXPECT_EQ(RGBX[i * 4 + 2], Src[0]);
+        EXPECT_EQ(RGBX[i * 4 + 3], 255);
+    }
+
+    const std::vector<Uint8> BGRA = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 0, RGBA.data(), TEX_FORMAT_BGRA8_UNORM, 0, 4, TestWidth, TestHeight);
+    EXPECT_EQ(BGRA, SrcData);
+}
+
+TEST(GraphicsAccessories_TextureConversion, SRGB8)
+{
+    const std::vector<Uint8> SrcData = GenerateRandomBytes(NumPixels * 4);
+
+    const std::vector<Uint8> Linear = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM_SRGB, 0, SrcData.data(), TEX_FORMAT_BGRA8_UNORM, 0, 4, TestWidth, TestHeight);
+    const std::vector<Uint8> SRGB   = Convert<Uint8>(TEX_FORMAT_RGBA8_UNORM, 0, SrcData.data(), TEX_FORMAT_RGBA8_UNORM_SRGB, 0, 4, TestWidth, TestHeight);
+    const std::vector<float> Float  = Convert<float>(TEX_FORMAT_RGBA8_UNORM_SRGB, 0, SrcData.data(), TEX_FORMAT_RGBA32_FLOAT, 0, 4, TestWidth, TestHeight);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const Uint8* Src = &SrcData[i * 4];
+        for (size_t c = 0; c < 3; ++c)
+        {
+            EXPECT_EQ(Linear[i * 4 + 2 - c], RefFloatToUnorm8(GammaToLinear(Src[c])));
+            EXPECT_EQ(SRGB[i * 4 + c], RefFloatToUnorm8(LinearToGamma(static_cast<float>(Src[c]) / 255.f)));
+            EXPECT_EQ(Float[i * 4 + c], GammaToLinear(Src[c]));
+        }
+        // Alpha is linear
+        EXPECT_EQ(Linear[i * 4 + 3], Src[3]);
+        EXPECT_EQ(SRGB[i * 4 + 3], Src[3]);
+        EXPECT_EQ(Float[i * 4 + 3], static_cast<float>(Src[3]) / 255.f);
+    }
+}
+
+TEST(GraphicsAccessories_TextureConversion, Unorm8ToFloat)
+{
+    const std::vector<Uint8> SrcData = GenerateRandomBytes(NumPixels * 2);
+
+    const std::vector<float> DstData = Convert<float>(TEX_FORMAT_RG8_UNORM, 0, SrcData.data(), TEX_FORMAT_RG32_FLOAT, 0, 2, TestWidth, TestHeight);
+    for (size_t i = 0; i < SrcData.size(); ++i)
+        EXPECT_EQ(DstData[i], static_cast<float>(SrcData[i]) / 255.f);
+
+    const std::vector<Uint8> Unorm = Convert<Uint8>(TEX_FORMAT_RG32_FLOAT, 0, DstData.data(), TEX_FORMAT_RG8_UNORM, 0, 2, TestWidth, TestHeight);
+    EXPECT_EQ(Unorm, SrcData);
+}
+
+TEST(GraphicsAccessories_TextureConversion, FloatToUnorm8)
+{
+    std::vector<float> SrcData = GenerateRandomData<float>(NumPixels * 4, -0.5f, 1.5f);
+    SrcData[1] = std::numeric_limits<float>::quiet_NaN();
+    SrcData[2] = -0.f;
+    SrcData[5] = 0.5f / 255.f;
+    SrcData[6] = 1.5f / 255.f;
+
+    const std::vector<Uint8> DstData = Convert<Uint8>(TEX_FORMAT_RGBA32_FLOAT, 0, SrcData.data(), TEX_FORMAT_RGBA8_UNORM, 0, 4, TestWidth, TestHeight);
+    for (size_t i = 0; i < SrcData.size(); ++i)
+        EXPECT_EQ(DstData[i], RefFloatToUnorm8(SrcData[i])) << "i = " << i << ", value = " << SrcData[i];
+}
+
+TEST(GraphicsAccessories_TextureConversion, RGB10A2)
+{
+    std::vector<float> SrcData = GenerateRandomData<float>(NumPixels * 4, -0.1f, 1.1f);
+    SrcData[0] = std::numeric_limits<float>::quiet_NaN();
+
+    const auto RefUnorm = [](float f, float Scale) {
+        return std::isnan(f) ? 0u : static_cast<Uint32>(std::lrint(std::min(std::max(f, 0.f), 1.f) * Scale));
+    };
+
+    const std::vector<Uint32> Packed = Convert<Uint32>(TEX_FORMAT_RGBA32_FLOAT, 0, SrcData.data(), TEX_FORMAT_RGB10A2_UNORM, 0, 1, TestWidth, TestHeight);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const float* RGBA = &SrcData[i * 4];
+        const Uint32 Ref  = (RefUnorm(RGBA[0], 1023.f) << 0) |
+            (RefUnorm(RGBA[1], 1023.f) << 10) |
+            (RefUnorm(RGBA[2], 1023.f) << 20) |
+            (RefUnorm(RGBA[3], 3.f) << 30);
+        EXPECT_EQ(Packed[i], Ref) << "i = " << i;
+    }
+
+    const std::vector<float> Unpacked = Convert<float>(TEX_FORMAT_RGB10A2_UNORM, 0, Packed.data(), TEX_FORMAT_RGBA32_FLOAT, 0, 4, TestWidth, TestHeight);
+    for (size_t i = 0; i < NumPixels; ++i)
+    {
+        const Uint32 Val = Packed[i];
+        EXPECT_EQ(Unpacked[i * 4 + 0], static_cast<float>(Val & 0x3FF) / 1023.f);
+        EXPECT_EQ(Unpacked[i * 4 + 1], static_cast<float>((Val >> 10) & 0x3FF) / 1023.f);
+        EXPECT_EQ(Unpacked[i * 4 + 2], static_cast<float>((Val >> 20) & 0x3FF) / 1023.f);
+        EXPECT_EQ(Unpacked[i * 4 + 3], static_cast<float>(Val >> 30) / 3.f);
+    }
+
+    const std::vector<Uint32> Repacked = Convert<Uint32>(TEX_FORMAT_RGBA32_FLOAT, 0, Unpacked.data(), TEX_FORMAT_RGB10A2_UNORM, 0, 1, TestWidth, TestHeight);
+    EXPECT_EQ(Repacked, Packed);
+}
+
+TEST(GraphicsAccessories_TextureConversion, Generic)
+{
+    const std::vector<Int16> SrcData = {-32768, -16384, 0, 32767, 100, -100};
+
+    const std::vector<float> Float = Convert<float>(TEX_FORMAT_RG16_SNORM, 0, SrcData.data(), TEX_FORMAT_RGBA32_FLOAT, 0, 4, 3, 1);
+    EXPECT_EQ(Float[0], -1.f);
+    EXPECT_EQ(Float[1], -16384.f / 32767.f);
+    EXPECT_EQ(Float[2], 0.f);
+    EXPECT_EQ(Float[3], 1.f);
+    EXPECT_EQ(Float[4], 0.f);
+    EXPECT_EQ(Float[5], 1.f);
+    EXPECT_EQ(Float[6], 0.f);
+    EXPECT_EQ(Float[7], 1.f);
+    EXPECT_EQ(Float[8], 100.f / 32767.f);
+    EXPECT_EQ(Float[9], -100.f / 32767.f);
+
+    const std::vector<Uint16> Unorm16 = Convert<Uint16>(TEX_FORMAT_RG16_SNORM, 0, SrcData.data(), TEX_FORMAT_RGBA16_UNORM, 0, 4, 3, 1);
+    const std::vector<Uint16> RefUnorm16{0, 0, 0, 65535, 0, 65535, 0, 65535, 200, 0, 0, 65535};
+    EXPECT_EQ(Unorm16, RefUnorm16);
+
+    const std::vector<Uint8> Uint8Data = Convert<Uint8>(TEX_FORMAT_RG16_SINT, 0, SrcData.data(), TEX_FORMAT_RG8_UINT, 0, 2, 3, 1);
+    const std::vector<Uint8> RefUint8{0, 0, 0, 255, 100, 0};
+    EXPECT_EQ(Uint8Data, RefUint8);
+}
+
+TEST(GraphicsAccessories_TextureConversion, Strides)
+{
+    constexpr size_t SrcStride = TestWidth * 3 + 5;
+    constexpr size_t DstStride = TestWidth * 4 + 12;
+
+    const std::vector<Uint8> SrcData = GenerateRandomBytes(SrcStride * TestHeight);
+    std::vector<Uint8>       DstData(DstStride * TestHeight, 0xCD);
+
+    ConvertTextureDataAttribs Attribs;
+    Attribs.SrcFormat        = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    Attribs.SrcNumComponents = 3;
+    Attribs.pSrcData         = SrcData.data();
+    Attribs.SrcStride        = SrcStride;
+    Attribs.DstFormat        = TEX_FORMAT_BGRA8_UNORM_SRGB;
+    Attribs.pDstData         = DstData.data();
+    Attribs.DstStride        = DstStride;
+    Attribs.Width            = TestWidth;
+    Attribs.Height           = TestHeight;
+    EXPECT_TRUE(ConvertTextureData(Attribs));
+
+    for (size_t y = 0; y < TestHeight; ++y)
+    {
+        for (size_t x = 0; x < TestWidth; ++x)
+        {
+            const Uint8* Src = &SrcData[y * SrcStride + x * 3];
+            const Uint8* Dst = &DstData[y * DstStride + x * 4];
+            EXPECT_EQ(Dst[0], Src[2]);
+            EXPECT_EQ(Dst[1], Src[1]);
+            EXPECT_EQ(Dst[2], Src[0]);
+            EXPECT_EQ(Dst[3], 255);
+        }
+        for (size_t i = TestWidth * 4; i < DstStride; ++i)
+            EXPECT_EQ(DstData[y * DstStride + i], 0xCD);
+    }
+}
+
+TEST(GraphicsAccessories_TextureConversion, Parallel)
+{
+    constexpr Uint32 Width  = 512;
+    constexpr Uint32 Height = 300;
+
+    const std::vector<float> SrcData = GenerateRandomData<float>(size_t{Width} * Height * 4, -1.f, 2.f);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{3});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (TEXTURE_FORMAT DstFormat : {TEX_FORMAT_RGBA16_FLOAT, TEX_FORMAT_RGBA16_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB})
+    {
+        const std::vector<Uint16> Ref = Convert<Uint16>(TEX_FORMAT_RGBA32_FLOAT, 0, SrcData.data(), DstFormat, 0, 4, Width, Height);
+        const std::vector<Uint16> Res = Convert<Uint16>(TEX_FORMAT_RGBA32_FLOAT, 0, SrcData.data(), DstFormat, 0, 4, Width, Height, pThreadPool);
+        EXPECT_EQ(Ref, Res);
+    }
+}
+
+TEST(GraphicsAccessories_TextureConversion, InvalidArguments)
+{
+    std::vector<Uint8> Data(64);
+
+    ConvertTextureDataAttribs Attribs;
+    Attribs.pSrcData  = Data.data();
+    Attribs.pDstData  = Data.data() + 32;
+    Attribs.Width     = 2;
+    Attribs.Height    = 2;
+    Attribs.SrcFormat = TEX_FORMAT_BC1_UNORM;
+    Attribs.DstFormat = TEX_FORMAT_RGBA8_UNORM;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Source format TEX_FORMAT_BC1_UNORM is not supported"};
+        EXPECT_FALSE(ConvertTextureData(Attribs));
+    }
+
+    Attribs.SrcFormat = TEX_FORMAT_RGBA8_UNORM;
+    Attribs.DstFormat = TEX_FORMAT_D32_FLOAT;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Destination format TEX_FORMAT_D32_FLOAT is not supported"};
+        EXPECT_FALSE(ConvertTextureData(Attribs));
+    }
+
+    Attribs.DstFormat        = TEX_FORMAT_R32_FLOAT;
+    Attribs.SrcNumComponents = 5;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Source component count (5) is not valid"};
+        EXPECT_FALSE(ConvertTextureData(Attribs));
+    }
+}
+
+} // namespace
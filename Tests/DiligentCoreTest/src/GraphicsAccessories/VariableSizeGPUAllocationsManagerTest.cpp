@@ -249,4 +249,68 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFirstFit)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+    VariableSizeAllocationsManager ListMgr(128, Allocator);
+
+    VariableSizeAllocationsManager::Allocation al[8];
+    for (size_t o = 0; o < _countof(al); ++o)
+        al[o] = ListMgr.Allocate(16, 1);
+    EXPECT_TRUE(ListMgr.IsFull());
+
+    // Free blocks: [16, 48), [80, 96), [112, 128)
+    ListMgr.Free(std::move(al[1]));
+    ListMgr.Free(std::move(al[2]));
+    ListMgr.Free(std::move(al[5]));
+    ListMgr.Free(std::move(al[7]));
+
+    // Best fit picks the smallest block
+    {
+        auto a = ListMgr.Allocate(16, 1);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{80});
+        ListMgr.Free(std::move(a));
+    }
+
+    // First fit picks the block with the lowest offset
+    {
+        auto a = ListMgr.AllocateFirstFit(16, 1, 128);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        EXPECT_EQ(a.Size, OffsetType{16});
+        ListMgr.Free(std::move(a));
+    }
+
+    // Only blocks below the max offset are considered
+    {
+        auto a = ListMgr.AllocateFirstFit(24, 1, 16);
+        EXPECT_FALSE(a.IsValid());
+
+        a = ListMgr.AllocateFirstFit(24, 1, 17);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        ListMgr.Free(std::move(a));
+
+        a = ListMgr.AllocateFirstFit(40, 1, 128);
+        EXPECT_FALSE(a.IsValid());
+    }
+
+    // Aligned first-fit allocation
+    {
+        auto a = ListMgr.AllocateFirstFit(5, 8, 128);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        EXPECT_EQ(a.Size, OffsetType{8});
+        ListMgr.Free(std::move(a));
+    }
+
+    for (size_t o = 0; o < _countof(al); ++o)
+    {
+        if (al[o].IsValid())
+            ListMgr.Free(std::move(al[o]));
+    }
+    EXPECT_TRUE(ListMgr.IsEmpty());
+}
+
 } // namespace
@@ -30,6 +30,8 @@
 #include "gtest/gtest.h"
 
 #include <array>
+#include <string>
+#include <vector>
 
 using namespace Diligent;
 
@@ -179,4 +181,66 @@ TEST(PipelineResourceSignatureBaseTest, Compatibility)
     }
 }
 
+TEST(PipelineResourceSignatureBaseTest, ImmutableSamplerNameIndex)
+{
+    // Signatures use the name index when they have 16 or more immutable samplers
+    std::vector<std::string> Names;
+    std::vector<SHADER_TYPE> Stages;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const std::string TexName = "g_Tex" + std::to_string(i);
+
+        Names.push_back(TexName);
+        Stages.push_back(i % 2 == 0 ? SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL : SHADER_TYPE_VERTEX);
+
+        // Sampler whose name is the texture name with the combined sampler suffix. It is defined in the stages
+        // where the texture sampler is not, so that looking up the suffixed name in these stages only matches
+        // this sampler if the suffix is not used.
+        Names.push_back(TexName + "_sampler");
+        Stages.push_back(i % 2 == 0 ? SHADER_TYPE_COMPUTE : SHADER_TYPE_PIXEL);
+    }
+    // Samplers with the same name in different stages
+    Names.push_back("g_Tex0");
+    Stages.push_back(SHADER_TYPE_COMPUTE);
+    Names.push_back("g_Tex1_sampler");
+    Stages.push_back(SHADER_TYPE_VERTEX);
+    Names.push_back("g_Sam");
+    Stages.push_back(SHADER_TYPE_PIXEL);
+    Names.push_back("g_Sam");
+    Stages.push_back(SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL);
+
+    std::vector<ImmutableSamplerDesc> Samplers;
+    for (size_t i = 0; i < Names.size(); ++i)
+        Samplers.emplace_back(Stages[i], Names[i].c_str(), Sam_LinearClamp);
+    ASSERT_GE(Samplers.size(), size_t{16});
+
+    const SHADER_TYPE TestStages[] = {SHADER_TYPE_VERTEX, SHADER_TYPE_PIXEL, SHADER_TYPE_COMPUTE, SHADER_TYPE_GEOMETRY};
+
+    std::vector<std::string> TestNames = Names;
+    for (const std::string& Name : Names)
+        TestNames.push_back(Name + "_sampler");
+    TestNames.push_back("g_Missing");
+
+    for (const char* Suffix : {static_cast<const char*>(nullptr), "", "_sampler"})
+    {
+        PipelineResourceNameIndex NameIndex;
+        AddImmutableSamplersToNameIndex(NameIndex, Samplers.data(), static_cast<Uint32>(Samplers.size()), Suffix);
+
+        // The index is only used with the suffix it was populated with, or without a suffix
+        for (const char* SearchSuffix : {static_cast<const char*>(nullptr), Suffix})
+        {
+            for (const std::string& Name : TestNames)
+            {
+                for (SHADER_TYPE Stage : TestStages)
+                {
+                    const Uint32 RefIdx = FindImmutableSampler(Samplers.data(), static_cast<Uint32>(Samplers.size()), Stage, Name.c_str(), SearchSuffix);
+                    const Uint32 Idx    = FindImmutableSampler(NameIndex, Samplers.data(), Stage, Name.c_str(), SearchSuffix);
+                    EXPECT_EQ(Idx, RefIdx) << "Name: " << Name << ", stage: " << GetShaderTypeLiteralName(Stage)
+                                           << ", suffix: " << (SearchSuffix != nullptr ? SearchSuffix : "<null>");
+                }
+            }
+        }
+    }
+}
+
 } // namespace
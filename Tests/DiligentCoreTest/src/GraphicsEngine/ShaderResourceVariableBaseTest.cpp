@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/ShaderResourceVariableBase.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+// Minimal variable manager that provides what ShaderVariableNameHash::Initialize() needs
+class TestVariableManager
+{
+public:
+    struct Variable
+    {
+        const char* Name = nullptr;
+
+        void GetResourceDesc(ShaderResourceDesc& ResDesc) const
+        {
+            ResDesc      = {};
+            ResDesc.Name = Name;
+        }
+    };
+
+    explicit TestVariableManager(const std::vector<std::string>& Names)
+    {
+        m_Vars.resize(Names.size());
+        for (size_t i = 0; i < Names.size(); ++i)
+            m_Vars[i].Name = Names[i].c_str();
+    }
+
+    Uint32          GetVariableCount() const { return static_cast<Uint32>(m_Vars.size()); }
+    const Variable* GetVariable(Uint32 Index) const { return &m_Vars[Index]; }
+
+private:
+    std::vector<Variable> m_Vars;
+};
+
+// Smallest power of two table that keeps the load factor at or below 0.5, same as in ShaderVariableNameHash
+size_t GetTableSize(size_t NumVars)
+{
+    size_t TableSize = 1;
+    while (TableSize < NumVars * 2)
+        TableSize *= 2;
+    return TableSize;
+}
+
+void TestNameHash(const std::vector<std::string>& Names)
+{
+    const TestVariableManager Mgr{Names};
+
+    ShaderVariableNameHash NameHash;
+    EXPECT_FALSE(NameHash.IsInitialized());
+    NameHash.Initialize(Mgr);
+    EXPECT_TRUE(NameHash.IsInitialized());
+
+    for (Uint32 i = 0; i < Names.size(); ++i)
+    {
+        // Use a copy to make sure that names are compared by value
+        const std::string Name = Names[i];
+        EXPECT_EQ(NameHash.Find(Name.c_str()), i) << Name;
+    }
+
+    EXPECT_EQ(NameHash.Find(""), ShaderVariableNameHash::InvalidIndex);
+    EXPECT_EQ(NameHash.Find("MissingVariable"), ShaderVariableNameHash::InvalidIndex);
+    EXPECT_EQ(NameHash.Find((Names[0] + "_").c_str()), ShaderVariableNameHash::InvalidIndex);
+    EXPECT_EQ(NameHash.Find(Names[0].substr(0, Names[0].length() - 1).c_str()), ShaderVariableNameHash::InvalidIndex);
+}
+
+TEST(ShaderResourceVariableBaseTest, NameHashLookup)
+{
+    for (size_t NumVars : {size_t{ShaderVariableNameHash::MinVariableCount}, size_t{100}, size_t{1000}})
+    {
+        std::vector<std::string> Names;
+        for (size_t i = 0; i < NumVars; ++i)
+            Names.emplace_back("g_Variable" + std::to_string(i));
+        TestNameHash(Names);
+    }
+}
+
+TEST(ShaderResourceVariableBaseTest, NameHashCollisions)
+{
+    constexpr size_t NumVars = ShaderVariableNameHash::MinVariableCount;
+
+    // Select names that all map to the same slot, so that every lookup has to probe
+    // past the other names and every missing name has to walk the whole cluster.
+    const size_t Mask = GetTableSize(NumVars) - 1;
+
+    std::vector<std::string> Names;
+    std::vector<std::string> MissingNames;
+    for (size_t i = 0; Names.size() < NumVars || MissingNames.size() < 4; ++i)
+    {
+        std::string Name = "g_Tex" + std::to_string(i);
+        if ((CStringHash<Char>{}(Name.c_str()) & Mask) != 0)
+            continue;
+        if (Names.size() < NumVars)
+            Names.emplace_back(std::move(Name));
+        else
+            MissingNames.emplace_back(std::move(Name));
+    }
+    TestNameHash(Names);
+
+    const TestVariableManager Mgr{Names};
+
+    ShaderVariableNameHash NameHash;
+    NameHash.Initialize(Mgr);
+    for (const std::string& Name : MissingNames)
+        EXPECT_EQ(NameHash.Find(Name.c_str()), ShaderVariableNameHash::InvalidIndex) << Name;
+}
+
+TEST(ShaderResourceVariableBaseTest, NameHashDuplicates)
+{
+    std::vector<std::string> Names;
+    for (size_t i = 0; i < ShaderVariableNameHash::MinVariableCount; ++i)
+        Names.emplace_back("g_Buffer" + std::to_string(i % 4));
+
+    const TestVariableManager Mgr{Names};
+
+    ShaderVariableNameHash NameHash;
+    NameHash.Initialize(Mgr);
+
+    // Same as the linear search, the first variable with the name is returned
+    for (Uint32 i = 0; i < 4; ++i)
+        EXPECT_EQ(NameHash.Find(Names[i].c_str()), i);
+}
+
+} // namespace
@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ResolvingShaderSourceFactory.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class ShaderSourceDirectories
+{
+public:
+    ShaderSourceDirectories() :
+        m_Dir0{m_TmpDir.Get() + FileSystem::SlashSymbol + "Dir0"},
+        m_Dir1{m_TmpDir.Get() + FileSystem::SlashSymbol + "Dir1"}
+    {
+        FileSystem::CreateDirectory(m_Dir0.c_str());
+        FileSystem::CreateDirectory(m_Dir1.c_str());
+    }
+
+    void WriteFile(Uint32 Dir, const char* Name, const std::string& Source) const
+    {
+        const std::string Path = (Dir == 0 ? m_Dir0 : m_Dir1) + FileSystem::SlashSymbol + Name;
+        EXPECT_TRUE(FileWrapper::WriteFile(Path.c_str(), Source.data(), Source.size())) << Path;
+    }
+
+    std::string GetSearchDirectories() const
+    {
+        return m_Dir0 + ";" + m_Dir1;
+    }
+
+private:
+    TempDirectory m_TmpDir;
+    std::string   m_Dir0;
+    std::string   m_Dir1;
+};
+
+RefCntAutoPtr<IResolvingShaderSourceFactory> CreateFactory(const ShaderSourceDirectories& Dirs, IThreadPool* pThreadPool = nullptr)
+{
+    const std::string SearchDirs = Dirs.GetSearchDirectories();
+
+    RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory;
+    CreateResolvingShaderSourceFactory({SearchDirs.c_str(), pThreadPool}, &pFactory);
+    return pFactory;
+}
+
+std::string ReadSource(IShaderSourceInputStreamFactory* pFactory, const char* Name)
+{
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+    if (!pStream)
+        return "<null>";
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    pStream->ReadBlob(pData);
+    return std::string{pData->GetConstDataPtr<char>(), pData->GetSize()};
+}
+
+TEST(ResolvingShaderSourceFactoryTest, Resolve)
+{
+    ShaderSourceDirectories Dirs;
+    Dirs.WriteFile(0, "Common.fxh", "// Common 0");
+    Dirs.WriteFile(1, "Common.fxh", "// Common 1");
+    Dirs.WriteFile(1, "Shader.fx", "#include \"Common.fxh\"");
+
+    RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory = CreateFactory(Dirs);
+    ASSERT_NE(pFactory, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pSourceFactory{pFactory, IID_IShaderSourceInputStreamFactory};
+    EXPECT_NE(pSourceFactory, nullptr);
+
+    EXPECT_EQ(ReadSource(pFactory, "Common.fxh"), "// Common 0");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.fx"), "#include \"Common.fxh\"");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "<null>");
+
+    // The factory does not see the file system changes until Refresh() is called
+    Dirs.WriteFile(0, "Missing.fxh", "// Not missing any more");
+    Dirs.WriteFile(1, "Shader.fx", "// Modified");
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "<null>");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.fx"), "#include \"Common.fxh\"");
+
+    EXPECT_EQ(pFactory->Refresh(), 2u);
+    EXPECT_EQ(ReadSource(pFactory, "Missing.fxh"), "// Not missing any more");
+    EXPECT_EQ(ReadSource(pFactory, "Shader.fx"), "// Modified");
+    EXPECT_EQ(pFactory->Refresh(), 0u);
+}
+
+TEST(ResolvingShaderSourceFactoryTest, ClosureHash)
+{
+    ShaderSourceDirectories Dirs;
+    Dirs.WriteFile(0, "Shader1.fx", "#include \"Include1.fxh\"\n#include \"Include2.fxh\"\n");
+    Dirs.WriteFile(0, "Shader2.fx", "#include \"Include2.fxh\"\n");
+    Dirs.WriteFile(1, "Include1.fxh", "#include \"Include3.fxh\"\n// Include1\n");
+    Dirs.WriteFile(0, "Include2.fxh", "// Include2\n");
+    Dirs.WriteFile(1, "Include3.fxh", "// Include3\n");
+
+    RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory = CreateFactory(Dirs);
+    ASSERT_NE(pFactory, nullptr);
+
+    EXPECT_EQ(pFactory->GetClosureHash("Missing.fx"), Uint64{0});
+
+    const Uint64 Hash1 = pFactory->GetClosureHash("Shader1.fx");
+    const Uint64 Hash2 = pFactory->GetClosureHash("Shader2.fx");
+    EXPECT_NE(Hash1, Uint64{0});
+    EXPECT_NE(Hash2, Uint64{0});
+    EXPECT_NE(Hash1, Hash2);
+
+    // Modify the file that is only included by Shader1
+    Dirs.WriteFile(1, "Include3.fxh", "// Include3 modified\n");
+    EXPECT_EQ(pFactory->GetClosureHash("Shader1.fx"), Hash1);
+    EXPECT_EQ(pFactory->Refresh(), 1u);
+
+    const Uint64 Hash1_2 = pFactory->GetClosureHash("Shader1.fx");
+    EXPECT_NE(Hash1_2, Hash1);
+    EXPECT_EQ(pFactory->GetClosureHash("Shader2.fx"), Hash2);
+
+    // Shadow the include file in the first search directory
+    Dirs.WriteFile(0, "Include3.fxh", "// Include3 modified\n");
+    EXPECT_EQ(pFactory->Refresh(), 1u);
+    EXPECT_NE(pFactory->GetClosureHash("Shader1.fx"), Hash1_2);
+    EXPECT_EQ(pFactory->GetClosureHash("Shader2.fx"), Hash2);
+
+    // Add a new include to Shader2
+    Dirs.WriteFile(0, "Shader2.fx", "#include \"Include2.fxh\"\n#include \"Include4.fxh\"\n");
+    Dirs.WriteFile(1, "Include4.fxh", "// Include4\n");
+    EXPECT_EQ(pFactory->Refresh(), 1u);
+    const Uint64 Hash2_2 = pFactory->GetClosureHash("Shader2.fx");
+    EXPECT_NE(Hash2_2, Hash2);
+    EXPECT_EQ(ReadSource(pFactory, "Include4.fxh"), "// Include4\n");
+
+    Dirs.WriteFile(1, "Include4.fxh", "// Include4 modified\n");
+    EXPECT_EQ(pFactory->Refresh(), 1u);
+    EXPECT_NE(pFactory->GetClosureHash("Shader2.fx"), Hash2_2);
+}
+
+TEST(ResolvingShaderSourceFactoryTest, Prefetch)
+{
+    ShaderSourceDirectories Dirs;
+
+    // Shader.fx includes 50 files, each of which includes 2 more files
+    constexpr Uint32 NumIncludes = 50;
+    std::string      ShaderSource;
+    for (Uint32 i = 0; i < NumIncludes; ++i)
+    {
+        const std::string Name = "Include" + std::to_string(i) + ".fxh";
+        ShaderSource += "#include \"" + Name + "\"\n";
+        Dirs.WriteFile(i % 2,
+                       Name.c_str(),
+                       "#include \"Nested" + std::to_string(i) + ".fxh\"\n" +
+                           "#include \"Nested" + std::to_string((i + 1) % NumIncludes) + ".fxh\"\n");
+        Dirs.WriteFile((i + 1) % 2, ("Nested" + std::to_string(i) + ".fxh").c_str(), "// Nested " + std::to_string(i));
+    }
+    Dirs.WriteFile(1, "Shader.fx", ShaderSource);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    RefCntAutoPtr<IDataBlob> pGraph;
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory = CreateFactory(Dirs, pPool);
+        ASSERT_NE(pFactory, nullptr);
+
+        const char* Names[] = {"Shader.fx", "Missing.fx"};
+        EXPECT_EQ(pFactory->Prefetch(Names, _countof(Names)), 1 + NumIncludes * 2);
+        EXPECT_EQ(pFactory->Prefetch(Names, _countof(Names)), 0u);
+        EXPECT_EQ(ReadSource(pFactory, "Nested7.fxh"), "// Nested 7");
+
+        if (!pGraph)
+            pFactory->Store(&pGraph);
+    }
+    ASSERT_NE(pGraph, nullptr);
+
+    // The dependency graph loaded from the blob allows reading the entire closure at once
+    RefCntAutoPtr<IResolvingShaderSourceFactory> pFactory = CreateFactory(Dirs, pThreadPool);
+    ASSERT_NE(pFactory, nullptr);
+    EXPECT_TRUE(pFactory->Load(pGraph));
+
+    RefCntAutoPtr<IResolvingShaderSourceFactory> pRefFactory = CreateFactory(Dirs);
+    EXPECT_EQ(pFactory->GetClosureHash("Shader.fx"), pRefFactory->GetClosureHash("Shader.fx"));
+    EXPECT_EQ(ReadSource(pFactory, "Include3.fxh"), "#include \"Nested3.fxh\"\n#include \"Nested4.fxh\"\n");
+
+    RefCntAutoPtr<IDataBlob> pGraph2;
+    pFactory->Store(&pGraph2);
+    ASSERT_NE(pGraph2, nullptr);
+    EXPECT_EQ(pGraph2->GetSize(), pGraph->GetSize());
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Incorrect shader dependency graph header"};
+
+        RefCntAutoPtr<DataBlobImpl> pInvalidData = DataBlobImpl::Create(16);
+        EXPECT_FALSE(pFactory->Load(pInvalidData));
+    }
+}
+
+} // namespace
@@ -0,0 +1,420 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureStreamingScheduler.hpp"
+#include "TextureUploaderBase.hpp"
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class MockTexture final : public ObjectBase<ITexture>
+{
+public:
+    MockTexture(IReferenceCounters* pRefCounters, const TextureDesc& Desc) :
+        ObjectBase<ITexture>{pRefCounters},
+        m_Desc{Desc}
+    {}
+
+    virtual const TextureDesc& DILIGENT_CALL_TYPE GetDesc() const override final { return m_Desc; }
+    virtual Int32 DILIGENT_CALL_TYPE              GetUniqueID() const override final { return 0; }
+    virtual void DILIGENT_CALL_TYPE               SetUserData(IObject* pUserData) override final {}
+    virtual IObject* DILIGENT_CALL_TYPE           GetUserData() const override final { return nullptr; }
+    virtual void DILIGENT_CALL_TYPE               CreateView(const TextureViewDesc& ViewDesc, ITextureView** ppView) override final {}
+    virtual ITextureView* DILIGENT_CALL_TYPE      GetDefaultView(TEXTURE_VIEW_TYPE ViewType) override final { return nullptr; }
+    virtual Uint64 DILIGENT_CALL_TYPE             GetNativeHandle() override final { return 0; }
+    virtual void DILIGENT_CALL_TYPE               SetState(RESOURCE_STATE State) override final {}
+    virtual RESOURCE_STATE DILIGENT_CALL_TYPE     GetState() const override final { return RESOURCE_STATE_UNKNOWN; }
+
+    virtual const SparseTextureProperties& DILIGENT_CALL_TYPE GetSparseProperties() const override final
+    {
+        static const SparseTextureProperties Props;
+        return Props;
+    }
+
+private:
+    const TextureDesc m_Desc;
+};
+
+class MockUploadBuffer final : public UploadBufferBase
+{
+public:
+    MockUploadBuffer(IReferenceCounters* pRefCounters, const UploadBufferDesc& Desc) :
+        UploadBufferBase{pRefCounters, Desc}
+    {}
+
+    virtual void WaitForCopyScheduled() override final {}
+};
+
+// Texture uploader that records scheduled copies instead of executing them
+class MockTextureUploader final : public ObjectBase<ITextureUploader>
+{
+public:
+    struct CopyInfo
+    {
+        ITexture* pDstTexture;
+        Uint32    ArraySlice;
+        Uint32    MipLevel;
+    };
+
+    MockTextureUploader(IReferenceCounters* pRefCounters) :
+        ObjectBase<ITextureUploader>{pRefCounters}
+    {}
+
+    virtual void RenderThreadUpdate(IDeviceContext* pContext) override final {}
+
+    virtual void AllocateUploadBuffer(IDeviceContext*         pContext,
+                                      const UploadBufferDesc& Desc,
+                                      IUploadBuffer**         ppBuffer) override final
+    {
+        ++NumAllocations;
+        *ppBuffer = MakeNewRCObj<MockUploadBuffer>()(Desc);
+        (*ppBuffer)->AddRef();
+    }
+
+    virtual void ScheduleGPUCopy(IDeviceContext* pContext,
+                                 ITexture*       pDstTexture,
+                                 Uint32          ArraySlice,
+                                 Uint32          MipLevel,
+                                 IUploadBuffer*  pUploadBuffer) override final
+    {
+        Copies.push_back({pDstTexture, ArraySlice, MipLevel});
+    }
+
+    virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final
+    {
+        ++NumRecycledBuffers;
+    }
+
+    virtual void DiscardBuffer(IDeviceContext* pContext, IUploadBuffer* pUploadBuffer) override final
+    {
+        EXPECT_NE(pUploadBuffer, nullptr);
+        NumDiscardedBuffers.fetch_add(1);
+    }
+
+    virtual TextureUploaderStats GetStats() override final
+    {
+        return {};
+    }
+
+    std::atomic<Uint32>   NumAllocations{0};
+    Uint32                NumRecycledBuffers = 0;
+    std::atomic<Uint32>   NumDiscardedBuffers{0};
+    std::vector<CopyInfo> Copies;
+};
+
+RefCntAutoPtr<ITexture> CreateMockTexture(Uint32 Width, Uint32 Height, Uint32 MipLevels = 1)
+{
+    TextureDesc Desc;
+    Desc.Name      = "Mock texture";
+    Desc.Type      = RESOURCE_DIM_TEX_2D;
+    Desc.Width     = Width;
+    Desc.Height    = Height;
+    Desc.MipLevels = MipLevels;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    return RefCntAutoPtr<ITexture>{MakeNewRCObj<MockTexture>()(Desc)};
+}
+
+RefCntAutoPtr<ITextureStreamingScheduler> CreateScheduler(ITextureUploader* pUploader,
+                                                          IThreadPool*      pThreadPool,
+                                                          Uint32            MaxRequestsInFlight = 16,
+                                                          Uint64            MaxBytesPerUpdate   = 0)
+{
+    TextureStreamingSchedulerCreateInfo CI;
+    CI.pUploader           = pUploader;
+    CI.pThreadPool         = pThreadPool;
+    CI.MaxRequestsInFlight = MaxRequestsInFlight;
+    CI.MaxBytesPerUpdate   = MaxBytesPerUpdate;
+
+    RefCntAutoPtr<ITextureStreamingScheduler> pScheduler;
+    CreateTextureStreamingScheduler(CI, &pScheduler);
+    return pScheduler;
+}
+
+TEST(TextureStreamingSchedulerTest, PriorityOrder)
+{
+    RefCntAutoPtr<MockTextureUploader> pUploader{MakeNewRCObj<MockTextureUploader>()()};
+
+    auto pScheduler = CreateScheduler(pUploader, nullptr);
+    ASSERT_NE(pScheduler, nullptr);
+
+    constexpr float Priorities[] = {1, 3, 2, 3, 0};
+
+    std::vector<RefCntAutoPtr<ITexture>> Textures;
+    std::vector<size_t>                  LoadOrder;
+    std::vector<size_t>                  CompleteOrder;
+    for (size_t i = 0; i < _countof(Priorities); ++i)
+    {
+        Textures.emplace_back(CreateMockTexture(64, 64, 4));
+
+        TextureStreamingRequestDesc ReqDesc;
+        ReqDesc.pDstTexture = Textures.back();
+        ReqDesc.FirstMip    = 1;
+        ReqDesc.Priority    = Priorities[i];
+        ReqDesc.LoadData    = [i, &LoadOrder](IUploadBuffer* pBuffer) {
+            const auto& BuffDesc = pBuffer->GetDesc();
+            EXPECT_EQ(BuffDesc.Width, 32u);
+            EXPECT_EQ(BuffDesc.Height, 32u);
+            EXPECT_EQ(BuffDesc.MipLevels, 3u);
+            LoadOrder.push_back(i);
+            return true;
+        };
+        ReqDesc.OnComplete = [i, &CompleteOrder](bool Success) {
+            EXPECT_TRUE(Success);
+            CompleteOrder.push_back(i);
+        };
+        EXPECT_NE(pScheduler->EnqueueRequest(ReqDesc), InvalidTextureStreamingRequestId);
+    }
+
+    // Data is loaded by the first update and copied by the second one
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(LoadOrder, (std::vector<size_t>{1, 3, 2, 0, 4}));
+    EXPECT_TRUE(pUploader->Copies.empty());
+    EXPECT_EQ(pScheduler->GetStats().NumReadyRequests, 5u);
+
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(CompleteOrder, (std::vector<size_t>{1, 3, 2, 0, 4}));
+    ASSERT_EQ(pUploader->Copies.size(), CompleteOrder.size());
+    for (size_t i = 0; i < CompleteOrder.size(); ++i)
+    {
+        EXPECT_EQ(pUploader->Copies[i].pDstTexture, Textures[CompleteOrder[i]]);
+        EXPECT_EQ(pUploader->Copies[i].MipLevel, 1u);
+    }
+    EXPECT_EQ(pUploader->NumRecycledBuffers, 5u);
+
+    const auto Stats = pScheduler->GetStats();
+    EXPECT_EQ(Stats.NumPendingRequests, 0u);
+    EXPECT_EQ(Stats.NumLoadingRequests, 0u);
+    EXPECT_EQ(Stats.NumReadyRequests, 0u);
+    EXPECT_EQ(Stats.NumCompletedRequests, 5u);
+    EXPECT_EQ(Stats.BytesUploaded, 5u * (32 * 32 + 16 * 16 + 8 * 8) * 4);
+}
+
+TEST(TextureStreamingSchedulerTest, Budget)
+{
+    RefCntAutoPtr<MockTextureUploader> pUploader{MakeNewRCObj<MockTextureUploader>()()};
+
+    constexpr Uint64 TexDataSize = 64 * 64 * 4;
+
+    auto pScheduler = CreateScheduler(pUploader, nullptr, 3, TexDataSize * 2);
+    ASSERT_NE(pScheduler, nullptr);
+
+    auto pTexture = CreateMockTexture(64, 64);
+
+    constexpr Uint32 NumRequests = 7;
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        TextureStreamingRequestDesc ReqDesc;
+        ReqDesc.pDstTexture = pTexture;
+        ReqDesc.LoadData    = [](IUploadBuffer*) { return true; };
+        pScheduler->EnqueueRequest(ReqDesc);
+    }
+
+    // Only three requests may hold upload buffers
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(pScheduler->GetStats().NumReadyRequests, 3u);
+    EXPECT_EQ(pScheduler->GetStats().NumPendingRequests, 4u);
+
+    const Uint32 RefCopies[] = {2, 2, 2, 1};
+    for (Uint32 RefNumCopies : RefCopies)
+    {
+        pScheduler->Update(nullptr);
+        const auto Stats = pScheduler->GetStats();
+        EXPECT_EQ(Stats.LastUpdateNumCopies, RefNumCopies);
+        EXPECT_EQ(Stats.LastUpdateBytes, RefNumCopies * TexDataSize);
+        EXPECT_LE(Stats.NumReadyRequests, 3u);
+    }
+    EXPECT_EQ(pUploader->Copies.size(), size_t{NumRequests});
+    // Upload buffers are recycled by the uploader
+    EXPECT_EQ(pUploader->NumAllocations.load(), NumRequests);
+
+    // At least one copy is scheduled even if it exceeds the budget
+    auto pLargeTexture = CreateMockTexture(256, 256);
+    {
+        TextureStreamingRequestDesc ReqDesc;
+        ReqDesc.pDstTexture = pLargeTexture;
+        ReqDesc.LoadData    = [](IUploadBuffer*) { return true; };
+        pScheduler->EnqueueRequest(ReqDesc);
+    }
+    pScheduler->Update(nullptr);
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(pScheduler->GetStats().LastUpdateNumCopies, 1u);
+    EXPECT_EQ(pScheduler->GetStats().LastUpdateBytes, Uint64{256 * 256 * 4});
+}
+
+TEST(TextureStreamingSchedulerTest, ReprioritizeAndCancel)
+{
+    RefCntAutoPtr<MockTextureUploader> pUploader{MakeNewRCObj<MockTextureUploader>()()};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    auto pScheduler = CreateScheduler(pUploader, pThreadPool, 3);
+    ASSERT_NE(pScheduler, nullptr);
+
+    auto pTexture = CreateMockTexture(32, 32);
+
+    std::vector<Uint32>       LoadOrder;
+    std::vector<Uint32>       CompleteOrder;
+    TextureStreamingRequestId Ids[5] = {};
+    for (Uint32 i = 0; i < _countof(Ids); ++i)
+    {
+        TextureStreamingRequestDesc ReqDesc;
+        ReqDesc.pDstTexture = pTexture;
+        ReqDesc.ArraySlice  = 0;
+        ReqDesc.LoadData    = [i, &LoadOrder](IUploadBuffer*) {
+            LoadOrder.push_back(i);
+            return i != 4;
+        };
+        ReqDesc.OnComplete = [i, &CompleteOrder](bool Success) {
+            EXPECT_EQ(Success, i != 4);
+            CompleteOrder.push_back(i);
+        };
+        Ids[i] = pScheduler->EnqueueRequest(ReqDesc);
+    }
+
+    // Requests 0, 1, 2 start loading, 3 and 4 are pending
+    pScheduler->Update(nullptr);
+    {
+        const auto Stats = pScheduler->GetStats();
+        EXPECT_EQ(Stats.NumLoadingRequests, 3u);
+        EXPECT_EQ(Stats.NumPendingRequests, 2u);
+    }
+
+    EXPECT_TRUE(pScheduler->SetRequestPriority(Ids[2], 10));
+    EXPECT_TRUE(pScheduler->CancelRequest(Ids[1]));
+    EXPECT_FALSE(pScheduler->CancelRequest(Ids[1]));
+    EXPECT_TRUE(pScheduler->SetRequestPriority(Ids[4], 5));
+    EXPECT_TRUE(pScheduler->CancelRequest(Ids[3]));
+
+    while (pThreadPool->GetQueueSize() > 0)
+        pThreadPool->ProcessTask(0, false);
+    EXPECT_EQ(LoadOrder, (std::vector<Uint32>{2, 0}));
+
+    // Copies 2 and 0; the buffer of the cancelled request 1 is returned to the uploader
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(CompleteOrder, (std::vector<Uint32>{2, 0}));
+    EXPECT_EQ(pUploader->NumAllocations.load(), 4u);
+    EXPECT_EQ(pUploader->NumDiscardedBuffers.load(), 1u);
+
+    while (pThreadPool->GetQueueSize() > 0)
+        pThreadPool->ProcessTask(0, false);
+    pScheduler->Update(nullptr);
+    EXPECT_EQ(LoadOrder, (std::vector<Uint32>{2, 0, 4}));
+    EXPECT_EQ(CompleteOrder, (std::vector<Uint32>{2, 0, 4}));
+    EXPECT_EQ(pUploader->Copies.size(), size_t{2});
+    // The buffer of the failed request 4 is discarded too
+    EXPECT_EQ(pUploader->NumDiscardedBuffers.load(), 2u);
+    EXPECT_EQ(pUploader->NumRecycledBuffers, 2u);
+
+    const auto Stats = pScheduler->GetStats();
+    EXPECT_EQ(Stats.NumCompletedRequests, 2u);
+    EXPECT_EQ(Stats.NumFailedRequests, 1u);
+    EXPECT_EQ(Stats.NumCancelledRequests, 2u);
+    EXPECT_EQ(Stats.NumPendingRequests + Stats.NumLoadingRequests + Stats.NumReadyRequests, 0u);
+
+    EXPECT_FALSE(pScheduler->SetRequestPriority(Ids[0], 1));
+    EXPECT_FALSE(pScheduler->CancelRequest(Ids[4]));
+}
+
+TEST(TextureStreamingSchedulerTest, DiscardBuffersOnDestruction)
+{
+    RefCntAutoPtr<MockTextureUploader> pUploader{MakeNewRCObj<MockTextureUploader>()()};
+
+    auto pTexture = CreateMockTexture(32, 32);
+    {
+        auto pScheduler = CreateScheduler(pUploader, nullptr);
+        ASSERT_NE(pScheduler, nullptr);
+
+        constexpr Uint32 NumRequests = 3;
+        for (Uint32 i = 0; i < NumRequests; ++i)
+        {
+            TextureStreamingRequestDesc ReqDesc;
+            ReqDesc.pDstTexture = pTexture;
+            ReqDesc.LoadData    = [](IUploadBuffer*) { return true; };
+            pScheduler->EnqueueRequest(ReqDesc);
+        }
+
+        // All requests are loaded, but none of them is copied
+        pScheduler->Update(nullptr);
+        EXPECT_EQ(pScheduler->GetStats().NumReadyRequests, NumRequests);
+        EXPECT_EQ(pUploader->NumDiscardedBuffers.load(), 0u);
+    }
+
+    // Buffers of the requests that have never been copied must be returned to the uploader
+    EXPECT_EQ(pUploader->NumDiscardedBuffers.load(), 3u);
+    EXPECT_TRUE(pUploader->Copies.empty());
+}
+
+TEST(TextureStreamingSchedulerTest, Multithreaded)
+{
+    RefCntAutoPtr<MockTextureUploader> pUploader{MakeNewRCObj<MockTextureUploader>()()};
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    auto pScheduler = CreateScheduler(pUploader, pThreadPool, 8);
+    ASSERT_NE(pScheduler, nullptr);
+
+    auto pTexture = CreateMockTexture(16, 16, 5);
+
+    constexpr Uint32    NumRequests = 256;
+    std::atomic<Uint32> NumLoaded{0};
+    Uint32              NumCompleted = 0;
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        TextureStreamingRequestDesc ReqDesc;
+        ReqDesc.pDstTexture = pTexture;
+        ReqDesc.FirstMip    = i % 5;
+        ReqDesc.Priority    = static_cast<float>(i % 7);
+        ReqDesc.LoadData    = [&NumLoaded](IUploadBuffer*) {
+            NumLoaded.fetch_add(1);
+            return true;
+        };
+        ReqDesc.OnComplete = [&NumCompleted](bool) { ++NumCompleted; };
+        pScheduler->EnqueueRequest(ReqDesc);
+    }
+
+    while (NumCompleted < NumRequests)
+    {
+        pScheduler->Update(nullptr);
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(NumLoaded.load(), NumRequests);
+    EXPECT_EQ(pUploader->Copies.size(), size_t{NumRequests});
+    EXPECT_EQ(pScheduler->GetStats().NumCompletedRequests, Uint64{NumRequests});
+}
+
+} // namespace
@@ -133,6 +133,11 @@ TEST(VertexPoolXTest, VertexPoolCreateInfoX)
         EXPECT_NE(Ref, CIX);
         Ref.DisableDebugValidation = true;
         EXPECT_EQ(Ref, CIX);
+
+        CIX.SetEnableCompaction(true);
+        EXPECT_NE(Ref, CIX);
+        Ref.EnableCompaction = true;
+        EXPECT_EQ(Ref, CIX);
     }
 
     {
@@ -27,9 +27,17 @@
 
 #include "PlatformMisc.hpp"
 
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
+
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -114,4 +122,176 @@ TEST(Platforms_PlatformMisc, SwapBytes)
     EXPECT_EQ(PlatformMisc::SwapBytes(fswap), f);
 }
 
+TEST(Platforms_PlatformMisc, ProcessorSet)
+{
+    ProcessorSet Set;
+    EXPECT_TRUE(Set.IsEmpty());
+    EXPECT_EQ(Set.Count(), 0u);
+    EXPECT_EQ(Set.FindNext(0), ~0u);
+
+    for (Uint32 Proc : {0u, 5u, 63u, 64u, 130u, 191u})
+        Set.Set(Proc);
+    EXPECT_FALSE(Set.IsEmpty());
+    EXPECT_EQ(Set.Count(), 6u);
+    EXPECT_TRUE(Set.IsSet(63));
+    EXPECT_TRUE(Set.IsSet(130));
+    EXPECT_FALSE(Set.IsSet(129));
+    EXPECT_FALSE(Set.IsSet(1000));
+    EXPECT_EQ(Set.GetMask64(), (Uint64{1} << 0) | (Uint64{1} << 5) | (Uint64{1} << 63));
+
+    std::vector<Uint32> Processors;
+    for (Uint32 Proc = Set.FindNext(0); Proc != ~0u; Proc = Set.FindNext(Proc + 1))
+        Processors.push_back(Proc);
+    EXPECT_EQ(Processors, (std::vector<Uint32>{0, 5, 63, 64, 130, 191}));
+    EXPECT_EQ(Set.FindNext(65), 130u);
+
+    Set.Reset(130);
+    Set.Reset(191);
+    EXPECT_EQ(Set.Count(), 4u);
+    EXPECT_EQ(Set.FindNext(65), ~0u);
+
+    // Trailing zero words must not affect comparison
+    ProcessorSet Set2{(Uint64{1} << 0) | (Uint64{1} << 5) | (Uint64{1} << 63)};
+    EXPECT_NE(Set, Set2);
+    Set2.Set(64);
+    EXPECT_EQ(Set, Set2);
+
+    ProcessorSet Set3;
+    Set3.Set(100);
+    Set3 |= Set2;
+    EXPECT_EQ(Set3.Count(), 5u);
+    EXPECT_TRUE(Set3.IsSet(5));
+    EXPECT_TRUE(Set3.IsSet(100));
+}
+
+template <typename PlatformClass>
+void TestCPUTopology()
+{
+    const CPUTopology Topology = PlatformClass::GetCPUTopology();
+    ASSERT_FALSE(Topology.Processors.empty());
+    EXPECT_GT(Topology.NumCores, 0u);
+    EXPECT_LE(Topology.NumCores, Topology.Processors.size());
+    EXPECT_GT(Topology.NumL3Domains, 0u);
+    EXPECT_LE(Topology.NumL3Domains, Topology.NumCores);
+    EXPECT_GT(Topology.NumNUMANodes, 0u);
+
+    for (size_t i = 0; i < Topology.Processors.size(); ++i)
+    {
+        const CPUTopology::Processor& Proc = Topology.Processors[i];
+        if (i > 0)
+        {
+            EXPECT_GT(Proc.Id, Topology.Processors[i - 1].Id);
+        }
+        EXPECT_LT(Proc.CoreId, Topology.NumCores);
+        EXPECT_LT(Proc.L3DomainId, Topology.NumL3Domains);
+        EXPECT_LT(Proc.NUMANodeId, Topology.NumNUMANodes);
+    }
+}
+
+TEST(Platforms_PlatformMisc, GetCPUTopology)
+{
+    TestCPUTopology<PlatformMisc>();
+    TestCPUTopology<BasicPlatformMisc>();
+}
+
+TEST(Platforms_PlatformMisc, SetCurrentThreadAffinity)
+{
+#if PLATFORM_LINUX || PLATFORM_WIN32
+    // Allow all processors so that the test does not change the scheduling of the test thread
+    ProcessorSet AllProcessors;
+    for (const CPUTopology::Processor& Proc : PlatformMisc::GetCPUTopology().Processors)
+        AllProcessors.Set(Proc.Id);
+    EXPECT_TRUE(PlatformMisc::SetCurrentThreadAffinity(AllProcessors));
+#endif
+    EXPECT_FALSE(PlatformMisc::SetCurrentThreadAffinity(ProcessorSet{}));
+}
+
+#if PLATFORM_LINUX
+void WriteSysfsFile(const std::string& Dir, const char* Name, const std::string& Contents)
+{
+    ASSERT_TRUE(FileSystem::PathExists(Dir.c_str()) || FileSystem::CreateDirectory(Dir.c_str()));
+
+    const std::string Path = Dir + "/" + Name;
+    FileWrapper       File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File);
+    EXPECT_TRUE(File->Write(Contents.data(), Contents.size()));
+}
+
+TEST(Platforms_PlatformMisc, LinuxSysfsCPUTopology)
+{
+    // 2 NUMA nodes x 5 L3 domains x 8 cores x 2 SMT threads.
+    // As on real systems, SMT siblings of core N are processors N and N + NumCores.
+    constexpr Uint32 NumCores       = 80;
+    constexpr Uint32 CoresPerDomain = 8;
+    constexpr Uint32 CoresPerNode   = 40;
+
+    TempDirectory     TmpDir;
+    const std::string SysfsPath = TmpDir.Get();
+    const std::string CPUPath   = SysfsPath + "/cpu";
+    const std::string NodePath  = SysfsPath + "/node";
+
+    WriteSysfsFile(CPUPath, "online", std::to_string(0) + "-" + std::to_string(NumCores * 2 - 1) + "\n");
+    for (Uint32 CPU = 0; CPU < NumCores * 2; ++CPU)
+    {
+        const Uint32      Core     = CPU % NumCores;
+        const std::string CPUDir   = CPUPath + "/cpu" + std::to_string(CPU);
+        const std::string Siblings = std::to_string(Core) + "," + std::to_string(Core + NumCores) + "\n";
+        // Older kernels only provide thread_siblings_list
+        WriteSysfsFile(CPUDir + "/topology", (CPU % 2) ? "core_cpus_list" : "thread_siblings_list", Siblings);
+
+        WriteSysfsFile(CPUDir + "/cache/index0", "level", "1\n");
+        WriteSysfsFile(CPUDir + "/cache/index0", "shared_cpu_list", Siblings);
+        WriteSysfsFile(CPUDir + "/cache/index1", "level", "2\n");
+        WriteSysfsFile(CPUDir + "/cache/index1", "shared_cpu_list", Siblings);
+
+        const Uint32 FirstDomainCore = Core / CoresPerDomain * CoresPerDomain;
+        const Uint32 LastDomainCore  = FirstDomainCore + CoresPerDomain - 1;
+        WriteSysfsFile(CPUDir + "/cache/index2", "level", "3\n");
+        WriteSysfsFile(CPUDir + "/cache/index2", "shared_cpu_list",
+                       std::to_string(FirstDomainCore) + "-" + std::to_string(LastDomainCore) + "," +
+                           std::to_string(FirstDomainCore + NumCores) + "-" + std::to_string(LastDomainCore + NumCores) + "\n");
+    }
+
+    WriteSysfsFile(NodePath, "online", "0-1\n");
+    WriteSysfsFile(NodePath + "/node0", "cpulist", "0-39,80-119\n");
+    WriteSysfsFile(NodePath + "/node1", "cpulist", "40-79,120-159\n");
+
+    const CPUTopology Topology = LinuxMisc::GetCPUTopology(SysfsPath.c_str());
+    ASSERT_EQ(Topology.Processors.size(), size_t{NumCores * 2});
+    EXPECT_EQ(Topology.NumCores, NumCores);
+    EXPECT_EQ(Topology.NumL3Domains, NumCores / CoresPerDomain);
+    EXPECT_EQ(Topology.NumNUMANodes, 2u);
+
+    for (Uint32 CPU = 0; CPU < NumCores * 2; ++CPU)
+    {
+        const CPUTopology::Processor& Proc = Topology.Processors[CPU];
+        const Uint32                  Core = CPU % NumCores;
+        EXPECT_EQ(Proc.Id, CPU);
+        EXPECT_EQ(Proc.CoreId, Core) << CPU;
+        EXPECT_EQ(Proc.L3DomainId, Core / CoresPerDomain) << CPU;
+        EXPECT_EQ(Proc.NUMANodeId, Core / CoresPerNode) << CPU;
+    }
+}
+
+TEST(Platforms_PlatformMisc, LinuxSysfsCPUTopologyUnknownNode)
+{
+    TempDirectory     TmpDir;
+    const std::string SysfsPath = TmpDir.Get();
+    const std::string NodePath  = SysfsPath + "/node";
+
+    // Only node 1 is online, and it does not list processors 2 and 3
+    WriteSysfsFile(SysfsPath + "/cpu", "online", "0-3\n");
+    WriteSysfsFile(NodePath, "online", "1\n");
+    WriteSysfsFile(NodePath + "/node1", "cpulist", "0-1\n");
+
+    const CPUTopology Topology = LinuxMisc::GetCPUTopology(SysfsPath.c_str());
+    ASSERT_EQ(Topology.Processors.size(), size_t{4});
+    EXPECT_EQ(Topology.NumNUMANodes, 2u);
+    EXPECT_EQ(Topology.Processors[0].NUMANodeId, 0u);
+    EXPECT_EQ(Topology.Processors[1].NUMANodeId, 0u);
+    EXPECT_EQ(Topology.Processors[2].NUMANodeId, 1u);
+    EXPECT_EQ(Topology.Processors[3].NUMANodeId, 1u);
+}
+#endif
+
 } // namespace
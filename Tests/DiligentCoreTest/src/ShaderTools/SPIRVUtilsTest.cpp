@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVUtils.hpp"
+#include "SPIRVModuleIndex.hpp"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// SPIR-V opcodes, decorations and enums used by the tests (see spirv.hpp)
+// clang-format off
+constexpr uint32_t OpName           = 5;
+constexpr uint32_t OpTypeInt        = 21;
+constexpr uint32_t OpTypeFloat      = 22;
+constexpr uint32_t OpTypeVector     = 23;
+constexpr uint32_t OpTypeImage      = 25;
+constexpr uint32_t OpTypeArray      = 28;
+constexpr uint32_t OpTypePointer    = 32;
+constexpr uint32_t OpConstant       = 43;
+constexpr uint32_t OpFunction       = 54;
+constexpr uint32_t OpFunctionEnd    = 56;
+constexpr uint32_t OpVariable       = 59;
+constexpr uint32_t OpDecorate       = 71;
+constexpr uint32_t OpDecorateString = 5632;
+
+constexpr uint32_t DecorationLocation           = 30;
+constexpr uint32_t DecorationBinding            = 33;
+constexpr uint32_t DecorationDescriptorSet      = 34;
+constexpr uint32_t DecorationHlslSemanticGOOGLE = 5635;
+
+constexpr uint32_t StorageClassUniformConstant = 0;
+constexpr uint32_t StorageClassInput           = 1;
+constexpr uint32_t StorageClassFunction        = 7;
+
+constexpr uint32_t Dim2D               = 1;
+constexpr uint32_t ImageFormatUnknown  = 0;
+constexpr uint32_t ImageFormatRgba32f  = 1;
+constexpr uint32_t ImageFormatRgba8    = 4;
+// clang-format on
+
+class SPIRVBuilder
+{
+public:
+    explicit SPIRVBuilder(uint32_t Bound) :
+        m_SPIRV{0x07230203, 0x00010000, 0, Bound, 0}
+    {}
+
+    SPIRVBuilder& Instr(uint32_t OpCode, std::initializer_list<uint32_t> Operands, const char* Str = nullptr)
+    {
+        const size_t StrWords  = Str != nullptr ? strlen(Str) / 4 + 1 : 0;
+        const size_t WordCount = 1 + Operands.size() + StrWords;
+        m_SPIRV.push_back(OpCode | static_cast<uint32_t>(WordCount << 16u));
+        m_SPIRV.insert(m_SPIRV.end(), Operands.begin(), Operands.end());
+        if (Str != nullptr)
+        {
+            const size_t Offset = m_SPIRV.size();
+            m_SPIRV.resize(Offset + StrWords, 0);
+            memcpy(&m_SPIRV[Offset], Str, strlen(Str));
+        }
+        return *this;
+    }
+
+    size_t GetSize() const { return m_SPIRV.size(); }
+
+    std::vector<uint32_t>&& Get() { return std::move(m_SPIRV); }
+
+private:
+    std::vector<uint32_t> m_SPIRV;
+};
+
+// Ids of the test module
+enum : uint32_t
+{
+    IdFloat = 1,
+    IdRWImage,
+    IdRWImagePtr,
+    IdRWTex,
+    IdImage,
+    IdImagePtr,
+    IdTex,
+    IdUint,
+    IdUint4,
+    IdRWImageArr,
+    IdRWImageArrPtr,
+    IdRWTexArr,
+    IdFloat4,
+    IdFloat4InPtr,
+    IdPos,
+    IdFuncType,
+    IdFunc,
+    IdLocalVar,
+    IdBound
+};
+
+struct TestModule
+{
+    std::vector<uint32_t> SPIRV;
+
+    size_t RWImageTypeOffset   = 0;
+    size_t ImageTypeOffset     = 0;
+    size_t RWTexBindingOffset  = 0;
+    size_t RWTexDescrSetOffset = 0;
+    size_t PosLocationOffset   = 0;
+    size_t NumInstructions     = 0;
+};
+
+TestModule CreateTestModule()
+{
+    TestModule   Module;
+    SPIRVBuilder Builder{IdBound};
+
+    // clang-format off
+    Builder
+        .Instr(OpName, {IdRWTex},    "g_RWTex")
+        .Instr(OpName, {IdTex},      "g_Tex")
+        .Instr(OpName, {IdRWTexArr}, "g_RWTexArr")
+        .Instr(OpName, {IdPos},      "in_var_ATTRIB3");
+
+    Module.RWTexBindingOffset = Builder.GetSize() + 3;
+    Builder.Instr(OpDecorate, {IdRWTex, DecorationBinding, 5});
+    Module.RWTexDescrSetOffset = Builder.GetSize() + 3;
+    Builder.Instr(OpDecorate, {IdRWTex, DecorationDescriptorSet, 1});
+    Module.PosLocationOffset = Builder.GetSize() + 3;
+    Builder
+        .Instr(OpDecorate,       {IdPos, DecorationLocation, 0})
+        .Instr(OpDecorateString, {IdPos, DecorationHlslSemanticGOOGLE}, "ATTRIB3")
+        .Instr(OpTypeFloat,      {IdFloat, 32});
+
+    //                                    Result      Sampled Type  Dim   Depth Arrayed MS Sampled  Format
+    Module.RWImageTypeOffset = Builder.GetSize();
+    Builder.Instr(OpTypeImage,   {IdRWImage, IdFloat,       Dim2D,  0,    0,      0, 2,       ImageFormatUnknown});
+    Builder.Instr(OpTypePointer, {IdRWImagePtr, StorageClassUniformConstant, IdRWImage});
+    Builder.Instr(OpVariable,    {IdRWImagePtr, IdRWTex, StorageClassUniformConstant});
+
+    Module.ImageTypeOffset = Builder.GetSize();
+    Builder.Instr(OpTypeImage,   {IdImage,   IdFloat,       Dim2D,  0,    0,      0, 1,       ImageFormatUnknown});
+    Builder
+        .Instr(OpTypePointer, {IdImagePtr, StorageClassUniformConstant, IdImage})
+        .Instr(OpVariable,    {IdImagePtr, IdTex, StorageClassUniformConstant})
+        .Instr(OpTypeInt,     {IdUint, 32, 0})
+        .Instr(OpConstant,    {IdUint, IdUint4, 4})
+        .Instr(OpTypeArray,   {IdRWImageArr, IdRWImage, IdUint4})
+        .Instr(OpTypePointer, {IdRWImageArrPtr, StorageClassUniformConstant, IdRWImageArr})
+        .Instr(OpVariable,    {IdRWImageArrPtr, IdRWTexArr, StorageClassUniformConstant})
+        .Instr(OpTypeVector,  {IdFloat4, IdFloat, 4})
+        .Instr(OpTypePointer, {IdFloat4InPtr, StorageClassInput, IdFloat4})
+        .Instr(OpVariable,    {IdFloat4InPtr, IdPos, StorageClassInput})
+        .Instr(OpFunction,    {IdFloat, IdFunc, 0, IdFuncType})
+        .Instr(OpVariable,    {IdFloat4InPtr, IdLocalVar, StorageClassFunction})
+        .Instr(OpFunctionEnd, {});
+    // clang-format on
+
+    Module.NumInstructions = 26;
+    Module.SPIRV           = Builder.Get();
+    return Module;
+}
+
+TEST(SPIRVUtils, InstructionIterator)
+{
+    const TestModule Module = CreateTestModule();
+
+    size_t NumInstructions = 0;
+    for (const SPIRVInstructionIterator& Instr : SPIRVInstructions{Module.SPIRV})
+    {
+        if (NumInstructions == 0)
+        {
+            EXPECT_EQ(Instr.GetOpCode(), OpName);
+            EXPECT_EQ(Instr.GetOffset(), SPIRVInstructions::HeaderSize);
+            EXPECT_EQ(Instr[1], Uint32{IdRWTex});
+        }
+        ++NumInstructions;
+    }
+    EXPECT_EQ(NumInstructions, Module.NumInstructions);
+
+    // The last instruction does not fit into the truncated module
+    std::vector<uint32_t> Truncated = Module.SPIRV;
+    Truncated.resize(Module.RWImageTypeOffset + 4);
+    NumInstructions = 0;
+    for (const SPIRVInstructionIterator& Instr : SPIRVInstructions{Truncated})
+    {
+        EXPECT_LT(Instr.GetOffset(), Module.RWImageTypeOffset);
+        ++NumInstructions;
+    }
+    EXPECT_EQ(NumInstructions, size_t{9});
+
+    // Zero word count terminates the iteration
+    std::vector<uint32_t> Invalid = Module.SPIRV;
+    Invalid[SPIRVInstructions::HeaderSize] = 0;
+    EXPECT_TRUE(SPIRVInstructions{Invalid}.begin() == SPIRVInstructions{Invalid}.end());
+}
+
+TEST(SPIRVUtils, ModuleIndex)
+{
+    const TestModule       Module = CreateTestModule();
+    const SPIRVModuleIndex Index{Module.SPIRV};
+
+    EXPECT_EQ(Index.GetIdBound(), Uint32{IdBound});
+    EXPECT_EQ(Index.GetDefinitionOffset(IdRWImage), Module.RWImageTypeOffset);
+    EXPECT_EQ(Index.GetOpCode(IdRWImage), OpTypeImage);
+    EXPECT_EQ(Index.GetOpCode(IdUint4), OpConstant);
+    EXPECT_EQ(Index.GetOpCode(IdFuncType), 0u);
+    EXPECT_EQ(Index.GetDefinitionOffset(IdBound + 10), SPIRVModuleIndex::InvalidOffset);
+
+    EXPECT_STREQ(Index.GetName(IdRWTex), "g_RWTex");
+    EXPECT_STREQ(Index.GetName(IdRWTexArr), "g_RWTexArr");
+    EXPECT_EQ(Index.GetName(IdRWImage), nullptr);
+
+    EXPECT_EQ(Index.GetDecorationOffset(IdRWTex, DecorationBinding), Module.RWTexBindingOffset);
+    EXPECT_EQ(Index.GetDecorationOffset(IdRWTex, DecorationDescriptorSet), Module.RWTexDescrSetOffset);
+    EXPECT_EQ(Index.GetDecorationOffset(IdTex, DecorationBinding), SPIRVModuleIndex::InvalidOffset);
+    EXPECT_EQ(Index.GetDecorationOffset(IdPos, DecorationLocation), Module.PosLocationOffset);
+    EXPECT_EQ(Module.SPIRV[Module.RWTexBindingOffset], 5u);
+    EXPECT_EQ(Module.SPIRV[Module.RWTexDescrSetOffset], 1u);
+
+    EXPECT_STREQ(Index.GetDecorationString(IdPos, DecorationHlslSemanticGOOGLE), "ATTRIB3");
+    EXPECT_EQ(Index.GetDecorationString(IdRWTex, DecorationHlslSemanticGOOGLE), nullptr);
+
+    EXPECT_EQ(Index.GetStorageClass(IdRWTex), StorageClassUniformConstant);
+    EXPECT_EQ(Index.GetStorageClass(IdPos), StorageClassInput);
+    EXPECT_EQ(Index.GetStorageClass(IdRWImage), ~0u);
+
+    EXPECT_EQ(Index.GetBaseTypeId(IdRWTex), Uint32{IdRWImage});
+    EXPECT_EQ(Index.GetBaseTypeId(IdRWTexArr), Uint32{IdRWImage});
+    EXPECT_EQ(Index.GetBaseTypeId(IdPos), Uint32{IdFloat4});
+    EXPECT_EQ(Index.GetBaseTypeId(IdFloat), 0u);
+
+    std::vector<uint32_t> GlobalVars;
+    Index.ProcessGlobalVariables([&GlobalVars](uint32_t VarId) { GlobalVars.push_back(VarId); });
+    EXPECT_EQ(GlobalVars, (std::vector<uint32_t>{IdRWTex, IdTex, IdRWTexArr, IdPos}));
+
+    EXPECT_TRUE(HasStorageImages(Index));
+}
+
+TEST(SPIRVUtils, PatchImageFormats)
+{
+    const TestModule Module = CreateTestModule();
+
+    std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ImageFormats;
+    ImageFormats.emplace("g_RWTex", TEX_FORMAT_RGBA8_UNORM);
+    ImageFormats.emplace("g_Tex", TEX_FORMAT_RGBA32_FLOAT);
+
+    const std::vector<uint32_t> Patched = PatchImageFormats(Module.SPIRV, ImageFormats);
+    ASSERT_EQ(Patched.size(), Module.SPIRV.size());
+    EXPECT_EQ(Patched[Module.RWImageTypeOffset + 8], ImageFormatRgba8);
+    // Sampled images are not patched
+    EXPECT_EQ(Patched[Module.ImageTypeOffset + 8], ImageFormatUnknown);
+
+    // g_RWTexArr shares the image type with g_RWTex
+    ImageFormats.clear();
+    ImageFormats.emplace("g_RWTexArr", TEX_FORMAT_RGBA32_FLOAT);
+
+    std::vector<uint32_t>  SPIRV = Module.SPIRV;
+    const SPIRVModuleIndex Index{SPIRV};
+    PatchImageFormats(SPIRV, Index, ImageFormats);
+    EXPECT_EQ(SPIRV[Module.RWImageTypeOffset + 8], ImageFormatRgba32f);
+}
+
+TEST(SPIRVUtils, MapHLSLVertexShaderInputs)
+{
+    TestModule             Module = CreateTestModule();
+    const SPIRVModuleIndex Index{Module.SPIRV};
+
+    MapHLSLVertexShaderInputs(Module.SPIRV, Index);
+    EXPECT_EQ(Module.SPIRV[Module.PosLocationOffset], 3u);
+}
+
+} // namespace
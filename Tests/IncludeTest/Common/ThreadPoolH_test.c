@@ -56,4 +56,7 @@ void TestThreadPool()
     IThreadPool_StopThreads((IThreadPool*)NULL);
     bool MoreTasks = IThreadPool_ProcessTask((IThreadPool*)NULL, 1, true);
     (void)MoreTasks;
+    size_t ScratchSize    = 0;
+    void*  pScratchMemory = IThreadPool_GetThreadScratchMemory((IThreadPool*)NULL, 0, &ScratchSize);
+    (void)pScratchMemory;
 }
@@ -48,4 +48,7 @@ void TestPipelineResourceSignature(struct IPipelineResourceSignature* pSign)
     IPipelineResourceSignature_InitializeStaticSRBResources(pSign, (struct IShaderResourceBinding*)NULL);
 
     IPipelineResourceSignature_CopyStaticResources(pSign, (struct IPipelineResourceSignature*)NULL);
+
+    SRBMemoryStats Stats = IPipelineResourceSignature_GetSRBMemoryStats(pSign);
+    (void)Stats;
 }
@@ -47,6 +47,7 @@ void TestRenderStateCacheCInterface()
     IRenderStateCache_WriteToStream(pCache, 1234, (IFileStream*)NULL);
     IRenderStateCache_Reset(pCache);
     IRenderStateCache_Reload(pCache, NULL, NULL);
+    IRenderStateCache_NotifyFileChanged(pCache, "Shader.fx");
     Uint32 Ver = IRenderStateCache_GetContentVersion(pCache);
     (void)Ver;
 }